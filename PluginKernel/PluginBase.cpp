@@ -34,7 +34,7 @@ PluginBase::~PluginBase()
         delete *it;
     }
     pluginParameters.clear();
-    pluginParameterMap.clear();
+    pluginParameterRegistry.clear();
 	delete [] pluginParameterArray;
 }
 
@@ -47,7 +47,8 @@ PluginParameter* PluginBase::getPluginParameterByIndex(int32_t index)
 
 PluginParameter* PluginBase::getPluginParameterByControlID(int32_t controlID)
 {
-    return pluginParameterMap[controlID];
+    int32_t index = pluginParameterRegistry.getIndex(controlID);
+    return index >= 0 ? pluginParameters[index] : nullptr;
 }
 
 /*
@@ -208,12 +209,12 @@ bool PluginBase::updateOutBoundVariables()
 // --- returns array index for vector access
 int32_t PluginBase::addPluginParameter(PluginParameter* piParam, double sampleRate)
 {
-    // --- map for controlID-indexing
-    pluginParameterMap.insert(std::make_pair(piParam->getControlID(), piParam));
-
     // --- vector for fast iteration and 0-indexing
     pluginParameters.push_back(piParam);
 
+    // --- registry for controlID-indexing
+    pluginParameterRegistry.addIndex(piParam->getControlID(), (int32_t)pluginParameters.size() - 1);
+
     // --- first intialization, this can change
     piParam->initParamSmoother(sampleRate);
 
@@ -268,10 +269,18 @@ bool PluginBase::initPresetParameters(std::vector<PresetParameter>& presetParame
 
 bool PluginBase::setPresetParameter(std::vector<PresetParameter>& presetParameters, uint32_t _controlID, double _controlValue)
 {
+    // --- lists from initPresetParameters( ) are in pluginParameters order: O(1)
+    int32_t index = pluginParameterRegistry.getIndex(_controlID);
+    if(index >= 0 && (uint32_t)index < presetParameters.size() && presetParameters[index].controlID == _controlID)
+    {
+        presetParameters[index].actualValue = _controlValue;
+        return true;
+    }
+
+    // --- any other list: search it
     bool foundIt = false;
     for(std::vector<PresetParameter>::iterator it = presetParameters.begin(); it !=  presetParameters.end(); ++it)
     {
-        //PresetParameter preParam = *it;
         if((*it).controlID == _controlID)
         {
             (*it).actualValue = _controlValue;
@@ -254,12 +254,11 @@ protected:
 	PluginParameter** pluginParameterArray = nullptr;
 	uint32_t numPluginParameters = 0;
 
-    // --- vectorized version of pluginParameterMap for fast iteration when key not needed
+    // --- parameters in creation order, for fast iteration when key not needed; pluginParameterRegistry indexes it by controlID
     std::vector<PluginParameter*> pluginParameters;
 
-    // --- map<controlID , PluginParameter*>
-    typedef std::map<uint32_t, PluginParameter*> pluginParameterControlIDMap;
-    pluginParameterControlIDMap pluginParameterMap;
+    // --- controlID -> pluginParameters index; also indexes preset parameter lists, which are built in the same order
+    ParameterRegistry pluginParameterRegistry;
 
     // --- plugin core -> host (wrap) connector
     IPluginHostConnector* pluginHostConnector; // created and destroyed on host
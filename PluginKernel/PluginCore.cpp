@@ -11,6 +11,7 @@
 
 #include "pluginCore.h"
 #include "plugindescription.h"
+#include <chrono>
 
 PluginCore::PluginCore()
 {
@@ -57,12 +58,16 @@ PluginCore::PluginCore()
 	// --- finish inits
 	synthEngine = new SynthEngine;
 
+	// --- the user's patch bank, browsed with the "Bank Page" and "Bank Patch" controls
+	patchBankPath = getPatchBankPath();
+	openPatchBank(patchBankPath.c_str());
+
 }
 
 bool PluginCore::initPluginParameters()
 {
 	// ADDED BY RACKAFX -- DO NOT EDIT THIS CODE!!! -------------------------------------- //
-	if (pluginParameterMap.size() > 0)
+	if (pluginParameters.size() > 0)
 		return true;
 
 	// **--0xDEA7--**
@@ -100,7 +105,7 @@ bool PluginCore::initPluginParameters()
 	addPluginParameter(piParam);
 
 	// --- discrete control: Osc1 Wave
-	piParam = new PluginParameter(controlID::osc1Wave, "Osc1 Wave", "Saw,Square,Triangle,Sin,WhiteNoise", "Saw");
+	piParam = new PluginParameter(controlID::osc1Wave, "Osc1 Wave", "Saw,Square,Triangle,Sin,WhiteNoise,Supersaw", "Saw");
 	piParam->setBoundVariable(&osc1Wave, boundVariableType::kInt);
 	addPluginParameter(piParam);
 
@@ -119,7 +124,7 @@ bool PluginCore::initPluginParameters()
 	addPluginParameter(piParam);
 
 	// --- discrete control: Osc2 Wave
-	piParam = new PluginParameter(controlID::osc2Wave, "Osc2 Wave", "Saw,Square,Triangle,Sin,WhiteNoise", "Saw");
+	piParam = new PluginParameter(controlID::osc2Wave, "Osc2 Wave", "Saw,Square,Triangle,Sin,WhiteNoise,Supersaw", "Saw");
 	piParam->setBoundVariable(&osc2Wave, boundVariableType::kInt);
 	addPluginParameter(piParam);
 
@@ -371,12 +376,12 @@ bool PluginCore::initPluginParameters()
 	addPluginParameter(piParam);
 
 	// --- discrete control: Mod Source 1
-	piParam = new PluginParameter(controlID::modSource1, "Mod Source 1", "None,LFO1 Out,LFO1 InvOut,LFO2 Out,LFO2 InvOut,EG1 Out,EG1 BiasOut,EG2 Out,EG2 BiasOut,Osc1 Out,Osc2 Out,SubOsc Out", "None");
+	piParam = new PluginParameter(controlID::modSource1, "Mod Source 1", "None,LFO1 Out,LFO1 InvOut,LFO2 Out,LFO2 InvOut,EG1 Out,EG1 BiasOut,EG2 Out,EG2 BiasOut,Osc1 Out,Osc2 Out,SubOsc Out,MPE Bend,MPE Pressure,MPE Slide,MSEG Out,GLFO1 Out,GLFO1 InvOut,GLFO2 Out,GLFO2 InvOut", "None");
 	piParam->setBoundVariable(&modSource1, boundVariableType::kInt);
 	addPluginParameter(piParam);
 
 	// --- discrete control: Mod Dest 1
-	piParam = new PluginParameter(controlID::modDest1, "Mod Dest 1", "None,Osc1 Pitch,Osc2 Pitch,All Osc Pitch,Osc1 PW,Osc2 PW,SubOsc PW,All Osc PW,Filter1 fc,Filter1 Q,Filter2 fc,Filter2 Q,EG1 Repeat mSec,EG2 Repeat mSec,EG1 Repeat SubDiv,EG2 Repeat SubDiv,DCA Amp,DCA Pan,DelayFX Mix,DelayFX FB,Chorus Depth", "None");
+	piParam = new PluginParameter(controlID::modDest1, "Mod Dest 1", "None,Osc1 Pitch,Osc2 Pitch,All Osc Pitch,Osc1 PW,Osc2 PW,SubOsc PW,All Osc PW,Filter1 fc,Filter1 Q,Filter2 fc,Filter2 Q,EG1 Repeat mSec,EG2 Repeat mSec,EG1 Repeat SubDiv,EG2 Repeat SubDiv,DCA Amp,DCA Pan,DelayFX Mix,DelayFX FB,Chorus Depth,FM Pitch", "None");
 	piParam->setBoundVariable(&modDest1, boundVariableType::kInt);
 	addPluginParameter(piParam);
 
@@ -388,12 +393,12 @@ bool PluginCore::initPluginParameters()
 	addPluginParameter(piParam);
 
 	// --- discrete control: Mod Source 2
-	piParam = new PluginParameter(controlID::modSource2, "Mod Source 2", "None,LFO1 Out,LFO1 InvOut,LFO2 Out,LFO2 InvOut,EG1 Out,EG1 BiasOut,EG2 Out,EG2 BiasOut,Osc1 Out,Osc2 Out,SubOsc Out", "None");
+	piParam = new PluginParameter(controlID::modSource2, "Mod Source 2", "None,LFO1 Out,LFO1 InvOut,LFO2 Out,LFO2 InvOut,EG1 Out,EG1 BiasOut,EG2 Out,EG2 BiasOut,Osc1 Out,Osc2 Out,SubOsc Out,MPE Bend,MPE Pressure,MPE Slide,MSEG Out,GLFO1 Out,GLFO1 InvOut,GLFO2 Out,GLFO2 InvOut", "None");
 	piParam->setBoundVariable(&modSource2, boundVariableType::kInt);
 	addPluginParameter(piParam);
 
 	// --- discrete control: Mod Dest 2
-	piParam = new PluginParameter(controlID::modDest2, "Mod Dest 2", "None,Osc1 Pitch,Osc2 Pitch,All Osc Pitch,Osc1 PW,Osc2 PW,SubOsc PW,All Osc PW,Filter1 fc,Filter1 Q,Filter2 fc,Filter2 Q,EG1 Repeat,EG2 Repeat,DCA Amp,DCA Pan,DelayFX Mix,DelayFX FB,Chorus Depth", "None");
+	piParam = new PluginParameter(controlID::modDest2, "Mod Dest 2", "None,Osc1 Pitch,Osc2 Pitch,All Osc Pitch,Osc1 PW,Osc2 PW,SubOsc PW,All Osc PW,Filter1 fc,Filter1 Q,Filter2 fc,Filter2 Q,EG1 Repeat mSec,EG2 Repeat mSec,EG1 Repeat SubDiv,EG2 Repeat SubDiv,DCA Amp,DCA Pan,DelayFX Mix,DelayFX FB,Chorus Depth,FM Pitch", "None");
 	piParam->setBoundVariable(&modDest2, boundVariableType::kInt);
 	addPluginParameter(piParam);
 
@@ -547,6 +552,530 @@ bool PluginCore::initPluginParameters()
 	piParam->setIsDiscreteSwitch(true);
 	addPluginParameter(piParam);
 
+	// --- discrete control: MPE
+	piParam = new PluginParameter(controlID::enableMPE, "MPE", "SWITCH OFF,SWITCH ON", "SWITCH_OFF");
+	piParam->setBoundVariable(&enableMPE, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- discrete control: MSEG Sync
+	piParam = new PluginParameter(controlID::msegTempoSync, "MSEG Sync", "SWITCH OFF,SWITCH ON", "SWITCH_OFF");
+	piParam->setBoundVariable(&msegTempoSync, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- continuous control: GLFO1 Rate
+	piParam = new PluginParameter(controlID::globalLFO1FreqControl, "GLFO1 Rate", "Hz", controlVariableType::kDouble, 0.020000, 20.000000, 0.020000, taper::kVoltOctaveTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&globalLFO1FreqControl, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: GLFO1 Level
+	piParam = new PluginParameter(controlID::globalLFO1AmpControl, "GLFO1 Level", "", controlVariableType::kDouble, 0.000000, 1.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&globalLFO1AmpControl, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- discrete control: GLFO1 Wave
+	piParam = new PluginParameter(controlID::globalLFO1Wave, "GLFO1 Wave", "Sin,UpSaw,DownSaw,Square,Triangle,RSH,QRSH,ExpUp,ExpDown,WhiteNoise", "Sin");
+	piParam->setBoundVariable(&globalLFO1Wave, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- continuous control: GLFO2 Rate
+	piParam = new PluginParameter(controlID::globalLFO2FreqControl, "GLFO2 Rate", "Hz", controlVariableType::kDouble, 0.020000, 20.000000, 0.020000, taper::kVoltOctaveTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&globalLFO2FreqControl, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: GLFO2 Level
+	piParam = new PluginParameter(controlID::globalLFO2AmpControl, "GLFO2 Level", "", controlVariableType::kDouble, 0.000000, 1.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&globalLFO2AmpControl, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- discrete control: GLFO2 Wave
+	piParam = new PluginParameter(controlID::globalLFO2Wave, "GLFO2 Wave", "Sin,UpSaw,DownSaw,Square,Triangle,RSH,QRSH,ExpUp,ExpDown,WhiteNoise", "Sin");
+	piParam->setBoundVariable(&globalLFO2Wave, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- discrete control: LFO1 Sync
+	piParam = new PluginParameter(controlID::lfo1SyncSubDiv, "LFO1 Sync", "Off,Whole,Dotted Half,Half,Dotted Quarter,Quarter,Dotted Eigth,Triplet Quarter,Eigth,Triplet Eigth,Sixteenth", "Off");
+	piParam->setBoundVariable(&lfo1SyncSubDiv, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- discrete control: LFO2 Sync
+	piParam = new PluginParameter(controlID::lfo2SyncSubDiv, "LFO2 Sync", "Off,Whole,Dotted Half,Half,Dotted Quarter,Quarter,Dotted Eigth,Triplet Quarter,Eigth,Triplet Eigth,Sixteenth", "Off");
+	piParam->setBoundVariable(&lfo2SyncSubDiv, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- discrete control: GLFO1 Sync
+	piParam = new PluginParameter(controlID::globalLFO1SyncSubDiv, "GLFO1 Sync", "Off,Whole,Dotted Half,Half,Dotted Quarter,Quarter,Dotted Eigth,Triplet Quarter,Eigth,Triplet Eigth,Sixteenth", "Off");
+	piParam->setBoundVariable(&globalLFO1SyncSubDiv, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- discrete control: GLFO2 Sync
+	piParam = new PluginParameter(controlID::globalLFO2SyncSubDiv, "GLFO2 Sync", "Off,Whole,Dotted Half,Half,Dotted Quarter,Quarter,Dotted Eigth,Triplet Quarter,Eigth,Triplet Eigth,Sixteenth", "Off");
+	piParam->setBoundVariable(&globalLFO2SyncSubDiv, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- discrete control: Delay Sync
+	piParam = new PluginParameter(controlID::delaySyncSubDiv, "Delay Sync", "Off,Whole,Dotted Half,Half,Dotted Quarter,Quarter,Dotted Eigth,Triplet Quarter,Eigth,Triplet Eigth,Sixteenth", "Off");
+	piParam->setBoundVariable(&delaySyncSubDiv, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Ens Voices
+	piParam = new PluginParameter(controlID::ensembleTaps, "Ens Voices", "", controlVariableType::kInt, 1.000000, 8.000000, 3.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&ensembleTaps, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Ens Rate
+	piParam = new PluginParameter(controlID::ensembleRate_Hz, "Ens Rate", "Hz", controlVariableType::kDouble, 0.050000, 5.000000, 0.500000, taper::kVoltOctaveTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&ensembleRate_Hz, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Ens Depth
+	piParam = new PluginParameter(controlID::ensembleDepth_Pct, "Ens Depth", "%", controlVariableType::kDouble, 0.000000, 100.000000, 50.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&ensembleDepth_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Ens Mix
+	piParam = new PluginParameter(controlID::ensembleMix_Pct, "Ens Mix", "%", controlVariableType::kDouble, 0.000000, 100.000000, 50.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&ensembleMix_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- discrete control: ENSEMBLE
+	piParam = new PluginParameter(controlID::enableEnsembleFX, "ENSEMBLE", "SWITCH OFF,SWITCH ON", "SWITCH_OFF");
+	piParam->setBoundVariable(&enableEnsembleFX, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Rvb Time
+	piParam = new PluginParameter(controlID::reverbTime_mSec, "Rvb Time", "mSec", controlVariableType::kDouble, 100.000000, 20000.000000, 2000.000000, taper::kVoltOctaveTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&reverbTime_mSec, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Rvb Damping
+	piParam = new PluginParameter(controlID::reverbDamping_Pct, "Rvb Damping", "%", controlVariableType::kDouble, 0.000000, 100.000000, 50.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&reverbDamping_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Rvb Size
+	piParam = new PluginParameter(controlID::reverbSize_Pct, "Rvb Size", "%", controlVariableType::kDouble, 25.000000, 100.000000, 100.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&reverbSize_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Rvb PreDelay
+	piParam = new PluginParameter(controlID::reverbPreDelay_mSec, "Rvb PreDelay", "mSec", controlVariableType::kDouble, 0.000000, 200.000000, 10.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&reverbPreDelay_mSec, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Rvb Mix
+	piParam = new PluginParameter(controlID::reverbMix_Pct, "Rvb Mix", "%", controlVariableType::kDouble, 0.000000, 100.000000, 25.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&reverbMix_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- discrete control: REVERB
+	piParam = new PluginParameter(controlID::enableReverbFX, "REVERB", "SWITCH OFF,SWITCH ON", "SWITCH_OFF");
+	piParam->setBoundVariable(&enableReverbFX, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- discrete control: Oversampling
+	piParam = new PluginParameter(controlID::oversampling, "Oversampling", "x1,x2,x4", "x1");
+	piParam->setBoundVariable(&oversampling, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Unison Voices
+	piParam = new PluginParameter(controlID::unisonCount, "Unison Voices", "", controlVariableType::kInt, 1.000000, 16.000000, 7.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&unisonCount, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Supersaw Saws
+	piParam = new PluginParameter(controlID::supersawCount, "Supersaw Saws", "", controlVariableType::kInt, 1.000000, 16.000000, 7.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&supersawCount, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Supersaw Detune
+	piParam = new PluginParameter(controlID::supersawDetune_Pct, "Supersaw Detune", "%", controlVariableType::kDouble, 0.000000, 100.000000, 50.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&supersawDetune_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Supersaw Mix
+	piParam = new PluginParameter(controlID::supersawMix_Pct, "Supersaw Mix", "%", controlVariableType::kDouble, 0.000000, 100.000000, 50.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&supersawMix_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- discrete control: FM Algorithm
+	piParam = new PluginParameter(controlID::fmAlgorithm, "FM Algorithm", "Alg1,Alg2,Alg3,Alg4,Alg5,Alg6,Alg7,Alg8", "Alg1");
+	piParam->setBoundVariable(&fmAlgorithm, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- continuous control: FM Feedback
+	piParam = new PluginParameter(controlID::fmFeedback_Pct, "FM Feedback", "%", controlVariableType::kDouble, 0.000000, 100.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmFeedback_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: FM Level
+	piParam = new PluginParameter(controlID::fmAmpControl_dB, "FM Level", "dB", controlVariableType::kDouble, -96.000000, 12.000000, -96.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmAmpControl_dB, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: FM Attack
+	piParam = new PluginParameter(controlID::fmAttackTime_mSec, "FM Attack", "mSec", controlVariableType::kDouble, 1.000000, 5000.000000, 5.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmAttackTime_mSec, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: FM Release
+	piParam = new PluginParameter(controlID::fmReleaseTime_mSec, "FM Release", "mSec", controlVariableType::kDouble, 1.000000, 10000.000000, 500.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmReleaseTime_mSec, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op1 Ratio
+	piParam = new PluginParameter(controlID::fmOp1Ratio, "Op1 Ratio", "", controlVariableType::kDouble, 0.500000, 16.000000, 1.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp1Ratio, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op1 Level
+	piParam = new PluginParameter(controlID::fmOp1Level_Pct, "Op1 Level", "%", controlVariableType::kDouble, 0.000000, 100.000000, 100.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp1Level_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op1 Decay
+	piParam = new PluginParameter(controlID::fmOp1DecayTime_mSec, "Op1 Decay", "mSec", controlVariableType::kDouble, 10.000000, 10000.000000, 1000.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp1DecayTime_mSec, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op1 Sustain
+	piParam = new PluginParameter(controlID::fmOp1Sustain_Pct, "Op1 Sustain", "%", controlVariableType::kDouble, 0.000000, 100.000000, 70.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp1Sustain_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op2 Ratio
+	piParam = new PluginParameter(controlID::fmOp2Ratio, "Op2 Ratio", "", controlVariableType::kDouble, 0.500000, 16.000000, 1.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp2Ratio, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op2 Level
+	piParam = new PluginParameter(controlID::fmOp2Level_Pct, "Op2 Level", "%", controlVariableType::kDouble, 0.000000, 100.000000, 50.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp2Level_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op2 Decay
+	piParam = new PluginParameter(controlID::fmOp2DecayTime_mSec, "Op2 Decay", "mSec", controlVariableType::kDouble, 10.000000, 10000.000000, 1000.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp2DecayTime_mSec, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op2 Sustain
+	piParam = new PluginParameter(controlID::fmOp2Sustain_Pct, "Op2 Sustain", "%", controlVariableType::kDouble, 0.000000, 100.000000, 70.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp2Sustain_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op3 Ratio
+	piParam = new PluginParameter(controlID::fmOp3Ratio, "Op3 Ratio", "", controlVariableType::kDouble, 0.500000, 16.000000, 1.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp3Ratio, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op3 Level
+	piParam = new PluginParameter(controlID::fmOp3Level_Pct, "Op3 Level", "%", controlVariableType::kDouble, 0.000000, 100.000000, 50.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp3Level_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op3 Decay
+	piParam = new PluginParameter(controlID::fmOp3DecayTime_mSec, "Op3 Decay", "mSec", controlVariableType::kDouble, 10.000000, 10000.000000, 1000.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp3DecayTime_mSec, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op3 Sustain
+	piParam = new PluginParameter(controlID::fmOp3Sustain_Pct, "Op3 Sustain", "%", controlVariableType::kDouble, 0.000000, 100.000000, 70.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp3Sustain_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op4 Ratio
+	piParam = new PluginParameter(controlID::fmOp4Ratio, "Op4 Ratio", "", controlVariableType::kDouble, 0.500000, 16.000000, 1.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp4Ratio, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op4 Level
+	piParam = new PluginParameter(controlID::fmOp4Level_Pct, "Op4 Level", "%", controlVariableType::kDouble, 0.000000, 100.000000, 50.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(true);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp4Level_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op4 Decay
+	piParam = new PluginParameter(controlID::fmOp4DecayTime_mSec, "Op4 Decay", "mSec", controlVariableType::kDouble, 10.000000, 10000.000000, 1000.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp4DecayTime_mSec, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Op4 Sustain
+	piParam = new PluginParameter(controlID::fmOp4Sustain_Pct, "Op4 Sustain", "%", controlVariableType::kDouble, 0.000000, 100.000000, 70.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&fmOp4Sustain_Pct, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Bank Patch
+	piParam = new PluginParameter(controlID::bankPatch, "Bank Patch", "", controlVariableType::kInt, 0.000000, 128.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&bankPatch, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Bank Page
+	piParam = new PluginParameter(controlID::bankPage, "Bank Page", "", controlVariableType::kInt, 0.000000, 127.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&bankPage, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- discrete control: Bank Save
+	piParam = new PluginParameter(controlID::bankSave, "Bank Save", "SWITCH_OFF,SWITCH_ON", "SWITCH_OFF");
+	piParam->setBoundVariable(&bankSave, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- discrete control: Bank Reload
+	piParam = new PluginParameter(controlID::bankReload, "Bank Reload", "SWITCH_OFF,SWITCH_ON", "SWITCH_OFF");
+	piParam->setBoundVariable(&bankReload, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- discrete control: Master FX Order
+	piParam = new PluginParameter(controlID::masterFXOrder, "Master FX Order", "CHO_ENS_DLY_REV,CHO_ENS_REV_DLY,CHO_DLY_ENS_REV,CHO_DLY_REV_ENS,CHO_REV_ENS_DLY,CHO_REV_DLY_ENS,ENS_CHO_DLY_REV,ENS_CHO_REV_DLY,ENS_DLY_CHO_REV,ENS_DLY_REV_CHO,ENS_REV_CHO_DLY,ENS_REV_DLY_CHO,DLY_CHO_ENS_REV,DLY_CHO_REV_ENS,DLY_ENS_CHO_REV,DLY_ENS_REV_CHO,DLY_REV_CHO_ENS,DLY_REV_ENS_CHO,REV_CHO_ENS_DLY,REV_CHO_DLY_ENS,REV_ENS_CHO_DLY,REV_ENS_DLY_CHO,REV_DLY_CHO_ENS,REV_DLY_ENS_CHO", "CHO_ENS_DLY_REV");
+	piParam->setBoundVariable(&masterFXOrder, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- meters: not bound; the GUI timer sets them from the engine telemetry (see PLUGINGUI_TIMERPING)
+	// --- meter control: Peak L
+	piParam = new PluginParameter(controlID::peakMeterL, "Peak L", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLogMeter);
+	addPluginParameter(piParam);
+
+	// --- meter control: Peak R
+	piParam = new PluginParameter(controlID::peakMeterR, "Peak R", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLogMeter);
+	addPluginParameter(piParam);
+
+	// --- meter control: CPU Load
+	piParam = new PluginParameter(controlID::cpuLoadMeter, "CPU Load", 10.00, 500.00, ENVELOPE_DETECT_MODE_NONE, meterCal::kLinearMeter);
+	addPluginParameter(piParam);
+
+	// --- meter control: Voices
+	piParam = new PluginParameter(controlID::voicesMeter, "Voices", 10.00, 500.00, ENVELOPE_DETECT_MODE_NONE, meterCal::kLinearMeter);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Points
+	piParam = new PluginParameter(controlID::msegPoints, "MSEG Points", "", controlVariableType::kInt, 1.000000, 4.000000, 3.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPoints, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt1 Level
+	piParam = new PluginParameter(controlID::msegPt1Level, "MSEG Pt1 Level", "", controlVariableType::kDouble, -1.000000, 1.000000, 1.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt1Level, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt1 Time
+	piParam = new PluginParameter(controlID::msegPt1Time_mSec, "MSEG Pt1 Time", "mSec", controlVariableType::kDouble, 0.000000, 10000.000000, 10.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt1Time_mSec, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt1 Beats
+	piParam = new PluginParameter(controlID::msegPt1Beats, "MSEG Pt1 Beats", "", controlVariableType::kDouble, 0.062500, 16.000000, 0.125000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt1Beats, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt1 Curve
+	piParam = new PluginParameter(controlID::msegPt1Curve, "MSEG Pt1 Curve", "", controlVariableType::kDouble, -12.000000, 12.000000, 2.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt1Curve, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt2 Level
+	piParam = new PluginParameter(controlID::msegPt2Level, "MSEG Pt2 Level", "", controlVariableType::kDouble, -1.000000, 1.000000, 0.500000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt2Level, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt2 Time
+	piParam = new PluginParameter(controlID::msegPt2Time_mSec, "MSEG Pt2 Time", "mSec", controlVariableType::kDouble, 0.000000, 10000.000000, 250.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt2Time_mSec, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt2 Beats
+	piParam = new PluginParameter(controlID::msegPt2Beats, "MSEG Pt2 Beats", "", controlVariableType::kDouble, 0.062500, 16.000000, 0.500000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt2Beats, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt2 Curve
+	piParam = new PluginParameter(controlID::msegPt2Curve, "MSEG Pt2 Curve", "", controlVariableType::kDouble, -12.000000, 12.000000, 4.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt2Curve, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt3 Level
+	piParam = new PluginParameter(controlID::msegPt3Level, "MSEG Pt3 Level", "", controlVariableType::kDouble, -1.000000, 1.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt3Level, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt3 Time
+	piParam = new PluginParameter(controlID::msegPt3Time_mSec, "MSEG Pt3 Time", "mSec", controlVariableType::kDouble, 0.000000, 10000.000000, 500.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt3Time_mSec, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt3 Beats
+	piParam = new PluginParameter(controlID::msegPt3Beats, "MSEG Pt3 Beats", "", controlVariableType::kDouble, 0.062500, 16.000000, 1.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt3Beats, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt3 Curve
+	piParam = new PluginParameter(controlID::msegPt3Curve, "MSEG Pt3 Curve", "", controlVariableType::kDouble, -12.000000, 12.000000, 4.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt3Curve, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt4 Level
+	piParam = new PluginParameter(controlID::msegPt4Level, "MSEG Pt4 Level", "", controlVariableType::kDouble, -1.000000, 1.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt4Level, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt4 Time
+	piParam = new PluginParameter(controlID::msegPt4Time_mSec, "MSEG Pt4 Time", "mSec", controlVariableType::kDouble, 0.000000, 10000.000000, 100.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt4Time_mSec, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt4 Beats
+	piParam = new PluginParameter(controlID::msegPt4Beats, "MSEG Pt4 Beats", "", controlVariableType::kDouble, 0.062500, 16.000000, 1.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt4Beats, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Pt4 Curve
+	piParam = new PluginParameter(controlID::msegPt4Curve, "MSEG Pt4 Curve", "", controlVariableType::kDouble, -12.000000, 12.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegPt4Curve, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Sustain
+	piParam = new PluginParameter(controlID::msegSustainPoint, "MSEG Sustain", "", controlVariableType::kInt, -1.000000, 3.000000, 1.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegSustainPoint, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- discrete control: MSEG Loop
+	piParam = new PluginParameter(controlID::msegLoop, "MSEG Loop", "SWITCH OFF,SWITCH ON", "SWITCH_OFF");
+	piParam->setBoundVariable(&msegLoop, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Loop Start
+	piParam = new PluginParameter(controlID::msegLoopStart, "MSEG Loop Start", "", controlVariableType::kInt, 0.000000, 3.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegLoopStart, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MSEG Loop End
+	piParam = new PluginParameter(controlID::msegLoopEnd, "MSEG Loop End", "", controlVariableType::kInt, 0.000000, 3.000000, 1.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&msegLoopEnd, boundVariableType::kInt);
+	addPluginParameter(piParam);
+
 	// --- BONUS Parameters
 	// --- SCALE_GUI_SIZE
 	piParam = new PluginParameter(SCALE_GUI_SIZE, "Scale GUI", "tiny,small,medium,normal,large,giant", "normal");
@@ -979,6 +1508,141 @@ bool PluginCore::initPluginParameters()
 	auxAttribute.setUintAttribute(0);
 	setParamAuxAttribute(controlID::subdivideTime, auxAttribute);
 
+	// --- controlID::enableMPE
+	auxAttribute.reset(auxGUIIdentifier::GUI2SSButtonStyle);
+	auxAttribute.setUintAttribute(0);
+	setParamAuxAttribute(controlID::enableMPE, auxAttribute);
+
+	// --- controlID::msegTempoSync
+	auxAttribute.reset(auxGUIIdentifier::GUI2SSButtonStyle);
+	auxAttribute.setUintAttribute(0);
+	setParamAuxAttribute(controlID::msegTempoSync, auxAttribute);
+
+	// --- controlID::msegLoop
+	auxAttribute.reset(auxGUIIdentifier::GUI2SSButtonStyle);
+	auxAttribute.setUintAttribute(0);
+	setParamAuxAttribute(controlID::msegLoop, auxAttribute);
+
+	// --- controlID::bankSave
+	auxAttribute.reset(auxGUIIdentifier::GUI2SSButtonStyle);
+	auxAttribute.setUintAttribute(0);
+	setParamAuxAttribute(controlID::bankSave, auxAttribute);
+
+	// --- controlID::bankReload
+	auxAttribute.reset(auxGUIIdentifier::GUI2SSButtonStyle);
+	auxAttribute.setUintAttribute(0);
+	setParamAuxAttribute(controlID::bankReload, auxAttribute);
+
+	// --- controlID::globalLFO1FreqControl
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::globalLFO1FreqControl, auxAttribute);
+
+	// --- controlID::globalLFO1AmpControl
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::globalLFO1AmpControl, auxAttribute);
+
+	// --- controlID::globalLFO1Wave
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::globalLFO1Wave, auxAttribute);
+
+	// --- controlID::globalLFO2FreqControl
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::globalLFO2FreqControl, auxAttribute);
+
+	// --- controlID::globalLFO2AmpControl
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::globalLFO2AmpControl, auxAttribute);
+
+	// --- controlID::globalLFO2Wave
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::globalLFO2Wave, auxAttribute);
+
+	// --- controlID::lfo1SyncSubDiv
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::lfo1SyncSubDiv, auxAttribute);
+
+	// --- controlID::lfo2SyncSubDiv
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::lfo2SyncSubDiv, auxAttribute);
+
+	// --- controlID::globalLFO1SyncSubDiv
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::globalLFO1SyncSubDiv, auxAttribute);
+
+	// --- controlID::globalLFO2SyncSubDiv
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::globalLFO2SyncSubDiv, auxAttribute);
+
+	// --- controlID::delaySyncSubDiv
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::delaySyncSubDiv, auxAttribute);
+
+	// --- controlID::ensembleTaps
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::ensembleTaps, auxAttribute);
+
+	// --- controlID::ensembleRate_Hz
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::ensembleRate_Hz, auxAttribute);
+
+	// --- controlID::ensembleDepth_Pct
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::ensembleDepth_Pct, auxAttribute);
+
+	// --- controlID::ensembleMix_Pct
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::ensembleMix_Pct, auxAttribute);
+
+	// --- controlID::enableEnsembleFX
+	auxAttribute.reset(auxGUIIdentifier::GUI2SSButtonStyle);
+	auxAttribute.setUintAttribute(0);
+	setParamAuxAttribute(controlID::enableEnsembleFX, auxAttribute);
+
+	// --- controlID::reverbTime_mSec
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::reverbTime_mSec, auxAttribute);
+
+	// --- controlID::reverbDamping_Pct
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::reverbDamping_Pct, auxAttribute);
+
+	// --- controlID::reverbSize_Pct
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::reverbSize_Pct, auxAttribute);
+
+	// --- controlID::reverbPreDelay_mSec
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::reverbPreDelay_mSec, auxAttribute);
+
+	// --- controlID::reverbMix_Pct
+	auxAttribute.reset(auxGUIIdentifier::GUIKnobGraphic);
+	auxAttribute.setUintAttribute(10);
+	setParamAuxAttribute(controlID::reverbMix_Pct, auxAttribute);
+
+	// --- controlID::enableReverbFX
+	auxAttribute.reset(auxGUIIdentifier::GUI2SSButtonStyle);
+	auxAttribute.setUintAttribute(0);
+	setParamAuxAttribute(controlID::enableReverbFX, auxAttribute);
+
 
 	// **--0xEDA5--**
 
@@ -1075,6 +1739,82 @@ bool PluginCore::initPluginPresets()
 	setPresetParameter(preset->presetParameters, controlID::eg1RepeatTime_SubDiv, -0.000000);
 	setPresetParameter(preset->presetParameters, controlID::eg2RepeatTime_SubDiv, -0.000000);
 	setPresetParameter(preset->presetParameters, controlID::subdivideTime, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::enableMPE, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegTempoSync, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::globalLFO1FreqControl, 0.020000);
+	setPresetParameter(preset->presetParameters, controlID::globalLFO1AmpControl, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::globalLFO1Wave, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::globalLFO2FreqControl, 0.020000);
+	setPresetParameter(preset->presetParameters, controlID::globalLFO2AmpControl, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::globalLFO2Wave, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::lfo1SyncSubDiv, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::lfo2SyncSubDiv, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::globalLFO1SyncSubDiv, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::globalLFO2SyncSubDiv, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::delaySyncSubDiv, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::ensembleTaps, 3.000000);
+	setPresetParameter(preset->presetParameters, controlID::ensembleRate_Hz, 0.500000);
+	setPresetParameter(preset->presetParameters, controlID::ensembleDepth_Pct, 50.000000);
+	setPresetParameter(preset->presetParameters, controlID::ensembleMix_Pct, 50.000000);
+	setPresetParameter(preset->presetParameters, controlID::enableEnsembleFX, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::reverbTime_mSec, 2000.000000);
+	setPresetParameter(preset->presetParameters, controlID::reverbDamping_Pct, 50.000000);
+	setPresetParameter(preset->presetParameters, controlID::reverbSize_Pct, 100.000000);
+	setPresetParameter(preset->presetParameters, controlID::reverbPreDelay_mSec, 10.000000);
+	setPresetParameter(preset->presetParameters, controlID::reverbMix_Pct, 25.000000);
+	setPresetParameter(preset->presetParameters, controlID::enableReverbFX, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::oversampling, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::unisonCount, 7.000000);
+	setPresetParameter(preset->presetParameters, controlID::supersawCount, 7.000000);
+	setPresetParameter(preset->presetParameters, controlID::supersawDetune_Pct, 50.000000);
+	setPresetParameter(preset->presetParameters, controlID::supersawMix_Pct, 50.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmAlgorithm, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmFeedback_Pct, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmAmpControl_dB, -96.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmAttackTime_mSec, 5.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmReleaseTime_mSec, 500.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp1Ratio, 1.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp1Level_Pct, 100.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp1DecayTime_mSec, 1000.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp1Sustain_Pct, 70.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp2Ratio, 1.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp2Level_Pct, 50.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp2DecayTime_mSec, 1000.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp2Sustain_Pct, 70.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp3Ratio, 1.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp3Level_Pct, 50.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp3DecayTime_mSec, 1000.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp3Sustain_Pct, 70.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp4Ratio, 1.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp4Level_Pct, 50.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp4DecayTime_mSec, 1000.000000);
+	setPresetParameter(preset->presetParameters, controlID::fmOp4Sustain_Pct, 70.000000);
+	setPresetParameter(preset->presetParameters, controlID::bankPatch, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::bankPage, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::bankSave, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::bankReload, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::masterFXOrder, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegPoints, 3.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt1Level, 1.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt1Time_mSec, 10.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt1Beats, 0.125000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt1Curve, 2.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt2Level, 0.500000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt2Time_mSec, 250.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt2Beats, 0.500000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt2Curve, 4.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt3Level, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt3Time_mSec, 500.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt3Beats, 1.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt3Curve, 4.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt4Level, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt4Time_mSec, 100.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt4Beats, 1.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegPt4Curve, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegSustainPoint, 1.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegLoop, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegLoopStart, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::msegLoopEnd, 1.000000);
 	addPreset(preset);
 
 
@@ -1105,17 +1845,101 @@ void PluginCore::updateEngine()
 	std::shared_ptr<SynthVoiceModifiers> voiceModifiers = synthEngine->getSynthVoiceModifiers();
 	if (!voiceModifiers) return;
 
+	// --- "Bank Save" was pressed: hand the sound of the last update to the GUI thread, which writes the bank
+	if (patchSnapshotRequested.load(std::memory_order_acquire))
+	{
+		SynthPatchBank::encodePatch(synthModifiers, patchSnapshot);
+		patchSnapshotRequested.store(false, std::memory_order_relaxed);
+		patchSnapshotReady.store(true, std::memory_order_release);
+	}
+
+	// --- pick up a bank the GUI thread opened; the one we were reading is free for its next open
+	SynthPatchBank* bank = patchBank.load(std::memory_order_acquire);
+	if (bank != audioPatchBank.load(std::memory_order_relaxed))
+	{
+		audioPatchBank.store(bank, std::memory_order_release);
+		if (loadedBankPatch > 0)
+			loadedBankPatch = -1;
+	}
+
+	// --- a bank patch replaces the panel controls; the host tempo is the only thing the panel still supplies
+	int selectedBankPatch = bankPatch > 0 ? bankPage*(int)kBankPatchesPerPage + bankPatch : 0;
+	if (bank && selectedBankPatch > 0 && (uint32_t)selectedBankPatch <= bank->getPatchCount())
+	{
+		if (selectedBankPatch != loadedBankPatch)
+		{
+			if (loadedBankPatch == 0)
+				SynthPatchBank::encodePatch(synthModifiers, panelPatch);
+
+			bank->loadPatch(selectedBankPatch - 1, synthModifiers);
+			loadedBankPatch = selectedBankPatch;
+		}
+
+		voiceModifiers->eg1Modifiers->bpm = hostBPM;
+		voiceModifiers->eg1Modifiers->sigDenominator = hostTimeSigDenominator;
+		voiceModifiers->eg2Modifiers->bpm = hostBPM;
+		voiceModifiers->eg2Modifiers->sigDenominator = hostTimeSigDenominator;
+
+		UpdateInfo updateInfo;
+		synthEngine->update(updateInfo);
+		return;
+	}
+
+	// --- back to the panel: restore the modifiers the bank patch overwrote, then apply the controls as usual
+	if (loadedBankPatch != 0)
+	{
+		SynthPatchBank::decodePatch(panelPatch, synthModifiers);
+		loadedBankPatch = 0;
+	}
+
 	// --- mono/poly operation
 	synthModifiers->synthMode = convertEnum(synthEngineMode, synthMode);
 
 	// --- master PB
 	synthModifiers->masterPitchBend = masterPitchBend;
 
+	// --- oscillators stacked per note in unison mode
+	synthModifiers->unisonCount = unisonCount;
+
+	// --- MPE per-note expression (poly and unison modes)
+	synthModifiers->enableMPE = (enableMPE == 1);
+
+	// --- global LFOs (on Engine level, always free running)
+	synthModifiers->globalLFO1Modifiers->oscWave = convertEnum(globalLFO1Wave, LFOWaveform);
+	synthModifiers->globalLFO1Modifiers->oscAmpControl = globalLFO1AmpControl;
+	synthModifiers->globalLFO1Modifiers->oscFreqControl = globalLFO1FreqControl;
+	synthModifiers->globalLFO1Modifiers->tempoSync = (globalLFO1SyncSubDiv != 0);
+	synthModifiers->globalLFO1Modifiers->cycle_beats = egSubDivToBeats(convertEnum(globalLFO1SyncSubDiv, egSubDiv));
+
+	synthModifiers->globalLFO2Modifiers->oscWave = convertEnum(globalLFO2Wave, LFOWaveform);
+	synthModifiers->globalLFO2Modifiers->oscAmpControl = globalLFO2AmpControl;
+	synthModifiers->globalLFO2Modifiers->oscFreqControl = globalLFO2FreqControl;
+	synthModifiers->globalLFO2Modifiers->tempoSync = (globalLFO2SyncSubDiv != 0);
+	synthModifiers->globalLFO2Modifiers->cycle_beats = egSubDivToBeats(convertEnum(globalLFO2SyncSubDiv, egSubDiv));
+
 	// --- chorus FX (master, on Engine level)
 	synthModifiers->chorusFXModifiers->chorusRate_Hz = chorusRate_Hz;
 	synthModifiers->chorusFXModifiers->chorusDepth_Pct = chorusDepth_Pct;
 	synthModifiers->chorusFXModifiers->enabled = (enableChorusFX == 1);
 
+	// --- ensemble FX (master, on Engine level)
+	synthModifiers->ensembleFXModifiers->numTaps = ensembleTaps;
+	synthModifiers->ensembleFXModifiers->rate_Hz = ensembleRate_Hz;
+	synthModifiers->ensembleFXModifiers->depth_Pct = ensembleDepth_Pct;
+	synthModifiers->ensembleFXModifiers->mix_Pct = ensembleMix_Pct;
+	synthModifiers->ensembleFXModifiers->enabled = (enableEnsembleFX == 1);
+
+	// --- reverb FX (master, on Engine level)
+	synthModifiers->reverbFXModifiers->reverbTime_mSec = reverbTime_mSec;
+	synthModifiers->reverbFXModifiers->damping_Pct = reverbDamping_Pct;
+	synthModifiers->reverbFXModifiers->size_Pct = reverbSize_Pct;
+	synthModifiers->reverbFXModifiers->preDelay_mSec = reverbPreDelay_mSec;
+	synthModifiers->reverbFXModifiers->mix_Pct = reverbMix_Pct;
+	synthModifiers->reverbFXModifiers->enabled = (enableReverbFX == 1);
+
+	// --- voice oversampling (oscillators and filters)
+	voiceModifiers->oversampling = convertEnum(oversampling, oversamplingMode);
+
 	// --- delay FX (master, on Engine level)
 	synthModifiers->delayFXModifiers->delayTime_mSec = delayTime_mSec;
 	synthModifiers->delayFXModifiers->feedback_Pct = feedback_Pct;
@@ -1123,6 +1947,29 @@ void PluginCore::updateEngine()
 	synthModifiers->delayFXModifiers->delayMix_Pct = delayMix_Pct;
 	synthModifiers->delayFXModifiers->delayFXMode = convertEnum(delayType, delayFXMode);
 	synthModifiers->delayFXModifiers->enabled = (enableDelayFX == 1);
+	synthModifiers->delayFXModifiers->tempoSync = (delaySyncSubDiv != 0);
+	synthModifiers->delayFXModifiers->delayTime_beats = egSubDivToBeats(convertEnum(delaySyncSubDiv, egSubDiv));
+
+	// --- master FX order: the list holds the permutations in lexicographic order, so the
+	//     index decodes one FX per slot (factorial number system); the engine moves the slots
+	uint32_t remainingFX[kNumMasterFX] = { kMasterFXChorus, kMasterFXEnsemble, kMasterFXDelay, kMasterFXReverb };
+	uint32_t orderIndex = (uint32_t)masterFXOrder;
+	uint32_t radix = 1;
+	for (uint32_t i = 2; i < kNumMasterFX; i++)
+		radix *= i;
+
+	for (uint32_t i = 0; i < kNumMasterFX; i++)
+	{
+		uint32_t pick = orderIndex / radix;
+		orderIndex %= radix;
+		synthModifiers->masterFXOrder[i] = remainingFX[pick];
+
+		for (uint32_t j = pick; j < kNumMasterFX - 1 - i; j++)
+			remainingFX[j] = remainingFX[j + 1];
+
+		if (i < kNumMasterFX - 1)
+			radix /= kNumMasterFX - 1 - i;
+	}
 
 	// --- Portamento
 	voiceModifiers->enablePortamento = (enablePortamento == 1);
@@ -1136,6 +1983,9 @@ void PluginCore::updateEngine()
 	voiceModifiers->osc1Modifiers->masterTuningOffset_cents = masterTuningOffset_cents;
 	voiceModifiers->osc1Modifiers->unisonDetune_cents = unisonDetune_cents;
 	voiceModifiers->osc1Modifiers->oscFreqRatio = osc1TuningRatio;
+	voiceModifiers->osc1Modifiers->supersawCount = supersawCount;
+	voiceModifiers->osc1Modifiers->supersawDetune_Pct = supersawDetune_Pct;
+	voiceModifiers->osc1Modifiers->supersawMix_Pct = supersawMix_Pct;
 
 	// --- the sub-oscillator uses:
 	//           - same waveshape
@@ -1161,18 +2011,47 @@ void PluginCore::updateEngine()
 	voiceModifiers->osc2Modifiers->cents = osc2Detune_cents;
 	voiceModifiers->osc2Modifiers->masterTuningOffset_cents = masterTuningOffset_cents;
 	voiceModifiers->osc2Modifiers->unisonDetune_cents = unisonDetune_cents;
+	voiceModifiers->osc2Modifiers->supersawCount = supersawCount;
+	voiceModifiers->osc2Modifiers->supersawDetune_Pct = supersawDetune_Pct;
+	voiceModifiers->osc2Modifiers->supersawMix_Pct = supersawMix_Pct;
+
+	// --- FM engine: the attack and release are shared by all four operators
+	voiceModifiers->fmEngineModifiers->algorithm = convertEnum(fmAlgorithm, fmEngineAlgorithm);
+	voiceModifiers->fmEngineModifiers->feedback = fmFeedback_Pct / 100.0;
+	voiceModifiers->fmEngineModifiers->fmAmpControl_dB = fmAmpControl_dB;
+	voiceModifiers->fmEngineModifiers->masterTuningRatio = masterTuningRatio;
+	voiceModifiers->fmEngineModifiers->masterTuningOffset_cents = masterTuningOffset_cents;
+
+	double fmOpRatio[kNumFMOperators] = { fmOp1Ratio, fmOp2Ratio, fmOp3Ratio, fmOp4Ratio };
+	double fmOpLevel_Pct[kNumFMOperators] = { fmOp1Level_Pct, fmOp2Level_Pct, fmOp3Level_Pct, fmOp4Level_Pct };
+	double fmOpDecayTime_mSec[kNumFMOperators] = { fmOp1DecayTime_mSec, fmOp2DecayTime_mSec, fmOp3DecayTime_mSec, fmOp4DecayTime_mSec };
+	double fmOpSustain_Pct[kNumFMOperators] = { fmOp1Sustain_Pct, fmOp2Sustain_Pct, fmOp3Sustain_Pct, fmOp4Sustain_Pct };
+	for (uint32_t i = 0; i < kNumFMOperators; i++)
+	{
+		FMOperatorModifiers& fmOperator = voiceModifiers->fmEngineModifiers->operators[i];
+		fmOperator.ratio = fmOpRatio[i];
+		fmOperator.outputLevel = fmOpLevel_Pct[i] / 100.0;
+		fmOperator.attackTime_mSec = fmAttackTime_mSec;
+		fmOperator.decayTime_mSec = fmOpDecayTime_mSec[i];
+		fmOperator.sustainLevel = fmOpSustain_Pct[i] / 100.0;
+		fmOperator.releaseTime_mSec = fmReleaseTime_mSec;
+	}
 
 	// --- LFO1
 	voiceModifiers->lfo1Modifiers->oscWave = convertEnum(lfo1Wave, LFOWaveform);
 	voiceModifiers->lfo1Modifiers->oscAmpControl = lfo1AmpControl;
 	voiceModifiers->lfo1Modifiers->oscFreqControl = lfo1FreqControl;
 	voiceModifiers->lfo1Modifiers->oscMode = convertEnum(lfo1Mode, LFOMode);
+	voiceModifiers->lfo1Modifiers->tempoSync = (lfo1SyncSubDiv != 0);
+	voiceModifiers->lfo1Modifiers->cycle_beats = egSubDivToBeats(convertEnum(lfo1SyncSubDiv, egSubDiv));
 
 	// --- LFO2
 	voiceModifiers->lfo2Modifiers->oscWave = convertEnum(lfo2Wave, LFOWaveform);
 	voiceModifiers->lfo2Modifiers->oscAmpControl = lfo2AmpControl;
 	voiceModifiers->lfo2Modifiers->oscFreqControl = lfo2FreqControl;
 	voiceModifiers->lfo2Modifiers->oscMode = convertEnum(lfo2Mode, LFOMode);
+	voiceModifiers->lfo2Modifiers->tempoSync = (lfo2SyncSubDiv != 0);
+	voiceModifiers->lfo2Modifiers->cycle_beats = egSubDivToBeats(convertEnum(lfo2SyncSubDiv, egSubDiv));
 	
 	// --- EG1
 	voiceModifiers->eg1Modifiers->repeatTime_mSec = eg1RepeatTime_mSec;
@@ -1182,10 +2061,10 @@ void PluginCore::updateEngine()
 	voiceModifiers->eg1Modifiers->sustainLevel = eg1SustainLevel;
 	voiceModifiers->eg1Modifiers->releaseTime_mSec = eg1ReleaseTime_mSec;
 
-	// tempo stuff HARDCODED
+	// --- tempo: the EG prefers the engine's host transport; these are the fallback
 	voiceModifiers->eg1Modifiers->subdivide = (subdivideTime == 1);
-	voiceModifiers->eg1Modifiers->bpm = 120.0;
-	voiceModifiers->eg1Modifiers->sigDenominator = 4;
+	voiceModifiers->eg1Modifiers->bpm = hostBPM;
+	voiceModifiers->eg1Modifiers->sigDenominator = hostTimeSigDenominator;
 	voiceModifiers->eg1Modifiers->repeatSubDiv = convertEnum(eg1RepeatTime_SubDiv, egSubDiv);
 
 	// --- since EG1 hardwired to output DCA; these scaling values will be applied
@@ -1207,12 +2086,28 @@ void PluginCore::updateEngine()
 	voiceModifiers->eg2Modifiers->sustainLevel = eg2SustainLevel;
 	voiceModifiers->eg2Modifiers->releaseTime_mSec = eg2ReleaseTime_mSec;
 
-	// tempo stuff HARDCODED
+	// --- tempo: the EG prefers the engine's host transport; these are the fallback
 	voiceModifiers->eg2Modifiers->subdivide = (subdivideTime == 1);
-	voiceModifiers->eg2Modifiers->bpm = 120.0;
-	voiceModifiers->eg2Modifiers->sigDenominator = 4;
+	voiceModifiers->eg2Modifiers->bpm = hostBPM;
+	voiceModifiers->eg2Modifiers->sigDenominator = hostTimeSigDenominator;
 	voiceModifiers->eg2Modifiers->repeatSubDiv = convertEnum(eg2RepeatTime_SubDiv, egSubDiv);
 
+	// --- MSEG: the panel edits the first four breakpoints; tempo comes from the host
+	double msegLevel[4] = { msegPt1Level, msegPt2Level, msegPt3Level, msegPt4Level };
+	double msegTime_mSec[4] = { msegPt1Time_mSec, msegPt2Time_mSec, msegPt3Time_mSec, msegPt4Time_mSec };
+	double msegBeats[4] = { msegPt1Beats, msegPt2Beats, msegPt3Beats, msegPt4Beats };
+	double msegCurve[4] = { msegPt1Curve, msegPt2Curve, msegPt3Curve, msegPt4Curve };
+	for (uint32_t i = 0; i < 4; i++)
+		voiceModifiers->msegModifiers->breakpoints[i] = MSEGBreakpoint(msegLevel[i], msegTime_mSec[i], msegBeats[i], msegCurve[i]);
+
+	// --- the MSEG validates the counts and indexes against each other
+	voiceModifiers->msegModifiers->numBreakpoints = msegPoints;
+	voiceModifiers->msegModifiers->sustainBreakpoint = msegSustainPoint;
+	voiceModifiers->msegModifiers->enableLoop = (msegLoop == 1);
+	voiceModifiers->msegModifiers->loopStart = msegLoopStart;
+	voiceModifiers->msegModifiers->loopEnd = msegLoopEnd;
+	voiceModifiers->msegModifiers->tempoSync = (msegTempoSync == 1);
+
 	// --- LPF
 	voiceModifiers->filter1Modifiers->fcControl = filter1Fc;
 	voiceModifiers->filter1Modifiers->qControl = filter1Q;
@@ -1349,10 +2244,105 @@ void PluginCore::updateEngine()
 	synthEngine->update(updateInfo);
 }
 
+/**
+	\brief The user's patch bank file: SYNTH_PATCH_BANK_PATH if the project defines it, otherwise <plugin name>.spbk in
+	the per-user application data folder
+
+	\return the path, or an empty string if there is no user folder
+*/
+std::string PluginCore::getPatchBankPath()
+{
+#ifdef SYNTH_PATCH_BANK_PATH
+	return std::string(SYNTH_PATCH_BANK_PATH);
+#else
+#ifdef _WIN32
+	const char* userFolder = getenv("APPDATA");
+	const char* dataFolder = "";
+#elif defined(__APPLE__)
+	const char* userFolder = getenv("HOME");
+	const char* dataFolder = "/Library/Application Support";
+#else
+	const char* userFolder = getenv("HOME");
+	const char* dataFolder = "/.config";
+#endif
+	if (!userFolder || !*userFolder)
+		return std::string();
+
+	std::string bankPath(userFolder);
+	bankPath.append(dataFolder);
+	bankPath.append("/");
+	bankPath.append(getPluginName());
+	bankPath.append(".spbk");
+	return bankPath;
+#endif
+}
+
+/**
+	\brief Map a binary patch bank; "Bank Page" and "Bank Patch" select from it. Call from the constructor or the GUI
+	thread, never the audio thread. The bank is opened into the slot the audio thread is not reading and handed over
+	on its next updateEngine( ).
+
+	\param bankPath -- path to the bank file
+	\return true if the bank was opened; false if it is invalid, or if the audio thread has not picked up the last
+	bank yet (its old bank may still be in use)
+*/
+bool PluginCore::openPatchBank(const char* bankPath)
+{
+	if (!bankPath || !*bankPath) return false;
+
+	SynthPatchBank* currentBank = patchBank.load(std::memory_order_relaxed);
+	if (currentBank != audioPatchBank.load(std::memory_order_acquire))
+		return false;
+
+	SynthPatchBank* nextBank = currentBank == &patchBanks[0] ? &patchBanks[1] : &patchBanks[0];
+	if (!nextBank->openBank(bankPath))
+		return false;
+
+	patchBank.store(nextBank, std::memory_order_release);
+	return true;
+}
+
+/**
+	\brief Write the patches of the open bank plus one more sound, as the last patch, to a bank file and open that
+	file. Call from the GUI thread, never the audio thread; the audio thread keeps reading the old bank until it
+	picks up the new one.
+
+	\param bankPath -- path to the bank file; may be the open bank
+	\param patchName -- name for the new patch
+	\param patch -- the new patch; see PLUGINGUI_TIMERPING in processMessage( )
+	\return true if the bank was written and opened
+*/
+bool PluginCore::savePatchBank(const char* bankPath, const char* patchName, const SynthPatchRecord& patch)
+{
+	if (!bankPath || !*bankPath || !patchName) return false;
+
+	std::vector<NamedSynthPatch> patches;
+	SynthPatchBank* currentBank = patchBank.load(std::memory_order_relaxed);
+	uint32_t patchCount = currentBank ? currentBank->getPatchCount() : 0;
+	for (uint32_t i = 0; i < patchCount; i++)
+	{
+		std::shared_ptr<SynthEngineModifiers> patchModifiers = std::make_shared<SynthEngineModifiers>();
+		if (!currentBank->loadPatch(i, patchModifiers))
+			return false;
+
+		patches.push_back(NamedSynthPatch(currentBank->getPatchName(i), patchModifiers));
+	}
+
+	std::shared_ptr<SynthEngineModifiers> newPatchModifiers = std::make_shared<SynthEngineModifiers>();
+	SynthPatchBank::decodePatch(patch, newPatchModifiers);
+	patches.push_back(NamedSynthPatch(patchName, newPatchModifiers));
+
+	// --- written under a temporary name and renamed, so the mapped bank stays readable
+	if (!SynthPatchBank::writeBank(bankPath, patches))
+		return false;
+
+	return openPatchBank(bankPath);
+}
+
 bool PluginCore::processAudioFrame(ProcessFrameInfo& processFrameInfo)
 {
-    // --- fire any MIDI events for this sample interval
-    processFrameInfo.midiEventQueue->fireMidiEvents(processFrameInfo.currentFrame);
+	// --- debug builds: no allocation from here on
+	SYNTH_AUDIO_THREAD_SCOPE();
 
 	// --- do per-frame updates; VST automation and parameter smoothing
 	doSampleAccurateParameterUpdates();
@@ -1372,6 +2362,7 @@ bool PluginCore::processAudioFrame(ProcessFrameInfo& processFrameInfo)
 		RenderInfo synthRenderInfo;
 		synthRenderInfo.numOutputChannels = kNumEngineOutputs;
 		synthRenderInfo.outputData = &synthEngineOutputs[0];
+		synthRenderInfo.sampleOffset = processFrameInfo.currentFrame; // --- engine fires queued MIDI at this offset
 		
 		// --- update engine with current plugin core values
 		updateEngine();
@@ -1438,6 +2429,73 @@ bool PluginCore::processAudioFrame(ProcessFrameInfo& processFrameInfo)
     return false; /// NOT processed
 }
 
+// --- the synth renders by blocks; the engine sums its voices into a block and runs the master FX on the whole block
+bool PluginCore::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
+{
+	// --- flush denormals to zero for the whole buffer; the host's mode is restored on return
+	DenormalGuard denormalGuard;
+
+	// --- FX plugins and unusual output formats: frame processing in the base class
+	if (getPluginType() != kSynthPlugin ||
+		(processBufferInfo.channelIOConfig.outputChannelFormat != kCFMono &&
+		 processBufferInfo.channelIOConfig.outputChannelFormat != kCFStereo))
+		return PluginBase::processAudioBuffers(processBufferInfo);
+
+	// --- sync internal bound variables, latch the transport and queue the MIDI events
+	preProcessAudioBuffers(processBufferInfo);
+
+	// --- debug builds: no allocation from here on
+	SYNTH_AUDIO_THREAD_SCOPE();
+
+	// --- render time for the engine telemetry; one clock read at each end of the buffer
+	std::chrono::steady_clock::time_point renderStart = std::chrono::steady_clock::now();
+
+	bool stereo = processBufferInfo.channelIOConfig.outputChannelFormat == kCFStereo;
+	uint32_t frame = 0;
+	while (frame < processBufferInfo.numFramesToProcess)
+	{
+		uint32_t blockSize = processBufferInfo.numFramesToProcess - frame;
+		if (blockSize > kSynthRenderBlockSize)
+			blockSize = kSynthRenderBlockSize;
+
+		// --- VST automation and parameter smoothing still run per frame; the engine is updated once per block
+		for (uint32_t i = 0; i < blockSize; i++)
+			doSampleAccurateParameterUpdates();
+
+		// --- update engine with current plugin core values
+		updateEngine();
+
+		// --- render synth; the engine fires queued MIDI at frame offsets in the block
+		synthEngine->renderBlock(&engineBlockOutputs[kEngineLeftOutput][0], &engineBlockOutputs[kEngineRightOutput][0], blockSize, frame);
+
+		// --- decode and output
+		for (uint32_t i = 0; i < blockSize; i++)
+			processBufferInfo.outputs[0][frame + i] = (float)engineBlockOutputs[kEngineLeftOutput][i];
+		if (stereo)
+		{
+			for (uint32_t i = 0; i < blockSize; i++)
+				processBufferInfo.outputs[1][frame + i] = (float)engineBlockOutputs[kEngineRightOutput][i];
+		}
+
+		frame += blockSize;
+	}
+
+	synthEngine->setTelemetryRenderTime(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - renderStart).count(),
+										processBufferInfo.numFramesToProcess);
+
+	// --- same timeline bookkeeping as the frame loop
+	if (processBufferInfo.hostInfo)
+	{
+		processBufferInfo.hostInfo->uAbsoluteFrameBufferIndex += processBufferInfo.numFramesToProcess;
+		processBufferInfo.hostInfo->dAbsoluteFrameBufferTime += (double)processBufferInfo.numFramesToProcess / audioProcDescriptor.sampleRate;
+	}
+
+	// --- meters and the MIDI stamped past the end of the buffer
+	postProcessAudioBuffers(processBufferInfo);
+
+	return true; /// processed
+}
+
 // --- do pre buffer processing
 bool PluginCore::preProcessAudioBuffers(ProcessBufferInfo& processInfo)
 {
@@ -1445,6 +2503,26 @@ bool PluginCore::preProcessAudioBuffers(ProcessBufferInfo& processInfo)
     //     want to use the auto-variable-binding
     syncInBoundVariables();
 
+	// --- latch the host transport for tempo synced components; the timeline position makes the
+	//     synced LFO phase deterministic when the host seeks or loops
+	if (processInfo.hostInfo)
+	{
+		if (processInfo.hostInfo->dBPM > 0.0)
+			hostBPM = processInfo.hostInfo->dBPM;
+		if (processInfo.hostInfo->uTimeSigDenomintor > 0)
+			hostTimeSigDenominator = processInfo.hostInfo->uTimeSigDenomintor;
+
+		synthEngine->setHostTransport(hostBPM, processInfo.hostInfo->fTimeSigNumerator, hostTimeSigDenominator,
+									  processInfo.hostInfo->uAbsoluteFrameBufferIndex);
+	}
+	else
+		synthEngine->continueTransport();
+
+	// --- drain the whole buffer's MIDI events in one pass; processMIDIEvent( ) queues them in the engine
+	//     which then splits renderBlock( ) at their sample offsets
+	if (processInfo.midiEventQueue && processInfo.midiEventQueue->getEventCount() > 0)
+		processInfo.midiEventQueue->fireAllMidiEvents(processInfo.numFramesToProcess);
+
 	// updateEngine();
 
     return true;
@@ -1457,6 +2535,9 @@ bool PluginCore::postProcessAudioBuffers(ProcessBufferInfo& processInfo)
 	//     in the future
 	updateOutBoundVariables();
 
+	// --- fire anything the host stamped past the end of the buffer
+	synthEngine->flushMIDIEvents();
+
     return true;
 }
 
@@ -1511,18 +2592,27 @@ bool PluginCore::postUpdatePluginParameter(int32_t controlID, double controlValu
 //            the state of your plugin.
 bool PluginCore::guiParameterChanged(int32_t controlID, double actualValue)
 {
-	/*
+	// --- the patch bank buttons; file work stays on the GUI thread
 	switch (controlID)
 	{
-		case controlID::<your control here>
+		case controlID::bankSave:
 		{
+			// --- ask the audio thread for the current sound; the GUI timer writes it once it arrives
+			if (actualValue > 0.5 && !patchSnapshotReady.load(std::memory_order_acquire))
+				patchSnapshotRequested.store(true, std::memory_order_release);
+			return true; // handled
+		}
 
+		case controlID::bankReload:
+		{
+			if (actualValue > 0.5)
+				openPatchBank(patchBankPath.c_str());
 			return true; // handled
 		}
 
 		default:
 			break;
-	}*/
+	}
 
 	return false; /// not handled
 }
@@ -1536,7 +2626,10 @@ bool PluginCore::setVectorJoystickParameters(const VectorJoystickData& vectorJoy
 //     will be called on each sample interval for each MIDI event that occurred
 bool PluginCore::processMIDIEvent(midiEvent& event)
 {
-	synthEngine->processMIDIEvent(event);
+	// --- queue for sample accurate dispatch from the engine's render( )
+	if (!synthEngine->queueMIDIEvent(event))
+		synthEngine->processMIDIEvent(event); // --- queue full: fire now rather than lose a note-off
+
 
     return true;
 }
@@ -1562,6 +2655,25 @@ bool PluginCore::processMessage(MessageInfo& messageInfo)
         // --- update view; this will only be called if the GUI is actually open
         case PLUGINGUI_TIMERPING:
         {
+            // --- the GUI timer is the one telemetry reader: drain the ring, keep the newest frame
+            if (synthEngine->getTelemetryRing()->popLatestFrame(engineTelemetry))
+            {
+                // --- meters: output peaks, render time as a fraction of real time, voice slots in use
+                setPIParamValue(controlID::peakMeterL, engineTelemetry.peak[0]);
+                setPIParamValue(controlID::peakMeterR, engineTelemetry.peak[1]);
+                setPIParamValue(controlID::cpuLoadMeter, engineTelemetry.cpuLoad);
+                setPIParamValue(controlID::voicesMeter, (double)engineTelemetry.activeVoices / (double)kMaxTelemetryVoices);
+            }
+
+            // --- "Bank Save": the audio thread has encoded the sound; append it to the bank here, off the audio thread
+            if (patchSnapshotReady.load(std::memory_order_acquire))
+            {
+                SynthPatchBank* currentBank = patchBank.load(std::memory_order_relaxed);
+                char patchName[kMaxPatchNameLength] = { 0 };
+                snprintf(patchName, kMaxPatchNameLength, "User %u", (currentBank ? currentBank->getPatchCount() : 0) + 1);
+                savePatchBank(patchBankPath.c_str(), patchName, patchSnapshot);
+                patchSnapshotReady.store(false, std::memory_order_release);
+            }
             return false;
         }
 
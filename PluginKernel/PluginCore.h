@@ -3,6 +3,8 @@
 
 #include "PluginBase.h"
 #include "SynthEngine.h"
+#include "SynthPatchBank.h"
+#include "DenormalGuard.h"
 
 // **--0x7F1F--**
 
@@ -82,7 +84,87 @@ enum controlID {
 	eg2RepeatTime_mSec = 100,
 	eg1RepeatTime_SubDiv = 31,
 	eg2RepeatTime_SubDiv = 101,
-	subdivideTime = 3079
+	subdivideTime = 3079,
+	enableMPE = 3085,
+	msegTempoSync = 3086,
+	globalLFO1FreqControl = 140,
+	globalLFO1AmpControl = 141,
+	globalLFO1Wave = 142,
+	globalLFO2FreqControl = 143,
+	globalLFO2AmpControl = 144,
+	globalLFO2Wave = 145,
+	lfo1SyncSubDiv = 146,
+	lfo2SyncSubDiv = 147,
+	globalLFO1SyncSubDiv = 148,
+	globalLFO2SyncSubDiv = 149,
+	delaySyncSubDiv = 150,
+	ensembleTaps = 151,
+	ensembleRate_Hz = 152,
+	ensembleDepth_Pct = 153,
+	ensembleMix_Pct = 154,
+	enableEnsembleFX = 3087,
+	reverbTime_mSec = 155,
+	reverbDamping_Pct = 156,
+	reverbSize_Pct = 157,
+	reverbPreDelay_mSec = 158,
+	reverbMix_Pct = 159,
+	enableReverbFX = 3088,
+	oversampling = 160,
+	unisonCount = 161,
+	supersawCount = 162,
+	supersawDetune_Pct = 163,
+	supersawMix_Pct = 164,
+	fmAlgorithm = 165,
+	fmFeedback_Pct = 166,
+	fmAmpControl_dB = 167,
+	fmAttackTime_mSec = 168,
+	fmReleaseTime_mSec = 169,
+	fmOp1Ratio = 170,
+	fmOp1Level_Pct = 171,
+	fmOp1DecayTime_mSec = 172,
+	fmOp1Sustain_Pct = 173,
+	fmOp2Ratio = 174,
+	fmOp2Level_Pct = 175,
+	fmOp2DecayTime_mSec = 176,
+	fmOp2Sustain_Pct = 177,
+	fmOp3Ratio = 178,
+	fmOp3Level_Pct = 179,
+	fmOp3DecayTime_mSec = 180,
+	fmOp3Sustain_Pct = 181,
+	fmOp4Ratio = 182,
+	fmOp4Level_Pct = 183,
+	fmOp4DecayTime_mSec = 184,
+	fmOp4Sustain_Pct = 185,
+	bankPatch = 186,
+	msegPoints = 187,
+	msegPt1Level = 188,
+	msegPt1Time_mSec = 189,
+	msegPt1Beats = 190,
+	msegPt1Curve = 191,
+	msegPt2Level = 192,
+	msegPt2Time_mSec = 193,
+	msegPt2Beats = 194,
+	msegPt2Curve = 195,
+	msegPt3Level = 196,
+	msegPt3Time_mSec = 197,
+	msegPt3Beats = 198,
+	msegPt3Curve = 199,
+	msegPt4Level = 200,
+	msegPt4Time_mSec = 201,
+	msegPt4Beats = 202,
+	msegPt4Curve = 203,
+	msegSustainPoint = 204,
+	msegLoop = 205,
+	msegLoopStart = 206,
+	msegLoopEnd = 207,
+	bankPage = 208,
+	bankSave = 209,
+	bankReload = 210,
+	masterFXOrder = 211,
+	peakMeterL = 212,
+	peakMeterR = 213,
+	cpuLoadMeter = 214,
+	voicesMeter = 215
 };
 
 	// **--0x0F1F--**
@@ -106,9 +188,8 @@ public:
 	// --- Process audio by frames (default)
 	virtual bool processAudioFrame(ProcessFrameInfo& processFrameInfo);
 
-	// --- uncomment and override this for buffer processing; see base class implementation for
-	//     help on breaking up buffers and getting info from processBufferInfo
-	//virtual bool processAudioBuffers(ProcessBufferInfo& processBufferInfo);
+	// --- Process audio by buffers: the synth renders in blocks; FX plugins use the base class frame processing
+	virtual bool processAudioBuffers(ProcessBufferInfo& processBufferInfo);
 
 	// --- preProcess: sync GUI parameters here; override if you don't want to use automatic variable-binding
 	virtual bool preProcessAudioBuffers(ProcessBufferInfo& processInfo);
@@ -149,6 +230,29 @@ public:
 	// --- user data
 	SynthEngine* synthEngine = nullptr;
 	void updateEngine();
+	double hostBPM = 120.0;		///< tempo from HostInfo::dBPM, latched at the top of each buffer
+	uint32_t hostTimeSigDenominator = 4;	///< time signature denominator from HostInfo, latched at the top of each buffer
+	EngineTelemetryFrame engineTelemetry;	///< newest engine telemetry, refreshed on the GUI timer for meters and voice displays
+
+	// --- block rendering: the engine is updated once per block of (at most) kSynthRenderBlockSize samples
+	static const uint32_t kSynthRenderBlockSize = 64;
+	double engineBlockOutputs[kNumEngineOutputs][kSynthRenderBlockSize] = { { 0.0 } };	///< one engine block, converted to the host buffers
+
+	// --- binary patch bank: "Bank Patch" 0 plays the panel controls, N plays patch N - 1 of "Bank Page"; the GUI
+	//     thread opens and writes banks ("Bank Reload", "Bank Save"), the audio thread only decodes patches
+	static const uint32_t kBankPatchesPerPage = 128;
+	static std::string getPatchBankPath();
+	bool openPatchBank(const char* bankPath);
+	bool savePatchBank(const char* bankPath, const char* patchName, const SynthPatchRecord& patch);
+	std::string patchBankPath;				///< the user's bank file
+	SynthPatchBank patchBanks[2];			///< the bank the audio thread reads and a spare that the next bank is opened into
+	std::atomic<SynthPatchBank*> patchBank{ nullptr };		///< newest open bank; set by openPatchBank( )
+	std::atomic<SynthPatchBank*> audioPatchBank{ nullptr };	///< bank the audio thread reads; set by updateEngine( )
+	SynthPatchRecord panelPatch;			///< the panel's engine modifiers, kept while a bank patch replaces them
+	int loadedBankPatch = 0;				///< bank patch number + 1 in the engine modifiers; 0 = panel, -1 = reload
+	std::atomic<bool> patchSnapshotRequested{ false };	///< "Bank Save" pressed; the audio thread encodes the sound
+	std::atomic<bool> patchSnapshotReady{ false };		///< patchSnapshot holds the sound; the GUI timer saves it
+	SynthPatchRecord patchSnapshot;			///< the sound to save, encoded on the audio thread
 
 	// --- end user variables/functions
 
@@ -169,6 +273,10 @@ private:
 	double lfo1AmpControl = 0.0;
 	double lfo2FreqControl = 0.0;
 	double lfo2AmpControl = 0.0;
+	double globalLFO1FreqControl = 0.0;
+	double globalLFO1AmpControl = 0.0;
+	double globalLFO2FreqControl = 0.0;
+	double globalLFO2AmpControl = 0.0;
 	double filter1Fc = 0.0;
 	double filter1Q = 0.0;
 	double eg2AttackTime_mSec = 0.0;
@@ -194,6 +302,15 @@ private:
 	double delayMix_Pct = 0.0;
 	double chorusRate_Hz = 0.0;
 	double chorusDepth_Pct = 0.0;
+	int ensembleTaps = 0;
+	double ensembleRate_Hz = 0.0;
+	double ensembleDepth_Pct = 0.0;
+	double ensembleMix_Pct = 0.0;
+	double reverbTime_mSec = 0.0;
+	double reverbDamping_Pct = 0.0;
+	double reverbSize_Pct = 0.0;
+	double reverbPreDelay_mSec = 0.0;
+	double reverbMix_Pct = 0.0;
 	double filter2Fc = 0.0;
 	double filter2Q = 0.0;
 	double eg2DelayTime_mSec = 0.0;
@@ -203,10 +320,10 @@ private:
 
 	// --- Discrete Plugin Variables 
 	int osc1Wave = 0;
-	enum class osc1WaveEnum { Saw,Square,Triangle,Sin,WhiteNoise };	// to compare: if(compareEnum(osc1WaveEnum::Saw, osc1Wave)) etc... 
+	enum class osc1WaveEnum { Saw,Square,Triangle,Sin,WhiteNoise,Supersaw };	// to compare: if(compareEnum(osc1WaveEnum::Saw, osc1Wave)) etc... 
 
 	int osc2Wave = 0;
-	enum class osc2WaveEnum { Saw,Square,Triangle,Sin,WhiteNoise };	// to compare: if(compareEnum(osc2WaveEnum::Saw, osc2Wave)) etc... 
+	enum class osc2WaveEnum { Saw,Square,Triangle,Sin,WhiteNoise,Supersaw };	// to compare: if(compareEnum(osc2WaveEnum::Saw, osc2Wave)) etc... 
 
 	int lfo1Wave = 0;
 	enum class lfo1WaveEnum { Sin,UpSaw,DownSaw,Square,Triangle,RSH,QRSH,ExpUp,ExpDown,WhiteNoise };	// to compare: if(compareEnum(lfo1WaveEnum::Sin, lfo1Wave)) etc... 
@@ -254,13 +371,13 @@ private:
 	enum class invertFilterFcEnum { SWITCH_OFF,SWITCH_ON };	// to compare: if(compareEnum(invertFilterFcEnum::SWITCH_OFF, invertFilterFc)) etc... 
 
 	int modSource1 = 0;
-	enum class modSource1Enum { None,LFO1_Out,LFO1_InvOut,LFO2_Out,LFO2_InvOut,EG1_Out,EG1_BiasOut,EG2_Out,EG2_BiasOut,Osc1_Out,Osc2_Out,SubOsc_Out };	// to compare: if(compareEnum(modSource1Enum::None, modSource1)) etc... 
+	enum class modSource1Enum { None,LFO1_Out,LFO1_InvOut,LFO2_Out,LFO2_InvOut,EG1_Out,EG1_BiasOut,EG2_Out,EG2_BiasOut,Osc1_Out,Osc2_Out,SubOsc_Out,MPE_Bend,MPE_Pressure,MPE_Slide,MSEG_Out,GLFO1_Out,GLFO1_InvOut,GLFO2_Out,GLFO2_InvOut };	// to compare: if(compareEnum(modSource1Enum::None, modSource1)) etc... 
 
 	int modDest1 = 0;
 	enum class modDest1Enum { None,Osc1_Pitch,Osc2_Pitch,All_Osc_Pitch,Osc1_PW,Osc2_PW,SubOsc_PW,All_Osc_PW,Filter1_fc,Filter1_Q,Filter2_fc,Filter2_Q,EG1_Repeat_mSec,EG2_Repeat_mSec,EG1_Repeat_SubDiv,EG2_Repeat_SubDiv,DCA_Amp,DCA_Pan,DelayFX_Mix,DelayFX_FB,Chorus_Depth };	// to compare: if(compareEnum(modDest1Enum::None, modDest1)) etc... 
 
 	int modSource2 = 0;
-	enum class modSource2Enum { None,LFO1_Out,LFO1_InvOut,LFO2_Out,LFO2_InvOut,EG1_Out,EG1_BiasOut,EG2_Out,EG2_BiasOut,Osc1_Out,Osc2_Out,SubOsc_Out };	// to compare: if(compareEnum(modSource2Enum::None, modSource2)) etc... 
+	enum class modSource2Enum { None,LFO1_Out,LFO1_InvOut,LFO2_Out,LFO2_InvOut,EG1_Out,EG1_BiasOut,EG2_Out,EG2_BiasOut,Osc1_Out,Osc2_Out,SubOsc_Out,MPE_Bend,MPE_Pressure,MPE_Slide,MSEG_Out,GLFO1_Out,GLFO1_InvOut,GLFO2_Out,GLFO2_InvOut };	// to compare: if(compareEnum(modSource2Enum::None, modSource2)) etc... 
 
 	int modDest2 = 0;
 	enum class modDest2Enum { None,Osc1_Pitch,Osc2_Pitch,All_Osc_Pitch,Osc1_PW,Osc2_PW,SubOsc_PW,All_Osc_PW,Filter1_fc,Filter1_Q,Filter2_fc,Filter2_Q,EG1_Repeat_mSec,EG2_Repeat_mSec,EG1_Repeat_SubDiv,EG2_Repeat_SubDiv,DCA_Amp,DCA_Pan,DelayFX_Mix,DelayFX_FB,Chorus_Depth };	// to compare: if(compareEnum(modDest2Enum::None, modDest2)) etc... 
@@ -292,6 +409,149 @@ private:
 	int subdivideTime = 0;
 	enum class subdivideTimeEnum { SWITCH_OFF,SWITCH_ON };	// to compare: if(compareEnum(subdivideTimeEnum::SWITCH_OFF, subdivideTime)) etc... 
 
+	int enableMPE = 0;
+	enum class enableMPEEnum { SWITCH_OFF,SWITCH_ON };	// to compare: if(compareEnum(enableMPEEnum::SWITCH_OFF, enableMPE)) etc... 
+
+	int msegTempoSync = 0;
+	enum class msegTempoSyncEnum { SWITCH_OFF,SWITCH_ON };	// to compare: if(compareEnum(msegTempoSyncEnum::SWITCH_OFF, msegTempoSync)) etc... 
+
+	int globalLFO1Wave = 0;
+	enum class globalLFO1WaveEnum { Sin,UpSaw,DownSaw,Square,Triangle,RSH,QRSH,ExpUp,ExpDown,WhiteNoise };	// to compare: if(compareEnum(globalLFO1WaveEnum::Sin, globalLFO1Wave)) etc... 
+
+	int globalLFO2Wave = 0;
+	enum class globalLFO2WaveEnum { Sin,UpSaw,DownSaw,Square,Triangle,RSH,QRSH,ExpUp,ExpDown,WhiteNoise };	// to compare: if(compareEnum(globalLFO2WaveEnum::Sin, globalLFO2Wave)) etc... 
+
+	int lfo1SyncSubDiv = 0;
+	enum class lfo1SyncSubDivEnum { Off,Whole,Dotted_Half,Half,Dotted_Quarter,Quarter,Dotted_Eigth,Triplet_Quarter,Eigth,Triplet_Eigth,Sixteenth };	// to compare: if(compareEnum(lfo1SyncSubDivEnum::Off, lfo1SyncSubDiv)) etc... 
+
+	int lfo2SyncSubDiv = 0;
+	enum class lfo2SyncSubDivEnum { Off,Whole,Dotted_Half,Half,Dotted_Quarter,Quarter,Dotted_Eigth,Triplet_Quarter,Eigth,Triplet_Eigth,Sixteenth };	// to compare: if(compareEnum(lfo2SyncSubDivEnum::Off, lfo2SyncSubDiv)) etc... 
+
+	int globalLFO1SyncSubDiv = 0;
+	enum class globalLFO1SyncSubDivEnum { Off,Whole,Dotted_Half,Half,Dotted_Quarter,Quarter,Dotted_Eigth,Triplet_Quarter,Eigth,Triplet_Eigth,Sixteenth };	// to compare: if(compareEnum(globalLFO1SyncSubDivEnum::Off, globalLFO1SyncSubDiv)) etc... 
+
+	int globalLFO2SyncSubDiv = 0;
+	enum class globalLFO2SyncSubDivEnum { Off,Whole,Dotted_Half,Half,Dotted_Quarter,Quarter,Dotted_Eigth,Triplet_Quarter,Eigth,Triplet_Eigth,Sixteenth };	// to compare: if(compareEnum(globalLFO2SyncSubDivEnum::Off, globalLFO2SyncSubDiv)) etc... 
+
+	int delaySyncSubDiv = 0;
+	enum class delaySyncSubDivEnum { Off,Whole,Dotted_Half,Half,Dotted_Quarter,Quarter,Dotted_Eigth,Triplet_Quarter,Eigth,Triplet_Eigth,Sixteenth };	// to compare: if(compareEnum(delaySyncSubDivEnum::Off, delaySyncSubDiv)) etc... 
+
+	int enableEnsembleFX = 0;
+	enum class enableEnsembleFXEnum { SWITCH_OFF,SWITCH_ON };	// to compare: if(compareEnum(enableEnsembleFXEnum::SWITCH_OFF, enableEnsembleFX)) etc... 
+
+	int enableReverbFX = 0;
+	enum class enableReverbFXEnum { SWITCH_OFF,SWITCH_ON };	// to compare: if(compareEnum(enableReverbFXEnum::SWITCH_OFF, enableReverbFX)) etc... 
+
+	int oversampling = 0;
+	enum class oversamplingEnum { x1,x2,x4 };	// to compare: if(compareEnum(oversamplingEnum::x1, oversampling)) etc... 
+
+	int unisonCount = 0;
+
+	int supersawCount = 0;
+
+	double supersawDetune_Pct = 0.0;
+
+	double supersawMix_Pct = 0.0;
+
+	int fmAlgorithm = 0;
+	enum class fmAlgorithmEnum { Alg1,Alg2,Alg3,Alg4,Alg5,Alg6,Alg7,Alg8 };	// to compare: if(compareEnum(fmAlgorithmEnum::Alg1, fmAlgorithm)) etc... 
+
+	double fmFeedback_Pct = 0.0;
+
+	double fmAmpControl_dB = 0.0;
+
+	double fmAttackTime_mSec = 0.0;
+
+	double fmReleaseTime_mSec = 0.0;
+
+	double fmOp1Ratio = 0.0;
+
+	double fmOp1Level_Pct = 0.0;
+
+	double fmOp1DecayTime_mSec = 0.0;
+
+	double fmOp1Sustain_Pct = 0.0;
+
+	double fmOp2Ratio = 0.0;
+
+	double fmOp2Level_Pct = 0.0;
+
+	double fmOp2DecayTime_mSec = 0.0;
+
+	double fmOp2Sustain_Pct = 0.0;
+
+	double fmOp3Ratio = 0.0;
+
+	double fmOp3Level_Pct = 0.0;
+
+	double fmOp3DecayTime_mSec = 0.0;
+
+	double fmOp3Sustain_Pct = 0.0;
+
+	double fmOp4Ratio = 0.0;
+
+	double fmOp4Level_Pct = 0.0;
+
+	double fmOp4DecayTime_mSec = 0.0;
+
+	double fmOp4Sustain_Pct = 0.0;
+
+	int bankPatch = 0;
+
+	int msegPoints = 0;
+
+	double msegPt1Level = 0.0;
+
+	double msegPt1Time_mSec = 0.0;
+
+	double msegPt1Beats = 0.0;
+
+	double msegPt1Curve = 0.0;
+
+	double msegPt2Level = 0.0;
+
+	double msegPt2Time_mSec = 0.0;
+
+	double msegPt2Beats = 0.0;
+
+	double msegPt2Curve = 0.0;
+
+	double msegPt3Level = 0.0;
+
+	double msegPt3Time_mSec = 0.0;
+
+	double msegPt3Beats = 0.0;
+
+	double msegPt3Curve = 0.0;
+
+	double msegPt4Level = 0.0;
+
+	double msegPt4Time_mSec = 0.0;
+
+	double msegPt4Beats = 0.0;
+
+	double msegPt4Curve = 0.0;
+
+	int msegSustainPoint = 0;
+
+	int msegLoop = 0;
+	enum class msegLoopEnum { SWITCH_OFF,SWITCH_ON };	// to compare: if(compareEnum(msegLoopEnum::SWITCH_OFF, msegLoop)) etc... 
+
+	int msegLoopStart = 0;
+
+	int msegLoopEnd = 0;
+
+	int bankPage = 0;
+
+	int bankSave = 0;
+	enum class bankSaveEnum { SWITCH_OFF,SWITCH_ON };	// to compare: if(compareEnum(bankSaveEnum::SWITCH_OFF, bankSave)) etc... 
+
+	int bankReload = 0;
+	enum class bankReloadEnum { SWITCH_OFF,SWITCH_ON };	// to compare: if(compareEnum(bankReloadEnum::SWITCH_OFF, bankReload)) etc... 
+
+	int masterFXOrder = 0;
+	enum class masterFXOrderEnum { CHO_ENS_DLY_REV,CHO_ENS_REV_DLY,CHO_DLY_ENS_REV,CHO_DLY_REV_ENS,CHO_REV_ENS_DLY,CHO_REV_DLY_ENS,ENS_CHO_DLY_REV,ENS_CHO_REV_DLY,ENS_DLY_CHO_REV,ENS_DLY_REV_CHO,ENS_REV_CHO_DLY,ENS_REV_DLY_CHO,DLY_CHO_ENS_REV,DLY_CHO_REV_ENS,DLY_ENS_CHO_REV,DLY_ENS_REV_CHO,DLY_REV_CHO_ENS,DLY_REV_ENS_CHO,REV_CHO_ENS_DLY,REV_CHO_DLY_ENS,REV_ENS_CHO_DLY,REV_ENS_DLY_CHO,REV_DLY_CHO_ENS,REV_DLY_ENS_CHO };	// to compare: if(compareEnum(masterFXOrderEnum::CHO_ENS_DLY_REV, masterFXOrder)) etc... 
+
 	// **--0x1A7F--**
     // --- end member variables
 
@@ -199,13 +199,13 @@ IPluginGUIConnector* PluginGUI::open(UTF8StringPtr _viewName, void* parent, std:
     for(int i=0; i<size; i++)
     {
         PluginParameter* ctrl = new PluginParameter(*(*pluginParameterPtr)[i]);
-        pluginParameters.push_back(ctrl);
+        addGUIControl(ctrl);
     }
 
 	// --- add the preset file writer (not a plugin parameter, but a GUI parameter - does not need to be stored/refreshed
 	PluginParameter* piParam = new PluginParameter(WRITE_PRESET_FILE, "Preset", "SWITCH_OFF,SWITCH_ON", "SWITCH_OFF");
 	piParam->setIsDiscreteSwitch(true);
-	pluginParameters.push_back(piParam);
+	addGUIControl(piParam);
 
     // --- set knob action
     UIAttributes* attributes = description->getCustomAttributes("Settings", true);
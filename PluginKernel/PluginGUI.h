@@ -361,16 +361,20 @@ protected:
             delete *it;
         }
         pluginParameters.clear();
+        guiParameterRegistry.clear();
+    }
+
+    // --- add a control to the list and the tag registry
+    void addGUIControl(PluginParameter* ctrl)
+    {
+        pluginParameters.push_back(ctrl);
+        guiParameterRegistry.addIndex(ctrl->getControlID(), (int32_t)pluginParameters.size() - 1);
     }
 
     PluginParameter* getGuiControlWithTag(int tag)
     {
-        for(std::vector<PluginParameter*>::iterator it = pluginParameters.begin(); it != pluginParameters.end(); ++it) {
-            PluginParameter* ctrl = *it;
-            if(ctrl->getControlID() == tag)
-                return ctrl;
-        }
-        return nullptr;
+        int32_t index = guiParameterRegistry.getIndex(tag);
+        return index >= 0 ? pluginParameters[index] : nullptr;
     }
 
     PluginGUIConnector* pluginGUIConnector;
@@ -590,6 +594,7 @@ private:
     CControlUpdateReceiverMap controlUpdateReceivers;
     std::vector<CControl*> writeableControls;
     std::vector<PluginParameter*> pluginParameters;
+    ParameterRegistry guiParameterRegistry; ///< tag -> pluginParameters index
 #ifdef AAXPLUGIN
     AAX_IViewContainer* aaxViewContainer = nullptr;
 #endif
@@ -650,5 +650,52 @@ private:
 
 };
 
-#endif
+// --- controlIDs below this are indexed with a flat table; larger ones (GUI-only tags like WRITE_PRESET_FILE) use a map
+const uint32_t kMaxDenseControlID = 16384;
+
+// --- ParameterRegistry: O(1) controlID -> array index lookup for the parameter lists in the core, the GUI and the presets;
+//     controlIDs are small dense integers, so the table is a vector indexed by controlID holding -1 for unused IDs
+class ParameterRegistry
+{
+public:
+    ParameterRegistry() {}
+
+    // --- register the array index of a controlID; a duplicate controlID keeps its first index, like a search would
+    void addIndex(uint32_t controlID, int32_t index)
+    {
+        if (controlID < kMaxDenseControlID)
+        {
+            if (controlID >= indexTable.size())
+                indexTable.resize(controlID + 1, -1);
+            if (indexTable[controlID] < 0)
+                indexTable[controlID] = index;
+        }
+        else
+            sparseIndexes.insert(std::make_pair(controlID, index));
+    }
+
+    // --- array index of a controlID, or -1 if it is not registered
+    int32_t getIndex(uint32_t controlID) const
+    {
+        if (controlID < kMaxDenseControlID)
+            return controlID < indexTable.size() ? indexTable[controlID] : -1;
+
+        std::map<uint32_t, int32_t>::const_iterator it = sparseIndexes.find(controlID);
+        return it != sparseIndexes.end() ? it->second : -1;
+    }
 
+    // --- number of controlIDs the flat table covers
+    size_t getTableSize() const { return indexTable.size(); }
+
+    void clear()
+    {
+        indexTable.clear();
+        sparseIndexes.clear();
+    }
+
+private:
+    std::vector<int32_t> indexTable;                ///< controlID -> index, -1 = unused
+    std::map<uint32_t, int32_t> sparseIndexes;      ///< controlIDs >= kMaxDenseControlID
+};
+
+#endif
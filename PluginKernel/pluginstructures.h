@@ -869,6 +869,17 @@ public:
 
 	// --- Fire off the next
 	virtual bool fireMidiEvents(uint32_t uSampleOffset) = 0;
+
+	// --- Fire every event in the buffer in one pass; each event carries its own midiSampleOffset
+	//     so the plugin can place it in the buffer. Wrappers override this to walk their event list
+	//     once; the default falls back to firing offset by offset for queues that can only do that.
+	virtual bool fireAllMidiEvents(uint32_t uNumSampleOffsets)
+	{
+		bool fired = false;
+		for (uint32_t i = 0; i < uNumSampleOffsets; i++)
+			fired = fireMidiEvents(i) || fired;
+		return fired;
+	}
 };
 
 // --- Interface for VST3 parameter value update queue (sample accurate automation)
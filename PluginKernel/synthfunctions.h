@@ -44,9 +44,14 @@ const unsigned char EXPRESSION_CC11 = 0x0B;
 const unsigned char JOYSTICK_X = 0x10;
 const unsigned char JOYSTICK_Y = 0x11;
 const unsigned char SUSTAIN_PEDAL = 0x40;
+const unsigned char MPE_SLIDE_CC74 = 0x4A;		// --- MPE per-note "slide" (timbre) controller
 const unsigned char RESET_ALL_CONTROLLERS = 0x79;
 const unsigned char ALL_NOTES_OFF = 0x7B;
 
+// --- MPE (MIDI Polyphonic Expression) lower zone: channel 1 is the master channel, channels 2-16 are member channels (zero-indexed here)
+const unsigned char MPE_MASTER_CHANNEL = 0x00;
+const unsigned char MPE_NUM_CHANNELS = 16;
+
 // --- SYSTEM MESSAGES
 const unsigned char SYSTEM_EXCLUSIVE = 0xF0;
 const unsigned char MIDI_TIME_CODE = 0xF1;
@@ -0,0 +1,128 @@
+#include "AllocationTripwire.h"
+
+#ifdef SYNTH_ALLOCATION_TRIPWIRE
+
+#include <assert.h>
+#include <stdlib.h>
+#include <new>
+
+std::atomic<uint64_t> AllocationTripwire::tripCount{ 0 };
+std::atomic<size_t> AllocationTripwire::lastTripSize{ 0 };
+std::atomic<bool> AllocationTripwire::assertOnTrip{ true };
+
+// --- audio thread scope depth of the calling thread; a plain counter so that checking it never allocates. With the
+//     malloc( ) hooks it must not be dynamic TLS either: the first access from a thread would allocate the TLS block
+#if defined(__GLIBC__)
+static thread_local uint32_t audioThreadDepth __attribute__((tls_model("initial-exec"))) = 0;
+#else
+static thread_local uint32_t audioThreadDepth = 0;
+#endif
+
+/** mark the calling thread as the audio thread; scopes nest */
+void AllocationTripwire::enterAudioThread()
+{
+	audioThreadDepth++;
+}
+
+/** leave the innermost audio thread scope */
+void AllocationTripwire::exitAudioThread()
+{
+	if (audioThreadDepth > 0)
+		audioThreadDepth--;
+}
+
+/** true inside an audio thread scope */
+bool AllocationTripwire::isAudioThread()
+{
+	return audioThreadDepth > 0;
+}
+
+/**
+	\brief Count an audio thread allocation (or free) and assert if asked to
+	\param size -- bytes requested; 0 for a free
+*/
+void AllocationTripwire::trip(size_t size)
+{
+	tripCount.fetch_add(1, std::memory_order_relaxed);
+	lastTripSize.store(size, std::memory_order_relaxed);
+
+	// --- look up the call stack: this allocation (or free) happened inside render( ) or processMIDIEvent( )
+	assert(!assertOnTrip.load(std::memory_order_relaxed) && "allocation on the audio thread");
+}
+
+// --- glibc: malloc( ), calloc( ), realloc( ) and free( ) are replaced as well (an executable or shared object that
+//     defines them interposes the C library's), and everything calls the C library's own allocator underneath
+#if defined(__GLIBC__)
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* memory, size_t size);
+extern "C" void __libc_free(void* memory);
+
+#define TRIPWIRE_MALLOC(size) __libc_malloc(size)
+#define TRIPWIRE_FREE(memory) __libc_free(memory)
+
+extern "C" void* malloc(size_t size)
+{
+	if (audioThreadDepth > 0)
+		AllocationTripwire::trip(size);
+	return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size)
+{
+	if (audioThreadDepth > 0)
+		AllocationTripwire::trip(count*size);
+	return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* memory, size_t size)
+{
+	if (audioThreadDepth > 0)
+		AllocationTripwire::trip(size);
+	return __libc_realloc(memory, size);
+}
+
+extern "C" void free(void* memory)
+{
+	if (memory && audioThreadDepth > 0)
+		AllocationTripwire::trip(0);
+	__libc_free(memory);
+}
+#else
+#define TRIPWIRE_MALLOC(size) malloc(size)
+#define TRIPWIRE_FREE(memory) free(memory)
+#endif
+
+/** the replaced operators all come through here */
+static void* tripwireAllocate(size_t size)
+{
+	if (audioThreadDepth > 0)
+		AllocationTripwire::trip(size);
+
+	void* memory = TRIPWIRE_MALLOC(size > 0 ? size : 1);
+	if (!memory)
+		throw std::bad_alloc();
+	return memory;
+}
+
+static void tripwireFree(void* memory)
+{
+	if (memory && audioThreadDepth > 0)
+		AllocationTripwire::trip(0);
+
+	TRIPWIRE_FREE(memory);
+}
+
+// --- global replacements; aligned forms are not used by the synth objects and keep the default implementation
+void* operator new(size_t size) { return tripwireAllocate(size); }
+void* operator new[](size_t size) { return tripwireAllocate(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { try { return tripwireAllocate(size); } catch (...) { return nullptr; } }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { try { return tripwireAllocate(size); } catch (...) { return nullptr; } }
+void operator delete(void* memory) noexcept { tripwireFree(memory); }
+void operator delete[](void* memory) noexcept { tripwireFree(memory); }
+void operator delete(void* memory, size_t) noexcept { tripwireFree(memory); }
+void operator delete[](void* memory, size_t) noexcept { tripwireFree(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { tripwireFree(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { tripwireFree(memory); }
+
+#endif // SYNTH_ALLOCATION_TRIPWIRE
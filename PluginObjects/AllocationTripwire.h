@@ -0,0 +1,73 @@
+#pragma once
+
+// --- the allocation tripwire is compiled in only when SYNTH_ALLOCATION_TRIPWIRE is defined (here or in the project
+//     settings, debug builds only); otherwise the SYNTH_AUDIO_THREAD_SCOPE macro compiles to nothing and the global
+//     operator new/delete are not replaced
+//#define SYNTH_ALLOCATION_TRIPWIRE
+
+#ifdef SYNTH_ALLOCATION_TRIPWIRE
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+/**
+	\class AllocationTripwire
+	\ingroup SynthClasses
+	\brief Debug check for the allocation-free audio thread. The global operator new and delete (all forms) are replaced
+	and count every call made inside an audio thread scope: the render( ) and processMIDIEvent( ) calls mark their thread
+	with SYNTH_AUDIO_THREAD_SCOPE( ), scopes nest, and everything outside a scope is left alone. With assertOnTrip set
+	(the default) the first audio thread allocation asserts, so a debugger stops on the offending call stack.
+
+	With glibc, malloc( ), calloc( ), realloc( ) and free( ) are replaced too, so C library and third party allocations
+	on the audio thread are caught. Elsewhere (macOS, Windows) only operator new/delete are hooked: there is no portable
+	way to replace malloc( ) from inside a plugin, so direct malloc( ) calls go unseen there. The synth objects do not
+	make any; run the headless test (tests/AllocationTripwireTest.cpp) on Linux to check the C library calls as well.
+	Aligned allocations (posix_memalign( ), aligned operator new) are not hooked on any platform.
+*/
+class AllocationTripwire
+{
+public:
+	// --- audio thread scope of the calling thread
+	static void enterAudioThread();
+	static void exitAudioThread();
+	static bool isAudioThread();
+
+	// --- called by the replaced operators
+	static void trip(size_t size);
+
+	/** allocations and frees seen inside audio thread scopes since the last reset */
+	static uint64_t getTripCount() { return tripCount.load(std::memory_order_relaxed); }
+
+	/** size of the last allocation seen, 0 for a free */
+	static size_t getLastTripSize() { return lastTripSize.load(std::memory_order_relaxed); }
+
+	/** clear the counters */
+	static void resetTripCount() { tripCount.store(0, std::memory_order_relaxed); lastTripSize.store(0, std::memory_order_relaxed); }
+
+	/** assert on the first trip (default) or only count them, e.g. for a test that checks getTripCount( ) */
+	static void setAssertOnTrip(bool _assertOnTrip) { assertOnTrip.store(_assertOnTrip, std::memory_order_relaxed); }
+
+protected:
+	static std::atomic<uint64_t> tripCount;
+	static std::atomic<size_t> lastTripSize;
+	static std::atomic<bool> assertOnTrip;
+};
+
+/**
+	\class AudioThreadScope
+	\ingroup SynthClasses
+	\brief Marks the calling thread as the audio thread for the lifetime of the object
+*/
+class AudioThreadScope
+{
+public:
+	AudioThreadScope() { AllocationTripwire::enterAudioThread(); }
+	~AudioThreadScope() { AllocationTripwire::exitAudioThread(); }
+};
+
+#define SYNTH_AUDIO_THREAD_SCOPE() AudioThreadScope audioThreadScope
+
+#else
+#define SYNTH_AUDIO_THREAD_SCOPE() ((void)0)
+#endif
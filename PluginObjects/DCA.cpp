@@ -18,11 +18,11 @@ DCA::DCA(std::shared_ptr<DCAModifiers> _modifiers, IMIDIData* _midiData, uint32_
 	componentType = componentType::kDCA;
 
 	// --- create modulators 
-	modulators[kDCA_AmpMod] = new Modulator(kDefaultOutputValueON, kDCA_Amp_ModRange, modTransform::kAlwaysPositiveTransform);
+	modulators[kDCA_AmpMod] = createModulator(kDefaultOutputValueON, kDCA_Amp_ModRange, modTransform::kAlwaysPositiveTransform);
 
-	modulators[kDCA_MaxDownAmpMod] = new Modulator(kDefaultOutputValueON, kDCA_Amp_ModRange, modTransform::kMaxDownTransform);
+	modulators[kDCA_MaxDownAmpMod] = createModulator(kDefaultOutputValueON, kDCA_Amp_ModRange, modTransform::kMaxDownTransform);
 
-	modulators[kDCA_PanMod] = new Modulator(kDefaultOutputValueOFF, kDCA_Pan_ModRange, modTransform::kNoTransform);
+	modulators[kDCA_PanMod] = createModulator(kDefaultOutputValueOFF, kDCA_Pan_ModRange, modTransform::kNoTransform);
 
 	// --- validate all pointers
 	validComponent = validateComponent();
@@ -31,12 +31,8 @@ DCA::DCA(std::shared_ptr<DCAModifiers> _modifiers, IMIDIData* _midiData, uint32_
 /** Destructor: delete output array and modulators */
 DCA::~DCA()
 {
-	// --- delete our arrays and nullify
-	if (outputs) delete[] outputs;
-	if (modulators)delete[] modulators;
-
-	outputs = nullptr;
-	modulators = nullptr;
+	// --- delete our arrays (and modulators) and nullify
+	destroyArrays();
 }
 
 /** 
@@ -65,7 +61,10 @@ bool DCA::startComponent()
 	// --- save flag
 	noteOn = true;
 
-	return true; // nothing to do
+	// --- a new note starts at its own gain, not at the end of the last note's ramp
+	snapGains = true;
+
+	return true;
 }
 
 /**
@@ -98,6 +97,11 @@ bool DCA::resetComponent()
 	gainRaw = 1.0;			// --- unity
 	panLeftGain = 0.707;	// --- center
 	panRightGain = 0.707;	// --- center
+
+	// --- stop the ramps; jump to the targets on the next update
+	rampSamplesRemaining = 0;
+	samplesSinceUpdate = 0;
+	snapGains = true;
 	
 	// --- clear the outputs
 	clearOutputs();
@@ -177,18 +181,31 @@ bool DCA::updateComponent()
 	//double modGain_dB = doUnipolarModulationFromMax(ampMod, kMinModGain_dB, modifiers->gain_dB);
 	double ampMod = doUnipolarModulationFromMax(modulators[kDCA_MaxDownAmpMod]->getModulatedValue(), 0.0, 1.0);
 
-	// --- support for MIDI Volume CC
-	double midiVolumeGain = mmaMIDItoAtten(midiData->getMidiCCData(VOLUME_CC07));
+	// --- support for MIDI Volume CC; only convert on a change
+	uint32_t midiVolume = midiData->getMidiCCData(VOLUME_CC07);
+	if (variableChanged(lastMIDIVolume, midiVolume))
+	{
+		lastMIDIVolume = midiVolume;
+		midiVolumeGain = mmaMIDItoAtten(midiVolume);
+	}
+
+	// --- dB to raw only on a change; the control gain appears twice: in the gain product and as the final output gain
+	if (variableChanged(lastGain_dB, modifiers->gain_dB))
+	{
+		lastGain_dB = modifiers->gain_dB;
+
+		if (lastGain_dB > kMinAbsoluteGain_dB) // note change from last project
+		{
+			double gain = pow(10.0, lastGain_dB / 20.0);
+			controlGain = gain*gain;
+		}
+		else
+			controlGain = 0.0; // OFF
+	}
 
 	// --- calculate the final raw gain value
 	//gainRaw = midiVolumeGain * midiVelocityGain * egAmpMod * ampMod * pow(10.0, modGain_dB / 20.0);
-	gainRaw = midiVolumeGain * midiVelocityGain * modulators[kDCA_AmpMod]->getModulatedValue() * ampMod * pow(10.0, modifiers->gain_dB / 20.0);
-
-	// --- apply final output gain
-	if (modifiers->gain_dB > kMinAbsoluteGain_dB) // note change from last project
-		gainRaw *= pow(10.0, modifiers->gain_dB / 20.0);
-	else
-		gainRaw = 0.0; // OFF
+	gainRaw = midiVolumeGain * midiVelocityGain * modulators[kDCA_AmpMod]->getModulatedValue() * ampMod * controlGain;
 
 	// --- is mute ON? 0 = OFF, 1 = ON
 	if (modifiers->mute) gainRaw = 0.0;
@@ -199,12 +216,46 @@ bool DCA::updateComponent()
 	// --- limit in case pan control is biased
 	boundValue(panTotal, -1.0, 1.0);
 
-	// --- equal power calculation in synthfunction.h
-	calculatePanValues(panTotal, panLeftGain, panRightGain);
+	// --- equal power calculation in synthfunction.h; sin/cos only on a change
+	if (variableChanged(lastPanTotal, panTotal))
+	{
+		lastPanTotal = panTotal;
+		calculatePanValues(panTotal, panLeftGain, panRightGain);
+	}
+
+	// --- ramp to the new gains over the update interval
+	startGainRamps();
 
 	return true; // handled
 }
 
+/**
+	\brief Set the new target gains from gainRaw and the pan gains and start the linear ramps; the ramps land exactly on the
+	targets after rampLength samples. After a note-on or reset, the gains jump to the targets instead.
+*/
+void DCA::startGainRamps()
+{
+	targetMonoGain = gainRaw;
+	targetLeftGain = panLeftGain * gainRaw;
+	targetRightGain = panRightGain * gainRaw;
+
+	if (snapGains)
+	{
+		monoGain = targetMonoGain;
+		leftGain = targetLeftGain;
+		rightGain = targetRightGain;
+		rampSamplesRemaining = 0;
+		snapGains = false;
+		return;
+	}
+
+	double rampScale = 1.0 / (double)rampLength;
+	monoGainInc = (targetMonoGain - monoGain) * rampScale;
+	leftGainInc = (targetLeftGain - leftGain) * rampScale;
+	rightGainInc = (targetRightGain - rightGain) * rampScale;
+	rampSamplesRemaining = rampLength;
+}
+
 /**
 	\brief Render the component; 
 	- for ISynthAudioProcessors, this checks and updates the component if needed
@@ -223,7 +274,17 @@ bool DCA::renderComponent(bool update)
 	runModuators(update);
 
 	if (update)
+	{
+		// --- the gain ramps span the interval between updates
+		if (samplesSinceUpdate > 0 && !snapGains)
+			rampLength = samplesSinceUpdate < kDCAMaxRampSamples ? samplesSinceUpdate : kDCAMaxRampSamples;
+		samplesSinceUpdate = 0;
+
 		updateComponent();
+	}
+
+	// --- one sample interval
+	samplesSinceUpdate++;
 
 	// --- any other render-only operations here...
 	return true;
@@ -250,14 +311,17 @@ bool DCA::processAudio(RenderInfo& renderInfo)
 		renderInfo.numOutputChannels > 2)
 		return false; // not handled
 
+	// --- ramp the gains
+	advanceGainRamps();
+
 	// --- rendering into output array
 	if (renderInfo.numInputChannels == 1 && renderInfo.numOutputChannels == 1)
-		outputs[kDCALeftOutput] = renderInfo.inputData[0] * gainRaw;
+		outputs[kDCALeftOutput] = renderInfo.inputData[0] * monoGain;
 	else
-		outputs[kDCALeftOutput] = renderInfo.inputData[0] * panLeftGain * gainRaw;
+		outputs[kDCALeftOutput] = renderInfo.inputData[0] * leftGain;
 
 	if (renderInfo.numInputChannels == 2 && renderInfo.numOutputChannels == 2)
-		outputs[kDCARightOutput] = renderInfo.inputData[1] * panRightGain * gainRaw;
+		outputs[kDCARightOutput] = renderInfo.inputData[1] * rightGain;
 
 	// --- if rendering internal, we're done!
 	if (renderInfo.renderInternal)
@@ -281,3 +345,93 @@ bool DCA::processAudio(RenderInfo& renderInfo)
 	return true;
 }
 
+/**
+	\brief Process a block of audio in place with the same gain ramps as processAudio( ); the ramp part and the constant part
+	of the block are separate loops without per-sample state so they can be vectorized. A ramp that ends in the block lands
+	exactly on its target gains.
+
+	\param leftBuffer -- left (or mono) channel buffer
+	\param rightBuffer -- right channel buffer; nullptr for mono -> mono, which uses the gain without pan
+	\param blockSize -- number of samples in the buffers
+	\param update -- a flag that is used to update the component once at the top of the block
+
+	\return true if handled, false if not handled
+*/
+bool DCA::processAudioBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize, bool update)
+{
+	if (!leftBuffer || blockSize == 0)
+		return false;
+
+	// --- check render/update; this counts one sample interval
+	if (!renderComponent(update))
+		return false;
+
+	samplesSinceUpdate += blockSize - 1;
+
+	uint32_t i = 0;
+
+	// --- ramp part; the last sample of a ramp is the target, which the constant part applies
+	if (rampSamplesRemaining > 0)
+	{
+		uint32_t rampCount = rampSamplesRemaining < blockSize ? rampSamplesRemaining : blockSize;
+		bool rampEnds = rampCount == rampSamplesRemaining;
+		uint32_t incCount = rampEnds ? rampCount - 1 : rampCount;
+
+		if (rightBuffer)
+		{
+			double left = leftGain;
+			double right = rightGain;
+			for (uint32_t n = 0; n < incCount; n++)
+			{
+				leftBuffer[n] *= left + (double)(n + 1) * leftGainInc;
+				rightBuffer[n] *= right + (double)(n + 1) * rightGainInc;
+			}
+		}
+		else
+		{
+			double mono = monoGain;
+			for (uint32_t n = 0; n < incCount; n++)
+				leftBuffer[n] *= mono + (double)(n + 1) * monoGainInc;
+		}
+
+		// --- advance the ramp state
+		rampSamplesRemaining -= rampCount;
+		if (rampEnds)
+		{
+			monoGain = targetMonoGain;
+			leftGain = targetLeftGain;
+			rightGain = targetRightGain;
+		}
+		else
+		{
+			monoGain += (double)rampCount * monoGainInc;
+			leftGain += (double)rampCount * leftGainInc;
+			rightGain += (double)rampCount * rightGainInc;
+		}
+
+		i = incCount;
+	}
+
+	// --- constant part
+	if (rightBuffer)
+	{
+		double left = leftGain;
+		double right = rightGain;
+		for (uint32_t n = i; n < blockSize; n++)
+		{
+			leftBuffer[n] *= left;
+			rightBuffer[n] *= right;
+		}
+		outputs[kDCARightOutput] = rightBuffer[blockSize - 1];
+	}
+	else
+	{
+		double mono = monoGain;
+		for (uint32_t n = i; n < blockSize; n++)
+			leftBuffer[n] *= mono;
+	}
+
+	outputs[kDCALeftOutput] = leftBuffer[blockSize - 1];
+
+	return true;
+}
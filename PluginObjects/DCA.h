@@ -15,6 +15,10 @@ const double kMinAbsoluteGain_dB = -96.0;
 const double kDCA_Amp_ModRange = 1.0;			// --> unipolar, 100%
 const double kDCA_Pan_ModRange = 1.0;			// --> unipolar, 100%
 
+// --- gain ramps run from one update to the next; this is the length until the update interval has been measured
+const uint32_t kDCADefaultRampSamples = 64;
+const uint32_t kDCAMaxRampSamples = 4096;
+
 // --- outputs[] indexes for this component
 enum {
 	kDCALeftOutput,
@@ -79,6 +83,11 @@ struct DCAModifiers
 	- kDCA_MaxDownAmpMod:		[-1, +1] gain modulation -- modulation is from the max gain downwards (tremolo or AM effect)
 	- kDCA_PanMod:				[-1, +1] pan modulation --- uses constant power curves simulated with sin/cos quadrants
 
+	Gain smoothing:
+	The dB to raw conversion, MIDI volume and pan gains are only recalculated when their inputs change. Each update sets new
+	target gains and the output gains ramp linearly to them over the update interval (measured between updates), so the
+	granular updates do not cause zipper noise. processAudioBlock( ) applies the same ramps to whole buffers.
+
 	\author Will Pirkle
 	\version Revision : 1.0
 	\date Date : 2017 / 09 / 24
@@ -118,14 +127,62 @@ public:
 	/// setter for pan value
 	void setPanValue(double _panValue) { panValue = _panValue; }
 
+	// --- process a block of audio in place; rightBuffer may be nullptr for mono
+	virtual bool processAudioBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize, bool update);
+
 protected:
+	// --- start the ramps to the new target gains
+	void startGainRamps();
+
+	// --- advance the ramps by one sample
+	inline void advanceGainRamps()
+	{
+		if (rampSamplesRemaining == 0) return;
+
+		if (--rampSamplesRemaining == 0)
+		{
+			// --- land exactly on the targets
+			monoGain = targetMonoGain;
+			leftGain = targetLeftGain;
+			rightGain = targetRightGain;
+		}
+		else
+		{
+			monoGain += monoGainInc;
+			leftGain += leftGainInc;
+			rightGain += rightGainInc;
+		}
+	}
+
 	double gainRaw = 1.0;			///< the final raw gain value
 	double panLeftGain = 0.707;		///< left channel gain
 	double panRightGain = 0.707;	///< right channel gain
 	double midiVelocityGain = 0.0;	
 
+	// --- cached conversions; only recalculated when their inputs change
+	double lastGain_dB = 0.0;		///< gain_dB the control gain was calculated from
+	double controlGain = 1.0;		///< raw gain for lastGain_dB (0.0 if below kMinAbsoluteGain_dB)
+	uint32_t lastMIDIVolume = 127;	///< CC7 value the MIDI volume gain was calculated from
+	double midiVolumeGain = 1.0;	///< raw gain for lastMIDIVolume
+	double lastPanTotal = -2.0;		///< pan value the pan gains were calculated from; out of range forces the first calculation
+
+	// --- ramped output gains: mono (gain only) and left/right (gain * pan)
+	double monoGain = 1.0;			///< current mono gain
+	double leftGain = 0.707;		///< current left gain
+	double rightGain = 0.707;		///< current right gain
+	double targetMonoGain = 1.0;	///< mono gain at the end of the ramp
+	double targetLeftGain = 0.707;	///< left gain at the end of the ramp
+	double targetRightGain = 0.707;	///< right gain at the end of the ramp
+	double monoGainInc = 0.0;		///< per-sample mono gain increment
+	double leftGainInc = 0.0;		///< per-sample left gain increment
+	double rightGainInc = 0.0;		///< per-sample right gain increment
+	uint32_t rampSamplesRemaining = 0;	///< samples left in the running ramp
+	uint32_t rampLength = kDCADefaultRampSamples;	///< ramp length, measured between updates
+	uint32_t samplesSinceUpdate = 0;	///< sample counter for measuring the update interval
+	bool snapGains = true;			///< jump (no ramp) to the targets on the next update; set on note-on and reset
+
 	// --- pan value is set internally by voice, or via MIDI/MIDI Channel
-	double panValue = 0.0;			///< pan value is set internally by voice, or via MIDI/MIDI Channel
+	double panValue = 0.0;			///< fixed pan offset [-1, +1], added to the pan modulator
 
 	// --- note on flag
 	bool noteOn = false;
@@ -1,5 +1,7 @@
 #include "DelayFX.h"
 
+#include <string.h>
+
 /**
 \brief constructor: null and reset
 */
@@ -9,6 +11,8 @@ DelayLine::DelayLine(void)
 	buffer = NULL;
 	delay_ms = 0.0;
 	delayInSamples = 0.0;
+	bufferLength = 0;
+	wrapMask = 0;
 	sampleRate = 0;
 
 	// --- reset
@@ -21,30 +25,41 @@ DelayLine::DelayLine(void)
 DelayLine::~DelayLine(void)
 {
 	if (buffer)
-		delete buffer;
+		delete[] buffer;
 
 	buffer = NULL;
 }
 
 /**
-\brief create and initialize the delay line (buffer of doubles)
+\brief create and initialize the delay line (buffer of doubles); the buffer is rounded up to a power of two that also holds
+one block and the interpolator taps past the longest delay
 
 \param delayLengthInSamples: the MAX length of the delay line
 */
 void DelayLine::init(int delayLengthInSamples)
 {
+	// --- power of two length for mask wrapping
+	int length = 1;
+	while (length < delayLengthInSamples + (int)(kDelayFXBlockSize + kDelayLineGuardSamples))
+		length <<= 1;
+
 	// --- save for later
-	bufferLength = delayLengthInSamples;
+	bufferLength = length;
+	wrapMask = bufferLength - 1;
 
 	// --- delete if existing
 	if (buffer)
-		delete buffer;
+		delete[] buffer;
 
 	// --- create
 	buffer = new double[bufferLength];
 
 	// --- flush buffer
 	memset(buffer, 0, bufferLength * sizeof(double));
+
+	// --- indexes must be inside the new buffer
+	writeIndex &= wrapMask;
+	cookVariables();
 }
 
 /**
@@ -56,9 +71,9 @@ void DelayLine::resetDelay()
 	if (buffer)
 		memset(buffer, 0, bufferLength * sizeof(double));
 
-	// --- init read/write indices
+	// --- init write index and interpolator
 	writeIndex = 0;
-	readIndex = 0;
+	allpassState = 0.0;
 
 	// --- cook
 	cookVariables();
@@ -83,12 +98,10 @@ void DelayLine::cookVariables()
 	// --- calculate fractional delay
 	delayInSamples = delay_ms*((double)sampleRate / 1000.0);
 
-	// --- subtract to make read index
-	readIndex = writeIndex - (int)delayInSamples;
-
-	// --- the check and wrap BACKWARDS if the index is negative
-	if (readIndex < 0)
-		readIndex += bufferLength;	// amount of wrap is Read + Length
+	// --- the block reads and interpolator taps must stay inside the buffer
+	double maxDelay = (double)(bufferLength - (int)(kDelayFXBlockSize + kDelayLineGuardSamples));
+	if (maxDelay < 0.0) maxDelay = 0.0;
+	boundValue(delayInSamples, 0.0, maxDelay);
 }
 
 /**
@@ -96,22 +109,7 @@ void DelayLine::cookVariables()
 */
 double DelayLine::readDelay()
 {
-	// --- Read the output of the delay at readIndex
-	double yn = buffer[readIndex];
-
-	// --- Read the location ONE BEHIND yn at y(n-1)
-	int nReadIndex_1 = readIndex - 1;
-	if (nReadIndex_1 < 0)
-		nReadIndex_1 = bufferLength - 1; // bufferLength-1 is last location
-
-	// --- get y(n-1)
-	double yn_1 = buffer[nReadIndex_1];
-
-	// --- get fractional component
-	double dFracDelay = delayInSamples - (int)delayInSamples;
-
-	// --- interpolate: (0, yn) and (1, yn_1) by the amount fracDelay
-	return doLinearInterpolation(0, 1, yn, yn_1, dFracDelay); // interp frac between them
+	return readDelayAtSamples(delayInSamples);
 }
 
 /**
@@ -121,34 +119,56 @@ double DelayLine::readDelay()
 */
 double DelayLine::readDelayAt(double _delay_mSec)
 {
-	// --- local variales
-	double dDelayInSamples = _delay_mSec*((float)sampleRate) / 1000.0;
+	return readDelayAtSamples(_delay_mSec*((double)sampleRate) / 1000.0);
+}
 
-	// --- subtract to make read index
-	int nReadIndex = writeIndex - (int)dDelayInSamples;
+/**
+\brief  read the delay line at a fractional number of samples with the current interpolation; note this does not increment
+any index variables
 
-	// --- wrap if needed
-	if (nReadIndex < 0)
-		nReadIndex += bufferLength;	// amount of wrap is Read + Length
+\param _delayInSamples: delay in samples from the current write position
+\param offset: position of the sample in a block that has not been written yet (0 for single samples); the read is
+		relative to writeIndex + offset
+*/
+double DelayLine::readDelayAtSamples(double _delayInSamples, uint32_t offset)
+{
+	int intDelay = (int)_delayInSamples;
+	double frac = _delayInSamples - (double)intDelay;
 
-	//---  Read the output of the delay at readIndex
-	double yn = buffer[nReadIndex];
-	return yn;
+	if (interpolation == delayInterpolation::kAllpass)
+	{
+		// --- keep the fractional part in [0.5, 1.5) where the 1st order allpass is well behaved
+		if (frac < 0.5 && intDelay > 1)
+		{
+			intDelay--;
+			frac += 1.0;
+		}
 
-	// --- Read the location ONE BEHIND yn at y(n-1)
-	int nReadIndex_1 = nReadIndex - 1;
-	if (nReadIndex_1 < 0)
-		nReadIndex_1 = bufferLength - 1; // bufferLength-1 is last location
+		int index = (writeIndex + (int)offset - intDelay) & wrapMask;
+		double eta = (1.0 - frac) / (1.0 + frac);
 
-										 // -- get y(n-1)
-	double yn_1 = buffer[nReadIndex_1];
+		// --- y(n) = eta*x(n) + x(n-1) - eta*y(n-1)
+		allpassState = eta*(buffer[index] - allpassState) + buffer[(index - 1) & wrapMask];
+		return allpassState;
+	}
 
-	// --- get the fractional component
-	double dFracDelay = dDelayInSamples - (int)dDelayInSamples;
+	// --- index of x(n - D)
+	int index = (writeIndex + (int)offset - intDelay) & wrapMask;
+	double yn = buffer[index];
 
-	// --- interpolate: (0, yn) and (1, yn_1) by the amount fracDelay
-	return doLinearInterpolation(0, 1, yn, yn_1, dFracDelay); // interp frac between them
+	if (frac == 0.0)
+		return yn;
 
+	// --- 4 taps need x(n - D + 1), which must be written already
+	if (interpolation == delayInterpolation::kLagrange && intDelay > 1)
+	{
+		double taps[4] = { buffer[(index + 1) & wrapMask], yn, buffer[(index - 1) & wrapMask], buffer[(index - 2) & wrapMask] };
+		return doLagrangeInterpolation(taps, frac);
+	}
+
+	// --- interpolate: (0, yn) and (1, yn_1) by the amount fracDelay
+	double yn_1 = buffer[(index - 1) & wrapMask];
+	return doLinearInterpolation(0, 1, yn, yn_1, frac);
 }
 
 /**
@@ -158,17 +178,12 @@ double DelayLine::readDelayAt(double _delay_mSec)
 */
 void DelayLine::writeDelayAndInc(double inputSample)
 {
-	// --- write to the delay line
+	// --- write to the delay line; a decayed feedback tail ends in zeros, not denormals
+	snapToZero(inputSample);
 	buffer[writeIndex] = inputSample; // external feedback sample
 
-	// --- increment the pointers and wrap if necessary
-	writeIndex++;
-	if (writeIndex >= bufferLength)
-		writeIndex = 0;
-
-	readIndex++;
-	if (readIndex >= bufferLength)
-		readIndex = 0;
+	// --- increment the pointer and wrap
+	writeIndex = (writeIndex + 1) & wrapMask;
 }
 
 bool DelayLine::processAudio(double* input, double* output)
@@ -182,6 +197,139 @@ bool DelayLine::processAudio(double* input, double* output)
 	return true; // all OK
 }
 
+/**
+\brief  read a block at the prescribed (fixed) delay value without writing or incrementing; an integer delay is a straight
+copy (at most two memcpy( ) calls around the wrap point)
+
+\param output: buffer to receive blockSize delayed samples
+\param blockSize: number of samples
+
+\return false if the delay is shorter than getMinBlockDelay(blockSize)
+*/
+bool DelayLine::readDelayBlock(double* output, uint32_t blockSize)
+{
+	if (delayInSamples < getMinBlockDelay(blockSize))
+		return false;
+
+	int intDelay = (int)delayInSamples;
+	double frac = delayInSamples - (double)intDelay;
+
+	if (frac == 0.0 && interpolation != delayInterpolation::kAllpass)
+	{
+		// --- split copy around the wrap point
+		uint32_t index = (uint32_t)((writeIndex - intDelay) & wrapMask);
+		uint32_t firstPart = (uint32_t)bufferLength - index;
+		if (firstPart > blockSize) firstPart = blockSize;
+
+		memcpy(output, &buffer[index], firstPart * sizeof(double));
+		if (firstPart < blockSize)
+			memcpy(&output[firstPart], &buffer[0], (blockSize - firstPart) * sizeof(double));
+
+		return true;
+	}
+
+	if (interpolation == delayInterpolation::kLinear)
+	{
+		int index = (writeIndex - intDelay) & wrapMask;
+		for (uint32_t i = 0; i < blockSize; i++)
+		{
+			double yn = buffer[(index + i) & wrapMask];
+			double yn_1 = buffer[(index + i - 1) & wrapMask];
+			output[i] = yn + frac*(yn_1 - yn);
+		}
+		return true;
+	}
+
+	for (uint32_t i = 0; i < blockSize; i++)
+		output[i] = readDelayAtSamples(delayInSamples, i);
+
+	return true;
+}
+
+/**
+\brief  read a block at a different (fractional) delay for every sample without writing or incrementing
+
+\param delayInSamplesBuffer: the delay in samples for each sample in the block
+\param output: buffer to receive blockSize delayed samples
+\param blockSize: number of samples
+
+\return false if any delay is shorter than getMinBlockDelay(blockSize)
+*/
+bool DelayLine::readModulatedBlock(const double* delayInSamplesBuffer, double* output, uint32_t blockSize)
+{
+	double minDelay = getMinBlockDelay(blockSize);
+	for (uint32_t i = 0; i < blockSize; i++)
+	{
+		if (delayInSamplesBuffer[i] < minDelay)
+			return false;
+	}
+
+	if (interpolation == delayInterpolation::kLinear)
+	{
+		// --- tight gather loop; no per-sample dispatch
+		for (uint32_t i = 0; i < blockSize; i++)
+		{
+			int intDelay = (int)delayInSamplesBuffer[i];
+			double frac = delayInSamplesBuffer[i] - (double)intDelay;
+			int index = writeIndex + (int)i - intDelay;
+
+			double yn = buffer[index & wrapMask];
+			double yn_1 = buffer[(index - 1) & wrapMask];
+			output[i] = yn + frac*(yn_1 - yn);
+		}
+		return true;
+	}
+
+	for (uint32_t i = 0; i < blockSize; i++)
+		output[i] = readDelayAtSamples(delayInSamplesBuffer[i], i);
+
+	return true;
+}
+
+/**
+\brief  write a block into the delay line and increment the write index; at most two memcpy( ) calls
+
+\param input: blockSize samples to write
+\param blockSize: number of samples
+*/
+void DelayLine::writeDelayBlock(const double* input, uint32_t blockSize)
+{
+	uint32_t firstPart = (uint32_t)(bufferLength - writeIndex);
+	if (firstPart > blockSize) firstPart = blockSize;
+
+	memcpy(&buffer[writeIndex], input, firstPart * sizeof(double));
+	if (firstPart < blockSize)
+		memcpy(&buffer[0], &input[firstPart], (blockSize - firstPart) * sizeof(double));
+
+	writeIndex = (writeIndex + (int)blockSize) & wrapMask;
+}
+
+/**
+\brief  process a block at the fixed delay; same result as calling processAudio( ) blockSize times
+
+\param input: blockSize input samples
+\param output: blockSize output samples; must not overlap the input for delays of getMinBlockDelay(blockSize) or longer
+\param blockSize: number of samples
+
+\return true if handled
+*/
+bool DelayLine::processAudioBlock(const double* input, double* output, uint32_t blockSize)
+{
+	if (input != output && readDelayBlock(output, blockSize))
+	{
+		writeDelayBlock(input, blockSize);
+		return true;
+	}
+
+	// --- short delays feed back inside the block
+	for (uint32_t i = 0; i < blockSize; i++)
+	{
+		double in = input[i];
+		processAudio(&in, &output[i]);
+	}
+	return true;
+}
+
 /**
 	\brief Object constructor specialized to properly and safely share the modifiers and MIDI data
 	\param _modifiers -- the GUI modifiers structure for this component, to be shared with all similar components
@@ -202,18 +350,21 @@ DelayFX::DelayFX(std::shared_ptr<DelayFXModifiers> _modifiers, IMIDIData* _midiD
 	// --- create modulators
 	//
 	// --- delay feedback
-	modulators[kDelayFX_FeedbackMod] = new Modulator(kDefaultOutputValueOFF, kDelayFX_Feedback_ModRange, modTransform::kNoTransform);
+	modulators[kDelayFX_FeedbackMod] = createModulator(kDefaultOutputValueOFF, kDelayFX_Feedback_ModRange, modTransform::kNoTransform);
 	
 	// --- delay mix
-	modulators[kDelayFX_MixMod] = new Modulator(kDefaultOutputValueOFF, kDelayFX_Mix_ModRange, modTransform::kNoTransform);
+	modulators[kDelayFX_MixMod] = createModulator(kDefaultOutputValueOFF, kDelayFX_Mix_ModRange, modTransform::kNoTransform);
 
 	// --- chorus depth
-	modulators[kChorusFX_DepthMod] = new Modulator(kDefaultOutputValueOFF, kChorusFX_Depth_ModRange, modTransform::kNoTransform);
+	modulators[kChorusFX_DepthMod] = createModulator(kDefaultOutputValueOFF, kChorusFX_Depth_ModRange, modTransform::kNoTransform);
 
 	// --- lfo
-	lfo = new LFO(lfoModifiers, _midiData, kNumLFOOutputs, kNumLFOModulators);
+	lfo = createComponent<LFO>(lfoModifiers, _midiData, kNumLFOOutputs, kNumLFOModulators);
 	lfo->getModifiers()->oscWave = LFOWaveform::kSin;
 
+	// --- the chorus only uses the normal and quad phase outputs
+	lfo->setOutputMask((1 << kLFONormalOutput) | (1 << kLFOQuadPhaseOutput));
+
 	// --- validate all pointers
 	validComponent = validateComponent();
 }
@@ -221,13 +372,9 @@ DelayFX::DelayFX(std::shared_ptr<DelayFXModifiers> _modifiers, IMIDIData* _midiD
 /** Destructor: delete output array and modulators */
 DelayFX::~DelayFX()
 {
-	// --- delete our arrays and nullify
-	if (outputs) delete[] outputs;
-	if (modulators)delete[] modulators;
-	if (lfo) delete lfo;
-
-	outputs = nullptr;
-	modulators = nullptr;
+	// --- delete our arrays (and modulators) and nullify
+	destroyArrays();
+	destroyComponent(lfo);
 }
 
 /**
@@ -241,12 +388,13 @@ bool DelayFX::initializeComponent(InitializeInfo& info)
 	if (!validComponent) return false;
 
 	// --- set sample rate first
+	sampleRate = info.sampleRate;
 	leftDelay.setSampleRate(info.sampleRate);
 	rightDelay.setSampleRate(info.sampleRate);
 
 	// --- initialize to 2 sec max delay
-	leftDelay.init(2.0*info.sampleRate);
-	rightDelay.init(2.0*info.sampleRate);
+	leftDelay.init(kMaxDelayFX_mSec*info.sampleRate / 1000.0);
+	rightDelay.init(kMaxDelayFX_mSec*info.sampleRate / 1000.0);
 
 	// --- init the LFO
 	lfo->initializeComponent(info);
@@ -266,6 +414,10 @@ bool DelayFX::startComponent()
 	// --- save flag
 	noteOn = true;
 	lfo->startComponent();
+	lfoBlockIndex = kDelayFXBlockSize;
+
+	// --- no ramps from stale gains
+	snapGains = true;
 
 	return true; // nothing to do
 }
@@ -303,6 +455,10 @@ bool DelayFX::resetComponent()
 
 	// --- reset lfo
 	lfo->resetComponent();
+	lfoBlockIndex = kDelayFXBlockSize;
+
+	// --- no ramps from stale gains
+	snapGains = true;
 
 	return true;
 }
@@ -375,7 +531,7 @@ bool DelayFX::updateComponent()
 	// --- check valid flag
 	if (!validComponent) return false;
 
-	enabled = modifiers->enabled;
+	enabled = modifiers->enabled || ownerBypass;
 	chorusRate_Hz = modifiers->chorusRate_Hz;
 	
 	// --- chorus depth modulation
@@ -389,24 +545,41 @@ bool DelayFX::updateComponent()
 	// --- set the LFO Frequency & Depth (Amplitude)
 	lfo->getModifiers()->oscFreqControl = chorusRate_Hz;
 	lfo->updateComponent();
+
+	// --- fractional delay interpolation
+	leftDelay.setInterpolation(modifiers->interpolation);
+	rightDelay.setInterpolation(modifiers->interpolation);
+
 	if (delayFXMode == delayFXMode::chorus)
+	{
+		startGainRamps();
 		return true;
+	}
+
+	// --- tempo sync: beats -> mSec from the host tempo
+	double delay_mSec = modifiers->delayTime_mSec;
+	SynthTransport* transport = modifiers->tempoSync ? midiData->getTransport() : nullptr;
+	if (transport)
+	{
+		delay_mSec = transport->beatsToMilliseconds(modifiers->delayTime_beats);
+		boundValue(delay_mSec, 0.0, kMaxDelayFX_mSec);
+	}
 
 	if (modifiers->delayRatio < 0)
 	{
 		// --- note negation of ratio!
-		leftDelay.setDelay_mSec(-modifiers->delayRatio*modifiers->delayTime_mSec);
-		rightDelay.setDelay_mSec(modifiers->delayTime_mSec);
+		leftDelay.setDelay_mSec(-modifiers->delayRatio*delay_mSec);
+		rightDelay.setDelay_mSec(delay_mSec);
 	}
 	else if (modifiers->delayRatio > 0)
 	{
-		leftDelay.setDelay_mSec(modifiers->delayTime_mSec);
-		rightDelay.setDelay_mSec(modifiers->delayRatio*modifiers->delayTime_mSec);
+		leftDelay.setDelay_mSec(delay_mSec);
+		rightDelay.setDelay_mSec(modifiers->delayRatio*delay_mSec);
 	}
 	else
 	{
-		leftDelay.setDelay_mSec(modifiers->delayTime_mSec);
-		rightDelay.setDelay_mSec(modifiers->delayTime_mSec);
+		leftDelay.setDelay_mSec(delay_mSec);
+		rightDelay.setDelay_mSec(delay_mSec);
 	}
 
 	// --- add feedback modulation (+/- 50%)
@@ -419,15 +592,43 @@ bool DelayFX::updateComponent()
 	delayMix_Pct = modifiers->delayMix_Pct + modulators[kDelayFX_MixMod]->getModulatedValue();
 
 	// --- always bound modulated values!!
-	boundValue(feedback_Pct, kDelayFX_Mix_Min, kDelayFX_Mix_Max);
+	boundValue(delayMix_Pct, kDelayFX_Mix_Min, kDelayFX_Mix_Max);
 
 	// --- save others
-	delayTime_mSec = modifiers->delayTime_mSec;
+	delayTime_mSec = delay_mSec;
 	delayRatio = modifiers->delayRatio;
 
+	// --- new gains
+	startGainRamps();
+
 	return true; // handled
 }
 
+/**
+	\brief Set the gain ramp targets from the current feedback, mix and chorus depth; the ramps span one update interval
+*/
+void DelayFX::startGainRamps()
+{
+	double feedback = feedback_Pct / 100.0;
+	double wet = delayMix_Pct / 100.0;
+	double chorus = (chorusDepth_Pct / 100.0)*0.5;
+
+	if (snapGains)
+	{
+		feedbackGain.snap(feedback);
+		wetGain.snap(wet);
+		dryGain.snap(1.0 - wet);
+		chorusGain.snap(chorus);
+		snapGains = false;
+		return;
+	}
+
+	feedbackGain.setTarget(feedback, kDelayFXBlockSize);
+	wetGain.setTarget(wet, kDelayFXBlockSize);
+	dryGain.setTarget(1.0 - wet, kDelayFXBlockSize);
+	chorusGain.setTarget(chorus, kDelayFXBlockSize);
+}
+
 /**
 	\brief Render the component;
 	- for ISynthAudioProcessors, this checks and updates the component if needed
@@ -442,8 +643,7 @@ bool DelayFX::renderComponent(bool update)
 	// --- check valid flag
 	if (!validComponent) return false;
 
-	// --- sub-component
-	lfo->renderComponent(update);
+	// --- the LFO sub-component is rendered in blocks in processDelayFX( )
 
 	// --- run the modulators
 	runModuators(update);
@@ -533,15 +733,26 @@ bool DelayFX::processAudio(RenderInfo& renderInfo)
 //
 void DelayFX::processDelayFX(RenderInfo& renderInfo)
 {
+	// --- advance the gain ramps
+	double feedback = feedbackGain.getNextValue();
+	double wet = wetGain.getNextValue();
+	double dry = dryGain.getNextValue();
+	double chorusDepth = chorusGain.getNextValue();
+
 	// --- chorus is twin QP variety
 	if (delayFXMode == delayFXMode::chorus)
 	{
-		// --- render the LFO sample
-		lfo->renderComponent(true);
+		// --- render the next LFO block
+		if (lfoBlockIndex >= kDelayFXBlockSize)
+		{
+			lfo->renderBlock(kDelayFXBlockSize, false);
+			lfoBlockIndex = 0;
+		}
 
 		// --- get normal and quad phase outputs
-		double lfoOut = lfo->getOutputValue(kLFONormalOutput);
-		double lfoOutQP = lfo->getOutputValue(kLFOQuadPhaseOutput);
+		double lfoOut = lfo->getBlockOutputPtr(kLFONormalOutput)[lfoBlockIndex];
+		double lfoOutQP = lfo->getBlockOutputPtr(kLFOQuadPhaseOutput)[lfoBlockIndex];
+		lfoBlockIndex++;
 
 		// --- left channel uses normal LFO
 		double modValue_mSec = doBipolarModulation(lfoOut, kMinChorusDelay_mSec, kMaxChorusDelay_mSec);
@@ -550,7 +761,7 @@ void DelayFX::processDelayFX(RenderInfo& renderInfo)
 		double delay = leftDelay.readDelayAt(modValue_mSec);
 		
 		// --- form output
-		outputs[kDelayFXLeftOutput] = renderInfo.inputData[0] + (chorusDepth_Pct / 100.0)*0.5*delay;
+		outputs[kDelayFXLeftOutput] = renderInfo.inputData[0] + chorusDepth*delay;
 
 		// --- write delay
 		leftDelay.writeDelayAndInc(renderInfo.inputData[0]);
@@ -569,7 +780,7 @@ void DelayFX::processDelayFX(RenderInfo& renderInfo)
 			double delay = rightDelay.readDelayAt(modValue_mSec);
 
 			// --- form output
-			outputs[kDelayFXRightOutput] = renderInfo.inputData[1] + (chorusDepth_Pct / 100.0)*0.5*delay;
+			outputs[kDelayFXRightOutput] = renderInfo.inputData[1] + chorusDepth*delay;
 
 			// --- write input to delay line
 			rightDelay.writeDelayAndInc(renderInfo.inputData[1]);
@@ -587,11 +798,11 @@ void DelayFX::processDelayFX(RenderInfo& renderInfo)
 
 	// --- SETUP for NORMAL operation
 	if (delayFXMode == delayFXMode::norm)
-		leftDelayIn = renderInfo.inputData[0] + leftDelayOut*(feedback_Pct / 100.0);
+		leftDelayIn = renderInfo.inputData[0] + leftDelayOut*feedback;
 	else if (delayFXMode == delayFXMode::cross)
-		leftDelayIn = renderInfo.inputData[0] + rightDelayOut*(feedback_Pct / 100.0);
+		leftDelayIn = renderInfo.inputData[0] + rightDelayOut*feedback;
 	else if (delayFXMode == delayFXMode::pingpong)
-		leftDelayIn = renderInfo.inputData[1] + rightDelayOut*(feedback_Pct / 100.0);
+		leftDelayIn = renderInfo.inputData[1] + rightDelayOut*feedback;
 
 	// --- mono -> stereo
 	if (renderInfo.numInputChannels == 1 && renderInfo.numOutputChannels == 2)
@@ -604,11 +815,11 @@ void DelayFX::processDelayFX(RenderInfo& renderInfo)
 	{
 		// --- setup right channel
 		if (delayFXMode == delayFXMode::norm)
-			rightDelayIn = renderInfo.inputData[1] + rightDelayOut*(feedback_Pct / 100.0);
+			rightDelayIn = renderInfo.inputData[1] + rightDelayOut*feedback;
 		else if (delayFXMode == delayFXMode::cross)
-			rightDelayIn = renderInfo.inputData[1] + leftDelayOut*(feedback_Pct / 100.0);
+			rightDelayIn = renderInfo.inputData[1] + leftDelayOut*feedback;
 		else if (delayFXMode == delayFXMode::pingpong)
-			rightDelayIn = renderInfo.inputData[0] + leftDelayOut*(feedback_Pct / 100.0);
+			rightDelayIn = renderInfo.inputData[0] + leftDelayOut*feedback;
 	}
 
 	// --- intermediate variables
@@ -619,9 +830,6 @@ void DelayFX::processDelayFX(RenderInfo& renderInfo)
 	leftDelay.processAudio(&leftDelayIn, &leftOut);
 	rightDelay.processAudio(&rightDelayIn, &rightOut);
 
-	double wet = (delayMix_Pct / 100.0);
-	double dry = 1.0 - wet;
-
 	// --- form outputs
 	outputs[kDelayFXLeftOutput] = dry*renderInfo.inputData[0] + wet*leftOut;
 
@@ -630,3 +838,164 @@ void DelayFX::processDelayFX(RenderInfo& renderInfo)
 	else
 		outputs[kDelayFXRightOutput] = outputs[kDelayFXLeftOutput];
 }
+
+/**
+	\brief Process a stereo (or mono, with a nullptr right buffer) block in place; the block is processed in chunks of
+	kDelayFXBlockSize and the component is updated once per chunk if update is set.
+
+	\param leftBuffer -- left (or mono) channel buffer
+	\param rightBuffer -- right channel buffer; nullptr for mono -> mono
+	\param blockSize -- number of samples in the buffers
+	\param update -- a flag that is used to update the component
+
+	\return true if handled, false if not handled
+*/
+bool DelayFX::processAudioBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize, bool update)
+{
+	if (!leftBuffer || blockSize == 0)
+		return false;
+
+	uint32_t offset = 0;
+	while (offset < blockSize)
+	{
+		uint32_t count = blockSize - offset;
+		if (count > kDelayFXBlockSize)
+			count = kDelayFXBlockSize;
+
+		// --- check render/update
+		if (!renderComponent(update))
+			return false;
+
+		// --- pass through if not enabled
+		if (enabled)
+			processDelayFXBlock(&leftBuffer[offset], rightBuffer ? &rightBuffer[offset] : nullptr, count);
+
+		offset += count;
+	}
+
+	outputs[kDelayFXLeftOutput] = leftBuffer[blockSize - 1];
+	outputs[kDelayFXRightOutput] = rightBuffer ? rightBuffer[blockSize - 1] : outputs[kDelayFXLeftOutput];
+
+	return true;
+}
+
+/**
+	\brief Process one chunk in place: read the delayed block(s), form the delay inputs, write them and mix. Delays that are
+	shorter than the block, and mono, fall back to processDelayFX( ) for each sample.
+
+	\param leftBuffer -- left (or mono) channel buffer
+	\param rightBuffer -- right channel buffer; nullptr for mono -> mono
+	\param blockSize -- number of samples; at most kDelayFXBlockSize
+*/
+void DelayFX::processDelayFXBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize)
+{
+	if (delayFXMode == delayFXMode::chorus)
+	{
+		// --- one LFO block for this chunk; the per-sample path starts a new one
+		lfo->renderBlock(blockSize, false);
+		lfoBlockIndex = kDelayFXBlockSize;
+
+		const double* lfoOut = lfo->getBlockOutputPtr(kLFONormalOutput);
+		const double* lfoOutQP = lfo->getBlockOutputPtr(kLFOQuadPhaseOutput);
+		double samplesPerMSec = sampleRate / 1000.0;
+
+		// --- modulated delay times; left uses the normal output, right the quad phase output
+		for (uint32_t i = 0; i < blockSize; i++)
+			leftInputBuffer[i] = doBipolarModulation(lfoOut[i], kMinChorusDelay_mSec, kMaxChorusDelay_mSec)*samplesPerMSec;
+
+		leftDelay.readModulatedBlock(leftInputBuffer, leftDelayBuffer, blockSize);
+		leftDelay.writeDelayBlock(leftBuffer, blockSize);
+
+		if (rightBuffer)
+		{
+			for (uint32_t i = 0; i < blockSize; i++)
+				rightInputBuffer[i] = doBipolarModulation(lfoOutQP[i], kMinChorusDelay_mSec, kMaxChorusDelay_mSec)*samplesPerMSec;
+
+			rightDelay.readModulatedBlock(rightInputBuffer, rightDelayBuffer, blockSize);
+			rightDelay.writeDelayBlock(rightBuffer, blockSize);
+		}
+
+		// --- form outputs
+		for (uint32_t i = 0; i < blockSize; i++)
+		{
+			double chorusDepth = chorusGain.getNextValue();
+			leftBuffer[i] += chorusDepth*leftDelayBuffer[i];
+			if (rightBuffer)
+				rightBuffer[i] += chorusDepth*rightDelayBuffer[i];
+		}
+
+		// --- keep the unused ramps in step
+		feedbackGain.advance(blockSize);
+		wetGain.advance(blockSize);
+		dryGain.advance(blockSize);
+		return;
+	}
+
+	// --- short delays feed back inside the block; mono uses the mono -> mono path
+	double minDelay = leftDelay.getMinBlockDelay(blockSize);
+	if (!rightBuffer || leftDelay.getDelayInSamples() < minDelay || rightDelay.getDelayInSamples() < minDelay)
+	{
+		double input[2] = { 0.0, 0.0 };
+		RenderInfo renderInfo;
+		renderInfo.inputData = &input[0];
+		renderInfo.numInputChannels = rightBuffer ? 2 : 1;
+		renderInfo.numOutputChannels = rightBuffer ? 2 : 1;
+
+		for (uint32_t i = 0; i < blockSize; i++)
+		{
+			input[0] = leftBuffer[i];
+			input[1] = rightBuffer ? rightBuffer[i] : leftBuffer[i];
+
+			processDelayFX(renderInfo);
+
+			leftBuffer[i] = outputs[kDelayFXLeftOutput];
+			if (rightBuffer)
+				rightBuffer[i] = outputs[kDelayFXRightOutput];
+		}
+		return;
+	}
+
+	// --- delayed outputs for the whole chunk
+	leftDelay.readDelayBlock(leftDelayBuffer, blockSize);
+	rightDelay.readDelayBlock(rightDelayBuffer, blockSize);
+
+	// --- delay inputs with feedback (see routing in processDelayFX( ))
+	for (uint32_t i = 0; i < blockSize; i++)
+	{
+		double feedback = feedbackGain.getNextValue();
+
+		if (delayFXMode == delayFXMode::norm)
+		{
+			leftInputBuffer[i] = leftBuffer[i] + leftDelayBuffer[i] * feedback;
+			rightInputBuffer[i] = rightBuffer[i] + rightDelayBuffer[i] * feedback;
+		}
+		else if (delayFXMode == delayFXMode::cross)
+		{
+			leftInputBuffer[i] = leftBuffer[i] + rightDelayBuffer[i] * feedback;
+			rightInputBuffer[i] = rightBuffer[i] + leftDelayBuffer[i] * feedback;
+		}
+		else // pingpong
+		{
+			leftInputBuffer[i] = rightBuffer[i] + rightDelayBuffer[i] * feedback;
+			rightInputBuffer[i] = leftBuffer[i] + leftDelayBuffer[i] * feedback;
+		}
+
+		// --- the feedback tail ends in zeros, not denormals
+		snapToZero(leftInputBuffer[i]);
+		snapToZero(rightInputBuffer[i]);
+	}
+
+	leftDelay.writeDelayBlock(leftInputBuffer, blockSize);
+	rightDelay.writeDelayBlock(rightInputBuffer, blockSize);
+
+	// --- form outputs
+	for (uint32_t i = 0; i < blockSize; i++)
+	{
+		double wet = wetGain.getNextValue();
+		double dry = dryGain.getNextValue();
+		leftBuffer[i] = dry*leftBuffer[i] + wet*leftDelayBuffer[i];
+		rightBuffer[i] = dry*rightBuffer[i] + wet*rightDelayBuffer[i];
+	}
+
+	chorusGain.advance(blockSize);
+}
@@ -23,6 +23,15 @@ const double kChorusFX_Depth_Max = 100.0;
 const double kMinChorusDelay_mSec = 5.0;
 const double kMaxChorusDelay_mSec = 30.0;
 
+// --- delay lines are 2 seconds long; tempo synced times are bound to this
+const double kMaxDelayFX_mSec = 2000.0;
+
+// --- block processing length; this is also the update interval the engine uses for the master FX
+const uint32_t kDelayFXBlockSize = kMaxLFOBlockSize;
+
+// --- extra delay line samples for the interpolator taps
+const uint32_t kDelayLineGuardSamples = 4;
+
 // --- outputs[] indexes for this component
 enum {
 	kDelayFXLeftOutput,
@@ -41,6 +50,9 @@ enum {
 /** normal, crossed feedback or ping-pong delay types */
 enum class delayFXMode { norm, cross, pingpong, chorus };
 
+/** fractional delay interpolation for modulated reads */
+enum class delayInterpolation { kLinear, kLagrange, kAllpass };
+
 /**
 	\struct DelayFXModifiers
 	\ingroup SynthStructures
@@ -55,6 +67,9 @@ enum class delayFXMode { norm, cross, pingpong, chorus };
 	\param chorusRate_Hz:			rate for chorus effect
 	\param chorusDepth_Pct:			depth (%) for chorus
 	\param enabled:					enable/disable the FX
+	\param tempoSync:				use delayTime_beats and the host tempo instead of delayTime_mSec
+	\param delayTime_beats:			delay time in beats (quarter notes) when tempoSync is on
+	\param interpolation:			fractional delay interpolation for the delay lines
 	\param modControls:				intensity and range controls for each modulator object
 */
 struct DelayFXModifiers
@@ -75,6 +90,13 @@ struct DelayFXModifiers
 	// --- mode of operation
 	delayFXMode delayFXMode = delayFXMode::norm;
 
+	// --- tempo sync
+	bool tempoSync = false;
+	double delayTime_beats = 1.0;
+
+	// --- fractional delay
+	delayInterpolation interpolation = delayInterpolation::kLinear;
+
 	// --- modulator controls
 	ModulatorControl modulationControls[kNumDelayFXModulators];
 };
@@ -84,6 +106,14 @@ struct DelayFXModifiers
 \ingroup SynthClasses
 \brief Encapsulates a single delay line of some number of samples in length
 
+The buffer length is a power of two so the read and write indexes wrap with a mask. Reads may be interpolated with:
+- linear: 2 taps
+- Lagrange: 4 taps, 3rd order; flatter frequency response for modulated delays
+- allpass: 1st order Thiran allpass; flat magnitude response, but it has a state so only one read per sample is allowed
+
+The block functions read and write whole blocks; a fixed integer delay is read with (at most two) memcpy( ) calls. Block reads
+take all samples from before the block is written, so the delay must be at least getMinBlockDelay( ) samples long.
+
 \author Will Pirkle
 \version Revision : 1.0
 \date Date : 2017 / 09 / 24
@@ -107,6 +137,9 @@ public:
 	void setSampleRate(int fs) { sampleRate = fs; };
 	void setDelay_mSec(double _delay_mSec);
 
+	/** set the fractional delay interpolation */
+	void setInterpolation(delayInterpolation _interpolation) { interpolation = _interpolation; }
+
 	// --- function to cook variables
 	void cookVariables();
 
@@ -117,12 +150,27 @@ public:
 	//     without writing or incrementing (optional)
 	double readDelayAt(double _delay_mSec);
 
+	// --- read the delay at an arbitrary number of samples; offset is the position in the block (0 for single samples)
+	double readDelayAtSamples(double _delayInSamples, uint32_t offset = 0);
+
 	// --- write the input and icrement pointers (optional)
 	void writeDelayAndInc(double inputSample);
 
 	// --- process audio -- this is the normal way to use the object
 	bool processAudio(double* input, double* output);
 
+	// --- block functions
+	bool readDelayBlock(double* output, uint32_t blockSize);
+	bool readModulatedBlock(const double* delayInSamplesBuffer, double* output, uint32_t blockSize);
+	void writeDelayBlock(const double* input, uint32_t blockSize);
+	bool processAudioBlock(const double* input, double* output, uint32_t blockSize);
+
+	/** the shortest delay (in samples) that can be read in blocks of blockSize */
+	double getMinBlockDelay(uint32_t blockSize) { return (double)(blockSize + 1); }
+
+	/** the current delay in samples */
+	double getDelayInSamples() { return delayInSamples; }
+
 protected:
 	// member variables
 	//
@@ -140,10 +188,17 @@ protected:
 	int writeIndex;				///< write index values for circ buffer
 
 	// --- max length of buffer	
-	int bufferLength;			///< max length of buffer	
+	int bufferLength;			///< max length of buffer; always a power of two
+
+	// --- wrap mask
+	int wrapMask;				///< bufferLength - 1
 
 	// --- sample rate 
 	int sampleRate;				///< sample rate 
+
+	// --- fractional delay
+	delayInterpolation interpolation = delayInterpolation::kLinear;	///< interpolation for fractional delays
+	double allpassState = 0.0;	///< y(n-1) of the allpass interpolator
 };
 
 /**
@@ -170,11 +225,17 @@ protected:
 	\param chorusRate_Hz:			rate for chorus effect
 	\param chorusDepth_Pct:			depth (%) for chorus
 	\param enabled:					enable/disable the FX
+	\param tempoSync:				use delayTime_beats and the host tempo instead of delayTime_mSec
+	\param delayTime_beats:			delay time in beats (quarter notes) when tempoSync is on
 	\param modControls:				intensity and range controls for each modulator object
 
 	Modulator indexes:
 	- kDelayFX_FeedbackMod:			[ 0, +1] delay feedback modulation (!)
 
+	The feedback, mix and chorus depth gains are calculated on update cycles and ramped over kDelayFXBlockSize samples;
+	the engine updates the master FX at that interval. processAudioBlock( ) processes in chunks of kDelayFXBlockSize with
+	block reads and writes of the delay lines and a block rendered chorus LFO.
+
 	\author Will Pirkle
 	\version Revision : 1.0
 	\date Date : 2017 / 09 / 24
@@ -211,9 +272,15 @@ public:
 	/** reset our shared modifier pointer to a new pointer */
 	void setModifiers(DelayFXModifiers* _modifiers) { modifiers.reset(_modifiers); }
 
+	// --- block processing, in place
+	virtual bool processAudioBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize, bool update);
+
 	/** do the delay FX */
 	void processDelayFX(RenderInfo& renderInfo);
 
+	/** do the delay FX on one chunk of at most kDelayFXBlockSize samples */
+	void processDelayFXBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize);
+
 protected:
 	// --- our delay lines
 	DelayLine leftDelay;
@@ -231,6 +298,26 @@ protected:
 	bool enabled = false;
 	double chorusRate_Hz = 0.0;
 	double chorusDepth_Pct = 0.0;
+	double sampleRate = 0.0;
+
+	// --- gains from the update cycle, ramped between updates
+	GainRamp feedbackGain;			///< feedback_Pct/100
+	GainRamp wetGain;				///< delayMix_Pct/100
+	GainRamp dryGain;				///< 1 - wet
+	GainRamp chorusGain;			///< chorus depth scaled to the wet level
+	bool snapGains = true;			///< jump to the new gains on the next update (after start/reset)
+
+	// --- set the ramp targets from the current settings
+	void startGainRamps();
+
+	// --- the chorus LFO is rendered in blocks; the per-sample path steps through the block
+	uint32_t lfoBlockIndex = kDelayFXBlockSize;	///< next LFO block sample; kDelayFXBlockSize = render a new block
+
+	// --- block scratch buffers
+	double leftDelayBuffer[kDelayFXBlockSize] = { 0.0 };	///< delayed left samples
+	double rightDelayBuffer[kDelayFXBlockSize] = { 0.0 };	///< delayed right samples
+	double leftInputBuffer[kDelayFXBlockSize] = { 0.0 };	///< left delay input (with feedback), or left modulated delay times
+	double rightInputBuffer[kDelayFXBlockSize] = { 0.0 };	///< right delay input (with feedback), or right modulated delay times
 
 	// --- note on flag
 	bool noteOn = false;
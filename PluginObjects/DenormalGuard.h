@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stdint.h>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define SYNTH_DENORMAL_GUARD_SSE
+#elif (defined(__aarch64__) || defined(_M_ARM64)) && (defined(__GNUC__) || defined(__clang__))
+#define SYNTH_DENORMAL_GUARD_ARM64
+#endif
+
+// --- LIMITS (always at top)
+//
+// --- MXCSR flush-to-zero (results) and denormals-are-zero (inputs) bits
+const uint32_t kMXCSR_FlushToZero = 0x8000;
+const uint32_t kMXCSR_DenormalsAreZero = 0x0040;
+
+// --- FPCR flush-to-zero bit (ARM64; covers both results and inputs)
+const uint64_t kFPCR_FlushToZero = (uint64_t)1 << 24;
+
+/**
+	\class DenormalGuard
+	\ingroup SynthClasses
+	\brief Turns on flush-to-zero and denormals-are-zero for the calling thread for the lifetime of the object and
+	puts the host's floating point mode back afterwards. Decaying feedback (filter states, reverb and delay tails)
+	otherwise ends up in denormal numbers, which are many times slower to process on most CPUs.
+
+	The control register is only written when the bits are not already set, so nested guards and hosts that already
+	run with FTZ/DAZ cost one register read. On other targets the guard does nothing; the objects also snap their
+	decayed states to zero (see snapToZero( )) so they do not rely on it.
+*/
+class DenormalGuard
+{
+public:
+	DenormalGuard()
+	{
+#if defined(SYNTH_DENORMAL_GUARD_SSE)
+		savedMode = _mm_getcsr();
+		uint32_t mode = savedMode | kMXCSR_FlushToZero | kMXCSR_DenormalsAreZero;
+		if (mode != savedMode)
+		{
+			_mm_setcsr(mode);
+			restoreMode = true;
+		}
+#elif defined(SYNTH_DENORMAL_GUARD_ARM64)
+		asm volatile("mrs %0, fpcr" : "=r"(savedMode));
+		uint64_t mode = savedMode | kFPCR_FlushToZero;
+		if (mode != savedMode)
+		{
+			asm volatile("msr fpcr, %0" : : "r"(mode));
+			restoreMode = true;
+		}
+#endif
+	}
+
+	~DenormalGuard()
+	{
+		if (!restoreMode)
+			return;
+
+#if defined(SYNTH_DENORMAL_GUARD_SSE)
+		_mm_setcsr(savedMode);
+#elif defined(SYNTH_DENORMAL_GUARD_ARM64)
+		asm volatile("msr fpcr, %0" : : "r"(savedMode));
+#endif
+	}
+
+	// --- not copyable; the guard belongs to one scope on one thread
+	DenormalGuard(const DenormalGuard&) = delete;
+	DenormalGuard& operator=(const DenormalGuard&) = delete;
+
+protected:
+#if defined(SYNTH_DENORMAL_GUARD_SSE)
+	uint32_t savedMode = 0;		///< host MXCSR
+#elif defined(SYNTH_DENORMAL_GUARD_ARM64)
+	uint64_t savedMode = 0;		///< host FPCR
+#endif
+	bool restoreMode = false;	///< true if we changed the mode
+};
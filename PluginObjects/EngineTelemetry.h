@@ -0,0 +1,124 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+// --- LIMITS (always at top)
+//
+// --- the engine publishes one frame per block of this many samples (about 170 frames per second at 44.1kHz)
+const uint32_t kTelemetryBlockSize = 256;
+
+// --- ring capacity in frames; must be a power of two. A reader that falls further behind than this loses the newest frames
+const uint32_t kTelemetryRingSize = 64;
+
+// --- voices reported per frame; one per voice slot including the ghost voices, NUM_VOICE_SLOTS in SynthEngine.h
+//     (checked there; this header stays independent of the engine)
+const uint32_t kMaxTelemetryVoices = 20;
+
+/**
+	\struct EngineTelemetryFrame
+	\ingroup SynthStructures
+	\brief One block of engine telemetry for meters and voice activity displays; plain data, copied through the ring.
+
+	\param blockIndex:			free running block counter; a gap between two frames means frames were dropped
+	\param peak:				peak absolute output per channel over the block
+	\param rms:					RMS output per channel over the block
+	\param activeVoices:		most voices running at the same time during the block
+	\param stealCount:			voices stolen since the last reset; running total
+	\param renderTime_uSec:		render time for a block of this length, from the last buffer timed with
+								SynthEngine::setTelemetryRenderTime( ); PluginCore times each host buffer
+	\param cpuLoad:				renderTime_uSec as a fraction of the block's real time duration
+	\param voiceEGState:		output EG state of each voice at the end of the block, as egState values (kOff = idle)
+	\param voiceNote:			MIDI note of each voice at the end of the block
+*/
+struct EngineTelemetryFrame
+{
+	EngineTelemetryFrame() {}
+
+	uint64_t blockIndex = 0;
+	float peak[2] = { 0.f, 0.f };
+	float rms[2] = { 0.f, 0.f };
+	uint32_t activeVoices = 0;
+	uint32_t stealCount = 0;
+	float renderTime_uSec = 0.f;
+	float cpuLoad = 0.f;
+	uint8_t voiceEGState[kMaxTelemetryVoices] = { 0 };
+	uint8_t voiceNote[kMaxTelemetryVoices] = { 0 };
+};
+
+/**
+	\class EngineTelemetryRing
+	\ingroup SynthClasses
+	\brief A fixed capacity, wait-free, single-producer/single-consumer FIFO of EngineTelemetryFrame structures for
+	sending meter and voice data from the audio thread to a GUI (or any other reader) without locks or allocation.
+	When the ring is full the new frame is dropped; the reader sees the gap in EngineTelemetryFrame::blockIndex.
+
+	Thread safety:
+	- exactly one thread may call pushFrame( ); this is the audio thread
+	- exactly one thread may call popFrame( ), popLatestFrame( ) and clear( ); this is the GUI timer or a test
+
+	Neither side depends on the plugin framework, so the ring can be driven headless.
+*/
+class EngineTelemetryRing
+{
+public:
+	EngineTelemetryRing() {}
+
+	/** producer: add a frame to the back of the ring; returns false if the ring is full */
+	bool pushFrame(const EngineTelemetryFrame& frame)
+	{
+		uint32_t write = writeIndex.load(std::memory_order_relaxed);
+		uint32_t read = readIndex.load(std::memory_order_acquire);
+
+		if (write - read >= kTelemetryRingSize)
+			return false; // full
+
+		frames[write & kMask] = frame;
+		writeIndex.store(write + 1, std::memory_order_release);
+		return true;
+	}
+
+	/** consumer: copy and remove the frame at the front of the ring; returns false if empty */
+	bool popFrame(EngineTelemetryFrame& frame)
+	{
+		uint32_t read = readIndex.load(std::memory_order_relaxed);
+		if (read == writeIndex.load(std::memory_order_acquire))
+			return false; // empty
+
+		frame = frames[read & kMask];
+		readIndex.store(read + 1, std::memory_order_release);
+		return true;
+	}
+
+	/** consumer: drain the ring and copy the newest frame; returns false if it was empty (frame is unchanged) */
+	bool popLatestFrame(EngineTelemetryFrame& frame)
+	{
+		uint32_t read = readIndex.load(std::memory_order_relaxed);
+		uint32_t write = writeIndex.load(std::memory_order_acquire);
+		if (read == write)
+			return false; // empty
+
+		frame = frames[(write - 1) & kMask];
+		readIndex.store(write, std::memory_order_release);
+		return true;
+	}
+
+	/** consumer: discard all pending frames */
+	void clear()
+	{
+		readIndex.store(writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+	}
+
+	/** number of frames waiting; exact on the consumer side, a snapshot on the producer side */
+	uint32_t getFrameCount()
+	{
+		return writeIndex.load(std::memory_order_acquire) - readIndex.load(std::memory_order_acquire);
+	}
+
+protected:
+	static const uint32_t kMask = kTelemetryRingSize - 1;
+
+	EngineTelemetryFrame frames[kTelemetryRingSize];	///< preallocated frame storage
+	std::atomic<uint32_t> writeIndex{ 0 };				///< free running; only written by producer
+	std::atomic<uint32_t> readIndex{ 0 };				///< free running; only written by consumer
+};
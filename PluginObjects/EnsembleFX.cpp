@@ -0,0 +1,408 @@
+#include "EnsembleFX.h"
+
+#include <string.h>
+
+/**
+	\brief Object constructor specialized to properly and safely share the modifiers and MIDI data
+	\param _modifiers -- the GUI modifiers structure for this component, to be shared with all similar components
+	\param _midiData -- global MIDI data interface, shared across all ISynthComponents
+	\param numOutputs -- the number of outputs for this component
+	\param numModulators -- the number of modulators for this component
+*/
+EnsembleFX::EnsembleFX(std::shared_ptr<EnsembleFXModifiers> _modifiers, IMIDIData* _midiData, uint32_t numOutputs, uint32_t numModulators)
+: ISynthAudioProcessor(_midiData, numOutputs, numModulators)
+, modifiers(_modifiers)
+{
+	if (!modifiers) return;
+
+	// --- set our type id
+	componentType = componentType::kFXProcessor;
+
+	// --- validate all pointers
+	validComponent = validateComponent();
+}
+
+/** Destructor: delete output array and modulators */
+EnsembleFX::~EnsembleFX()
+{
+	// --- delete our arrays (and modulators) and nullify
+	destroyArrays();
+}
+
+/**
+	\brief Initialize component with sample-rate dependent parameters
+	\param info -- initialization information including sample rate
+	\return true if handled, false if not handled
+*/
+bool EnsembleFX::initializeComponent(InitializeInfo& info)
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- set sample rate first
+	sampleRate = info.sampleRate;
+	delayLine.setSampleRate(info.sampleRate);
+
+	// --- only needs to hold the longest tap
+	delayLine.init(kMaxEnsembleBuffer_mSec*info.sampleRate / 1000.0);
+
+	return true;
+}
+
+/**
+	\brief Perform startup operations for the component
+	\return true if handled, false if not handled
+*/
+bool EnsembleFX::startComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- save flag
+	noteOn = true;
+
+	// --- no ramps from stale gains
+	snapGains = true;
+
+	return true;
+}
+
+/**
+	\brief Perform shut-off operations for the component
+	\return true if handled, false if not handled
+*/
+bool EnsembleFX::stopComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- clear flag
+	noteOn = false;
+
+	return true;
+}
+
+/**
+	\brief Reset the component to a note-off state
+	\return true if handled, false if not handled
+*/
+bool EnsembleFX::resetComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- clear the outputs
+	clearOutputs();
+
+	// --- flush buffer
+	delayLine.resetDelay();
+
+	// --- restart the LFO
+	modCounter = 0.0;
+
+	// --- no ramps from stale gains
+	snapGains = true;
+
+	return true;
+}
+
+/**
+	\brief Validate all shared pointers, dynamically declared objects (including modulators) and the output array;
+	this function should be called once during construction to set the validComponent flag, which is used for future component validation.
+	\return true if handled, false if not handled
+*/
+bool EnsembleFX::validateComponent()
+{
+	// --- shared pointers and modifiers
+	if (modifiers && midiData)
+	{
+		// --- test for outputs
+		for (unsigned int i = 0; i < numOutputs; i++)
+		{
+			if (!getOutputPtr(i))
+				return false;
+		}
+		return true;
+	}
+	return false;
+}
+
+/**
+	\brief Perform note-on operations for the component
+	\return true if handled, false if not handled
+*/
+bool EnsembleFX::doNoteOn(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity)
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	resetComponent();
+
+	return startComponent();
+}
+
+/**
+	\brief Perform note-off operations for the component
+	\return true if handled, false if not handled
+*/
+bool EnsembleFX::doNoteOff(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity)
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	return true;
+}
+
+/**
+	\brief Recalculate the LFO, the tap tables and the gain targets from the GUI modifiers
+	\return true if handled, false if not handled
+*/
+bool EnsembleFX::updateComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	enabled = modifiers->enabled || ownerBypass;
+
+	// --- LFO
+	double rate_Hz = modifiers->rate_Hz;
+	boundValue(rate_Hz, 0.0, 20.0);
+	phaseInc = sampleRate > 0.0 ? rate_Hz / sampleRate : 0.0;
+
+	// --- the allpass interpolator has one state, so it can't serve multiple taps
+	delayInterpolation interpolation = modifiers->interpolation;
+	if (interpolation == delayInterpolation::kAllpass)
+		interpolation = delayInterpolation::kLagrange;
+	delayLine.setInterpolation(interpolation);
+
+	// --- tap tables only on a change
+	numTaps = modifiers->numTaps;
+	if (numTaps < kMinEnsembleTaps) numTaps = kMinEnsembleTaps;
+	if (numTaps > kMaxEnsembleTaps) numTaps = kMaxEnsembleTaps;
+
+	double spread_Pct = modifiers->spread_Pct;
+	boundValue(spread_Pct, 0.0, 100.0);
+
+	if (numTaps != lastNumTaps || spread_Pct != lastSpread_Pct)
+	{
+		lastNumTaps = numTaps;
+		lastSpread_Pct = spread_Pct;
+
+		// --- equal loudness for any number of (uncorrelated) taps
+		double norm = 1.0 / sqrt((double)numTaps);
+
+		for (uint32_t i = 0; i < numTaps; i++)
+		{
+			tapPhaseOffset[i] = (double)i / (double)numTaps;
+
+			// --- spread evenly from left to right
+			double pan = numTaps > 1 ? (spread_Pct / 100.0)*(2.0*(double)i / (double)(numTaps - 1) - 1.0) : 0.0;
+			calculatePanValues(pan, tapLeftGain[i], tapRightGain[i]);
+			tapLeftGain[i] *= norm;
+			tapRightGain[i] *= norm;
+		}
+	}
+
+	// --- gains and sweep
+	double wet = modifiers->mix_Pct / 100.0;
+	boundValue(wet, 0.0, 1.0);
+
+	double depth = modifiers->depth_Pct / 100.0;
+	boundValue(depth, 0.0, 1.0);
+	double excursion = depth*0.5*(kMaxEnsembleDelay_mSec - kMinEnsembleDelay_mSec)*sampleRate / 1000.0;
+
+	if (snapGains)
+	{
+		wetGain.snap(wet);
+		dryGain.snap(1.0 - wet);
+		sweepDepth.snap(excursion);
+		snapGains = false;
+	}
+	else
+	{
+		wetGain.setTarget(wet, kDelayFXBlockSize);
+		dryGain.setTarget(1.0 - wet, kDelayFXBlockSize);
+		sweepDepth.setTarget(excursion, kDelayFXBlockSize);
+	}
+
+	return true;
+}
+
+/**
+	\brief Render the component; for ISynthAudioProcessors, this checks and updates the component if needed
+
+	\param update -- a flag that is used to update the component
+
+	\return true if handled, false if not handled
+*/
+bool EnsembleFX::renderComponent(bool update)
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- run the modulators
+	runModuators(update);
+
+	if (update)
+		updateComponent();
+
+	return true;
+}
+
+/**
+	\brief Process audio from renderInfo.inputData to output array; one sample through the block renderer
+
+	\param renderInfo contains information about the processing including the flag renderInfo.renderInternal; if this is true, we process audio
+	into the output buffer only, otherwise copy the output data into the renderInfo.outputData array
+
+	\return true if handled, false if not handled
+*/
+bool EnsembleFX::processAudio(RenderInfo& renderInfo)
+{
+	// --- check render/update
+	if (!renderComponent(renderInfo.updateComponent))
+		return false;
+
+	// --- always check for proper channel setup
+	if (renderInfo.numInputChannels == 0 ||
+		renderInfo.numInputChannels > 2 ||
+		renderInfo.numOutputChannels == 0 ||
+		renderInfo.numOutputChannels > 2)
+		return false; // not handled
+
+	double left = renderInfo.inputData[0];
+	double right = renderInfo.numInputChannels == 2 ? renderInfo.inputData[1] : left;
+
+	if (enabled)
+		processEnsembleBlock(&left, renderInfo.numOutputChannels == 2 ? &right : nullptr, 1);
+
+	outputs[kEnsembleFXLeftOutput] = left;
+	outputs[kEnsembleFXRightOutput] = renderInfo.numOutputChannels == 2 ? right : left;
+
+	// --- if rendering internal, we're done!
+	if (renderInfo.renderInternal)
+		return true;
+
+	renderInfo.outputData[0] = outputs[kEnsembleFXLeftOutput];
+	if (renderInfo.numOutputChannels == 2)
+		renderInfo.outputData[1] = outputs[kEnsembleFXRightOutput];
+
+	return true;
+}
+
+/**
+	\brief Process a stereo (or mono, with a nullptr right buffer) block in place; the block is processed in chunks of
+	kDelayFXBlockSize and the component is updated once per chunk if update is set.
+
+	\param leftBuffer -- left (or mono) channel buffer
+	\param rightBuffer -- right channel buffer; nullptr for mono -> mono
+	\param blockSize -- number of samples in the buffers
+	\param update -- a flag that is used to update the component
+
+	\return true if handled, false if not handled
+*/
+bool EnsembleFX::processAudioBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize, bool update)
+{
+	if (!leftBuffer || blockSize == 0)
+		return false;
+
+	uint32_t offset = 0;
+	while (offset < blockSize)
+	{
+		uint32_t count = blockSize - offset;
+		if (count > kDelayFXBlockSize)
+			count = kDelayFXBlockSize;
+
+		// --- check render/update
+		if (!renderComponent(update))
+			return false;
+
+		// --- pass through if not enabled
+		if (enabled)
+			processEnsembleBlock(&leftBuffer[offset], rightBuffer ? &rightBuffer[offset] : nullptr, count);
+
+		offset += count;
+	}
+
+	outputs[kEnsembleFXLeftOutput] = leftBuffer[blockSize - 1];
+	outputs[kEnsembleFXRightOutput] = rightBuffer ? rightBuffer[blockSize - 1] : outputs[kEnsembleFXLeftOutput];
+
+	return true;
+}
+
+/**
+	\brief Process one chunk in place: sweep and read every tap over the whole chunk, accumulate the panned taps, write the
+	mono input and mix
+
+	\param leftBuffer -- left (or mono) channel buffer
+	\param rightBuffer -- right channel buffer; nullptr for mono -> mono
+	\param blockSize -- number of samples; at most kDelayFXBlockSize
+*/
+void EnsembleFX::processEnsembleBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize)
+{
+	// --- mono sum feeds the shared delay line
+	if (rightBuffer)
+	{
+		for (uint32_t i = 0; i < blockSize; i++)
+			monoBuffer[i] = 0.5*(leftBuffer[i] + rightBuffer[i]);
+	}
+	else
+		memcpy(monoBuffer, leftBuffer, blockSize * sizeof(double));
+
+	// --- LFO phase and sweep depth for the chunk
+	double phase = modCounter;
+	for (uint32_t i = 0; i < blockSize; i++)
+	{
+		phaseBuffer[i] = phase;
+		phase += phaseInc;
+		if (phase >= 1.0) phase -= 1.0;
+
+		depthBuffer[i] = sweepDepth.getNextValue();
+	}
+	modCounter = phase;
+
+	double centerDelay = 0.5*(kMaxEnsembleDelay_mSec + kMinEnsembleDelay_mSec)*sampleRate / 1000.0;
+
+	memset(wetLeftBuffer, 0, blockSize * sizeof(double));
+	memset(wetRightBuffer, 0, blockSize * sizeof(double));
+
+	// --- tap by tap
+	for (uint32_t tap = 0; tap < numTaps; tap++)
+	{
+		double phaseOffset = tapPhaseOffset[tap];
+		for (uint32_t i = 0; i < blockSize; i++)
+		{
+			double tapPhase = phaseBuffer[i] + phaseOffset;
+			tapPhase = tapPhase >= 1.0 ? tapPhase - 1.0 : tapPhase;
+			delayBuffer[i] = centerDelay + depthBuffer[i] * polynomialSine(tapPhase);
+		}
+
+		delayLine.readModulatedBlock(delayBuffer, tapBuffer, blockSize);
+
+		double leftGain = tapLeftGain[tap];
+		double rightGain = tapRightGain[tap];
+		for (uint32_t i = 0; i < blockSize; i++)
+		{
+			wetLeftBuffer[i] += leftGain*tapBuffer[i];
+			wetRightBuffer[i] += rightGain*tapBuffer[i];
+		}
+	}
+
+	// --- write after all taps have read
+	delayLine.writeDelayBlock(monoBuffer, blockSize);
+
+	// --- form outputs
+	for (uint32_t i = 0; i < blockSize; i++)
+	{
+		double wet = wetGain.getNextValue();
+		double dry = dryGain.getNextValue();
+
+		if (rightBuffer)
+		{
+			leftBuffer[i] = dry*leftBuffer[i] + wet*wetLeftBuffer[i];
+			rightBuffer[i] = dry*rightBuffer[i] + wet*wetRightBuffer[i];
+		}
+		else // --- mono: fold the taps back together
+			leftBuffer[i] = dry*leftBuffer[i] + wet*0.5*(wetLeftBuffer[i] + wetRightBuffer[i]);
+	}
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "synthfunctions.h"
+#include "synthobjects.h"
+#include "guiconstants.h"
+#include "DelayFX.h"
+
+// --- LIMITS (always at top)
+//
+// --- number of chorus taps
+const uint32_t kMinEnsembleTaps = 1;
+const uint32_t kMaxEnsembleTaps = 8;
+
+// --- tap delay range; the taps sweep around the center of this range
+const double kMinEnsembleDelay_mSec = 6.0;
+const double kMaxEnsembleDelay_mSec = 24.0;
+
+// --- the delay line only needs to hold the longest tap
+const double kMaxEnsembleBuffer_mSec = 50.0;
+
+// --- outputs[] indexes for this component
+enum {
+	kEnsembleFXLeftOutput,
+	kEnsembleFXRightOutput,
+	kNumEnsembleFXOutputs
+};
+
+// --- modulator indexes for this component
+enum {
+	kNumEnsembleFXModulators
+};
+
+/**
+	\struct EnsembleFXModifiers
+	\ingroup SynthStructures
+	\brief Contains modifiers for the EnsembleFX component. A "modifier" is any variable that *may* be connected to a
+	GUI control, however modifiers are not required to be connected to anything and their default values are set in the structure.
+
+	\param numTaps:			number of chorus taps [kMinEnsembleTaps, kMaxEnsembleTaps]
+	\param rate_Hz:			LFO rate for all taps
+	\param depth_Pct:		sweep depth in % of the tap delay range
+	\param spread_Pct:		stereo spread of the taps in %; 0 = all taps in the center
+	\param mix_Pct:			wet/dry mix in %
+	\param enabled:			enable/disable the FX
+	\param interpolation:	fractional delay interpolation for the tap reads
+*/
+struct EnsembleFXModifiers
+{
+	EnsembleFXModifiers() {}
+
+	uint32_t numTaps = 3;
+	double rate_Hz = 0.5;
+	double depth_Pct = 50.0;
+	double spread_Pct = 100.0;
+	double mix_Pct = 50.0;
+	bool enabled = false;
+	delayInterpolation interpolation = delayInterpolation::kLinear;
+};
+
+/**
+	\class EnsembleFX
+	\ingroup SynthClasses
+	\brief Encapsulates a multi-tap stereo chorus (ensemble). All taps read one delay line that holds the mono sum of the input;
+	each tap sweeps with its own phase of one sinusoidal LFO (tap k is offset by k/numTaps of a cycle) and is panned across the
+	stereo field with equal power gains.
+
+	The taps are rendered tap-by-tap over a block: the delay times for one tap are calculated for the whole block, read with
+	DelayLine::readModulatedBlock( ) and accumulated into the left and right wet buffers, so the inner loops are short and
+	branch-free. Only one delay line is written no matter how many taps there are.
+
+	I/O: supports the following channel combinations:
+	- mono -> mono
+	- mono -> stereo
+	- stereo -> stereo
+
+	Outputs: contains 2 outputs
+	- Left Channel
+	- Right Channel
+
+	Control I/F:
+	Use EnsembleFXModifiers structure
+
+	Modulator indexes:
+	- this component has no modulators
+*/
+class EnsembleFX : public ISynthAudioProcessor
+{
+public:
+	EnsembleFX(std::shared_ptr<EnsembleFXModifiers> _modifiers, IMIDIData* _midiData, uint32_t numOutputs, uint32_t numModulators);
+	virtual ~EnsembleFX();
+
+	// --- ISynthComponent
+	virtual bool initializeComponent(InitializeInfo& info);
+	virtual bool startComponent();
+	virtual bool stopComponent();
+	virtual bool resetComponent();
+	virtual bool validateComponent();
+	virtual bool isComponentRunning() { return noteOn; }
+
+	// --- note event handlers
+	virtual bool doNoteOn(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity);
+	virtual bool doNoteOff(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity);
+
+	// --- update and render methods
+	virtual bool updateComponent();
+	virtual bool renderComponent(bool update);
+
+	// --- IAudioProcessor
+	virtual bool processAudio(RenderInfo& renderInfo);
+
+	// --- block processing, in place
+	virtual bool processAudioBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize, bool update);
+
+	// --- modifier getter
+	std::shared_ptr<EnsembleFXModifiers> getModifiers() { return modifiers; }
+
+protected:
+	// --- do the ensemble on one chunk of at most kDelayFXBlockSize samples
+	void processEnsembleBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize);
+
+	// --- the shared (mono) delay line
+	DelayLine delayLine;
+
+	double sampleRate = 0.0;
+	bool enabled = false;
+
+	// --- LFO
+	double modCounter = 0.0;		///< LFO phase [0, 1)
+	double phaseInc = 0.0;			///< LFO phase increment
+
+	// --- taps
+	uint32_t numTaps = 0;							///< number of active taps
+	double tapPhaseOffset[kMaxEnsembleTaps] = { 0.0 };	///< tap phase offsets, k/numTaps
+	double tapLeftGain[kMaxEnsembleTaps] = { 0.0 };		///< tap pan gains, including the 1/sqrt(numTaps) normalization
+	double tapRightGain[kMaxEnsembleTaps] = { 0.0 };	///< tap pan gains, including the 1/sqrt(numTaps) normalization
+	uint32_t lastNumTaps = 0;						///< numTaps the tap tables were built from
+	double lastSpread_Pct = -1.0;					///< spread the tap tables were built from
+
+	// --- gains and sweep from the update cycle, ramped between updates
+	GainRamp wetGain;				///< mix_Pct/100
+	GainRamp dryGain;				///< 1 - wet
+	GainRamp sweepDepth;			///< sweep excursion in samples
+	bool snapGains = true;			///< jump to the new values on the next update (after start/reset)
+
+	// --- block scratch buffers
+	double monoBuffer[kDelayFXBlockSize] = { 0.0 };		///< mono sum of the input
+	double phaseBuffer[kDelayFXBlockSize] = { 0.0 };	///< LFO phase for each sample
+	double depthBuffer[kDelayFXBlockSize] = { 0.0 };	///< sweep excursion for each sample
+	double delayBuffer[kDelayFXBlockSize] = { 0.0 };	///< tap delay times in samples
+	double tapBuffer[kDelayFXBlockSize] = { 0.0 };		///< tap output
+	double wetLeftBuffer[kDelayFXBlockSize] = { 0.0 };	///< accumulated left taps
+	double wetRightBuffer[kDelayFXBlockSize] = { 0.0 };	///< accumulated right taps
+
+	// --- note on flag
+	bool noteOn = false;
+
+	// --- our modifiers
+	std::shared_ptr<EnsembleFXModifiers> modifiers;
+};
+
@@ -0,0 +1,399 @@
+#include "FMOperatorEngine.h"
+
+/** number of operator bits that are set; a compile time constant for the template arguments */
+static constexpr uint32_t countOperators(uint32_t operatorBits)
+{
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < kNumFMOperators; i++)
+		count += (operatorBits >> i) & 1;
+	return count;
+}
+
+/**
+	\brief One output sample of an algorithm. The routing is in the template arguments, so the operator bit tests below
+	are resolved by the compiler and each instantiation is straight-line code for its algorithm. Operators render from
+	4 down to 1, which is the direction of modulation in all eight algorithms.
+
+	\return the sum of the carriers, scaled by 1/(number of carriers)
+*/
+template <uint32_t ModulatorsOf3, uint32_t ModulatorsOf2, uint32_t ModulatorsOf1, uint32_t Carriers>
+double FMOperatorEngine::renderAlgorithm()
+{
+	double output[kNumFMOperators];
+
+	// --- operator 4 with feedback
+	output[3] = doOperator(3, feedbackScale*(feedbackHistory[0] + feedbackHistory[1]));
+	feedbackHistory[1] = feedbackHistory[0];
+	feedbackHistory[0] = output[3];
+
+	// --- operators 3, 2, 1, each phase modulated by the sum of its modulators
+	output[2] = doOperator(2, modulationScale*((ModulatorsOf3 & kFMOp4) ? output[3] : 0.0));
+
+	output[1] = doOperator(1, modulationScale*(((ModulatorsOf2 & kFMOp4) ? output[3] : 0.0) +
+											   ((ModulatorsOf2 & kFMOp3) ? output[2] : 0.0)));
+
+	output[0] = doOperator(0, modulationScale*(((ModulatorsOf1 & kFMOp4) ? output[3] : 0.0) +
+											   ((ModulatorsOf1 & kFMOp3) ? output[2] : 0.0) +
+											   ((ModulatorsOf1 & kFMOp2) ? output[1] : 0.0)));
+
+	// --- carriers
+	const double carrierScale = 1.0 / (double)countOperators(Carriers);
+	return carrierScale*(((Carriers & kFMOp1) ? output[0] : 0.0) +
+						 ((Carriers & kFMOp2) ? output[1] : 0.0) +
+						 ((Carriers & kFMOp3) ? output[2] : 0.0) +
+						 ((Carriers & kFMOp4) ? output[3] : 0.0));
+}
+
+/**
+	\brief Object constructor specialized to properly and safely share the modifiers and MIDI data
+	\param _modifiers -- the GUI modifiers structure for this component, to be shared with all similar components
+	\param _midiData -- global MIDI data, shared across all ISynthComponents
+	\param numOutputs -- the number of outputs for this component
+	\param numModulators -- the number of modulators for this component
+*/
+FMOperatorEngine::FMOperatorEngine(std::shared_ptr<FMEngineModifiers> _modifiers, IMIDIData* _midiData, uint32_t numOutputs, uint32_t numModulators)
+	: ISynthComponent(_midiData, numOutputs, numModulators)
+	, modifiers(_modifiers)
+{
+	if (!modifiers) return;
+
+	// --- set our type id
+	componentType = componentType::kPitchedOscillator;
+
+	// --- create modulators
+	modulators[kFMEnginePitchMod] = createModulator(kDefaultOutputValueOFF, kFMEngine_Pitch_ModRange, modTransform::kNoTransform);
+
+	/* the modulation range for this one will be changed for each portamento "session" */
+	modulators[kFMEnginePortamentoMod] = createModulator(kDefaultOutputValueOFF, kFMEngine_Pitch_ModRange, modTransform::kNoTransform);
+
+	// --- validate all pointers
+	validComponent = validateComponent();
+}
+
+/** Destructor: delete output array and modulators */
+FMOperatorEngine::~FMOperatorEngine()
+{
+	// --- delete our arrays (and modulators) and nullify
+	destroyArrays();
+}
+
+/**
+	\brief Initialize component with sample-rate dependent parameters
+	\param info -- initialization information including sample rate
+	\return true if handled, false if not handled
+*/
+bool FMOperatorEngine::initializeComponent(InitializeInfo& info)
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- retain sample rate for update calculations
+	sampleRate = info.sampleRate;
+
+	// --- bulk reset
+	resetComponent();
+
+	return true;
+}
+
+/**
+	\brief Start the operators from phase zero (key sync) and their EGs from the attack
+	\return true if handled, false if not handled
+*/
+bool FMOperatorEngine::startComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	for (uint32_t i = 0; i < kNumFMOperators; i++)
+	{
+		operatorPhase[i] = 0.0;
+		operatorLevelInc[i] = 0.0;
+		egState[i] = fmOperatorEGState::kAttack;
+	}
+	feedbackHistory[0] = 0.0;
+	feedbackHistory[1] = 0.0;
+
+	// --- set our flag
+	noteOn = true;
+
+	return true;
+}
+
+/**
+	\brief Perform shut-off operations for the component
+	\return true if handled, false if not handled
+*/
+bool FMOperatorEngine::stopComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- clear our flag
+	noteOn = false;
+
+	return true;
+}
+
+/**
+	\brief Reset the component to a note-off state
+	\return true if handled, false if not handled
+*/
+bool FMOperatorEngine::resetComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- clear the outputs
+	clearOutputs();
+
+	for (uint32_t i = 0; i < kNumFMOperators; i++)
+	{
+		operatorPhase[i] = 0.0;
+		operatorPhaseInc[i] = 0.0;
+		operatorLevel[i] = 0.0;
+		operatorLevelInc[i] = 0.0;
+		egState[i] = fmOperatorEGState::kOff;
+		egLevel[i] = 0.0;
+	}
+	feedbackHistory[0] = 0.0;
+	feedbackHistory[1] = 0.0;
+
+	samplesSinceUpdate = 0;
+
+	// --- reset run/stop flag
+	noteOn = false;
+
+	return true;
+}
+
+/**
+	\brief Validate all shared pointers, dynamically declared objects (including modulators) and the output array
+	\return true if valid, false if not
+*/
+bool FMOperatorEngine::validateComponent()
+{
+	// --- shared pointers and modifiers
+	if (modifiers && midiData)
+	{
+		// --- test for modulators
+		for (unsigned int i = 0; i < numModulators; i++)
+		{
+			if (!modulators[i])
+				return false;
+		}
+
+		// --- test for outputs
+		for (unsigned int i = 0; i < numOutputs; i++)
+		{
+			if (!getOutputPtr(i))
+				return false;
+		}
+		return true;
+	}
+	return false;
+}
+
+/**
+	\brief Perform note-on operations for the component
+	\return true if handled, false if not handled
+*/
+bool FMOperatorEngine::doNoteOn(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity)
+{
+	if (!validComponent) return false;
+
+	// --- save pitch
+	midiNotePitch = midiPitch;
+
+	// --- start component
+	startComponent();
+
+	return true;
+}
+
+/**
+	\brief Perform note-off operations for the component: release the operator EGs
+	\return true if handled, false if not handled
+*/
+bool FMOperatorEngine::doNoteOff(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity)
+{
+	if (!validComponent) return false;
+
+	for (uint32_t i = 0; i < kNumFMOperators; i++)
+	{
+		if (egState[i] != fmOperatorEGState::kOff)
+			egState[i] = fmOperatorEGState::kRelease;
+	}
+
+	noteOn = false;
+
+	return true;
+}
+
+/**
+	\brief Run one operator EG forward by the time since the last update
+	- attack: linear ramp to 1.0
+	- decay/sustain: exponential approach to the sustain level, reaching -60dB of the distance in decayTime_mSec
+	- release: exponential decay to kFMOperatorEGOffLevel, then off
+
+	\param op -- operator index
+	\param elapsed_mSec -- time since the last update
+*/
+void FMOperatorEngine::updateOperatorEG(uint32_t op, double elapsed_mSec)
+{
+	const FMOperatorModifiers& opModifiers = modifiers->operators[op];
+
+	// --- ln(1000): -60dB
+	const double timeConstants = 6.907755279;
+
+	if (egState[op] == fmOperatorEGState::kAttack)
+	{
+		egLevel[op] += opModifiers.attackTime_mSec > 0.0 ? elapsed_mSec / opModifiers.attackTime_mSec : 1.0;
+		if (egLevel[op] >= 1.0)
+		{
+			egLevel[op] = 1.0;
+			egState[op] = fmOperatorEGState::kDecaySustain;
+		}
+	}
+	else if (egState[op] == fmOperatorEGState::kDecaySustain)
+	{
+		double sustainLevel = opModifiers.sustainLevel;
+		boundValue(sustainLevel, 0.0, 1.0);
+		double coeff = opModifiers.decayTime_mSec > 0.0 ? exp(-timeConstants*elapsed_mSec / opModifiers.decayTime_mSec) : 0.0;
+		egLevel[op] = sustainLevel + (egLevel[op] - sustainLevel)*coeff;
+	}
+	else if (egState[op] == fmOperatorEGState::kRelease)
+	{
+		double coeff = opModifiers.releaseTime_mSec > 0.0 ? exp(-timeConstants*elapsed_mSec / opModifiers.releaseTime_mSec) : 0.0;
+		egLevel[op] *= coeff;
+		if (egLevel[op] < kFMOperatorEGOffLevel)
+		{
+			egLevel[op] = 0.0;
+			egState[op] = fmOperatorEGState::kOff;
+		}
+	}
+}
+
+/** true if any operator EG is still running */
+bool FMOperatorEngine::operatorsRunning()
+{
+	for (uint32_t i = 0; i < kNumFMOperators; i++)
+	{
+		if (egState[i] != fmOperatorEGState::kOff)
+			return true;
+	}
+	return false;
+}
+
+/**
+	\brief Recalculate the component's internal variables based on GUI modifiers, modulators, and MIDI data: select the
+	render kernel, the operator frequencies, and the operator EGs and their ramps for the next update interval
+	\return true if handled, false if not handled
+*/
+bool FMOperatorEngine::updateComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- select the render kernel only when the algorithm changes
+	if (modifiers->algorithm != algorithm || !renderKernel)
+	{
+		// --- routings: modulators of operators 3, 2, 1 and the carriers; see fmEngineAlgorithm
+		static const RenderKernel algorithmKernels[(uint32_t)fmEngineAlgorithm::kNumAlgorithms] = {
+			&FMOperatorEngine::renderAlgorithm<kFMOp4, kFMOp3, kFMOp2, kFMOp1>,
+			&FMOperatorEngine::renderAlgorithm<0, kFMOp3 | kFMOp4, kFMOp2, kFMOp1>,
+			&FMOperatorEngine::renderAlgorithm<0, kFMOp3, kFMOp2 | kFMOp4, kFMOp1>,
+			&FMOperatorEngine::renderAlgorithm<kFMOp4, 0, kFMOp2 | kFMOp3, kFMOp1>,
+			&FMOperatorEngine::renderAlgorithm<kFMOp4, 0, kFMOp2, kFMOp1 | kFMOp3>,
+			&FMOperatorEngine::renderAlgorithm<kFMOp4, kFMOp4, kFMOp4, kFMOp1 | kFMOp2 | kFMOp3>,
+			&FMOperatorEngine::renderAlgorithm<kFMOp4, 0, 0, kFMOp1 | kFMOp2 | kFMOp3>,
+			&FMOperatorEngine::renderAlgorithm<0, 0, 0, kFMOp1 | kFMOp2 | kFMOp3 | kFMOp4> };
+
+		algorithm = modifiers->algorithm;
+		uint32_t index = (uint32_t)algorithm;
+		if (index >= (uint32_t)fmEngineAlgorithm::kNumAlgorithms)
+			index = 0;
+		renderKernel = algorithmKernels[index];
+	}
+
+	// --- calculate MIDI pitch bend in semitones (globalMIDIData[kMIDIPitchBendRange] is in semitones)
+	double midiPitchBend = midiData->getMidiGlobalData(kMIDIPitchBendRange) * midiPitchBendToBipolar(midiData->getMidiGlobalData(kMIDIPitchBendData1),
+																									   midiData->getMidiGlobalData(kMIDIPitchBendData2));
+
+	// --- note frequency with all modulations ***in semitones***
+	double noteFrequency = midiNotePitch*
+		pitchShiftTableLookup(
+			(modulators[kFMEnginePitchMod]->getModulatedValue()) +			/* ExpFreqModulation input */
+			(modulators[kFMEnginePortamentoMod]->getModulatedValue()) +		/* portamento input */
+			(midiPitchBend) +												/* [-1, +1]*MIDI_PB_range*/
+			(modifiers->masterTuningOffset_cents / 100.0));					/* master tuning offset */
+	noteFrequency *= modifiers->masterTuningRatio;
+
+	// --- update interval: measured between updates, so it follows the voice granularity and oversampling
+	if (samplesSinceUpdate > 0)
+		updateInterval = samplesSinceUpdate;
+	samplesSinceUpdate = 0;
+	double elapsed_mSec = sampleRate > 0.0 ? 1000.0*(double)updateInterval / sampleRate : 0.0;
+
+	for (uint32_t i = 0; i < kNumFMOperators; i++)
+	{
+		const FMOperatorModifiers& opModifiers = modifiers->operators[i];
+
+		// --- frequency
+		double operatorFrequency = noteFrequency*opModifiers.ratio*pitchShiftTableLookup(opModifiers.detune_cents / 100.0);
+		boundValue(operatorFrequency, 0.0, 0.5*sampleRate);
+		operatorPhaseInc[i] = sampleRate > 0.0 ? operatorFrequency / sampleRate : 0.0;
+
+		// --- EG and the ramp to its level at the next update
+		updateOperatorEG(i, elapsed_mSec);
+
+		double outputLevel = opModifiers.outputLevel;
+		boundValue(outputLevel, 0.0, 1.0);
+		operatorLevelInc[i] = (outputLevel*egLevel[i] - operatorLevel[i]) / (double)updateInterval;
+	}
+
+	// --- feedback in cycles; the history holds two samples
+	double feedback = modifiers->feedback;
+	boundValue(feedback, 0.0, 1.0);
+	feedbackScale = 0.5*feedback*kFMEngine_MaxFeedback / (2.0*pi);
+
+	// --- output gain control
+	outputGain = modifiers->fmAmpControl_dB <= -96.0 ? 0.0 : pow(10.0, modifiers->fmAmpControl_dB / 20.0);
+
+	return true;
+}
+
+/**
+	\brief Render the component: modulators and update on update cycles only, then one sample of the selected kernel
+
+	\param update -- a flag that is used to update the component; the voice's granularity timer sets/clears this variable
+
+	\return true if handled, false if not handled
+*/
+bool FMOperatorEngine::renderComponent(bool update)
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- the modulators only set the pitch, which is calculated on updates
+	if (update)
+	{
+		runModuators(true);
+		updateComponent();
+	}
+	samplesSinceUpdate++;
+
+	// --- off: nothing to render
+	if (outputGain == 0.0 || !renderKernel)
+	{
+		outputs[kFMEngineLeftOutput] = 0.0;
+		outputs[kFMEngineRightOutput] = 0.0;
+		return true;
+	}
+
+	double output = outputGain*(this->*renderKernel)();
+	outputs[kFMEngineLeftOutput] = output;
+	outputs[kFMEngineRightOutput] = output;
+
+	return true;
+}
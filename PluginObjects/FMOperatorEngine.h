@@ -0,0 +1,239 @@
+#pragma once
+
+#include "synthfunctions.h"
+#include "synthobjects.h"
+
+// --- LIMITS (always at top)
+//
+// --- operators per engine
+const uint32_t kNumFMOperators = 4;
+
+// --- a modulator at full level shifts its target's phase by this many radians (Chowning IMAX = 4, as kSynthOsc_FM_PM_ModIndex)
+const double kFMEngine_MaxModIndex = 4.0;
+
+// --- operator 4 feedback at full, in radians; above about 1.5 the feedback saw turns to noise
+const double kFMEngine_MaxFeedback = 1.5;
+
+// --- modulation ranges
+const double kFMEngine_Pitch_ModRange = 12.0;		// --> +/- 12 semitones, as kSynthOsc_Pitch_ModRange
+
+// --- samples between updates until the first update interval has been measured
+const uint32_t kFMEngineDefaultUpdateInterval = 64;
+
+// --- an operator EG below this level (-80dB) has finished its release
+const double kFMOperatorEGOffLevel = 0.0001;
+
+// --- operator bits for the algorithm routings: bit n-1 = operator n
+const uint32_t kFMOp1 = 0x1;
+const uint32_t kFMOp2 = 0x2;
+const uint32_t kFMOp3 = 0x4;
+const uint32_t kFMOp4 = 0x8;
+
+// --- outputs[] indexes for this component
+enum {
+	kFMEngineLeftOutput,
+	kFMEngineRightOutput,
+	kNumFMEngineOutputs
+};
+
+// --- modulator indexes for this component
+enum {
+	kFMEnginePitchMod,
+	kFMEnginePortamentoMod,
+	kNumFMEngineModulators
+};
+
+/**
+	\enum fmEngineAlgorithm
+	\ingroup SynthStructures
+	\brief The eight 4-operator algorithms of the DX21/TX81Z; "a>b" means operator a modulates operator b, operator 4 always has
+	feedback and the carriers are summed:
+	- kAlgorithm1: 4>3>2>1
+	- kAlgorithm2: (3 + 4)>2>1
+	- kAlgorithm3: 3>2>1 and 4>1
+	- kAlgorithm4: 4>3>1 and 2>1
+	- kAlgorithm5: 4>3 and 2>1; carriers 1 and 3
+	- kAlgorithm6: 4>1, 4>2 and 4>3; carriers 1, 2 and 3
+	- kAlgorithm7: 4>3; carriers 1, 2 and 3
+	- kAlgorithm8: no modulation; all four operators are carriers
+*/
+enum class fmEngineAlgorithm { kAlgorithm1, kAlgorithm2, kAlgorithm3, kAlgorithm4, kAlgorithm5, kAlgorithm6, kAlgorithm7, kAlgorithm8, kNumAlgorithms };
+
+// --- operator EG stages
+enum class fmOperatorEGState { kOff, kAttack, kDecaySustain, kRelease };
+
+/**
+	\struct FMOperatorModifiers
+	\ingroup SynthStructures
+	\brief Contains modifiers for one operator of the FMOperatorEngine
+
+	\param ratio:				operator frequency as a ratio of the note frequency
+	\param detune_cents:		operator detuning in cents
+	\param outputLevel:			[0, +1]; the output level of a carrier or the modulation index (over kFMEngine_MaxModIndex) of a modulator
+	\param attackTime_mSec:		operator EG attack time (linear)
+	\param decayTime_mSec:		operator EG decay time to -60dB from the peak (exponential)
+	\param sustainLevel:		operator EG sustain level [0, +1]
+	\param releaseTime_mSec:	operator EG release time to -60dB (exponential)
+*/
+struct FMOperatorModifiers
+{
+	FMOperatorModifiers() {}
+
+	double ratio = 1.0;
+	double detune_cents = 0.0;
+	double outputLevel = 1.0;
+	double attackTime_mSec = 5.0;
+	double decayTime_mSec = 1000.0;
+	double sustainLevel = 0.7;
+	double releaseTime_mSec = 500.0;
+};
+
+/**
+	\struct FMEngineModifiers
+	\ingroup SynthStructures
+	\brief Contains modifiers for the FMOperatorEngine component
+
+	\param algorithm:					operator routing; see fmEngineAlgorithm
+	\param feedback:					operator 4 feedback [0, +1]; 1 = kFMEngine_MaxFeedback
+	\param fmAmpControl_dB:				output level in dB; -96dB turns the engine off
+	\param masterTuningRatio:			master tuning control using a ratio
+	\param masterTuningOffset_cents:	master tuning control using a pitch offset in cents
+	\param operators:					the operator modifiers; operators[0] is operator 1
+	\param modulationControls:			intensity and range controls for each modulator object
+*/
+struct FMEngineModifiers
+{
+	FMEngineModifiers()
+	{
+		// --- a useful default: operator 1 is the carrier of every algorithm, the modulators start at a moderate index
+		for (uint32_t i = 1; i < kNumFMOperators; i++)
+			operators[i].outputLevel = 0.5;
+	}
+
+	fmEngineAlgorithm algorithm = fmEngineAlgorithm::kAlgorithm1;
+	double feedback = 0.0;
+	double fmAmpControl_dB = -96.0;
+	double masterTuningRatio = 1.0;
+	double masterTuningOffset_cents = 0.0;
+
+	FMOperatorModifiers operators[kNumFMOperators];
+
+	// --- modulator controls
+	ModulatorControl modulationControls[kNumFMEngineModulators];
+};
+
+/**
+	\class FMOperatorEngine
+	\ingroup SynthClasses
+	\brief A 4-operator FM (phase modulation) engine: sine operators (see polynomialSine( )) with their own EGs, feedback on
+	operator 4 and the eight DX21/TX81Z algorithms.
+
+	Each algorithm is a template instantiation of renderAlgorithm( ) with its routing as template arguments, so the
+	compiler resolves every routing test; updateComponent( ) points renderKernel at the instantiation for the selected
+	algorithm. The only per-sample work is the kernel itself: no modulators run between updates, and the operator EGs
+	are calculated on updates and ramped linearly across the update interval.
+
+	Outputs: contains 2 outputs
+	- Left Output with the user-controlled gain (in dB) applied
+	- Right Output with the user-controlled gain (in dB) applied
+
+	Control I/F:
+	Use FMEngineModifiers structure
+
+	- kFMEnginePitchMod:		[-1, +1] pitch modulation (update rate)
+	- kFMEnginePortamentoMod:	[-1, +1] for glide (portamento) effect
+*/
+class FMOperatorEngine : public ISynthComponent
+{
+public:
+	FMOperatorEngine(std::shared_ptr<FMEngineModifiers> _modifiers, IMIDIData* _midiData, uint32_t numOutputs, uint32_t numModulators);
+	virtual ~FMOperatorEngine();
+
+	// --- ISynthComponent
+	virtual bool initializeComponent(InitializeInfo& info);
+	virtual bool startComponent();
+	virtual bool stopComponent();
+	virtual bool resetComponent();
+	virtual bool validateComponent();
+	virtual bool isComponentRunning() { return noteOn || operatorsRunning(); }
+	ModulatorControl* getModulatorControls(uint32_t modulatorIndex) { return &modifiers->modulationControls[modulatorIndex]; }
+
+	// --- note event handlers
+	virtual bool doNoteOn(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity);
+	virtual bool doNoteOff(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity);
+
+	// --- update and render methods
+	virtual bool updateComponent();
+	virtual bool renderComponent(bool update);
+
+	// --- modifier getter
+	std::shared_ptr<FMEngineModifiers> getModifiers() { return modifiers; }
+
+protected:
+	// --- one output sample of an algorithm; the template arguments are the operator bits (kFMOp1...) of the
+	//     modulators of operators 3, 2 and 1 and of the carriers; operator 4 is modulated by its feedback only
+	template <uint32_t ModulatorsOf3, uint32_t ModulatorsOf2, uint32_t ModulatorsOf1, uint32_t Carriers>
+	double renderAlgorithm();
+
+	// --- the selected algorithm
+	typedef double (FMOperatorEngine::*RenderKernel)();
+	RenderKernel renderKernel = nullptr;			///< renderAlgorithm( ) instantiation for the current algorithm
+	fmEngineAlgorithm algorithm = fmEngineAlgorithm::kNumAlgorithms;	///< algorithm that renderKernel was selected for
+
+	// --- one sample of one operator: sine at phase + phaseModulation (in cycles), scaled by the EG'd level
+	inline double doOperator(uint32_t op, double phaseModulation)
+	{
+		double phase = operatorPhase[op] + phaseModulation;
+		phase -= (double)(int64_t)phase;
+		phase += phase < 0.0 ? 1.0 : 0.0;
+
+		double output = operatorLevel[op] * polynomialSine(phase);
+
+		// --- timebase and EG ramp
+		double nextPhase = operatorPhase[op] + operatorPhaseInc[op];
+		operatorPhase[op] = nextPhase >= 1.0 ? nextPhase - 1.0 : nextPhase;
+		operatorLevel[op] += operatorLevelInc[op];
+
+		return output;
+	}
+
+	// --- operator EGs
+	void updateOperatorEG(uint32_t op, double elapsed_mSec);
+	bool operatorsRunning();
+
+	// --- sample rate
+	double sampleRate = 0.0;				///< sample rate
+
+	// --- the midi pitch, will need to save for portamento
+	double midiNotePitch = 0.0;				///< the midi pitch
+
+	// --- operators, one array entry per operator (operatorPhase[0] is operator 1)
+	double operatorPhase[kNumFMOperators] = { 0.0 };		///< modulo counters [0, 1)
+	double operatorPhaseInc[kNumFMOperators] = { 0.0 };		///< phase inc = fo/fs
+	double operatorLevel[kNumFMOperators] = { 0.0 };		///< current level, including the EG
+	double operatorLevelInc[kNumFMOperators] = { 0.0 };		///< per-sample ramp to the level at the next update
+
+	// --- operator EGs, calculated on updates
+	fmOperatorEGState egState[kNumFMOperators] = { fmOperatorEGState::kOff };	///< EG stage
+	double egLevel[kNumFMOperators] = { 0.0 };				///< EG output [0, +1]
+
+	// --- feedback: operator 4 is modulated by the average of its last two outputs (as on the DX7) to tame its hunting
+	double feedbackHistory[2] = { 0.0 };					///< last two outputs of operator 4
+	double feedbackScale = 0.0;								///< feedback amount in cycles per unit of summed history
+
+	// --- modulation index in cycles per unit of modulator output
+	double modulationScale = kFMEngine_MaxModIndex / (2.0*pi);
+
+	// --- output gain from fmAmpControl_dB
+	double outputGain = 0.0;
+
+	// --- update interval, measured in rendered samples
+	uint32_t updateInterval = kFMEngineDefaultUpdateInterval;	///< samples between the last two updates
+	uint32_t samplesSinceUpdate = 0;							///< samples rendered since the last update
+
+	// --- flag indicating state (running or not)
+	bool noteOn = false;
+
+	// --- our modifiers
+	std::shared_ptr<FMEngineModifiers> modifiers = nullptr;
+};
@@ -0,0 +1,237 @@
+#include "FXChain.h"
+
+#include <string.h>
+
+/**
+	\brief Set the crossfade length for enabling and bypassing slots
+	\param sampleRate -- the sample rate
+*/
+void FXChain::setSampleRate(double sampleRate)
+{
+	crossfadeSamples = (uint32_t)(kFXChainCrossfade_mSec*sampleRate / 1000.0);
+}
+
+/**
+	\brief Add a processor to the end of the chain; the chain takes over its bypass
+	\param processor -- the processor, which must outlive the chain (or be removed first)
+	\param bypass -- initial bypass state; there is no crossfade for the initial state
+	\param profileZone -- SynthProfiler zone for the slot (only used in profiling builds)
+	\return the new slot index, or -1 if the chain is full
+*/
+int FXChain::addProcessor(ISynthAudioProcessor* processor, bool bypass, uint32_t profileZone)
+{
+	if (!processor || numSlots >= kMaxFXChainSlots)
+		return -1;
+
+	FXChainSlot& slot = slots[numSlots];
+	slot.processor = processor;
+	slot.bypass = bypass;
+	slot.mix.snap(bypass ? 0.0 : 1.0);
+	slot.forceUpdate = true;
+	slot.profileZone = profileZone;
+
+	processor->setOwnerBypass(true);
+
+	return (int)numSlots++;
+}
+
+/**
+	\brief Remove a slot; the processor gets its own bypass back and the following slots move up
+	\param slot -- the slot index
+	\return true if the slot was removed
+*/
+bool FXChain::removeSlot(uint32_t slot)
+{
+	if (slot >= numSlots)
+		return false;
+
+	slots[slot].processor->setOwnerBypass(false);
+
+	for (uint32_t i = slot; i < numSlots - 1; i++)
+		slots[i] = slots[i + 1];
+
+	slots[--numSlots] = FXChainSlot();
+	return true;
+}
+
+/**
+	\brief Move a slot to a new position; the slots in between shift by one
+	\param fromSlot -- index of the slot to move
+	\param toSlot -- its new index
+	\return true if the slot was moved
+*/
+bool FXChain::moveSlot(uint32_t fromSlot, uint32_t toSlot)
+{
+	if (fromSlot >= numSlots || toSlot >= numSlots)
+		return false;
+
+	FXChainSlot moving = slots[fromSlot];
+
+	if (fromSlot < toSlot)
+	{
+		for (uint32_t i = fromSlot; i < toSlot; i++)
+			slots[i] = slots[i + 1];
+	}
+	else
+	{
+		for (uint32_t i = fromSlot; i > toSlot; i--)
+			slots[i] = slots[i - 1];
+	}
+
+	slots[toSlot] = moving;
+	return true;
+}
+
+/**
+	\brief Find the slot that holds a processor
+	\param processor -- the processor
+	\return the slot index, or -1 if the processor is not in the chain
+*/
+int FXChain::getSlotIndex(ISynthAudioProcessor* processor)
+{
+	for (uint32_t i = 0; i < numSlots; i++)
+	{
+		if (slots[i].processor == processor)
+			return (int)i;
+	}
+	return -1;
+}
+
+/**
+	\brief Bypass or enable a slot with a crossfade; enabling an idle slot resets its processor first
+	\param slot -- the slot index
+	\param bypass -- true to bypass the slot
+	\return true if the slot exists
+*/
+bool FXChain::setBypass(uint32_t slot, bool bypass)
+{
+	if (slot >= numSlots)
+		return false;
+
+	FXChainSlot& fxSlot = slots[slot];
+	if (fxSlot.bypass == bypass)
+		return true;
+
+	// --- coming back from idle: flush the old tail and pick up the current modifiers
+	if (!bypass && fxSlot.isIdle())
+	{
+		fxSlot.processor->resetComponent();
+		fxSlot.forceUpdate = true;
+	}
+
+	fxSlot.bypass = bypass;
+	fxSlot.mix.setTarget(bypass ? 0.0 : 1.0, crossfadeSamples);
+
+	return true;
+}
+
+/**
+	\brief Bypass or enable the slot that holds a processor
+	\param processor -- the processor
+	\param bypass -- true to bypass the slot
+	\return true if the processor is in the chain
+*/
+bool FXChain::setBypass(ISynthAudioProcessor* processor, bool bypass)
+{
+	int slot = getSlotIndex(processor);
+	if (slot < 0)
+		return false;
+
+	return setBypass((uint32_t)slot, bypass);
+}
+
+/**
+	\brief Jump to the end of all crossfades so that every slot is either idle or fully enabled
+*/
+void FXChain::finishCrossfades()
+{
+	for (uint32_t i = 0; i < numSlots; i++)
+		slots[i].mix.snap(slots[i].mix.target);
+}
+
+/**
+	\brief Process a stereo (or mono, with a nullptr right buffer) block in place through all slots, in order. Idle slots
+	are skipped, fully enabled slots process the buffers directly and crossfading slots are processed in chunks of
+	kFXChainBlockSize against a dry copy.
+
+	\param leftBuffer -- left (or mono) channel buffer
+	\param rightBuffer -- right channel buffer; nullptr for mono -> mono
+	\param blockSize -- number of samples in the buffers
+	\param update -- a flag that is used to update the processors
+
+	\return true if handled, false if not handled
+*/
+bool FXChain::processAudioBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize, bool update)
+{
+	if (!leftBuffer || blockSize == 0)
+		return false;
+
+	for (uint32_t i = 0; i < numSlots; i++)
+	{
+		FXChainSlot& slot = slots[i];
+
+		// --- bypassed: zero cost
+		if (slot.isIdle())
+			continue;
+
+		bool updateSlot = update || slot.forceUpdate;
+		slot.forceUpdate = false;
+
+		SYNTH_PROFILE_SCOPE(slot.profileZone);
+
+		// --- fully enabled: in place, no copies
+		if (slot.mix.samplesRemaining == 0)
+		{
+			if (!slot.processor->processAudioBlock(leftBuffer, rightBuffer, blockSize, updateSlot))
+				return false;
+			continue;
+		}
+
+		// --- crossfading
+		uint32_t offset = 0;
+		while (offset < blockSize)
+		{
+			uint32_t count = blockSize - offset;
+			if (count > kFXChainBlockSize)
+				count = kFXChainBlockSize;
+
+			if (!processCrossfade(slot, &leftBuffer[offset], rightBuffer ? &rightBuffer[offset] : nullptr, count, updateSlot))
+				return false;
+
+			offset += count;
+		}
+	}
+
+	return true;
+}
+
+/**
+	\brief Process one chunk through a crossfading slot: keep a dry copy, process in place, then mix with the ramp
+
+	\param slot -- the slot
+	\param leftBuffer -- left (or mono) channel buffer
+	\param rightBuffer -- right channel buffer; nullptr for mono -> mono
+	\param blockSize -- number of samples; at most kFXChainBlockSize
+	\param update -- a flag that is used to update the processor
+
+	\return true if handled, false if not handled
+*/
+bool FXChain::processCrossfade(FXChainSlot& slot, double* leftBuffer, double* rightBuffer, uint32_t blockSize, bool update)
+{
+	memcpy(dryLeft, leftBuffer, blockSize * sizeof(double));
+	if (rightBuffer)
+		memcpy(dryRight, rightBuffer, blockSize * sizeof(double));
+
+	if (!slot.processor->processAudioBlock(leftBuffer, rightBuffer, blockSize, update))
+		return false;
+
+	for (uint32_t i = 0; i < blockSize; i++)
+	{
+		double mix = slot.mix.getNextValue();
+		leftBuffer[i] = dryLeft[i] + mix*(leftBuffer[i] - dryLeft[i]);
+		if (rightBuffer)
+			rightBuffer[i] = dryRight[i] + mix*(rightBuffer[i] - dryRight[i]);
+	}
+
+	return true;
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "synthfunctions.h"
+#include "synthobjects.h"
+#include "SynthProfiler.h"
+
+// --- LIMITS (always at top)
+//
+// --- number of processor slots
+const uint32_t kMaxFXChainSlots = 8;
+
+// --- the chain is processed in chunks of this size; the crossfade scratch buffers hold one chunk
+const uint32_t kFXChainBlockSize = 64;
+
+// --- length of the crossfade when a slot is enabled or bypassed
+const double kFXChainCrossfade_mSec = 20.0;
+
+/**
+	\struct FXChainSlot
+	\ingroup SynthStructures
+	\brief One slot of an FXChain: the processor and its bypass state.
+
+	\param processor:	the processor; not owned by the chain
+	\param bypass:		the slot's bypass switch
+	\param mix:			crossfade gain, 0 = dry (bypassed) to 1 = fully processed
+	\param forceUpdate:	update the processor on its next block (set when it is enabled)
+	\param profileZone:	SynthProfiler zone the slot's processing is counted in
+*/
+struct FXChainSlot
+{
+	FXChainSlot() {}
+
+	ISynthAudioProcessor* processor = nullptr;
+	bool bypass = true;
+	GainRamp mix;
+	bool forceUpdate = false;
+	uint32_t profileZone = kProfileMasterFX;
+
+	/** true if the slot is bypassed and the crossfade is done; the processor is not called at all */
+	bool isIdle() { return bypass && mix.samplesRemaining == 0; }
+};
+
+/**
+	\class FXChain
+	\ingroup SynthClasses
+	\brief An ordered array of ISynthAudioProcessor slots that are processed in place, one after the other, one block at a time.
+	Slots can be added, removed, reordered and bypassed; the chain does not own the processors.
+
+	Bypass:
+	- an idle (bypassed) slot costs nothing: its processor is not called
+	- enabling a slot resets its processor (no stale tail from the last time it ran) and crossfades from the dry signal to
+	  the processed signal over kFXChainCrossfade_mSec; bypassing crossfades back and then goes idle
+	- while the slot is fully enabled the processor works directly on the chain buffers with no extra copies
+
+	The chain takes over the bypass of its processors with ISynthAudioProcessor::setOwnerBypass( ), so the processors keep
+	running during the fade out; the owner maps its enable switches to setBypass( ). Reordering is immediate and is meant
+	for patch changes, not for automation.
+*/
+class FXChain
+{
+public:
+	FXChain() {}
+	virtual ~FXChain() {}
+
+	// --- set the crossfade length from the sample rate
+	void setSampleRate(double sampleRate);
+
+	// --- slot management; these are cheap and allocation free
+	int addProcessor(ISynthAudioProcessor* processor, bool bypass = true, uint32_t profileZone = kProfileMasterFX);
+	bool removeSlot(uint32_t slot);
+	bool moveSlot(uint32_t fromSlot, uint32_t toSlot);
+	int getSlotIndex(ISynthAudioProcessor* processor);
+
+	// --- bypass with crossfade
+	bool setBypass(uint32_t slot, bool bypass);
+	bool setBypass(ISynthAudioProcessor* processor, bool bypass);
+
+	// --- jump to the end of all crossfades; use after a reset or patch load
+	void finishCrossfades();
+
+	/** true if the slot's bypass switch is on */
+	bool getBypass(uint32_t slot) { return slot < numSlots ? slots[slot].bypass : true; }
+
+	/** number of slots in use */
+	uint32_t getNumSlots() { return numSlots; }
+
+	/** processor in a slot, or nullptr */
+	ISynthAudioProcessor* getProcessor(uint32_t slot) { return slot < numSlots ? slots[slot].processor : nullptr; }
+
+	// --- process a stereo (or mono, with a nullptr right buffer) block in place
+	bool processAudioBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize, bool update);
+
+protected:
+	// --- process one slot while it crossfades; at most kFXChainBlockSize samples
+	bool processCrossfade(FXChainSlot& slot, double* leftBuffer, double* rightBuffer, uint32_t blockSize, bool update);
+
+	FXChainSlot slots[kMaxFXChainSlots];		///< the slots, in processing order
+	uint32_t numSlots = 0;						///< number of slots in use
+	uint32_t crossfadeSamples = 882;			///< crossfade length in samples
+
+	// --- dry copies for the crossfades
+	double dryLeft[kFXChainBlockSize] = { 0.0 };	///< dry left (or mono) input of the slot
+	double dryRight[kFXChainBlockSize] = { 0.0 };	///< dry right input of the slot
+};
+
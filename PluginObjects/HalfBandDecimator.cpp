@@ -0,0 +1,65 @@
+#include "HalfBandDecimator.h"
+
+/**
+	\brief Zeroth order modified Bessel function of the first kind, for the Kaiser window
+	\param x -- the argument
+	\return I0(x)
+*/
+static double besselI0(double x)
+{
+	double sum = 1.0;
+	double term = 1.0;
+	for (uint32_t k = 1; k < 50; k++)
+	{
+		term *= (x / (2.0*k))*(x / (2.0*k));
+		sum += term;
+		if (term < 1.0e-12*sum)
+			break;
+	}
+	return sum;
+}
+
+/**
+	\brief Design the half-band filter: a Kaiser windowed sinc with its cutoff at a quarter of the input rate, normalized
+	for unity gain at DC; clears the history
+
+	\param _numPairs -- coefficient pairs [1, kMaxHalfBandPairs]; the filter has (4*_numPairs - 1) taps
+	\param kaiserBeta -- Kaiser window beta; higher for more stopband attenuation and a wider transition band
+*/
+void HalfBandDecimator::design(uint32_t _numPairs, double kaiserBeta)
+{
+	numPairs = _numPairs;
+	if (numPairs < 1) numPairs = 1;
+	if (numPairs > kMaxHalfBandPairs) numPairs = kMaxHalfBandPairs;
+	numEvenTaps = 2 * numPairs;
+
+	// --- the outermost taps are (2*numPairs - 1) away from the center
+	double halfLength = 2.0*numPairs - 1.0;
+	double windowNorm = 1.0 / besselI0(kaiserBeta);
+
+	double pairSum = 0.0;
+	for (uint32_t k = 0; k < numPairs; k++)
+	{
+		// --- tap at an odd distance d from the center: 0.5*sinc(d/2)
+		double d = 2.0*k + 1.0;
+		double tap = sin(pi*d / 2.0) / (pi*d);
+
+		double r = d / halfLength;
+		tap *= besselI0(kaiserBeta*sqrt(fmax(0.0, 1.0 - r*r)))*windowNorm;
+
+		// --- the even branch window runs oldest to newest, so pair k sits on both sides of the middle
+		coefficients[numPairs + k] = tap;
+		coefficients[numPairs - 1 - k] = tap;
+		pairSum += tap;
+	}
+
+	// --- DC gain: 0.5 (center) + 2*pairSum = 1
+	if (pairSum != 0.0)
+	{
+		double scale = 0.25 / pairSum;
+		for (uint32_t i = 0; i < numEvenTaps; i++)
+			coefficients[i] *= scale;
+	}
+
+	reset();
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "synthfunctions.h"
+#include "synthobjects.h"
+
+// --- LIMITS (always at top)
+//
+// --- coefficient pairs per stage; a stage with N pairs is a (4N - 1) tap half-band FIR
+const uint32_t kMaxHalfBandPairs = 32;
+
+// --- 2x -> 1x: narrow transition band around fs/4 so the audio band is kept, about 80dB stopband
+const uint32_t kHalfBandPairs2x = 28;
+
+// --- 4x -> 2x: everything above the audio band is removed later, so the transition band is wide and the filter short
+const uint32_t kHalfBandPairs4x = 6;
+
+// --- Kaiser window beta for the coefficient design
+const double kHalfBandKaiserBeta = 8.0;
+
+// --- oversampling modes for the voice audio path
+enum class oversamplingMode { k1x, k2x, k4x };
+
+/** convert an oversampling mode to its rate multiplier */
+inline uint32_t getOversamplingFactor(oversamplingMode mode)
+{
+	if (mode == oversamplingMode::k4x) return 4;
+	if (mode == oversamplingMode::k2x) return 2;
+	return 1;
+}
+
+/**
+	\class HalfBandDecimator
+	\ingroup SynthClasses
+	\brief A polyphase half-band FIR that decimates by two. Every other tap of a half-band filter is zero apart from the
+	center tap (0.5), so the odd input samples only need a delay to the center and the even input samples go through a
+	symmetric FIR at the output rate: one multiply-add per tap pair side, per output sample.
+
+	The even branch history is kept twice in a row (the doubled buffer trick), so the FIR is a plain dot product over a
+	contiguous array that the compiler can vectorize; there is no wrap logic inside the loop. The coefficients are designed
+	once in design( ) with a Kaiser windowed sinc and all storage is fixed size, so there are no allocations.
+
+	Latency: (4N - 2)/2 input samples, or (2N - 1)/2 output samples for N pairs.
+*/
+class HalfBandDecimator
+{
+public:
+	HalfBandDecimator() {}
+
+	// --- design the filter and clear the history
+	void design(uint32_t _numPairs, double kaiserBeta = kHalfBandKaiserBeta);
+
+	/** clear the history */
+	void reset()
+	{
+		memset(evenHistory, 0, sizeof(evenHistory));
+		memset(oddHistory, 0, sizeof(oddHistory));
+		evenIndex = 0;
+		oddIndex = 0;
+	}
+
+	/** decimate two input samples, x0 first, to one output sample */
+	inline double decimate(double x0, double x1)
+	{
+		// --- odd branch: the center tap, (numPairs - 1) output samples ago
+		oddHistory[oddIndex] = x0;
+		if (++oddIndex == numPairs) oddIndex = 0;
+		double center = oddHistory[oddIndex];
+
+		// --- even branch: write twice so the window is contiguous, oldest to newest
+		evenHistory[evenIndex] = x1;
+		evenHistory[evenIndex + numEvenTaps] = x1;
+		if (++evenIndex == numEvenTaps) evenIndex = 0;
+
+		const double* window = &evenHistory[evenIndex];
+		double sum = 0.0;
+		for (uint32_t i = 0; i < numEvenTaps; i++)
+			sum += coefficients[i] * window[i];
+
+		return 0.5*center + sum;
+	}
+
+	/** decimate 2*outputCount input samples; output may be the same buffer as input */
+	void decimateBlock(const double* input, double* output, uint32_t outputCount)
+	{
+		for (uint32_t i = 0; i < outputCount; i++)
+			output[i] = decimate(input[2 * i], input[2 * i + 1]);
+	}
+
+	/** latency in output samples */
+	double getLatency() { return (2.0*numPairs - 1.0) / 2.0; }
+
+protected:
+	uint32_t numPairs = 1;			///< coefficient pairs
+	uint32_t numEvenTaps = 2;		///< even branch length, 2*numPairs
+
+	double coefficients[2 * kMaxHalfBandPairs] = { 0.0 };		///< even branch taps, oldest to newest (symmetric)
+	double evenHistory[4 * kMaxHalfBandPairs] = { 0.0 };		///< even branch history, stored twice
+	double oddHistory[kMaxHalfBandPairs] = { 0.0 };				///< odd branch delay to the center tap
+	uint32_t evenIndex = 0;			///< even branch write index
+	uint32_t oddIndex = 0;			///< odd branch write index
+};
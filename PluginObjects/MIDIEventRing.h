@@ -0,0 +1,75 @@
+#pragma once
+#include "pluginstructures.h"
+
+#include <atomic>
+
+// --- LIMITS (always at top)
+//
+// --- ring capacity; must be a power of two
+const uint32_t kMIDIEventRingSize = 1024;
+
+/**
+	\class MIDIEventRing
+	\ingroup SynthClasses
+	\brief A fixed capacity, lock-free, single-producer/single-consumer FIFO of midiEvent structures. All storage is
+	preallocated in the object so that neither side ever allocates; when the ring is full the new event is dropped and
+	pushEvent( ) returns false.
+
+	Thread safety:
+	- exactly one thread may call pushEvent( )
+	- exactly one thread may call peekEvent( ), popEvent( ) and clear( ); this may be the same thread as the producer
+*/
+class MIDIEventRing
+{
+public:
+	MIDIEventRing() {}
+
+	/** producer: add an event to the back of the ring; returns false if the ring is full */
+	bool pushEvent(const midiEvent& event)
+	{
+		uint32_t write = writeIndex.load(std::memory_order_relaxed);
+		uint32_t read = readIndex.load(std::memory_order_acquire);
+
+		if (write - read >= kMIDIEventRingSize)
+			return false; // full
+
+		events[write & kMask] = event;
+		writeIndex.store(write + 1, std::memory_order_release);
+		return true;
+	}
+
+	/** consumer: get a pointer to the event at the front of the ring without removing it; nullptr if empty */
+	const midiEvent* peekEvent()
+	{
+		uint32_t read = readIndex.load(std::memory_order_relaxed);
+		if (read == writeIndex.load(std::memory_order_acquire))
+			return nullptr; // empty
+
+		return &events[read & kMask];
+	}
+
+	/** consumer: remove the event at the front of the ring; call after peekEvent( ) returned non-null */
+	void popEvent()
+	{
+		readIndex.store(readIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	/** consumer: discard all pending events */
+	void clear()
+	{
+		readIndex.store(writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+	}
+
+	/** number of events waiting; exact on the consumer side, a snapshot on the producer side */
+	uint32_t getEventCount()
+	{
+		return writeIndex.load(std::memory_order_acquire) - readIndex.load(std::memory_order_acquire);
+	}
+
+protected:
+	static const uint32_t kMask = kMIDIEventRingSize - 1;
+
+	midiEvent events[kMIDIEventRingSize];		///< preallocated event storage
+	std::atomic<uint32_t> writeIndex{ 0 };		///< free running; only written by producer
+	std::atomic<uint32_t> readIndex{ 0 };		///< free running; only written by consumer
+};
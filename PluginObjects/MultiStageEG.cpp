@@ -0,0 +1,426 @@
+#include "MultiStageEG.h"
+
+#include <string.h>
+
+/**
+	\brief Object constructor specialized to properly and safely share the modifiers and MIDI data
+	\param _modifiers -- the GUI modifiers structure for this component, to be shared with all similar components
+	\param _midiData -- global MIDI data interface, shared across all ISynthComponents
+	\param numOutputs -- the number of outputs for this component
+	\param numModulators -- the number of modulators for this component
+*/
+MultiStageEG::MultiStageEG(std::shared_ptr<MultiStageEGModifiers> _modifiers, IMIDIData* _midiData, uint32_t numOutputs, uint32_t numModulators)
+: ISynthComponent(_midiData, numOutputs, numModulators)
+, modifiers(_modifiers)
+{
+	if (!modifiers) return;
+
+	// --- set our type id
+	componentType = componentType::kEG;
+
+	// --- validate all pointers
+	validComponent = validateComponent();
+
+	// --- clear
+	clearOutputs();
+}
+
+/** Destructor: delete output array and modulators */
+MultiStageEG::~MultiStageEG()
+{
+	// --- delete our arrays (and modulators) and nullify
+	destroyArrays();
+}
+
+/**
+	\brief Initialize component with sample-rate dependent parameters
+	\param info -- initialization information including sample rate
+	\return true if handled, false if not handled
+*/
+bool MultiStageEG::initializeComponent(InitializeInfo& info)
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- the segment table is fs based
+	if (info.sampleRate != sampleRate)
+	{
+		sampleRate = info.sampleRate;
+		calculateSegments();
+	}
+
+	return true;
+}
+
+/**
+	\brief Perform startup operations for the component: go to the first segment
+	\return true if handled, false if not handled
+*/
+bool MultiStageEG::startComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	noteOn = true;
+
+	if (segmentSettings.resetToZero)
+		envelopeOutput = 0.0;
+
+	startSegment(0);
+
+	return true;
+}
+
+/**
+	\brief Perform shut-off operations for the component
+	\return true if handled, false if not handled
+*/
+bool MultiStageEG::stopComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- clear output and go to OFF state
+	envelopeOutput = 0.0;
+	outputs[kMSEGNormalOutput] = 0.0;
+	state = msegState::kOff;
+	segment = -1;
+	noteOn = false;
+
+	return true;
+}
+
+/**
+	\brief Reset the component to a note-off state
+	\return true if handled, false if not handled
+*/
+bool MultiStageEG::resetComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- clear the outputs
+	clearOutputs();
+
+	state = msegState::kOff;
+	segment = -1;
+	samplesRemaining = 0;
+	noteOn = false;
+
+	if (segmentSettings.resetToZero)
+		envelopeOutput = 0.0;
+
+	return true;
+}
+
+/**
+	\brief Validate all shared pointers, dynamically declared objects (including modulators) and the output array;
+	this function should be called once during construction to set the validComponent flag, which is used for future component validation.
+	\return true if handled, false if not handled
+*/
+bool MultiStageEG::validateComponent()
+{
+	// --- shared pointers and modifiers
+	if (modifiers && midiData)
+	{
+		// --- test for outputs
+		for (unsigned int i = 0; i < numOutputs; i++)
+		{
+			if (!getOutputPtr(i))
+				return false;
+		}
+		return true;
+	}
+	return false;
+}
+
+/**
+	\brief Perform note-on operations for the component
+	\return true if handled, false if not handled
+*/
+bool MultiStageEG::doNoteOn(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity)
+{
+	return startComponent();
+}
+
+/**
+	\brief Perform note-off operations for the component; leave the hold point or the loop and run the release segments
+	(the segments after the sustain breakpoint) from the current level
+	\return true if handled, false if not handled
+*/
+bool MultiStageEG::doNoteOff(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity)
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	noteOn = false;
+
+	// --- one-shot envelopes just keep running
+	if (segmentSettings.sustainBreakpoint < 0)
+		return true;
+
+	if (state == msegState::kHold || (state == msegState::kSegment && segment <= segmentSettings.sustainBreakpoint))
+		startSegment(segmentSettings.sustainBreakpoint + 1);
+
+	return true;
+}
+
+/**
+	\brief Recalculate the segment table if the modifiers (including the tempo) have changed; a running segment keeps its
+	coefficients and the new table is used from the next segment on
+	\return true if handled, false if not handled
+*/
+bool MultiStageEG::updateComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- fast memory block compare; only rebuild on a change, which includes a tempo change for synced segments
+	if (memcmp(&lastModifiers, modifiers.get(), sizeof(MultiStageEGModifiers)) != 0 ||
+		(modifiers->tempoSync && getTransportBPM() != bpm))
+		calculateSegments();
+
+	return true;
+}
+
+/**
+	\brief Render the component: one multiply-add per sample, the segment counter decides when to move on
+
+	\param update -- a flag that is used to update the component; the voice's granularity timer sets/clears this variable
+
+	\return true if handled, false if not handled
+*/
+bool MultiStageEG::renderComponent(bool update)
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- check update
+	if (update)
+		updateComponent();
+
+	if (state == msegState::kSegment || state == msegState::kShutdown)
+	{
+		envelopeOutput = coeff*envelopeOutput + offset;
+
+		if (--samplesRemaining == 0)
+			finishSegment();
+	}
+
+	outputs[kMSEGNormalOutput] = envelopeOutput;
+
+	return true;
+}
+
+/**
+	\brief Render a block of EG output values; each segment (or the part of it that falls in this block) is rendered in a
+	tight loop with no state or threshold tests. The output is identical to calling renderComponent( ) blockSize times.
+
+	\param egBuffer -- buffer to receive blockSize EG output values
+	\param blockSize -- number of samples to render
+	\param update -- a flag that is used to update the component once at the top of the block
+
+	\return true if handled, false if not handled
+*/
+bool MultiStageEG::renderBlock(double* egBuffer, uint32_t blockSize, bool update)
+{
+	// --- check valid flag
+	if (!validComponent || !egBuffer) return false;
+
+	// --- check update
+	if (update)
+		updateComponent();
+
+	uint32_t sample = 0;
+	while (sample < blockSize)
+	{
+		if (state == msegState::kSegment || state == msegState::kShutdown)
+		{
+			uint32_t count = blockSize - sample;
+			if (count > samplesRemaining)
+				count = samplesRemaining;
+
+			double output = envelopeOutput;
+			for (uint32_t i = 0; i < count; i++)
+			{
+				output = coeff*output + offset;
+				egBuffer[sample++] = output;
+			}
+			envelopeOutput = output;
+			samplesRemaining -= count;
+
+			// --- the last sample of a segment is exactly the breakpoint level
+			if (samplesRemaining == 0)
+			{
+				finishSegment();
+				egBuffer[sample - 1] = envelopeOutput;
+			}
+		}
+		else
+		{
+			// --- off or holding: constant
+			while (sample < blockSize)
+				egBuffer[sample++] = envelopeOutput;
+		}
+	}
+
+	outputs[kMSEGNormalOutput] = envelopeOutput;
+
+	return true;
+}
+
+/**
+	\brief Get the tempo for the synced segments; the host transport wins over the modifier
+	\return the tempo in BPM
+*/
+double MultiStageEG::getTransportBPM()
+{
+	SynthTransport* transport = midiData->getTransport();
+	return transport ? transport->bpm : modifiers->bpm;
+}
+
+/**
+	\brief Perform operations for voice-stealing operation: a short linear ramp to 0.0, then off
+	\return true if handled, false if not handled
+*/
+bool MultiStageEG::shutDownComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	noteOn = false;
+
+	uint32_t samples = (uint32_t)(shutdownTime_mSec*sampleRate / 1000.0);
+	if (samples == 0) samples = 1;
+
+	coeff = 1.0;
+	offset = -envelopeOutput / (double)samples;
+	targetLevel = 0.0;
+	samplesRemaining = samples;
+	state = msegState::kShutdown;
+
+	return true;
+}
+
+/**
+	\brief Snapshot the modifiers and precompute the length, geometric ratio and normalizer of every segment.
+
+	A segment of N samples with curvature c from level y0 to level L is:
+
+	y[n] = y0 + (L - y0)*(1 - k^n)/(1 - k^N), k = exp(-c/N)
+
+	which is the recurrence y[n+1] = k*y[n] + (1 - k)*(y0 + (L - y0)/(1 - k^N)); for c = 0 it is the linear ramp
+	y[n+1] = y[n] + (L - y0)/N
+*/
+void MultiStageEG::calculateSegments()
+{
+	// --- bitwise snapshot so the memcmp( ) in updateComponent( ) sees the same bytes
+	memcpy(&lastModifiers, modifiers.get(), sizeof(MultiStageEGModifiers));
+	segmentSettings = lastModifiers;
+
+	// --- validate our copy
+	if (segmentSettings.numBreakpoints < 1) segmentSettings.numBreakpoints = 1;
+	if (segmentSettings.numBreakpoints > kMaxMSEGBreakpoints) segmentSettings.numBreakpoints = kMaxMSEGBreakpoints;
+
+	if (segmentSettings.sustainBreakpoint >= (int32_t)segmentSettings.numBreakpoints)
+		segmentSettings.sustainBreakpoint = -1;
+
+	if (segmentSettings.loopStart >= segmentSettings.loopEnd ||
+		segmentSettings.loopEnd >= segmentSettings.numBreakpoints ||
+		(segmentSettings.sustainBreakpoint >= 0 && (int32_t)segmentSettings.loopEnd > segmentSettings.sustainBreakpoint))
+		segmentSettings.enableLoop = false;
+
+	bpm = getTransportBPM();
+	double beatLength_mSec = bpm > 0.0 ? 60000.0 / bpm : 500.0;
+
+	for (uint32_t i = 0; i < segmentSettings.numBreakpoints; i++)
+	{
+		MSEGBreakpoint& breakpoint = segmentSettings.breakpoints[i];
+
+		double time_mSec = segmentSettings.tempoSync ? breakpoint.time_beats*beatLength_mSec : breakpoint.time_mSec;
+		double samples = floor(sampleRate*time_mSec / 1000.0 + 0.5);
+
+		// --- a zero-time segment is a jump on the next sample
+		segmentSamples[i] = samples < 1.0 ? 1 : (uint32_t)samples;
+
+		double curvature = breakpoint.curvature;
+		boundValue(curvature, kMinMSEGCurvature, kMaxMSEGCurvature);
+
+		if (curvature == 0.0 || segmentSamples[i] == 1)
+		{
+			segmentRatio[i] = 1.0;
+			segmentNorm[i] = 0.0;
+		}
+		else
+		{
+			segmentRatio[i] = exp(-curvature / (double)segmentSamples[i]);
+			segmentNorm[i] = 1.0 / (1.0 - exp(-curvature));
+		}
+	}
+}
+
+/**
+	\brief Enter a segment: set up the recurrence from the current output to the segment's breakpoint
+	\param newSegment -- the index of the breakpoint to move towards; past the last breakpoint, the EG turns off
+*/
+void MultiStageEG::startSegment(int32_t newSegment)
+{
+	if (newSegment < 0 || newSegment >= (int32_t)segmentSettings.numBreakpoints)
+	{
+		state = msegState::kOff;
+		segment = -1;
+		return;
+	}
+
+	segment = newSegment;
+	targetLevel = segmentSettings.breakpoints[segment].level;
+	samplesRemaining = segmentSamples[segment];
+
+	double delta = targetLevel - envelopeOutput;
+	if (segmentRatio[segment] == 1.0)
+	{
+		// --- linear
+		coeff = 1.0;
+		offset = delta / (double)samplesRemaining;
+	}
+	else
+	{
+		// --- geometric
+		coeff = segmentRatio[segment];
+		offset = (1.0 - coeff)*(envelopeOutput + delta*segmentNorm[segment]);
+	}
+
+	state = msegState::kSegment;
+}
+
+/**
+	\brief Leave a finished segment: snap to the breakpoint level, then loop, hold or move on to the next segment
+*/
+void MultiStageEG::finishSegment()
+{
+	envelopeOutput = targetLevel;
+
+	if (state == msegState::kShutdown)
+	{
+		state = msegState::kOff;
+		segment = -1;
+		return;
+	}
+
+	if (noteOn)
+	{
+		if (segmentSettings.enableLoop && segment == (int32_t)segmentSettings.loopEnd)
+		{
+			startSegment(segmentSettings.loopStart + 1);
+			return;
+		}
+
+		if (segment == segmentSettings.sustainBreakpoint)
+		{
+			state = msegState::kHold;
+			return;
+		}
+	}
+
+	startSegment(segment + 1);
+}
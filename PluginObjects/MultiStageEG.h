@@ -0,0 +1,196 @@
+#pragma once
+
+#include "synthfunctions.h"
+#include "synthobjects.h"
+
+// --- LIMITS (always at top)
+//
+// --- maximum number of breakpoints (segments) in one envelope
+const uint32_t kMaxMSEGBreakpoints = 16;
+
+// --- curvature limits; 0.0 is a linear segment
+const double kMaxMSEGCurvature = 12.0;
+const double kMinMSEGCurvature = -12.0;
+
+// --- outputs[] indexes for this component
+enum {
+	kMSEGNormalOutput,
+	kNumMSEGOutputs };
+
+// --- modulatior indexes for this component
+enum {
+	kNumMSEGModulators };
+
+// --- state of the segment sequencer
+enum class msegState { kOff, kSegment, kHold, kShutdown };
+
+/**
+	\struct MSEGBreakpoint
+	\ingroup SynthStructures
+	\brief One breakpoint of a multi-stage envelope; the segment that ends at this breakpoint ramps from the previous level to this one.
+
+	\param level:			the level to reach at the end of the segment, bipolar [-1, +1]
+	\param time_mSec:		segment duration in mSec (free running mode)
+	\param time_beats:		segment duration in beats (quarter notes) when tempo sync is on
+	\param curvature:		segment shape; 0.0 = linear, > 0 = fast start/slow finish (analog-like), < 0 = slow start/fast finish
+*/
+struct MSEGBreakpoint
+{
+	MSEGBreakpoint() {}
+	MSEGBreakpoint(double _level, double _time_mSec, double _time_beats, double _curvature)
+	: level(_level)
+	, time_mSec(_time_mSec)
+	, time_beats(_time_beats)
+	, curvature(_curvature){}
+
+	double level = 0.0;
+	double time_mSec = 100.0;
+	double time_beats = 1.0;
+	double curvature = 0.0;
+};
+
+/**
+	\struct MultiStageEGModifiers
+	\ingroup SynthStructures
+	\brief Contains modifiers for the multi-stage EG component. A "modifier" is any variable that *may* be connected to a
+	GUI control, however modifiers are not required to be connected to anything and their default values are set in the structure.
+
+	The default breakpoints form a simple ADSR: attack to 1.0, decay to 0.5 and hold (sustain), release to 0.0
+
+	\param numBreakpoints:		number of active breakpoints [1, kMaxMSEGBreakpoints]
+	\param breakpoints:			the breakpoint array
+	\param sustainBreakpoint:	the envelope holds at this breakpoint while the note is held; -1 for one-shot envelopes
+	\param enableLoop:			loop while the note is held
+	\param loopStart:			after finishing the segment into loopEnd, continue with the segment after loopStart
+	\param loopEnd:				the last breakpoint of the loop; must be > loopStart (and <= sustainBreakpoint if there is one)
+	\param tempoSync:			use time_beats and the host tempo instead of time_mSec
+	\param bpm:					tempo for a component without a host transport; the engine's SynthTransport wins
+	\param resetToZero:			start each note from 0.0 rather than the current output
+*/
+struct MultiStageEGModifiers
+{
+	MultiStageEGModifiers()
+	{
+		breakpoints[0] = MSEGBreakpoint(1.0, 10.0, 0.125, 2.0);
+		breakpoints[1] = MSEGBreakpoint(0.5, 250.0, 0.5, 4.0);
+		breakpoints[2] = MSEGBreakpoint(0.0, 500.0, 1.0, 4.0);
+	}
+
+	uint32_t numBreakpoints = 3;
+	MSEGBreakpoint breakpoints[kMaxMSEGBreakpoints];
+	int32_t sustainBreakpoint = 1;
+
+	bool enableLoop = false;
+	uint32_t loopStart = 0;
+	uint32_t loopEnd = 1;
+
+	bool tempoSync = false;
+	double bpm = 120.0;
+
+	bool resetToZero = true;
+};
+
+/**
+	\class MultiStageEG
+	\ingroup SynthClasses
+	\brief Encapsulates a multi-stage, loopable envelope generator with an arbitrary number of breakpoints, per-segment curvature
+	and optional tempo sync.
+
+	Each segment is a geometric (or, for zero curvature, linear) ramp that is generated with the same first order recurrence:
+
+	y[n+1] = coeff*y[n] + offset
+
+	The per-breakpoint sample counts and geometric ratios are precomputed in updateComponent( ) when the modifiers, the sample
+	rate or the tempo change; entering a segment costs a few multiplies and rendering costs one multiply-add and a counter
+	decrement per sample. The endpoint of every segment is exact (the counter, not a threshold test, ends the segment), and
+	renderBlock( ) renders whole segments in a tight loop. Tempo synced segments follow the host transport.
+
+	Outputs: contains 1 output
+	- Normal Output
+
+	Control I/F:
+	Use MultiStageEGModifiers structure
+
+	Modulator indexes:
+	- this component has no modulators
+*/
+class MultiStageEG : public ISynthComponent
+{
+public:
+	// --- NOTE: the only constructor requires modifiers and midi arrays when being shared for global parameters
+	MultiStageEG(std::shared_ptr<MultiStageEGModifiers> _modifiers, IMIDIData* _midiData, uint32_t numOutputs, uint32_t numModulators);
+	virtual ~MultiStageEG();
+
+	// --- ISynthComponent
+	virtual bool initializeComponent(InitializeInfo& info);
+	virtual bool startComponent();
+	virtual bool stopComponent();
+	virtual bool resetComponent();
+	virtual bool validateComponent();
+	virtual bool isComponentRunning() { return state != msegState::kOff; }
+
+	// --- note event handlers
+	virtual bool doNoteOn(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity);
+	virtual bool doNoteOff(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity);
+
+	// --- update and render methods
+	virtual bool updateComponent();
+	virtual bool renderComponent(bool update);
+
+	// --- render a block of EG output values
+	bool renderBlock(double* egBuffer, uint32_t blockSize, bool update);
+
+	// --- for voice stealing
+	virtual bool shutDownComponent();
+
+	// --- modifier getter
+	std::shared_ptr<MultiStageEGModifiers> getModifiers() { return modifiers; }
+
+	// --- accessors - allow owner to get our state
+	msegState getState() { return state; }			///< returns current state of the segment sequencer
+	int32_t getCurrentSegment() { return segment; }	///< returns the index of the breakpoint we are moving towards
+
+protected:
+	// --- precompute the segment table from the modifiers
+	void calculateSegments();
+
+	// --- tempo for the synced segments
+	double getTransportBPM();
+
+	// --- segment sequencing
+	void startSegment(int32_t newSegment);
+	void finishSegment();
+
+	// --- sample rate for time calculations
+	double sampleRate = 0.0;				///< sample rate
+	double bpm = 0.0;						///< tempo of the segment table, from the host transport
+
+	// --- the current output of the EG
+	double envelopeOutput = 0.0;			///< the current envelope output sample
+
+	// --- the running segment
+	msegState state = msegState::kOff;		///< sequencer state
+	int32_t segment = -1;					///< index of the breakpoint we are moving towards
+	uint32_t samplesRemaining = 0;			///< samples left in the running segment
+	double coeff = 1.0;						///< recurrence coefficient for the running segment
+	double offset = 0.0;					///< recurrence offset for the running segment
+	double targetLevel = 0.0;				///< exact level at the end of the running segment
+
+	// --- precomputed segment table
+	uint32_t segmentSamples[kMaxMSEGBreakpoints] = { 0 };	///< segment length in samples
+	double segmentRatio[kMaxMSEGBreakpoints] = { 0.0 };	///< geometric ratio k = exp(-curvature/N); 1.0 for linear
+	double segmentNorm[kMaxMSEGBreakpoints] = { 0.0 };		///< 1/(1 - k^N) for the geometric ramp
+
+	// --- the modifiers the segment table was built from: raw (for change detection) and validated
+	MultiStageEGModifiers lastModifiers;
+	MultiStageEGModifiers segmentSettings;
+
+	// --- note flag; loops and the sustain hold only apply while the note is held
+	bool noteOn = false;
+
+	// --- this is set internally; user normally not allowed to adjust
+	double shutdownTime_mSec = 5.0;			///< short shutdown time when stealing a voice
+
+	// --- our modifiers
+	std::shared_ptr<MultiStageEGModifiers> modifiers = nullptr;
+};
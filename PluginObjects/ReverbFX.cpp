@@ -0,0 +1,451 @@
+#include "ReverbFX.h"
+
+#include <string.h>
+
+/**
+	\brief Object constructor specialized to properly and safely share the modifiers and MIDI data
+	\param _modifiers -- the GUI modifiers structure for this component, to be shared with all similar components
+	\param _midiData -- global MIDI data interface, shared across all ISynthComponents
+	\param numOutputs -- the number of outputs for this component
+	\param numModulators -- the number of modulators for this component
+*/
+ReverbFX::ReverbFX(std::shared_ptr<ReverbFXModifiers> _modifiers, IMIDIData* _midiData, uint32_t numOutputs, uint32_t numModulators)
+: ISynthAudioProcessor(_midiData, numOutputs, numModulators)
+, modifiers(_modifiers)
+{
+	if (!modifiers) return;
+
+	// --- set our type id
+	componentType = componentType::kFXProcessor;
+
+	// --- validate all pointers
+	validComponent = validateComponent();
+}
+
+/** Destructor: delete output array and modulators */
+ReverbFX::~ReverbFX()
+{
+	// --- delete our arrays (and modulators) and nullify
+	destroyArrays();
+}
+
+/**
+	\brief Initialize component with sample-rate dependent parameters
+	\param info -- initialization information including sample rate
+	\return true if handled, false if not handled
+*/
+bool ReverbFX::initializeComponent(InitializeInfo& info)
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- set sample rate first
+	sampleRate = info.sampleRate;
+
+	preDelay.setSampleRate(info.sampleRate);
+	preDelay.init(kMaxReverbPreDelay_mSec*info.sampleRate / 1000.0);
+
+	for (uint32_t i = 0; i < kNumReverbLines; i++)
+	{
+		lines[i].setSampleRate(info.sampleRate);
+		lines[i].init(kMaxReverbLine_mSec*info.sampleRate / 1000.0);
+	}
+
+	// --- force the line lengths and gains to be recalculated
+	lastSize_Pct = -1.0;
+
+	return true;
+}
+
+/**
+	\brief Perform startup operations for the component
+	\return true if handled, false if not handled
+*/
+bool ReverbFX::startComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- save flag
+	noteOn = true;
+
+	// --- no ramps from stale gains
+	snapGains = true;
+
+	return true;
+}
+
+/**
+	\brief Perform shut-off operations for the component
+	\return true if handled, false if not handled
+*/
+bool ReverbFX::stopComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- clear flag
+	noteOn = false;
+
+	return true;
+}
+
+/**
+	\brief Reset the component to a note-off state
+	\return true if handled, false if not handled
+*/
+bool ReverbFX::resetComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- clear the outputs
+	clearOutputs();
+
+	// --- flush buffers
+	preDelay.resetDelay();
+	for (uint32_t i = 0; i < kNumReverbLines; i++)
+	{
+		lines[i].resetDelay();
+		dampingState[i] = 0.0;
+	}
+
+	// --- restart the LFO
+	modCounter = 0.0;
+
+	// --- no ramps from stale gains
+	snapGains = true;
+
+	return true;
+}
+
+/**
+	\brief Validate all shared pointers, dynamically declared objects (including modulators) and the output array;
+	this function should be called once during construction to set the validComponent flag, which is used for future component validation.
+	\return true if handled, false if not handled
+*/
+bool ReverbFX::validateComponent()
+{
+	// --- shared pointers and modifiers
+	if (modifiers && midiData)
+	{
+		// --- test for outputs
+		for (unsigned int i = 0; i < numOutputs; i++)
+		{
+			if (!getOutputPtr(i))
+				return false;
+		}
+		return true;
+	}
+	return false;
+}
+
+/**
+	\brief Perform note-on operations for the component
+	\return true if handled, false if not handled
+*/
+bool ReverbFX::doNoteOn(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity)
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	resetComponent();
+
+	return startComponent();
+}
+
+/**
+	\brief Perform note-off operations for the component
+	\return true if handled, false if not handled
+*/
+bool ReverbFX::doNoteOff(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity)
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	return true;
+}
+
+// --- sign patterns: orthogonal rows of the 8x8 Hadamard matrix
+static const double reverbInputSign[kNumReverbLines] = { 1.0, -1.0, -1.0, 1.0, 1.0, -1.0, -1.0, 1.0 };
+static const double reverbLeftSign[kNumReverbLines] = { 1.0, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, -1.0 };
+static const double reverbRightSign[kNumReverbLines] = { 1.0, 1.0, -1.0, -1.0, 1.0, 1.0, -1.0, -1.0 };
+
+/**
+	\brief Recalculate the line lengths, decay gains, damping and mix from the GUI modifiers; the lengths and decay gains only
+	when the size or decay time change
+	\return true if handled, false if not handled
+*/
+bool ReverbFX::updateComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	enabled = modifiers->enabled || ownerBypass;
+
+	double size_Pct = modifiers->size_Pct;
+	boundValue(size_Pct, kMinReverbSize_Pct, kMaxReverbSize_Pct);
+
+	double reverbTime_mSec = modifiers->reverbTime_mSec;
+	boundValue(reverbTime_mSec, kMinReverbTime_mSec, kMaxReverbTime_mSec);
+
+	// --- modulation
+	double modDepth = modifiers->modDepth_Pct / 100.0;
+	boundValue(modDepth, 0.0, 1.0);
+	modExcursion = modDepth*kMaxReverbMod_mSec*sampleRate / 1000.0;
+	phaseInc = sampleRate > 0.0 ? kReverbModRate_Hz / sampleRate : 0.0;
+
+	if (size_Pct != lastSize_Pct || reverbTime_mSec != lastReverbTime_mSec)
+	{
+		lastSize_Pct = size_Pct;
+		lastReverbTime_mSec = reverbTime_mSec;
+
+		// --- the modulated reads must stay behind the block
+		double minDelay = lines[0].getMinBlockDelay(kDelayFXBlockSize) + kMaxReverbMod_mSec*sampleRate / 1000.0;
+		double matrixNorm = 1.0 / sqrt((double)kNumReverbLines);
+
+		for (uint32_t i = 0; i < kNumReverbLines; i++)
+		{
+			// --- integer lengths: unmodulated lines read with memcpy( )
+			lineDelay[i] = floor(kReverbLineLength_mSec[i] * (size_Pct / 100.0)*sampleRate / 1000.0 + 0.5);
+			if (lineDelay[i] < minDelay)
+				lineDelay[i] = ceil(minDelay);
+
+			lines[i].setDelay_mSec(1000.0*lineDelay[i] / sampleRate);
+
+			// --- -60dB after reverbTime_mSec: g = 10^(-3*length/RT60)
+			lineGain[i] = pow(10.0, -3.0*lineDelay[i] / (reverbTime_mSec*sampleRate / 1000.0))*matrixNorm;
+		}
+	}
+
+	// --- damping
+	damping = (modifiers->damping_Pct / 100.0)*kMaxReverbDamping;
+	boundValue(damping, 0.0, kMaxReverbDamping);
+
+	// --- pre-delay
+	double preDelay_mSec = modifiers->preDelay_mSec;
+	boundValue(preDelay_mSec, 0.0, kMaxReverbPreDelay_mSec);
+	preDelay.setDelay_mSec(preDelay_mSec);
+
+	// --- mix
+	double wet = modifiers->mix_Pct / 100.0;
+	boundValue(wet, 0.0, 1.0);
+
+	if (snapGains)
+	{
+		wetGain.snap(wet);
+		dryGain.snap(1.0 - wet);
+		snapGains = false;
+	}
+	else
+	{
+		wetGain.setTarget(wet, kDelayFXBlockSize);
+		dryGain.setTarget(1.0 - wet, kDelayFXBlockSize);
+	}
+
+	return true;
+}
+
+/**
+	\brief Render the component; for ISynthAudioProcessors, this checks and updates the component if needed
+
+	\param update -- a flag that is used to update the component
+
+	\return true if handled, false if not handled
+*/
+bool ReverbFX::renderComponent(bool update)
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- run the modulators
+	runModuators(update);
+
+	if (update)
+		updateComponent();
+
+	return true;
+}
+
+/**
+	\brief Process audio from renderInfo.inputData to output array; one sample through the block renderer
+
+	\param renderInfo contains information about the processing including the flag renderInfo.renderInternal; if this is true, we process audio
+	into the output buffer only, otherwise copy the output data into the renderInfo.outputData array
+
+	\return true if handled, false if not handled
+*/
+bool ReverbFX::processAudio(RenderInfo& renderInfo)
+{
+	// --- check render/update
+	if (!renderComponent(renderInfo.updateComponent))
+		return false;
+
+	// --- always check for proper channel setup
+	if (renderInfo.numInputChannels == 0 ||
+		renderInfo.numInputChannels > 2 ||
+		renderInfo.numOutputChannels == 0 ||
+		renderInfo.numOutputChannels > 2)
+		return false; // not handled
+
+	double left = renderInfo.inputData[0];
+	double right = renderInfo.numInputChannels == 2 ? renderInfo.inputData[1] : left;
+
+	if (enabled)
+		processReverbBlock(&left, renderInfo.numOutputChannels == 2 ? &right : nullptr, 1);
+
+	outputs[kReverbFXLeftOutput] = left;
+	outputs[kReverbFXRightOutput] = renderInfo.numOutputChannels == 2 ? right : left;
+
+	// --- if rendering internal, we're done!
+	if (renderInfo.renderInternal)
+		return true;
+
+	renderInfo.outputData[0] = outputs[kReverbFXLeftOutput];
+	if (renderInfo.numOutputChannels == 2)
+		renderInfo.outputData[1] = outputs[kReverbFXRightOutput];
+
+	return true;
+}
+
+/**
+	\brief Process a stereo (or mono, with a nullptr right buffer) block in place; the block is processed in chunks of
+	kDelayFXBlockSize and the component is updated once per chunk if update is set.
+
+	\param leftBuffer -- left (or mono) channel buffer
+	\param rightBuffer -- right channel buffer; nullptr for mono -> mono
+	\param blockSize -- number of samples in the buffers
+	\param update -- a flag that is used to update the component
+
+	\return true if handled, false if not handled
+*/
+bool ReverbFX::processAudioBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize, bool update)
+{
+	if (!leftBuffer || blockSize == 0)
+		return false;
+
+	uint32_t offset = 0;
+	while (offset < blockSize)
+	{
+		uint32_t count = blockSize - offset;
+		if (count > kDelayFXBlockSize)
+			count = kDelayFXBlockSize;
+
+		// --- check render/update
+		if (!renderComponent(update))
+			return false;
+
+		// --- pass through if not enabled
+		if (enabled)
+			processReverbBlock(&leftBuffer[offset], rightBuffer ? &rightBuffer[offset] : nullptr, count);
+
+		offset += count;
+	}
+
+	outputs[kReverbFXLeftOutput] = leftBuffer[blockSize - 1];
+	outputs[kReverbFXRightOutput] = rightBuffer ? rightBuffer[blockSize - 1] : outputs[kReverbFXLeftOutput];
+
+	return true;
+}
+
+/**
+	\brief Process one chunk in place: read all lines for the chunk, run the damping and the feedback matrix sample by sample,
+	write all lines and mix
+
+	\param leftBuffer -- left (or mono) channel buffer
+	\param rightBuffer -- right channel buffer; nullptr for mono -> mono
+	\param blockSize -- number of samples; at most kDelayFXBlockSize
+*/
+void ReverbFX::processReverbBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize)
+{
+	// --- mono sum through the pre-delay
+	if (rightBuffer)
+	{
+		for (uint32_t i = 0; i < blockSize; i++)
+			monoBuffer[i] = 0.5*(leftBuffer[i] + rightBuffer[i]);
+	}
+	else
+		memcpy(monoBuffer, leftBuffer, blockSize * sizeof(double));
+
+	preDelay.processAudioBlock(monoBuffer, inputBuffer, blockSize);
+
+	// --- read the lines
+	if (modExcursion > 0.0)
+	{
+		double phase = modCounter;
+		for (uint32_t i = 0; i < blockSize; i++)
+		{
+			phaseBuffer[i] = phase;
+			phase += phaseInc;
+			if (phase >= 1.0) phase -= 1.0;
+		}
+		modCounter = phase;
+
+		for (uint32_t line = 0; line < kNumReverbLines; line++)
+		{
+			double phaseOffset = (double)line / (double)kNumReverbLines;
+			for (uint32_t i = 0; i < blockSize; i++)
+			{
+				double linePhase = phaseBuffer[i] + phaseOffset;
+				linePhase = linePhase >= 1.0 ? linePhase - 1.0 : linePhase;
+				delayBuffer[i] = lineDelay[line] + modExcursion*polynomialSine(linePhase);
+			}
+			lines[line].readModulatedBlock(delayBuffer, lineOutput[line], blockSize);
+		}
+	}
+	else
+	{
+		for (uint32_t line = 0; line < kNumReverbLines; line++)
+			lines[line].readDelayBlock(lineOutput[line], blockSize);
+	}
+
+	// --- damping, decay and the feedback matrix
+	double inputGain = 1.0 / sqrt((double)kNumReverbLines);
+	for (uint32_t i = 0; i < blockSize; i++)
+	{
+		double x[kNumReverbLines];
+		for (uint32_t line = 0; line < kNumReverbLines; line++)
+		{
+			// --- y(n) = (1 - d)x(n) + d*y(n-1)
+			dampingState[line] = lineOutput[line][i] + damping*(dampingState[line] - lineOutput[line][i]);
+			snapToZero(dampingState[line]);
+			x[line] = lineGain[line] * dampingState[line];
+		}
+
+		hadamardTransform8(x);
+
+		double input = inputGain*inputBuffer[i];
+		for (uint32_t line = 0; line < kNumReverbLines; line++)
+		{
+			lineInput[line][i] = x[line] + reverbInputSign[line] * input;
+			snapToZero(lineInput[line][i]);
+		}
+	}
+
+	for (uint32_t line = 0; line < kNumReverbLines; line++)
+		lines[line].writeDelayBlock(lineInput[line], blockSize);
+
+	// --- form outputs from the line outputs
+	double outputGain = 1.0 / sqrt((double)kNumReverbLines);
+	for (uint32_t i = 0; i < blockSize; i++)
+	{
+		double wetLeft = 0.0;
+		double wetRight = 0.0;
+		for (uint32_t line = 0; line < kNumReverbLines; line++)
+		{
+			wetLeft += reverbLeftSign[line] * lineOutput[line][i];
+			wetRight += reverbRightSign[line] * lineOutput[line][i];
+		}
+
+		double wet = wetGain.getNextValue()*outputGain;
+		double dry = dryGain.getNextValue();
+
+		if (rightBuffer)
+		{
+			leftBuffer[i] = dry*leftBuffer[i] + wet*wetLeft;
+			rightBuffer[i] = dry*rightBuffer[i] + wet*wetRight;
+		}
+		else // --- mono: fold the outputs back together
+			leftBuffer[i] = dry*leftBuffer[i] + wet*0.5*(wetLeft + wetRight);
+	}
+}
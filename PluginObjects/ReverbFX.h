@@ -0,0 +1,202 @@
+#pragma once
+
+#include "synthfunctions.h"
+#include "synthobjects.h"
+#include "guiconstants.h"
+#include "DelayFX.h"
+
+// --- LIMITS (always at top)
+//
+// --- feedback delay network size; the mixing matrix is a fast Hadamard transform so this must be a power of two
+const uint32_t kNumReverbLines = 8;
+
+// --- line lengths at 100% size, mutually prime-ish so the echo densities don't line up
+const double kReverbLineLength_mSec[kNumReverbLines] = { 29.7, 37.1, 41.1, 43.7, 53.3, 59.9, 67.1, 73.3 };
+
+// --- room size scales the line lengths
+const double kMinReverbSize_Pct = 25.0;
+const double kMaxReverbSize_Pct = 100.0;
+
+// --- decay time (RT60)
+const double kMinReverbTime_mSec = 100.0;
+const double kMaxReverbTime_mSec = 20000.0;
+
+// --- pre-delay
+const double kMaxReverbPreDelay_mSec = 200.0;
+
+// --- delay modulation; breaks up metallic resonances in the tail
+const double kReverbModRate_Hz = 0.37;
+const double kMaxReverbMod_mSec = 0.5;
+
+// --- damping lowpass coefficient at 100%
+const double kMaxReverbDamping = 0.9;
+
+// --- the lines hold the longest line plus the modulation
+const double kMaxReverbLine_mSec = 80.0;
+
+// --- outputs[] indexes for this component
+enum {
+	kReverbFXLeftOutput,
+	kReverbFXRightOutput,
+	kNumReverbFXOutputs
+};
+
+// --- modulator indexes for this component
+enum {
+	kNumReverbFXModulators
+};
+
+/**
+	\struct ReverbFXModifiers
+	\ingroup SynthStructures
+	\brief Contains modifiers for the ReverbFX component. A "modifier" is any variable that *may* be connected to a
+	GUI control, however modifiers are not required to be connected to anything and their default values are set in the structure.
+
+	\param reverbTime_mSec:		decay time (RT60) in mSec
+	\param damping_Pct:			high frequency damping in the feedback loop in %
+	\param size_Pct:			room size in % [kMinReverbSize_Pct, kMaxReverbSize_Pct]; scales the line lengths
+	\param preDelay_mSec:		pre-delay in mSec
+	\param modDepth_Pct:		delay line modulation depth in %
+	\param mix_Pct:				wet/dry mix in %
+	\param enabled:				enable/disable the FX
+*/
+struct ReverbFXModifiers
+{
+	ReverbFXModifiers() {}
+
+	double reverbTime_mSec = 2000.0;
+	double damping_Pct = 50.0;
+	double size_Pct = 100.0;
+	double preDelay_mSec = 10.0;
+	double modDepth_Pct = 30.0;
+	double mix_Pct = 25.0;
+	bool enabled = false;
+};
+
+/**
+	\brief In place, unnormalized 8 point fast Walsh-Hadamard transform (3 butterfly stages); multiply by 1/sqrt(8) for the
+	orthogonal (lossless) matrix
+	\param x -- the 8 values to transform
+*/
+inline void hadamardTransform8(double* x)
+{
+	for (uint32_t span = 1; span < 8; span <<= 1)
+	{
+		for (uint32_t i = 0; i < 8; i += span << 1)
+		{
+			for (uint32_t j = i; j < i + span; j++)
+			{
+				double a = x[j];
+				double b = x[j + span];
+				x[j] = a + b;
+				x[j + span] = a - b;
+			}
+		}
+	}
+}
+
+/**
+	\class ReverbFX
+	\ingroup SynthClasses
+	\brief Encapsulates an 8-line feedback delay network (FDN) reverb.
+
+	The mono sum of the input passes through a pre-delay and is fed to all lines with alternating signs. Each line output
+	goes through a one-pole damping lowpass and a decay gain that sets the RT60 for that line's length; the lines are then
+	mixed with an orthogonal Hadamard matrix and fed back. The left and right outputs are two orthogonal sign patterns of the
+	line outputs, so they are decorrelated. All lines are slowly modulated with different LFO phases.
+
+	All lines are longer than a block, so processing is block based: every line is read for the whole block first (a
+	memcpy( ) for unmodulated lines), then the damping and the matrix run sample by sample across the lines, then every line
+	is written with one block write. The decay gains are only recalculated when the decay time or size change. Size changes
+	move the line lengths immediately and are not meant to be automated.
+
+	I/O: supports the following channel combinations:
+	- mono -> mono
+	- mono -> stereo
+	- stereo -> stereo
+
+	Outputs: contains 2 outputs
+	- Left Channel
+	- Right Channel
+
+	Control I/F:
+	Use ReverbFXModifiers structure
+
+	Modulator indexes:
+	- this component has no modulators
+*/
+class ReverbFX : public ISynthAudioProcessor
+{
+public:
+	ReverbFX(std::shared_ptr<ReverbFXModifiers> _modifiers, IMIDIData* _midiData, uint32_t numOutputs, uint32_t numModulators);
+	virtual ~ReverbFX();
+
+	// --- ISynthComponent
+	virtual bool initializeComponent(InitializeInfo& info);
+	virtual bool startComponent();
+	virtual bool stopComponent();
+	virtual bool resetComponent();
+	virtual bool validateComponent();
+	virtual bool isComponentRunning() { return noteOn; }
+
+	// --- note event handlers
+	virtual bool doNoteOn(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity);
+	virtual bool doNoteOff(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity);
+
+	// --- update and render methods
+	virtual bool updateComponent();
+	virtual bool renderComponent(bool update);
+
+	// --- IAudioProcessor
+	virtual bool processAudio(RenderInfo& renderInfo);
+
+	// --- block processing, in place
+	virtual bool processAudioBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize, bool update);
+
+	// --- modifier getter
+	std::shared_ptr<ReverbFXModifiers> getModifiers() { return modifiers; }
+
+protected:
+	// --- do the reverb on one chunk of at most kDelayFXBlockSize samples
+	void processReverbBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize);
+
+	// --- the network
+	DelayLine preDelay;
+	DelayLine lines[kNumReverbLines];
+
+	double sampleRate = 0.0;
+	bool enabled = false;
+
+	// --- line settings
+	double lineDelay[kNumReverbLines] = { 0.0 };		///< line lengths in samples (integers)
+	double lineGain[kNumReverbLines] = { 0.0 };		///< decay gains, including the 1/sqrt(8) matrix normalization
+	double dampingState[kNumReverbLines] = { 0.0 };	///< damping lowpass states
+	double damping = 0.0;								///< damping lowpass coefficient
+	double lastReverbTime_mSec = -1.0;					///< decay time the gains were calculated from
+	double lastSize_Pct = -1.0;							///< size the lengths and gains were calculated from
+
+	// --- modulation
+	double modCounter = 0.0;		///< LFO phase [0, 1)
+	double phaseInc = 0.0;			///< LFO phase increment
+	double modExcursion = 0.0;		///< modulation depth in samples
+
+	// --- mix, ramped between updates
+	GainRamp wetGain;				///< mix_Pct/100
+	GainRamp dryGain;				///< 1 - wet
+	bool snapGains = true;			///< jump to the new values on the next update (after start/reset)
+
+	// --- block scratch buffers
+	double monoBuffer[kDelayFXBlockSize] = { 0.0 };						///< mono sum of the input
+	double inputBuffer[kDelayFXBlockSize] = { 0.0 };						///< pre-delayed input
+	double phaseBuffer[kDelayFXBlockSize] = { 0.0 };						///< LFO phase for each sample
+	double delayBuffer[kDelayFXBlockSize] = { 0.0 };						///< modulated line delays
+	double lineOutput[kNumReverbLines][kDelayFXBlockSize] = { { 0.0 } };	///< line outputs for the block
+	double lineInput[kNumReverbLines][kDelayFXBlockSize] = { { 0.0 } };	///< line inputs for the block
+
+	// --- note on flag
+	bool noteOn = false;
+
+	// --- our modifiers
+	std::shared_ptr<ReverbFXModifiers> modifiers;
+};
+
@@ -0,0 +1,194 @@
+#include "SupersawOscillator.h"
+
+/**
+	\brief Object constructor; see SynthOscillator
+	\param _modifiers -- the GUI modifiers structure for this component, to be shared with all similar components
+	\param _midiData -- global MIDI data, shared across all ISynthComponents
+	\param numOutputs -- the number of outputs for this component
+	\param numModulators -- the number of modulators for this component
+*/
+SupersawOscillator::SupersawOscillator(std::shared_ptr<SynthOscModifiers> _modifiers, IMIDIData* _midiData, uint32_t numOutputs, uint32_t numModulators)
+	: SynthOscillator(_modifiers, _midiData, numOutputs, numModulators)
+{
+	// --- each oscillator gets its own phase sequence
+	randomState ^= (uint32_t)(uintptr_t)this;
+}
+
+/**
+	\brief Reset the component to a note-off state; each saw starts on a random phase, as on the JP-8000, so the
+	supersaw does not start every note with its edges lined up
+	\return true if handled, false if not handled
+*/
+bool SupersawOscillator::resetComponent()
+{
+	if (!SynthOscillator::resetComponent())
+		return false;
+
+	// --- all kMaxSupersawSaws, so the count can change mid-note
+	for (uint32_t i = 0; i < kMaxSupersawSaws; i++)
+		sawModCounter[i] = randomPhase();
+
+	return true;
+}
+
+/**
+	\brief Recalculate the component's internal variables; see SynthOscillator::updateComponent( )
+	\return true if handled, false if not handled
+*/
+bool SupersawOscillator::updateComponent()
+{
+	if (!SynthOscillator::updateComponent())
+		return false;
+
+	if (oscWave == synthOscWaveform::kSupersaw)
+		updateSupersaw();
+
+	return true;
+}
+
+/**
+	\brief Render the supersaw, or pass any other waveform to the SynthOscillator
+
+	\param left -- receives the left output
+	\param right -- receives the right output
+*/
+void SupersawOscillator::renderWaveform(double& left, double& right)
+{
+	if (oscWave == synthOscWaveform::kSupersaw)
+		doSupersaw(left, right);
+	else
+		SynthOscillator::renderWaveform(left, right);
+}
+
+/**
+	\brief Rebuild the detune ratios and gains of the saws when the count, detune, mix or spread changes.
+	- detune: the saws run from -1 (flat, left) to +1 (sharp, right) through the measured JP-8000 offsets, interpolated
+	  for counts other than seven, scaled by the detune curve
+	- mix: the center saw (the middle pair for an even count) gets the center gain and the others share the energy
+	  of the six JP-8000 side saws
+	- level: the stack is normalized to the power of a single saw since the saws are not phase aligned
+*/
+void SupersawOscillator::updateSupersaw()
+{
+	uint32_t count = modifiers->supersawCount;
+	if (count < 1) count = 1;
+	if (count > kMaxSupersawSaws) count = kMaxSupersawSaws;
+
+	// --- only on a change
+	if (count == sawCount && modifiers->supersawDetune_Pct == sawDetune_Pct &&
+		modifiers->supersawMix_Pct == sawMix_Pct && modifiers->unisonSpread_Pct == sawSpread_Pct)
+		return;
+
+	sawCount = count;
+	sawDetune_Pct = modifiers->supersawDetune_Pct;
+	sawMix_Pct = modifiers->supersawMix_Pct;
+	sawSpread_Pct = modifiers->unisonSpread_Pct;
+
+	double detune = sawDetune_Pct / 100.0;
+	boundValue(detune, 0.0, 1.0);
+	detune = supersawDetuneCurve(detune);
+
+	double mix = sawMix_Pct / 100.0;
+	boundValue(mix, 0.0, 1.0);
+	double centerGain = 0.0;
+	double sideGain = 0.0;
+	supersawMixCurves(mix, centerGain, sideGain);
+
+	// --- one center saw, or a pair sharing its gain
+	uint32_t numCenter = sawCount % 2 == 1 ? 1 : 2;
+	uint32_t numSide = sawCount - numCenter;
+	if (numCenter == 2)
+		centerGain *= sqrt(0.5);
+	if (numSide > 0)
+		sideGain *= sqrt(6.0 / (double)numSide);
+
+	double power = numCenter*centerGain*centerGain + numSide*sideGain*sideGain;
+	double level = power > 0.0 ? 1.0 / sqrt(power) : 0.0;
+
+	double spread = sawSpread_Pct / 100.0;
+	boundValue(spread, 0.0, 1.0);
+
+	centerSaw = sawCount / 2;
+	for (uint32_t i = 0; i < sawCount; i++)
+	{
+		double position = sawCount == 1 ? 0.0 : -1.0 + 2.0*(double)i / (double)(sawCount - 1);
+
+		// --- interpolate the measured offsets; exact for seven saws
+		double tablePosition = (position + 1.0)*0.5*(double)(kNumSupersawOffsets - 1);
+		uint32_t index = (uint32_t)tablePosition;
+		if (index > kNumSupersawOffsets - 2) index = kNumSupersawOffsets - 2;
+		double offset = doLinearInterpolation(0.0, 1.0, kSupersawOffsets[index], kSupersawOffsets[index + 1], tablePosition - (double)index);
+		sawIncRatio[i] = 1.0 + offset*detune;
+
+		bool center = i == centerSaw || (numCenter == 2 && i == centerSaw - 1);
+		double gain = level*(center ? centerGain : sideGain);
+
+		double pan = position*spread;
+		sawLeftGain[i] = gain*fmin(1.0, 1.0 - pan);
+		sawRightGain[i] = gain*fmin(1.0, 1.0 + pan);
+	}
+}
+
+/**
+	\brief Synthesize the supersaw and pan it into a stereo pair. Phase accumulators (with phase modulation, as in
+	doSawtooth( )), trivial saws and the polynomial BLEP of every saw are one loop over plain arrays with no branches;
+	the wrap directions are the same for all saws and are worked out before the loop.
+
+	\param left -- receives the left output
+	\param right -- receives the right output
+*/
+void SupersawOscillator::doSupersaw(double& left, double& right)
+{
+	// --- smallest increment used for the BLEP width, so a stopped oscillator does not divide by zero
+	const double minInc = 1.0e-9;
+
+	double sawOutput[kMaxSupersawSaws];
+	double phase[kMaxSupersawSaws];
+	double inc[kMaxSupersawSaws];
+
+	const double centerPhaseInc = phaseInc;
+	const double phaseModulation = phaseModuator;
+	const double wrapDown = centerPhaseInc > 0.0 ? 1.0 : 0.0;
+	const double wrapUp = centerPhaseInc < 0.0 ? 1.0 : 0.0;
+	const double modWrapDown = phaseModulation > 0.0 ? 1.0 : 0.0;
+	const double modWrapUp = phaseModulation < 0.0 ? 1.0 : 0.0;
+	const uint32_t count = sawCount;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		// --- phase accumulator
+		double oscInc = centerPhaseInc*sawIncRatio[i];
+		double counter = sawModCounter[i];
+		counter -= counter >= 1.0 ? wrapDown : 0.0;
+		counter += counter <= 0.0 ? wrapUp : 0.0;
+		sawModCounter[i] = counter + oscInc;
+
+		double finalCounter = counter + phaseModulation;
+		finalCounter -= finalCounter >= 1.0 ? modWrapDown : 0.0;
+		finalCounter += finalCounter <= 0.0 ? modWrapUp : 0.0;
+
+		// --- polynomial BLEP, one sample either side of the falling edge
+		double width = fabs(oscInc);
+		width = width > minInc ? width : minInc;
+		double after = finalCounter / width;
+		double before = (finalCounter - 1.0) / width;
+		double blepAfter = after + after - after*after - 1.0;
+		double blepBefore = before*before + before + before + 1.0;
+		double blep = finalCounter < width ? blepAfter : 0.0;
+		blep = finalCounter > 1.0 - width ? blepBefore : blep;
+
+		phase[i] = finalCounter;
+		inc[i] = width;
+		sawOutput[i] = 2.0*finalCounter - 1.0 - blep;
+	}
+
+	// --- hard sync follows the center saw
+	resetTrigger = count > 0 && phase[centerSaw] < inc[centerSaw];
+
+	left = 0.0;
+	right = 0.0;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		left += sawLeftGain[i] * sawOutput[i];
+		right += sawRightGain[i] * sawOutput[i];
+	}
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "synthoscillator.h"
+
+// --- LIMITS (always at top)
+//
+// --- saws in one supersaw
+const uint32_t kMaxSupersawSaws = 16;
+
+// --- JP-8000 supersaw, as measured by Adam Szabo ("How to Emulate the Super Saw", 2010):
+//     frequency offsets of the seven saws at full detune, as fractions of the note frequency
+const uint32_t kNumSupersawOffsets = 7;
+const double kSupersawOffsets[kNumSupersawOffsets] = { -0.11002313, -0.06288439, -0.01952356, 0.0, 0.01991221, 0.06216538, 0.10745242 };
+
+/**
+	\brief The JP-8000 detune curve: fine control near zero, then a steep rise at the top of the knob
+
+	\param detune -- detune knob [0, 1]
+	\return the scalar for kSupersawOffsets [0, 1]
+*/
+inline double supersawDetuneCurve(double detune)
+{
+	const double x = detune;
+	return ((((((((((10028.7312891634*x - 50818.8652045924)*x + 111363.4808729368)*x - 138150.6761080548)*x
+		+ 106649.6679158292)*x - 53046.9642751875)*x + 17019.9518580080)*x - 3425.0836591318)*x
+		+ 404.2703938388)*x - 24.1878824391)*x + 0.6717417634)*x + 0.0030115596;
+}
+
+/**
+	\brief The JP-8000 mix curves: the center saw fades down linearly while the detuned saws come up quickly
+
+	\param mix -- mix knob [0, 1]
+	\param centerGain -- receives the gain of the center saw
+	\param sideGain -- receives the gain of each detuned saw
+*/
+inline void supersawMixCurves(double mix, double& centerGain, double& sideGain)
+{
+	centerGain = -0.55366*mix + 0.99785;
+	sideGain = -0.73764*mix*mix + 1.2841*mix + 0.044372;
+}
+
+/**
+	\class SupersawOscillator
+	\ingroup SynthClasses
+	\brief A pitched oscillator with one more waveform, synthOscWaveform::kSupersaw: up to kMaxSupersawSaws detuned
+	sawtooths with random phases, using the detune and mix curves of the JP-8000 (see supersawDetuneCurve( ) and
+	supersawMixCurves( )). The saws are spread across the stereo field and the stack is normalized to the level of a
+	single saw, whatever the count and mix.
+
+	The saws are kept as plain arrays and rendered in one branch-free loop: phase accumulator, trivial saw and a
+	two point polynomial BLEP (both residuals are calculated and selected), so the compiler vectorizes the whole saw.
+	The polynomial BLEP is not as clean as the table BLEP of the single saw but a detuned stack hides the difference.
+
+	All other waveforms, the modulators, the outputs and the unison stack are those of the SynthOscillator, so the
+	SupersawOscillator is a drop-in osc1/osc2 and is a modulation source like any other oscillator. Unison is not
+	applied to the supersaw; it is a stack already.
+
+	Control I/F:
+	Use SynthOscModifiers structure: oscWave, supersawCount, supersawDetune_Pct, supersawMix_Pct and unisonSpread_Pct
+*/
+class SupersawOscillator : public SynthOscillator
+{
+public:
+	SupersawOscillator(std::shared_ptr<SynthOscModifiers> _modifiers, IMIDIData* _midiData, uint32_t numOutputs, uint32_t numModulators);
+	virtual ~SupersawOscillator() {}
+
+	// --- ISynthComponent
+	virtual bool resetComponent();
+	virtual bool updateComponent();
+
+protected:
+	// --- SynthOscillator
+	virtual void renderWaveform(double& left, double& right);
+
+	// --- supersaw functions
+	void updateSupersaw();
+	void doSupersaw(double& left, double& right);
+
+	/** next random phase [0, 1); a private generator so the audio thread does not share rand( ) */
+	inline double randomPhase()
+	{
+		randomState = randomState * 1664525 + 1013904223;
+		return (double)(randomState >> 8) / 16777216.0;
+	}
+
+	// --- supersaw, one array entry per saw (structure of arrays so the loop vectorizes)
+	uint32_t sawCount = 0;									///< saws in the stack; 0 = not built yet
+	double sawDetune_Pct = 0.0;								///< detune the stack was built for
+	double sawMix_Pct = 0.0;								///< mix the stack was built for
+	double sawSpread_Pct = 0.0;								///< spread the stack was built for
+	double sawIncRatio[kMaxSupersawSaws] = { 0.0 };			///< detune as a ratio of phaseInc
+	double sawModCounter[kMaxSupersawSaws] = { 0.0 };		///< modulo counters
+	double sawLeftGain[kMaxSupersawSaws] = { 0.0 };			///< left gain, including the mix and level
+	double sawRightGain[kMaxSupersawSaws] = { 0.0 };		///< right gain, including the mix and level
+	uint32_t centerSaw = 0;									///< index of the saw that drives hard sync
+
+	// --- random phases
+	uint32_t randomState = 0x2545F491;
+};
@@ -0,0 +1,124 @@
+#include "SynthArena.h"
+
+#include <string.h>
+
+// --- the calling thread's current arena
+static thread_local SynthArena* currentArena = nullptr;
+
+/** get the calling thread's current arena, or nullptr */
+SynthArena* SynthArena::getCurrent()
+{
+	return currentArena;
+}
+
+/** set the calling thread's current arena; use SynthArena::Scope */
+void SynthArena::setCurrent(SynthArena* arena)
+{
+	currentArena = arena;
+}
+
+/** round a pointer up to an alignment (a power of two) */
+static char* alignPointer(char* pointer, size_t alignment)
+{
+	return (char*)(((uintptr_t)pointer + alignment - 1) & ~(uintptr_t)(alignment - 1));
+}
+
+/**
+	\brief Add a new, zeroed chunk of at least minSize usable bytes; its first byte is cache line aligned
+	\param minSize -- bytes that must fit in the chunk
+*/
+void SynthArena::addChunk(size_t minSize)
+{
+	size_t chunkSize = minSize > kArenaChunkSize ? minSize : kArenaChunkSize;
+
+	// --- room for the header and the alignment
+	size_t headerSize = (sizeof(Chunk) + kArenaCacheLineSize - 1) & ~(kArenaCacheLineSize - 1);
+	size_t rawSize = chunkSize + headerSize + kArenaCacheLineSize;
+	char* rawMemory = new char[rawSize];
+	memset(rawMemory, 0, rawSize);
+
+	char* start = alignPointer(rawMemory, kArenaCacheLineSize);
+	Chunk* chunk = (Chunk*)start;
+	chunk->rawMemory = rawMemory;
+	chunk->next = chunks;
+	chunks = chunk;
+	numChunks++;
+
+	current = start + headerSize;
+	end = current + chunkSize;
+}
+
+/**
+	\brief Allocate zeroed memory from the newest chunk, adding a chunk if it does not fit
+	\param size -- bytes
+	\param alignment -- a power of two, at most kArenaCacheLineSize
+	\return the memory
+*/
+void* SynthArena::allocate(size_t size, size_t alignment)
+{
+	if (alignment > kArenaCacheLineSize)
+		alignment = kArenaCacheLineSize;
+
+	char* memory = current ? alignPointer(current, alignment) : nullptr;
+	if (!memory || memory + size > end)
+	{
+		addChunk(size);
+		memory = current;
+	}
+
+	bytesUsed += (memory + size) - current;
+	current = memory + size;
+	return memory;
+}
+
+/**
+	\brief Start a region: move to the next cache line and, if the region would not fit in the rest of the chunk,
+	move to a new chunk
+	\param expectedSize -- expected size of the region in bytes; 0 if not known
+*/
+void SynthArena::beginRegion(size_t expectedSize)
+{
+	char* start = current ? alignPointer(current, kArenaCacheLineSize) : nullptr;
+	if (!start || start + expectedSize > end)
+	{
+		addChunk(expectedSize);
+		return;
+	}
+
+	bytesUsed += start - current;
+	current = start;
+}
+
+/** remember an object whose destructor must run */
+void SynthArena::addDestructor(void* object, void(*destroy)(void*))
+{
+	DestructorRecord* record = static_cast<DestructorRecord*>(allocate(sizeof(DestructorRecord), alignof(DestructorRecord)));
+	record->object = object;
+	record->destroy = destroy;
+	record->next = destructors;
+	destructors = record;
+}
+
+/**
+	\brief Destroy all objects, newest first (so owners go before the components they constructed), then free the chunks
+*/
+void SynthArena::destroy()
+{
+	while (destructors)
+	{
+		DestructorRecord* record = destructors;
+		destructors = record->next;
+		record->destroy(record->object);
+	}
+
+	while (chunks)
+	{
+		Chunk* chunk = chunks;
+		chunks = chunk->next;
+		delete[] chunk->rawMemory;
+	}
+
+	numChunks = 0;
+	current = end = nullptr;
+	bytesUsed = 0;
+}
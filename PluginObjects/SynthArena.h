@@ -0,0 +1,122 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+// --- LIMITS (always at top)
+//
+// --- cache line size; regions and chunks start on a line
+const size_t kArenaCacheLineSize = 64;
+
+// --- default chunk size; a chunk holds several voices, a larger request gets a chunk of its own
+const size_t kArenaChunkSize = 1024 * 1024;
+
+/**
+	\class SynthArena
+	\ingroup SynthClasses
+	\brief A monotonic (bump) allocator for objects that live as long as their owner, such as the components of the
+	synth voices. Memory comes from large, zeroed, cache line aligned chunks and is only given back when the arena is
+	destroyed; objects are placement constructed and the arena runs their destructors, newest first, at that time.
+
+	Regions: beginRegion( ) starts the next allocation on a new cache line and, given the expected size, makes sure
+	that the whole region fits in one chunk. The SynthEngine makes each voice a region, so a voice, its components,
+	their output arrays and modulators are packed together in memory.
+
+	ISynthComponent picks up the current arena (see SynthArena::Scope) in its constructor and takes its output and
+	modulator arrays from it; createComponent( ) and createModulator( ) construct sub-objects in the same arena.
+
+	Construction time only; the arena is not thread safe and does not free single objects.
+*/
+class SynthArena
+{
+public:
+	SynthArena() {}
+	~SynthArena() { destroy(); }
+
+	// --- raw memory; zeroed, never nullptr (throws std::bad_alloc like new)
+	void* allocate(size_t size, size_t alignment = alignof(double));
+
+	// --- start a cache line aligned region of (about) expectedSize bytes that does not cross a chunk
+	void beginRegion(size_t expectedSize = 0);
+
+	// --- run the destructors, newest first, and free the chunks
+	void destroy();
+
+	/** bytes handed out so far, including alignment padding */
+	size_t getBytesUsed() { return bytesUsed; }
+
+	/** number of chunks */
+	uint32_t getNumChunks() { return numChunks; }
+
+	/** placement construct an object; its destructor runs when the arena is destroyed */
+	template <class T, class... Args>
+	T* construct(Args&&... args)
+	{
+		void* memory = allocate(sizeof(T), alignof(T));
+		T* object = new (memory) T(std::forward<Args>(args)...);
+
+		if (!std::is_trivially_destructible<T>::value)
+			addDestructor(object, &destroyObject<T>);
+
+		return object;
+	}
+
+	/** allocate a zeroed array of trivial objects (doubles, pointers) */
+	template <class T>
+	T* allocateArray(size_t count)
+	{
+		static_assert(std::is_trivial<T>::value, "arena arrays are for trivial types");
+		return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+	}
+
+	/**
+		\class Scope
+		\brief Makes an arena the current arena of the calling thread for the lifetime of the object; scopes nest
+	*/
+	class Scope
+	{
+	public:
+		Scope(SynthArena* arena) : previous(getCurrent()) { setCurrent(arena); }
+		~Scope() { setCurrent(previous); }
+
+	protected:
+		SynthArena* previous = nullptr;
+	};
+
+	// --- the calling thread's current arena, or nullptr
+	static SynthArena* getCurrent();
+
+protected:
+	static void setCurrent(SynthArena* arena);
+
+	/** type-erased destructor call */
+	template <class T>
+	static void destroyObject(void* object) { static_cast<T*>(object)->~T(); }
+
+	// --- destructor records are allocated in the arena itself and form a list, newest first
+	struct DestructorRecord
+	{
+		void* object;
+		void(*destroy)(void*);
+		DestructorRecord* next;
+	};
+	void addDestructor(void* object, void(*destroy)(void*));
+
+	// --- chunk header, at the start of each chunk's raw memory
+	struct Chunk
+	{
+		Chunk* next;
+		char* rawMemory;
+	};
+	void addChunk(size_t minSize);
+
+	Chunk* chunks = nullptr;						///< newest chunk first
+	uint32_t numChunks = 0;							///< number of chunks
+	char* current = nullptr;						///< next free byte in the newest chunk
+	char* end = nullptr;							///< end of the newest chunk
+	size_t bytesUsed = 0;							///< bytes handed out
+	DestructorRecord* destructors = nullptr;		///< objects to destroy, newest first
+};
@@ -18,6 +18,10 @@ SynthEngine::SynthEngine()
 	// --- CCs
 	ccMIDIData[VOLUME_CC07] = 127;	// --- MIDI VOLUME; default this to ON
 	ccMIDIData[PAN_CC10] = 64;		// --- MIDI PAN; default this to CENTER
+
+	// --- MPE: no member channels mapped yet
+	for (unsigned int i = 0; i < MPE_NUM_CHANNELS; i++)
+		mpeChannelVoice[i] = -1;
 	
 	// --- master FX: chorus
 	modifiers->chorusFXModifiers->delayFXMode = delayFXMode::chorus;
@@ -27,10 +31,35 @@ SynthEngine::SynthEngine()
 	modifiers->delayFXModifiers->delayFXMode = delayFXMode::norm;
 	masterFX_Delay = new DelayFX(modifiers->delayFXModifiers, this, kNumDelayFXOutputs, kNumDelayFXModulators);
 
-	// --- create array of voices
-	for (unsigned int i = 0; i < MAX_VOICES; i++)
+	// --- master FX: ensemble
+	masterFX_Ensemble = new EnsembleFX(modifiers->ensembleFXModifiers, this, kNumEnsembleFXOutputs, kNumEnsembleFXModulators);
+
+	// --- master FX: reverb
+	masterFX_Reverb = new ReverbFX(modifiers->reverbFXModifiers, this, kNumReverbFXOutputs, kNumReverbFXModulators);
+
+	// --- master FX chain in the default order; updateMasterFXChain( ) applies the order and enable modifiers
+	masterFXChain.addProcessor(masterFX_Chorus, true, kProfileChorusFX);
+	masterFXChain.addProcessor(masterFX_Ensemble, true, kProfileEnsembleFX);
+	masterFXChain.addProcessor(masterFX_Delay, true, kProfileDelayFX);
+	masterFXChain.addProcessor(masterFX_Reverb, true, kProfileReverbFX);
+
+	// --- global LFOs: free running so every voice sees the same phase
+	modifiers->globalLFO1Modifiers->oscMode = LFOMode::kFreeRun;
+	modifiers->globalLFO2Modifiers->oscMode = LFOMode::kFreeRun;
+	globalLFO1 = new LFO(modifiers->globalLFO1Modifiers, this, kNumLFOOutputs, kNumLFOModulators);
+	globalLFO2 = new LFO(modifiers->globalLFO2Modifiers, this, kNumLFOOutputs, kNumLFOModulators);
+
+	// --- create array of voices: one contiguous arena region per voice, sized from the first voice
+	for (unsigned int i = 0; i < NUM_VOICE_SLOTS; i++)
 	{
-		synthVoices[i].reset(new SynthVoice(modifiers->voiceModifiers, this, kNumVoiceOutputs, kNumVoiceModulators));
+		voiceArena.beginRegion(voiceArenaRegionSize);
+		size_t regionStart = voiceArena.getBytesUsed();
+		{
+			SynthArena::Scope arenaScope(&voiceArena);
+			synthVoices[i] = voiceArena.construct<SynthVoice>(modifiers->voiceModifiers, this, kNumVoiceOutputs, kNumVoiceModulators);
+		}
+		if (i == 0)
+			voiceArenaRegionSize = voiceArena.getBytesUsed() - regionStart;
 
 		// --- can register master level FX with voices for modulation from their components (beware, can get very tricky)
 		//     NOTE: you can't have multiple modulation components/indexes with the same source or destination
@@ -42,18 +71,28 @@ SynthEngine::SynthEngine()
 		synthVoices[i]->registerModulatorArrayIndex(modulationSource::kNoneDontCare, modulationDestination::kDelayFX_FB, kDelayFX_FeedbackMod);
 		synthVoices[i]->registerModulatorArrayIndex(modulationSource::kNoneDontCare, modulationDestination::kDelayFX_Mix, kDelayFX_MixMod);
 		synthVoices[i]->registerModulatorArrayIndex(modulationSource::kNoneDontCare, modulationDestination::kChorus_Depth, kChorusFX_DepthMod);
+
+		// --- the global LFOs are mod sources for every voice; the voice modulators point at the one shared output array
+		synthVoices[i]->registerModSourceComponent(modulationSource::kGlobalLFO1_Out, globalLFO1, kLFONormalOutput);
+		synthVoices[i]->registerModSourceComponent(modulationSource::kGlobalLFO1_OutInv, globalLFO1, kLFONormalOutputInverted);
+		synthVoices[i]->registerModSourceComponent(modulationSource::kGlobalLFO2_Out, globalLFO2, kLFONormalOutput);
+		synthVoices[i]->registerModSourceComponent(modulationSource::kGlobalLFO2_OutInv, globalLFO2, kLFONormalOutputInverted);
 	}
 
 
 }
 
 /**
-	\brief Destroy all modifiers and voices that were allocated in constructor
+	\brief Destroy all modifiers and FX that were allocated in constructor; the voices go with the voice arena
 */
 SynthEngine::~SynthEngine()
 {
 	if (masterFX_Chorus) delete masterFX_Chorus;
 	if (masterFX_Delay) delete masterFX_Delay;
+	if (masterFX_Ensemble) delete masterFX_Ensemble;
+	if (masterFX_Reverb) delete masterFX_Reverb;
+	if (globalLFO1) delete globalLFO1;
+	if (globalLFO2) delete globalLFO2;
 }
 
 /**
@@ -67,8 +106,21 @@ bool SynthEngine::reset(ResetInfo& resetInfo)
 {
 	InitializeInfo info(resetInfo.sampleRate, resetInfo.bitDepth);
 
-	for (unsigned int i = 0; i < MAX_VOICES; i++)
+	// --- discard any stale MIDI
+	midiEventRing.clear();
+	externalMIDIEventRing.clear();
+
+	// --- sample rate change: start the EG coefficient cache over before the voices recalculate their segments
+	egCoefficientCache.clearCache();
+
+	// --- the wave tables for every oversampling rate, before the oscillators look for theirs
+	oscillatorWaveTables.createWaveTables(resetInfo.sampleRate);
+
+	// --- set the oversampling first so the voices only initialize once
+	oversampling = modifiers->voiceModifiers->oversampling;
+	for (unsigned int i = 0; i < NUM_VOICE_SLOTS; i++)
 	{
+		synthVoices[i]->setOversampling(oversampling);
 		synthVoices[i]->initializeComponent(info);
 	}
 
@@ -79,6 +131,38 @@ bool SynthEngine::reset(ResetInfo& resetInfo)
 	masterFX_Delay->initializeComponent(info);
 	masterFX_Delay->startComponent();
 
+	masterFX_Ensemble->initializeComponent(info);
+	masterFX_Ensemble->startComponent();
+
+	masterFX_Reverb->initializeComponent(info);
+	masterFX_Reverb->startComponent();
+	masterFXUpdateCounter = 0;
+
+	// --- no fades after a reset: FX that are on start fully on
+	masterFXChain.setSampleRate(resetInfo.sampleRate);
+	updateMasterFXChain();
+	masterFXChain.finishCrossfades();
+
+	// --- global LFOs: rendered once per block, so they run at the control rate fs/kGlobalLFOBlockSize
+	InitializeInfo controlRateInfo(resetInfo.sampleRate / (double)kGlobalLFOBlockSize, resetInfo.bitDepth);
+	globalLFO1->initializeComponent(controlRateInfo);
+	globalLFO1->startComponent();
+	globalLFO2->initializeComponent(controlRateInfo);
+	globalLFO2->startComponent();
+	globalLFOBlockCounter = 0;
+
+	// --- timeline position is fs based
+	transport.sampleRate = resetInfo.sampleRate;
+
+	// --- start a fresh telemetry block; the ring belongs to its reader and is not touched
+	sampleRate = resetInfo.sampleRate;
+	telemetrySampleCounter = 0;
+	telemetrySumSquares[0] = telemetrySumSquares[1] = 0.0;
+	telemetryRenderTimePerSample_uSec = 0.0;
+	telemetryFrame.peak[0] = telemetryFrame.peak[1] = 0.f;
+	telemetryFrame.activeVoices = 0;
+	voiceStealCount = 0;
+
 	return true;
 }
 
@@ -91,20 +175,80 @@ bool SynthEngine::reset(ResetInfo& resetInfo)
 */
 bool SynthEngine::update(UpdateInfo& updateInfo)
 {
+	// --- called from the audio thread between frames
+	SYNTH_AUDIO_THREAD_SCOPE();
+
 	// --- MODE
 	synthMode = modifiers->synthMode;
 
+	// --- MPE: on any change, drop the channel map and neutralize per-note expression
+	if (enableMPE != modifiers->enableMPE)
+	{
+		enableMPE = modifiers->enableMPE;
+
+		MPEExpression neutral;
+		for (unsigned int i = 0; i < MPE_NUM_CHANNELS; i++)
+		{
+			mpeChannelVoice[i] = -1;
+			mpeChannelExpression[i] = neutral;
+		}
+		for (unsigned int i = 0; i < NUM_VOICE_SLOTS; i++)
+			synthVoices[i]->clearMPEExpression();
+	}
+
+	// --- unison stacks the (detuned) oscillators inside each voice, so unison mode plays polyphonically
+	uint32_t unisonCount = synthMode == synthMode::kUnison ? modifiers->unisonCount : 1;
+	modifiers->voiceModifiers->osc1Modifiers->unisonCount = unisonCount;
+	modifiers->voiceModifiers->osc2Modifiers->unisonCount = unisonCount;
+
 	// --- store pitch bend range in midi data table
 	globalMIDIData[kMIDIPitchBendRange] = modifiers->masterPitchBend;
 
+	// --- oversampling: re-initializes the voice oscillators (on the shared tables) and filters, so only on a change
+	if (modifiers->voiceModifiers->oversampling != oversampling)
+	{
+		oversampling = modifiers->voiceModifiers->oversampling;
+		for (unsigned int i = 0; i < NUM_VOICE_SLOTS; i++)
+			synthVoices[i]->setOversampling(oversampling);
+	}
+
 	masterFX_Chorus->updateComponent();
 	masterFX_Delay->updateComponent();
 
+	// --- global LFOs have no note events to sync or one-shot from
+	modifiers->globalLFO1Modifiers->oscMode = LFOMode::kFreeRun;
+	modifiers->globalLFO2Modifiers->oscMode = LFOMode::kFreeRun;
+
 	return true;
 }
 
 /**
-	\brief Render the synth output for this sample interval; loop through the voices and render/accumulate them
+	\brief Latch the host transport at the top of a buffer
+
+	\param bpm host tempo; ignored if not positive
+	\param timeSigNumerator time signature numerator; ignored if not positive
+	\param timeSigDenominator time signature denominator; ignored if 0
+	\param bufferStartSampleIndex the host's absolute sample index for the first sample in the buffer
+*/
+void SynthEngine::setHostTransport(double bpm, double timeSigNumerator, uint32_t timeSigDenominator, uint64_t bufferStartSampleIndex)
+{
+	if (bpm > 0.0) transport.bpm = bpm;
+	if (timeSigNumerator > 0.0) transport.timeSigNumerator = timeSigNumerator;
+	if (timeSigDenominator > 0) transport.timeSigDenominator = timeSigDenominator;
+
+	transportBufferStart = bufferStartSampleIndex;
+}
+
+/**
+	\brief For hosts without transport information: the new buffer starts right after the last rendered sample
+*/
+void SynthEngine::continueTransport()
+{
+	transportBufferStart = transport.absoluteSampleIndex + 1;
+}
+
+/**
+	\brief Render the synth output for this sample interval; a one sample renderBlock( )
 
 	\param renderInfo information about current render cycle
 
@@ -115,55 +259,256 @@ bool SynthEngine::render(RenderInfo& renderInfo)
 	if (renderInfo.numOutputChannels != kNumEngineOutputs)
 		return false; // not handled
 
-	// --- flush
-	clearOutputs();
-
 	// --- voices render into their internal buffers
 	renderInfo.renderInternal = true;
 
-	// --- for unison mode we need to scale back the gains of each voice
-	double gainFactor = 1.0;
-	if (synthMode == synthMode::kUnison)
-		gainFactor = 1.0 / (MAX_UNISON_VOICES);
+	double left = 0.0;
+	double right = 0.0;
+	if (!renderBlock(&left, &right, 1, renderInfo.sampleOffset))
+		return false;
+
+	// --- copy to output arrays
+	renderInfo.outputData[0] = left;
+	renderInfo.outputData[1] = right;
+
+	return true;
+}
 
-	// --- loop through voices and render/accumulate them
-	for (unsigned int i = 0; i < MAX_VOICES; i++) 
+/**
+	\brief Render a block of synth output. The block is split into runs that end at the next global LFO block or queued
+	MIDI event; each voice renders a whole run and is summed into the buffers, so every voice sees the same engine state
+	as it would sample by sample. The master FX then process the block in place, in chunks that start on their update
+	cycles. MIDI events fire at their sample offsets and the output is identical to calling render( ) for every sample,
+	except that noise sources draw from the shared random generator in voice order rather than in sample order.
+
+	The caller sets the floating point mode: PluginCore holds a DenormalGuard for each host buffer.
+
+	\param leftBuffer -- buffer to receive blockSize left channel samples
+	\param rightBuffer -- buffer to receive blockSize right channel samples
+	\param blockSize -- number of samples to render
+	\param sampleOffset -- offset of the first sample in the host buffer, for the queued MIDI events and the timeline
+
+	\return true if handled, false otherwise
+*/
+bool SynthEngine::renderBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize, uint32_t sampleOffset)
+{
+	if (!leftBuffer || !rightBuffer)
+		return false; // not handled
+
+	// --- debug builds: no allocation from here on
+	SYNTH_AUDIO_THREAD_SCOPE();
+
+	// --- profiling builds: count the samples and time the whole render
+	for (uint32_t i = 0; i < blockSize; i++)
+		SYNTH_PROFILE_END_SAMPLE();
+	SYNTH_PROFILE_SCOPE(kProfileEngineRender);
+
+	// --- flush
+	memset(leftBuffer, 0, blockSize * sizeof(double));
+	memset(rightBuffer, 0, blockSize * sizeof(double));
+
+	uint32_t activeVoices = 0;
+	uint32_t offset = 0;
+	while (offset < blockSize)
 	{
-		if (synthVoices[i]->renderComponent(false))
+		uint32_t runOffset = sampleOffset + offset;
+
+		// --- fire any MIDI events due at (or before) the first sample of the run
+		transport.absoluteSampleIndex = transportBufferStart + runOffset;
+		dispatchMIDIEvents(runOffset);
+
+		// --- the run ends at the next global LFO block or at the next queued event
+		uint32_t runLength = blockSize - offset;
+		if (runLength > kGlobalLFOBlockSize - globalLFOBlockCounter)
+			runLength = kGlobalLFOBlockSize - globalLFOBlockCounter;
+
+		const midiEvent* nextEvent = midiEventRing.peekEvent();
+		if (nextEvent && nextEvent->midiSampleOffset - runOffset < runLength)
+			runLength = nextEvent->midiSampleOffset - runOffset;
+
+		// --- global LFOs: one render (and update) per block for all voices
+		if (globalLFOBlockCounter == 0)
+		{
+			globalLFO1->renderComponent(true);
+			globalLFO2->renderComponent(true);
+		}
+		globalLFOBlockCounter += runLength;
+		if (globalLFOBlockCounter == kGlobalLFOBlockSize)
+			globalLFOBlockCounter = 0;
+
+		// --- each voice renders the run as a block and adds it to the mix; the voice moves the timeline along for the
+		//     tempo synced components, which read it on their update cycles
+		double* left = &leftBuffer[offset];
+		double* right = &rightBuffer[offset];
+		uint32_t runVoices = 0;
+		for (unsigned int i = 0; i < NUM_VOICE_SLOTS; i++)
 		{
-			outputs[kEngineLeftOutput] += gainFactor * synthVoices[i]->getOutputValue(kVoiceLeftOutput);
-			outputs[kEngineRightOutput] += gainFactor * synthVoices[i]->getOutputValue(kVoiceRightOutput);
+			// --- an idle voice only starts on a note event, and those end the run
+			SynthVoice* voice = synthVoices[i];
+			if (!voice->isComponentRunning())
+				continue;
+
+			SYNTH_PROFILE_SCOPE(kProfileVoice0 + i);
+			transport.absoluteSampleIndex = transportBufferStart + runOffset;
+			if (voice->renderBlock(left, right, runLength))
+				runVoices++;
 		}
+		if (runVoices > activeVoices)
+			activeVoices = runVoices;
+
+		offset += runLength;
 	}
 
-	// --- setup FX render
-	RenderInfo masterFXRender;
-	masterFXRender.inputData = &outputs[kEngineLeftOutput]; // NOTE: processing "in place"
-	masterFXRender.outputData = &outputs[kEngineLeftOutput];// NOTE: processing "in place"
-	masterFXRender.numInputChannels = kNumEngineOutputs;
-	masterFXRender.numOutputChannels = kNumEngineOutputs;
-	masterFXRender.renderInternal = false;
-	masterFXRender.updateComponent = true;
-
-	// --- master FX: CHORUS
-	if (masterFX_Chorus->getModifiers()->enabled)
+	// --- master FX: processed in place; each chunk ends where the next master FX update (and gain ramp) starts,
+	//     once every kDelayFXBlockSize samples
+	offset = 0;
+	while (offset < blockSize)
 	{
-		masterFX_Chorus->processAudio(masterFXRender);
+		uint32_t chunkLength = blockSize - offset;
+		if (chunkLength > kDelayFXBlockSize - masterFXUpdateCounter)
+			chunkLength = kDelayFXBlockSize - masterFXUpdateCounter;
+
+		bool updateMasterFX = masterFXUpdateCounter == 0;
+		masterFXUpdateCounter += chunkLength;
+		if (masterFXUpdateCounter == kDelayFXBlockSize)
+			masterFXUpdateCounter = 0;
+
+		if (updateMasterFX)
+			updateMasterFXChain();
+
+		masterFXChain.processAudioBlock(&leftBuffer[offset], &rightBuffer[offset], chunkLength, updateMasterFX);
+		offset += chunkLength;
 	}
 
-	// --- master FX: DELAY
-	if (masterFX_Delay->getModifiers()->enabled)
+	// --- the last frame stays in the output array
+	if (blockSize > 0)
 	{
-		masterFX_Delay->processAudio(masterFXRender);
+		outputs[kEngineLeftOutput] = leftBuffer[blockSize - 1];
+		outputs[kEngineRightOutput] = rightBuffer[blockSize - 1];
 	}
 
-	// --- copy to output arrays
-	renderInfo.outputData[0] = outputs[kEngineLeftOutput];
-	renderInfo.outputData[1] = outputs[kEngineRightOutput];
+	// --- meters and voice activity; the render time comes from the caller, see setTelemetryRenderTime( )
+	updateTelemetry(leftBuffer, rightBuffer, blockSize, activeVoices);
 
 	return true;
 }
 
+/**
+	\brief Accumulate a block of telemetry from the engine outputs; at the end of each kTelemetryBlockSize block, take the
+	voice snapshot and push the frame to the telemetry ring. If the reader has fallen behind and the ring is full the
+	frame is dropped; the audio thread never waits.
+
+	\param leftBuffer -- left channel output for the block
+	\param rightBuffer -- right channel output for the block
+	\param blockSize -- number of samples in the block
+	\param activeVoices -- most voices rendered at once in this block
+*/
+void SynthEngine::updateTelemetry(const double* leftBuffer, const double* rightBuffer, uint32_t blockSize, uint32_t activeVoices)
+{
+	const double* buffers[kNumEngineOutputs] = { leftBuffer, rightBuffer };
+	uint32_t offset = 0;
+	while (offset < blockSize)
+	{
+		// --- the part of the block that falls in the current frame
+		uint32_t count = blockSize - offset;
+		if (count > kTelemetryBlockSize - telemetrySampleCounter)
+			count = kTelemetryBlockSize - telemetrySampleCounter;
+
+		for (uint32_t channel = 0; channel < kNumEngineOutputs; channel++)
+		{
+			const double* buffer = &buffers[channel][offset];
+			double peak = telemetryFrame.peak[channel];
+			double sumSquares = telemetrySumSquares[channel];
+			for (uint32_t i = 0; i < count; i++)
+			{
+				double level = fabs(buffer[i]);
+				if (level > peak)
+					peak = level;
+				sumSquares += buffer[i] * buffer[i];
+			}
+			telemetryFrame.peak[channel] = (float)peak;
+			telemetrySumSquares[channel] = sumSquares;
+		}
+
+		if (activeVoices > telemetryFrame.activeVoices)
+			telemetryFrame.activeVoices = activeVoices;
+
+		offset += count;
+		telemetrySampleCounter += count;
+		if (telemetrySampleCounter == kTelemetryBlockSize)
+			publishTelemetryFrame();
+	}
+}
+
+/**
+	\brief Finish the telemetry frame, push it to the ring and start the next one
+*/
+void SynthEngine::publishTelemetryFrame()
+{
+	// --- finish the frame
+	for (uint32_t channel = 0; channel < kNumEngineOutputs; channel++)
+		telemetryFrame.rms[channel] = (float)sqrt(telemetrySumSquares[channel] / (double)kTelemetryBlockSize);
+
+	telemetryFrame.stealCount = voiceStealCount;
+	double renderTime_uSec = telemetryRenderTimePerSample_uSec*kTelemetryBlockSize;
+	telemetryFrame.renderTime_uSec = (float)renderTime_uSec;
+	telemetryFrame.cpuLoad = sampleRate > 0.0 ? (float)(renderTime_uSec*sampleRate / (1000000.0*kTelemetryBlockSize)) : 0.f;
+
+	for (uint32_t i = 0; i < NUM_VOICE_SLOTS; i++)
+	{
+		bool running = synthVoices[i]->isComponentRunning();
+		telemetryFrame.voiceEGState[i] = running ? (uint8_t)synthVoices[i]->getOutputEGState() : (uint8_t)egState::kOff;
+		telemetryFrame.voiceNote[i] = running ? (uint8_t)synthVoices[i]->getMidiNoteNumber() : 0;
+	}
+
+	telemetryRing.pushFrame(telemetryFrame);
+
+	// --- next block
+	telemetryFrame.blockIndex++;
+	telemetryFrame.peak[0] = telemetryFrame.peak[1] = 0.f;
+	telemetryFrame.activeVoices = 0;
+	telemetrySumSquares[0] = telemetrySumSquares[1] = 0.0;
+	telemetrySampleCounter = 0;
+}
+
+/**
+	\brief Apply the master FX order (only if it changed and is a valid permutation) and map the FX enable
+	modifiers to the chain's crossfaded bypass switches
+*/
+void SynthEngine::updateMasterFXChain()
+{
+	ISynthAudioProcessor* masterFX[kNumMasterFX] = { masterFX_Chorus, masterFX_Ensemble, masterFX_Delay, masterFX_Reverb };
+
+	if (memcmp(masterFXOrder, modifiers->masterFXOrder, sizeof(masterFXOrder)) != 0)
+	{
+		memcpy(masterFXOrder, modifiers->masterFXOrder, sizeof(masterFXOrder));
+
+		bool used[kNumMasterFX] = { false };
+		bool validOrder = true;
+		for (uint32_t i = 0; i < kNumMasterFX; i++)
+		{
+			if (masterFXOrder[i] >= kNumMasterFX || used[masterFXOrder[i]])
+			{
+				validOrder = false;
+				break;
+			}
+			used[masterFXOrder[i]] = true;
+		}
+
+		// --- move each FX into its position, front to back
+		if (validOrder)
+		{
+			for (uint32_t i = 0; i < kNumMasterFX; i++)
+				masterFXChain.moveSlot(masterFXChain.getSlotIndex(masterFX[masterFXOrder[i]]), i);
+		}
+	}
+
+	masterFXChain.setBypass(masterFX_Chorus, !modifiers->chorusFXModifiers->enabled);
+	masterFXChain.setBypass(masterFX_Ensemble, !modifiers->ensembleFXModifiers->enabled);
+	masterFXChain.setBypass(masterFX_Delay, !modifiers->delayFXModifiers->enabled);
+	masterFXChain.setBypass(masterFX_Reverb, !modifiers->reverbFXModifiers->enabled);
+}
+
 /**
 	\brief The MIDI event handler function; for note on/off messages it finds the voices to turn on/off.
 	MIDI CC information is placed in the shared CC array.
@@ -174,6 +519,15 @@ bool SynthEngine::render(RenderInfo& renderInfo)
 */
 bool SynthEngine::processMIDIEvent(midiEvent& event)
 {
+	SYNTH_AUDIO_THREAD_SCOPE();
+
+	// --- MPE member channels carry per-note expression (poly and unison modes)
+	if (enableMPE && synthMode != synthMode::kMono && event.midiChannel != MPE_MASTER_CHANNEL && event.midiChannel < MPE_NUM_CHANNELS)
+	{
+		if (processMPEEvent(event))
+			return true;
+	}
+
 	// --- note on and note off are specialized functions
 	if (event.midiMessage == NOTE_ON)
 	{
@@ -186,48 +540,9 @@ bool SynthEngine::processMIDIEvent(midiEvent& event)
 			synthVoices[0]->doNoteOn(event.midiData1, event.midiData2, synthVoices[0]->isComponentRunning());
 			return true;
 		}
-		else if (synthMode == synthMode::kUnison)
-		{
-			// --- create our stacked unison (aka supersaw when using sawtooth)
-			doUnisonNoteOn(event.midiData1, event.midiData2);
-			return true;
-		}
-
-		// --- is this note already playing?
-		int index = getVoiceIndexWithNote(event.midiData1);
 
-		// --- if not try to find a free one
-		if (index < 0)
-			index = getFreeVoiceIndex();
-
-		// --- if no free voice, find one to steal
-		bool stealVoice = false;
-		if (index < 0)
-		{
-			index = getVoiceIndexToSteal();
-			stealVoice = true;
-		}
-
-		// --- should always have an index to work with
-		if (index >= 0)
-		{
-			//if(stealVoice)
-			// TRACE("-- Stealing Voice Index:%d \n", index);
-
-			// --- advance timestamps
-			incrementVoiceTimestamps();
-
-			// --- store global data for note ON event: set previous note-on data
-			globalMIDIData[kLastMIDINoteNumber] = globalMIDIData[kCurrentMIDINoteNumber];
-			globalMIDIData[kLastMIDINoteVelocity] = globalMIDIData[kCurrentMIDINoteVelocity];
-
-			// --- current data
-			globalMIDIData[kCurrentMIDINoteNumber] = event.midiData1;
-			globalMIDIData[kCurrentMIDINoteVelocity] = event.midiData2;
-
-			// --- call note on with steal flag
-			synthVoices[index]->doNoteOn(event.midiData1, event.midiData2, stealVoice);
-		}
+		// --- poly and unison modes; a unison note is one voice with stacked oscillators
+		doPolyNoteOn(event.midiData1, event.midiData2);
 	}
 	else if (event.midiMessage == NOTE_OFF)
 	{
@@ -241,12 +556,6 @@ bool SynthEngine::processMIDIEvent(midiEvent& event)
 				//	return true;
 			}
 		}
-		else if (synthMode == synthMode::kUnison)
-		{
-			// --- kill our stacked unison (aka supersaw when using sawtooth)
-			doUnisonNoteOff(event.midiData1, event.midiData2);
-			//return true;
-		}
 
 		int index = getVoiceIndexForNoteOffWithNote(event.midiData1);
 		if (index >= 0)
@@ -254,6 +563,7 @@ bool SynthEngine::processMIDIEvent(midiEvent& event)
 			// TRACE("-- FOUND NOTE OFF index:%d \n", index);
 
 			synthVoices[index]->doNoteOff(event.midiData1, event.midiData2);
+			unmapMPEVoice(index);
 		}
 		else
 			int t = 0;
@@ -278,6 +588,209 @@ bool SynthEngine::processMIDIEvent(midiEvent& event)
 	return true;
 }
 
+/**
+	\brief Find a voice for a poly mode note-on event (re-trigger, free, or steal) and start the note.
+	A stolen note is handed over: it fades out on its own voice while the new note starts at once on a spare (ghost)
+	voice. Only if all the spare voices are still busy fading does the new note wait for the stolen voice to shut down.
+
+	\param midiNoteNumber the note number
+	\param midiNoteVelocity the note velocity
+
+	\return the voice index that received the note, or -1 if none
+*/
+int SynthEngine::doPolyNoteOn(uint32_t midiNoteNumber, uint32_t midiNoteVelocity)
+{
+	// --- is this note already playing?
+	int index = getVoiceIndexWithNote(midiNoteNumber);
+
+	// --- if not try to find a free one
+	if (index < 0)
+		index = getFreeVoiceIndex();
+
+	// --- if no free voice, find one to steal
+	bool stealVoice = false;
+	if (index < 0)
+	{
+		int stealIndex = getVoiceIndexToSteal();
+		if (stealIndex >= 0)
+		{
+			voiceStealCount++;
+
+			// --- the stolen note no longer follows its MPE channel
+			unmapMPEVoice(stealIndex);
+
+			// --- a voice that is already shutting down for a pending note just takes the new note instead
+			int spareIndex = -1;
+			if (synthVoices[stealIndex]->getOutputEGState() != egState::kShutdown)
+				spareIndex = getSpareVoiceIndex();
+
+			if (spareIndex >= 0)
+			{
+				// --- fade the stolen note out alongside the new one
+				synthVoices[stealIndex]->doFadeOut();
+				index = spareIndex;
+			}
+			else
+			{
+				// --- no spare voice: the new note waits for the stolen one to shut down
+				index = stealIndex;
+				stealVoice = true;
+			}
+		}
+	}
+
+	// --- should always have an index to work with
+	if (index >= 0)
+	{
+		//if(stealVoice)
+		// TRACE("-- Stealing Voice Index:%d \n", index);
+
+		// --- advance timestamps
+		incrementVoiceTimestamps();
+
+		// --- store global data for note ON event: set previous note-on data
+		globalMIDIData[kLastMIDINoteNumber] = globalMIDIData[kCurrentMIDINoteNumber];
+		globalMIDIData[kLastMIDINoteVelocity] = globalMIDIData[kCurrentMIDINoteVelocity];
+
+		// --- current data
+		globalMIDIData[kCurrentMIDINoteNumber] = midiNoteNumber;
+		globalMIDIData[kCurrentMIDINoteVelocity] = midiNoteVelocity;
+
+		// --- call note on with steal flag; the voice starts with neutral MPE expression on no channel
+		unmapMPEVoice(index);
+		synthVoices[index]->doNoteOn(midiNoteNumber, midiNoteVelocity, stealVoice);
+	}
+
+	return index;
+}
+
+/**
+	\brief Handle a message on an MPE member channel: note on/off maintain the channel -> voice map, and pitch bend,
+	channel pressure and CC74 (slide) update the per-note expression of the voice on that channel.
+
+	\param event a single MIDI Event on a member channel
+
+	\return true if handled, false to let the normal (global) MIDI processing handle it
+*/
+bool SynthEngine::processMPEEvent(midiEvent& event)
+{
+	uint32_t channel = event.midiChannel;
+
+	if (event.midiMessage == NOTE_ON && event.midiData2 > 0)
+	{
+		// --- doPolyNoteOn( ) has already dropped the voice from any other channel
+		int index = doPolyNoteOn(event.midiData1, event.midiData2);
+		if (index < 0)
+			return true;
+
+		mpeChannelVoice[channel] = index;
+
+		// --- controllers send initial expression before the note-on
+		synthVoices[index]->setMPEExpression(mpeChannelExpression[channel]);
+		return true;
+	}
+	else if (event.midiMessage == NOTE_OFF || event.midiMessage == NOTE_ON) // --- note-on with velocity 0 is note-off
+	{
+		int index = mpeChannelVoice[channel];
+		if (index < 0 || 
+			(synthVoices[index]->getMidiNoteNumber() != event.midiData1 && synthVoices[index]->getMidiNoteStealNumber() != event.midiData1))
+			index = getVoiceIndexForNoteOffWithNote(event.midiData1);
+
+		if (index >= 0)
+		{
+			synthVoices[index]->doNoteOff(event.midiData1, event.midiData2);
+			unmapMPEVoice(index);
+		}
+
+		// --- the releasing note keeps its last expression, but the channel is free
+		mpeChannelVoice[channel] = -1;
+		return true;
+	}
+
+	// --- per-note expression
+	MPEExpression& expression = mpeChannelExpression[channel];
+	if (event.midiMessage == PITCH_BEND)
+		expression.pitchBend_semitones = modifiers->mpePitchBendRange * midiPitchBendToBipolar(event.midiData1, event.midiData2);
+	else if (event.midiMessage == CHANNEL_PRESSURE)
+		expression.pressure = event.midiData1 / 127.0;
+	else if (event.midiMessage == CONTROL_CHANGE && event.midiData1 == MPE_SLIDE_CC74)
+		expression.slide = event.midiData2 / 127.0;
+	else
+		return false; // --- not expression; process normally
+
+	// --- O(1) lookup of the voice on this channel
+	if (mpeChannelVoice[channel] >= 0)
+		synthVoices[mpeChannelVoice[channel]]->setMPEExpression(expression);
+
+	return true;
+}
+
+/**
+	\brief Remove a voice from the MPE member channel map; expression on its old channel no longer reaches it
+
+	\param voiceIndex the voice that was released, stolen or is about to start a new note
+*/
+void SynthEngine::unmapMPEVoice(int voiceIndex)
+{
+	for (unsigned int i = 0; i < MPE_NUM_CHANNELS; i++)
+	{
+		if (mpeChannelVoice[i] == voiceIndex)
+			mpeChannelVoice[i] = -1;
+	}
+}
+
+/**
+	\brief Queue a MIDI event for sample accurate dispatch from render( ); the event's midiSampleOffset is relative to the
+	top of the current buffer. Events must be queued in offset order (hosts deliver them this way). Call from the audio thread only.
+
+	\param event a single MIDI Event to queue
+
+	\return true if queued, false if the queue is full (event dropped)
+*/
+bool SynthEngine::queueMIDIEvent(midiEvent& event)
+{
+	return midiEventRing.pushEvent(event);
+}
+
+/**
+	\brief Queue a MIDI event from a single non-audio thread (e.g. a virtual keyboard or test harness); lock-free and
+	allocation free. The event is fired at the top of the next render cycle regardless of its midiSampleOffset.
+
+	\param event a single MIDI Event to queue
+
+	\return true if queued, false if the queue is full (event dropped)
+*/
+bool SynthEngine::queueExternalMIDIEvent(midiEvent& event)
+{
+	return externalMIDIEventRing.pushEvent(event);
+}
+
+/**
+	\brief Fire all queued MIDI events that are due at the given sample offset; late events are fired immediately
+
+	\param sampleOffset the sample index within the current buffer
+*/
+void SynthEngine::dispatchMIDIEvents(uint32_t sampleOffset)
+{
+	const midiEvent* event = nullptr;
+
+	// --- external events are not sample stamped
+	while ((event = externalMIDIEventRing.peekEvent()) != nullptr)
+	{
+		midiEvent externalEvent = *event;
+		externalMIDIEventRing.popEvent();
+		processMIDIEvent(externalEvent);
+	}
+
+	// --- host events, in offset order
+	while ((event = midiEventRing.peekEvent()) != nullptr && event->midiSampleOffset <= sampleOffset)
+	{
+		midiEvent hostEvent = *event;
+		midiEventRing.popEvent();
+		processMIDIEvent(hostEvent);
+	}
+}
+
 /**
 	\brief Retrieve a MIDI global value
 
@@ -325,7 +838,7 @@ bool SynthEngine::setMIDIOutputEvent(midiEvent& event)
 */
 void SynthEngine::incrementVoiceTimestamps()
 {
-	for (unsigned int i = 0; i < MAX_VOICES; i++)
+	for (unsigned int i = 0; i < NUM_VOICE_SLOTS; i++)
 	{
 		if (synthVoices[i]->isComponentRunning())
 			synthVoices[i]->incrementTimestamp();
@@ -333,13 +846,44 @@ void SynthEngine::incrementVoiceTimestamps()
 }
 
 /**
-	\brief Get the array index of a free voice that is ready for note on event.
+	\brief Get the number of voices playing a note; voices fading out a handed over note do not count.
+
+	\return number of playing voices
+*/
+uint32_t SynthEngine::getPlayingVoiceCount()
+{
+	uint32_t count = 0;
+	for (unsigned int i = 0; i < NUM_VOICE_SLOTS; i++)
+	{
+		if (synthVoices[i]->isComponentRunning() && !synthVoices[i]->isFadingOut())
+			count++;
+	}
+
+	return count;
+}
+
+/**
+	\brief Get the array index of a free voice that is ready for note on event; MAX_VOICES may play at once, the
+	remaining NUM_GHOST_VOICES voices are kept for handing over stolen notes.
 
 	\return array index or -1 if no voices are free
 */
 int SynthEngine::getFreeVoiceIndex()
 {
-	for (unsigned int i = 0; i < MAX_VOICES; i++)
+	if (getPlayingVoiceCount() >= MAX_VOICES)
+		return -1;
+
+	return getSpareVoiceIndex();
+}
+
+/**
+	\brief Get the array index of any voice that is not running, including the ghost voices.
+
+	\return array index or -1 if all voices are running
+*/
+int SynthEngine::getSpareVoiceIndex()
+{
+	for (unsigned int i = 0; i < NUM_VOICE_SLOTS; i++)
 	{
 		if (!synthVoices[i]->isComponentRunning())
 			return i;
@@ -349,25 +893,46 @@ int SynthEngine::getFreeVoiceIndex()
 }
 
 /**
-	\brief Get the array index of a voice to steal; the heuristic used here is to steal the oldest note.
+	\brief Get the array index of a voice to steal. Released voices go first, the quietest (lowest output EG level)
+	of them; then held voices, the oldest of them; voices shutting down for a pending note go last. Voices that are
+	fading out are never stolen.
 
 	\return array index or -1 if no voices are free for stealing
 */
 int SynthEngine::getVoiceIndexToSteal()
 {
-	int nTimeStamp = -1;
 	int foundIndex = -1;
-	for (int i = 0; i<MAX_VOICES; i++)
+	int foundRank = 0;
+	double foundLevel = 0.0;
+	unsigned int foundTimestamp = 0;
+
+	for (int i = 0; i < NUM_VOICE_SLOTS; i++)
 	{
-		if (synthVoices[i])
+		if (!synthVoices[i]->isComponentRunning() || synthVoices[i]->isFadingOut())
+			continue;
+
+		// --- rank: 0 = released, 1 = held, 2 = shutting down
+		egState state = synthVoices[i]->getOutputEGState();
+		int rank = state == egState::kRelease ? 0 : (state == egState::kShutdown ? 2 : 1);
+		double level = synthVoices[i]->getOutputEGLevel();
+		unsigned int timestamp = synthVoices[i]->getTimestamp();
+
+		// --- lower rank wins; released voices by level, the others by age (highest timestamp is oldest)
+		bool better = foundIndex < 0 || rank < foundRank;
+		if (!better && rank == foundRank)
 		{
-			// if on and older, save
-			// highest timestamp is oldest
-			if (synthVoices[i]->isComponentRunning() && (int)synthVoices[i]->getTimestamp() > nTimeStamp)
-			{
-				foundIndex = i;
-				nTimeStamp = (int)synthVoices[i]->getTimestamp();
-			}
+			if (rank == 0 && level != foundLevel)
+				better = level < foundLevel;
+			else
+				better = timestamp > foundTimestamp;
+		}
+
+		if (better)
+		{
+			foundIndex = i;
+			foundRank = rank;
+			foundLevel = level;
+			foundTimestamp = timestamp;
 		}
 	}
 
@@ -383,9 +948,9 @@ int SynthEngine::getVoiceIndexToSteal()
 */
 int SynthEngine::getVoiceIndexWithNote(unsigned int midiNoteNumber)
 {
-	for (int i = 0; i < MAX_VOICES; i++)
+	for (int i = 0; i < NUM_VOICE_SLOTS; i++)
 	{
-		if (synthVoices[i] && synthVoices[i]->isComponentRunning() && synthVoices[i]->getMidiNoteNumber() == midiNoteNumber)
+		if (synthVoices[i] && synthVoices[i]->isComponentRunning() && !synthVoices[i]->isFadingOut() && synthVoices[i]->getMidiNoteNumber() == midiNoteNumber)
 			return i;
 	}
 
@@ -401,64 +966,21 @@ int SynthEngine::getVoiceIndexWithNote(unsigned int midiNoteNumber)
 */
 int SynthEngine::getVoiceIndexForNoteOffWithNote(unsigned int midiNoteNumber)
 {
-	for (int i = 0; i < MAX_VOICES; i++)
+	for (int i = 0; i < NUM_VOICE_SLOTS; i++)
 	{
-		if (synthVoices[i] && synthVoices[i]->isComponentRunning() && ( synthVoices[i]->getMidiNoteNumber() == midiNoteNumber || synthVoices[i]->getMidiNoteStealNumber() == midiNoteNumber) )
+		if (synthVoices[i] && synthVoices[i]->isComponentRunning() && !synthVoices[i]->isFadingOut() && ( synthVoices[i]->getMidiNoteNumber() == midiNoteNumber || synthVoices[i]->getMidiNoteStealNumber() == midiNoteNumber) )
 			return i;
 	}
 
 	return -1;
 }
 
-/**
-	\brief Create the unison voice by using multiple panned and detuned voices.
-
-	\param midiNoteNumber the note number to tes
-	\param midiNoteVelocity the note velocity
-*/
-void SynthEngine::doUnisonNoteOn(uint32_t midiNoteNumber, uint32_t midiNoteVelocity)
-{
-	double panValue = -1.0;
-	double panInc = 1.0 / ((MAX_UNISON_VOICES - 1) / 2.0); // assumes ODD number of voices so center voice is center panned and not detuned
-
-	double unisonDetuneIntensity = -1.0;
-	double unisonDetuneInc = 1.0 / ((MAX_UNISON_VOICES - 1) / 2.0); // assumes ODD number of voices so center voice is center panned and not detuned
-
-	for (unsigned int i = 0; i < MAX_UNISON_VOICES; i++)
-	{
-		// --- check if running?
-		synthVoices[i]->setVoicePanValue(panValue);
-		synthVoices[i]->setUnisonDetuneIntensity(unisonDetuneIntensity);
-
-		synthVoices[i]->doNoteOn(midiNoteNumber, midiNoteVelocity, synthVoices[i]->isComponentRunning(), true);
-
-		panValue += panInc;
-		unisonDetuneIntensity += unisonDetuneInc;
-	}
-
-}
-
-/**
-	\brief Place the unison voice into note-off mode.
-
-	\param midiNoteNumber the note number to tes
-	\param midiNoteVelocity the note velocity
-*/
-void SynthEngine::doUnisonNoteOff(uint32_t midiNoteNumber, uint32_t midiNoteVelocity)
-{
-	for (unsigned int i = 0; i < MAX_UNISON_VOICES; i++)
-	{
-		synthVoices[i]->doNoteOff(midiNoteNumber, midiNoteVelocity); 
-	}
-
-}
-
 /**
 	\brief Reset the engine to all-notes-off state by shutting down all components
 */
 void SynthEngine::resetEngine()
 {
-	for (unsigned int i = 0; i < MAX_VOICES; i++)
+	for (unsigned int i = 0; i < NUM_VOICE_SLOTS; i++)
 	{
 		synthVoices[i]->stopComponent();
 	}
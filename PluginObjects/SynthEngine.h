@@ -1,9 +1,23 @@
 #pragma once
 #include "SynthVoice.h"
 #include "DelayFX.h" // delay FX suite
+#include "EnsembleFX.h" // multi-tap chorus
+#include "ReverbFX.h" // FDN reverb
+#include "FXChain.h" // master FX slots
+#include "MIDIEventRing.h" // sample accurate MIDI
+#include "EngineTelemetry.h" // meters and voice activity for the GUI
+#include "AllocationTripwire.h" // debug check for audio thread allocations
 
 #define MAX_VOICES 16 // in release mode with granularity at 128, can easily get > 50 voices
-#define MAX_UNISON_VOICES 7 // --- see notes about unison panning and detuning!
+#define NUM_GHOST_VOICES 4 // spare voices that fade out stolen notes while the new notes start; see doPolyNoteOn()
+#define NUM_VOICE_SLOTS (MAX_VOICES + NUM_GHOST_VOICES) // voice objects; at most MAX_VOICES of them play notes
+
+// --- telemetry and profiling keep one entry per voice slot
+static_assert(kMaxTelemetryVoices == NUM_VOICE_SLOTS, "kMaxTelemetryVoices must match NUM_VOICE_SLOTS");
+static_assert(kMaxProfileVoices == NUM_VOICE_SLOTS, "kMaxProfileVoices must match NUM_VOICE_SLOTS");
+
+// --- global LFOs are rendered once per block of this many samples; matches the voice update granularity
+const uint32_t kGlobalLFOBlockSize = 64;
 
 // --- outputs[] indexes for this component
 enum {
@@ -14,6 +28,15 @@ enum {
 
 enum class synthMode { kPoly, kMono, kUnison};
 
+// --- master FX, for SynthEngineModifiers::masterFXOrder
+enum {
+	kMasterFXChorus,
+	kMasterFXEnsemble,
+	kMasterFXDelay,
+	kMasterFXReverb,
+	kNumMasterFX
+};
+
 /**
 	\struct SynthEngineModifiers
 	\ingroup SynthStructures
@@ -27,6 +50,14 @@ enum class synthMode { kPoly, kMono, kUnison};
 	\param masterVolume_dB:				master volume control in dB
 	\param masterPitchBend:				master pitch bend control in semitones
 	\param unisonDetune_Cents:			maximum detuning offset for unison mode in cents
+	\param unisonCount:					oscillators stacked per note in unison mode [1, kMaxUnisonOscillators]; osc1 and osc2 are stacked
+	\param enableMPE:					enable MIDI Polyphonic Expression (poly mode only); member channels get per-note expression
+	\param mpePitchBendRange:			per-note pitch bend range in semitones for MPE member channels
+	\param globalLFO1Modifiers:			modifiers for global LFO1 (always free running)
+	\param globalLFO2Modifiers:			modifiers for global LFO2 (always free running)
+	\param ensembleFXModifiers:			modifiers for the master ensemble (multi-tap chorus)
+	\param reverbFXModifiers:			modifiers for the master reverb
+	\param masterFXOrder:				processing order of the master FX; must be a permutation of the kMasterFX indexes
 */
 struct SynthEngineModifiers
 {
@@ -48,14 +79,34 @@ struct SynthEngineModifiers
 	// --- unison Detune
 	double unisonDetune_Cents = 0.0;
 
+	// --- unison stack size
+	uint32_t unisonCount = 7;
+
+	// --- MPE
+	bool enableMPE = false;
+	unsigned int mpePitchBendRange = 48;	// --- MPE spec default for member channels
+
 	// --- modifiers for our sub-components
 	std::shared_ptr<SynthVoiceModifiers> voiceModifiers = std::make_shared<SynthVoiceModifiers>();
 
+	// --- modifiers for the global LFOs
+	std::shared_ptr<LFOModifiers> globalLFO1Modifiers = std::make_shared<LFOModifiers>();
+	std::shared_ptr<LFOModifiers> globalLFO2Modifiers = std::make_shared<LFOModifiers>();
+
 	// --- modifiers for master FX: Chorus
 	std::shared_ptr<DelayFXModifiers> chorusFXModifiers = std::make_shared<DelayFXModifiers>();
 
 	// --- modifiers for master FX: Delay
 	std::shared_ptr<DelayFXModifiers> delayFXModifiers = std::make_shared<DelayFXModifiers>();
+
+	// --- modifiers for master FX: Ensemble
+	std::shared_ptr<EnsembleFXModifiers> ensembleFXModifiers = std::make_shared<EnsembleFXModifiers>();
+
+	// --- modifiers for master FX: Reverb
+	std::shared_ptr<ReverbFXModifiers> reverbFXModifiers = std::make_shared<ReverbFXModifiers>();
+
+	// --- master FX order, first to last
+	uint32_t masterFXOrder[kNumMasterFX] = { kMasterFXChorus, kMasterFXEnsemble, kMasterFXDelay, kMasterFXReverb };
 };
 
 /**
@@ -77,6 +128,14 @@ struct SynthEngineModifiers
 	\param masterVolume_dB:				master volume control in dB
 	\param masterPitchBend:				master pitch bend control in semitones
 	\param unisonDetune_Cents:			maximum detuning offset for unison mode in cents
+	\param unisonCount:					oscillators stacked per note in unison mode
+
+	Unison mode is polyphonic: notes are allocated as in poly mode and each voice stacks unisonCount detuned copies of
+	osc1 and osc2 (see SynthOscillator), sharing the voice's EGs, filters and DCA.
+
+	Block rendering:
+	renderBlock( ) renders each voice over runs of samples between MIDI events and global LFO updates, sums the voices into
+	the block and runs the master FXChain on the whole block; render( ) is a one sample renderBlock( ).
 
 	Modulator indexes:
 	- this component contains no modulators
@@ -95,12 +154,30 @@ public:
 	virtual bool reset(ResetInfo& resetInfo);
 	virtual bool update(UpdateInfo& updateInfo);
 	virtual bool render(RenderInfo& renderInfo);
+
+	// --- render a block: the voices are summed into the buffers, then the master FX process the whole block in place
+	bool renderBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize, uint32_t sampleOffset);
 	virtual bool processMIDIEvent(midiEvent& event);
 
+	// --- sample accurate MIDI: events are queued up front and dispatched from render( ) at their midiSampleOffset
+	bool queueMIDIEvent(midiEvent& event);
+	bool queueExternalMIDIEvent(midiEvent& event);
+	void dispatchMIDIEvents(uint32_t sampleOffset);
+
+	/** fire all remaining queued events; call at the end of a host buffer */
+	void flushMIDIEvents() { dispatchMIDIEvents(0xFFFFFFFF); }
+
 	// --- IMIDIData
 	virtual uint32_t getMidiGlobalData(uint32_t index);
 	virtual uint32_t getMidiCCData(uint32_t index);
 	virtual bool setMIDIOutputEvent(midiEvent& event);
+	virtual SynthTransport* getTransport() { return &transport; }
+	virtual EGCoefficientCache* getEGCoefficientCache() { return &egCoefficientCache; }
+	virtual OscillatorWaveTables* getOscillatorWaveTables() { return &oscillatorWaveTables; }
+
+	// --- host transport: call at the top of each buffer; render( ) adds the sample offset
+	void setHostTransport(double bpm, double timeSigNumerator, uint32_t timeSigDenominator, uint64_t bufferStartSampleIndex);
+	void continueTransport();
 
 	// --- our modifiers
 	std::shared_ptr<SynthEngineModifiers> modifiers = std::make_shared<SynthEngineModifiers>(); ///<engine modifiers
@@ -113,19 +190,44 @@ public:
 
 	// --- voice-stealing functions
 	void incrementVoiceTimestamps();
+	uint32_t getPlayingVoiceCount();
 	int getFreeVoiceIndex();
+	int getSpareVoiceIndex();
 	int getVoiceIndexToSteal();
 	int getVoiceIndexWithNote(unsigned int midiNoteNumber);
 	int getVoiceIndexForNoteOffWithNote(unsigned int midiNoteNumber);
 
-	// --- special functions for unison mode
-	void doUnisonNoteOn(uint32_t midiNoteNumber, uint32_t midiNoteVelocity);
-	void doUnisonNoteOff(uint32_t midiNoteNumber, uint32_t midiNoteVelocity);
+	// --- poly mode note-on; returns the voice index that received the note, or -1
+	int doPolyNoteOn(uint32_t midiNoteNumber, uint32_t midiNoteVelocity);
+
+	/** telemetry ring; the GUI timer (or any ONE reader) drains it with popFrame( ) or popLatestFrame( ) */
+	EngineTelemetryRing* getTelemetryRing() { return &telemetryRing; }
+
+	/** set the render time that the telemetry frames report, measured by the caller over sampleCount samples; the
+	    caller times whole host buffers, so the clock is read twice per buffer and not per sample */
+	void setTelemetryRenderTime(double renderTime_uSec, uint32_t sampleCount)
+	{
+		if (sampleCount > 0)
+			telemetryRenderTimePerSample_uSec = renderTime_uSec / (double)sampleCount;
+	}
+
+	// --- MPE member channel handler
+	bool processMPEEvent(midiEvent& event);
+
+	// --- drop the member channel mapping of a voice that is released, stolen or given a new note
+	void unmapMPEVoice(int voiceIndex);
 
 protected:
 	// --- reset subcomponents
 	void resetEngine();
 
+	// --- apply the master FX order and enable switches to the chain
+	void updateMasterFXChain();
+
+	// --- accumulate a block of telemetry; publishes a frame at the end of each kTelemetryBlockSize samples
+	void updateTelemetry(const double* leftBuffer, const double* rightBuffer, uint32_t blockSize, uint32_t activeVoices);
+	void publishTelemetryFrame();
+
 	// --- flush outputs
 	void clearOutputs()
 	{
@@ -143,10 +245,59 @@ protected:
 	// --- current mode
 	synthMode synthMode = synthMode::kPoly;				///< current mode of the synth
 
+	// --- current voice oversampling
+	oversamplingMode oversampling = oversamplingMode::k1x;	///< oversampling mode of all voices
+
+	// --- MPE state: O(1) member channel -> voice mapping and the last expression seen on each channel
+	bool enableMPE = false;								///< current MPE state
+	int mpeChannelVoice[MPE_NUM_CHANNELS];				///< voice index playing on each member channel, or -1
+	MPEExpression mpeChannelExpression[MPE_NUM_CHANNELS];	///< expression per member channel; copied to the voice at note-on
+
+	// --- voice storage: each voice and all of its components are one cache line aligned region of the arena; declared
+	//     before the voices, so it outlives them
+	SynthArena voiceArena;												///< owns the voices and their components
+	size_t voiceArenaRegionSize = 0;									///< bytes per voice, measured on the first one
+
 	// --- array of voice object pointers
-	std::unique_ptr<SynthVoice> synthVoices[MAX_VOICES] = { 0 };		///< array of voice objects for the engine
+	SynthVoice* synthVoices[NUM_VOICE_SLOTS] = { nullptr };					///< array of voice objects for the engine, in voiceArena
+
+	// --- preallocated MIDI event queues
+	MIDIEventRing midiEventRing;						///< host events for the current buffer, filled and consumed on the audio thread
+	MIDIEventRing externalMIDIEventRing;				///< events from ONE external producer (virtual keyboard, test harness); fired immediately
 
 	DelayFX* masterFX_Chorus = nullptr;
 	DelayFX* masterFX_Delay = nullptr;
+	EnsembleFX* masterFX_Ensemble = nullptr;
+	ReverbFX* masterFX_Reverb = nullptr;
+
+	// --- the master FX slots, processed in place on the engine outputs
+	FXChain masterFXChain;											///< master FX in processing order
+	uint32_t masterFXOrder[kNumMasterFX] = { kMasterFXChorus, kMasterFXEnsemble, kMasterFXDelay, kMasterFXReverb };	///< order currently in the chain
+
+	// --- global LFOs: one phase for all voices, rendered at control rate
+	LFO* globalLFO1 = nullptr;
+	LFO* globalLFO2 = nullptr;
+	uint32_t globalLFOBlockCounter = 0;				///< sample counter within the current global LFO block
+	uint32_t masterFXUpdateCounter = 0;				///< sample counter between master FX updates
+
+	// --- telemetry, written on the audio thread only
+	EngineTelemetryRing telemetryRing;				///< one frame per kTelemetryBlockSize samples, to the GUI
+	EngineTelemetryFrame telemetryFrame;			///< the frame being accumulated
+	double telemetrySumSquares[2] = { 0.0, 0.0 };	///< sum of squares per channel over the block
+	double telemetryRenderTimePerSample_uSec = 0.0;	///< render time per sample of the last timed buffer
+	uint32_t telemetrySampleCounter = 0;			///< samples in the current block
+	uint32_t voiceStealCount = 0;					///< voices stolen since the last reset
+	double sampleRate = 0.0;						///< for the CPU load
+
+	// --- EG coefficients for all voices, shared via IMIDIData::getEGCoefficientCache( ); cleared in reset( )
+	EGCoefficientCache egCoefficientCache;			///< exp/log results of the EG segment calculations
+
+	// --- oscillator wave tables for all voices at every oversampling rate, shared via IMIDIData::getOscillatorWaveTables( );
+	//     calculated in reset( ) so that an oversampling switch in update( ) only re-points the oscillators
+	OscillatorWaveTables oscillatorWaveTables;		///< saw and triangle multi-tables at 1x, 2x and 4x the host rate
+
+	// --- host transport, shared with the components via IMIDIData::getTransport( )
+	SynthTransport transport;						///< tempo, time signature and timeline position of the current sample
+	uint64_t transportBufferStart = 0;				///< timeline position of the first sample in the current buffer
 };
 
@@ -0,0 +1,733 @@
+#include "SynthPatchBank.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <cmath>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/**
+	\brief FNV-1a hash of a patch name; stored in the index and used to place names in the hash table
+
+	\param patchName -- NULL terminated name
+	\return the 32-bit hash
+*/
+uint32_t SynthPatchBank::hashPatchName(const char* patchName)
+{
+	uint32_t hash = 2166136261u;
+	for (uint32_t i = 0; i < kMaxPatchNameLength && patchName[i] != 0; i++)
+	{
+		hash ^= (uint8_t)patchName[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/**
+	\brief Build a signature from the sizes of every structure that is written to disk; a bank written by a build with
+	different modifier structures will fail this check and be rejected rather than decoded into garbage.
+
+	\return the signature
+*/
+uint32_t SynthPatchBank::getLayoutSignature()
+{
+	uint32_t sizes[] = { (uint32_t)sizeof(SynthPatchRecord),
+						 (uint32_t)sizeof(SynthOscModifiers),
+						 (uint32_t)sizeof(FMEngineModifiers),
+						 (uint32_t)sizeof(EGModifiers),
+						 (uint32_t)sizeof(MultiStageEGModifiers),
+						 (uint32_t)sizeof(LFOModifiers),
+						 (uint32_t)sizeof(VALadderFilterModifiers),
+						 (uint32_t)sizeof(DCAModifiers),
+						 (uint32_t)sizeof(DelayFXModifiers),
+						 (uint32_t)sizeof(EnsembleFXModifiers),
+						 (uint32_t)sizeof(ReverbFXModifiers),
+						 (uint32_t)sizeof(ModulatorRouting),
+						 (uint32_t)sizeof(ModulatorControl) };
+
+	uint32_t signature = 2166136261u;
+	for (uint32_t i = 0; i < sizeof(sizes) / sizeof(uint32_t); i++)
+	{
+		signature ^= sizes[i];
+		signature *= 16777619u;
+	}
+	return signature;
+}
+
+/**
+	\brief Map a bank file into memory and validate its header and offsets; nothing is decoded here
+
+	\param bankPath -- path to the bank file
+	\return true if the bank was mapped and is valid
+*/
+bool SynthPatchBank::openBank(const char* bankPath)
+{
+	closeBank();
+
+	if (!bankPath) return false;
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(bankPath, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) return false;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(PatchBankHeader))
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (!mapping)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!view)
+	{
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	fileHandle = file;
+	mappingHandle = mapping;
+	bankSize = (size_t)fileSize.QuadPart;
+	bankData = (const uint8_t*)view;
+#else
+	int file = open(bankPath, O_RDONLY);
+	if (file < 0) return false;
+
+	struct stat fileInfo;
+	if (fstat(file, &fileInfo) != 0 || fileInfo.st_size < (off_t)sizeof(PatchBankHeader))
+	{
+		close(file);
+		return false;
+	}
+
+	void* view = mmap(nullptr, (size_t)fileInfo.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+	// --- the mapping holds its own reference to the file
+	close(file);
+
+	if (view == MAP_FAILED) return false;
+
+	bankSize = (size_t)fileInfo.st_size;
+	bankData = (const uint8_t*)view;
+#endif
+
+	// --- validate the header
+	const PatchBankHeader* bankHeader = (const PatchBankHeader*)bankData;
+	if (bankHeader->magic != kPatchBankMagic ||
+		bankHeader->version != kPatchBankVersion ||
+		bankHeader->layoutSignature != getLayoutSignature() ||
+		bankHeader->patchRecordSize != sizeof(SynthPatchRecord) ||
+		bankHeader->nameHashTableSize == 0 ||
+		(bankHeader->nameHashTableSize & (bankHeader->nameHashTableSize - 1)) != 0)
+	{
+		closeBank();
+		return false;
+	}
+
+	// --- validate the sections (64-bit math so a corrupt count cannot wrap)
+	unsigned long long indexEnd = (unsigned long long)bankHeader->indexOffset + (unsigned long long)bankHeader->patchCount * sizeof(PatchBankIndexEntry);
+	unsigned long long hashEnd = (unsigned long long)bankHeader->nameHashTableOffset + (unsigned long long)bankHeader->nameHashTableSize * sizeof(uint32_t);
+	unsigned long long recordsEnd = (unsigned long long)bankHeader->recordsOffset + (unsigned long long)bankHeader->patchCount * sizeof(SynthPatchRecord);
+
+	if (indexEnd > bankSize || hashEnd > bankSize || recordsEnd > bankSize)
+	{
+		closeBank();
+		return false;
+	}
+
+	// --- validate the names and records; the enums are cast straight from the file when a patch is decoded
+	const PatchBankIndexEntry* bankIndex = (const PatchBankIndexEntry*)(bankData + bankHeader->indexOffset);
+	SynthPatchRecord record;
+	for (uint32_t i = 0; i < bankHeader->patchCount; i++)
+	{
+		if (memchr(bankIndex[i].name, 0, kMaxPatchNameLength) == nullptr ||
+			(unsigned long long)bankIndex[i].recordOffset + sizeof(SynthPatchRecord) > bankSize)
+		{
+			closeBank();
+			return false;
+		}
+
+		memcpy(&record, bankData + bankIndex[i].recordOffset, sizeof(SynthPatchRecord));
+		if (!validatePatchRecord(record))
+		{
+			closeBank();
+			return false;
+		}
+	}
+
+	header = bankHeader;
+	index = bankIndex;
+	nameHashTable = (const uint32_t*)(bankData + header->nameHashTableOffset);
+
+	return true;
+}
+
+/** unmap the bank; safe to call when nothing is mapped */
+void SynthPatchBank::closeBank()
+{
+	if (bankData)
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(bankData);
+		if (mappingHandle) CloseHandle((HANDLE)mappingHandle);
+		if (fileHandle) CloseHandle((HANDLE)fileHandle);
+		mappingHandle = nullptr;
+		fileHandle = nullptr;
+#else
+		munmap((void*)bankData, bankSize);
+#endif
+	}
+
+	bankData = nullptr;
+	bankSize = 0;
+	header = nullptr;
+	index = nullptr;
+	nameHashTable = nullptr;
+}
+
+/**
+	\brief Get a patch name by number; only touches the index, not the patch record
+
+	\param patchNumber -- zero-indexed patch number
+	\return the name (NULL termination is checked in openBank( )), or an empty string if the number is out of range
+*/
+const char* SynthPatchBank::getPatchName(uint32_t patchNumber)
+{
+	if (!header || patchNumber >= header->patchCount) return "";
+	return index[patchNumber].name;
+}
+
+/**
+	\brief Find a patch by name using the hash table stored in the bank
+
+	\param patchName -- NULL terminated name
+	\return the zero-indexed patch number, or -1 if not found
+*/
+int32_t SynthPatchBank::findPatch(const char* patchName)
+{
+	if (!header || !patchName) return -1;
+
+	uint32_t hash = hashPatchName(patchName);
+	uint32_t mask = header->nameHashTableSize - 1;
+
+	// --- linear probe; table is at most half full so this terminates quickly
+	for (uint32_t i = 0; i < header->nameHashTableSize; i++)
+	{
+		uint32_t patchNumber = nameHashTable[(hash + i) & mask];
+		if (patchNumber == kPatchBankNameIndexEmpty)
+			return -1;
+
+		if (patchNumber < header->patchCount &&
+			index[patchNumber].nameHash == hash &&
+			strncmp(index[patchNumber].name, patchName, kMaxPatchNameLength) == 0)
+			return (int32_t)patchNumber;
+	}
+	return -1;
+}
+
+/**
+	\brief Decode one patch from the mapped bank into an existing set of engine modifiers
+
+	\param patchNumber -- zero-indexed patch number
+	\param engineModifiers -- the engine modifiers to overwrite; sub-modifier pointers are preserved
+	\return true if the patch was decoded
+*/
+bool SynthPatchBank::loadPatch(uint32_t patchNumber, std::shared_ptr<SynthEngineModifiers> engineModifiers)
+{
+	if (!header || !engineModifiers || patchNumber >= header->patchCount) return false;
+
+	uint32_t recordOffset = index[patchNumber].recordOffset;
+	if ((unsigned long long)recordOffset + sizeof(SynthPatchRecord) > bankSize) return false;
+
+	// --- copy out of the mapping; this is the only place the record's pages are touched
+	SynthPatchRecord record;
+	memcpy(&record, bankData + recordOffset, sizeof(SynthPatchRecord));
+
+	decodePatch(record, engineModifiers);
+	return true;
+}
+
+/**
+	\brief Flatten the engine modifiers (and all of the shared sub-modifiers) into a patch record
+
+	\param engineModifiers -- the source modifiers
+	\param record -- the destination record
+*/
+void SynthPatchBank::encodePatch(std::shared_ptr<SynthEngineModifiers> engineModifiers, SynthPatchRecord& record)
+{
+	// --- every field is written here; the writer value-initializes the record so its padding bytes are zero
+	record.synthMode = engineModifiers->synthMode;
+	record.masterTuningRatio = engineModifiers->masterTuningRatio;
+	record.masterTuningOffset_cents = engineModifiers->masterTuningOffset_cents;
+	record.masterVolume_dB = engineModifiers->masterVolume_dB;
+	record.masterPitchBend = engineModifiers->masterPitchBend;
+	record.unisonDetune_Cents = engineModifiers->unisonDetune_Cents;
+	record.unisonCount = engineModifiers->unisonCount;
+	record.enableMPE = engineModifiers->enableMPE;
+	record.mpePitchBendRange = engineModifiers->mpePitchBendRange;
+	record.globalLFO1Modifiers = *engineModifiers->globalLFO1Modifiers;
+	record.globalLFO2Modifiers = *engineModifiers->globalLFO2Modifiers;
+	record.chorusFXModifiers = *engineModifiers->chorusFXModifiers;
+	record.delayFXModifiers = *engineModifiers->delayFXModifiers;
+	record.ensembleFXModifiers = *engineModifiers->ensembleFXModifiers;
+	record.reverbFXModifiers = *engineModifiers->reverbFXModifiers;
+	memcpy(record.masterFXOrder, engineModifiers->masterFXOrder, sizeof(record.masterFXOrder));
+
+	std::shared_ptr<SynthVoiceModifiers> voiceModifiers = engineModifiers->voiceModifiers;
+	record.enablePortamento = voiceModifiers->enablePortamento;
+	record.portamentoTime_mSec = voiceModifiers->portamentoTime_mSec;
+	record.legatoMode = voiceModifiers->legatoMode;
+	record.oversampling = voiceModifiers->oversampling;
+	record.enableLPF = voiceModifiers->enableLPF;
+	record.enableHPF = voiceModifiers->enableHPF;
+	record.osc1Modifiers = *voiceModifiers->osc1Modifiers;
+	record.osc2Modifiers = *voiceModifiers->osc2Modifiers;
+	record.subOscModifiers = *voiceModifiers->subOscModifiers;
+	record.fmEngineModifiers = *voiceModifiers->fmEngineModifiers;
+	record.eg1Modifiers = *voiceModifiers->eg1Modifiers;
+	record.eg2Modifiers = *voiceModifiers->eg2Modifiers;
+	record.msegModifiers = *voiceModifiers->msegModifiers;
+	record.lfo1Modifiers = *voiceModifiers->lfo1Modifiers;
+	record.lfo2Modifiers = *voiceModifiers->lfo2Modifiers;
+	record.glideLFOModifiers = *voiceModifiers->glideLFOModifiers;
+	record.filter1Modifiers = *voiceModifiers->filter1Modifiers;
+	record.filter2Modifiers = *voiceModifiers->filter2Modifiers;
+	record.outputDCAModifiers = *voiceModifiers->outputDCAModifiers;
+	record.voiceDelayFXModifiers = *voiceModifiers->delayFXModifiers;
+
+	for (uint32_t i = 0; i < MAX_MOD_ROUTINGS; i++)
+	{
+		record.modulationRoutings[i] = voiceModifiers->modulationRoutings[i];
+		record.progModulationControls[i] = voiceModifiers->progModulationControls[i];
+	}
+}
+
+/**
+	\brief Expand a patch record into the engine modifiers; copies by value into the existing shared sub-modifiers
+	so that every voice sees the new patch without re-wiring any pointers
+
+	\param record -- the source record
+	\param engineModifiers -- the destination modifiers
+*/
+void SynthPatchBank::decodePatch(const SynthPatchRecord& record, std::shared_ptr<SynthEngineModifiers> engineModifiers)
+{
+	engineModifiers->synthMode = record.synthMode;
+	engineModifiers->masterTuningRatio = record.masterTuningRatio;
+	engineModifiers->masterTuningOffset_cents = record.masterTuningOffset_cents;
+	engineModifiers->masterVolume_dB = record.masterVolume_dB;
+	engineModifiers->masterPitchBend = record.masterPitchBend;
+	engineModifiers->unisonDetune_Cents = record.unisonDetune_Cents;
+	engineModifiers->unisonCount = record.unisonCount;
+	engineModifiers->enableMPE = record.enableMPE;
+	engineModifiers->mpePitchBendRange = record.mpePitchBendRange;
+	*engineModifiers->globalLFO1Modifiers = record.globalLFO1Modifiers;
+	*engineModifiers->globalLFO2Modifiers = record.globalLFO2Modifiers;
+	*engineModifiers->chorusFXModifiers = record.chorusFXModifiers;
+	*engineModifiers->delayFXModifiers = record.delayFXModifiers;
+	*engineModifiers->ensembleFXModifiers = record.ensembleFXModifiers;
+	*engineModifiers->reverbFXModifiers = record.reverbFXModifiers;
+	memcpy(engineModifiers->masterFXOrder, record.masterFXOrder, sizeof(record.masterFXOrder));
+
+	std::shared_ptr<SynthVoiceModifiers> voiceModifiers = engineModifiers->voiceModifiers;
+	voiceModifiers->enablePortamento = record.enablePortamento;
+	voiceModifiers->portamentoTime_mSec = record.portamentoTime_mSec;
+	voiceModifiers->legatoMode = record.legatoMode;
+	voiceModifiers->oversampling = record.oversampling;
+	voiceModifiers->enableLPF = record.enableLPF;
+	voiceModifiers->enableHPF = record.enableHPF;
+	*voiceModifiers->osc1Modifiers = record.osc1Modifiers;
+	*voiceModifiers->osc2Modifiers = record.osc2Modifiers;
+	*voiceModifiers->subOscModifiers = record.subOscModifiers;
+	*voiceModifiers->fmEngineModifiers = record.fmEngineModifiers;
+	*voiceModifiers->eg1Modifiers = record.eg1Modifiers;
+	*voiceModifiers->eg2Modifiers = record.eg2Modifiers;
+	*voiceModifiers->msegModifiers = record.msegModifiers;
+	*voiceModifiers->lfo1Modifiers = record.lfo1Modifiers;
+	*voiceModifiers->lfo2Modifiers = record.lfo2Modifiers;
+	*voiceModifiers->glideLFOModifiers = record.glideLFOModifiers;
+	*voiceModifiers->filter1Modifiers = record.filter1Modifiers;
+	*voiceModifiers->filter2Modifiers = record.filter2Modifiers;
+	*voiceModifiers->outputDCAModifiers = record.outputDCAModifiers;
+	*voiceModifiers->delayFXModifiers = record.voiceDelayFXModifiers;
+
+	for (uint32_t i = 0; i < MAX_MOD_ROUTINGS; i++)
+	{
+		voiceModifiers->modulationRoutings[i] = record.modulationRoutings[i];
+		voiceModifiers->progModulationControls[i] = record.progModulationControls[i];
+	}
+}
+
+// --- field checks for a record read from disk: every bool must hold 0 or 1 (any other byte is undefined behavior
+//     once it is read as a bool), every double must be finite and every enum and count must be in range
+static bool isValidBool(const bool& value)
+{
+	uint8_t byte = 0;
+	memcpy(&byte, &value, 1);
+	return byte <= 1;
+}
+
+static bool isValidDouble(double value)
+{
+	return std::isfinite(value);
+}
+
+static bool isValidCount(uint32_t count, uint32_t minCount, uint32_t maxCount)
+{
+	return count >= minCount && count <= maxCount;
+}
+
+static bool isValidModulatorControls(const ModulatorControl* modulationControls, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (!isValidDouble(modulationControls[i].modulationIntensity) ||
+			!isValidDouble(modulationControls[i].modulationRange) ||
+			!isValidBool(modulationControls[i].invertIntensity))
+			return false;
+	}
+	return true;
+}
+
+static bool isValidLFOModifiers(const LFOModifiers& lfoModifiers)
+{
+	return (uint32_t)lfoModifiers.oscWave <= (uint32_t)LFOWaveform::kWhiteNoise &&
+		   (uint32_t)lfoModifiers.oscMode <= (uint32_t)LFOMode::kOneShot &&
+		   isValidDouble(lfoModifiers.oscFreqControl) &&
+		   isValidDouble(lfoModifiers.oscAmpControl) &&
+		   isValidDouble(lfoModifiers.pulseWidthControl_Pct) &&
+		   isValidBool(lfoModifiers.tempoSync) &&
+		   isValidDouble(lfoModifiers.cycle_beats) &&
+		   isValidModulatorControls(lfoModifiers.modulationControls, kNumLFOModulators);
+}
+
+static bool isValidDelayFXModifiers(const DelayFXModifiers& delayFXModifiers)
+{
+	return (uint32_t)delayFXModifiers.delayFXMode <= (uint32_t)delayFXMode::chorus &&
+		   (uint32_t)delayFXModifiers.interpolation <= (uint32_t)delayInterpolation::kAllpass &&
+		   isValidDouble(delayFXModifiers.delayTime_mSec) &&
+		   isValidDouble(delayFXModifiers.feedback_Pct) &&
+		   isValidDouble(delayFXModifiers.delayRatio) &&
+		   isValidDouble(delayFXModifiers.delayMix_Pct) &&
+		   isValidBool(delayFXModifiers.enabled) &&
+		   isValidDouble(delayFXModifiers.chorusRate_Hz) &&
+		   isValidDouble(delayFXModifiers.chorusDepth_Pct) &&
+		   isValidBool(delayFXModifiers.tempoSync) &&
+		   isValidDouble(delayFXModifiers.delayTime_beats) &&
+		   isValidModulatorControls(delayFXModifiers.modulationControls, kNumDelayFXModulators);
+}
+
+static bool isValidEnsembleFXModifiers(const EnsembleFXModifiers& ensembleFXModifiers)
+{
+	return isValidCount(ensembleFXModifiers.numTaps, kMinEnsembleTaps, kMaxEnsembleTaps) &&
+		   (uint32_t)ensembleFXModifiers.interpolation <= (uint32_t)delayInterpolation::kAllpass &&
+		   isValidDouble(ensembleFXModifiers.rate_Hz) &&
+		   isValidDouble(ensembleFXModifiers.depth_Pct) &&
+		   isValidDouble(ensembleFXModifiers.spread_Pct) &&
+		   isValidDouble(ensembleFXModifiers.mix_Pct) &&
+		   isValidBool(ensembleFXModifiers.enabled);
+}
+
+static bool isValidReverbFXModifiers(const ReverbFXModifiers& reverbFXModifiers)
+{
+	return isValidDouble(reverbFXModifiers.reverbTime_mSec) &&
+		   isValidDouble(reverbFXModifiers.damping_Pct) &&
+		   isValidDouble(reverbFXModifiers.size_Pct) &&
+		   isValidDouble(reverbFXModifiers.preDelay_mSec) &&
+		   isValidDouble(reverbFXModifiers.modDepth_Pct) &&
+		   isValidDouble(reverbFXModifiers.mix_Pct) &&
+		   isValidBool(reverbFXModifiers.enabled);
+}
+
+static bool isValidOscModifiers(const SynthOscModifiers& oscModifiers)
+{
+	return (uint32_t)oscModifiers.oscWave <= (uint32_t)synthOscWaveform::kSupersaw &&
+		   oscModifiers.octave >= -kMaxPatchOctaves && oscModifiers.octave <= kMaxPatchOctaves &&
+		   oscModifiers.semitones >= -kMaxPatchSemitones && oscModifiers.semitones <= kMaxPatchSemitones &&
+		   isValidDouble(oscModifiers.cents) &&
+		   isValidDouble(oscModifiers.oscFreqControl) &&
+		   isValidDouble(oscModifiers.oscFreqRatio) &&
+		   isValidDouble(oscModifiers.masterTuningRatio) &&
+		   isValidDouble(oscModifiers.masterTuningOffset_cents) &&
+		   isValidDouble(oscModifiers.unisonDetune_cents) &&
+		   isValidCount(oscModifiers.unisonCount, 1, kMaxUnisonOscillators) &&
+		   isValidDouble(oscModifiers.unisonSpread_Pct) &&
+		   isValidCount(oscModifiers.supersawCount, 1, kMaxSupersawSaws) &&
+		   isValidDouble(oscModifiers.supersawDetune_Pct) &&
+		   isValidDouble(oscModifiers.supersawMix_Pct) &&
+		   isValidDouble(oscModifiers.pulseWidthControl_Pct) &&
+		   isValidDouble(oscModifiers.oscAmpControl_dB) &&
+		   isValidBool(oscModifiers.useOscFreqControl) &&
+		   isValidModulatorControls(oscModifiers.modulationControls, kNumSynthOscModulators);
+}
+
+static bool isValidFMEngineModifiers(const FMEngineModifiers& fmEngineModifiers)
+{
+	if ((uint32_t)fmEngineModifiers.algorithm >= (uint32_t)fmEngineAlgorithm::kNumAlgorithms ||
+		!isValidDouble(fmEngineModifiers.feedback) ||
+		!isValidDouble(fmEngineModifiers.fmAmpControl_dB) ||
+		!isValidDouble(fmEngineModifiers.masterTuningRatio) ||
+		!isValidDouble(fmEngineModifiers.masterTuningOffset_cents) ||
+		!isValidModulatorControls(fmEngineModifiers.modulationControls, kNumFMEngineModulators))
+		return false;
+
+	for (uint32_t i = 0; i < kNumFMOperators; i++)
+	{
+		const FMOperatorModifiers& operatorModifiers = fmEngineModifiers.operators[i];
+		if (!isValidDouble(operatorModifiers.ratio) ||
+			!isValidDouble(operatorModifiers.detune_cents) ||
+			!isValidDouble(operatorModifiers.outputLevel) ||
+			!isValidDouble(operatorModifiers.attackTime_mSec) ||
+			!isValidDouble(operatorModifiers.decayTime_mSec) ||
+			!isValidDouble(operatorModifiers.sustainLevel) ||
+			!isValidDouble(operatorModifiers.releaseTime_mSec))
+			return false;
+	}
+	return true;
+}
+
+static bool isValidEGModifiers(const EGModifiers& egModifiers)
+{
+	return (uint32_t)egModifiers.egMode <= (uint32_t)egTCMode::kDigital &&
+		   (uint32_t)egModifiers.repeatSubDiv <= (uint32_t)egSubDiv::kSixteenth &&
+		   isValidBool(egModifiers.resetToZero) &&
+		   isValidBool(egModifiers.legatoMode) &&
+		   isValidBool(egModifiers.velocityToAttackScaling) &&
+		   isValidBool(egModifiers.noteNumberToDecayScaling) &&
+		   isValidBool(egModifiers.subdivide) &&
+		   isValidDouble(egModifiers.bpm) &&
+		   isValidCount(egModifiers.sigDenominator, 1, kMaxPatchSigDenominator) &&
+		   isValidDouble(egModifiers.repeatTime_mSec) &&
+		   isValidDouble(egModifiers.delayTime_mSec) &&
+		   isValidDouble(egModifiers.attackTime_mSec) &&
+		   isValidDouble(egModifiers.decayTime_mSec) &&
+		   isValidDouble(egModifiers.releaseTime_mSec) &&
+		   isValidDouble(egModifiers.sustainLevel) &&
+		   isValidModulatorControls(egModifiers.modulationControls, kNumEGModulators);
+}
+
+static bool isValidMultiStageEGModifiers(const MultiStageEGModifiers& msegModifiers)
+{
+	if (!isValidCount(msegModifiers.numBreakpoints, 1, kMaxMSEGBreakpoints) ||
+		msegModifiers.sustainBreakpoint < -1 || msegModifiers.sustainBreakpoint >= (int32_t)msegModifiers.numBreakpoints ||
+		!isValidBool(msegModifiers.enableLoop) ||
+		msegModifiers.loopStart >= msegModifiers.numBreakpoints ||
+		msegModifiers.loopEnd >= msegModifiers.numBreakpoints ||
+		!isValidBool(msegModifiers.tempoSync) ||
+		!isValidDouble(msegModifiers.bpm) ||
+		!isValidBool(msegModifiers.resetToZero))
+		return false;
+
+	// --- the unused breakpoints are stored too, so they are checked as well
+	for (uint32_t i = 0; i < kMaxMSEGBreakpoints; i++)
+	{
+		const MSEGBreakpoint& breakpoint = msegModifiers.breakpoints[i];
+		if (!isValidDouble(breakpoint.level) ||
+			!isValidDouble(breakpoint.time_mSec) ||
+			!isValidDouble(breakpoint.time_beats) ||
+			!isValidDouble(breakpoint.curvature))
+			return false;
+	}
+	return true;
+}
+
+static bool isValidFilterModifiers(const VALadderFilterModifiers& filterModifiers)
+{
+	return (uint32_t)filterModifiers.filter <= (uint32_t)filterType::kHPF4 &&
+		   isValidDouble(filterModifiers.fcControl) &&
+		   isValidDouble(filterModifiers.qControl) &&
+		   isValidBool(filterModifiers.applyNLP) &&
+		   isValidDouble(filterModifiers.nlpSaturation) &&
+		   isValidDouble(filterModifiers.gainCompensation) &&
+		   isValidBool(filterModifiers.enableKeyTrack) &&
+		   isValidDouble(filterModifiers.keytrackRatio) &&
+		   isValidModulatorControls(filterModifiers.modulationControls, kNumVALadderFilterModulators);
+}
+
+static bool isValidDCAModifiers(const DCAModifiers& dcaModifiers)
+{
+	return isValidDouble(dcaModifiers.gain_dB) &&
+		   isValidBool(dcaModifiers.mute) &&
+		   isValidModulatorControls(dcaModifiers.modulationControls, kNumDCAModulators);
+}
+
+// --- the FX order must name every master FX exactly once
+static bool isValidMasterFXOrder(const uint32_t* masterFXOrder)
+{
+	bool used[kNumMasterFX] = { false };
+	for (uint32_t i = 0; i < kNumMasterFX; i++)
+	{
+		if (masterFXOrder[i] >= kNumMasterFX || used[masterFXOrder[i]])
+			return false;
+		used[masterFXOrder[i]] = true;
+	}
+	return true;
+}
+
+/**
+	\brief Check every field of a patch record: bools, doubles, enums, counts and the FX order; a record that fails
+	would be decoded into modifiers the components index arrays with, switch on or feed into their coefficients.
+
+	\param record -- a record copied out of a bank file
+	\return true if the record is safe to decode
+*/
+bool SynthPatchBank::validatePatchRecord(const SynthPatchRecord& record)
+{
+	// --- SynthEngineModifiers
+	if ((uint32_t)record.synthMode > (uint32_t)synthMode::kUnison ||
+		!isValidDouble(record.masterTuningRatio) ||
+		!isValidDouble(record.masterTuningOffset_cents) ||
+		!isValidDouble(record.masterVolume_dB) ||
+		!isValidCount(record.masterPitchBend, 1, kMaxPatchPitchBendRange) ||
+		!isValidDouble(record.unisonDetune_Cents) ||
+		!isValidCount(record.unisonCount, 1, kMaxUnisonOscillators) ||
+		!isValidBool(record.enableMPE) ||
+		!isValidCount(record.mpePitchBendRange, 1, kMaxPatchPitchBendRange) ||
+		!isValidMasterFXOrder(record.masterFXOrder))
+		return false;
+
+	if (!isValidLFOModifiers(record.globalLFO1Modifiers) || !isValidLFOModifiers(record.globalLFO2Modifiers) ||
+		!isValidDelayFXModifiers(record.chorusFXModifiers) || !isValidDelayFXModifiers(record.delayFXModifiers) ||
+		!isValidEnsembleFXModifiers(record.ensembleFXModifiers) || !isValidReverbFXModifiers(record.reverbFXModifiers))
+		return false;
+
+	// --- SynthVoiceModifiers
+	if (!isValidBool(record.enablePortamento) ||
+		!isValidDouble(record.portamentoTime_mSec) ||
+		!isValidBool(record.legatoMode) ||
+		(uint32_t)record.oversampling > (uint32_t)oversamplingMode::k4x ||
+		!isValidBool(record.enableLPF) ||
+		!isValidBool(record.enableHPF))
+		return false;
+
+	if (!isValidOscModifiers(record.osc1Modifiers) || !isValidOscModifiers(record.osc2Modifiers) ||
+		!isValidOscModifiers(record.subOscModifiers) || !isValidFMEngineModifiers(record.fmEngineModifiers))
+		return false;
+
+	if (!isValidEGModifiers(record.eg1Modifiers) || !isValidEGModifiers(record.eg2Modifiers) ||
+		!isValidMultiStageEGModifiers(record.msegModifiers))
+		return false;
+
+	if (!isValidLFOModifiers(record.lfo1Modifiers) || !isValidLFOModifiers(record.lfo2Modifiers) ||
+		!isValidLFOModifiers(record.glideLFOModifiers))
+		return false;
+
+	if (!isValidFilterModifiers(record.filter1Modifiers) || !isValidFilterModifiers(record.filter2Modifiers) ||
+		!isValidDCAModifiers(record.outputDCAModifiers) || !isValidDelayFXModifiers(record.voiceDelayFXModifiers))
+		return false;
+
+	for (uint32_t i = 0; i < MAX_MOD_ROUTINGS; i++)
+	{
+		if ((uint32_t)record.modulationRoutings[i].modSource >= (uint32_t)modulationSource::kNumModulationSources ||
+			(uint32_t)record.modulationRoutings[i].modDest >= (uint32_t)modulationDestination::kNumModulationDestinations)
+			return false;
+	}
+
+	return isValidModulatorControls(record.progModulationControls, MAX_MOD_ROUTINGS);
+}
+
+/**
+	\brief Write a complete bank file: header, index, name hash table and the patch records. The file is written under
+	a temporary name and then renamed over bankPath, so a SynthPatchBank that has the old file mapped keeps reading
+	the old contents and never sees a partly written bank.
+
+	\param bankPath -- path to the bank file (replaced)
+	\param patches -- the named patches, in patch number order
+	\return true if the file was written
+*/
+bool SynthPatchBank::writeBank(const char* bankPath, const std::vector<NamedSynthPatch>& patches)
+{
+	if (!bankPath) return false;
+
+	PatchBankHeader bankHeader;
+	bankHeader.layoutSignature = getLayoutSignature();
+	bankHeader.patchCount = (uint32_t)patches.size();
+	bankHeader.patchRecordSize = sizeof(SynthPatchRecord);
+
+	// --- keep the hash table at most half full
+	uint32_t tableSize = 16;
+	while (tableSize < 2 * bankHeader.patchCount)
+		tableSize <<= 1;
+	bankHeader.nameHashTableSize = tableSize;
+
+	// --- records are 8-byte aligned for the doubles they contain
+	bankHeader.indexOffset = sizeof(PatchBankHeader);
+	bankHeader.nameHashTableOffset = bankHeader.indexOffset + bankHeader.patchCount * sizeof(PatchBankIndexEntry);
+	bankHeader.recordsOffset = (bankHeader.nameHashTableOffset + tableSize * sizeof(uint32_t) + 7) & ~7u;
+
+	// --- build index and name table
+	std::vector<PatchBankIndexEntry> bankIndex(bankHeader.patchCount);
+	std::vector<uint32_t> hashTable(tableSize, kPatchBankNameIndexEmpty);
+
+	for (uint32_t i = 0; i < bankHeader.patchCount; i++)
+	{
+		if (!patches[i].modifiers) return false;
+
+		strncpy(bankIndex[i].name, patches[i].name.c_str(), kMaxPatchNameLength - 1);
+		bankIndex[i].nameHash = hashPatchName(bankIndex[i].name);
+		bankIndex[i].recordOffset = bankHeader.recordsOffset + i * sizeof(SynthPatchRecord);
+
+		// --- first one wins for duplicate names
+		uint32_t slot = bankIndex[i].nameHash & (tableSize - 1);
+		while (hashTable[slot] != kPatchBankNameIndexEmpty)
+			slot = (slot + 1) & (tableSize - 1);
+		hashTable[slot] = i;
+	}
+
+	std::string tempPath = std::string(bankPath) + ".tmp";
+	FILE* file = fopen(tempPath.c_str(), "wb");
+	if (!file) return false;
+
+	bool success = fwrite(&bankHeader, sizeof(PatchBankHeader), 1, file) == 1;
+
+	if (success && bankHeader.patchCount > 0)
+		success = fwrite(&bankIndex[0], sizeof(PatchBankIndexEntry), bankHeader.patchCount, file) == bankHeader.patchCount;
+
+	if (success)
+		success = fwrite(&hashTable[0], sizeof(uint32_t), tableSize, file) == tableSize;
+
+	// --- alignment padding
+	uint8_t padding[8] = { 0 };
+	size_t padBytes = bankHeader.recordsOffset - (bankHeader.nameHashTableOffset + tableSize * sizeof(uint32_t));
+	if (success && padBytes > 0)
+		success = fwrite(padding, 1, padBytes, file) == padBytes;
+
+	// --- value-initialized: padding bytes in the file are deterministic
+	SynthPatchRecord record = SynthPatchRecord();
+	for (uint32_t i = 0; success && i < bankHeader.patchCount; i++)
+	{
+		encodePatch(patches[i].modifiers, record);
+		success = fwrite(&record, sizeof(SynthPatchRecord), 1, file) == 1;
+	}
+
+	if (fclose(file) != 0)
+		success = false;
+
+	// --- replace the old bank; the mapping of the old file stays valid
+	if (success)
+	{
+#ifdef _WIN32
+		success = MoveFileExA(tempPath.c_str(), bankPath, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+		success = rename(tempPath.c_str(), bankPath) == 0;
+#endif
+	}
+
+	if (!success)
+		remove(tempPath.c_str());
+
+	return success;
+}
@@ -0,0 +1,209 @@
+#pragma once
+#include "SynthEngine.h"
+
+#include <string>
+#include <vector>
+
+// --- LIMITS (always at top)
+//
+// --- bank file constants
+const uint32_t kPatchBankMagic = 0x4B425053;		// --- 'SPBK' in little endian
+const uint32_t kPatchBankVersion = 13;				// --- bump this if SynthPatchRecord changes
+const uint32_t kMaxPatchNameLength = 32;			// --- including the terminating NULL
+const uint32_t kPatchBankNameIndexEmpty = 0xFFFFFFFF;	// --- empty slot in the name hash table
+
+// --- limits for the record fields that have no enum or component limit of their own; a bank outside them is rejected
+const int32_t kMaxPatchOctaves = 10;				// --- oscillator octave offset, +/-
+const int32_t kMaxPatchSemitones = 127;				// --- oscillator semitone offset, +/-
+const uint32_t kMaxPatchSigDenominator = 64;		// --- EG repeat time signature denominator
+const uint32_t kMaxPatchPitchBendRange = 96;		// --- master and MPE pitch bend range in semitones
+
+/**
+	\struct PatchBankHeader
+	\ingroup SynthStructures
+	\brief The (fixed size) header at the top of every binary patch bank file. All offsets are in bytes from the top of the file.
+
+	File layout:
+	- PatchBankHeader
+	- PatchBankIndexEntry[patchCount]				(patch number -> name and record offset)
+	- uint32_t nameHashTable[nameHashTableSize]		(open-addressed, power-of-two sized; holds patch numbers)
+	- SynthPatchRecord[patchCount]
+
+	\param magic:				must be kPatchBankMagic
+	\param version:				must be kPatchBankVersion
+	\param layoutSignature:		signature built from the sizes of all serialized structures; guards against stale banks
+	\param patchCount:			number of patches in the bank
+	\param patchRecordSize:		sizeof(SynthPatchRecord) at the time of writing
+	\param nameHashTableSize:	number of slots in the name hash table (power of two)
+	\param indexOffset:			offset to the PatchBankIndexEntry array
+	\param nameHashTableOffset:	offset to the name hash table
+	\param recordsOffset:		offset to the first SynthPatchRecord
+*/
+struct PatchBankHeader
+{
+	uint32_t magic = kPatchBankMagic;
+	uint32_t version = kPatchBankVersion;
+	uint32_t layoutSignature = 0;
+	uint32_t patchCount = 0;
+	uint32_t patchRecordSize = 0;
+	uint32_t nameHashTableSize = 0;
+	uint32_t indexOffset = 0;
+	uint32_t nameHashTableOffset = 0;
+	uint32_t recordsOffset = 0;
+};
+
+/**
+	\struct PatchBankIndexEntry
+	\ingroup SynthStructures
+	\brief One entry in the patch number index; lets us browse names without touching the (much larger) patch records.
+
+	\param name:			NULL terminated patch name
+	\param nameHash:		hash of the name (FNV-1a) for fast rejection during name lookup
+	\param recordOffset:	offset to the SynthPatchRecord from the top of the file
+*/
+struct PatchBankIndexEntry
+{
+	char name[kMaxPatchNameLength] = { 0 };
+	uint32_t nameHash = 0;
+	uint32_t recordOffset = 0;
+};
+
+/**
+	\struct SynthPatchRecord
+	\ingroup SynthStructures
+	\brief A flat, fixed size snapshot of every SynthEngineModifiers and SynthVoiceModifiers field including the
+	sub-component modifiers and the programmable modulation routings. The sub-component modifiers are plain-old-data
+	so they are stored by value; the shared pointers of the live modifiers are never written to disk.
+*/
+struct SynthPatchRecord
+{
+	// --- SynthEngineModifiers
+	synthMode synthMode = synthMode::kPoly;
+	double masterTuningRatio = 1.0;
+	double masterTuningOffset_cents = 0.0;
+	double masterVolume_dB = 0.0;
+	unsigned int masterPitchBend = 1;
+	double unisonDetune_Cents = 0.0;
+	uint32_t unisonCount = 7;
+	bool enableMPE = false;
+	unsigned int mpePitchBendRange = 48;
+	LFOModifiers globalLFO1Modifiers;
+	LFOModifiers globalLFO2Modifiers;
+	DelayFXModifiers chorusFXModifiers;
+	DelayFXModifiers delayFXModifiers;
+	EnsembleFXModifiers ensembleFXModifiers;
+	ReverbFXModifiers reverbFXModifiers;
+	uint32_t masterFXOrder[kNumMasterFX] = { kMasterFXChorus, kMasterFXEnsemble, kMasterFXDelay, kMasterFXReverb };
+
+	// --- SynthVoiceModifiers
+	bool enablePortamento = false;
+	double portamentoTime_mSec = 0.0;
+	bool legatoMode = false;
+	oversamplingMode oversampling = oversamplingMode::k1x;
+	bool enableLPF = true;
+	bool enableHPF = true;
+	SynthOscModifiers osc1Modifiers;
+	SynthOscModifiers osc2Modifiers;
+	SynthOscModifiers subOscModifiers;
+	FMEngineModifiers fmEngineModifiers;
+	EGModifiers eg1Modifiers;
+	EGModifiers eg2Modifiers;
+	MultiStageEGModifiers msegModifiers;
+	LFOModifiers lfo1Modifiers;
+	LFOModifiers lfo2Modifiers;
+	LFOModifiers glideLFOModifiers;
+	VALadderFilterModifiers filter1Modifiers;
+	VALadderFilterModifiers filter2Modifiers;
+	DCAModifiers outputDCAModifiers;
+	DelayFXModifiers voiceDelayFXModifiers;
+	ModulatorRouting modulationRoutings[MAX_MOD_ROUTINGS];
+	ModulatorControl progModulationControls[MAX_MOD_ROUTINGS];
+};
+
+/**
+	\struct NamedSynthPatch
+	\ingroup SynthStructures
+	\brief A patch name paired with the engine modifiers that define it; used when writing banks.
+*/
+struct NamedSynthPatch
+{
+	NamedSynthPatch() {}
+	NamedSynthPatch(const char* _name, std::shared_ptr<SynthEngineModifiers> _modifiers)
+	: name(_name)
+	, modifiers(_modifiers){}
+
+	std::string name;
+	std::shared_ptr<SynthEngineModifiers> modifiers;
+};
+
+/**
+	\class SynthPatchBank
+	\ingroup SynthClasses
+	\brief Read-only access to a binary patch bank file. The file is memory mapped (mmap on POSIX, MapViewOfFile on Windows)
+	so opening a bank of thousands of patches costs only the header validation; each patch is decoded lazily, on request,
+	directly into an existing SynthEngineModifiers structure (which preserves the modifier pointers shared by the voices).
+
+	Lookup:
+	- by number: O(1) via the index array
+	- by name: O(1) expected via the open-addressed name hash table stored in the file
+
+	openBank( ) validates every index entry and every field of every patch record (NULL terminated names, bools that
+	hold 0 or 1, finite doubles, enums and counts in range, a complete master FX order) so a damaged or hostile file is
+	rejected as a whole and never decoded.
+
+	Do NOT call the open/close functions from the audio thread; loadPatch( ) is allocation free and may be called from
+	the same thread that writes the engine modifiers.
+*/
+class SynthPatchBank
+{
+public:
+	SynthPatchBank() {}
+	~SynthPatchBank() { closeBank(); }
+
+	// --- map and validate a bank file
+	bool openBank(const char* bankPath);
+
+	// --- unmap the file
+	void closeBank();
+
+	/** true if a valid bank is mapped */
+	bool isBankOpen() { return header != nullptr; }
+
+	/** number of patches in the mapped bank */
+	uint32_t getPatchCount() { return header ? header->patchCount : 0; }
+
+	// --- browsing and lookup
+	const char* getPatchName(uint32_t patchNumber);
+	int32_t findPatch(const char* patchName);
+
+	// --- lazy decode of one patch
+	bool loadPatch(uint32_t patchNumber, std::shared_ptr<SynthEngineModifiers> engineModifiers);
+
+	// --- encode/decode helpers; also used by the writer
+	static void encodePatch(std::shared_ptr<SynthEngineModifiers> engineModifiers, SynthPatchRecord& record);
+	static void decodePatch(const SynthPatchRecord& record, std::shared_ptr<SynthEngineModifiers> engineModifiers);
+
+	// --- check every field of a record read from disk
+	static bool validatePatchRecord(const SynthPatchRecord& record);
+
+	// --- write a complete bank to disk (non-realtime)
+	static bool writeBank(const char* bankPath, const std::vector<NamedSynthPatch>& patches);
+
+	// --- hash used for the name table
+	static uint32_t hashPatchName(const char* patchName);
+
+	// --- signature from the sizes of all serialized structures
+	static uint32_t getLayoutSignature();
+
+protected:
+	const uint8_t* bankData = nullptr;				///< start of the mapped file
+	size_t bankSize = 0;							///< size of the mapped file in bytes
+	const PatchBankHeader* header = nullptr;		///< header, points into bankData
+	const PatchBankIndexEntry* index = nullptr;		///< patch number index, points into bankData
+	const uint32_t* nameHashTable = nullptr;		///< name hash table, points into bankData
+
+#ifdef _WIN32
+	void* fileHandle = nullptr;
+	void* mappingHandle = nullptr;
+#endif
+};
@@ -0,0 +1,310 @@
+#include "SynthProfiler.h"
+
+#ifdef SYNTH_PROFILING
+
+#include <chrono>
+#include <stdio.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define SYNTH_PROFILE_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define SYNTH_PROFILE_RDTSC 1
+#endif
+
+// --- one slot per profiling thread
+ProfileThreadData SynthProfiler::threadData[kMaxProfileThreads];
+
+// --- the calling thread's slot, once claimed
+static thread_local ProfileThreadData* threadProfile = nullptr;
+
+// --- zone names for the reports; the voice zones are named voice_N
+static const char* profileZoneNames[kProfileVoice0] = {
+	"engine_render", "lfos", "egs", "oscillators", "filters", "decimators", "dca",
+	"chorus_fx", "ensemble_fx", "delay_fx", "reverb_fx", "master_fx" };
+
+/**
+	\brief Read the profiling clock
+	\return CPU time stamp counter on x86, otherwise steady_clock nanoseconds
+*/
+uint64_t readProfileClock()
+{
+#ifdef SYNTH_PROFILE_RDTSC
+	return __rdtsc();
+#else
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/** steady_clock time in uSec, for the block history */
+static uint64_t getTimestamp_uSec()
+{
+	return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+	\brief Writer: add one block to the histogram; single writer, so plain relaxed load/store pairs
+	\param cycles -- the block's cycles
+*/
+void ProfileHistogram::addBlock(uint64_t cycles)
+{
+	uint32_t bin = 0;
+	uint64_t value = cycles;
+	while (value > 1 && bin < kNumProfileBins - 1)
+	{
+		value >>= 1;
+		bin++;
+	}
+
+	bins[bin].store(bins[bin].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	totalCycles.store(totalCycles.load(std::memory_order_relaxed) + cycles, std::memory_order_relaxed);
+	if (cycles > maxCycles.load(std::memory_order_relaxed))
+		maxCycles.store(cycles, std::memory_order_relaxed);
+
+	// --- last, so a reader that sees the count also sees the block
+	blockCount.store(blockCount.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+/**
+	\brief Writer: clear the histogram
+*/
+void ProfileHistogram::clear()
+{
+	for (uint32_t i = 0; i < kNumProfileBins; i++)
+		bins[i].store(0, std::memory_order_relaxed);
+	totalCycles.store(0, std::memory_order_relaxed);
+	maxCycles.store(0, std::memory_order_relaxed);
+	blockCount.store(0, std::memory_order_release);
+}
+
+/**
+	\brief Get the calling thread's slot, claiming a free one the first time
+	\return the slot, or nullptr if all kMaxProfileThreads slots are taken (that thread is not profiled)
+*/
+ProfileThreadData* SynthProfiler::getThreadData()
+{
+	if (threadProfile)
+		return threadProfile;
+
+	for (uint32_t i = 0; i < kMaxProfileThreads; i++)
+	{
+		bool expected = false;
+		if (threadData[i].inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+		{
+			threadProfile = &threadData[i];
+			return threadProfile;
+		}
+	}
+	return nullptr;
+}
+
+/**
+	\brief Count one engine sample; at the end of a block, move the accumulators into the histograms and the history ring
+*/
+void SynthProfiler::endSample()
+{
+	ProfileThreadData* data = getThreadData();
+	if (!data)
+		return;
+
+	if (++data->sampleCounter < kProfileBlockSize)
+		return;
+	data->sampleCounter = 0;
+
+	// --- reset requested by a reader
+	if (data->resetRequested.exchange(false, std::memory_order_acq_rel))
+	{
+		for (uint32_t zone = 0; zone < kNumProfileZones; zone++)
+			data->histograms[zone].clear();
+	}
+
+	uint32_t writeIndex = data->historyWriteIndex.load(std::memory_order_relaxed);
+	ProfileBlockRecord& record = data->history[writeIndex % kProfileHistoryLength];
+	record.timestamp_uSec = getTimestamp_uSec();
+
+	for (uint32_t zone = 0; zone < kNumProfileZones; zone++)
+	{
+		uint64_t cycles = data->accumulators[zone];
+		data->accumulators[zone] = 0;
+
+		// --- zones that did not run this block (idle voices, bypassed FX) stay out of the histograms
+		if (cycles > 0)
+			data->histograms[zone].addBlock(cycles);
+
+		record.zoneCycles[zone] = cycles > 0xFFFFFFFF ? 0xFFFFFFFF : (uint32_t)cycles;
+	}
+
+	data->historyWriteIndex.store(writeIndex + 1, std::memory_order_release);
+}
+
+/**
+	\brief Get a zone's report name
+	\param zone -- the zone index
+	\return the name; voice zones share the name "voice"
+*/
+const char* SynthProfiler::getZoneName(uint32_t zone)
+{
+	if (zone < kProfileVoice0)
+		return profileZoneNames[zone];
+	return "voice";
+}
+
+/**
+	\brief Reader: get a snapshot of one zone's statistics
+	\param thread -- profiler thread slot
+	\param zone -- the zone index
+	\param blockCount -- number of blocks in which the zone ran
+	\param meanCycles -- mean cycles per block
+	\param maxCycles -- worst block
+	\param p99Cycles -- 99th percentile, as the upper edge of its log2 bin
+	\return true if the slot is in use and the zone has data
+*/
+bool SynthProfiler::getZoneStats(uint32_t thread, uint32_t zone, uint64_t& blockCount, uint64_t& meanCycles, uint64_t& maxCycles, uint64_t& p99Cycles)
+{
+	if (thread >= kMaxProfileThreads || zone >= kNumProfileZones || !threadData[thread].inUse.load(std::memory_order_acquire))
+		return false;
+
+	ProfileHistogram& histogram = threadData[thread].histograms[zone];
+	blockCount = histogram.blockCount.load(std::memory_order_acquire);
+	if (blockCount == 0)
+		return false;
+
+	meanCycles = histogram.totalCycles.load(std::memory_order_relaxed) / blockCount;
+	maxCycles = histogram.maxCycles.load(std::memory_order_relaxed);
+
+	uint64_t target = blockCount - blockCount / 100;
+	uint64_t count = 0;
+	p99Cycles = maxCycles;
+	for (uint32_t bin = 0; bin < kNumProfileBins; bin++)
+	{
+		count += histogram.bins[bin].load(std::memory_order_relaxed);
+		if (count >= target)
+		{
+			p99Cycles = 2ull << bin;
+			break;
+		}
+	}
+	return true;
+}
+
+/** append a zone's name, numbering the voice zones */
+static void appendZoneName(std::string& json, uint32_t zone)
+{
+	json += SynthProfiler::getZoneName(zone);
+	if (zone >= kProfileVoice0)
+		json += "_" + std::to_string(zone - kProfileVoice0);
+}
+
+/**
+	\brief Reader: all threads and zones as JSON, with the statistics and the raw log2 histograms
+	\return the JSON report
+*/
+std::string SynthProfiler::getReportJSON()
+{
+	std::string json = "{\"clock\":\"";
+#ifdef SYNTH_PROFILE_RDTSC
+	json += "rdtsc";
+#else
+	json += "steady_clock_ns";
+#endif
+	json += "\",\"blockSize\":" + std::to_string(kProfileBlockSize) + ",\"threads\":[";
+
+	bool firstThread = true;
+	for (uint32_t thread = 0; thread < kMaxProfileThreads; thread++)
+	{
+		if (!threadData[thread].inUse.load(std::memory_order_acquire))
+			continue;
+
+		json += firstThread ? "" : ",";
+		firstThread = false;
+		json += "{\"thread\":" + std::to_string(thread) + ",\"zones\":[";
+
+		bool firstZone = true;
+		for (uint32_t zone = 0; zone < kNumProfileZones; zone++)
+		{
+			uint64_t blockCount = 0, meanCycles = 0, maxCycles = 0, p99Cycles = 0;
+			if (!getZoneStats(thread, zone, blockCount, meanCycles, maxCycles, p99Cycles))
+				continue;
+
+			json += firstZone ? "{\"name\":\"" : ",{\"name\":\"";
+			firstZone = false;
+			appendZoneName(json, zone);
+			json += "\",\"blocks\":" + std::to_string(blockCount) +
+					",\"mean\":" + std::to_string(meanCycles) +
+					",\"max\":" + std::to_string(maxCycles) +
+					",\"p99\":" + std::to_string(p99Cycles) + ",\"histogram\":[";
+
+			ProfileHistogram& histogram = threadData[thread].histograms[zone];
+			for (uint32_t bin = 0; bin < kNumProfileBins; bin++)
+			{
+				json += bin == 0 ? "" : ",";
+				json += std::to_string(histogram.bins[bin].load(std::memory_order_relaxed));
+			}
+			json += "]}";
+		}
+		json += "]}";
+	}
+	json += "]}";
+
+	return json;
+}
+
+/**
+	\brief Reader: the recent block history of all threads as a Chrome trace (chrome://tracing, Perfetto); one counter
+	event per block with the cycles of every zone that ran
+	\return the JSON trace
+*/
+std::string SynthProfiler::getChromeTraceJSON()
+{
+	std::string json = "{\"traceEvents\":[";
+	bool firstEvent = true;
+
+	for (uint32_t thread = 0; thread < kMaxProfileThreads; thread++)
+	{
+		ProfileThreadData& data = threadData[thread];
+		if (!data.inUse.load(std::memory_order_acquire))
+			continue;
+
+		uint32_t writeIndex = data.historyWriteIndex.load(std::memory_order_acquire);
+
+		// --- skip the oldest quarter of the ring: the writer may be overwriting it while we read
+		uint32_t available = writeIndex < kProfileHistoryLength ? writeIndex : kProfileHistoryLength - kProfileHistoryLength / 4;
+		for (uint32_t i = writeIndex - available; i != writeIndex; i++)
+		{
+			const ProfileBlockRecord& record = data.history[i % kProfileHistoryLength];
+
+			json += firstEvent ? "" : ",";
+			firstEvent = false;
+			json += "{\"name\":\"cycles\",\"ph\":\"C\",\"pid\":1,\"tid\":" + std::to_string(thread) +
+					",\"ts\":" + std::to_string(record.timestamp_uSec) + ",\"args\":{";
+
+			bool firstZone = true;
+			for (uint32_t zone = 0; zone < kNumProfileZones; zone++)
+			{
+				if (record.zoneCycles[zone] == 0)
+					continue;
+
+				json += firstZone ? "\"" : ",\"";
+				firstZone = false;
+				appendZoneName(json, zone);
+				json += "\":" + std::to_string(record.zoneCycles[zone]);
+			}
+			json += "}}";
+		}
+	}
+	json += "]}";
+
+	return json;
+}
+
+/**
+	\brief Reader: ask every profiling thread to clear its histograms at its next block
+*/
+void SynthProfiler::requestReset()
+{
+	for (uint32_t thread = 0; thread < kMaxProfileThreads; thread++)
+		threadData[thread].resetRequested.store(true, std::memory_order_release);
+}
+
+#endif // SYNTH_PROFILING
@@ -0,0 +1,173 @@
+#pragma once
+
+// --- CPU profiling is compiled in only when SYNTH_PROFILING is defined (here or in the project settings); otherwise the
+//     SYNTH_PROFILE_ macros compile to nothing and there is no profiler storage
+//#define SYNTH_PROFILING
+
+#include <stdint.h>
+
+// --- LIMITS (always at top)
+//
+// --- per-voice zones; one per voice slot including the ghost voices, NUM_VOICE_SLOTS in SynthEngine.h (checked there)
+const uint32_t kMaxProfileVoices = 20;
+
+// --- profiled zones; a zone accumulates cycles over one block and the block total goes into the zone's histogram
+enum {
+	kProfileEngineRender,	/* SynthEngine::render( ), everything */
+	kProfileLFOs,			/* voice LFO blocks */
+	kProfileEGs,			/* EG1, EG2 and the MSEG */
+	kProfileOscillators,	/* all oscillators */
+	kProfileFilters,		/* both filters */
+	kProfileDecimators,		/* oversampling decimators */
+	kProfileDCA,			/* output DCA */
+	kProfileChorusFX,		/* master FX */
+	kProfileEnsembleFX,
+	kProfileDelayFX,
+	kProfileReverbFX,
+	kProfileMasterFX,		/* any other FXChain slot */
+	kProfileVoice0,			/* SynthVoice::renderBlock( ) for voice 0; voice N is kProfileVoice0 + N */
+	kNumProfileZones = kProfileVoice0 + kMaxProfileVoices
+};
+
+#ifdef SYNTH_PROFILING
+
+#include <atomic>
+#include <string>
+
+// --- blocks are counted in engine samples
+const uint32_t kProfileBlockSize = 64;
+
+// --- log2 histogram bins: bin b holds blocks of [2^b, 2^(b+1)) cycles
+const uint32_t kNumProfileBins = 48;
+
+// --- threads that can profile at the same time; each gets its own slot the first time it profiles
+const uint32_t kMaxProfileThreads = 8;
+
+// --- recent blocks kept for the Chrome trace
+const uint32_t kProfileHistoryLength = 512;
+
+/** read the profiling clock: the CPU time stamp counter on x86, otherwise steady_clock nanoseconds */
+uint64_t readProfileClock();
+
+/**
+	\struct ProfileHistogram
+	\ingroup SynthStructures
+	\brief Cycles-per-block histogram for one zone. Only the owning (audio) thread writes, with relaxed loads and stores
+	and no read-modify-write; any thread may read the counters at any time.
+*/
+struct ProfileHistogram
+{
+	ProfileHistogram() {}
+
+	std::atomic<uint64_t> bins[kNumProfileBins];	///< log2 bins
+	std::atomic<uint64_t> blockCount{ 0 };			///< number of blocks
+	std::atomic<uint64_t> totalCycles{ 0 };			///< sum over all blocks
+	std::atomic<uint64_t> maxCycles{ 0 };			///< worst block
+
+	/** writer: add one block */
+	void addBlock(uint64_t cycles);
+
+	/** writer: clear everything */
+	void clear();
+};
+
+/**
+	\struct ProfileBlockRecord
+	\ingroup SynthStructures
+	\brief One block of the recent history: when it ended and the cycles spent in each zone
+*/
+struct ProfileBlockRecord
+{
+	uint64_t timestamp_uSec = 0;						///< steady_clock time at the end of the block
+	uint32_t zoneCycles[kNumProfileZones] = { 0 };		///< cycles per zone (saturated)
+};
+
+/**
+	\struct ProfileThreadData
+	\ingroup SynthStructures
+	\brief Everything one profiling thread owns: the per-block accumulators (writer only), the histograms and the
+	recent block history (readable from any thread)
+*/
+struct ProfileThreadData
+{
+	ProfileThreadData() {}
+
+	std::atomic<bool> inUse{ false };						///< claimed by a thread
+	std::atomic<bool> resetRequested{ false };				///< a reader asked for a reset; honored at the next block
+
+	// --- writer only
+	uint64_t accumulators[kNumProfileZones] = { 0 };		///< cycles in the current block
+	uint32_t sampleCounter = 0;								///< samples in the current block
+
+	// --- readable
+	ProfileHistogram histograms[kNumProfileZones];			///< per zone histograms
+	ProfileBlockRecord history[kProfileHistoryLength];		///< recent blocks, a ring
+	std::atomic<uint32_t> historyWriteIndex{ 0 };			///< free running
+};
+
+/**
+	\class SynthProfiler
+	\ingroup SynthClasses
+	\brief Static, lock-free CPU profiler. Each thread that profiles claims one ProfileThreadData slot with an atomic
+	compare-exchange the first time (a thread_local pointer caches it), then only that thread writes it; nothing on the
+	audio side ever locks or allocates.
+
+	Audio side (through the macros):
+	- SYNTH_PROFILE_SCOPE(zone) times the rest of the enclosing scope and adds it to the zone's block accumulator
+	- SYNTH_PROFILE_END_SAMPLE() counts engine samples; every kProfileBlockSize samples the block totals go into the
+	  histograms and the history ring
+
+	Reader side (any thread): getZoneStats( ), getReportJSON( ) and getChromeTraceJSON( ); these may allocate. The
+	readings are relaxed snapshots, so a zone's counters may be one block apart.
+*/
+class SynthProfiler
+{
+public:
+	// --- audio side
+	static ProfileThreadData* getThreadData();
+	static void endSample();
+
+	/** add cycles to a zone of the calling thread's current block */
+	static inline void addCycles(uint32_t zone, uint64_t cycles)
+	{
+		ProfileThreadData* data = getThreadData();
+		if (data && zone < kNumProfileZones)
+			data->accumulators[zone] += cycles;
+	}
+
+	// --- reader side
+	static const char* getZoneName(uint32_t zone);
+	static bool getZoneStats(uint32_t thread, uint32_t zone, uint64_t& blockCount, uint64_t& meanCycles, uint64_t& maxCycles, uint64_t& p99Cycles);
+	static std::string getReportJSON();
+	static std::string getChromeTraceJSON();
+	static void requestReset();
+
+protected:
+	static ProfileThreadData threadData[kMaxProfileThreads];	///< one slot per profiling thread
+};
+
+/**
+	\class ProfileScope
+	\ingroup SynthClasses
+	\brief Scoped timer: reads the profiling clock on construction and adds the elapsed cycles to a zone on destruction
+*/
+class ProfileScope
+{
+public:
+	ProfileScope(uint32_t _zone) : zone(_zone), start(readProfileClock()) {}
+	~ProfileScope() { SynthProfiler::addCycles(zone, readProfileClock() - start); }
+
+protected:
+	uint32_t zone = 0;
+	uint64_t start = 0;
+};
+
+#define SYNTH_PROFILE_CONCAT_(a, b) a##b
+#define SYNTH_PROFILE_CONCAT(a, b) SYNTH_PROFILE_CONCAT_(a, b)
+#define SYNTH_PROFILE_SCOPE(zone) ProfileScope SYNTH_PROFILE_CONCAT(profileScope, __LINE__)(zone)
+#define SYNTH_PROFILE_END_SAMPLE() SynthProfiler::endSample()
+
+#else
+#define SYNTH_PROFILE_SCOPE(zone) ((void)0)
+#define SYNTH_PROFILE_END_SAMPLE() ((void)0)
+#endif
@@ -30,27 +30,33 @@ SynthVoice::SynthVoice(std::shared_ptr<SynthVoiceModifiers> _modifiers, IMIDIDat
 	*/
 
 	// --- Voice Architecture: 2 synth oscillators
-	osc1 = new SynthOscillator(modifiers->osc1Modifiers, _midiData, kNumSynthOscOutputs, kNumSynthOscModulators);
-	osc2 = new SynthOscillator(modifiers->osc2Modifiers, _midiData, kNumSynthOscOutputs, kNumSynthOscModulators);
+	osc1 = createComponent<SupersawOscillator>(modifiers->osc1Modifiers, _midiData, kNumSynthOscOutputs, kNumSynthOscModulators);
+	osc2 = createComponent<SupersawOscillator>(modifiers->osc2Modifiers, _midiData, kNumSynthOscOutputs, kNumSynthOscModulators);
 
 	// --->> 3. create the new object with the new modifiers for it
-	subOsc = new SynthOscillator(modifiers->subOscModifiers, _midiData, kNumSynthOscOutputs, kNumSynthOscModulators);
+	subOsc = createComponent<SynthOscillator>(modifiers->subOscModifiers, _midiData, kNumSynthOscOutputs, kNumSynthOscModulators);
+
+	// --- Voice Architecture: 4-operator FM engine
+	fmEngine = createComponent<FMOperatorEngine>(modifiers->fmEngineModifiers, _midiData, kNumFMEngineOutputs, kNumFMEngineModulators);
 
 	// --- Voice Architecture: 2 EGs
-	outputEG = new EnvelopeGenerator(modifiers->eg1Modifiers, _midiData, kNumEGOutputs, kNumEGModulators);
-	eg2 = new EnvelopeGenerator(modifiers->eg2Modifiers, _midiData, kNumEGOutputs, kNumEGModulators);
+	outputEG = createComponent<EnvelopeGenerator>(modifiers->eg1Modifiers, _midiData, kNumEGOutputs, kNumEGModulators);
+	eg2 = createComponent<EnvelopeGenerator>(modifiers->eg2Modifiers, _midiData, kNumEGOutputs, kNumEGModulators);
+
+	// --- Voice Architecture: 1 multi-stage EG
+	mseg = createComponent<MultiStageEG>(modifiers->msegModifiers, _midiData, kNumMSEGOutputs, kNumMSEGModulators);
 
 	// --- Voice Architecture: 3 LFOs
-	lfo1 = new LFO(modifiers->lfo1Modifiers, _midiData, kNumLFOOutputs, kNumLFOModulators);
-	lfo2 = new LFO(modifiers->lfo2Modifiers, _midiData, kNumLFOOutputs, kNumLFOModulators);
-	glideLFO = new LFO(modifiers->glideLFOModifiers, _midiData, kNumLFOOutputs, kNumLFOModulators);
+	lfo1 = createComponent<LFO>(modifiers->lfo1Modifiers, _midiData, kNumLFOOutputs, kNumLFOModulators);
+	lfo2 = createComponent<LFO>(modifiers->lfo2Modifiers, _midiData, kNumLFOOutputs, kNumLFOModulators);
+	glideLFO = createComponent<LFO>(modifiers->glideLFOModifiers, _midiData, kNumLFOOutputs, kNumLFOModulators);
 
 	// --- Voice Architecture: 1 Moog Filter (Stereo or Dual-Mono)
-	filter1 = new VALadderFilter(modifiers->filter1Modifiers, _midiData, kNumVALadderFilterOutputs, kNumVALadderFilterModulators);
-	filter2 = new VALadderFilter(modifiers->filter2Modifiers, _midiData, kNumVALadderFilterOutputs, kNumVALadderFilterModulators);
+	filter1 = createComponent<VALadderFilter>(modifiers->filter1Modifiers, _midiData, kNumVALadderFilterOutputs, kNumVALadderFilterModulators);
+	filter2 = createComponent<VALadderFilter>(modifiers->filter2Modifiers, _midiData, kNumVALadderFilterOutputs, kNumVALadderFilterModulators);
 
 	// --- Voice Architecture: 1 DCA for output (Stereo or Dual-Mono)
-	outputDCA = new DCA(modifiers->outputDCAModifiers, _midiData, kNumDCAOutputs, kNumDCAModulators);
+	outputDCA = createComponent<DCA>(modifiers->outputDCAModifiers, _midiData, kNumDCAOutputs, kNumDCAModulators);
 
 	// --- delay FX as insert 
 	// insertDelayFX = new DelayFX(modifiers->delayFXModifiers, _midiData, kNumDelayFXOutputs, kNumDelayFXModulators);
@@ -73,6 +79,13 @@ SynthVoice::SynthVoice(std::shared_ptr<SynthVoiceModifiers> _modifiers, IMIDIDat
 
 	registerModSourceComponent(modulationSource::kEG2_Out, eg2, kEGNormalOutput);
 	registerModSourceComponent(modulationSource::kEG2_BiasedOut, eg2, kEGBiasedOutput);
+
+	registerModSourceComponent(modulationSource::kMSEG_Out, mseg, kMSEGNormalOutput);
+
+	// --- MPE per-note expression lives in the voice's own output array
+	registerModSourceComponent(modulationSource::kMPE_PitchBend, this, kVoiceMPEPitchBendOutput);
+	registerModSourceComponent(modulationSource::kMPE_Pressure, this, kVoiceMPEPressureOutput);
+	registerModSourceComponent(modulationSource::kMPE_Slide, this, kVoiceMPESlideOutput);
 	// ------------------------------------------------------------------------------------------------------------
 
 	// --- REGISTER MOD DESTINATION COMPONENTS --------------------------------------------------------------------
@@ -86,6 +99,8 @@ SynthVoice::SynthVoice(std::shared_ptr<SynthVoiceModifiers> _modifiers, IMIDIDat
 
 	registerModDestinationComponent(modulationDestination::kSubOsc_PW, subOsc);
 
+	registerModDestinationComponent(modulationDestination::kFMEngine_Pitch, fmEngine);
+
 	registerModDestinationComponent(modulationDestination::kFilter1_fc, filter1);		//MODIFY FOR LPF AND HPF
 	registerModDestinationComponent(modulationDestination::kFilter1_Q, filter1);
 	registerModDestinationComponent(modulationDestination::kFilter2_fc, filter2);		//MODIFY FOR LPF AND HPF
@@ -98,6 +113,13 @@ SynthVoice::SynthVoice(std::shared_ptr<SynthVoiceModifiers> _modifiers, IMIDIDat
 
 	registerModDestinationComponent(modulationDestination::kDCA_Amp, outputDCA);
 	registerModDestinationComponent(modulationDestination::kDCA_Pan, outputDCA);
+
+	// --- oversampling: design the decimators once
+	for (uint32_t i = 0; i < kNumVoiceAudioOutputs; i++)
+	{
+		decimator2x[i].design(kHalfBandPairs2x);
+		decimator4x[i].design(kHalfBandPairs4x);
+	}
 	
 	// --- insert delay FX
 	//registerModDestinationComponent(modulationDestination::kDelayFX_FB, insertDelayFX);
@@ -112,6 +134,7 @@ SynthVoice::SynthVoice(std::shared_ptr<SynthVoiceModifiers> _modifiers, IMIDIDat
 	// --- OSC PITCH MOD
 	registerModulatorArrayIndex(modulationSource::kNoneDontCare, modulationDestination::kOsc1_Pitch, kSynthOscPitchMod);
 	registerModulatorArrayIndex(modulationSource::kNoneDontCare, modulationDestination::kOsc2_Pitch, kSynthOscPitchMod);
+	registerModulatorArrayIndex(modulationSource::kNoneDontCare, modulationDestination::kFMEngine_Pitch, kFMEnginePitchMod);
 
 	// --- OSC PW MOD
 	registerModulatorArrayIndex(modulationSource::kNoneDontCare, modulationDestination::kOsc1_PW, kSynthOscPulseWidthMod);
@@ -170,6 +193,7 @@ SynthVoice::SynthVoice(std::shared_ptr<SynthVoiceModifiers> _modifiers, IMIDIDat
 
 	// --- setup the default modulations
 	setFixedModulationRoutings();
+	updateLFOOutputMasks();
 
 	// --- setup update granularity; could do this at Engine level, but maybe in future with an engine that mixed 
 	//     various voice objects, we might want individual granularity control
@@ -180,20 +204,22 @@ SynthVoice::SynthVoice(std::shared_ptr<SynthVoiceModifiers> _modifiers, IMIDIDat
 	glideLFO->getModifiers()->oscMode = LFOMode::kOneShot;
 }
 
-/** delete all sub-component objects */
+/** delete all sub-component objects; in an arena, the arena destroys them after the voice */
 SynthVoice::~SynthVoice()
 {
-	if (osc1) delete osc1;
-	if (osc2) delete osc2;
-	if (subOsc) delete subOsc; 
-	if (lfo1) delete lfo1;
-	if (lfo2) delete lfo2;
-	if (glideLFO) delete glideLFO;
-	if (outputEG) delete outputEG;
-	if (eg2) delete eg2;
-	if (filter1) delete filter1;
-	if (filter2) delete filter2;
-	if (outputDCA) delete outputDCA;
+	destroyComponent(osc1);
+	destroyComponent(osc2);
+	destroyComponent(subOsc);
+	destroyComponent(fmEngine);
+	destroyComponent(lfo1);
+	destroyComponent(lfo2);
+	destroyComponent(glideLFO);
+	destroyComponent(outputEG);
+	destroyComponent(eg2);
+	destroyComponent(mseg);
+	destroyComponent(filter1);
+	destroyComponent(filter2);
+	destroyComponent(outputDCA);
 //	if (insertDelayFX) delete insertDelayFX;
 
 	// --- database
@@ -201,6 +227,8 @@ SynthVoice::~SynthVoice()
 	modDestinationComponents.clear();
 	modulatorArrayIndexes.clear();
 	modSourceOutputArrayIndexes.clear();
+
+	destroyArrays();
 }
 
 /**
@@ -212,22 +240,64 @@ bool SynthVoice::initializeComponent(InitializeInfo& info)
 {
 	if (!validateComponent()) return false;
 
-	osc1->initializeComponent(info);
-	osc2->initializeComponent(info);
-	subOsc->initializeComponent(info); 
+	// --- oscillators and filters run at the oversampled rate
+	hostRateInfo = info;
+	initialized = true;
+	initializeOversampledComponents();
+
 	outputEG->initializeComponent(info);
 	eg2->initializeComponent(info);
+	mseg->initializeComponent(info);
 	lfo1->initializeComponent(info);
 	lfo2->initializeComponent(info);
 	glideLFO->initializeComponent(info);
-	filter1->initializeComponent(info);
-	filter2->initializeComponent(info);
 	outputDCA->initializeComponent(info);
 	//insertDelayFX->initializeComponent(info); // creates delay buffers
 
 	return true;
 }
 
+/**
+	\brief Initialize the oscillators and filters at the host rate times the oversampling factor and clear the decimators
+*/
+void SynthVoice::initializeOversampledComponents()
+{
+	InitializeInfo info(hostRateInfo);
+	info.sampleRate = hostRateInfo.sampleRate*oversamplingFactor;
+
+	osc1->initializeComponent(info);
+	osc2->initializeComponent(info);
+	subOsc->initializeComponent(info);
+	fmEngine->initializeComponent(info);
+	filter1->initializeComponent(info);
+	filter2->initializeComponent(info);
+
+	for (uint32_t i = 0; i < kNumVoiceAudioOutputs; i++)
+	{
+		decimator2x[i].reset();
+		decimator4x[i].reset();
+	}
+}
+
+/**
+	\brief Set the oversampling mode; if the voice has been initialized and the mode changed, the oscillators and filters
+	are re-initialized at the new rate; the oscillators switch to the engine's wave tables for that rate (see
+	OscillatorWaveTables), so nothing is calculated here
+
+	\param mode -- the new oversampling mode
+*/
+void SynthVoice::setOversampling(oversamplingMode mode)
+{
+	if (mode == oversampling)
+		return;
+
+	oversampling = mode;
+	oversamplingFactor = getOversamplingFactor(mode);
+
+	if (initialized)
+		initializeOversampledComponents();
+}
+
 /**
 	\brief Perform startup operations for the component
 	\return true if handled, false if not handled
@@ -235,6 +305,7 @@ bool SynthVoice::initializeComponent(InitializeInfo& info)
 bool SynthVoice::startComponent()
 {
 	voiceRunning = true;
+	fadingOut = false;
 	granularityCounter = -1;
 	return true;
 }
@@ -251,6 +322,7 @@ bool SynthVoice::stopComponent()
 		osc1->stopComponent();
 		osc2->stopComponent();
 		subOsc->stopComponent();
+		fmEngine->stopComponent();
 		lfo1->stopComponent();
 		lfo2->stopComponent();
 		glideLFO->stopComponent();
@@ -258,16 +330,21 @@ bool SynthVoice::stopComponent()
 		filter2->stopComponent();
 		outputEG->stopComponent();
 		eg2->stopComponent();
+		mseg->stopComponent();
 		outputDCA->stopComponent();
 	//	insertDelayFX->stopComponent();
 
 		clearTimestamp();
+		fadingOut = false;
 
 		// --- do we have a note pending from being stolen?
 		if (midiNoteData[kPendingMIDINoteNumber] >= 0 && midiNoteData[kPendingMIDINoteVelocity] >= 0)
 		{
-			// --- start new note (non-stolen now)
-			return doNoteOn(midiNoteData[kPendingMIDINoteNumber], midiNoteData[kPendingMIDINoteVelocity], false, unisonVoiceMode);
+			// --- start new note (non-stolen now); it keeps the expression its MPE channel sent while we shut down
+			MPEExpression pendingExpression = mpeExpression;
+			bool started = doNoteOn(midiNoteData[kPendingMIDINoteNumber], midiNoteData[kPendingMIDINoteVelocity], false);
+			setMPEExpression(pendingExpression);
+			return started;
 		}
 		else
 		{
@@ -294,6 +371,7 @@ bool SynthVoice::resetComponent()
 	osc1->resetComponent();
 	osc2->resetComponent();
 	subOsc->resetComponent();	
+	fmEngine->resetComponent();
 	lfo1->resetComponent();
 	lfo2->resetComponent();
 	glideLFO->resetComponent();
@@ -301,9 +379,16 @@ bool SynthVoice::resetComponent()
 	filter2->resetComponent();
 	outputEG->resetComponent();
 	eg2->resetComponent();
+	mseg->resetComponent();
 	outputDCA->resetComponent();
 //	insertDelayFX->resetComponent();
 
+	for (uint32_t i = 0; i < kNumVoiceAudioOutputs; i++)
+	{
+		decimator2x[i].reset();
+		decimator4x[i].reset();
+	}
+
 	return true;
 }
 
@@ -317,7 +402,7 @@ bool SynthVoice::resetComponent()
 bool SynthVoice::validateComponent()
 {
 	// --- sub-components
-	if (osc1 && osc2 && subOsc && outputEG && eg2 && lfo1 && lfo2 && filter1 && filter2 && outputDCA && glideLFO)// && insertDelayFX)
+	if (osc1 && osc2 && subOsc && fmEngine && outputEG && eg2 && mseg && lfo1 && lfo2 && filter1 && filter2 && outputDCA && glideLFO)// && insertDelayFX)
 	{
 		// --- shared pointers and modifiers
 		if (modifiers && midiData)
@@ -352,84 +437,242 @@ bool SynthVoice::updateComponent()
 }
 
 /**
-	\brief Render the component;
+	\brief Render the component; one sample through renderBlock( ), into the outputs[] array
 	- for ISynthAudioProcessors, this checks and updates the component if needed
 	- for ISynthComponents, this synthesizes the output data into the output array
 
-	\param update -- a flag that is used to update the component; the voice's granularity timer sets/clears this variable
+	\param update -- not used; the voice's granularity timer decides when the components update
 
 	\return true if handled, false if not handled
 */
 bool SynthVoice::renderComponent(bool update)
 {
-	if (!validComponent || !voiceRunning) return false;
-
-	// --- setup granularity of updates - can make an enormous difference in polyphony!
-	bool updateComponents = needsComponentUpdate();
-	
-	// --- check voice done; shut off if it is finished, and return
-	if (isVoiceDone())
+	double left = 0.0;
+	double right = 0.0;
+	if (!renderBlock(&left, &right, 1))
 		return false;
 
-	// --- check for modulation routing change; this should only happen sporadically
-	if (updateComponents)
+	outputs[kVoiceLeftOutput] = left;
+	outputs[kVoiceRightOutput] = right;
+	return true;
+}
+
+/**
+	\brief Render a block of samples into the voice buffers and add them to the mix buffers.
+
+	The block is split into chunks that start on a component update (every updateGranularity samples). The modulators
+	are only read on update cycles, so each chunk renders its first sample (the update) through every component, then
+	the rest of the chunk one component at a time: the EGs as blocks, the oscillators and filters, then the DCA. The
+	output is the same as rendering the components sample by sample. A chunk ends early on the sample that turns the
+	output EG off; the next sample stops the voice or starts its pending note.
+
+	\param leftMix -- left mix buffer; the voice adds its output
+	\param rightMix -- right mix buffer; the voice adds its output
+	\param blockSize -- number of samples to render
+
+	\return true if the voice rendered any samples
+*/
+bool SynthVoice::renderBlock(double* leftMix, double* rightMix, uint32_t blockSize)
+{
+	if (!validComponent) return false;
+
+	// --- the tempo synced components read the timeline on update cycles
+	SynthTransport* transport = midiData->getTransport();
+	uint64_t blockStartSampleIndex = transport ? transport->absoluteSampleIndex : 0;
+
+	bool rendered = false;
+	uint32_t sample = 0;
+	while (sample < blockSize && voiceRunning)
 	{
-		// --- do a fast memory block compare
-		if (memcmp(&modulationRoutings[0], &modifiers->modulationRoutings[0], sizeof(modulationRoutings)) != 0)
+		if (transport)
+			transport->absoluteSampleIndex = blockStartSampleIndex + sample;
+
+		// --- setup granularity of updates - can make an enormous difference in polyphony!
+		bool updateComponents = needsComponentUpdate();
+
+		// --- check voice done; shut off if it is finished (this sample is silent)
+		if (isVoiceDone())
+		{
+			sample++;
+			continue;
+		}
+
+		// --- the chunk runs to the next update
+		uint32_t chunkSize = blockSize - sample;
+		if (chunkSize > updateGranularity - (uint32_t)granularityCounter)
+			chunkSize = updateGranularity - (uint32_t)granularityCounter;
+		if (chunkSize > kVoiceRenderBlockSize)
+			chunkSize = kVoiceRenderBlockSize;
+
+		// --- check for modulation routing change; this should only happen sporadically
+		if (updateComponents)
+		{
+			// --- do a fast memory block compare
+			if (memcmp(&modulationRoutings[0], &modifiers->modulationRoutings[0], sizeof(modulationRoutings)) != 0)
+			{
+				// --- re-do the mod routings
+				updateModRoutings();
+			}
+		}
+
+		// --- render all things that can modulate
+		//
+		//     LFO outputs are only read on update cycles, so the LFOs render one sample of their routed outputs and advance
+		//     their timebases to the next update cycle
+		if (updateComponents)
+		{
+			SYNTH_PROFILE_SCOPE(kProfileLFOs);
+			lfo1->renderUpdateCycle(updateGranularity, true);
+			lfo2->renderUpdateCycle(updateGranularity, true);
+			glideLFO->renderUpdateCycle(updateGranularity, true);
+		}
+
+		// --- first sample: the components update from the EG outputs of this sample
+		uint32_t tailSize = chunkSize - 1;
+		{
+			SYNTH_PROFILE_SCOPE(kProfileEGs);
+			outputEG->renderBlock(&egBuffer[0], 1, updateComponents);
+			eg2->renderBlock(&egBuffer[0], 1, updateComponents);
+			mseg->renderBlock(&egBuffer[0], 1, updateComponents);
+		}
+		if (outputEG->getState() == egState::kOff)
+			tailSize = 0;
+
+		renderOscillatorBlock(updateComponents, 0, 1);
+		renderDCABlock(updateComponents, 0, 1);
+
+		// --- rest of the chunk: no updates, so nothing reads the EG outputs until the next chunk
+		if (tailSize > 0)
+		{
+			{
+				SYNTH_PROFILE_SCOPE(kProfileEGs);
+				tailSize = outputEG->renderBlock(&egBuffer[0], tailSize, false);
+				eg2->renderBlock(&egBuffer[0], tailSize, false);
+				mseg->renderBlock(&egBuffer[0], tailSize, false);
+			}
+
+			renderOscillatorBlock(false, 1, tailSize);
+			renderDCABlock(false, 1, tailSize);
+		}
+
+		// --- mix
+		uint32_t count = tailSize + 1;
+		for (uint32_t i = 0; i < count; i++)
 		{
-			// --- re-do the mod routings
-			updateModRoutings();
+			leftMix[sample + i] += voiceBuffer[kVoiceLeftOutput][i];
+			rightMix[sample + i] += voiceBuffer[kVoiceRightOutput][i];
 		}
+		rendered = true;
+
+		// --- the granularity counter moves over the rest of the chunk
+		granularityCounter += tailSize;
+		sample += count;
 	}
 
-	// --- render voice
-	//
-	// --- render all things that can modulate
-	lfo1->renderComponent(updateComponents);
-	lfo2->renderComponent(updateComponents);
-	glideLFO->renderComponent(updateComponents);
+	return rendered;
+}
 
-	outputEG->renderComponent(updateComponents);
-	eg2->renderComponent(updateComponents);
+/**
+	\brief Render the oscillators and filters into the voice buffers at the host rate; the oversampled modes render
+	several samples per host sample and decimate them back to one
 
+	\param update -- a flag that is used to update the components on the first sample
+	\param offset -- the first sample in the voice buffers
+	\param count -- number of samples to render
+*/
+void SynthVoice::renderOscillatorBlock(bool update, uint32_t offset, uint32_t count)
+{
+	double* left = &voiceBuffer[kVoiceLeftOutput][offset];
+	double* right = &voiceBuffer[kVoiceRightOutput][offset];
+
+	if (oversamplingFactor == 1)
+	{
+		for (uint32_t n = 0; n < count; n++)
+			renderOscillatorsAndFilters(update && n == 0, left[n], right[n]);
+		return;
+	}
+
+	for (uint32_t n = 0; n < count; n++)
+	{
+		// --- only the first sample of an update block updates the components
+		for (uint32_t i = 0; i < oversamplingFactor; i++)
+			renderOscillatorsAndFilters(update && n == 0 && i == 0, oversampledOutput[kVoiceLeftOutput][i], oversampledOutput[kVoiceRightOutput][i]);
+
+		SYNTH_PROFILE_SCOPE(kProfileDecimators);
+		for (uint32_t channel = 0; channel < kNumVoiceAudioOutputs; channel++)
+		{
+			double* samples = &oversampledOutput[channel][0];
+			if (oversamplingFactor == 4)
+				decimator4x[channel].decimateBlock(samples, samples, 2);
+			voiceBuffer[channel][offset + n] = decimator2x[channel].decimate(samples[0], samples[1]);
+		}
+	}
+}
+
+/**
+	\brief Apply the output DCA to the voice buffers, in place, as one block with the DCA's gain ramps
+
+	\param update -- a flag that is used to update the DCA at the top of the block
+	\param offset -- the first sample in the voice buffers
+	\param count -- number of samples to process
+*/
+void SynthVoice::renderDCABlock(bool update, uint32_t offset, uint32_t count)
+{
+	SYNTH_PROFILE_SCOPE(kProfileDCA);
+	outputDCA->processAudioBlock(&voiceBuffer[kVoiceLeftOutput][offset], &voiceBuffer[kVoiceRightOutput][offset], count, update);
+}
+
+/**
+	\brief Render the oscillators and the filters for one sample at the oscillator rate (the host rate times the
+	oversampling factor)
+
+	\param update -- a flag that is used to update the components
+	\param left -- receives the left output
+	\param right -- receives the right output
+*/
+void SynthVoice::renderOscillatorsAndFilters(bool update, double& left, double& right)
+{
 	// --- oscillators can be modulators also
-	osc1->renderComponent(updateComponents);
-	osc2->renderComponent(updateComponents);
-	subOsc->renderComponent(updateComponents);
-	
+	{
+		SYNTH_PROFILE_SCOPE(kProfileOscillators);
+		osc1->renderComponent(update);
+		osc2->renderComponent(update);
+		subOsc->renderComponent(update);
+		fmEngine->renderComponent(update);
+	}
+
 	// --- render the audio engine
 	//     form the sum of the two outputs, i stereo from this point on
-	outputs[kVoiceLeftOutput] = osc1->getOutputValue(kLeftOscOutputWithAmpGain) + osc2->getOutputValue(kLeftOscOutputWithAmpGain) + subOsc->getOutputValue(kLeftOscOutputWithAmpGain);
-	outputs[kVoiceRightOutput] = osc1->getOutputValue(kRightOscOutputWithAmpGain) + osc2->getOutputValue(kRightOscOutputWithAmpGain) + subOsc->getOutputValue(kRightOscOutputWithAmpGain);
+	double audio[kNumVoiceAudioOutputs] = { 0.0 };
+	audio[kVoiceLeftOutput] = osc1->getOutputValue(kLeftOscOutputWithAmpGain) + osc2->getOutputValue(kLeftOscOutputWithAmpGain) + subOsc->getOutputValue(kLeftOscOutputWithAmpGain) + fmEngine->getOutputValue(kFMEngineLeftOutput);
+	audio[kVoiceRightOutput] = osc1->getOutputValue(kRightOscOutputWithAmpGain) + osc2->getOutputValue(kRightOscOutputWithAmpGain) + subOsc->getOutputValue(kRightOscOutputWithAmpGain) + fmEngine->getOutputValue(kFMEngineRightOutput);
 
-	// --- setup for the filter -> DCA render into buffers
+	// --- setup for the filter render
 	RenderInfo processAudioInfo;
 
 	// --- set update flag for audio processors too
-	processAudioInfo.updateComponent = updateComponents;
+	processAudioInfo.updateComponent = update;
 
-	// --- filter and DCA will processes audio "in-place" = input and output buffers are same: writes output over input data
+	// --- filters will processes audio "in-place" = input and output buffers are same: writes output over input data
 	//
-	//     Can do this for fastest processing and not requiring intermediate arrays because filter and DCA are IN SERIES
+	//     Can do this for fastest processing and not requiring intermediate arrays because the filters are IN SERIES
 	//     Parallel operations require the intermediate arrays
-	processAudioInfo.inputData = &outputs[0];
-	processAudioInfo.outputData = &outputs[0];
-	processAudioInfo.numInputChannels = kNumVoiceOutputs;
-	processAudioInfo.numOutputChannels = kNumVoiceOutputs;
+	processAudioInfo.inputData = &audio[0];
+	processAudioInfo.outputData = &audio[0];
+	processAudioInfo.numInputChannels = kNumVoiceAudioOutputs;
+	processAudioInfo.numOutputChannels = kNumVoiceAudioOutputs;
 
 	// --- filter processes audio in-place
-	if( modifiers->enableHPF )
-		filter2->processAudio(processAudioInfo);
-	if( modifiers->enableLPF )
-		filter1->processAudio(processAudioInfo);
-	
-	// --- Delay FX processes audio in-place
-	// insertDelayFX->processAudio(processAudioInfo);
-
-	// --- DCA processes audio in-place
-	outputDCA->processAudio(processAudioInfo);
+	{
+		SYNTH_PROFILE_SCOPE(kProfileFilters);
+		if( modifiers->enableHPF )
+			filter2->processAudio(processAudioInfo);
+		if( modifiers->enableLPF )
+			filter1->processAudio(processAudioInfo);
+	}
 
-	return true;
+	left = audio[kVoiceLeftOutput];
+	right = audio[kVoiceRightOutput];
 }
 
 /**
@@ -444,27 +687,37 @@ bool SynthVoice::shutDownComponent()
 	return true;
 }
 
+/**
+	\brief Fade out the current note and stop, without a pending note; the SynthEngine has started the new note on another
+	voice, so the fade runs alongside its attack. Note-off messages are ignored from here on.
+	\return true if handled, false if not handled
+*/
+bool SynthVoice::doFadeOut()
+{
+	if (!voiceRunning)
+		return false;
+
+	// --- drop any note pending from an earlier steal
+	midiNoteData[kPendingMIDINoteNumber] = -1;
+	midiNoteData[kPendingMIDINoteVelocity] = -1;
+
+	fadingOut = true;
+	return outputEG->fadeOutComponent();
+}
+
 /**
 	\brief Begin a new note operation, or steal the voice if needed; called by the SynthEngine
 
 	\param midiNoteNumber the note number of the key that was depressed
 	\param midiNoteVelocity the note velocity
 	\param stealVoice flag to steal the voice if needed
-	\param _unisonVoiceMode flag to enable unison mode, which uses panning and detuning of multiple voices to achieve the effect
 
 	\return true if handled, false if not
 */
-bool SynthVoice::doNoteOn(uint32_t midiNoteNumber, uint32_t midiNoteVelocity, bool stealVoice, bool _unisonVoiceMode)
+bool SynthVoice::doNoteOn(uint32_t midiNoteNumber, uint32_t midiNoteVelocity, bool stealVoice)
 {
-	// --- save unison flag
-	unisonVoiceMode = _unisonVoiceMode;
-
-	double zero = 0.0;
-	if (!unisonVoiceMode)
-	{
-		setVoicePanValue(zero);
-		setUnisonDetuneIntensity(zero);
-	}
+	// --- no per-note expression left over from the last note; the engine applies the MPE channel's expression after this
+	clearMPEExpression();
 
 	// --- if we are stealing this voice, save the data and go to shutdown mode
 	if (stealVoice)
@@ -508,6 +761,7 @@ bool SynthVoice::doNoteOn(uint32_t midiNoteNumber, uint32_t midiNoteVelocity, bo
 		osc1->getModifiers()->modulationControls[kSynthOscPortamentoMod].modulationRange = glideRange;
 		osc2->getModifiers()->modulationControls[kSynthOscPortamentoMod].modulationRange = glideRange;
 		subOsc->getModifiers()->modulationControls[kSynthOscPortamentoMod].modulationRange = glideRange;
+		fmEngine->getModifiers()->modulationControls[kFMEnginePortamentoMod].modulationRange = glideRange;
 
 		// --- glide fo = 1/time
 		glideLFO->getModifiers()->oscFreqControl = 1.0 / (modifiers->portamentoTime_mSec / 1000.0);
@@ -520,6 +774,7 @@ bool SynthVoice::doNoteOn(uint32_t midiNoteNumber, uint32_t midiNoteVelocity, bo
 	osc1->doNoteOn(midiPitch, midiNoteNumber, midiNoteVelocity);
 	osc2->doNoteOn(midiPitch, midiNoteNumber, midiNoteVelocity);
 	subOsc->doNoteOn(midiPitch, midiNoteNumber, midiNoteVelocity);
+	fmEngine->doNoteOn(midiPitch, midiNoteNumber, midiNoteVelocity);
 
 	lfo1->doNoteOn(midiPitch, midiNoteNumber, midiNoteVelocity);
 	lfo2->doNoteOn(midiPitch, midiNoteNumber, midiNoteVelocity);
@@ -531,6 +786,7 @@ bool SynthVoice::doNoteOn(uint32_t midiNoteNumber, uint32_t midiNoteVelocity, bo
 
 	outputEG->doNoteOn(midiPitch, midiNoteNumber, midiNoteVelocity);
 	eg2->doNoteOn(midiPitch, midiNoteNumber, midiNoteVelocity);
+	mseg->doNoteOn(midiPitch, midiNoteNumber, midiNoteVelocity);
 
 	outputDCA->doNoteOn(midiPitch, midiNoteNumber, midiNoteVelocity);
 //	insertDelayFX->doNoteOn(midiPitch, midiNoteNumber, midiNoteVelocity);
@@ -549,12 +805,17 @@ bool SynthVoice::doNoteOn(uint32_t midiNoteNumber, uint32_t midiNoteVelocity, bo
 */  
 bool SynthVoice::doNoteOff(uint32_t midiNoteNumber, uint32_t midiNoteVelocity)
 {
+	// --- the note was handed over to another voice
+	if (fadingOut)
+		return true;
+
 	double midiPitch = midiFreqTable[midiNoteNumber];
 
 	// --- send the EGs into release mode
 	osc1->doNoteOff(midiPitch, midiNoteNumber, midiNoteVelocity);
 	osc2->doNoteOff(midiPitch, midiNoteNumber, midiNoteVelocity);
 	subOsc->doNoteOff(midiPitch, midiNoteNumber, midiNoteVelocity);
+	fmEngine->doNoteOff(midiPitch, midiNoteNumber, midiNoteVelocity);
 	lfo1->doNoteOff(midiPitch, midiNoteNumber, midiNoteVelocity);
 	lfo2->doNoteOff(midiPitch, midiNoteNumber, midiNoteVelocity);
 	glideLFO->doNoteOff(midiPitch, midiNoteNumber, midiNoteVelocity);
@@ -562,6 +823,7 @@ bool SynthVoice::doNoteOff(uint32_t midiNoteNumber, uint32_t midiNoteVelocity)
 	filter2->doNoteOff(midiPitch, midiNoteNumber, midiNoteVelocity);
 	outputEG->doNoteOff(midiPitch, midiNoteNumber, midiNoteVelocity);
 	eg2->doNoteOff(midiPitch, midiNoteNumber, midiNoteVelocity);
+	mseg->doNoteOff(midiPitch, midiNoteNumber, midiNoteVelocity);
 	outputDCA->doNoteOff(midiPitch, midiNoteNumber, midiNoteVelocity);
 //	insertDelayFX->doNoteOff(midiPitch, midiNoteNumber, midiNoteVelocity);
 
@@ -607,6 +869,37 @@ void SynthVoice::updateModRoutings()
 	// --- bulk memory block copy FROM modifiers TO our storage array
 	memcpy(&modulationRoutings[0], &modifiers->modulationRoutings[0], sizeof(modulationRoutings));
 
+	// --- LFOs only render what is routed
+	updateLFOOutputMasks();
+}
+
+/**
+\brief set the LFO output masks from the programmable routings; the glide LFO only feeds the (fixed) portamento routings
+*/
+void SynthVoice::updateLFOOutputMasks()
+{
+	uint32_t lfo1Mask = 0;
+	uint32_t lfo2Mask = 0;
+
+	for (unsigned int i = 0; i < MAX_MOD_ROUTINGS; i++)
+	{
+		if (modulationRoutings[i].modDest == modulationDestination::kNoneDontCare)
+			continue;
+
+		ISynthComponent* sourceComponent = getModSourceComponent(modulationRoutings[i].modSource);
+		int32_t sourceOutputArrayIndex = getModSourceOutputArrayIndex(modulationRoutings[i].modSource);
+		if (sourceOutputArrayIndex < 0 || sourceOutputArrayIndex >= kNumLFOOutputs)
+			continue;
+
+		if (sourceComponent == lfo1)
+			lfo1Mask |= 1 << sourceOutputArrayIndex;
+		else if (sourceComponent == lfo2)
+			lfo2Mask |= 1 << sourceOutputArrayIndex;
+	}
+
+	lfo1->setOutputMask(lfo1Mask);
+	lfo2->setOutputMask(lfo2Mask);
+	glideLFO->setOutputMask(1 << kLFOUnipolarDownRamp);
 }
 
 
@@ -631,50 +924,30 @@ void SynthVoice::setFixedModulationRoutings()
 
 	// --- because it is an oscillator, we want it to track the other oscillator's glide curve
 	addModulationRouting(glideLFO, kLFOUnipolarDownRamp, subOsc, kSynthOscPortamentoMod);
+	addModulationRouting(glideLFO, kLFOUnipolarDownRamp, fmEngine, kFMEnginePortamentoMod);
+
+	// --- MPE per-note pitch bend --> all oscillator pitch modulators (output is 0.0 unless MPE is running)
+	addModulationRouting(this, kVoiceMPEPitchBendOutput, osc1, kSynthOscPitchMod);
+	addModulationRouting(this, kVoiceMPEPitchBendOutput, osc2, kSynthOscPitchMod);
+	addModulationRouting(this, kVoiceMPEPitchBendOutput, subOsc, kSynthOscPitchMod);
+	addModulationRouting(this, kVoiceMPEPitchBendOutput, fmEngine, kFMEnginePitchMod);
 
 	// --- add more FIXED routings here...
 }
 
 
 /**
-	\brief Set the unison detune intensity value for each sub-component oscillator
-
-	\param unisonDetuneIntensity the intensity from [0, +1]
-*/
-void SynthVoice::setUnisonDetuneIntensity(double& unisonDetuneIntensity)
-{
-	if (!validComponent) return;
-
-	// --- set detune intensity of all pitched oscillators
-	osc1->setUnisonDetuneIntensity(unisonDetuneIntensity);
-	osc2->setUnisonDetuneIntensity(unisonDetuneIntensity);
-
-	// --- NOT setting the sub to detune during Unison Mode - it would sound funny
-	// NO NO NO subOsc->setUnisonDetuneIntensity(unisonDetuneIntensity);
-
-}
-
-/**
-	\brief Set DCA pan value; called for unison mode and also from MIDI pan modulation
+	\brief Set the per-note MPE expression; the values are written to the voice's modulation source outputs and picked
+	up by the modulators on the next update cycle
 
-	\param panValue the new pan value from [-1, +1]
+	\param expression the per-note expression state
 */
-void SynthVoice::setVoicePanValue(double& panValue)
+void SynthVoice::setMPEExpression(const MPEExpression& expression)
 {
-	if (!validComponent) return;
+	mpeExpression = expression;
 
-	// --- set pan value [-1, +1]
-	outputDCA->setPanValue(panValue);
+	// --- pitch bend is routed into the osc pitch modulators at unity intensity, so normalize to their range
+	outputs[kVoiceMPEPitchBendOutput] = expression.pitchBend_semitones / kSynthOsc_Pitch_ModRange;
+	outputs[kVoiceMPEPressureOutput] = expression.pressure;
+	outputs[kVoiceMPESlideOutput] = expression.slide;
 }
-
-
-
-
-
-
-
-
-
-
-
-
@@ -2,11 +2,16 @@
 #include "synthobjects.h"
 
 #include "synthoscillator.h"
+#include "SupersawOscillator.h"
+#include "FMOperatorEngine.h"
 #include "envelopegenerator.h"
+#include "MultiStageEG.h"
 #include "lfo.h"
 #include "valadderfilter.h"
 #include "dca.h"
 #include "DelayFX.h" // delay FX suite
+#include "HalfBandDecimator.h" // oversampling
+#include "SynthProfiler.h" // optional CPU profiling
 
 #include <vector>
 #include <map>
@@ -18,12 +23,21 @@
 enum {
 	kVoiceLeftOutput,
 	kVoiceRightOutput,
+	kVoiceMPEPitchBendOutput,	/* per-note pitch bend, normalized to kSynthOsc_Pitch_ModRange */
+	kVoiceMPEPressureOutput,	/* per-note pressure, unipolar [0, +1] */
+	kVoiceMPESlideOutput,		/* per-note slide (CC74), unipolar [0, +1] */
 	kNumVoiceOutputs
 };
 
+// --- the first two outputs are audio; the rest are modulation sources
+const unsigned int kNumVoiceAudioOutputs = 2;
+
 // --- modulator indexes for this component
 const unsigned int kNumVoiceModulators = 0;
 
+// --- block rendering: longest run the voice renders into its own buffers at once
+const uint32_t kVoiceRenderBlockSize = 64;
+
 /*  Modify this list if you customize the component objects; it's easy to add output channels
 	--------------------------------------------------------------------------------------------------------------------------- 
 	--- MODULATION SOURCES 
@@ -42,6 +56,13 @@ const unsigned int kNumVoiceModulators = 0;
 	- normal output
 	- biased output (for pitch modulation)
 
+	MULTI-STAGE EG:
+	- normal output
+
+	GLOBAL LFOs (owned by the SynthEngine, shared by all voices):
+	- normal output
+	- inverted output
+
 	OSCILLATOR:
 	- left osc output
 	- right osc output
@@ -58,6 +79,11 @@ const unsigned int kNumVoiceModulators = 0;
 	DELAY FX:
 	- currently none
 
+	VOICE (MPE per-note expression):
+	- pitch bend
+	- pressure
+	- slide (CC74)
+
 
 	---------------------------------------------------------------------------------------------------------------------------
 	--- MODULATION DESTINATIONS 
@@ -81,6 +107,10 @@ const unsigned int kNumVoiceModulators = 0;
 	- max-down amp modulation (AM)
 	- portamento modulation (from glide LFO)
 
+	FM ENGINE:
+	- pitch modulation
+	- portamento modulation (from glide LFO)
+
 	FILTERS:
 	- fc modulation
 	- Q modulation (2nd order and higher filters only)
@@ -116,6 +146,14 @@ enum class modulationSource {
 	kOsc1_Out, 
 	kOsc2_Out, 
 	kSubOsc_Out, 
+	kMPE_PitchBend,
+	kMPE_Pressure,
+	kMPE_Slide,
+	kMSEG_Out,
+	kGlobalLFO1_Out,
+	kGlobalLFO1_OutInv,
+	kGlobalLFO2_Out,
+	kGlobalLFO2_OutInv,
 	kNumModulationSources };	
 
 // --- note: not adding the subOsc for pitch mod
@@ -141,6 +179,7 @@ enum class modulationDestination {
 	kDelayFX_Mix, 
 	kDelayFX_FB, 
 	kChorus_Depth, 
+	kFMEngine_Pitch,
 	kNumModulationDestinations};
 
 /**
@@ -164,6 +203,24 @@ struct ModulatorRouting
 	}
 };
 
+/**
+\struct MPEExpression
+\ingroup SynthStructures
+\brief Compact per-note expression state for MIDI Polyphonic Expression (MPE); each voice owns one of these for the note it is playing
+
+\param pitchBend_semitones:	per-note pitch bend in semitones (already scaled by the MPE pitch bend range)
+\param pressure:				per-note (channel) pressure, unipolar [0, +1]
+\param slide:					per-note slide (CC74), unipolar [0, +1]
+*/
+struct MPEExpression
+{
+	MPEExpression() {}
+
+	double pitchBend_semitones = 0.0;
+	double pressure = 0.0;
+	double slide = 0.0;
+};
+
 /** overload for operator < so that ModulatorRouting structures can be used to index a map */
 bool operator <(const ModulatorRouting& x, const ModulatorRouting& y);
 
@@ -177,6 +234,7 @@ bool operator <(const ModulatorRouting& x, const ModulatorRouting& y);
 	\param enablePortamento:		turn glide (portamento) on/off
 	\param portamentoTime_mSec:		glide time in mSec
 	\param legatoMode:				turn legato mode on/off
+	\param oversampling:			oversampling for the oscillators and filters; changing it re-initializes them
 	\param modulationRoutings:		a set of programmable modulation routings for this voice
 	\param progModulationControls:	a set of controls (intensity, range, invert) for each modulation routing
 */
@@ -197,13 +255,18 @@ struct SynthVoiceModifiers
 	// --- legato mode
 	bool legatoMode = false; 
 
+	// --- oscillator and filter oversampling
+	oversamplingMode oversampling = oversamplingMode::k1x;
+
 	// --- modifiers for our sub-components
 	std::shared_ptr<SynthOscModifiers> osc1Modifiers = std::make_shared<SynthOscModifiers>();	///<modifiers for osc1, shared across voices
 	std::shared_ptr<SynthOscModifiers> osc2Modifiers = std::make_shared<SynthOscModifiers>();	///<modifiers for osc2 shared across voices
 	std::shared_ptr<SynthOscModifiers> subOscModifiers = std::make_shared<SynthOscModifiers>();	///<modifiers for osc2 shared across voices
+	std::shared_ptr<FMEngineModifiers> fmEngineModifiers = std::make_shared<FMEngineModifiers>();	///<modifiers for the FM engine, shared across voices
 
 	std::shared_ptr<EGModifiers> eg1Modifiers = std::make_shared<EGModifiers>();				///<modifiers for eg1, shared across voices
 	std::shared_ptr<EGModifiers> eg2Modifiers = std::make_shared<EGModifiers>();				///<modifiers for eg2 shared across voices
+	std::shared_ptr<MultiStageEGModifiers> msegModifiers = std::make_shared<MultiStageEGModifiers>();	///<modifiers for the multi-stage EG, shared across voices
 
 	std::shared_ptr<LFOModifiers> lfo1Modifiers = std::make_shared<LFOModifiers>();				///<modifiers for lfo1, shared across voices
 	std::shared_ptr<LFOModifiers> lfo2Modifiers = std::make_shared<LFOModifiers>();				///<modifiers for lfo2, shared across voices
@@ -234,6 +297,10 @@ struct SynthVoiceModifiers
 	- Left Channel
 	- Right Channel
 
+	Oversampling: in 2x and 4x modes the oscillators and filters are initialized and rendered at that multiple of the
+	sample rate, then decimated by half-band stages (4x -> 2x -> 1x) before the DCA. Modulators, EGs and the DCA stay
+	at the host rate and the update granularity is still counted in host samples.
+
 	Control I/F:
 	Use SynthVoiceModifiers structure; note that it's sub-component pointers are shared across all voices
 
@@ -272,15 +339,31 @@ public:
 	virtual bool updateComponent();
 	virtual bool renderComponent(bool update);
 
+	// --- render a block of samples and add it to the mix buffers
+	bool renderBlock(double* leftMix, double* rightMix, uint32_t blockSize);
+
 	// --- shutdown component
 	virtual bool shutDownComponent();
 
+	// --- fade out a note that has been handed over to another voice; see SynthEngine::doPolyNoteOn( )
+	bool doFadeOut();
+	bool isFadingOut() { return fadingOut; }	///< true while the voice fades out a handed over note
+
 	// --- note these are specialized voice functions
-	virtual bool doNoteOn(uint32_t midiNoteNumber, uint32_t midiNoteVelocity, bool stealVoice, bool _unisonVoiceMode = false);
+	virtual bool doNoteOn(uint32_t midiNoteNumber, uint32_t midiNoteVelocity, bool stealVoice);
 	virtual bool doNoteOff(uint32_t midiNoteNumber, uint32_t midiNoteVelocity);
 
 	/** called when modulation routings have changed*/
 	void updateModRoutings();
+
+	// --- oversampling; re-initializes the oscillators and filters if the voice was initialized and the mode changed
+	void setOversampling(oversamplingMode mode);
+
+	/** current oversampling mode */
+	oversamplingMode getOversampling() { return oversampling; }
+
+	/** tell the block rendered LFOs which of their outputs are routed */
+	void updateLFOOutputMasks();
 	
 	/** \brief add a new routing, may be fixed or dynamic (programmable) 
 		
@@ -307,6 +390,12 @@ public:
 		return false;
 	}
 
+	/** state of the output EG, for voice activity displays and voice stealing */
+	egState getOutputEGState() { return outputEG->getState(); }
+
+	/** current output EG level, for voice stealing */
+	double getOutputEGLevel() { return outputEG->getEnvelopeOutput(); }
+
 	/** one-time function to setup the initial (fexed/default) modulation routings */
 	void setFixedModulationRoutings();
 
@@ -314,29 +403,32 @@ public:
 	ISynthComponent* getModSourceComponent(modulationSource source)
 	{
 		if (source >= modulationSource::kNumModulationSources) return nullptr;
-		return modSourceComponents[source];
+		modSourceComponentMap::const_iterator it = modSourceComponents.find(source);
+		return it != modSourceComponents.end() ? it->second : nullptr;
 	}
 
 	/** get a synth component interface pointer based on the modulation destination */
 	ISynthComponent* getModDestComponent(modulationDestination dest)
 	{
 		if (dest >= modulationDestination::kNumModulationDestinations) return nullptr;
-		return modDestinationComponents[dest];
+		modDestComponentMap::const_iterator it = modDestinationComponents.find(dest);
+		return it != modDestinationComponents.end() ? it->second : nullptr;
 	}
 
 	/** get the output array index of a specific mod source */
 	int32_t getModSourceOutputArrayIndex(modulationSource source)
 	{
 		if (source >= modulationSource::kNumModulationSources) return -1;
-		return modSourceOutputArrayIndexes[source];
+		modSourceOutputArrayIndexMap::const_iterator it = modSourceOutputArrayIndexes.find(source);
+		return it != modSourceOutputArrayIndexes.end() ? it->second : -1;
 	}
 
 	/** get the index of a specific modulator */
 	int32_t getModulatorIndex(modulationSource source, modulationDestination dest)
 	{
 		if (source >= modulationSource::kNumModulationSources || dest >= modulationDestination::kNumModulationDestinations) return -1;
-		ModulatorRouting routing(source, dest);
-		return modulatorArrayIndexes[routing];
+		modulatorArrayIndexMap::const_iterator it = modulatorArrayIndexes.find(ModulatorRouting(source, dest));
+		return it != modulatorArrayIndexes.end() ? it->second : -1;
 	}
 
 	// --- timestamps for determining note age
@@ -349,9 +441,10 @@ public:
 	uint32_t getMidiNoteStealNumber() { return midiNoteData[kPendingMIDINoteNumber]; }	///< get the pending MIDI note number for a voice that is being stolen
 	uint32_t getMidiNoteVelocity() { return midiNoteData[kMIDINoteVelocity]; }			///< get the current MIDI velocity of the voice
 
-	// --- for unison detune
-	void setUnisonDetuneIntensity(double& unisonDetuneIntensity);
-	void setVoicePanValue(double& panValue);
+	// --- for MPE per-note expression
+	void setMPEExpression(const MPEExpression& expression);
+	void clearMPEExpression() { MPEExpression neutral; setMPEExpression(neutral); }
+	const MPEExpression& getMPEExpression() { return mpeExpression; }
 
 	/// get an output value from the output array
 	double getOutputValue(uint32_t index)
@@ -550,16 +643,34 @@ protected:
 		return update;
 	}
 
+	// --- render the oscillators and filters for one sample at the oversampled rate
+	void renderOscillatorsAndFilters(bool update, double& left, double& right);
+
+	// --- render the oscillators and filters into the voice buffers, decimating in the oversampled modes
+	void renderOscillatorBlock(bool update, uint32_t offset, uint32_t count);
+
+	// --- apply the output DCA to the voice buffers
+	void renderDCABlock(bool update, uint32_t offset, uint32_t count);
+
+	// --- initialize the components that run at the oversampled rate
+	void initializeOversampledComponents();
+
 	// --- SYNTH COMPONENTS; note that these are old-fashioned (raw) pointers - this will be needed for aggregating components or swapping interface pointers
 	//
 	SynthOscillator* osc1 = nullptr;
 	SynthOscillator* osc2 = nullptr;
 	SynthOscillator* subOsc = nullptr; // -->> 1. add member to .h file
 
+	// --- 4-operator FM engine, mixed with the oscillators
+	FMOperatorEngine* fmEngine = nullptr;
+
 	// --- 2 EGs
 	EnvelopeGenerator* outputEG = nullptr;
 	EnvelopeGenerator* eg2 = nullptr;
 
+	// --- 1 multi-stage EG (modulation only)
+	MultiStageEG* mseg = nullptr;
+
 	// --- 3 LFOs
 	LFO* lfo1 = nullptr;
 	LFO* lfo2 = nullptr;
@@ -584,6 +695,9 @@ protected:
 	// --- voice timestamp, for knowing the age of a voice
 	unsigned int timestamp = 0;						///<voice timestamp, for knowing the age of a voice
 
+	// --- fading out a handed over note; ignores note-off and does not count as a playing voice
+	bool fadingOut = false;							///< true while fading out, see doFadeOut( )
+
 	// --- MIDI note data
 	int midiNoteData[kNumMIDINoteData] = { -1 };	///< MIDI note information for this voice; contains CURRENT MIDI note information and PENDING information for voice-steal operation
 
@@ -591,7 +705,21 @@ protected:
 	uint32_t updateGranularity = 1;					///< number of sample invervals to wait between component updates
 	int granularityCounter = -1;					///< the counter for gramular updating; -1 = update NOW
 
-	bool unisonVoiceMode = false;					///< true if voice is in unison mode
+	// --- MPE per-note expression; doNoteOn( ) starts every note neutral
+	MPEExpression mpeExpression;					///< expression of the current note, also in the MPE outputs[]
+
+	// --- oversampling
+	oversamplingMode oversampling = oversamplingMode::k1x;			///< current mode
+	uint32_t oversamplingFactor = 1;								///< oscillator and filter rate multiplier
+	InitializeInfo hostRateInfo;									///< the host rate info from initializeComponent( )
+	bool initialized = false;										///< true after initializeComponent( )
+	double oversampledOutput[kNumVoiceAudioOutputs][4] = { { 0.0 } };	///< one voice sample at the oversampled rate
+	HalfBandDecimator decimator2x[kNumVoiceAudioOutputs];			///< 2x -> 1x stage
+	HalfBandDecimator decimator4x[kNumVoiceAudioOutputs];			///< 4x -> 2x stage
+
+	// --- block rendering
+	double voiceBuffer[kNumVoiceAudioOutputs][kVoiceRenderBlockSize] = { { 0.0 } };	///< voice audio for the current run
+	double egBuffer[kVoiceRenderBlockSize] = { 0.0 };								///< EG block output (the EGs are read through their outputs[])
 	bool voiceRunning = false;						///< NOTE: this is different from noteOn; after the note turns off, we still are running until the output EG has expired
 
 	// --- databases
@@ -24,7 +24,7 @@ VA1Filter::VA1Filter(std::shared_ptr<VA1FilterModifiers> _modifiers, IMIDIData*
 	componentType = componentType::kVA1Filter;
 
 	// --- create modulators
-	modulators[kVA1FilterFcMod] = new Modulator(kDefaultOutputValueOFF, filterModulationRange, modTransform::kNoTransform);
+	modulators[kVA1FilterFcMod] = createModulator(kDefaultOutputValueOFF, filterModulationRange, modTransform::kNoTransform);
 
 	// --- validate all pointers
 	validComponent = validateComponent();
@@ -33,12 +33,8 @@ VA1Filter::VA1Filter(std::shared_ptr<VA1FilterModifiers> _modifiers, IMIDIData*
 /** Destructor: delete output array and modulators */
 VA1Filter::~VA1Filter()
 {
-	// --- delete our arrays and nullify
-	if (outputs) delete[] outputs;
-	if (modulators)delete[] modulators;
-
-	outputs = nullptr;
-	modulators = nullptr;
+	// --- delete our arrays (and modulators) and nullify
+	destroyArrays();
 }
 
 /**
@@ -301,6 +297,7 @@ double VA1Filter::doFilter(filterType filter, double input, unsigned int channel
 
 	// --- update memory
 	z1[channel] = vn + lpf;
+	snapToZero(z1[channel]);
 
 	// --- form the HPF = INPUT = LPF
 	double hpf = input - lpf;
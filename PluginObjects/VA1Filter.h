@@ -148,6 +148,18 @@ public:
 	//     and it returns the filter output data
 	double doFilter(filterType filter, double input, unsigned int channel);
 
+	/** the lowpass output only, without the filter type tests; same as doFilter(filterType::kLPF1, input, channel) */
+	inline double doLowpassFilter(double input, unsigned int channel)
+	{
+		double vn = (input - z1[channel])*alpha;
+		double lpf = vn + z1[channel];
+		z1[channel] = vn + lpf;
+		snapToZero(z1[channel]);
+
+		outputs[channel] = lpf;
+		return lpf;
+	}
+
 	void setFilterCoeffs(double filter_fc, double _alpha, double _vaFilter_g)
 	{
 		alpha = _alpha;
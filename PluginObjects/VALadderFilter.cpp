@@ -35,7 +35,7 @@ VALadderFilter::VALadderFilter(std::shared_ptr<VALadderFilterModifiers> _modifie
 			subFilterModifiers->filter = filterType::kAPF1;
 
 		// --- create sub-filters
-		va1Filters[i] = new VA1Filter(subFilterModifiers, _midiData, kNumVA1FilterOutputs, kNumVA1FilterModulators);
+		va1Filters[i] = createComponent<VA1Filter>(subFilterModifiers, _midiData, kNumVA1FilterOutputs, kNumVA1FilterModulators);
 	}
 
 	// --- calculate the range of mod frequencies in semi-tones
@@ -45,16 +45,19 @@ VALadderFilter::VALadderFilter(std::shared_ptr<VALadderFilterModifiers> _modifie
 	filterModulationRange = semitonesBetweenFrequencies(kMinFilter_fc, kMaxFilter_fc) / 2.0;
 
 	// --- create modulators
-	modulators[kVALadderFilterFcMod] = new Modulator(kDefaultOutputValueOFF, filterModulationRange, modTransform::kNoTransform);
+	modulators[kVALadderFilterFcMod] = createModulator(kDefaultOutputValueOFF, filterModulationRange, modTransform::kNoTransform);
 
 	// --- note this modulator is not used for first order filters
-	modulators[kVALadderFilterQMod] = new Modulator(kDefaultOutputValueOFF, kFilterGUI_Q_Range / 2.0, modTransform::kNoTransform);
+	modulators[kVALadderFilterQMod] = createModulator(kDefaultOutputValueOFF, kFilterGUI_Q_Range / 2.0, modTransform::kNoTransform);
 
 	// --- this is a priority modulator from the osc output (Tom Sawyer) -- note limiting range to 1/3 of the normal range to prevent aliasing from broken filter
-	modulators[kVALadderFilterOscToFcMod] = new Modulator(kDefaultOutputValueOFF, filterModulationRange / 3.0, modTransform::kNoTransform, true); /* true = priority modulator */
+	modulators[kVALadderFilterOscToFcMod] = createModulator(kDefaultOutputValueOFF, filterModulationRange / 3.0, modTransform::kNoTransform, true); /* true = priority modulator */
 	
 	// --- validate all pointers
 	validComponent = validateComponent();
+
+	// --- a kernel for the default filter until the first update
+	selectRenderKernel();
 }
 
 /** Destructor: delete output array and modulators */
@@ -64,15 +67,11 @@ VALadderFilter::~VALadderFilter()
 	for (unsigned int i = 0; i < kNumMoogSubFilters; i++)
 	{
 		// --- now delete the filter
-		delete va1Filters[i];
+		destroyComponent(va1Filters[i]);
 	}
 
-	// --- delete our arrays and nullify
-	if (outputs) delete[] outputs;
-	if (modulators)delete[] modulators;
-
-	outputs = nullptr;
-	modulators = nullptr;
+	// --- delete our arrays (and modulators) and nullify
+	destroyArrays();
 }
 
 /**
@@ -245,6 +244,9 @@ bool VALadderFilter::updateComponent()
 	// --- the Q
 	filter_Q = modifiers->qControl + modulators[kVALadderFilterQMod]->getModulatedValue();
 
+	// --- the render kernel, on a filter type or NLP change
+	selectRenderKernel();
+
 	// --- then do the final coeff calculations
 	return calculateFilterCoeffs();
 }
@@ -305,12 +307,15 @@ bool VALadderFilter::processAudio(RenderInfo& renderInfo)
 		renderInfo.numOutputChannels > 2)
 		return false; // not handled
 
-	// --- process left channel (must have it)
-	doFilter(modifiers->filter, renderInfo.inputData[0], CHANNEL_0);
+	// --- the kernel also depends on the channel count
+	if (renderInfo.numInputChannels != numChannels)
+	{
+		numChannels = renderInfo.numInputChannels;
+		selectRenderKernel();
+	}
 
-	// --- process right channel if we have one
-	if (renderInfo.numInputChannels == 2)
-		doFilter(modifiers->filter, renderInfo.inputData[1], CHANNEL_1);
+	// --- process the left channel (must have it) and the right channel if we have one
+	(this->*renderKernel)(renderInfo.inputData);
 
 	// --- check for internal render only
 	if (renderInfo.renderInternal)
@@ -419,6 +424,82 @@ bool VALadderFilter::doFilter(filterType filter, double input, unsigned int chan
 	return false; // unknown filter type :(
 }
 
+/**
+	\brief One sample of the ladder for every channel; the same filter as doFilter( ), with the ladder, NLP and channel
+	count as template arguments so the tests below are resolved by the compiler
+
+	\param input the audio input samples, one per channel
+*/
+template <uint32_t Stages, bool NLP, uint32_t Channels>
+void VALadderFilter::renderLadder(const double* input)
+{
+	for (uint32_t channel = 0; channel < Channels; channel++)
+	{
+		// --- form sigma the brute force way, as calculateSigma( )
+		double sigma = 0.0;
+		if (Stages == 2)
+		{
+			sigma += va1Filters[kFilter1]->getFeedbackStorageValue(channel);
+			sigma += va1Filters[kFilter2]->getFeedbackStorageValue(channel);
+			sigma += va1Filters[kFilter5]->getFeedbackStorageValue(channel);
+		}
+		else
+		{
+			for (unsigned int i = 0; i < kNumMoogSubFilters; i++)
+				sigma += va1Filters[i]->getFeedbackStorageValue(channel);
+		}
+
+		// --- apply compensation
+		double filterInput = input[channel] * (1.0 + modifiers->gainCompensation*K);
+
+		// --- calculate input to first filter
+		double filterInput_u = (filterInput - K*sigma)*alpha0;
+
+		// --- apply non linear saturation; normalized version
+		if (NLP)
+			filterInput_u = tanh(modifiers->nlpSaturation*filterInput_u) / tanh(modifiers->nlpSaturation);
+
+		// --- cascade of 3 filters (half ladder) or 4 filters
+		double dLP1 = va1Filters[kFilter1]->doLowpassFilter(filterInput_u, channel);
+		double dLP2 = va1Filters[kFilter2]->doLowpassFilter(dLP1, channel);
+		if (Stages == 2)
+		{
+			outputs[kVA1LadderFilterOutput_0 + channel] = va1Filters[kFilter5]->doLowpassFilter(dLP2, channel);
+		}
+		else
+		{
+			double dLP3 = va1Filters[kFilter3]->doLowpassFilter(dLP2, channel);
+			double dLP4 = va1Filters[kFilter4]->doLowpassFilter(dLP3, channel);
+			outputs[kVA1LadderFilterOutput_0 + channel] = a*filterInput_u + b*dLP1 + c*dLP2 + d*dLP3 + e*dLP4;
+		}
+	}
+}
+
+/**
+	\brief Point renderKernel at the instantiation for the current ladder, NLP and channel count, only when one of them
+	has changed
+*/
+void VALadderFilter::selectRenderKernel()
+{
+	uint32_t stages = modifiers->filter == filterType::kLPF2 ? 2 : 4;
+	bool nlp = modifiers->applyNLP;
+	uint32_t channels = numChannels == 2 ? 2 : 1;
+	if (renderKernel && stages == kernelStages && nlp == kernelNLP && channels == kernelChannels)
+		return;
+
+	// --- [full ladder][NLP][stereo]
+	static const RenderKernel ladderKernels[2][2][2] = {
+		{ { &VALadderFilter::renderLadder<2, false, 1>, &VALadderFilter::renderLadder<2, false, 2> },
+		  { &VALadderFilter::renderLadder<2, true, 1>, &VALadderFilter::renderLadder<2, true, 2> } },
+		{ { &VALadderFilter::renderLadder<4, false, 1>, &VALadderFilter::renderLadder<4, false, 2> },
+		  { &VALadderFilter::renderLadder<4, true, 1>, &VALadderFilter::renderLadder<4, true, 2> } } };
+
+	kernelStages = stages;
+	kernelNLP = nlp;
+	kernelChannels = channels;
+	renderKernel = ladderKernels[stages == 4 ? 1 : 0][nlp ? 1 : 0][channels - 1];
+}
+
 /**
 	\brief Calcualte sigma, the sum of all the storage feedbacks from each subfilter
 
@@ -106,6 +106,12 @@ struct VALadderFilterModifiers
 	- kFilterFcMod:				[-1, +1] fc modulation
 	- kFilterQMod:				[-1, +1] Q modulation
 
+	Render kernels:
+	processAudio( ) runs a template instantiation of renderLadder( ) for the ladder (half or full), NLP on/off and the
+	channel count; updateComponent( ) selects it when the filter type or NLP changes, and processAudio( ) when the channel
+	count changes, so the per-sample path has no mode tests. doFilter( ) is kept for outer containers that choose the
+	filter type per call.
+
 	\author Will Pirkle
 	\version Revision : 1.0
 	\date Date : 2017 / 09 / 24
@@ -153,6 +159,19 @@ protected:
 	// --- do the final filter calculations
 	bool calculateFilterCoeffs();
 
+	// --- one sample of every channel; Stages = 2 for the half ladder (kLPF2), 4 for the full ladder and its Oberheim taps
+	template <uint32_t Stages, bool NLP, uint32_t Channels>
+	void renderLadder(const double* input);
+
+	// --- the selected render kernel
+	typedef void (VALadderFilter::*RenderKernel)(const double* input);
+	void selectRenderKernel();
+	RenderKernel renderKernel = nullptr;		///< renderLadder( ) instantiation for the current mode
+	uint32_t kernelStages = 0;					///< ladder stages that renderKernel was selected for
+	bool kernelNLP = false;						///< NLP setting that renderKernel was selected for
+	uint32_t kernelChannels = 0;				///< channel count that renderKernel was selected for
+	uint32_t numChannels = 1;					///< input channels of the last processAudio( ) call
+
 	// --- coeffs
 	double K = 0.0;			// --- global feedback value
 	double alpha0 = 0.0;	// --- input gain compensator from delay free loop resolution
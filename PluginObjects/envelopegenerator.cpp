@@ -1,5 +1,7 @@
 #include "envelopegenerator.h"
 
+#include <string.h>
+
 /**
 	\brief Object constructor specialized to properly and safely share the modifiers and MIDI data
 	\param _modifiers -- the GUI modifiers structure for this component, to be shared with all similar components
@@ -24,8 +26,8 @@ EnvelopeGenerator::EnvelopeGenerator(std::shared_ptr<EGModifiers> _modifiers, IM
 	//     a modulation range of +/- repeat time in mSec
 	//kRepeatTimeModRange = (kMaxLFO_fo - kMinLFO_fo) / 2.0;		// --> +/- 50%
 
-	modulators[kEGRepeatTimeMod] = new Modulator(kDefaultOutputValueOFF, repeatTimeModRange, modTransform::kNoTransform);
-	modulators[kEGRepeatTimeSDMod] = new Modulator(kDefaultOutputValueOFF, repeatTimeSDModRange, modTransform::kNoTransform);
+	modulators[kEGRepeatTimeMod] = createModulator(kDefaultOutputValueOFF, repeatTimeModRange, modTransform::kNoTransform);
+	modulators[kEGRepeatTimeSDMod] = createModulator(kDefaultOutputValueOFF, repeatTimeSDModRange, modTransform::kNoTransform);
 
 	// --- validate all pointers
 	validComponent = validateComponent();
@@ -41,12 +43,8 @@ EnvelopeGenerator::EnvelopeGenerator(std::shared_ptr<EGModifiers> _modifiers, IM
 /** Destructor: delete output array and modulators */
 EnvelopeGenerator::~EnvelopeGenerator()
 {
-	// --- delete our arrays and nullify
-	if (outputs) delete[] outputs;
-	if (modulators)delete[] modulators;
-
-	outputs = nullptr;
-	modulators = nullptr;
+	// --- delete our arrays (and modulators) and nullify
+	destroyArrays();
 }
 
 /**
@@ -79,6 +77,47 @@ bool EnvelopeGenerator::initializeComponent(InitializeInfo& info)
 	return true;
 }
 
+/**
+	\brief Get the segment coefficient exp(-log((1 + tco)/tco)/samples) from the cache, calculating and storing it on a miss
+
+	\param tco -- the time constant overshoot for the curve
+	\param samples -- the segment length in samples (time x sample rate)
+
+	\return the segment coefficient
+*/
+double EGCoefficientCache::getCoefficient(double tco, double samples)
+{
+	// --- zero-length segment: exp(-inf)
+	if (samples <= 0.0)
+		return 0.0;
+
+	// --- hash the bits of the keys
+	uint64_t samplesBits = 0;
+	uint64_t tcoBits = 0;
+	memcpy(&samplesBits, &samples, sizeof(double));
+	memcpy(&tcoBits, &tco, sizeof(double));
+	uint64_t hash = (samplesBits ^ (tcoBits * 0x9E3779B97F4A7C15ull)) * 0x9E3779B97F4A7C15ull;
+	CacheEntry& entry = cache[(uint32_t)(hash >> 32) & (kEGCoeffCacheSize - 1)];
+
+	// --- hit
+	if (entry.samples == samples && entry.tco == tco)
+		return entry.coeff;
+
+	// --- miss: calculate and replace
+	entry.tco = tco;
+	entry.samples = samples;
+	entry.coeff = exp(-log((1.0 + tco) / tco) / samples);
+
+	return entry.coeff;
+}
+
+/** empty every slot; the engine calls this from reset( ) */
+void EGCoefficientCache::clearCache()
+{
+	for (uint32_t i = 0; i < kEGCoeffCacheSize; i++)
+		cache[i] = CacheEntry();
+}
+
 /**
 	\brief Perform startup operations for the component
 	\return true if handled, false if not handled
@@ -115,6 +154,7 @@ bool EnvelopeGenerator::stopComponent()
 	// --- clear output and go to OFF state
 	envelopeOutput = 0.0;
 	state = egState::kOff;
+	fadingOut = false;
 
 	return true;
 }
@@ -136,6 +176,7 @@ bool EnvelopeGenerator::resetComponent()
 
 	// --- state
 	state = egState::kOff;
+	fadingOut = false;
 
 	// --- reset 
 	setEGMode(egMode);
@@ -226,6 +267,10 @@ bool EnvelopeGenerator::doNoteOn(double midiPitch, uint32_t midiNoteNumber, uint
 */
 bool EnvelopeGenerator::doNoteOff(double midiPitch, uint32_t midiNoteNumber, uint32_t midiNoteVelocity)
 {
+	// --- a fade out runs to the end
+	if (fadingOut)
+		return true;
+
 	if (sustainOverride)
 	{
 		// --- set releasePending flag
@@ -258,6 +303,25 @@ bool EnvelopeGenerator::updateComponent()
 		sustainUpdate = true;
 
 	sustainLevel = modifiers->sustainLevel;
+
+	// --- tempo for the repeat subdivision: the host transport wins over the modifier
+	SynthTransport* transport = midiData->getTransport();
+	double newBPM = transport ? transport->bpm : modifiers->bpm;
+	sigDenominator = transport ? transport->timeSigDenominator : modifiers->sigDenominator;
+
+	bool tempoUpdate = false;
+	if (newBPM > 0.0 && variableChanged(bpm, newBPM))
+	{
+		bpm = newBPM;
+		maxRepeatTimeSD = 60000.0 / bpm * 16.0;
+		minRepeatTimeSD = 60000.0 / bpm * 0.0625;
+		tempoUpdate = true;
+	}
+
+	// --- switching into subdivide mode needs a fresh repeat time too
+	if (variableChanged(subdivide, modifiers->subdivide))
+		tempoUpdate = true;
+
 	subdivide = modifiers->subdivide;
 
 	// --- these are expensive functions, so only call when modified
@@ -265,7 +329,7 @@ bool EnvelopeGenerator::updateComponent()
 	if (!subdivide && variableChanged(repeatTime_mSec, modifiers->repeatTime_mSec))
 		calculateRepeatTime(modifiers->repeatTime_mSec);
 
-	if (subdivide && variableChanged(repeatSubDiv, modifiers->repeatSubDiv))
+	if (subdivide && (tempoUpdate || variableChanged(repeatSubDiv, modifiers->repeatSubDiv)))
 		calculateRepeatTimeFromSubDiv(modifiers->repeatSubDiv);
 
 	if (variableChanged(delayTime_mSec, modifiers->delayTime_mSec))
@@ -290,7 +354,7 @@ bool EnvelopeGenerator::updateComponent()
 }
 
 /**
-	\brief Render the component;
+	\brief Render the component; this is a one sample block, see renderBlock( )
 	- for ISynthAudioProcessors, this checks and updates the component if needed
 	- for ISynthComponents, this synthesizes the output data into the output array
 
@@ -299,11 +363,33 @@ bool EnvelopeGenerator::updateComponent()
 	\return true if handled, false if not handled
 */
 bool EnvelopeGenerator::renderComponent(bool update)
+{
+	double output = 0.0;
+	return renderBlock(&output, 1, update) > 0;
+}
+
+/**
+	\brief Render a block of EG output values. Each exponential segment is an iteration of y[n+1] = offset + coeff*y[n]
+	whose closed form y[n] = yInf + (y[0] - yInf)*coeff^n gives the number of samples left in the segment up front;
+	those samples are then rendered with the bare recurrence, without the per-sample state machine and threshold tests.
+	The samples next to a segment boundary (and the short delay/shutdown/repeat states) go through doEnvelopeGenerator( ),
+	so the output is the same as running the state machine blockSize times.
+
+	The block ends early on the sample that turns the EG off, so that the voice can stop (or start its pending note)
+	on the next sample.
+
+	\param egBuffer -- buffer to receive blockSize EG output values (the normal output)
+	\param blockSize -- number of samples to render
+	\param update -- a flag that is used to update the component once at the top of the block
+
+	\return the number of samples rendered; less than blockSize only if the EG turned off
+*/
+uint32_t EnvelopeGenerator::renderBlock(double* egBuffer, uint32_t blockSize, bool update)
 {
 	// --- check valid flag
-	if (!validComponent) return false;
+	if (!validComponent || !egBuffer) return 0;
 
-	// --- run the modulators
+	// --- run the modulators, once per block
 	bool didModulate = runModuators(update);
 	//if( !didModulate )
 	//	return false;
@@ -366,8 +452,106 @@ bool EnvelopeGenerator::renderComponent(bool update)
 	if (update)
 		updateComponent();
 
-	// --- render EG
-	return doEnvelopeGenerator();
+	bool wasOff = state == egState::kOff;
+	uint32_t sample = 0;
+	while (sample < blockSize)
+	{
+		// --- find the recurrence for the current segment; repeat mode needs the per-sample timer
+		uint32_t segmentSamples = 0;
+		double coeff = 0.0;
+		double offset = 0.0;
+
+		if (repeatTime_mSec == 0.0)
+		{
+			if (state == egState::kAttack && attackTime_mSec > 0.0)
+			{
+				coeff = attackCoeff;
+				offset = attackOffset;
+				segmentSamples = calculateSegmentSamples(coeff, offset, 1.0);
+			}
+			else if (state == egState::kDecay && decayTime_mSec > 0.0)
+			{
+				coeff = decayCoeff;
+				offset = decayOffset;
+				segmentSamples = calculateSegmentSamples(coeff, offset, sustainLevel);
+			}
+			else if (state == egState::kRelease && releaseTime_mSec > 0.0 && !sustainOverride)
+			{
+				coeff = releaseCoeff;
+				offset = releaseOffset;
+				segmentSamples = calculateSegmentSamples(coeff, offset, 0.0);
+			}
+			else if (state == egState::kSustain)
+			{
+				// --- constant: coeff = 0, offset = sustain level
+				offset = sustainLevel;
+				segmentSamples = blockSize - sample + 2;
+			}
+		}
+
+		// --- leave the last two samples of the segment to the FSM; the one that crosses the threshold, and one more
+		//     in case the closed form rounds up
+		if (segmentSamples > 2)
+		{
+			uint32_t count = segmentSamples - 2;
+			if (count > blockSize - sample)
+				count = blockSize - sample;
+
+			double output = envelopeOutput;
+			for (uint32_t i = 0; i < count; i++)
+			{
+				output = offset + output*coeff;
+				egBuffer[sample++] = output;
+			}
+			envelopeOutput = output;
+			continue;
+		}
+
+		doEnvelopeGenerator();
+		egBuffer[sample++] = envelopeOutput;
+
+		// --- stop on the sample that turned the EG off
+		if (!wasOff && state == egState::kOff)
+			break;
+	}
+
+	outputs[kEGNormalOutput] = envelopeOutput;
+	outputs[kEGBiasedOutput] = envelopeOutput - sustainLevel;
+
+	return sample;
+}
+
+/**
+	\brief Calculate the number of samples it takes the segment recurrence y[n+1] = offset + coeff*y[n] to reach
+	(or cross) the target value, starting from the current envelope output; from the closed form:
+
+	y[n] = yInf + (y[0] - yInf)*coeff^n, where yInf = offset/(1 - coeff)
+
+	n = ceil( log((target - yInf)/(y[0] - yInf)) / log(coeff) )
+
+	\param coeff -- the segment coefficient
+	\param offset -- the segment offset
+	\param target -- the threshold that ends the segment
+
+	\return the number of samples including the one that crosses the target; 0 if the segment is already finished
+*/
+uint32_t EnvelopeGenerator::calculateSegmentSamples(double coeff, double offset, double target)
+{
+	if (coeff <= 0.0 || coeff >= 1.0)
+		return 0;
+
+	double yInf = offset / (1.0 - coeff);
+	double ratio = (target - yInf) / (envelopeOutput - yInf);
+
+	// --- already at or past the target, or (numerically) never getting there
+	if (ratio >= 1.0 || ratio <= 0.0)
+		return 0;
+
+	double samples = ceil(log(ratio) / log(coeff));
+	if (samples >= (double)0xFFFFFFFF)
+		return 0xFFFFFFFF;
+
+	return (uint32_t)samples;
 }
 
 /**
@@ -395,6 +579,28 @@ bool EnvelopeGenerator::shutDownComponent()
 	return true; // handled
 }
 
+/**
+	\brief Fade the output to zero over the shutdown time and turn off, whatever the legato and reset-to-zero settings;
+	used for a voice that has handed its note over to another voice (see SynthEngine::doPolyNoteOn( ))
+	\return true if handled, false if not handled
+*/
+bool EnvelopeGenerator::fadeOutComponent()
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- calculate the linear inc values based on current outputs
+	incShutdown = -(1000.0*envelopeOutput) / shutdownTime_mSec / sampleRate;
+
+	// --- taper in the shutdown state; note-off and the sustain pedal no longer apply
+	state = egState::kShutdown;
+	fadingOut = true;
+	sustainOverride = false;
+	releasePending = false;
+
+	return true; // handled
+}
+
 /**
 \brief Calculate the repeat time in mSec based on the subdivision given on the GUI, the tempo, and the time signature
 
@@ -404,39 +610,17 @@ void EnvelopeGenerator::calculateRepeatTimeFromSubDiv(egSubDiv subDiv)
 {
 	repeatSubDiv = subDiv;
 
-	double beatLength = 60000.0 / bpm;
-	double noteMultiplier = 0.0;
-
 	if( subDiv == egSubDiv::kOff )
 	{
 		repeatTime_mSec = 0.0;
 		reTimer.setTargetValueInSamples( 0 );
 		return;
 	}
-	else if( subDiv == egSubDiv::kWhole )
-		noteMultiplier = 4.0;
-	else if( subDiv == egSubDiv::kDottedHalf )
-		noteMultiplier = 3.0;
-	else if( subDiv == egSubDiv::kHalf )
-		noteMultiplier = 2.0;
-	else if( subDiv == egSubDiv::kDottedQuarter )
-		noteMultiplier = 1.5;
-	else if( subDiv == egSubDiv::kQuarter )
-		noteMultiplier = 1.0;
-	else if( subDiv == egSubDiv::kDottedEigth )
-		noteMultiplier = 0.75;
-	else if( subDiv == egSubDiv::kTripletQuarter )
-		noteMultiplier = 0.66;
-	else if( subDiv == egSubDiv::kEigth )
-		noteMultiplier = 0.5;
-	else if( subDiv == egSubDiv::kTripletEigth )
-		noteMultiplier = 0.33;
-	else if( subDiv == egSubDiv::kSixteenth )
-		noteMultiplier = 0.25;
-
-	repeatTime_mSec = beatLength * noteMultiplier;
-
-	reTimer.setTargetValueInSamples(sampleRate*repeatTime_mSec / 1000);
+
+	double beatLength = 60000.0 / bpm;
+	double noteMultiplier = egSubDivToBeats(subDiv);
+
+	calculateRepeatTime(beatLength * noteMultiplier);
 }
 
 /**
@@ -448,7 +632,8 @@ void EnvelopeGenerator::calculateRepeatTime(double repeatTime)
 {
 	repeatTime_mSec = repeatTime;
 
-	reTimer.setTargetValueInSamples(sampleRate*repeatTime / 1000);
+	// --- round to the nearest sample so tempo synced repeats stay on the grid
+	reTimer.setTargetValueInSamples((uint32_t)(sampleRate*repeatTime / 1000.0 + 0.5));
 }
 
 /**
@@ -463,6 +648,27 @@ void EnvelopeGenerator::calculateDelayTime(double delayTime)
 	egTimer.setTargetValueInSamples(sampleRate*delayTime / 1000);
 }
 
+/**
+	\brief Get a segment coefficient exp(-log((1 + tco)/tco)/samples); the engine's cache avoids the log/exp on every note-on
+
+	\param tco -- the time constant overshoot for the curve
+	\param samples -- the segment length in samples
+
+	\return the segment coefficient
+*/
+double EnvelopeGenerator::getSegmentCoefficient(double tco, double samples)
+{
+	EGCoefficientCache* coefficientCache = midiData ? midiData->getEGCoefficientCache() : nullptr;
+	if (coefficientCache)
+		return coefficientCache->getCoefficient(tco, samples);
+
+	// --- zero-length segment: exp(-inf)
+	if (samples <= 0.0)
+		return 0.0;
+
+	return exp(-log((1.0 + tco) / tco) / samples);
+}
+
 /**
 	\brief Calculate the attack time variables including the coefficient and offsets
 
@@ -478,7 +684,7 @@ void EnvelopeGenerator::calculateAttackTime(double attackTime, double attackTime
 	double samples = sampleRate*( (attackTime_mSec*attackTimeScalar) / 1000.0);
 
 	// --- coeff and base for iterative exponential calculation
-	attackCoeff = exp(-log((1.0 + attackTCO) / attackTCO) / samples);
+	attackCoeff = getSegmentCoefficient(attackTCO, samples);
 	attackOffset = (1.0 + attackTCO)*(1.0 - attackCoeff);
 }
 
@@ -497,7 +703,7 @@ void EnvelopeGenerator::calculateDecayTime(double decayTime, double decayTimeSca
 	double samples = sampleRate*( (decayTime_mSec*decayTimeScalar) / 1000.0);
 
 	// --- coeff and base for iterative exponential calculation
-	decayCoeff = exp(-log((1.0 + decayTCO) / decayTCO) / samples);
+	decayCoeff = getSegmentCoefficient(decayTCO, samples);
 	decayOffset = (sustainLevel - decayTCO)*(1.0 - decayCoeff);
 }
 
@@ -516,7 +722,7 @@ void EnvelopeGenerator::calculateReleaseTime(double releaseTime, double releaseT
 	double samples = sampleRate*( (releaseTime_mSec*releaseTimeScalar) / 1000.0);
 
 	// --- coeff and base for iterative exponential calculation
-	releaseCoeff = exp(-log((1.0 + releaseTCO) / releaseTCO) / samples);
+	releaseCoeff = getSegmentCoefficient(releaseTCO, samples);
 	releaseOffset = -releaseTCO*(1.0 - releaseCoeff);
 }
 
@@ -644,7 +850,7 @@ bool EnvelopeGenerator::doEnvelopeGenerator()
 		}
 		case egState::kShutdown:
 		{
-			if (modifiers->resetToZero)
+			if (modifiers->resetToZero || fadingOut)
 			{
 				// --- the shutdown state is just a linear taper since it is so short
 				envelopeOutput += incShutdown;
@@ -654,6 +860,7 @@ bool EnvelopeGenerator::doEnvelopeGenerator()
 				{
 					state = egState::kOff;		// go to next state
 					envelopeOutput = 0.0;		// reset envelope
+					fadingOut = false;
 					break;
 				}
 			}
@@ -22,6 +22,71 @@ enum class egTCMode { kAnalog, kDigital };
 enum class egState { kOff, kDelay, kAttack, kDecay, kSustain, kRelease, kShutdown, kShutdownForRepeat };
 enum class egSubDiv { kOff, kWhole, kDottedHalf, kHalf, kDottedQuarter, kQuarter, kDottedEigth, kTripletQuarter, kEigth, kTripletEigth, kSixteenth};
 
+/**
+\brief Convert a note subdivision to its length in beats (quarter notes); used for all tempo synced times
+
+\param subDiv: the subdivision
+\return the length in beats, or 0.0 for egSubDiv::kOff
+*/
+inline double egSubDivToBeats(egSubDiv subDiv)
+{
+	switch (subDiv)
+	{
+		case egSubDiv::kWhole:			return 4.0;
+		case egSubDiv::kDottedHalf:		return 3.0;
+		case egSubDiv::kHalf:			return 2.0;
+		case egSubDiv::kDottedQuarter:	return 1.5;
+		case egSubDiv::kQuarter:		return 1.0;
+		case egSubDiv::kDottedEigth:	return 0.75;
+		case egSubDiv::kTripletQuarter:	return 0.66;
+		case egSubDiv::kEigth:			return 0.5;
+		case egSubDiv::kTripletEigth:	return 0.33;
+		case egSubDiv::kSixteenth:		return 0.25;
+		default:						return 0.0;
+	}
+}
+
+// --- coefficient cache size; must be a power of two
+const uint32_t kEGCoeffCacheSize = 256;
+
+/**
+	\class EGCoefficientCache
+	\ingroup SynthClasses
+	\brief A small direct-mapped cache of the exponential segment coefficients coeff = exp(-log((1 + TCO)/TCO)/samples).
+
+	The key is the (TCO, segment length in samples) pair; since the length in samples is time x sample rate, a cached
+	value can never be reused at the wrong sample rate. The TCO selects the curve, so attack and decay/release curves
+	for both egTCMode::kAnalog and egTCMode::kDigital share the same table.
+
+	With velocity-to-attack or note-to-decay scaling there are at most 128 distinct scaled times per segment, so after
+	the first few notes every note-on is a cache hit instead of a log( ) and an exp( ).
+
+	The synth engine owns one cache for all of its voices (see IMIDIData::getEGCoefficientCache( )); it is constructed
+	with the engine and cleared in reset( ), so the audio thread never allocates it and engines rendering on different
+	threads never share one. An EG without a cache calculates its coefficients directly.
+*/
+class EGCoefficientCache
+{
+public:
+	EGCoefficientCache() {}
+
+	// --- lookup, calculating and storing on a miss
+	double getCoefficient(double tco, double samples);
+
+	// --- empty every slot
+	void clearCache();
+
+protected:
+	struct CacheEntry
+	{
+		double tco = -1.0;		///< key: time constant overshoot (never negative, so -1 marks an empty slot)
+		double samples = -1.0;	///< key: segment length in samples
+		double coeff = 0.0;		///< cached coefficient
+	};
+
+	CacheEntry cache[kEGCoeffCacheSize];	///< direct-mapped storage
+};
+
 /**
 	\struct EGModifiers
 	\ingroup SynthStructures
@@ -121,8 +186,12 @@ public:
 	virtual bool updateComponent();
 	virtual bool renderComponent(bool update);
 
+	// --- render a block of EG output values; whole segments are rendered at once
+	uint32_t renderBlock(double* egBuffer, uint32_t blockSize, bool update);
+
 	// --- specific to the EG component
 	virtual bool shutDownComponent();
+	bool fadeOutComponent();
 
 	// --- modifier getter
 	std::shared_ptr<EGModifiers> getModifiers() { return modifiers; }
@@ -132,6 +201,7 @@ public:
 
 	// --- accessors - allow owner to get our state
 	egState getState() { return state; }			///< returns current state of the EG finite state machine
+	double getEnvelopeOutput() { return envelopeOutput; }	///< returns the current envelope output sample
 
 	// --- output EG identifer access
 	bool isOutputEG() { return outputEG; }			///< returns true if this EG is connected to the output DCA
@@ -146,6 +216,12 @@ protected:
 	void calculateDecayTime(double decayTime, double decayTimeScalar = 1.0);
 	void calculateReleaseTime(double releaseTime, double releaseTimeScalar = 1.0);
 	
+	// --- segment coefficient, from the engine's cache if there is one
+	double getSegmentCoefficient(double tco, double samples);
+
+	// --- samples left in the current exponential segment
+	uint32_t calculateSegmentSamples(double coeff, double offset, double target);
+
 	// --- generate it
 	bool doRepeat();
 	bool doEnvelopeGenerator();
@@ -209,6 +285,7 @@ protected:
 
 	// --- inc value for shutdown
 	double incShutdown = 0.0;			///< shutdown linear incrementer
+	bool fadingOut = false;				///< the shutdown is a fade out (see fadeOutComponent( )), not a steal
 
 	// --- stage variable
 	egState state = egState::kOff;		///< EG state variable
@@ -235,8 +312,8 @@ protected:
 	// Modulator Range
 	double maxRepeatTime = 5000.0;
 	double minRepeatTime = 0.0;
-	double maxRepeatTimeSD = 6000.0 / bpm * 16.0;
-	double minRepeatTimeSD = 6000.0 / bpm * 0.0625;
+	double maxRepeatTimeSD = 60000.0 / bpm * 16.0;
+	double minRepeatTimeSD = 60000.0 / bpm * 0.0625;
 	double repeatTimeModRange = ( maxRepeatTime - minRepeatTime ) / 4.0;	// +/- 25% bipolar range
 	double repeatTimeSDModRange = ( maxRepeatTimeSD - minRepeatTimeSD ) / 2.0;	// +/- 50% bipolar range
 };
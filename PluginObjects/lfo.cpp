@@ -1,5 +1,7 @@
 #include "lfo.h"
 
+#include <string.h>
+
 /**
 	\brief Object constructor specialized to properly and safely share the modifiers and MIDI data
 	\param _modifiers -- the GUI modifiers structure for this component, to be shared with all similar components
@@ -24,26 +26,24 @@ LFO::LFO(std::shared_ptr<LFOModifiers> _modifiers, IMIDIData* _midiData, uint32_
 	componentType = componentType::kLFO;
 
 	// --- create modulators
-	modulators[kLFOFreqMod] = new Modulator(kDefaultOutputValueOFF, kLFO_Freq_ModRange, modTransform::kNoTransform);
+	modulators[kLFOFreqMod] = createModulator(kDefaultOutputValueOFF, kLFO_Freq_ModRange, modTransform::kNoTransform);
 
-	modulators[kLFOMaxDownAmpMod] = new Modulator(kDefaultOutputValueON, kLFO_Amp_ModRange, modTransform::kMaxDownTransform);
+	modulators[kLFOMaxDownAmpMod] = createModulator(kDefaultOutputValueON, kLFO_Amp_ModRange, modTransform::kMaxDownTransform);
 
-	modulators[kLFOPulseWidthMod] = new Modulator(kDefaultOutputValueOFF, kLFO_PW_ModRange, modTransform::kNoTransform);
+	modulators[kLFOPulseWidthMod] = createModulator(kDefaultOutputValueOFF, kLFO_PW_ModRange, modTransform::kNoTransform);
 	
 	// --- validate all pointers
 	validComponent = validateComponent();
 
+	// --- kernels for the default waveform until the first update
+	selectRenderKernels();
 }
 
 /** Destructor: delete output array and modulators */
 LFO::~LFO()
 {
-	// --- delete our arrays and nullify
-	if (outputs) delete[] outputs;
-	if (modulators)delete[] modulators;
-
-	outputs = nullptr;
-	modulators = nullptr;
+	// --- delete our arrays (and modulators) and nullify
+	destroyArrays();
 }
 
 /**
@@ -207,8 +207,16 @@ bool LFO::updateComponent()
 	// --- bound the amplitude to our range
 	boundValue(oscAmplitude, kMinLFO_amp, kMaxLFO_amp);
 
+	// --- tempo sync needs the host transport
+	SynthTransport* transport = nullptr;
+	if (modifiers->tempoSync && modifiers->cycle_beats > 0.0)
+		transport = midiData->getTransport();
+
 	// --- caculate osc freq with control value modulated by modulator LINEARLY; just add the modulator*range
-	oscFrequency = modifiers->oscFreqControl + modulators[kLFOFreqMod]->getModulatedValue();
+	if (transport)
+		oscFrequency = transport->bpm / (60.0*modifiers->cycle_beats);
+	else
+		oscFrequency = modifiers->oscFreqControl + modulators[kLFOFreqMod]->getModulatedValue();
 
 	// --- bound the frequency to our range
 	boundValue(oscFrequency, kMinLFO_fo, kMaxLFO_fo);
@@ -222,6 +230,16 @@ bool LFO::updateComponent()
 	// --- calcualte phase inc = fo/fs
 	phaseInc = oscFrequency / sampleRate;
 
+	// --- free running + tempo sync: lock the phase to the host timeline; beats -> phase once per update
+	if (transport && oscMode == LFOMode::kFreeRun)
+	{
+		double cycles = transport->getBeatPosition() / modifiers->cycle_beats;
+		modCounter = cycles - floor(cycles);
+	}
+
+	// --- render kernels, on a waveform or mode change
+	selectRenderKernels();
+
 	return true; // handled
 
 }
@@ -292,177 +310,507 @@ bool LFO::doOscillate()
 	// --- then, advance modulo by quadPhaseInc = 0.25 = 90 degrees, AND wrap if needed
 	advanceAndCheckWrapModulo(modCounterQP, quadPhaseInc);
 
-	// --- setup for switch/case statement
-	int oscillatorWaveform = enumToInt(oscWave);
+	// --- calculate the oscillator value; no kernel if we don't know what kind of osc they want
+	if (!sampleKernel)
+		return false;
+
+	(this->*sampleKernel)();
 
-	// --- calculate the oscillator value
-	switch (oscillatorWaveform)
+	// --- invert these
+	outputs[kLFOQuadPhaseOutputInverted] = -outputs[kLFOQuadPhaseOutput];
+	outputs[kLFONormalOutputInverted] = -outputs[kLFONormalOutput];
+	outputs[kLFOUnipolarOutputFromMax] = bipolarToUnipolar(outputs[kLFONormalOutput]);
+
+	// --- then, apply amplitude gain/mod
+	for (unsigned int i = 0; i < kNumLFOOutputs; i++)
 	{
-		case enumToInt(LFOWaveform::kSin):
-		{
-			// --- calculate normal angle
-			double angle = modCounter*2.0*pi - pi;
+		outputs[i] *= oscAmplitude;
+	}
 
-			// --- norm output with parabolicSine approximation
-			outputs[kLFONormalOutput] = parabolicSine(-angle);
+	// --- special output for amplitude modulation from max; after gain calc above!
+	outputs[kLFOUnipolarOutputFromMax] = 1.0 - outputs[kLFOUnipolarOutputFromMax]; 
 
-			// --- calculate QP angle
-			angle = modCounterQP*2.0*pi - pi;
+	// --- for use in glideLFO or other ramp-type LFO
+	outputs[kLFOUnipolarUpRamp] = modCounter;
+	outputs[kLFOUnipolarDownRamp] = 1.0 - modCounter;
 
-			// --- calc QP outputs
-			outputs[kLFOQuadPhaseOutput] = parabolicSine(-angle);
+	// --- setup for next time around
+	advanceModulo(modCounter, phaseInc);
 
-			break;
-		}
-		// --- can combine these
-		case enumToInt(LFOWaveform::kUpSaw):
-		case enumToInt(LFOWaveform::kDownSaw):
-		{
-			// --- one shot is unipolar for saw
-			if (oscMode == LFOMode::kOneShot)
-			{
-				outputs[kLFONormalOutput] = modCounter - 1.0;
-				outputs[kLFOQuadPhaseOutput] = modCounterQP - 1.0;
-			}
-			else // --- bipolar for sync or free running, use helper function
-			{
-				outputs[kLFONormalOutput] = unipolarToBipolar(modCounter);
-				outputs[kLFOQuadPhaseOutput] = unipolarToBipolar(modCounterQP);
-			}
+	return true;
+}
 
-			// --- invert for downsaw
-			if (oscillatorWaveform == enumToInt(LFOWaveform::kDownSaw))
-			{
-				outputs[kLFONormalOutput] *= -1.0;
-				outputs[kLFOQuadPhaseOutput] *= -1.0;
-			}
 
-			break;
-		}
-		case enumToInt(LFOWaveform::kSquare):
-		{
-			// check pulse width and output either +1 or -1
-			outputs[kLFONormalOutput] = modCounter > pulseWidth ? -1.0 : +1.0;
-			outputs[kLFOQuadPhaseOutput] = modCounterQP > pulseWidth ? -1.0 : +1.0;
 
-			break;
+
+
+/**
+	\brief One sample of the normal and quad phase outputs for one waveform and mode, from the current timebase. The
+	waveform and mode are template arguments, so the tests below are resolved by the compiler.
+*/
+template <LFOWaveform Waveform, bool OneShot>
+void LFO::oscillateSample()
+{
+	if (Waveform == LFOWaveform::kSin)
+	{
+		// --- same sine approximation as the block kernel, so both render paths give the same output
+		outputs[kLFONormalOutput] = polynomialSine(modCounter);
+		outputs[kLFOQuadPhaseOutput] = polynomialSine(modCounterQP);
+	}
+	else if (Waveform == LFOWaveform::kUpSaw || Waveform == LFOWaveform::kDownSaw)
+	{
+		// --- one shot is unipolar for saw
+		if (OneShot)
+		{
+			outputs[kLFONormalOutput] = modCounter - 1.0;
+			outputs[kLFOQuadPhaseOutput] = modCounterQP - 1.0;
 		}
-		case enumToInt(LFOWaveform::kTriangle):
+		else // --- bipolar for sync or free running, use helper function
 		{
-			// triv saw
 			outputs[kLFONormalOutput] = unipolarToBipolar(modCounter);
+			outputs[kLFOQuadPhaseOutput] = unipolarToBipolar(modCounterQP);
+		}
 
-			// bipolar triagle
-			outputs[kLFONormalOutput] = 2.0*fabs(outputs[kLFONormalOutput]) - 1.0;
+		// --- invert for downsaw
+		if (Waveform == LFOWaveform::kDownSaw)
+		{
+			outputs[kLFONormalOutput] *= -1.0;
+			outputs[kLFOQuadPhaseOutput] *= -1.0;
+		}
+	}
+	else if (Waveform == LFOWaveform::kSquare)
+	{
+		// check pulse width and output either +1 or -1
+		outputs[kLFONormalOutput] = modCounter > pulseWidth ? -1.0 : +1.0;
+		outputs[kLFOQuadPhaseOutput] = modCounterQP > pulseWidth ? -1.0 : +1.0;
+	}
+	else if (Waveform == LFOWaveform::kTriangle)
+	{
+		// triv saw
+		outputs[kLFONormalOutput] = unipolarToBipolar(modCounter);
 
-			if (oscMode == LFOMode::kOneShot)
-				// convert to unipolar
-				outputs[kLFONormalOutput] = bipolarToUnipolar(outputs[kLFONormalOutput]);
+		// bipolar triagle
+		outputs[kLFONormalOutput] = 2.0*fabs(outputs[kLFONormalOutput]) - 1.0;
 
-			// -- quad phase
-			outputs[kLFOQuadPhaseOutput] = unipolarToBipolar(modCounterQP);
+		if (OneShot)
+			// convert to unipolar
+			outputs[kLFONormalOutput] = bipolarToUnipolar(outputs[kLFONormalOutput]);
 
-			// bipolar triagle
-			outputs[kLFOQuadPhaseOutput] = 2.0*fabs(outputs[kLFOQuadPhaseOutput]) - 1.0;
+		// -- quad phase
+		outputs[kLFOQuadPhaseOutput] = unipolarToBipolar(modCounterQP);
 
-			if (oscMode == LFOMode::kOneShot)
-				// convert to unipolar
-				outputs[kLFOQuadPhaseOutput] = bipolarToUnipolar(outputs[kLFOQuadPhaseOutput]);
+		// bipolar triagle
+		outputs[kLFOQuadPhaseOutput] = 2.0*fabs(outputs[kLFOQuadPhaseOutput]) - 1.0;
 
-			break;
-		}
-		case enumToInt(LFOWaveform::kWhiteNoise):
+		if (OneShot)
+			// convert to unipolar
+			outputs[kLFOQuadPhaseOutput] = bipolarToUnipolar(outputs[kLFOQuadPhaseOutput]);
+	}
+	else if (Waveform == LFOWaveform::kWhiteNoise)
+	{
+		// --- white noise has no real "quad phase"
+		outputs[kLFONormalOutput] = doWhiteNoise();
+		outputs[kLFOQuadPhaseOutput] = outputs[kLFONormalOutput];
+	}
+	else if (Waveform == LFOWaveform::kRSH || Waveform == LFOWaveform::kQRSH)
+	{
+		// --- is this is the very first run? if so, form first output sample
+		if (randomSHCounter < 0)
 		{
-			// --- white noise has no real "quad phase"
-			outputs[kLFONormalOutput] = doWhiteNoise();
-			outputs[kLFOQuadPhaseOutput] = outputs[kLFONormalOutput];
+			if (Waveform == LFOWaveform::kRSH)
+				randomSHValue = doWhiteNoise();
+			else
+				randomSHValue = doPNSequence(pnRegister);
 
-			break;
+			// --- init the sample counter, will be advanced below
+			randomSHCounter = 1.0;
 		}
-		case enumToInt(LFOWaveform::kRSH):
-		case enumToInt(LFOWaveform::kQRSH):
+		// --- has hold time been exceeded? if so, generate next output sample
+		else if (randomSHCounter > (sampleRate / oscFrequency) )
 		{
-			// --- is this is the very first run? if so, form first output sample
-			if (randomSHCounter < 0)
-			{
-				if (oscillatorWaveform == enumToInt(LFOWaveform::kRSH))
-					randomSHValue = doWhiteNoise();
-				else
-					randomSHValue = doPNSequence(pnRegister);
+			// --- wrap counter
+			randomSHCounter -= sampleRate / oscFrequency;
 
-				// --- init the sample counter, will be advanced below
-				randomSHCounter = 1.0;
-			}
-			// --- has hold time been exceeded? if so, generate next output sample
-			else if (randomSHCounter > (sampleRate / oscFrequency) )
-			{
-				// --- wrap counter
-				randomSHCounter -= sampleRate / oscFrequency;
+			if (Waveform == LFOWaveform::kRSH)
+				randomSHValue = doWhiteNoise();
+			else
+				randomSHValue = doPNSequence(pnRegister);
+		}
 
-				if (oscillatorWaveform == enumToInt(LFOWaveform::kRSH))
-					randomSHValue = doWhiteNoise();
-				else
-					randomSHValue = doPNSequence(pnRegister);
-			}
+		// --- advance the sample counter
+		randomSHCounter += 1.0;
 
-			// --- advance the sample counter
-			randomSHCounter += 1.0;
+		// output held value
+		outputs[kLFONormalOutput] = randomSHValue;
 
-			// output held value
-			outputs[kLFONormalOutput] = randomSHValue;
+		// not meaningful for this output
+		outputs[kLFOQuadPhaseOutput] = outputs[kLFONormalOutput];
+	}
+	// --- expo is unipolar!
+	else if (Waveform == LFOWaveform::kExpUp)
+	{
+		// calculate the output directly
+		outputs[kLFONormalOutput] = concaveInvertedTransform(modCounter);
+		outputs[kLFOQuadPhaseOutput] = concaveInvertedTransform(modCounterQP);
+	}
+	else if (Waveform == LFOWaveform::kExpDown)
+	{
+		// calculate the output directly
+		outputs[kLFONormalOutput] = -concaveInvertedTransform(modCounter);
+		outputs[kLFOQuadPhaseOutput] = -concaveInvertedTransform(modCounterQP);
+	}
+}
+
+/**
+	\brief Point the render kernels at the instantiations for the current waveform and mode, only when either has changed
+*/
+void LFO::selectRenderKernels()
+{
+	if (sampleKernel && oscWave == kernelWave && oscMode == kernelMode)
+		return;
 
-			// not meaningful for this output
-			outputs[kLFOQuadPhaseOutput] = outputs[kLFONormalOutput];
+	kernelWave = oscWave;
+	kernelMode = oscMode;
 
+	bool oneShot = oscMode == LFOMode::kOneShot;
+	switch (oscWave)
+	{
+		case LFOWaveform::kSin:			setRenderKernels<LFOWaveform::kSin>(oneShot); break;
+		case LFOWaveform::kUpSaw:		setRenderKernels<LFOWaveform::kUpSaw>(oneShot); break;
+		case LFOWaveform::kDownSaw:		setRenderKernels<LFOWaveform::kDownSaw>(oneShot); break;
+		case LFOWaveform::kSquare:		setRenderKernels<LFOWaveform::kSquare>(oneShot); break;
+		case LFOWaveform::kTriangle:	setRenderKernels<LFOWaveform::kTriangle>(oneShot); break;
+		case LFOWaveform::kRSH:			setRenderKernels<LFOWaveform::kRSH>(oneShot); break;
+		case LFOWaveform::kQRSH:		setRenderKernels<LFOWaveform::kQRSH>(oneShot); break;
+		case LFOWaveform::kExpUp:		setRenderKernels<LFOWaveform::kExpUp>(oneShot); break;
+		case LFOWaveform::kExpDown:		setRenderKernels<LFOWaveform::kExpDown>(oneShot); break;
+		case LFOWaveform::kWhiteNoise:	setRenderKernels<LFOWaveform::kWhiteNoise>(oneShot); break;
+
+		// --- unknown waveform
+		default:
+			sampleKernel = nullptr;
+			blockKernel = nullptr;
 			break;
+	}
+}
+
+/**
+	\brief Set both render kernels for a waveform
+	\param oneShot -- true for the one shot mode
+*/
+template <LFOWaveform Waveform>
+void LFO::setRenderKernels(bool oneShot)
+{
+	sampleKernel = oneShot ? &LFO::oscillateSample<Waveform, true> : &LFO::oscillateSample<Waveform, false>;
+	blockKernel = oneShot ? &LFO::oscillateBlock<Waveform, true> : &LFO::oscillateBlock<Waveform, false>;
+}
+
+/**
+	\brief Render a block of LFO output values for the outputs in the output mask; the other outputs are not touched.
+	The block is written to the block buffers (see getBlockOutputPtr( )) and outputs[] holds the first sample of the block,
+	which is the value that the modulators read on an update cycle. Blocks longer than kMaxLFOBlockSize only render the
+	first kMaxLFOBlockSize samples; the timebase is always advanced by the full blockSize.
+
+	\param blockSize -- number of samples in the block
+	\param update -- a flag that is used to update the component once at the top of the block
+
+	\return true if handled, false if not handled
+*/
+bool LFO::renderBlock(uint32_t blockSize, bool update)
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- run the modulators
+	runModuators(update);
+
+	// --- check update
+	if (update)
+		updateComponent();
+
+	return renderMaskedOutputs(blockSize, blockSize < kMaxLFOBlockSize ? blockSize : kMaxLFOBlockSize);
+}
+
+/**
+	\brief Render only the first sample of a block for the outputs in the output mask -- the value that the modulators
+	read on an update cycle -- into outputs[], then advance the timebase by the full blockSize. Use this when nothing
+	reads the block buffers; outputs[] is identical to renderBlock( ) with the same blockSize.
+
+	\param blockSize -- number of samples until the next update cycle
+	\param update -- a flag that is used to update the component once at the top of the block
+
+	\return true if handled, false if not handled
+*/
+bool LFO::renderUpdateCycle(uint32_t blockSize, bool update)
+{
+	// --- check valid flag
+	if (!validComponent) return false;
+
+	// --- run the modulators
+	runModuators(update);
+
+	// --- check update
+	if (update)
+		updateComponent();
+
+	return renderMaskedOutputs(blockSize, blockSize > 0 ? 1 : 0);
+}
+
+/**
+	\brief Render the masked outputs for the first count samples of a block into the block buffers, set outputs[] to the
+	first sample and advance the timebase (and the sample and hold counters) by the full blockSize
+
+	\param blockSize -- number of samples in the block
+	\param count -- number of samples to render, [0, kMaxLFOBlockSize]
+
+	\return true if handled, false if not handled
+*/
+bool LFO::renderMaskedOutputs(uint32_t blockSize, uint32_t count)
+{
+	// --- check run/stop flag
+	if (!noteOn)
+	{
+		clearOutputs();
+		for (uint32_t j = 0; j < kNumLFOOutputs; j++)
+		{
+			if (outputMask & (1 << j))
+				memset(&blockOutputs[j][0], 0, count * sizeof(double));
 		}
-		// --- expo is unipolar!
-		case enumToInt(LFOWaveform::kExpUp):
+		return true;
+	}
+
+	// --- one shot: the LFO turns off on the sample where the timebase wraps
+	uint32_t runCount = count;
+	bool expired = false;
+	if (oscMode == LFOMode::kOneShot)
+	{
+		uint32_t samplesToWrap = 0;
+		if (modCounter < 1.0)
+			samplesToWrap = phaseInc > 0.0 ? (uint32_t)ceil((1.0 - modCounter) / phaseInc) : 0xFFFFFFFF;
+
+		if (samplesToWrap < runCount)
+			runCount = samplesToWrap;
+
+		// --- the run/stop flag changes on the block that starts at (or after) the wrap
+		expired = samplesToWrap == 0;
+	}
+
+	// --- the timebase for the block
+	for (uint32_t i = 0; i < count; i++)
+	{
+		double phase = modCounter + (double)i*phaseInc;
+		blockPhase[i] = phase - floor(phase);
+	}
+
+	// --- normal and quad phase waveforms; raw (unscaled) values go in their output buffers first
+	const uint32_t normalMask = (1 << kLFONormalOutput) | (1 << kLFONormalOutputInverted) | (1 << kLFOUnipolarOutputFromMax);
+	const uint32_t quadPhaseMask = (1 << kLFOQuadPhaseOutput) | (1 << kLFOQuadPhaseOutputInverted);
+	double* normal = &blockOutputs[kLFONormalOutput][0];
+	double* quadPhase = &blockOutputs[kLFOQuadPhaseOutput][0];
+
+	if (oscWave == LFOWaveform::kWhiteNoise || oscWave == LFOWaveform::kRSH || oscWave == LFOWaveform::kQRSH)
+	{
+		// --- these have state, so they are always rendered (over the full block); no real quad phase
+		for (uint32_t i = 0; i < blockSize; i++)
 		{
-			// calculate the output directly
-			outputs[kLFONormalOutput] = concaveInvertedTransform(modCounter);
-			outputs[kLFOQuadPhaseOutput] = concaveInvertedTransform(modCounterQP);
+			double value = 0.0;
+			if (oscWave == LFOWaveform::kWhiteNoise)
+			{
+				if (i >= count) break;
+				value = doWhiteNoise();
+			}
+			else
+			{
+				// --- same hold logic as doOscillate( )
+				if (randomSHCounter < 0)
+				{
+					randomSHValue = oscWave == LFOWaveform::kRSH ? doWhiteNoise() : doPNSequence(pnRegister);
+					randomSHCounter = 1.0;
+				}
+				else if (randomSHCounter > (sampleRate / oscFrequency))
+				{
+					randomSHCounter -= sampleRate / oscFrequency;
+					randomSHValue = oscWave == LFOWaveform::kRSH ? doWhiteNoise() : doPNSequence(pnRegister);
+				}
+				randomSHCounter += 1.0;
+				value = randomSHValue;
+			}
 
-			break;
+			if (i < count)
+			{
+				normal[i] = value;
+				quadPhase[i] = value;
+			}
 		}
-		case enumToInt(LFOWaveform::kExpDown):
-		{
-			// calculate the output directly
-			outputs[kLFONormalOutput] = -concaveInvertedTransform(modCounter);
-			outputs[kLFOQuadPhaseOutput] = -concaveInvertedTransform(modCounterQP);
+	}
+	else
+	{
+		if (outputMask & normalMask)
+			renderWaveformBlock(blockPhase, normal, count);
 
-			break;
+		if (outputMask & quadPhaseMask)
+		{
+			for (uint32_t i = 0; i < count; i++)
+			{
+				double phase = blockPhase[i] + quadPhaseInc;
+				blockPhaseQP[i] = phase >= 1.0 ? phase - 1.0 : phase;
+			}
+			renderWaveformBlock(blockPhaseQP, quadPhase, count);
 		}
+	}
 
-		// --- if we get here, we don't know what kind of osc they want
-		default:
-			return false;
+	// --- derived outputs, then amplitude; only for the masked outputs
+	double amplitude = oscAmplitude;
+	if (outputMask & (1 << kLFONormalOutputInverted))
+	{
+		double* output = &blockOutputs[kLFONormalOutputInverted][0];
+		for (uint32_t i = 0; i < count; i++)
+			output[i] = -normal[i] * amplitude;
+	}
+	if (outputMask & (1 << kLFOUnipolarOutputFromMax))
+	{
+		double* output = &blockOutputs[kLFOUnipolarOutputFromMax][0];
+		for (uint32_t i = 0; i < count; i++)
+			output[i] = 1.0 - (0.5*normal[i] + 0.5) * amplitude;
+	}
+	if (outputMask & (1 << kLFOQuadPhaseOutputInverted))
+	{
+		double* output = &blockOutputs[kLFOQuadPhaseOutputInverted][0];
+		for (uint32_t i = 0; i < count; i++)
+			output[i] = -quadPhase[i] * amplitude;
+	}
+	if (outputMask & (1 << kLFOUnipolarUpRamp))
+		memcpy(&blockOutputs[kLFOUnipolarUpRamp][0], blockPhase, count * sizeof(double));
+	if (outputMask & (1 << kLFOUnipolarDownRamp))
+	{
+		double* output = &blockOutputs[kLFOUnipolarDownRamp][0];
+		for (uint32_t i = 0; i < count; i++)
+			output[i] = 1.0 - blockPhase[i];
 	}
 
-	// --- invert these
-	outputs[kLFOQuadPhaseOutputInverted] = -outputs[kLFOQuadPhaseOutput];
-	outputs[kLFONormalOutputInverted] = -outputs[kLFONormalOutput];
-	outputs[kLFOUnipolarOutputFromMax] = bipolarToUnipolar(outputs[kLFONormalOutput]);
+	// --- scale these last, they are the sources for the derived outputs
+	if (outputMask & (1 << kLFONormalOutput))
+	{
+		for (uint32_t i = 0; i < count; i++)
+			normal[i] *= amplitude;
+	}
+	if (outputMask & (1 << kLFOQuadPhaseOutput))
+	{
+		for (uint32_t i = 0; i < count; i++)
+			quadPhase[i] *= amplitude;
+	}
 
-	// --- then, apply amplitude gain/mod
-	for (unsigned int i = 0; i < kNumLFOOutputs; i++)
+	// --- one shot: silence from the wrap on
+	if (runCount < count)
 	{
-		outputs[i] *= oscAmplitude;
+		for (uint32_t j = 0; j < kNumLFOOutputs; j++)
+		{
+			if (outputMask & (1 << j))
+				memset(&blockOutputs[j][runCount], 0, (count - runCount) * sizeof(double));
+		}
 	}
 
-	// --- special output for amplitude modulation from max; after gain calc above!
-	outputs[kLFOUnipolarOutputFromMax] = 1.0 - outputs[kLFOUnipolarOutputFromMax]; 
+	// --- the modulators read outputs[] on the update cycle: first sample of the block
+	for (uint32_t j = 0; j < kNumLFOOutputs; j++)
+	{
+		if (outputMask & (1 << j))
+			outputs[j] = count > 0 ? blockOutputs[j][0] : 0.0;
+	}
 
-	// --- for use in glideLFO or other ramp-type LFO
-	outputs[kLFOUnipolarUpRamp] = modCounter;
-	outputs[kLFOUnipolarDownRamp] = 1.0 - modCounter;
+	if (expired)
+	{
+		noteOn = false;
+		return true;
+	}
 
-	// --- setup for next time around
-	advanceModulo(modCounter, phaseInc);
+	// --- setup for next block; a one shot timebase is not wrapped so the next block sees the wrap
+	modCounter += (double)blockSize*phaseInc;
+	if (oscMode != LFOMode::kOneShot)
+		modCounter -= floor(modCounter);
+
+	modCounterQP = modCounter;
+	advanceAndCheckWrapModulo(modCounterQP, quadPhaseInc);
 
 	return true;
 }
 
+/**
+	\brief Render the (raw, unscaled) waveform for an array of unipolar phase values with the block kernel selected by
+	updateComponent( ); same shapes as doOscillate( )
 
+	\param phase -- timebase values [0.0, 1.0)
+	\param output -- buffer to receive the waveform
+	\param count -- number of samples
+*/
+void LFO::renderWaveformBlock(const double* phase, double* output, uint32_t count)
+{
+	if (blockKernel)
+		(this->*blockKernel)(phase, output, count);
+	else
+		memset(output, 0, count * sizeof(double));
+}
 
+/**
+	\brief The raw waveform for an array of phase values, for one waveform and mode; the noise and random sample and
+	hold waveforms have state and are rendered by renderBlock( ), so they output zeros here
+
+	\param phase -- timebase values [0.0, 1.0)
+	\param output -- buffer to receive the waveform
+	\param count -- number of samples
+*/
+template <LFOWaveform Waveform, bool OneShot>
+void LFO::oscillateBlock(const double* phase, double* output, uint32_t count)
+{
+	if (Waveform == LFOWaveform::kSin)
+	{
+		for (uint32_t i = 0; i < count; i++)
+			output[i] = polynomialSine(phase[i]);
+	}
+	else if (Waveform == LFOWaveform::kUpSaw || Waveform == LFOWaveform::kDownSaw)
+	{
+		// --- one shot is unipolar for saw
+		const double scale = Waveform == LFOWaveform::kDownSaw ? -1.0 : 1.0;
+		if (OneShot)
+		{
+			for (uint32_t i = 0; i < count; i++)
+				output[i] = scale*(phase[i] - 1.0);
+		}
+		else
+		{
+			for (uint32_t i = 0; i < count; i++)
+				output[i] = scale*(2.0*phase[i] - 1.0);
+		}
+	}
+	else if (Waveform == LFOWaveform::kSquare)
+	{
+		double pw = pulseWidth;
+		for (uint32_t i = 0; i < count; i++)
+			output[i] = phase[i] > pw ? -1.0 : +1.0;
+	}
+	else if (Waveform == LFOWaveform::kTriangle)
+	{
+		for (uint32_t i = 0; i < count; i++)
+			output[i] = 2.0*fabs(2.0*phase[i] - 1.0) - 1.0;
 
+		// --- one shot is unipolar
+		if (OneShot)
+		{
+			for (uint32_t i = 0; i < count; i++)
+				output[i] = 0.5*output[i] + 0.5;
+		}
+	}
+	else if (Waveform == LFOWaveform::kExpUp)
+	{
+		for (uint32_t i = 0; i < count; i++)
+			output[i] = concaveInvertedTransform(phase[i]);
+	}
+	else if (Waveform == LFOWaveform::kExpDown)
+	{
+		for (uint32_t i = 0; i < count; i++)
+			output[i] = -concaveInvertedTransform(phase[i]);
+	}
+	else
+	{
+		memset(output, 0, count * sizeof(double));
+	}
+}
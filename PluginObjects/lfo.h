@@ -26,6 +26,9 @@ const double kLFO_Amp_ModRange = 1.0;									// --> 100%
 // --- other constants
 const double quadPhaseInc = 0.25;	// +90 deg
 
+// --- maximum block length for renderBlock( ); matches the voice update granularity
+const uint32_t kMaxLFOBlockSize = 64;
+
 // --- outputs[] indexes for this component
 enum {  
 	kLFONormalOutput,
@@ -37,6 +40,9 @@ enum {
 	kLFOUnipolarDownRamp,		/* special output of the inverse modulo counter */
 	kNumLFOOutputs };
 
+// --- output mask for renderBlock( ): bit N enables outputs[N]
+const uint32_t kLFOAllOutputsMask = (1 << kNumLFOOutputs) - 1;
+
 // --- modulator indexes for this component
 enum {	
 	kLFOFreqMod,
@@ -60,6 +66,8 @@ enum class LFOMode { kSync, kFreeRun, kOneShot };
 	\param pulseWidthControl_Pct:	[0.0, 100.0] pulse width in percent for square waves only
 	\param oscWave:					oscillator waveform (see enum class LFOWaveform)
 	\param oscMode:					LFO mode: synchronized with note-on, free running, one-shot
+	\param tempoSync:				take the rate from the host tempo; free running LFOs are also phase locked to the host timeline
+	\param cycle_beats:				length of one LFO cycle in beats (quarter notes) when tempoSync is on
 	\param modControls:				intensity and range controls for each modulator object
 */
 struct LFOModifiers
@@ -77,6 +85,10 @@ struct LFOModifiers
 	// --- oscillator mode; default is sync, which is most common
 	LFOMode oscMode = LFOMode::kSync;
 
+	// --- tempo sync
+	bool tempoSync = false;
+	double cycle_beats = 1.0;
+
 	// --- modulator controls
 	ModulatorControl modulationControls[kNumLFOModulators];
 
@@ -104,8 +116,26 @@ struct LFOModifiers
 	\param pulseWidthControl_Pct:	[0.0, 100.0] pulse width in percent for square waves only
 	\param oscWave:					oscillator waveform (see enum class LFOWaveform)
 	\param oscMode:					LFO mode: synchronized with note-on, free running, one-shot
+	\param tempoSync:				take the rate from the host tempo; free running LFOs are also phase locked to the host timeline
+	\param cycle_beats:				length of one LFO cycle in beats (quarter notes) when tempoSync is on
 	\param modControls:				intensity and range controls for each modulator object
 
+	Tempo sync:
+	The frequency is bpm/(60*cycle_beats) and the frequency modulator is ignored. In free run mode, the modulo counter is
+	also set from the host timeline position on every update (once per block), so the phase depends only on the absolute
+	sample index and not on how long the LFO has been running.
+
+	Block rendering:
+	renderBlock( ) renders a block of samples at once, but only for the outputs set in the output mask (usually the outputs
+	that are routed in the modulation matrix), so an unused LFO only advances its timebase. The sine waveform uses
+	polynomialSine( ), as oscillateSample( ) does, and the waveform loops are branch-free so they can be vectorized. renderUpdateCycle( ) renders just the
+	first sample of the block, for LFOs that are only read on update cycles (the voice LFOs).
+
+	Render kernels:
+	Each waveform and mode (one shot or not) is a template instantiation of oscillateSample( ) for doOscillate( ) and of
+	oscillateBlock( ) for renderBlock( ); updateComponent( ) selects them when the waveform or mode changes, so neither
+	path tests the waveform per sample.
+
 	Modulator indexes:
 	- kLFOFreqMod:				[-1, +1] frequency modulation -- modulation is linear in frequency
 	- kLFOMaxDownAmpMod:		[ 0, +1] gain modulation -- modulation is from the max gain downwards (tremolo or AM effect)
@@ -147,6 +177,21 @@ public:
 	/** do the oscillator operation; may be called externally */
 	bool doOscillate();
 
+	// --- render a block of the masked outputs
+	bool renderBlock(uint32_t blockSize, bool update);
+
+	// --- render only the update cycle sample of the masked outputs and advance by a block
+	bool renderUpdateCycle(uint32_t blockSize, bool update);
+
+	/** set the outputs that renderBlock( ) produces; bit N enables outputs[N] */
+	void setOutputMask(uint32_t mask) { outputMask = mask & kLFOAllOutputsMask; }
+
+	/** get the outputs that renderBlock( ) produces */
+	uint32_t getOutputMask() { return outputMask; }
+
+	/** get the block buffer for one output; only valid for the masked outputs after renderBlock( ) */
+	const double* getBlockOutputPtr(uint32_t outputIndex) { return outputIndex < kNumLFOOutputs ? &blockOutputs[outputIndex][0] : nullptr; }
+
 protected:
 	/** true if this waveform requires a phse-offset to maintain correct phase alignment with other waveforms */
 	inline bool needsPhaseAdvance(LFOWaveform oscWave)
@@ -159,6 +204,24 @@ protected:
 	LFOWaveform oscWave = LFOWaveform::kTriangle;
 	LFOMode oscMode = LFOMode::kSync;;
 
+	// --- render kernels for the waveform and mode: one sample of the normal and quad phase outputs, and a block of
+	//     the raw waveform (see renderWaveformBlock( ))
+	template <LFOWaveform Waveform, bool OneShot>
+	void oscillateSample();
+	template <LFOWaveform Waveform, bool OneShot>
+	void oscillateBlock(const double* phase, double* output, uint32_t count);
+
+	// --- the selected kernels; nullptr for an unknown waveform
+	typedef void (LFO::*SampleKernel)();
+	typedef void (LFO::*BlockKernel)(const double* phase, double* output, uint32_t count);
+	void selectRenderKernels();
+	template <LFOWaveform Waveform>
+	void setRenderKernels(bool oneShot);
+	SampleKernel sampleKernel = nullptr;				///< oscillateSample( ) instantiation for the current waveform/mode
+	BlockKernel blockKernel = nullptr;					///< oscillateBlock( ) instantiation for the current waveform/mode
+	LFOWaveform kernelWave = LFOWaveform::kTriangle;	///< waveform that the kernels were selected for
+	LFOMode kernelMode = LFOMode::kSync;				///< mode that the kernels were selected for
+
 	// --- sample rate
 	double sampleRate = 0.0;			///< sample rate
 
@@ -187,6 +250,14 @@ protected:
 	// --- RUN/STOP flag
 	bool noteOn = false;
 
+	// --- block rendering
+	bool renderMaskedOutputs(uint32_t blockSize, uint32_t count);
+	void renderWaveformBlock(const double* phase, double* output, uint32_t count);
+	uint32_t outputMask = kLFOAllOutputsMask;						///< outputs produced by renderBlock( )
+	double blockPhase[kMaxLFOBlockSize] = { 0.0 };					///< timebase for the block
+	double blockPhaseQP[kMaxLFOBlockSize] = { 0.0 };				///< quad phase timebase for the block
+	double blockOutputs[kNumLFOOutputs][kMaxLFOBlockSize] = { { 0.0 } };	///< one block buffer per output
+
 	// --- our modifiers
 	std::shared_ptr<LFOModifiers> modifiers = nullptr;
 };
@@ -45,9 +45,14 @@ const unsigned char EXPRESSION_CC11 = 0x0B;
 const unsigned char JOYSTICK_X = 0x10;
 const unsigned char JOYSTICK_Y = 0x11;
 const unsigned char SUSTAIN_PEDAL = 0x40;
+const unsigned char MPE_SLIDE_CC74 = 0x4A;		// --- MPE per-note "slide" (timbre) controller
 const unsigned char RESET_ALL_CONTROLLERS = 0x79;
 const unsigned char ALL_NOTES_OFF = 0x7B;
 
+// --- MPE (MIDI Polyphonic Expression) lower zone: channel 1 is the master channel, channels 2-16 are member channels (zero-indexed here)
+const unsigned char MPE_MASTER_CHANNEL = 0x00;
+const unsigned char MPE_NUM_CHANNELS = 16;
+
 // --- SYSTEM MESSAGES
 const unsigned char SYSTEM_EXCLUSIVE = 0xF0;
 const unsigned char MIDI_TIME_CODE = 0xF1;
@@ -1028,6 +1033,21 @@ inline double parabolicSine(double x, bool bHighPrecision = true)
 	return y;
 }
 
+// --- sin(2*pi*phase) for a unipolar phase [0.0, 1.0) using an odd polynomial (Taylor series to x^11, max error < 1e-7);
+//     the folding is branch-free (selects only) so loops over phase arrays auto-vectorize
+inline double polynomialSine(double phase)
+{
+	// --- sin(2*pi*phase) = -sin(2*pi*x) for x = phase - 0.5; fold x into [-0.25, +0.25]
+	double x = phase - 0.5;
+	x = x > 0.25 ? 0.5 - x : x;
+	x = x < -0.25 ? -0.5 - x : x;
+
+	double t = 2.0*pi*x;
+	double t2 = t*t;
+
+	return -t*(1.0 + t2*(-1.0/6.0 + t2*(1.0/120.0 + t2*(-1.0/5040.0 + t2*(1.0/362880.0 + t2*(-1.0/39916800.0))))));
+}
+
 const double D = 5.0*(float)pi*(float)pi;
 inline double BhaskaraISine(double x)
 {
@@ -12,6 +12,8 @@
 #include <stdlib.h>
 #include <memory>
 
+#include "SynthArena.h" // voice component storage
+
 // --- this is for iterating over typed-enums!
 #include <type_traits>
 template < typename C, C beginVal, C endVal>
@@ -145,6 +147,9 @@ struct RenderInfo
 	
 	/// update component flag
 	bool updateComponent = false;
+
+	/// sample index of this render cycle within the current host buffer (for sample accurate MIDI)
+	uint32_t sampleOffset = 0;
 };
 
 /**
@@ -187,6 +192,96 @@ protected:
 	uint32_t targetValueInSamples = 0;
 };
 
+/**
+\struct SynthTransport
+\ingroup SynthStructures
+\brief Host transport information shared with the components via the IMIDIData interface; the absolute sample index
+is the host's uAbsoluteFrameBufferIndex plus the offset of the current sample in the buffer, so anything derived from it
+(LFO phase, for example) is deterministic when the host seeks or loops.
+
+\param bpm:					host tempo in beats (quarter notes) per minute
+\param timeSigNumerator:		time signature numerator
+\param timeSigDenominator:		time signature denominator
+\param absoluteSampleIndex:		sample index of the current sample from the host timeline start
+\param sampleRate:				audio sample rate
+*/
+struct SynthTransport
+{
+	SynthTransport() {}
+
+	double bpm = 120.0;
+	double timeSigNumerator = 4.0;
+	uint32_t timeSigDenominator = 4;
+	uint64_t absoluteSampleIndex = 0;
+	double sampleRate = 44100.0;
+
+	/** position on the host timeline in beats (quarter notes) */
+	double getBeatPosition() { return (double)absoluteSampleIndex*bpm / (60.0*sampleRate); }
+
+	/** duration of a number of beats in mSec */
+	double beatsToMilliseconds(double beats) { return bpm > 0.0 ? beats*60000.0 / bpm : 0.0; }
+};
+
+/**
+\struct GainRamp
+\ingroup SynthStructures
+\brief A linear ramp from the current gain to a new target gain over a number of samples; used to smooth gains that are
+only recalculated on update cycles. The ramp lands exactly on the target.
+*/
+struct GainRamp
+{
+	GainRamp() {}
+
+	double value = 0.0;				///< current gain
+	double target = 0.0;			///< gain at the end of the ramp
+	double increment = 0.0;			///< per-sample increment
+	uint32_t samplesRemaining = 0;	///< samples left in the ramp
+
+	/** jump to a new gain with no ramp */
+	void snap(double _target) { value = target = _target; increment = 0.0; samplesRemaining = 0; }
+
+	/** start a ramp to a new target gain over rampLength samples */
+	void setTarget(double _target, uint32_t rampLength)
+	{
+		target = _target;
+		if (rampLength == 0)
+		{
+			snap(_target);
+			return;
+		}
+		increment = (target - value) / (double)rampLength;
+		samplesRemaining = rampLength;
+	}
+
+	/** advance one sample and return the gain */
+	double getNextValue()
+	{
+		if (samplesRemaining > 0)
+		{
+			if (--samplesRemaining == 0)
+				value = target;
+			else
+				value += increment;
+		}
+		return value;
+	}
+
+	/** advance a number of samples at once */
+	void advance(uint32_t samples)
+	{
+		if (samples >= samplesRemaining)
+		{
+			value = target;
+			samplesRemaining = 0;
+		}
+		else
+		{
+			value += (double)samples*increment;
+			samplesRemaining -= samples;
+		}
+	}
+};
+
 /**
 \struct ModulatorControls
 \ingroup SynthStructures
@@ -494,6 +589,12 @@ public:
 	virtual bool processMIDIEvent(midiEvent& event) { return false; } // not handled
 };
 
+// --- owned by the synth engine, see envelopegenerator.h
+class EGCoefficientCache;
+
+// --- owned by the synth engine, see synthoscillator.h
+class OscillatorWaveTables;
+
 /**
 \class IMIDIData
 \ingroup SynthInterfaces
@@ -510,6 +611,15 @@ public:
 	
 	/**set an *outbound* MIDI event */
 	virtual bool setMIDIOutputEvent(midiEvent& event) = 0;
+
+	/** get the host transport (tempo, time signature, timeline position); nullptr if the owner has none */
+	virtual SynthTransport* getTransport() { return nullptr; }
+
+	/** get the EG segment coefficient cache shared by the owner's voices; nullptr if the owner has none */
+	virtual EGCoefficientCache* getEGCoefficientCache() { return nullptr; }
+
+	/** get the oscillator wave tables shared by the owner's voices; nullptr if the owner has none */
+	virtual OscillatorWaveTables* getOscillatorWaveTables() { return nullptr; }
 };
 
 
@@ -525,17 +635,19 @@ class ISynthComponent
 {
 public:
 
-	/** Constructor requires const poinkters and performs creation of output array and modulator array */
+	/** Constructor requires const poinkters and performs creation of output array and modulator array; inside a
+	    SynthArena::Scope the arrays (and anything made with createComponent( ) or createModulator( )) come from that arena */
 	ISynthComponent(IMIDIData* _midiData, uint32_t _numOutputs, uint32_t _numModulators)
 	{ 
 		midiData = _midiData;
 		numOutputs = _numOutputs;
 		numModulators = _numModulators;
+		arena = SynthArena::getCurrent();
 
 		if (numOutputs > 0)
-			outputs = new double[numOutputs];
+			outputs = arena ? arena->allocateArray<double>(numOutputs) : new double[numOutputs]();
 		if (numModulators > 0)
-			modulators = new Modulator*[numModulators];
+			modulators = arena ? arena->allocateArray<Modulator*>(numModulators) : new Modulator*[numModulators]();
 	}
 
 	virtual bool initializeComponent(InitializeInfo& info) = 0; ///< initilize with new sample rate
@@ -626,7 +738,50 @@ public:
 	/** get the type (identifier) of the component */
 	componentType getComponentType() { return componentType; }
 
+	/** the arena this component was constructed in, or nullptr for the heap */
+	SynthArena* getArena() { return arena; }
+
 protected:
+	/** construct a sub-component (or any object) in this component's arena, or with new if there is none */
+	template <class T, class... Args>
+	T* createComponent(Args&&... args)
+	{
+		if (!arena)
+			return new T(std::forward<Args>(args)...);
+
+		SynthArena::Scope scope(arena);
+		return arena->construct<T>(std::forward<Args>(args)...);
+	}
+
+	/** destroy an object made with createComponent( ); arena objects are destroyed with the arena */
+	template <class T>
+	void destroyComponent(T*& component)
+	{
+		if (!arena && component)
+			delete component;
+		component = nullptr;
+	}
+
+	/** create a modulator for the modulator array */
+	Modulator* createModulator(double defaultValue, double defaultModRange, modTransform transform, bool priorityModulator = false)
+	{
+		return createComponent<Modulator>(defaultValue, defaultModRange, transform, priorityModulator);
+	}
+
+	/** destroy the modulators, the modulator array and the output array; call from the derived destructor */
+	void destroyArrays()
+	{
+		if (!arena)
+		{
+			for (uint32_t i = 0; modulators && i < numModulators; i++)
+				delete modulators[i];
+			delete[] modulators;
+			delete[] outputs;
+		}
+		modulators = nullptr;
+		outputs = nullptr;
+	}
+
 	double* outputs = nullptr;	///< array of output values for component
 	uint32_t numOutputs = 0;
 
@@ -645,6 +800,9 @@ protected:
 
 	// --- stand-alone operation flag (currently not used)
 	bool standAloneComponent = false;
+
+	// --- storage
+	SynthArena* arena = nullptr;	///< arena for the arrays and sub-components, nullptr = heap
 };
 
 
@@ -675,6 +833,43 @@ public:
 		// --- process it
 		return processAudio(renderInfo);
 	}
+
+	/** process a stereo (or mono, with a nullptr right buffer) block in place; the default runs processAudio( ) on each sample and
+	    updates on the first one if update is set. Block based processors override this. */
+	virtual bool processAudioBlock(double* leftBuffer, double* rightBuffer, uint32_t blockSize, bool update)
+	{
+		if (!leftBuffer) return false;
+
+		RenderInfo info;
+		info.numInputChannels = rightBuffer ? 2 : 1;
+		info.numOutputChannels = info.numInputChannels;
+		info.renderInternal = false;
+
+		double frame[2] = { 0.0 };
+		info.inputData = &frame[0];
+		info.outputData = &frame[0];
+
+		for (uint32_t i = 0; i < blockSize; i++)
+		{
+			frame[0] = leftBuffer[i];
+			frame[1] = rightBuffer ? rightBuffer[i] : 0.0;
+			info.updateComponent = update && i == 0;
+
+			if (!processAudio(info))
+				return false;
+
+			leftBuffer[i] = frame[0];
+			if (rightBuffer) rightBuffer[i] = frame[1];
+		}
+		return true;
+	}
+
+	/** an owner that crossfades this processor in and out (see FXChain) takes over its bypass; the processor then
+	    always processes, even when its own enable modifier is off */
+	void setOwnerBypass(bool _ownerBypass) { ownerBypass = _ownerBypass; }
+
+protected:
+	bool ownerBypass = false; ///< the owner handles the bypass
 };
 
 // --------------------------------------------------------------------------------------------------------------------------- //
@@ -691,6 +886,30 @@ inline void boundValue(double& value, double minValue, double maxValue)
 	value = fmax(value, minValue);
 }
 
+/**
+\struct snapToZero
+\ingroup SynthFunctions
+\brief Set a decayed filter or feedback state to exactly zero once it falls below kDenormalSnapThreshold (-300dB),
+so that a tail ends in zeros instead of denormal numbers; does not depend on the FPU mode (see DenormalGuard)
+*/
+const double kDenormalSnapThreshold = 1.0e-15;
+
+// --- SYNTH_DENORMAL_SNAP_SWITCH (benchmark builds only) adds a run time switch so that a test can time a tail
+//     with neither the snap nor a DenormalGuard; the program defines the switch (see tests/DenormalBenchmark.cpp)
+#ifdef SYNTH_DENORMAL_SNAP_SWITCH
+extern bool enableDenormalSnap;
+#endif
+
+inline void snapToZero(double& value)
+{
+#ifdef SYNTH_DENORMAL_SNAP_SWITCH
+	if (!enableDenormalSnap)
+		return;
+#endif
+	if (fabs(value) < kDenormalSnapThreshold)
+		value = 0.0;
+}
+
 /**
 \struct midiPitchBendToBipolar
 \ingroup SynthFunctions
@@ -848,6 +1067,22 @@ inline double doLinearInterpolation(double x1, double x2, double y1, double y2,
 	return dx*y2 + (1 - dx)*y1;
 }
 
+/**
+\struct doLagrangeInterpolation
+\ingroup SynthFunctions
+\brief Perform 3rd order (4 point) Lagrange interpolation on equally spaced points at x = -1, 0, 1, 2
+\param y -- the four values at x = -1, 0, 1, 2
+\param x -- the fractional position between x = 0 and x = 1
+*/
+inline double doLagrangeInterpolation(const double* y, double x)
+{
+	double xp1 = x + 1.0;
+	double xm1 = x - 1.0;
+	double xm2 = x - 2.0;
+
+	return -x*xm1*xm2*y[0] / 6.0 + xp1*xm1*xm2*y[1] / 2.0 - xp1*x*xm2*y[2] / 2.0 + xp1*x*xm1*y[3] / 6.0;
+}
+
 const double pitchShiftTable[kPitchShiftTableLength] = {
 0.00061519582514398126697058311052, 0.00061575131178425574190321567514, 0.00061630729999719274358332965491, 0.00061686379023568292667700774246, 0.00061742078295302579848957691411, 0.00061797827860293275473169138934, 0.00061853627763952220060955644598, 0.00061909478051732291185166312530, 0.00061965378769127598627269870590, 0.00062021329961673137432659475010, 0.00062077331674945004751087207495, 0.00062133383954560681729228921455, 0.00062189486846178599829815247801, 0.00062245640395498433566218166035, 0.00062301844648261328184907226202, 0.00062358099650249541878732628675, 0.00062414405447286619259272821836, 0.00062470762085237759985573147148, 0.00062527169610009298347103046112, 0.00062583628067549071892494705338, 0.00062640137503846594901890654228, 0.00062696697964932700600226844756, 0.00062753309496879768839688873427, 0.00062809972145802029676320277218, 0.00062866685957855097163088364809, 0.00062923450979236294610535962235, 0.00062980267256184849743172460279, 0.00063037134834981547754778619108, 0.00063094053761948937306819340520, 0.00063151024083451634105051963886, 0.00063208045845895887218657271944, 0.00063265119095729839288760887328, 0.00063322243879443830105041568501, 0.00063379420243569919556775316138, 0.00063436648234682180367421944212, 0.00063493927899397001671233375930, 0.00063551259284372611964297750120, 0.00063608642436309350155082542599, 0.00063666077401949990825086311830, 0.00063723564228079278021904530149, 0.00063781102961524163783707530584, 0.00063838693649154165925957427064, 0.00063896336337880836782343596525, 0.00063954031074658142675543048838, 0.00064011777906482637389568024489, 0.00064069576880393082699005624647, 0.00064127428043470741103604382261, 0.00064185331442839581826687034294, 0.00064243287125665923028433601516, 0.00064301295139158659488337610455, 0.00064359355530569533655749214773, 0.00064417468347192734495071375633, 0.00064475633636365157694281258216, 0.00064533851445466676715473353099, 0.00064592121821919687429947032342, 0.00064650444813189433378858295143, 0.00064708820466784244297697714643, 0.00064767248830255102435421443730, 0.00064825729951195924447016061265, 0.00064884263877243864970106868029, 0.00064942850656078828733980268240, 0.00065001490335423774136192065498, 0.00065060182963044995135132309017, 0.00065118928586751676727134574563, 0.00065177727254396187681062535546, 0.00065236579013874308220766184974, 0.00065295483913124861396343190378, 0.00065354442000129929924573390920, 0.00065413453322915181449570543037, 0.00065472517929549413177869876534, 0.00065531635868144790402906041393, 0.00065590807186857193449708303135, 0.00065650031933885729783922924341, 0.00065709310157473037588421460597, 0.00065768641905905556813843881869, 0.00065828027227513073813686128588, 0.00065887466170669014078886682739, 0.00065946958783790745814434863803, 0.00066006505115339081206371485422, 0.00066066105213818612524462325908, 0.00066125759127777961488697799908, 0.00066185466905809356430445689057, 0.00066245228596548892500972538500, 0.00066305044248676813564008503121, 0.00066364913910917078514878353346, 0.00066424837632037675699131495932, 0.00066484815460850818068933021365, 0.00066544847446212585396346783639, 0.00066604933637023162797813347069, 0.00066665074082227144310758282231, 0.00066725268830813034160592822630, 0.00066785517931813626231474234629, 0.00066845821434306177538653415127, 0.00066906179387412072125801421052, 0.00066966591840296994537357067045, 0.00067027058842171309289287295385, 0.00067087580442289529610022658090, 0.00067148156689950686069195961991, 0.00067208787634498543418076765832, 0.00067269473325321166908702386067, 0.00067330213811851236712507917659, 0.00067391009143566308128847630599, 0.00067451859369988367062104250849, 0.00067512764540684111914253806574, 0.00067573724705265235477430474376, 0.00067634739913387991253057585084, 0.00067695810214753464502390745139, 0.00067756935659107864981104407676, 0.00067818116296242093258422878321, 0.00067879352175991968399576537152, 0.00067940643348238585752518758909, 0.00068001989862907818214926569667, 0.00068063391769970641494852392483, 0.00068124849119443372635201994214, 0.00068186361961387247174887216161, 0.00068247930345908722725434270018, 0.00068309554323159728337483409533, 0.00068371233943337230819919936309, 0.00068432969256683538316482495745, 0.00068494760313486560514284473555, 0.00068556607164079364120923276715, 0.00068618509858840454757045179690, 0.00068680468448194113059018794942, 0.00068742482982609863419870555035, 0.00068804553512602810091958183136, 0.00068866680088733919079535539254, 0.00068928862761609584457883626030, 0.00068991101581881845213745085843, 0.00069053396600248786400128020446, 0.00069115747867453964509154573648, 0.00069178155434286786942821301238, 0.00069240619351582772221520567513, 0.00069303139670223072935084651647, 0.00069365716441134801003437493350, 0.00069428349715291287885116089384, 0.00069491039543711650896401499367, 0.00069553785977461064261861967140, 0.00069616589067651084375004666427, 0.00069679448865439151065276357500, 0.00069742365422028880332649958262, 0.00069805338788670411292319739616, 0.00069868369016659874915636807557, 0.00069931456157339730132782573691, 0.00069994600262099067409377051163, 0.00070057801382373088329436061628, 0.00070121059569643463382088155456, 0.00070184374875438592170096008260, 0.00070247747351333158886965701839, 0.00070311177048948392525468120695, 0.00070374664019952424664355872252, 0.00070438208316059747367277044106, 0.00070501809989031581811513849090, 0.00070565469090676105970438847237, 0.00070629185672848053458711126140, 0.00070692959787448952056754247764, 0.00070756791486427492339494893514, 0.00070820680821778963891233171779, 0.00070884627845545634776402987853, 0.00070948632609817022590115165315, 0.00071012695166729406567179827547, 0.00071076815568466152842758143393, 0.00071140993867257996344927173382, 0.00071205230115382596271789150677, 0.00071269524365164774615949427883, 0.00071333876668976906477298571829, 0.00071398287079238356277882671108, 0.00071462755648415846390641981145, 0.00071527282429023717347932320720, 0.00071591867473623494160656077767, 0.00071656510834824114000718431328, 0.00071721212565282316513809446334, 0.00071785972717702123402361280569, 0.00071850791344835131160134755746, 0.00071915668499480836332871103167, 0.00071980604234486147627314345243, 0.00072045598602745689487819591434, 0.00072110651657202116514983059048, 0.00072175763450845614732642729905, 0.00072240934036714216006508371137, 0.00072306163467894134146835005694, 0.00072371451797519201123293219879, 0.00072436799078771289903816432698, 0.00072502205364880487926948493538, 0.00072567670709124750157148486807, 0.00072633195164830083399160054469, 0.00072698778785370947452815215684, 0.00072764421624169713011948124048, 0.00072830123734696976083025088400, 0.00072895885170471915771861493027, 0.00072961705985061741340513830067, 0.00073027586232082028309953170009, 0.00073093525965197043720716907345, 0.00073159525238119247399909417240, 0.00073225584104609573853766901763, 0.00073291702618477811738417759813, 0.00073357880833582018390709444944, 0.00073424118803828910140990560151, 0.00073490416583174144205675704100, 0.00073556774225621830796267852648, 0.00073623191785224836695966654787, 0.00073689669316085099678298453441, 0.00073756206872353140616138666985, 0.00073822804508228388742363534902, 0.00073889462277959463542414964010, 0.00073956180235843719389388084551, 0.00074022958436227527436596096422, 0.00074089796933506579194178565118, 0.00074156695782125442006210702672, 0.00074223655036577840943268213891, 0.00074290674751406962379035592292, 0.00074357754981204976941350226483, 0.00074424895780613353930832420957, 0.00074492097204323164897493692038, 0.00074559359307074584907737424544, 0.00074626682143657250331075792005, 0.00074694065768910497364607703474, 0.00074761510237722939194171534183, 0.00074829015605032737044888246913, 0.00074896581925827925441813137653, 0.00074964209255145935160979941969, 0.00075031897648073875121965681245, 0.00075099647159748868490564133182, 0.00075167457845357575629829938180, 0.00075235329760136443466578271000, 0.00075303262959372106646188660406, 0.00075371257498400834589497021554, 0.00075439313432608856753447401644, 0.00075507430817432687891743725572, 0.00075575609708358640163872177453, 0.00075643850160923094185644321996, 0.00075712152230712889341979199287, 0.00075780515973364749159751907470, 0.00075848941444565660778553972676, 0.00075917428700053156843258195252, 0.00075985977795614805928997581574, 0.00076054588787088581169903989121, 0.00076123261730363131309651247847, 0.00076191996681377292810477541707, 0.00076260793696120425955858879163, 0.00076329652830632696743073939416, 0.00076398574141004621518291628490, 0.00076467557683377359711157650324, 0.00076536603513943017411402802708, 0.00076605711688944181161908808519, 0.00076674882264674221535316611664, 0.00076744115297477607552656397871, 0.00076813410843749418792369976217, 0.00076882768959935638124897350210, 0.00076952189702533520341415362864, 0.00077021673128091028368708004237, 0.00077091219293207191055883331643, 0.00077160828254532450119068665018, 0.00077230500068768074672237444744, 0.00077300234792666562382013051291, 0.00077370032483031921360233651441, 0.00077439893196719182272974579817, 0.00077509816990634712759178359676, 0.00077579803921736521007262998850, 0.00077649854047033789548187820984, 0.00077719967423587178832061761469, 0.00077790144108509130804751663391, 0.00077860384158963381016904659049, 0.00077930687632165294726621640464, 0.00078001054585382181318087280175, 0.00078071485075932763042505513340, 0.00078141979161187511120773008244, 0.00078212536898569014372217811371, 0.00078283158345551393745426205228, 0.00078353843559660681789003078279, 0.00078424592598475147912223670588, 0.00078495405519624734599903881360, 0.00078566282380791458567204088581, 0.00078637223239709681810172270389, 0.00078708228154165623714766386598, 0.00078779297181997664633462674644, 0.00078850430381096714513994294649, 0.00078921627809405659956243361819, 0.00078992889524919700314914416950, 0.00079064215585686705486251346642, 0.00079135606049806662964929415693, 0.00079207060975432013946728737608, 0.00079278580420768011115251194809, 0.00079350164444072154856790746180, 0.00079421813103654572731093796989, 0.00079493526457878312205945769975, 0.00079565304565158831082150037162, 0.00079637147483964355280244840074, 0.00079709055272816160733068135968, 0.00079781027990288107178823429066, 0.00079853065695006920053644616786, 0.00079925168445652559120334634812, 0.00079997336300957687209300939202, 0.00080069569319707973795163802322, 0.00080141867560742496151560132489, 0.00080214231082953132197926882085, 0.00080286659945284961654304867196, 0.00080359154206736569617947063549, 0.00080431713926359515304254088619, 0.00080504339163258700675512846701, 0.00080577029976592663175483099991, 0.00080649786425573076996398125260, 0.00080722608569465078339616459502, 0.00080795496467587612360317095295, 0.00080868450179312891066413238050, 0.00080941469764066729421225776520, 0.00081014555281328913972221927864, 0.00081087706790632606539820370628, 0.00081160924351564767056238514087, 0.00081234208023766424616035619621, 0.00081307557866932189585135182242, 0.00081380973940810535493389776818, 0.00081454456305204221873428327427, 0.00081528005019969697949461240327, 0.00081601620145017438739953874460, 0.00081675301740312335370408636237, 0.00081749049865873120446213562218, 0.00081822864581772714997337514475, 0.00081896745948138597107068825665, 0.00081970694025152216442842156852, 0.00082044708873049373726998867440, 0.00082118790552120556839460485676, 0.00082192939122710398716642465899, 0.00082267154645218002612105934190, 0.00082341437180097332409339783155, 0.00082415786787856616310565804895, 0.00082490203529058726307499060937, 0.00082564687464321546810086527302, 0.00082639238654317334967225328057, 0.00082713857159773197715718628942, 0.00082788543041471319462731859318, 0.00082863296360248517562901993116, 0.00082938117176996502526858945359, 0.00083013005552662279176029391792, 0.00083087961548247593699528801281, 0.00083162985224809258914813181462, 0.00083238076643459533738439448669, 0.00083313235865365537716892285758, 0.00083388462951749641339366236892, 0.00083463757963889791298417453191, 0.00083539120963118935862812275417, 0.00083614552010825458558396228170, 0.00083690051168453416692571966706, 0.00083765618497502096831408557875, 0.00083841254059526264166141151790, 0.00083916957916136617878083425737, 0.00083992730128999151459345817727, 0.00084068570759835543025617621282, 0.00084144479870423534786927355356, 0.00084220457522596293368360997889, 0.00084296503778242876016996154576, 0.00084372618699308479968401730531, 0.00084448802347793954555660311811, 0.00084525054785756115627998186213, 0.00084601376075308157547610887761, 0.00084677766278619002668359705410, 0.00084754225457913735016640677244, 0.00084830753675473936394058060984, 0.00084907350993637100908251191811, 0.00084984017474797014443654852300, 0.00085060753181404123290237917487, 0.00085137558175964937832308487842, 0.00085214432521042401177252534339, 0.00085291376279256301152359442952, 0.00085368389513282587257453348784, 0.00085445472285853869397892479398, 0.00085522624659759678093090551343, 0.00085599846697845922375430527396, 0.00085677138463015280103046711346, 0.00085754500018227512378454768793, 0.00085831931426498953973530658956, 0.00085909432750902795222075480908, 0.00085987004054569526542706192629, 0.00086064645400686309601595569418, 0.00086142356852497367625254298673, 0.00086220138473304332345226175249, 0.00086297990326465712739023583566, 0.00086375912475397176922692343837, 0.00086453904983572007515724155979, 0.00086531967914520472803796558026, 0.00086610101331830195367511571192, 0.00086688305299146542395177794660, 0.00086766579880172029371615538551, 0.00086844925138666699548917193852, 0.00086923341138448460049120702919, 0.00087001827943392550605145041587, 0.00087080385617431868821441964812, 0.00087159014224557371328799826316, 0.00087237713828817477473148711553, 0.00087316484494318416260255633077, 0.00087395326285224660036593524737, 0.00087474239265758252283994300669, 0.00087553223500199262984561299206, 0.00087632279052886092197277578819, 0.00087711405988214949640963125077, 0.00087790604370640147428861421730, 0.00087869874264674566275573619478, 0.00087949215734888972449689870103, 0.00088028628845912462296680045526, 0.00088108113662432809183588933166, 0.00088187670249195856345819644062, 0.00088267298671005918041937432506, 0.00088346998992726169866451790824, 0.00088426771279277987386491233224, 0.00088506615595641390664694014845, 0.00088586532006855412887946776834, 0.00088666520578017449846081055043, 0.00088746581374283715296785723936, 0.00088826714460869555384237017392, 0.00088906919903048895695990561094, 0.00088987197766154577365654843035, 0.00089067548115578779911738482866, 0.00089147971016772381558368465448, 0.00089228466535245382074137410200, 0.00089309034736567249716798766457, 0.00089389675686366335764093671301, 0.00089470389450330221458446144922, 0.00089551176094206173371875534528, 0.00089632035683800471200649573333, 0.00089712968284978798078066475341, 0.00089793973963666685097345654398, 0.00089875052785848817422237333474, 0.00089956204817569467967891538862, 0.00090037430124932909397683644670, 0.00090118728774102720233823982099, 0.00090200100831302251064292008209, 0.00090281546362814982329553226137, 0.00090363065434983906327320868357, 0.00090444658114211917525337991464, 0.00090526324466962181190116121243, 0.00090608064559757591285849009921, 0.00090689878459181074051020932103, 0.00090771766231875999995232229267, 0.00090853727944545598430026167591, 0.00090935763663953336939649307880, 0.00091017873456923290009790150634, 0.00091100057390339531874362544173, 0.00091182315531146526828287779409, 0.00091264647946349541224320134347, 0.00091347054703013971267699933065, 0.00091429535868265820065109439341, 0.00091512091509291990359259427734, 0.00091594721693339742427802940838, 0.00091677426487717041028030484640, 0.00091760205959792978235717297864, 0.00091843060176997133765841585529, 0.00091925989206819954443344888873, 0.00092008993116813209568044529263, 0.00092092071974589264499178042911, 0.00092175225847821590230424249057, 0.00092258454804245077808533270769, 0.00092341758911655420338088218202, 0.00092425138237909568346417632512, 0.00092508592850926055044247231507, 0.00092592122818684410856526767475, 0.00092675728209225532051168672254, 0.00092759409090652114419917051436, 0.00092843165531127991915022468206, 0.00092926997598878548646067487837, 0.00093010905362191120034770497327, 0.00093094888889414353135703938946, 0.00093178948248958618633119854735, 0.00093263083509296379469688531572, 0.00093347294738961594535303634146, 0.00093431582006550130663907749451, 0.00093515945380720087894144132434, 0.00093600384930191246526248738391, 0.00093684900723745435750788868035, 0.00093769492830226923961445262279, 0.00093854161318541822443817235211, 0.00093938906257658421478096144597, 0.00094023727716607667388021285504, 0.00094108625764482457809467774723, 0.00094193600470438118739402444390, 0.00094278651903692729796535587639, 0.00094363780133526549594169541280, 0.00094448985229282362684893881166, 0.00094534267260365934925497866104, 0.00094619626296245373797688671402, 0.00094705062406451453668743134529, 0.00094790575660578147050572273002, 0.00094876166128281865658200544544, 0.00094961833879281937458721740697, 0.00095047578983360996984081081607, 0.00095133401510364334809771724721, 0.00095219301530200309551660309282, 0.00095305279112840738178769051103, 0.00095391334328320288860059150693, 0.00095477467246736849593169438322, 0.00095563677938251961885285368226, 0.00095649966473090181073857252159, 0.00095736332921539444955338904464, 0.00095822777353951529150100085985, 0.00095909299840741374897079563056, 0.00095995900452387501050610651987, 0.00096082579259432416077246763564, 0.00096169336332481967534457911739, 0.00096256171742205775751499707837, 0.00096343085559337613300173730480, 0.00096430077854674754473524034282, 0.00096517148699078430650749593767, 0.00096604298163474166399877773870, 0.00096691526318851226534656362332, 0.00096778833236262919691161865643, 0.00096866218986827118744842302078, 0.00096953683641725523553039911562, 0.00097041227272204105477881874720, 0.00097128849949573551909171031937, 0.00097216551745208550690952042928, 0.00097304332730548267170467280351, 0.00097392192977096691142852025180, 0.00097480132556422062223983049378, 0.00097568151540157195111130361553, 0.00097656250000000000000000000000, 0.00097744428007712712801191567991, 0.00097832685635122393873197577108, 0.00097921022954121340019228991736, 0.00098009440036666336387716214062, 0.00098097936954779220257438776542, 0.00098186513780547141246046738416, 0.00098275170586122062577061342381, 0.00098363907443721042972439860819, 0.00098452724425626713701531489420, 0.00098541621604186606375730406171, 0.00098630599051813629997431664975, 0.00098719656840986374536639491595, 0.00098808795044248547145837591188, 0.00098898013734209340788727793381, 0.00098987312983543889605142496180, 0.00099076692864992575021654275247, 0.00099166153451361481116488327814, 0.00099255694815522763248261117752, 0.00099345317030414019218720333981, 0.00099435020169038701269570434960, 0.00099524804304466593131428542307, 0.00099614669509833029398260251241, 0.00099704615858339415944422423621, 0.00099794643423253576869358383306, 0.00099884752277909212396511673404, 0.00099974942495706137397804003086, 0.00100065214150110910230895289175, 0.00100155567314655965377445667741, 0.00100246002062940177228245186569, 0.00100336518468629272080039349646, 0.00100427116605455069194008377309, 0.00100517796547215979528766549578, 0.00100608558367777439421231200356, 0.00100699402141071216697232326709, 0.00100790327941095779300251233934, 0.00100881335841916837392506778315, 0.00100972425917666606097478076975, 0.00101063598242544195812686602665, 0.00101154852890816132626738976796, 0.00101246189936815577693762779887, 0.00101337609454942891018536244019, 0.00101429111519665891665009649358, 0.00101520696205519337339262531117, 0.00101612363587105249650155425201, 0.00101704113739093369474242312123, 0.00101795946736220549802554025121, 0.00101887862653291059317206546098, 0.00101979861565177124492487248375, 0.00102071943546818214021421056259, 0.00102164108673221385760465640402, 0.00102256357019461893882728009686, 0.00102348688660682364884313422237, 0.00102441103672093274633281279051, 0.00102533602128973360366470668481, 0.00102626184106669013536283774357, 0.00102718849680594626755381071348, 0.00102811598926233049161593768872, 0.00102904431919134914212576870085, 0.00102997348734919116734765065502, 0.00103090349449273159868067928358, 0.00103183434137952526228609873016, 0.00103276602876781111589599149170, 0.00103369855741651636878153386334, 0.00103463192808524975969952652832, 0.00103556614153430589370108449998, 0.00103650119852467001262119605798, 0.00103743709981801018882308085267, 0.00103837384617668231252818333843, 0.00103931143836373486230573170985, 0.00104024987714290109881709600614, 0.00104118916327860405214578154443, 0.00104212929753596064176568436466, 0.00104307028068077495448762181951, 0.00104401211347954258126802251638, 0.00104495479669945495401761625942, 0.00104589833110839240670753014228, 0.00104684271747492872901841298727, 0.00104778795656833550314912528734, 0.00104873404915857494808240080175, 0.00104968099601630469007440549234, 0.00105062879791288188262299296838, 0.00105157745562035648441423507649, 0.00105252696991147537929067734552, 0.00105347734155968736358133241993, 0.00105442857133913533984603816407, 0.00105538066002466152104588559268, 0.00105633360839181176735190881288, 0.00105728741721682777988944312852, 0.00105824208727665273858942196483, 0.00105919761934893477163532882201, 0.00106015401421202088393103135644, 0.00106111127264495999286686434004, 0.00106206939542750943353266457336, 0.00106302838334012585141952200729, 0.00106398823716397105711151116481, 0.00106494895768091571257307759168, 0.00106591054567353304277643744058, 0.00106687300192510252198896392173, 0.00106783632721961507794361523338, 0.00106880052234176528558329266616, 0.00106976558807695678807170303060, 0.00107073152521130554939987611363, 0.00107169833453163399969443325688, 0.00107266601682547493834540830449, 0.00107363457288107608765537204221, 0.00107460400348739315394552829019, 0.00107557430943409394752396934791, 0.00107654549151156337001566942746, 0.00107751755051089625862814624924, 0.00107849048722390128927928198976, 0.00107946430244310661444862020630, 0.00108043899696175184008128944413, 0.00108141457157379236239669317854, 0.00108239102707390500573980673948, 0.00108336836425747999948510091883, 0.00108434658392062574852610090659, 0.00108532568686017338692451073001, 0.00108630567387366983901630934639, 0.00108728654575938193938000608796, 0.00108826830331630120332619959811, 0.00108925094734413688800367392417, 0.00109023447864332032920808845944, 0.00109121889801500906135023338805, 0.00109220420626108052908342926912, 0.00109319040418413642411221697870, 0.00109417749258750658832017865763, 0.00109516547227524250855690279849, 0.00109615434405212165344667418765, 0.00109714410872365224387803284145, 0.00109813476709606544674813211060, 0.00109912631997632122965447010188, 0.00110011876817211117982053814046, 0.00110111211249185308308495834240, 0.00110210635374469395966756657401, 0.00110310149274051570202070937654, 0.00110409753028992791909490556179, 0.00110509446720427140578579816577, 0.00110609230429562421446632036748, 0.00110709104237679319820975010202, 0.00110809068226131921496013799100, 0.00110909122476348189802186627873, 0.00111009267069829206664444143371, 0.00111109502088149627967161858777, 0.00111209827612958160603096047225, 0.00111310243725976890268036800791, 0.00111410750509001650089546675559, 0.00111511348043902497675916585251, 0.00111612036412623086278905759627, 0.00111712815697181033422480389561, 0.00111813685979668376267726070949, 0.00111914647342250942775587763123, 0.00112015699867168676967521534493, 0.00112116843636736224394667704729, 0.00112218078733342194880373554611, 0.00112319405239449487780845071683, 0.00112420823237595964190493891266, 0.00112522332810393557896155858344, 0.00112623934040528795794133820607, 0.00112725627010763274939153522070, 0.00112827411803932946970929762642, 0.00112929288502948530110991942621, 0.00113031257190796007895683406019, 0.00113133317950535891918684150426, 0.00113235470865303698879966720625, 0.00113337716018310427634752102222, 0.00113440053492841800251988981785, 0.00113542483372258717379266190761, 0.00113645005739997800343898948228, 0.00113747620679570567159277771907, 0.00113850328274563952941911271211, 0.00113953128608640786960382040860, 0.00114056021765538990325739021614, 0.00114159007829072139776627192731, 0.00114262086883129901360156566170, 0.00114365259011677249806337997029, 0.00114468524298754967261082526875, 0.00114571882828480207071331076207, 0.00114675334685045561371186106925, 0.00114778879952719689919171663917, 0.00114882518715847775463145818975, 0.00114986251058850743114736481232, 0.00115090077066225694030210391361, 0.00115193996822546469195602814040, 0.00115298010412462912169240247806, 0.00115402117920701216026435620421, 0.00115506319432064552196748330459, 0.00115610615031432203102246258908, 0.00115715004803760147626678911337, 0.00115819488834081429744216062971, 0.00115924067207505507998144267390, 0.00116028740009218645813648951304, 0.00116133507324484475282944107022, 0.00116238369238643194855664653176, 0.00116343325837112068071865778052, 0.00116448377205385857242891933794, 0.00116553523429036172930073345100, 0.00116658764593711799205377754873, 0.00116764100785139387540800814946, 0.00116869532089122502710454298835, 0.00116975058591542186575695794204, 0.00117080680378357478502171495904, 0.00117186397535604569682121667284, 0.00117292210149397410287597232070, 0.00117398118305928034731111520017, 0.00117504122091465976196467124737, 0.00117610221592358570215364199640, 0.00117716416895031626872747398949, 0.00117822708085988520076980989870, 0.00117929095251810729660935095353, 0.00118035578479158361799028487127, 0.00118142157854769346697620946429, 0.00118248833465459915643969157628, 0.00118355605398125121423269501264, 0.00118462473739738057693093864486, 0.00118569438577350357716388984386, 0.00118676499998092671410432341617, 0.00118783658089173884721267970832, 0.00118890912937881640040749253728, 0.00118998264631582856623581712086, 0.00119105713257722841541541569654, 0.00119213258903825918520735793749, 0.00119320901657495861622471089447, 0.00119428641606415071249602810610, 0.00119536478838345181299751551762, 0.00119644413441127492846172142293, 0.00119752445502682128460059107766, 0.00119860575111008661047806711508, 0.00119968802354186525847834499103, 0.00120077127320374283173110008249, 0.00120185550097810052092017762959, 0.00120294070774812095897532415734, 0.00120402689439777998113567658578, 0.00120511406181185096175845217203, 0.00120620221087591153637241792040, 0.00120729134247633341017746921864, 0.00120838145750028973061940273936, 0.00120947255683575833999643389660, 0.00121056464137151505340572743563, 0.00121165771199713756187121838082, 0.00121275176960301172071621245152, 0.00121384681508032287594600617808, 0.00121494284932106085157788033513, 0.00121603987321802537065196236910, 0.00121713788766481781529471550840, 0.00121823689355584686457023568806, 0.00121933689178633283128894149172, 0.00122043788325229963891149775890, 0.00122153986885058110992141600093, 0.00122264284947882443527200635458, 0.00122374682603548366917334266901, 0.00122485179941982319853921445940, 0.00122595777053192489872146531127, 0.00122706474027267815885000601384, 0.00122817270954378595336498047885, 0.00122928167924777004618719367102, 0.00123039165028796253394116622104, 0.00123150262356851148380643135027, 0.00123261459999438548716665930982, 0.00123372758047136585335401548491, 0.00123484156590605159697915382822, 0.00123595655720586550946338277868, 0.00123707255527904440121911289197, 0.00123818956103464582370332625061, 0.00123930757538255197254539741181, 0.00124042659923346274865318950020, 0.00124154663349890009502174414990, 0.00124266767909121363458457842910, 0.00124378973692357199659630495603, 0.00124491280790996867132436332071, 0.00124603689296522656369814452404, 0.00124716199300499083757465257349, 0.00124828810894573238518545643672, 0.00124941524170475519971146294296, 0.00125054339220018596694206092224, 0.00125167256135098143784989410676, 0.00125280275007693189803781308456, 0.00125393395929865401200453689512, 0.00125506618993759537679377746855, 0.00125619944291604059352640554437, 0.00125733371915710194326176729618, 0.00125846901958472589221071924470, 0.00125960534512369699486344920558, 0.00126074269669963095509557238216, 0.00126188107523897874613638681041, 0.00126302048166903268210103927771, 0.00126416091691791774437314543889, 0.00126530238191459678577521774656, 0.00126644487758887660210083137002, 0.00126758840487139839113550632277, 0.00126873296469364360734843888423, 0.00126987855798794003342466751860, 0.00127102518568745223928595500240, 0.00127217284872618700310165085199, 0.00127332154803899981650172623660, 0.00127447128456158556043809060299, 0.00127562205923048327567415061168, 0.00127677387298308331851914854127, 0.00127792672675761673564687193050, 0.00127908062149316285351086097677, 0.00128023555812965274779136048977, 0.00128139153760786165398011249295, 0.00128254856086941482207208764521, 0.00128370662885679163653374068588, 0.00128486574251331846056867203032, 0.00128602590278317318976675220910, 0.00128718711061139067311498429547, 0.00128834936694385468990142751267, 0.00128951267272730315388562516432, 0.00129067702890933353430946706197, 0.00129184243643839374859894064684, 0.00129300889626378866757716590286, 0.00129417640933568488595395429286, 0.00129534497660510204870842887459, 0.00129651459902391848894032122530, 0.00129768527754487729940213736057, 0.00129885701312157657467960536479, 0.00130002980670847548272384130996, 0.00130120365926089990270264618033, 0.00130237857173503353454269149125, 0.00130355454508792375362125071092, 0.00130473158027748616441532369947, 0.00130590967826249722792686380757, 0.00130708884000259859849146781841, 0.00130826906645830362899141086075, 0.00130945035859098826355739753069, 0.00131063271736289580805812082787, 0.00131181614373714386899416606269, 0.00131300063867771459567845848682, 0.00131418620314946075176842921195, 0.00131537283811811113627687763739, 0.00131656054455026147627372257176, 0.00131774932341338028157773365479, 0.00131893917567581491628869727606, 0.00132013010230678162412742970844, 0.00132132210427637225048924651816, 0.00132251518255555922977395599816, 0.00132370933811618712860891378114, 0.00132490457193097785001945076999, 0.00132610088497353627128017006243, 0.00132729827821834157029756706692, 0.00132849675264075351398262991864, 0.00132969630921701636137866042731, 0.00133089694892425170792693567279, 0.00133209867274046325595626694138, 0.00133330148164454288621516564461, 0.00133450537661626068321185645260, 0.00133571035863627252462948469258, 0.00133691642868612355077306830253, 0.00133812358774824144251602842104, 0.00133933183680593989074714134091, 0.00134054117684342618578574590771, 0.00134175160884579059220045316181, 0.00134296313379901372138391923983, 0.00134417575268997086836153531664, 0.00134538946650642333817404772134, 0.00134660427623702473425015835318, 0.00134782018287132616257695261197, 0.00134903718739976734124208501697, 0.00135025529081368223828507613149, 0.00135147449410530470954860948751, 0.00135269479826775982506115170168, 0.00135391620429506929004781490278, 0.00135513871318215729962208815351, 0.00135636232592484186516845756643, 0.00135758704351983936799153074304, 0.00135881286696477171505037517818, 0.00136003979725815636429853139333, 0.00136126783539941282989704784967, 0.00136249698238886745270403988428, 0.00136372723922774494349774432322, 0.00136495860691817445450868540036, 0.00136619108646319456674966819065, 0.00136742467886674461639839872618, 0.00136865938513367076632964991489, 0.00136989520626973121028568947111, 0.00137113214328158728241846553431, 0.00137237019717680909514090359380, 0.00137360936896388226118037589885, 0.00137484965965219726839741110069, 0.00137609107025205620183916366273, 0.00137733360177467838159071078508, 0.00137857725523219168915767252059, 0.00137982203163763690427490171686, 0.00138106793200497572800256040892, 0.00138231495734907929018309147295, 0.00138356310868573573885642602477, 0.00138481238703165544443041135025, 0.00138606279340446145870169303294, 0.00138731432882269602006874986699, 0.00138856699430582575770232178769, 0.00138982079087423301792802998733, 0.00139107571954922128523723934279, 0.00139233178135302168750009332854, 0.00139358897730878302130552714999, 0.00139484730844057760665299916525, 0.00139610677577340822584639479231, 0.00139736738033319749831273615115, 0.00139862912314679460265565147381, 0.00139989200524198134818754102326, 0.00140115602764746176658872123255, 0.00140242119139286926764176310911, 0.00140368749750877184340192016521, 0.00140495494702666317773931403678, 0.00140622354097896785050936241390, 0.00140749328039904849328711744505, 0.00140876416632119494734554088211, 0.00141003619978063163623027698179, 0.00141130938181352211940877694474, 0.00141258371345696106917422252280, 0.00141385919574897904113508495527, 0.00141513582972854984678989787028, 0.00141641361643557927782466343558, 0.00141769255691091269552805975707, 0.00141897265219634045180230330629, 0.00142025390333458813134359655095, 0.00142153631136932305685516286786, 0.00142281987734515992689854346764, 0.00142410460230765192543578301354, 0.00142539048730329549231898855766, 0.00142667753337953812954597143658, 0.00142796574158476712555765342216, 0.00142925511296831692781283962290, 0.00143054564858047434695864641441, 0.00143183734947246988321312155534, 0.00143313021669648228001436862655, 0.00143442425130564633027618892669, 0.00143571945435404246804722561137, 0.00143701582689670262320269511491, 0.00143831336998961672665742206334, 0.00143961208468972295254628690486, 0.00144091197205491378975639182869, 0.00144221303314404233029966118096, 0.00144351526901691229465285459810, 0.00144481868073428432013016742275, 0.00144612326935788268293670011388, 0.00144742903595038402246586439759, 0.00144873598157542579807632865396, 0.00145004410729760975853896987076, 0.00145135341418249500314296973613, 0.00145266390329660166798320108938, 0.00145397557570741894905630431367, 0.00145528843248339426023896248097, 0.00145660247469393952166050176800, 0.00145791770340943831543722986055, 0.00145923411970123482681027660135, 0.00146055172464164056619906340018, 0.00146187051930394087441433814689, 0.00146319050476238494799818834480, 0.00146451168209219147707533803526, 0.00146583405236955623476835519625, 0.00146715761667164036781418889888, 0.00146848237607657820281981120303, 0.00146980833166348288411351408200, 0.00147113548451243661592535705296, 0.00147246383570449673391933309574, 0.00147379338632170199356596906881, 0.00147512413744706281232277333970, 0.00147645609016456777484727069805, 0.00147778924555918927084829928020, 0.00147912360471687438778776169102, 0.00148045916872455054873192192844, 0.00148179593867013158388357130235, 0.00148313391564250884012421405345, 0.00148447310073155681886536427783, 0.00148581349502813924758071184584, 0.00148715509962409953882700452965, 0.00148849791561226707861664841914, 0.00148984194408646329794987384076, 0.00149118718614149169815474849088, 0.00149253364287314500662151584010, 0.00149388131537820994729215406949, 0.00149523020475445878388343068366, 0.00149658031210065474089776493827, 0.00149793163851655850883626275305, 0.00149928418510291870321959883938, 0.00150063795296147750243931362490, 0.00150199294319497736981128266365, 0.00150334915690715151259659876359, 0.00150470659520272886933156542000, 0.00150606525918744213292377320812, 0.00150742514996801669178994043108, 0.00150878626865217713506894803288, 0.00151014861634865375783487451145, 0.00151151219416717280327744354906, 0.00151287700321846188371288643992, 0.00151424304461425778683958398574, 0.00151561031946729498319503814940, 0.00151697882889131321557107945353, 0.00151834857400106313686516390504, 0.00151971955591229611857995163149, 0.00152109177574177162339807978242, 0.00152246523460726262619302495693, 0.00152383993362754585620955083414, 0.00152521587392240851911717758327, 0.00152659305661265393486147878832, 0.00152797148282009243036583256981, 0.00152935115366754719422315300648, 0.00153073207027886034822805605415, 0.00153211423377888362323817617039, 0.00153349764529348443070633223329, 0.00153488230594955215105312795743, 0.00153626821687498837584739952433, 0.00153765537919871276249794700419, 0.00153904379405067040682830725729, 0.00154043346256182056737416008474, 0.00154182438586414382111766663286, 0.00154321656509064900238137330035, 0.00154461000137536149344474889489, 0.00154600469585333124764026102582, 0.00154740064966063842720467302883, 0.00154879786393438364545949159634, 0.00155019633981269425518356719351, 0.00155159607843473042014525997701, 0.00155299708094067579096375641967, 0.00155439934847174357664123522937, 0.00155580288217018261609503326781, 0.00155720768317926762033809318098, 0.00155861375264330589453243280929, 0.00156002109170764362636174560350, 0.00156142970151865526085011026680, 0.00156283958322375022241546016488, 0.00156425073797138028744435622741, 0.00156566316691102787490852410457, 0.00156707687119321363578006156558, 0.00156849185196950295824447341175, 0.00156990811039249469199807762720, 0.00157132564761582917134408177162, 0.00157274446479419363620344540777, 0.00157416456308331247429532773197, 0.00157558594363995329266925349287, 0.00157700860762193429027988589297, 0.00157843255618811319912486723638, 0.00157985779049839400629828833900, 0.00158128431171373410972502693284, 0.00158271212099613325929858831387, 0.00158414121950864027893457475216, 0.00158557160841536022230502389618, 0.00158700328888144309713581492360, 0.00158843626207309145462187593978, 0.00158987052915756624411891539950, 0.00159130609130317662164300074323, 0.00159274294967928710560489680148, 0.00159418110545632321466136271937, 0.00159562055980576214357646858133, 0.00159706131390013840107289233572, 0.00159850336891305118240669269625, 0.00159994672601915374418601878403, 0.00160139138639415947590327604644, 0.00160283735121484992303120264978, 0.00160428462165906264395853764171, 0.00160573319890569923308609734391, 0.00160718308413473139235894127097, 0.00160863427852719030608508177238, 0.00161008678326517401351025693401, 0.00161154059953185326350966199982, 0.00161299572851146153992796250520, 0.00161445217138930156679232919004, 0.00161590992935175224720634190589, 0.00161736900358625782132826476101, 0.00161882939528133458842451553039, 0.00162029110562657827944443855728, 0.00162175413581265213079640741256, 0.00162321848703129534112477028174, 0.00162468416047532849232071239243, 0.00162615115733864379170270364483, 0.00162761947881621070986779553635, 0.00162908912610408443746856654855, 0.00163056010039939395898922480654, 0.00163203240290034877479907748921, 0.00163350603480624670740817272474, 0.00163498099731746240892427124436, 0.00163645729163545429994675028951, 0.00163793491896277194214137651329, 0.00163941388050304432885684313703, 0.00164089417746098747453997734880, 0.00164237581104241113678920971353, 0.00164385878245420797433284931799, 0.00164534309290436005224211868381, 0.00164682874360194664818679566309, 0.00164831573575713232621131609790, 0.00164980407058117452614998121874, 0.00165129374928643093620173054603, 0.00165278477308634669934450656115, 0.00165427714319546395431437257884, 0.00165577086082942638925463718635, 0.00165726592720497035125803986233, 0.00165876234353993005053717890718, 0.00166026011105324558352058783584, 0.00166175923096495187399057602562, 0.00166325970449618517829626362925, 0.00166476153286919067476878897338, 0.00166626471730731075433784571516, 0.00166776925903499282678732473784, 0.00166927515927779582596834906383, 0.00167078241926237871725624550834, 0.00167229104021650917116792456341, 0.00167380102336906833385143933413, 0.00167531236995004193662817115751, 0.00167682508119052528332282303580, 0.00167833915832273235756166851473, 0.00167985460257998302918691635455, 0.00168137141519671086051235242564, 0.00168288959740847069573854710711, 0.00168440915045192586736721995777, 0.00168593007556485752033992309151, 0.00168745237398616959936803461062, 0.00168897604695587909111320623623, 0.00169050109571512231255996372425, 0.00169202752150616315095221775522, 0.00169355532557238005336719410820, 0.00169508450915827470033281354489, 0.00169661507350947872788116121967, 0.00169814701987274201816502383622, 0.00169968034949594028887309704601, 0.00170121506362808246580475834975, 0.00170275116351929875664616975683, 0.00170428865042084802354505068678, 0.00170582752558512602304718885904, 0.00170736779026565174514906697567, 0.00170890944571707738795784958796, 0.00171045249319519356186181102686, 0.00171199693395691844750861054791, 0.00171354276926030560206093422693, 0.00171509000036455024756909537587, 0.00171663862852997907947061317913, 0.00171818865501805590444150961815, 0.00171974008109139053085412385258, 0.00172129290801372619203191138837, 0.00172284713704994735250508597346, 0.00172440276946608664690452350499, 0.00172595980652931425478047167132, 0.00172751824950794353845384687673, 0.00172907809967144015031448311959, 0.00173063935829040945607593116051, 0.00173220202663660390735023142383, 0.00173376610598293084790355589320, 0.00173533159760344058743231077102, 0.00173689850277333399097834387703, 0.00173846682276896920098241405839, 0.00174003655886785101210290083174, 0.00174160771234863737642883929624, 0.00174318028449114742657599652631, 0.00174475427657634954946297423106, 0.00174632968988636832520511266154, 0.00174790652570449320073187049474, 0.00174948478531516504567988601337, 0.00175106447000398525969122598411, 0.00175264558105772184394555157638, 0.00175422811976429899281926250154, 0.00175581208741280294857722843460, 0.00175739748529349132551147238956, 0.00175898431469777944899379740207, 0.00176057257691824924593360091052, 0.00176216227324865618367177866332, 0.00176375340498391712691639288124, 0.00176534597342011836083874865011, 0.00176693997985452339732903581648, 0.00176853542558555974772982466448, 0.00177013231191282781329388029690, 0.00177173064013710825775893553669, 0.00177333041156034899692162110085, 0.00177493162748567430593571447872, 0.00177653428921739110768474034785, 0.00177813839806097791391981122189, 0.00177974395532309154731309686071, 0.00178135096231157559823476965732, 0.00178295942033544763116736930897, 0.00178456933070490764148274820400, 0.00178618069473134499433597532914, 0.00178779351372732671528187342602, 0.00178940778900660442916892289844, 0.00179102352188412346743751069056, 0.00179264071367600942401299146667, 0.00179425936569957596156132950682, 0.00179587947927333370194691308797, 0.00179750105571697634844474666949, 0.00179912409635138935935783077724, 0.00180074860249865818795367289340, 0.00180237457548205440467647964198, 0.00180400201662604502128584016418, 0.00180563092725629964659106452274, 0.00180726130869967812654641736714, 0.00180889316228423835050675982927, 0.00181052648933924362380232242486, 0.00181216129119515182571698019842, 0.00181379756918362148102041864206, 0.00181543532463751999990464458534, 0.00181707455889091196860052335182, 0.00181871527327906673879298615759, 0.00182035746913846580019580301268, 0.00182200114780679063748725088345, 0.00182364631062293053656575558819, 0.00182529295892699082448640268694, 0.00182694109406027942535399866131, 0.00182859071736531640130218878681, 0.00183024183018583980718518855468, 0.00183189443386679484855605881677, 0.00183354852975434082056060969279, 0.00183520411919585956471434595727, 0.00183686120353994267531683171057, 0.00183851978413639908886689777745, 0.00184017986233626419136089058526, 0.00184184143949178528998356085822, 0.00184350451695643180460848498115, 0.00184516909608490155617066541538, 0.00184683517823310840676176436403, 0.00184850276475819136692835265023, 0.00185017185701852110088494463014, 0.00185184245637368821713053534950, 0.00185351456418451064102337344508, 0.00185518818181304228839834102871, 0.00185686331062255983830044936411, 0.00185853995197757097292134975675, 0.00186021810724382240069540994654, 0.00186189777778828706271407877892, 0.00186357896497917237266239709470, 0.00186526167018592758939377063143, 0.00186694589477923189070607268292, 0.00186863164013100261327815498902, 0.00187031890761440175788288264869, 0.00187200769860382493052497476782, 0.00187369801447490871501577736069, 0.00187538985660453847922890524558, 0.00187708322637083644887634470422, 0.00187877812515316842956192289193, 0.00188047455433215334776042571008, 0.00188217251528964915618935549446, 0.00188387200940876237478804888781, 0.00188557303807385459593071175277, 0.00188727560267053099188339082559, 0.00188897970458564725369787762332, 0.00189068534520731869850995732207, 0.00189239252592490747595377342805, 0.00189410124812902907337486269057, 0.00189581151321156294101144546005, 0.00189752332256563731316401089089, 0.00189923667758563874917443481394, 0.00190095157966721993968162163213, 0.00190266803020728669619543449443, 0.00190438603060400619103320618564, 0.00190610558225681476357538102206, 0.00190782668656640577720118301386, 0.00190954934493473699186338876643, 0.00191127355876503923770570736451, 0.00191299932946180362147714504317, 0.00191472665843078889910677808928, 0.00191645554707903058300200171971, 0.00191818599681482749794159126111, 0.00191991800904775002101221303974, 0.00192165158518864832154493527128, 0.00192338672664963935068915823479, 0.00192512343484411551502999415675, 0.00192686171118675226600347460959, 0.00192860155709349508947048068563, 0.00193034297398156861301499187533, 0.00193208596326948332799755547740, 0.00193383052637702453069312724665, 0.00193557666472525839382323731286, 0.00193732437973654237489684604157, 0.00193907367283451047106079823124, 0.00194082454544408210955763749439, 0.00194257699899147103818342063875, 0.00194433103490417101381904085855, 0.00194608665461096534340934560703, 0.00194784385954193382285704050361, 0.00194960265112844124447966098757, 0.00195136303080314390222260723107, 0.00195312500000000000000000000000, 0.00195488856015425425602383135981, 0.00195665371270244787746395154215, 0.00195842045908242680038457983471, 0.00196018880073332672775432428125, 0.00196195873909558440514877553085, 0.00196373027561094282492093476833, 0.00196550341172244125154122684762, 0.00196727814887442085944879721637, 0.00196905448851253427403062978840, 0.00197083243208373212751460812342, 0.00197261198103627259994863329950, 0.00197439313681972749073278983190, 0.00197617590088497094291675182376, 0.00197796027468418681577455586762, 0.00197974625967087779210284992359, 0.00198153385729985150043308550494, 0.00198332306902722962232976655628, 0.00198511389631045526496522235504, 0.00198690634060828038437440667963, 0.00198870040338077402539140869919, 0.00199049608608933186262857084614, 0.00199229339019666058796520502483, 0.00199409231716678831888844847242, 0.00199589286846507153738716766611, 0.00199769504555818424793023346808, 0.00199949884991412274795608006173, 0.00200130428300221820461790578349, 0.00200311134629311930754891335482, 0.00200492004125880354456490373138, 0.00200673036937258544160078699292, 0.00200854233210910138388016754618, 0.00201035593094431959057533099156, 0.00201217116735554878842462400712, 0.00201398804282142433394464653418, 0.00201580655882191558600502467868, 0.00201762671683833674785013556630, 0.00201944851835333212194956153951, 0.00202127196485088391625373205329, 0.00202309705781632265253477953593, 0.00202492379873631155387525559775, 0.00202675218909885782037072488038, 0.00202858223039331783330019298717, 0.00203041392411038674678525062234, 0.00203224727174210499300310850401, 0.00203408227478186738948484624245, 0.00203591893472441099605108050241, 0.00203775725306582118634413092195, 0.00203959723130354248984974496750, 0.00204143887093636428042842112518, 0.00204328217346442771520931280804, 0.00204512714038923787765456019372, 0.00204697377321364729768626844475, 0.00204882207344186549266562558103, 0.00205067204257946720732941336962, 0.00205252368213338027072567548714, 0.00205437699361189253510762142696, 0.00205623197852466098323187537744, 0.00205808863838269828425153740170, 0.00205994697469838233469530131003, 0.00206180698898546319736135856715, 0.00206366868275905052457219746032, 0.00206553205753562223179198298340, 0.00206739711483303273756306772668, 0.00206926385617049951939905305665, 0.00207113228306861178740216899996, 0.00207300239704934002524239211596, 0.00207487419963602037764616170534, 0.00207674769235336462505636667686, 0.00207862287672746972461146341971, 0.00208049975428580219763419201229, 0.00208237832655720810429156308885, 0.00208425859507192128353136872931, 0.00208614056136154990897524363902, 0.00208802422695908516253604503277, 0.00208990959339890990803523251884, 0.00209179666221678481341506028457, 0.00209368543494985745803682597455, 0.00209557591313667100629825057467, 0.00209746809831714989616480160350, 0.00209936199203260938014881098468, 0.00210125759582576376524598593676, 0.00210315491124071296882847015297, 0.00210505393982295075858135469105, 0.00210695468311937472716266483985, 0.00210885714267827067969207632814, 0.00211076132004932304209177118537, 0.00211266721678362353470381762577, 0.00211457483443365555977888625705, 0.00211648417455330547717884392966, 0.00211839523869786954327065764403, 0.00212030802842404176786206271288, 0.00212222254528991998573372868009, 0.00212413879085501886706532914673, 0.00212605676668025170283904401458, 0.00212797647432794211422302232961, 0.00212989791536183142514615518337, 0.00213182109134706608555287488116, 0.00213374600385020504397792784346, 0.00213567265443923015588723046676, 0.00213760104468353057116658533232, 0.00213953117615391357614340606119, 0.00214146305042261109879975222725, 0.00214339666906326799938886651375, 0.00214533203365094987669081660897, 0.00214726914576215217531074408441, 0.00214920800697478630789105658039, 0.00215114861886818789504793869582, 0.00215309098302312674003133885492, 0.00215503510102179251725629249847, 0.00215698097444780257855856397953, 0.00215892860488621322889724041261, 0.00216087799392350368016257888826, 0.00216282914314758472479338635708, 0.00216478205414781001147961347897, 0.00216673672851495999897020183766, 0.00216869316784125149705220181318, 0.00217065137372034677384902146002, 0.00217261134774733967803261869278, 0.00217457309151876387876001217592, 0.00217653660663260240665239919622, 0.00217850189468827377600734784835, 0.00218046895728664065841617691888, 0.00218243779603001812270046677611, 0.00218440841252216105816685853824, 0.00218638080836827284822443395740, 0.00218835498517501317664035731525, 0.00219033094455048501711380559698, 0.00219230868810424330689334837530, 0.00219428821744730448775606568290, 0.00219626953419213089349626422120, 0.00219825263995264245930894020375, 0.00220023753634422235964107628092, 0.00220222422498370616616991668479, 0.00220421270748938791933513314802, 0.00220620298548103140404141875308, 0.00220819506057985583818981112358, 0.00221018893440854281157159633153, 0.00221218460859124842893264073496, 0.00221418208475358639641950020405, 0.00221618136452263842992027598200, 0.00221818244952696379604373255745, 0.00222018534139658413328888286742, 0.00222219004176299255934323717554, 0.00222419655225916321206192094451, 0.00222620487451953780536073601581, 0.00222821501018003300179093351119, 0.00223022696087804995351833170503, 0.00223224072825246172557811519255, 0.00223425631394362066844960779122, 0.00223627371959336752535452141899, 0.00223829294684501885551175526246, 0.00224031399734337353935043068986, 0.00224233687273472448789335409458, 0.00224436157466684389760747109221, 0.00224638810478898975561690143365, 0.00224841646475191928380987782532, 0.00225044665620787115792311716689, 0.00225247868081057591588267641214, 0.00225451254021526549878307044139, 0.00225654823607865893941859525285, 0.00225858577005897060221983885242, 0.00226062514381592015791366812039, 0.00226266635901071783837368300851, 0.00226470941730607397759933441250, 0.00226675432036620855269504204443, 0.00226880106985683600503977963569, 0.00227084966744517434758532381522, 0.00227290011479995600687797896455, 0.00227495241359141134318555543814, 0.00227700656549127905883822542421, 0.00227906257217281573920764081720, 0.00228112043531077980651478043228, 0.00228318015658144279553254385462, 0.00228524173766259802720313132340, 0.00228730518023354499612675994058, 0.00228937048597509934522165053750, 0.00229143765656960414142662152415, 0.00229350669370091122742372213850, 0.00229557759905439379838343327833, 0.00229765037431695550926291637950, 0.00229972502117701486229472962464, 0.00230180154132451388060420782722, 0.00230387993645092938391205628079, 0.00230596020824925824338480495612, 0.00230804235841402432052871240842, 0.00231012638864129104393496660919, 0.00231221230062864406204492517816, 0.00231430009607520295253357822673, 0.00231638977668162859488432125943, 0.00231848134415011015996288534780, 0.00232057480018437291627297902608, 0.00232267014648968950565888214044, 0.00232476738477286389711329306351, 0.00232686651674224136143731556103, 0.00232896754410771714485783867588, 0.00233107046858072345860146690200, 0.00233317529187423598410755509747, 0.00233528201570278775081601629893, 0.00233739064178245005420908597671, 0.00233950117183084373151391588408, 0.00234161360756714957004342991809, 0.00234372795071209139364243334569, 0.00234584420298794820575194464141, 0.00234796236611856069462223040034, 0.00235008244182931952392934249474, 0.00235220443184717140430728399281, 0.00235432833790063253745494797897, 0.00235645416171977040153961979740, 0.00235858190503621459321870190706, 0.00236071156958316723598056974254, 0.00236284315709538693395241892858, 0.00236497666930919831287938315256, 0.00236711210796250242846539002528, 0.00236924947479476115386187728973, 0.00237138877154700715432777968772, 0.00237352999996185342820864683233, 0.00237567316178347769442535941664, 0.00237781825875763280081498507457, 0.00237996529263165713247163424171, 0.00238211426515445683083083139309, 0.00238426517807651837041471587497, 0.00238641803314991723244942178894, 0.00238857283212830142499205621220, 0.00239072957676690362599503103525, 0.00239288826882254985692344284587, 0.00239504891005364256920118215533, 0.00239721150222017322095613423016, 0.00239937604708373051695668998207, 0.00240154254640748566346220016499, 0.00240371100195620104184035525918, 0.00240588141549624191795064831467, 0.00240805378879555996227135317156, 0.00241022812362370192351690434407, 0.00241240442175182307274483584081, 0.00241458268495266682035493843728, 0.00241676291500057946123880547873, 0.00241894511367151667999286779320, 0.00242112928274303010681145487126, 0.00242331542399427512374243676163, 0.00242550353920602344143242490304, 0.00242769363016064575189201235617, 0.00242988569864212170315576067026, 0.00243207974643605074130392473819, 0.00243427577532963563058943101680, 0.00243647378711169372914047137613, 0.00243867378357266566257788298344, 0.00244087576650459927782299551779, 0.00244307973770116221984283200186, 0.00244528569895764887054401270916, 0.00244749365207096733834668533802, 0.00244970359883964639707842891880, 0.00245191554106384979744293062254, 0.00245412948054535631770001202767, 0.00245634541908757190672996095770, 0.00245856335849554009237438734203, 0.00246078330057592506788233244208, 0.00246300524713702296761286270055, 0.00246522919998877097433331861964, 0.00246745516094273170670803096982, 0.00246968313181210319395830765643, 0.00247191311441173101892676555735, 0.00247414511055808880243822578393, 0.00247637912206929164740665250122, 0.00247861515076510394509079482361, 0.00248085319846692549730637900041, 0.00248309326699780019004348829981, 0.00248533535818242726916915685820, 0.00248757947384714399319260991206, 0.00248982561581993734264872664141, 0.00249207378593045312739628904808, 0.00249432398600998167514930514699, 0.00249657621789146477037091287343, 0.00249883048340951039942292588591, 0.00250108678440037193388412184447, 0.00250334512270196287569978821352, 0.00250560550015386379607562616911, 0.00250786791859730802400907379024, 0.00251013237987519075358755493710, 0.00251239888583208118705281108873, 0.00251466743831420388652353459236, 0.00251693803916945178442143848940, 0.00251921069024739398972689841116, 0.00252148539339926191019114476433, 0.00252376215047795749227277362081, 0.00252604096333806536420207855542, 0.00252832183383583548874629087777, 0.00253060476382919357155043549312, 0.00253288975517775320420166274005, 0.00253517680974279678227101264554, 0.00253746592938728721469687776846, 0.00253975711597588006684933503720, 0.00254205037137490447857191000480, 0.00254434569745237400620330170398, 0.00254664309607799963300345247319, 0.00254894256912317112087618120597, 0.00255124411846096655134830122336, 0.00255354774596616663703829708254, 0.00255585345351523347129374386100, 0.00255816124298632570702172195354, 0.00256047111625930549558272097954, 0.00256278307521572330796022498589, 0.00256509712173882964414417529042, 0.00256741325771358327306748137175, 0.00256973148502663692113734406064, 0.00257205180556634637953350441819, 0.00257437422122278134622996859093, 0.00257669873388770937980285502533, 0.00257902534545460630777125032864, 0.00258135405781866706861893412395, 0.00258368487287678749719788129369, 0.00258601779252757733515433180571, 0.00258835281867136977190790858572, 0.00259068995321020409741685774918, 0.00259302919804783697788064245060, 0.00259537055508975459880427472115, 0.00259771402624315314935921072959, 0.00260005961341695096544768261992, 0.00260240731852179980540529236066, 0.00260475714347006706908538298251, 0.00260710909017584750724250142184, 0.00260946316055497232883064739895, 0.00261181935652499445585372761514, 0.00261417768000519719698293563681, 0.00261653813291660725798282172150, 0.00261890071718197652711479506138, 0.00262126543472579161611624165573, 0.00262363228747428773798833212538, 0.00262600127735542919135691697363, 0.00262837240629892150353685842390, 0.00263074567623622227255375527477, 0.00263312108910052295254744514352, 0.00263549864682676056315546730957, 0.00263787835135162983257739455212, 0.00264026020461356324825485941687, 0.00264264420855274450097849303631, 0.00264503036511111845954791199631, 0.00264741867623237425721782756227, 0.00264980914386195570003890153998, 0.00265220176994707254256034012485, 0.00265459655643668314059513413383, 0.00265699350528150702796525983729, 0.00265939261843403272275732085461, 0.00266179389784850341585387134558, 0.00266419734548092651191253388276, 0.00266660296328908577243033128923, 0.00266901075323252136642371290520, 0.00267142071727254504925896938516, 0.00267383285737224710154613660507, 0.00267624717549648288503205684208, 0.00267866367361187978149428268182, 0.00268108235368685237157149181542, 0.00268350321769158118440090632362, 0.00268592626759802744276783847965, 0.00268835150537994173672307063327, 0.00269077893301284667634809544268, 0.00269320855247404946850031670635, 0.00269564036574265232515390522394, 0.00269807437479953468248417003394, 0.00270051058162736447657015226298, 0.00270294898821060941909721897503, 0.00270538959653551965012230340335, 0.00270783240859013858009562980556, 0.00271027742636431459924417630702, 0.00271272465184968373033691513285, 0.00271517408703967873598306148608, 0.00271762573392954343010075035636, 0.00272007959451631272859706278666, 0.00272253567079882565979409569934, 0.00272499396477773490540807976856, 0.00272745447845548988699548864645, 0.00272991721383634890901737080071, 0.00273238217292638913349933638131, 0.00273484935773348923279679745235, 0.00273731877026734153265929982979, 0.00273979041253946242057137894221, 0.00274226428656317456483693106861, 0.00274474039435361819028180718760, 0.00274721873792776452236075179769, 0.00274969931930439453679482220139, 0.00275218214050411240367832732545, 0.00275466720354935676318142157015, 0.00275715451046438337831534504119, 0.00275964406327527380854980343372, 0.00276213586400995145600512081785, 0.00276462991469815858036618294591, 0.00276712621737147147771285204954, 0.00276962477406331088886082270051, 0.00277212558680892291740338606587, 0.00277462865764539204013749973399, 0.00277713398861165151540464357538, 0.00277964158174846603585605997466, 0.00278215143909844257047447868558, 0.00278466356270604337500018665708, 0.00278717795461756604261105429998, 0.00278969461688115521330599833050, 0.00279221355154681645169278958463, 0.00279473476066639499662547230230, 0.00279725824629358920531130294762, 0.00279978401048396269637508204653, 0.00280231205529492353317744246510, 0.00280484238278573853528352621822, 0.00280737499501754368680384033041, 0.00280990989405332635547862807357, 0.00281244708195793570101872482780, 0.00281498656079809698657423489010, 0.00281752833264238989469108176422, 0.00282007239956126327246055396358, 0.00282261876362704423881755388948, 0.00282516742691392213834844504561, 0.00282771839149795808227016991054, 0.00283027165945709969357979574056, 0.00283282723287115855564932687116, 0.00283538511382182539105611951413, 0.00283794530439268090360460661259, 0.00284050780666917626268719310190, 0.00284307262273864611371032573572, 0.00284563975469031985379708693529, 0.00284820920461530385087156602708, 0.00285078097460659098463797711531, 0.00285335506675907625909194287317, 0.00285593148316953425111530684433, 0.00285851022593663385562567924580, 0.00286109129716094869391729282881, 0.00286367469894493976642624311069, 0.00286626043339296456002873725311, 0.00286884850261129266055237785338, 0.00287143890870808493609445122274, 0.00287403165379340524640539022982, 0.00287662673997923345331484412668, 0.00287922416937944590509257380972, 0.00288182394410982757951278365738, 0.00288442606628808466059932236192, 0.00288703053803382458930570919620, 0.00288963736146856864026033484549, 0.00289224653871576536587340022777, 0.00289485807190076804493172879518, 0.00289747196315085159615265730793, 0.00290008821459521951707793974151, 0.00290270682836499000628593947226, 0.00290532780659320333596640217877, 0.00290795115141483789811260862734, 0.00291057686496678852047792496194, 0.00291320494938787904332100353599, 0.00291583540681887663087445972110, 0.00291846823940246965362055320270, 0.00292110344928328113239812680035, 0.00292374103860788174882867629378, 0.00292638100952476989599637668960, 0.00292902336418438295415067607053, 0.00293166810473911246953671039250, 0.00293431523334328073562837779775, 0.00293696475215315640563962240606, 0.00293961666332696576822702816401, 0.00294227096902487323185071410592, 0.00294492767140899346783866619148, 0.00294758677264340398713193813762, 0.00295024827489412562464554667940, 0.00295291218032913554969454139609, 0.00295557849111837854169659856041, 0.00295824720943374877557552338203, 0.00296091833744910109746384385687, 0.00296359187734026316776714260470, 0.00296626783128501768024842810689, 0.00296894620146311363773072855565, 0.00297162699005627849516142369168, 0.00297431019924819907765400905930, 0.00297699583122453415723329683829, 0.00297968388817292659589974768153, 0.00298237437228298339630949698176, 0.00298506728574629001324303168019, 0.00298776263075641989458430813897, 0.00299046040950891756776686136732, 0.00299316062420130948179552987654, 0.00299586327703311701767252550610, 0.00299856837020583740643919767876, 0.00300127590592295500487862724981, 0.00300398588638995473962256532729, 0.00300669831381430302519319752719, 0.00300941319040545773866313084000, 0.00301213051837488426584754641624, 0.00301485029993603338357988086216, 0.00301757253730435427013789606576, 0.00302029723269730751566974902289, 0.00302302438833434560655488709813, 0.00302575400643692376742577287985, 0.00302848608922851557367916797148, 0.00303122063893458996639007629881, 0.00303395765778262643114215890705, 0.00303669714800212627373032781009, 0.00303943911182459223715990326298, 0.00304218355148354324679615956484, 0.00304493046921452525238604991387, 0.00304767986725509171241910166827, 0.00305043174784481703823435516654, 0.00305318611322530786972295757664, 0.00305594296564018486073166513961, 0.00305870230733509438844630601295, 0.00306146414055772069645611210831, 0.00306422846755776724647635234078, 0.00306699529058696886141266446657, 0.00306976461189910430210625591485, 0.00307253643374997675169479904866, 0.00307531075839742552499589400838, 0.00307808758810134081365661451457, 0.00308086692512364113474832016948, 0.00308364877172828764223533326572, 0.00308643313018129800476274660070, 0.00308922000275072298688949778978, 0.00309200939170666249528052205164, 0.00309480129932127685440934605765, 0.00309759572786876729091898319268, 0.00310039267962538851036713438702, 0.00310319215686946084029051995401, 0.00310599416188135158192751283934, 0.00310879869694348715328247045875, 0.00311160576434036523219006653562, 0.00311441536635853524067618636195, 0.00311722750528661178906486561857, 0.00312004218341528725272349120701, 0.00312285940303731052170022053360, 0.00312567916644750044483092032976, 0.00312850147594276057488871245482, 0.00313132633382205574981704820914, 0.00313415374238642727156012313117, 0.00313698370393900591648894682351, 0.00313981622078498938399615525441, 0.00314265129523165834268816354324, 0.00314548892958838727240689081555, 0.00314832912616662494859065546393, 0.00315117188727990658533850698575, 0.00315401721524386858055977178594, 0.00315686511237622639824973447276, 0.00315971558099678801259657667799, 0.00316256862342746821945005386567, 0.00316542424199226651859717662774, 0.00316828243901728055786914950431, 0.00317114321683072044461004779237, 0.00317400657776288619427162984721, 0.00317687252414618290924375187956, 0.00317974105831513248823783079899, 0.00318261218260635324328600148647, 0.00318548589935857421120979360296, 0.00318836221091264642932272543874, 0.00319124111961152428715293716266, 0.00319412262780027680214578467144, 0.00319700673782610236481338539249, 0.00319989345203830748837203756807, 0.00320278277278831895180655209288, 0.00320567470242969984606240529956, 0.00320856924331812528791707528342, 0.00321146639781139846617219468783, 0.00321436616826946278471788254194, 0.00321726855705438061217016354476, 0.00322017356653034802702051386802, 0.00322308119906370652701932399964, 0.00322599145702292307985592501041, 0.00322890434277860313358465838007, 0.00323181985870350449441268381179, 0.00323473800717251564265652952201, 0.00323765879056266917684903106078, 0.00324058221125315655888887711455, 0.00324350827162530426159281482512, 0.00324643697406259068224954056348, 0.00324936832095065698464142478485, 0.00325230231467728758340540728966, 0.00325523895763242141973559107271, 0.00325817825220816887493713309709, 0.00326112020079878791797844961309, 0.00326406480580069754959815497841, 0.00326701206961249341481634544948, 0.00326996199463492481784854248872, 0.00327291458327090859989350057901, 0.00327586983792554388428275302658, 0.00327882776100608865771368627406, 0.00328178835492197494907995469759, 0.00328475162208482227357841942705, 0.00328771756490841594866569863598, 0.00329068618580872010448423736761, 0.00329365748720389329637359132619, 0.00329663147151426465242263219579, 0.00329960814116234905229996243747, 0.00330258749857286187240346109206, 0.00330556954617269339868901312229, 0.00330855428639092790862874515767, 0.00331154172165885277850927437271, 0.00331453185440994070251607972466, 0.00331752468707986010107435781435, 0.00332052022210649116704117567167, 0.00332351846192990374798115205124, 0.00332651940899237035659252725850, 0.00332952306573838134953757794676, 0.00333252943461462150867569143031, 0.00333553851806998565357464947567, 0.00333855031855559165193669812766, 0.00334156483852475743451249101668, 0.00334458208043301834233584912681, 0.00334760204673813666770287866825, 0.00335062473990008387325634231502, 0.00335365016238105056664564607161, 0.00335667831664546471512333702947, 0.00335970920515996605837383270909, 0.00336274283039342172102470485129, 0.00336577919481694139147709421422, 0.00336881830090385173473443991554, 0.00337186015112971504067984618302, 0.00337490474797233919873606922124, 0.00337795209391175818222641247246, 0.00338100219143024462511992744851, 0.00338405504301232630190443551044, 0.00338711065114476010673438821641, 0.00339016901831654940066562708978, 0.00339323014701895745576232243934, 0.00339629403974548403633004767244, 0.00339936069899188057774619409201, 0.00340243012725616493160951669950, 0.00340550232703859751329233951367, 0.00340857730084169604709010137356, 0.00341165505117025204609437771808, 0.00341473558053130349029813395134, 0.00341781889143415477591569917593, 0.00342090498639038712372362205372, 0.00342399386791383689501722109583, 0.00342708553852061120412186845385, 0.00343018000072910049513819075173, 0.00343327725705995815894122635825, 0.00343637731003611180888301923630, 0.00343948016218278106170824770516, 0.00344258581602745238406382277674, 0.00344569427409989470501017194692, 0.00344880553893217329380904700997, 0.00345191961305862850956094334265, 0.00345503649901588707690769375347, 0.00345815619934288030062896623917, 0.00346127871658081891215186232102, 0.00346440405327320781470046284767, 0.00346753221196586169580711178639, 0.00347066319520688117486462154204, 0.00347379700554666798195668775406, 0.00347693364553793840196482811677, 0.00348007311773570202420580166347, 0.00348321542469727475285767859248, 0.00348636056898229485315199305262, 0.00348950855315269909892594846212, 0.00349265937977273665041022532307, 0.00349581305140898640146374098947, 0.00349896957063033009135977202675, 0.00350212894000797051938245196823, 0.00350529116211544368789110315277, 0.00350845623952859798563852500308, 0.00351162417482560589715445686920, 0.00351479497058698265102294477913, 0.00351796862939555889798759480414, 0.00352114515383649849186720182104, 0.00352432454649731236734355732665, 0.00352750680996783425383278576248, 0.00353069194684023672167749730022, 0.00353387995970904679465807163297, 0.00353707085117111949545964932895, 0.00354026462382565562658776059379, 0.00354346128027421651551787107337, 0.00354666082312069799384324220171, 0.00354986325497134861187142895744, 0.00355306857843478221536948069570, 0.00355627679612195582783962244378, 0.00355948791064618309462619372141, 0.00356270192462315119646953931465, 0.00356591884067089526233473861794, 0.00356913866140981528296549640800, 0.00357236138946268998867195065827, 0.00357558702745465343056374685204, 0.00357881557801320885833784579688, 0.00358204704376824693487502138112, 0.00358528142735201884802598293334, 0.00358851873139915192312265901364, 0.00359175895854666740389382617593, 0.00359500211143395269688949333897, 0.00359824819270277871871566155448, 0.00360149720499731637590734578680, 0.00360474915096410880935295928396, 0.00360800403325209004257168032836, 0.00361126185451259929318212904548, 0.00361452261739935625309283473428, 0.00361778632456847670101351965855, 0.00362105297867848724760464484973, 0.00362432258239030365143396039684, 0.00362759513836724296204083728412, 0.00363087064927503999980928917068, 0.00363414911778182393720104670365, 0.00363743054655813347758597231518, 0.00364071493827693160039160602537, 0.00364400229561358127497450176691, 0.00364729262124586107313151117637, 0.00365058591785398164897280537389, 0.00365388218812055885070799732262, 0.00365718143473063280260437757363, 0.00366048366037167961437037710937, 0.00366378886773358969711211763354, 0.00366709705950868164112121938558, 0.00367040823839171912942869191454, 0.00367372240707988535063366342115, 0.00367703956827279817773379555490, 0.00368035972467252838272178117052, 0.00368368287898357057996712171644, 0.00368700903391286360921696996229, 0.00369033819216980311234133083076, 0.00369367035646621681352352872807, 0.00369700552951638273385670530047, 0.00370034371403704220176988926028, 0.00370368491274737643426107069899, 0.00370702912836902128204674689016, 0.00371037636362608457679668205742, 0.00371372662124511967660089872822, 0.00371707990395514194584269951349, 0.00372043621448764480139081989307, 0.00372379555557657412542815755785, 0.00372715792995834474532479418940, 0.00373052334037185517878754126286, 0.00373389178955846378141214536583, 0.00373726328026200522655630997804, 0.00374063781522880351576576529737, 0.00374401539720764986104994953564, 0.00374739602894981743003155472138, 0.00375077971320907695845781049115, 0.00375416645274167289775268940843, 0.00375755625030633685912384578387, 0.00376094910866430669552085142016, 0.00376434503057929831237871098892, 0.00376774401881752474957609777562, 0.00377114607614770919186142350554, 0.00377455120534106198376678165118, 0.00377795940917129450739575524665, 0.00378137069041463739701991464415, 0.00378478505184981495190754685609, 0.00378820249625805814674972538114, 0.00379162302642312588202289092010, 0.00379504664513127462632802178177, 0.00379847335517127749834886962788, 0.00380190315933443987936324326427, 0.00380533606041457339239086898885, 0.00380877206120801238206641237127, 0.00381221116451362952715076204413, 0.00381565337313281155440236602772, 0.00381909868986947398372677753287, 0.00382254711753007847541141472902, 0.00382599865892360724295429008635, 0.00382945331686157779821355617855, 0.00383291109415806116600400343941, 0.00383637199362965499588318252222, 0.00383983601809550004202442607948, 0.00384330317037729664308987054255, 0.00384677345329927870137831646957, 0.00385024686968823103005998831350, 0.00385372342237350453200694921918, 0.00385720311418699017894096137127, 0.00386068594796313722602998375066, 0.00386417192653896665599511095479, 0.00386766105275404906138625449330, 0.00387115332945051678764647462572, 0.00387464875947308474979369208313, 0.00387814734566902094212159646247, 0.00388164909088816421911527498878, 0.00388515399798294207636684127749, 0.00388866206980834202763808171710, 0.00389217330922193068681869121406, 0.00389568771908386764571408100721, 0.00389920530225688248895932197513, 0.00390272606160628780444521446213, 0.00390625000000000000000000000000, 0.00390977712030850590996244875441, 0.00391330742540489835701311704952, 0.00391684091816485360076915966943, 0.00392037760146665085342343459729, 0.00392391747819117141238276502690, 0.00392746055122188564984186953666, 0.00393100682344488076835897771844, 0.00393455629774884432098280839796, 0.00393810897702506854806125957680, 0.00394166486416746252030574027003, 0.00394522396207254780198248056422, 0.00394878627363945498146557966379, 0.00395235180176993928374828968231, 0.00395592054936837623363432570045, 0.00395949251934175558420569984719, 0.00396306771459970126614269503307, 0.00396664613805446184674474707776, 0.00397022779262091052993044471009, 0.00397381268121655816666359939404, 0.00397740080676155065286803136360, 0.00398099217217866372525714169228, 0.00398458678039331857384519608445, 0.00398818463433357837250037292165, 0.00399178573693014307477433533222, 0.00399539009111636589377525297095, 0.00399899769982824809799737408866, 0.00400260856600443640923581156699, 0.00400622269258623601301261274443, 0.00400984008251760969121502142798, 0.00401346073874517088320157398584, 0.00401708466421820016567512112715, 0.00402071186188864178323587594832, 0.00402434233471109757684924801424, 0.00402797608564284606580407910315, 0.00403161311764383377409526332258, 0.00403525343367667349570027113259, 0.00403889703670666164181390911381, 0.00404254392970177043459267807179, 0.00404619411563264530506955907185, 0.00404984759747262137302703521868, 0.00405350437819771824282666372596, 0.00405716446078663566660038597433, 0.00406082784822077089148528727947, 0.00406449454348421172072969298483, 0.00406816454956373477896969248491, 0.00407183786944881939001694703961, 0.00407551450613164497477347580912, 0.00407919446260708497969948993500, 0.00408287774187272595877162828515, 0.00408656434692885803250383958130, 0.00409025428077847575530912038744, 0.00409394754642729199328732292429, 0.00409764414688373358741646512726, 0.00410134408515893441465882673924, 0.00410504736426675793936613700907, 0.00410875398722378767230045681913, 0.00411246395704932196646375075488, 0.00411617727676539396641786083819, 0.00411989394939676727147581658528, 0.00412361397797092639472271713430, 0.00412733736551809844705918095542, 0.00413106411507124706566917993200, 0.00413479422966606547512613545337, 0.00413852771234099643671289214808, 0.00414226456613722617688955196513, 0.00414600479409868005048478423191, 0.00414974839927203815320710944547, 0.00415349538470673185219794731893, 0.00415724575345493944922292683941, 0.00416099950857160179318317005936, 0.00416475665311441881066834014291, 0.00416851719014384256706273745863, 0.00417228112272309721586527331283, 0.00417604845391817292715730403074, 0.00417981918679781981607046503768, 0.00418359332443356702474490660393, 0.00418737086989971751815886591430, 0.00419115182627334201259650114935, 0.00419493619663429719024438924180, 0.00419872398406522136238283593457, 0.00420251519165152753049197187352, 0.00420630982248142333557172634073, 0.00421010787964590411924792334730, 0.00421390936623874945432532967970, 0.00421771428535653875729893869106, 0.00422152264009864868626875633595, 0.00422533443356724706940763525154, 0.00422914966886730851747255854889, 0.00423296834910661355644290182454, 0.00423679047739573908654131528806, 0.00424061605684808093363891146055, 0.00424444509057984257355267132539, 0.00424827758171003773413065829345, 0.00425211353336050080359287406395, 0.00425595294865588683053125862443, 0.00425979583072366285029231036674, 0.00426364218269412956902053579711, 0.00426749200770041269004106965212, 0.00427134530887846031177446093352, 0.00427520208936705854024795669943, 0.00427906235230782975437202608759, 0.00428292610084522219759950445450, 0.00428679333812653339669251906230, 0.00429066406730190235546684718315, 0.00429453829152430435062148816883, 0.00429841601394957001369689919557, 0.00430229723773637839218109135686, 0.00430618196604625348006267770984, 0.00431007020204358243242737103174, 0.00431396194889560775920234192427, 0.00431785720977242645779448082521, 0.00432175598784700389087820582290, 0.00432565828629517205167198667937, 0.00432956410829562002295922695794, 0.00433347345702991739585518971012, 0.00433738633568250559618961759156, 0.00434130274744069354769804292005, 0.00434522269549467675398002342035, 0.00434914618303753035960523831704, 0.00435307321326520481330479839244, 0.00435700378937654494992948173149, 0.00436093791457328391891756780296, 0.00436487559206003624540093355222, 0.00436881682504431951424850311128, 0.00437276161673654829853408188001, 0.00437670997035002635328071463050, 0.00438066188910096743214239722874, 0.00438461737620848921587191071580, 0.00438857643489460897551213136580, 0.00439253906838425918490731447719, 0.00439650527990528752070309437272, 0.00440047507268844471928215256185, 0.00440444844996740973025461940438, 0.00440842541497877844075548026126, 0.00441240597096206280808283750616, 0.00441639012115970907429440828196, 0.00442037786881708909259014461668, 0.00442436921718249685786528146991, 0.00442836416950717019075378644288, 0.00443236272904527946192576592921, 0.00443636489905392759208746511490, 0.00444037068279316566449255176963, 0.00444438008352598772077168831629, 0.00444839310451832642412384188901, 0.00445240974903907300863625806642, 0.00445643002036006860566708098759, 0.00446045392175609990703666341005, 0.00446448145650492084907101641988, 0.00446851262788724393898442954765, 0.00447254743918673505070904283798, 0.00447658589369003424157655857130, 0.00448062799468674968078607534494, 0.00448467374546944897578670818916, 0.00448872314933368519312972821922, 0.00449277620957798211331901683252, 0.00449683292950383856761975565064, 0.00450089331241573971376102036857, 0.00450495736162115443385056678949, 0.00450902508043053099756614088278, 0.00451309647215731527675197654048, 0.00451717154011794380652489167005, 0.00452125028763184031582733624077, 0.00452533271802143220730041406341, 0.00452941883461215055728388279022, 0.00453350864073241710539008408887, 0.00453760213971366940799434530618, 0.00454169933489035129725586159566, 0.00454580022959991201375595792911, 0.00454990482718282008428589691107, 0.00455401313098256071976166481363, 0.00455812514434563147841528163440, 0.00456224087062155701094434689935, 0.00456636031316288819315030167445, 0.00457048347532519605440626264681, 0.00457461036046708739016830591595, 0.00457874097195020215989025302861, 0.00458287531313920828285324304829, 0.00458701338740181898540049232338, 0.00459115519810879019885208052187, 0.00459530074863391101852583275900, 0.00459945004235402625514250729566, 0.00460360308264903036329362961965, 0.00460775987290185876782411256158, 0.00461192041649851388468439594703, 0.00461608471682805211050437677045, 0.00462025277728258208786993321837, 0.00462442460125728552200463639110, 0.00462860019215040850715237041868, 0.00463277955336325718976864251886, 0.00463696268830021685047881874198, 0.00464114960036874843463117201736, 0.00464534029297937901131776428088, 0.00464953476954572519214137216181, 0.00465373303348448532495984508728, 0.00465793508821543428971567735175, 0.00466214093716144344775598185038, 0.00466635058374847543766206214855, 0.00467056403140557550163203259785, 0.00467478128356489750633295798821, 0.00467900234366169006511304573337, 0.00468322721513429914008685983617, 0.00468745590142418018519965272617, 0.00469168840597589901358910324802, 0.00469592473223712138924446080068, 0.00470016488365863557841173303586, 0.00470440886369434541069978195083, 0.00470865667580126507490989595794, 0.00471290832343953733363228764119, 0.00471716381007243178852261777934, 0.00472142313916633447196113948507, 0.00472568631419077039845788590355, 0.00472995333861839922784398027034, 0.00473422421592500485693078005056, 0.00473849894958951970563854061425, 0.00474277754309401691074077334065, 0.00474705999992370685641729366466, 0.00475134632356695191940376687967, 0.00475563651751526820371518411434, 0.00475993058526331426494326848342, 0.00476422853030891105957644882096, 0.00476853035615303934291464571515, 0.00477283606629983446489884357788, 0.00477714566425660024789889845920, 0.00478145915353381072143701402410, 0.00478577653764509971384688569174, 0.00479009782010728166895541235704, 0.00479442300444034904399748242554, 0.00479875209416746103391337996413, 0.00480308509281496785747744837636, 0.00480742200391240468576592448358, 0.00481176283099248383590129662934, 0.00481610757759111645509575438950, 0.00482045624724740731648076064175, 0.00482480884350364614548967168162, 0.00482916536990533103862466290934, 0.00483352583000116152456282492267, 0.00483789022734303335998573558641, 0.00484225856548605674417595778891, 0.00484663084798855284957008748847, 0.00485100707841204688286484980608, 0.00485538726032128890169881074712, 0.00485977139728424600839673530572, 0.00486415949287210148260784947638, 0.00486855155065926865909364806839, 0.00487294757422339092772789470587, 0.00487734756714533132515576596688, 0.00488175153300919595356077707038, 0.00488615947540232704177087796893, 0.00489057139791529774108802541832, 0.00489498730414193120724641872243, 0.00489940719767929626360380979122, 0.00490383108212769959488586124507, 0.00490825896109070916595307210173, 0.00491269083817514641554513588062, 0.00491712671699108018474877468407, 0.00492156660115184753367945091895, 0.00492601049427404940467267735471, 0.00493045839997754194866663723928, 0.00493491032188545994396910998603, 0.00493936626362420985736356726648, 0.00494382622882346203785353111471, 0.00494829022111617500279123760265, 0.00495275824413858589689851896765, 0.00495723030153020789018158964723, 0.00496170639693384839252754403560, 0.00496618653399560384953392855323, 0.00497067071636485453833831371639, 0.00497515894769428451693826787050, 0.00497965123163987728738266724804, 0.00498414757186090625479257809616, 0.00498864797201995988085165834036, 0.00499315243578293301018877770048, 0.00499766096681902079884585177183, 0.00500217356880074126568302972373, 0.00500669024540392922084652838066, 0.00501121100030772759215125233823, 0.00501573583719461257857119562686, 0.00502026475975038497662206182781, 0.00502479777166416237410562217747, 0.00502933487662840517096185521950, 0.00503387607833890703828982893242, 0.00503842138049478797945379682233, 0.00504297078679852121829707556344, 0.00504752430095591845399249919524, 0.00505208192667613072840415711084, 0.00505664366767166750804562980193, 0.00506120952765839061254782293986, 0.00506577951035550640840332548009, 0.00507035361948559009509507333746, 0.00507493185877457789884070749054, 0.00507951423195176013369867007441, 0.00508410074274980548769686805599, 0.00508869139490475148185355536157, 0.00509328619215599926600690494638, 0.00509788513824633877230541045833, 0.00510248823692193657214355440033, 0.00510709549193233327407659416508, 0.00511170690703046434050227375678, 0.00511632248597265488349039586069, 0.00512094223251861099116544195908, 0.00512556615043144401383523600657, 0.00513019424347766189037356454605, 0.00513482651542716654613496274351, 0.00513946297005327124018947415607, 0.00514410361113269536115222280159, 0.00514874844244556269245993718187, 0.00515339746777541615752049608545, 0.00515805069090921608498945261090, 0.00516270811563733413723786824789, 0.00516736974575357152494881063376, 0.00517203558505515813975561556504, 0.00517670563734273954381581717143, 0.00518137990642040472538676354475, 0.00518605839609567742520823685481, 0.00519074111017950919760854944229, 0.00519542805248630282927146950556, 0.00520011922683390453298057920506, 0.00520481463704359961081058472132, 0.00520951428694013153608555199980, 0.00521421818035169761657021680890, 0.00521892632110994465766129479789, 0.00522363871304998544226050327666, 0.00522835536001039786341282322724, 0.00523307626583321451596564344300, 0.00523780143436394958478263816914, 0.00524253086945158583431769727667, 0.00524726457494857547597666425077, 0.00525200255471085491326688199365, 0.00525674481259784647652066880141, 0.00526149135247244454510751054954, 0.00526624217820104243564793833343, 0.00527099729365352459575788657276, 0.00527575670270325966515478910424, 0.00528052040922712302706276688014, 0.00528528841710549247140393802624, 0.00529006073022223691909582399262, 0.00529483735246474591235044115933, 0.00529961828772391486952475503358, 0.00530440353989414508512068024970, 0.00530919311287336367910505430245, 0.00531398701056301752537747162819, 0.00531878523686806544551464170922, 0.00532358779569700422962252872594, 0.00532839469096185649327201971914, 0.00533320592657817154486066257846, 0.00533802150646503926340047385679, 0.00534284143454509270060315273554, 0.00534766571474449420309227321013, 0.00535249435099296230061716173054, 0.00535732734722376303243551731725, 0.00536216470737370474314298363083, 0.00536700643538315976671659868202, 0.00537185253519605835498262891292, 0.00537670301075988347344614126655, 0.00538155786602568988324923893174, 0.00538641710494810240644758536632, 0.00539128073148530465030781044788, 0.00539614874959906676288312610268, 0.00540102116325473242258725647957, 0.00540589797642121883819443795005, 0.00541077919307103583079765485309, 0.00541566481718028062963821156472, 0.00542055485272862919848835261405, 0.00542544930369936399122687831209, 0.00543034817407936094141307492578, 0.00543525146785908686020150071272, 0.00544015918903262285510891160811, 0.00544507134159765478903514335229, 0.00544998792955546981081615953713, 0.00545490895691097630454402533928, 0.00545983442767270128748169355504, 0.00546476434585277826699867276261, 0.00546969871546697499614664295109, 0.00547463754053468653476555161319, 0.00547958082507892484114275788443, 0.00548452857312634566022691018361, 0.00548948078870723985001056632882, 0.00549443747585552904472150359538, 0.00549939863860878560414269244916, 0.00550436428100822740944186861611, 0.00550933440709871352636284314030, 0.00551430902092876328718373812876, 0.00551928812655055108654655882106, 0.00552427172801990291201024163570, 0.00552925982939631369128541393820, 0.00553425243474294642487265605268, 0.00553924954812662177772164540102, 0.00554425117361784236535982017813, 0.00554925731529078754972195142159, 0.00555426797722330303080928715076, 0.00555928316349692860226516799571, 0.00556430287819688861039590932478, 0.00556932712541208675000037331415, 0.00557435590923512861577515664635, 0.00557938923376231389605894861461, 0.00558442710309363290338557916925, 0.00558946952133278652380399265098, 0.00559451649258718188006955784886, 0.00559956802096792539275016409306, 0.00560462411058984359690793297659, 0.00560968476557148054001400439006, 0.00561474999003508737360768066083, 0.00561981978810664924151030419353, 0.00562489416391587487148440160922, 0.00562997312159619397314846978020, 0.00563505666528477631993521157483, 0.00564014479912253001436805988078, 0.00564523752725408847763510777895, 0.00565033485382784080724993813760, 0.00565543678299591963398729177470, 0.00566054331891419938715959148112, 0.00566565446574231364185170178871, 0.00567077022764365425155919098188, 0.00567589060878536180720921322518, 0.00568101561333834905592743425018, 0.00568614524547729569686760342506, 0.00569127950938063970759417387058, 0.00569641840923060423229618010055, 0.00570156194921318543872290618424, 0.00570671013351815251818388574634, 0.00571186296633906503278366173504, 0.00571702045187327118069831044522, 0.00572218259432189738783458565763, 0.00572734939788987606340553426776, 0.00573252086678593258950442645983, 0.00573769700522258532110475570676, 0.00574287781741616640274195049187, 0.00574806330758681396225773241326, 0.00575325347995846690662968825336, 0.00575844833875888834073819566584, 0.00576364788821965862847251926837, 0.00576885213257616932119864472384, 0.00577406107606764570916446643878, 0.00577927472293714074996762164460, 0.00578449307743153073174680045554, 0.00578971614380153262041650563674, 0.00579494392630170666175226656947, 0.00580017642919043903415587948302, 0.00580541365672997654312492699091, 0.00581065561318641100874149429956, 0.00581590230282967579622521725469, 0.00582115372993357357150889797026, 0.00582640989877576155608895902560, 0.00583167081363775326174891944220, 0.00583693647880493497043241646338, 0.00584220689856656573424320555432, 0.00584748207721576349765735258757, 0.00585276201904953632254580142558, 0.00585804672836877024511004208307, 0.00586333620947822493907342078501, 0.00586863046668655800180980364189, 0.00587392950430631628072619676573, 0.00587923332665393153645405632801, 0.00588454193804974299425447625822, 0.00588985534281799040512428433658, 0.00589517354528680797426387627524, 0.00590049654978824777984414140519, 0.00590582436065827456883603474580, 0.00591115698223675708339319712081, 0.00591649441886749408170409481045, 0.00592183667489820566437463966736, 0.00592718375468052633553428520941, 0.00593253566257003189104990426017, 0.00593789240292623074490840906492, 0.00594325398011255699032284738337, 0.00594862039849639468586106616499, 0.00595399166244907178391354563018, 0.00595936777634585319179949536306, 0.00596474874456596332317204200990, 0.00597013457149258349593301531399, 0.00597552526151283978916861627795, 0.00598092081901783166608677078102, 0.00598632124840262243303801170669, 0.00599172655406623403534505101220, 0.00599713674041167134343144340392, 0.00600255181184591347920420645323, 0.00600797177277990947924513065459, 0.00601339662762860258093944310076, 0.00601882638081091894677321363361, 0.00602426103674976853169509283248, 0.00602970059987206329771280977070, 0.00603514507460871200972274408514, 0.00604059446539461503133949804578, 0.00604604877666868774366282224264, 0.00605150801287385100429849771331, 0.00605697217845703114735833594295, 0.00606244127786917646333320064400, 0.00606791531556525633173126976772, 0.00607339429600425254746065562017, 0.00607887822364918100487285457234, 0.00608436710296708996303927108329, 0.00608986093842905050477209982773, 0.00609535973451017995539125138293, 0.00610086349568963754591566228669, 0.00610637222645061573944591515328, 0.00611188593128036625201637832561, 0.00611740461467019224633956397952, 0.00612292828111544139291222421662, 0.00612845693511553015614401473954, 0.00613399058117394119227228088675, 0.00613952922379820860421251182970, 0.00614507286749994916658090815531, 0.00615062151679485538680047795879, 0.00615617517620268162731322902914, 0.00616173385024727880004968838534, 0.00616729754345657962127935647345, 0.00617286626036259600952549320141, 0.00617844000550144163697030563753, 0.00618401878341332846000799605690, 0.00618960259864255370881869211530, 0.00619519145573753111239101443175, 0.00620078535925078049018122072766, 0.00620638431373892168058103990802, 0.00621198832376269969440807372507, 0.00621759739388697777601189287111, 0.00622321152868073046438013307124, 0.00622883073271706701190542077029, 0.00623445501057322791493842117916, 0.00624008436683057450544698241401, 0.00624571880607461670659175112519, 0.00625135833289500435910879261314, 0.00625700295188552114977742490964, 0.00626265266764410716282540647626, 0.00626830748477285801256719821595, 0.00627396740787801183297789364701, 0.00627963244156997529854535855520, 0.00628530259046332015482327904010, 0.00629097785917677454481378163109, 0.00629665825233324556037262098585, 0.00630234377455981664012396592511, 0.00630803443048773716111954357189, 0.00631373022475244845969077900349, 0.00631943116199357949464010530960, 0.00632513724685493643890010773134, 0.00633084848398452956774740130186, 0.00633656487803456545254698895064, 0.00634228643366144088922009558473, 0.00634801315552576891909630774080, 0.00635374504829236928793445571273, 0.00635948211663026497647566159799, 0.00636522436521270301712505101932, 0.00637097179871715189186653915954, 0.00637672442182529285864545087748, 0.00638248223922304510485892237170, 0.00638824525560055794110025928489, 0.00639401347565220472962677078499, 0.00639978690407661063993538519412, 0.00640556554557664224042179412777, 0.00641134940485939969212481059913, 0.00641713848663624623902546062482, 0.00642293279562280040179134132927, 0.00642873233653892556943576508388, 0.00643453711410875775489337513591, 0.00644034713306069952348797968966, 0.00644616239812741305403864799928, 0.00645198291404584269026489806720, 0.00645780868555721060397800670216, 0.00646363971740700898882536762358, 0.00646947601434502781586610709041, 0.00647531758112534269050675206358, 0.00648116442250631311777775422911, 0.00648701654325060505373867769663, 0.00649287394812518570130777106897, 0.00649873664190131396928284956971, 0.00650460462935457083000212463730, 0.00651047791526484717627987208743, 0.00651635650441633774987426619418, 0.00652224040159757149914820928416, 0.00652812961160139856864326191044, 0.00653402413922498682963269089896, 0.00653992398926984529888839503542, 0.00654582916654182153659569110005, 0.00655173967585108776856550605316, 0.00655765552201217384598042059451, 0.00656357670984395423496859933721, 0.00656950324416964454715683885411, 0.00657543512981682756052270732994, 0.00658137237161744454577716467725, 0.00658731497440778659274718265237, 0.00659326294302852496803657444957, 0.00659921628232470244140861481696, 0.00660517499714572374480692218413, 0.00661113909234538332793107429097, 0.00661710857278185928670444226896, 0.00662308344331770555701854874542, 0.00662906370881987706822346950730, 0.00663504937415972367159566758232, 0.00664104044421298233408235134334, 0.00664703692385980315915361416046, 0.00665303881798474504999374445902, 0.00665904613147676269907515589352, 0.00666505886922923954790443090701, 0.00667107703613997564395798889336, 0.00667710063711118330387339625531, 0.00668312967704951139957803007974, 0.00668916416086604102148038819564, 0.00669520409347627333540575733650, 0.00670124947980016340970399468802, 0.00670730032476210547009998208523, 0.00671335663329092943024667405894, 0.00671941841031992777993897547617, 0.00672548566078684777885809964459, 0.00673155838963388278295418842845, 0.00673763660180769913266018988907, 0.00674372030225943355080664431966, 0.00674980949594467839747213844248, 0.00675590418782351202764413500290, 0.00676200438286049358704854483904, 0.00676811008602465260380887102087, 0.00677422130228951587666008649080, 0.00678033803663310313813994412158, 0.00678646029403791491152464487868, 0.00679258807949096373585140540285, 0.00679872139798376549230107812605, 0.00680486025451232986321903339899, 0.00681100465407719068977598908532, 0.00681715460168339643098889268913, 0.00682331010234050409218875543615, 0.00682947116106260351114931594907, 0.00683563778286831388864008829387, 0.00684180997278077424744724410743, 0.00684798773582766945322575224964, 0.00685417107704122587769068886132, 0.00686036000145820099027638150346, 0.00686655451411991198107376277449, 0.00687275462007222795457472841463, 0.00687896032436556212341649541031, 0.00688517163205490043131895561146, 0.00689138854819979287946729584746, 0.00689761107786434658761809401994, 0.00690383922611725268231319674328, 0.00691007299803177849062407744896, 0.00691631239868576060125793247835, 0.00692255743316163348749503470003, 0.00692880810654641996620961563735, 0.00693506442393172339161422357279, 0.00694132639041375888028229113047, 0.00694759401109334030072206545015, 0.00695386729107587680392965623355, 0.00696014623547139971160291338492, 0.00696643084939455384252404712697, 0.00697272113796458970630398610524, 0.00697901710630539386104320698223, 0.00698531875954547763762914058816, 0.00699162610281797280292748197894, 0.00699793914126065584591085411148, 0.00700425788001594537557359387847, 0.00701058232423088737578220630553, 0.00701691247905719163446836006415, 0.00702324834965121613111760368042, 0.00702958994117396530204588955826, 0.00703593725879111345916649966625, 0.00704229030767300132054309358409, 0.00704864909299462473468711465330, 0.00705501361993566417085688158295, 0.00706138389368047778016368454246, 0.00706775991941809358931614326593, 0.00707414170234223465411060871588, 0.00708052924765131558998421112960, 0.00708692256054843303103574214674, 0.00709332164624139165087779446139, 0.00709972650994270156055154785690, 0.00710613715686956443073896139140, 0.00711255359224390731887055494553, 0.00711897582129237052606107738484, 0.00712540384924630239293907862930, 0.00713183768134178618786078729386, 0.00713827732281963490273968275801, 0.00714472277892537997734390131654, 0.00715117405490930252431880376207, 0.00715763115602642205348438153578, 0.00716409408753649386975004276223, 0.00717056285470403335924327592465, 0.00717703746279830905041574595771, 0.00718351791709333480778765235186, 0.00719000422286790105697029673593, 0.00719649638540556264160175103939, 0.00720299440999463275181469157360, 0.00720949830192821328189722862589, 0.00721600806650418442195205059875, 0.00722252370902519858636425809095, 0.00722904523479870816937697952653, 0.00723557264913695773883572925911, 0.00724210595735697449520928969946, 0.00724864516478060296605923085167, 0.00725519027673449026089036451026, 0.00726174129855007999961857834137, 0.00726829823556364353759340346528, 0.00727486109311627215934237256079, 0.00728142987655386320078321205074, 0.00728800459122715821314031359179, 0.00729458524249172648307171229476, 0.00730117183570796329794561074777, 0.00730776437624111336460730470321, 0.00731436286946126994201744508928, 0.00732096732074335922874075421873, 0.00732757773546717419005380733665, 0.00733419411901736761905112871318, 0.00734081647678343825885738382908, 0.00734744481415976549709689891188, 0.00735407913654560155963801904022, 0.00736071944934505676544356234103, 0.00736736575796713682312555349085, 0.00737401806782573155524262986660, 0.00738067638433960622468266166152, 0.00738734071293242929023836751412, 0.00739401105903276980452210054295, 0.00740068742807408440353977852055, 0.00740736982549474766435171346757, 0.00741405825673804690090218372234, 0.00742075272725216915359336411484, 0.00742745324249023501639310751443, 0.00743415980791028822849408896900, 0.00744087242897528960278163978614, 0.00744759111115314391404762517368, 0.00745431585991669382745827832082, 0.00746104668074371035757508252573, 0.00746778357911692322601560078965, 0.00747452656052401478992130989809, 0.00748127563045760703153153059475, 0.00748803079441529451792947114086, 0.00749479205789963919687179938478, 0.00750155942641815391691562098231, 0.00750833290548334059133495088645, 0.00751511250061267805505638150976, 0.00752189821732861339104170284031, 0.00752869006115859228794873203583, 0.00753548803763505383596088549325, 0.00754229215229541838372284701109, 0.00754910241068211876336313537195, 0.00755591881834259335160020043531, 0.00756274138082927479403982928829, 0.00756957010369962469964466578176, 0.00757640499251612149766987869270, 0.00758324605284625176404578184020, 0.00759009329026254404848561563313, 0.00759694671034255933350642919777, 0.00760380631866887975872648652853, 0.00761067212082914244797304803569, 0.00761754412241602910094151468456, 0.00762442232902725905430152408826, 0.00763130674626561790463430412501, 0.00763819737973895230426224500775, 0.00764509423506015695082282945805, 0.00765199731784721014909989023067, 0.00765890663372316080059754028753, 0.00766582218831612233200800687882, 0.00767274398725930565495767510242, 0.00767967203619100442085754210098, 0.00768660634075459328617974108511, 0.00769354690659855306594794299713, 0.00770049373937646726429040455741, 0.00770744684474700906401389843836, 0.00771440622837397602107323280052, 0.00772137189592627878886865744335, 0.00772834385307793331199022190958, 0.00773532210550809291860208105618, 0.00774230665890103877946337718186, 0.00774929751894616949958738416626, 0.00775629469133803668007276499452, 0.00776329818177633364240097790798, 0.00777030799596588415273368255498, 0.00777732413961667971846747349218, 0.00778434661844386571044607237013, 0.00779137543816773529142816201443, 0.00779841060451375977374821601984, 0.00780545212321258081306085685469, 0.00781250000000000000000000000000, 0.00781955424061701181992489750883, 0.00782661485080979671402623409904, 0.00783368183632970720153831933885, 0.00784075520293330170684686919458, 0.00784783495638234282476553005381, 0.00785492110244377129968373907332, 0.00786201364688976153671795543687, 0.00786911259549768864196561679591, 0.00787621795405013709612251915360, 0.00788332972833492504061148054006, 0.00789044792414509560396496112844, 0.00789757254727890996293115932758, 0.00790470360353987856749657936462, 0.00791184109873675246726865140090, 0.00791898503868351116841139969438, 0.00792613542919940253228539006614, 0.00793329227610892369348949415553, 0.00794045558524182105986088942018, 0.00794762536243311633332719878808, 0.00795480161352310130573606272719, 0.00796198434435732745051428338456, 0.00796917356078663714769039216890, 0.00797636926866715674500074584330, 0.00798357147386028614954867066444, 0.00799078018223273178755050594191, 0.00799799539965649619599474817733, 0.00800521713200887281847162313397, 0.00801244538517247202602522548887, 0.00801968016503521938243004285596, 0.00802692147749034176640314797169, 0.00803416932843640033135024225430, 0.00804142372377728356647175189664, 0.00804868466942219515369849602848, 0.00805595217128569213160815820629, 0.00806322623528766754819052664516, 0.00807050686735334699140054226518, 0.00807779407341332328362781822761, 0.00808508785940354086918535614359, 0.00809238823126529061013911814371, 0.00809969519494524274605407043737, 0.00810700875639543648565332745193, 0.00811432892157327133320077194867, 0.00812165569644154178297057455893, 0.00812898908696842344145938596967, 0.00813632909912746955793938496981, 0.00814367573889763878003389407922, 0.00815102901226328994954695161823, 0.00815838892521416995939897987000, 0.00816575548374545191754325657030, 0.00817312869385771606500767916259, 0.00818050856155695151061824077487, 0.00818789509285458398657464584858, 0.00819528829376746717483293025452, 0.00820268817031786882931765347848, 0.00821009472853351587873227401815, 0.00821750797444757534460091363826, 0.00822492791409864393292750150977, 0.00823235455353078793283572167638, 0.00823978789879353454295163317056, 0.00824722795594185278944543426860, 0.00825467473103619689411836191084, 0.00826212823014249413133835986400, 0.00826958845933213095025227090673, 0.00827705542468199287342578429616, 0.00828452913227445235377910393026, 0.00829200958819736010096956846382, 0.00829949679854407630641421889095, 0.00830699076941346370439589463786, 0.00831449150690987889844585367882, 0.00832199901714320358636634011873, 0.00832951330622883762133668028582, 0.00833703438028768513412547491725, 0.00834456224544619443173054662566, 0.00835209690783634585431460806149, 0.00835963837359563963214093007537, 0.00836718664886713404948981320786, 0.00837474173979943503631773182860, 0.00838230365254668402519300229869, 0.00838987239326859438048877848360, 0.00839744796813044272476567186914, 0.00840503038330305506098394374703, 0.00841261964496284667114345268146, 0.00842021575929180823849584669460, 0.00842781873247749890865065935941, 0.00843542857071307751459787738213, 0.00844304528019729737253751267190, 0.00845066886713449413881527050307, 0.00845829933773461703494511709778, 0.00846593669821322711288580364908, 0.00847358095479147817308263057612, 0.00848123211369616186727782292110, 0.00848889018115968514710534265078, 0.00849655516342007546826131658690, 0.00850422706672100160718574812790, 0.00851190589731177366106251724887, 0.00851959166144732570058462073348, 0.00852728436538825913804107159422, 0.00853498401540082538008213930425, 0.00854269061775692062354892186704, 0.00855040417873411708049591339886, 0.00855812470461565950874405217519, 0.00856585220169044439519900890900, 0.00857358667625306679338503812460, 0.00858132813460380471093369436630, 0.00858907658304860870124297633765, 0.00859683202789914002739379839113, 0.00860459447547275678436218271372, 0.00861236393209250696012535541968, 0.00862014040408716486485474206347, 0.00862792389779121551840468384853, 0.00863571441954485291558896165043, 0.00864351197569400778175641164580, 0.00865131657259034410334397335873, 0.00865912821659124004591845391587, 0.00866694691405983479171037942024, 0.00867477267136501119237923518313, 0.00868260549488138709539608584009, 0.00869044539098935350796004684071, 0.00869829236607506071921047663409, 0.00870614642653040962660959678487, 0.00871400757875308989985896346298, 0.00872187582914656783783513560593, 0.00872975118412007249080186710444, 0.00873763365008863902849700622255, 0.00874552323347309659706816376001, 0.00875341994070005270656142926100, 0.00876132377820193486428479445749, 0.00876923475241697843174382143161, 0.00877715286978921795102426273161, 0.00878507813676851836981462895437, 0.00879301055981057504140618874544, 0.00880095014537688943856430512369, 0.00880889689993481946050923880875, 0.00881685082995755688151096052252, 0.00882481194192412561616567501233, 0.00883278024231941814858881656392, 0.00884075573763417818518028923336, 0.00884873843436499371573056293983, 0.00885672833901434038150757288577, 0.00886472545809055892385153185842, 0.00887272979810785518417493022980, 0.00888074136558633132898510353925, 0.00888876016705197544154337663258, 0.00889678620903665284824768377803, 0.00890481949807814601727251613283, 0.00891286004072013721133416197517, 0.00892090784351219981407332682011, 0.00892896291300984169814203283977, 0.00893702525577448787796885909529, 0.00894509487837347010141808567596, 0.00895317178738006848315311714259, 0.00896125598937349936157215068988, 0.00896934749093889795157341637832, 0.00897744629866737038625945643844, 0.00898555241915596422663803366504, 0.00899366585900767713523951130128, 0.00900178662483147942752204073713, 0.00900991472324230886770113357898, 0.00901805016086106199513228176556, 0.00902619294431463055350395308096, 0.00903434308023588761304978334010, 0.00904250057526368063165467248155, 0.00905066543604286441460082812682, 0.00905883766922430111456776558043, 0.00906701728146483421078016817773, 0.00907520427942733881598869061236, 0.00908339866978070259451172319132, 0.00909160045919982402751191585821, 0.00909980965436564016857179382214, 0.00910802626196512143952332962726, 0.00911625028869126295683056326880, 0.00912448174124311402188869379870, 0.00913272062632577638630060334890, 0.00914096695065039210881252529362, 0.00914922072093417478033661183190, 0.00915748194390040431978050605721, 0.00916575062627841656570648609659, 0.00917402677480363797080098464676, 0.00918231039621758039770416104375, 0.00919060149726782203705166551799, 0.00919890008470805251028501459132, 0.00920720616529806072658725923930, 0.00921551974580371753564822512317, 0.00922384083299702776936879189407, 0.00923216943365610422100875354090, 0.00924050555456516417573986643674, 0.00924884920251457104400927278220, 0.00925720038430081701430474083736, 0.00926555910672651437953728503771, 0.00927392537660043370095763748395, 0.00928229920073749686926234403472, 0.00929068058595875802263552856175, 0.00929906953909145038428274432363, 0.00930746606696897064991969017456, 0.00931587017643086857943135470350, 0.00932428187432288689551196370076, 0.00933270116749695087532412429709, 0.00934112806281115100326406519571, 0.00934956256712979501266591597641, 0.00935800468732338013022609146674, 0.00936645443026859828017371967235, 0.00937491180284836037039930545234, 0.00938337681195179802717820649605, 0.00939184946447424277848892160137, 0.00940032976731727115682346607173, 0.00940881772738869082139956390165, 0.00941731335160253014981979191589, 0.00942581664687907466726457528239, 0.00943432762014486357704523555867, 0.00944284627833266894392227897015, 0.00945137262838154079691577180711, 0.00945990667723679845568796054067, 0.00946844843185000971386156010112, 0.00947699789917903941127708122849, 0.00948555508618803382148154668130, 0.00949411999984741371283458732933, 0.00950269264713390383880753375934, 0.00951127303503053640743036822869, 0.00951986117052662852988653696684, 0.00952845706061782211915289764192, 0.00953706071230607868582929143031, 0.00954567213259966892979768715577, 0.00955429132851320049579779691840, 0.00956291830706762144287402804821, 0.00957155307529019942769377138347, 0.00958019564021456333791082471407, 0.00958884600888069808799496485108, 0.00959750418833492206782675992827, 0.00960617018562993571495489675272, 0.00961484400782480937153184896715, 0.00962352566198496767180259325869, 0.00963221515518223291019150877901, 0.00964091249449481463296152128351, 0.00964961768700729229097934336323, 0.00965833073981066207724932581868, 0.00966705166000232304912564984534, 0.00967578045468606671997147117281, 0.00968451713097211348835191557782, 0.00969326169597710569914017497695, 0.00970201415682409376572969961217, 0.00971077452064257780339762149424, 0.00971954279456849201679347061145, 0.00972831898574420296521569895276, 0.00973710310131853731818729613678, 0.00974589514844678185545578941174, 0.00975469513429066265031153193377, 0.00976350306601839190712155414076, 0.00977231895080465408354175593786, 0.00978114279583059548217605083664, 0.00978997460828386241449283744487, 0.00979881439535859252720761958244, 0.00980766216425539918977172249015, 0.00981651792218141833190614420346, 0.00982538167635029283109027176124, 0.00983425343398216036949754936813, 0.00984313320230369506735890183791, 0.00985202098854809880934535470942, 0.00986091679995508389733327447857, 0.00986982064377091988793821997206, 0.00987873252724841971472713453295, 0.00988765245764692407570706222941, 0.00989658044223235000558247520530, 0.00990551648827717179379703793529, 0.00991446060306041578036317929445, 0.00992341279386769678505508807120, 0.00993237306799120769906785710646, 0.00994134143272970907667662743279, 0.00995031789538856903387653574100, 0.00995930246327975457476533449608, 0.00996829514372181250958515619232, 0.00997729594403991976170331668072, 0.00998630487156586602037755540096, 0.00999532193363804159769170354366, 0.01000434713760148253136605944746, 0.01001338049080785844169305676132, 0.01002242200061545518430250467645, 0.01003147167438922515714239125373, 0.01004052951950076995324412365562, 0.01004959554332832474821124435493, 0.01005866975325681034192371043900, 0.01006775215667781407657965786484, 0.01007684276098957595890759364465, 0.01008594157359704243659415112688, 0.01009504860191183690798499839048, 0.01010416385335226145680831422169, 0.01011328733534333501609125960385, 0.01012241905531678122509564587972, 0.01013155902071101281680665096019, 0.01014070723897118019019014667492, 0.01014986371754915579768141498107, 0.01015902846390352026739734014882, 0.01016820148549961097539373611198, 0.01017738278980950296370711072313, 0.01018657238431199853201380989276, 0.01019577027649267754461082091666, 0.01020497647384387314428710880065, 0.01021419098386466654815318833016, 0.01022341381406092868100454751357, 0.01023264497194530976698079172138, 0.01024188446503722198233088391817, 0.01025113230086288802767047201314, 0.01026038848695532378074712909211, 0.01026965303085433309226992548702, 0.01027892594010654248037894831214, 0.01028820722226539072230444560319, 0.01029749688489112538491987436373, 0.01030679493555083231504099217091, 0.01031610138181843216997890522180, 0.01032541623127466827447573649579, 0.01033473949150714304989762126752, 0.01034407117011031627951123113007, 0.01035341127468547908763163434287, 0.01036275981284080945077352708950, 0.01037211679219135485041647370963, 0.01038148222035901839521709888459, 0.01039085610497260565854293901111, 0.01040023845366780906596115841012, 0.01040962927408719922162116944264, 0.01041902857388026307217110399961, 0.01042843636070339523314043361779, 0.01043785264221988931532258959578, 0.01044727742609997088452100655331, 0.01045671072002079572682564645447, 0.01046615253166642903193128688599, 0.01047560286872789916956527633829, 0.01048506173890317166863539455335, 0.01049452914989715095195332850153, 0.01050400510942170982653376398730, 0.01051348962519569295304133760283, 0.01052298270494488909021502109908, 0.01053248435640208487129587666686, 0.01054199458730704919151577314551, 0.01055151340540651933030957820847, 0.01056104081845424605412553376027, 0.01057057683421098494280787605248, 0.01058012146044447383819164798524, 0.01058967470492949182470088231867, 0.01059923657544782973904951006716, 0.01060880707978829017024136049940, 0.01061838622574672735821010860491, 0.01062797402112603505075494325638, 0.01063757047373613089102928341845, 0.01064717559139400845924505745188, 0.01065678938192371298654403943829, 0.01066641185315634308972132515692, 0.01067604301293007852680094771358, 0.01068568286909018540120630547108, 0.01069533142948898840618454642026, 0.01070498870198592460123432346109, 0.01071465469444752606487103463451, 0.01072432941474740948628596726167, 0.01073401287076631953343319736405, 0.01074370507039211670996525782584, 0.01075340602151976694689228253310, 0.01076311573205137976649847786348, 0.01077283420989620481289517073265, 0.01078256146297060930061562089577, 0.01079229749919813352576625220536, 0.01080204232650946484517451295915, 0.01081179595284243767638887590010, 0.01082155838614207166159530970617, 0.01083132963436056125927642312945, 0.01084110970545725839697670522810, 0.01085089860739872798245375662418, 0.01086069634815872188282614985155, 0.01087050293571817372040300142544, 0.01088031837806524571021782321623, 0.01089014268319530957807028670459, 0.01089997585911093962163231907425, 0.01090981791382195260908805067857, 0.01091966885534540257496338711007, 0.01092952869170555653399734552522, 0.01093939743093394999229328590218, 0.01094927508106937306953110322638, 0.01095916165015784968228551576885, 0.01096905714625269132045382036722, 0.01097896157741447970002113265764, 0.01098887495171105808944300719077, 0.01099879727721757120828538489832, 0.01100872856201645481888373723223, 0.01101866881419742705272568628061, 0.01102861804185752657436747625752, 0.01103857625310110217309311764211, 0.01104854345603980582402048327140, 0.01105851965879262738257082787641, 0.01106850486948589284974531210537, 0.01107849909625324355544329080203, 0.01108850234723568473071964035626, 0.01109851463058157509944390284318, 0.01110853595444660606161857430152, 0.01111856632699385720453033599142, 0.01112860575639377722079181864956, 0.01113865425082417350000074662830, 0.01114871181847025723155031329270, 0.01115877846752462779211789722922, 0.01116885420618726580677115833851, 0.01117893904266557304760798530197, 0.01118903298517436376013911569771, 0.01119913604193585078550032818612, 0.01120924822117968719381586595318, 0.01121936953114296108002800878012, 0.01122949998007017474721536132165, 0.01123963957621329848302060838705, 0.01124978832783174974296880321845, 0.01125994624319238794629693956040, 0.01127011333056955263987042314966, 0.01128028959824506002873611976156, 0.01129047505450817695527021555790, 0.01130066970765568161449987627520, 0.01131087356599183926797458354940, 0.01132108663782839877431918296224, 0.01133130893148462728370340357742, 0.01134154045528730850311838196376, 0.01135178121757072361441842645036, 0.01136203122667669811185486850036, 0.01137229049095459139373520685012, 0.01138255901876127941518834774115, 0.01139283681846120846459236020110, 0.01140312389842637087744581236848, 0.01141342026703630503636777149268, 0.01142372593267813006556732347008, 0.01143404090374654236139662089045, 0.01144436518864379477566917131526, 0.01145469879577975212681106853552, 0.01146504173357186517900885291965, 0.01147539401044517064220951141351, 0.01148575563483233280548390098375, 0.01149612661517362792451546482653, 0.01150650695991693381325937650672, 0.01151689667751777668147639133167, 0.01152729577643931725694503853674, 0.01153770426515233864239728944767, 0.01154812215213529141832893287756, 0.01155854944587428149993524328920, 0.01156898615486306146349360091108, 0.01157943228760306524083301127348, 0.01158988785260341332350453313893, 0.01160035285838087806831175896605, 0.01161082731345995308624985398183, 0.01162131122637282201748298859911, 0.01163180460565935159245043450937, 0.01164230745986714714301779594052, 0.01165281979755152311217791805120, 0.01166334162727550652349783888440, 0.01167387295760986994086483292676, 0.01168441379713313146848641110864, 0.01169496415443152699531470517513, 0.01170552403809907264509160285115, 0.01171609345673754049022008416614, 0.01172667241895644987814684157001, 0.01173726093337311600361960728378, 0.01174785900861263256145239353145, 0.01175846665330786307290811265602, 0.01176908387609948598850895251644, 0.01177971068563598081024856867316, 0.01179034709057361594852775255049, 0.01180099309957649555968828281038, 0.01181164872131654913767206949160, 0.01182231396447351416678639424163, 0.01183298883773498816340818962090, 0.01184367334979641132874927933472, 0.01185436750936105267106857041881, 0.01186507132514006378209980852034, 0.01187578480585246148981681812984, 0.01188650796022511398064569476674, 0.01189724079699278937172213232998, 0.01190798332489814356782709126037, 0.01191873555269170638359899072611, 0.01192949748913192664634408401980, 0.01194026914298516699186603062799, 0.01195105052302567957833723255590, 0.01196184163803566333217354156204, 0.01197264249680524486607602341337, 0.01198345310813246807069010202440, 0.01199427348082334268686288680783, 0.01200510362369182695840841290646, 0.01201594354555981895849026130918, 0.01202679325525720516187888620152, 0.01203765276162183789354642726721, 0.01204852207349953706339018566496, 0.01205940119974412659542561954140, 0.01207029014921742401944548817028, 0.01208118893078923006267899609156, 0.01209209755333737548732564448528, 0.01210301602574770200859699542661, 0.01211394435691406229471667188591, 0.01212488255573835292666640128800, 0.01213583063113051266346253953543, 0.01214678859200850509492131124034, 0.01215775644729836200974570914468, 0.01216873420593417992607854216658, 0.01217972187685810100954419965547, 0.01219071946902035991078250276587, 0.01220172699137927509183132457338, 0.01221274445290123147889183030657, 0.01222377186256073250403275665121, 0.01223480922934038449267912795904, 0.01224585656223088278582444843323, 0.01225691387023106031228802947908, 0.01226798116234788238454456177351, 0.01227905844759641720842502365940, 0.01229014573499989833316181631062, 0.01230124303358971077360095591757, 0.01231235035240536325462645805828, 0.01232346770049455760009937677069, 0.01233459508691315924255871294690, 0.01234573252072519201905098640282, 0.01235688001100288327394061127507, 0.01236803756682665692001599211380, 0.01237920519728510741763738423060, 0.01239038291147506222478202886350, 0.01240157071850156098036244145533, 0.01241276862747784336116207981604, 0.01242397664752539938881614745014, 0.01243519478777395555202378574222, 0.01244642305736146092876026614249, 0.01245766146543413402381084154058, 0.01246891002114645582987684235832, 0.01248016873366114901089396482803, 0.01249143761214923341318350225038, 0.01250271666579000871821758522628, 0.01251400590377104229955484981929, 0.01252530533528821432565081295252, 0.01253661496954571602513439643189, 0.01254793481575602366595578729402, 0.01255926488313995059709071711040, 0.01257060518092664030964655808020, 0.01258195571835354908962756326218, 0.01259331650466649112074524197169, 0.01260468754911963328024793185023, 0.01261606886097547432223908714377, 0.01262746044950489691938155800699, 0.01263886232398715898928021061920, 0.01265027449370987287780021546268, 0.01266169696796905913549480260372, 0.01267312975606913090509397790129, 0.01268457286732288177844019116947, 0.01269602631105153783819261548160, 0.01270749009658473857586891142546, 0.01271896423326052995295132319598, 0.01273044873042540603425010203864, 0.01274194359743430378373307831907, 0.01275344884365058571729090175495, 0.01276496447844609020971784474341, 0.01277649051120111588220051856979, 0.01278802695130440945925354156998, 0.01279957380815322127987077038824, 0.01281113109115328448084358825554, 0.01282269880971879938424962119825, 0.01283427697327249247805092124963, 0.01284586559124560080358268265854, 0.01285746467307785113887153016776, 0.01286907422821751550978675027181, 0.01288069426612139904697595937932, 0.01289232479625482610807729599856, 0.01290396582809168538052979613440, 0.01291561737111442120795601340433, 0.01292727943481401797765073524715, 0.01293895202869005563173221418083, 0.01295063516225068538101350412717, 0.01296232884501262623555550845822, 0.01297403308650121010747735539326, 0.01298574789625037140261554213794, 0.01299747328380262793856569913942, 0.01300920925870914166000424927461, 0.01302095583052969435255974417487, 0.01303271300883267549974853238837, 0.01304448080319514299829641856832, 0.01305625922320279713728652382088, 0.01306804827844997365926538179792, 0.01307984797853969059777679007084, 0.01309165833308364307319138220009, 0.01310347935170217553713101210633, 0.01311531104402434769196084118903, 0.01312715341968790846993719867442, 0.01313900648833928909431367770821, 0.01315087025963365512104541465987, 0.01316274474323488909155432935449, 0.01317462994881557318549436530475, 0.01318652588605704993607314889914, 0.01319843256464940488281722963393, 0.01321034999429144748961384436825, 0.01322227818469076665586214858195, 0.01323421714556371857340888453791, 0.01324616688663541111403709749084, 0.01325812741763975413644693901460, 0.01327009874831944734319133516465, 0.01328208088842596466816470268668, 0.01329407384771960631830722832092, 0.01330607763596949009998748891803, 0.01331809226295352539815031178705, 0.01333011773845847909580886181402, 0.01334215407227995128791597778672, 0.01335420127422236660774679251062, 0.01336625935409902279915606015948, 0.01337832832173208204296077639128, 0.01339040818695254667081151467301, 0.01340249895960032681940798937603, 0.01341460064952421094019996417046, 0.01342671326658185886049334811787, 0.01343883682063985555987795095234, 0.01345097132157369555771619928919, 0.01346311677926776556590837685690, 0.01347527320361539826532037977813, 0.01348744060451886710161328863933, 0.01349961899188935679494427688496, 0.01351180837564702405528827000580, 0.01352400876572098717409708967807, 0.01353622017204930520761774204175, 0.01354844260457903175332017298160, 0.01356067607326620627627988824315, 0.01357292058807582982304928975736, 0.01358517615898192747170281080571, 0.01359744279596753098460215625209, 0.01360972050902465972643806679798, 0.01362200930815438137955197817064, 0.01363430920336679286197778537826, 0.01364662020468100818437751087231, 0.01365894232212520702229863189814, 0.01367127556573662777728017658774, 0.01368361994556154849489448821487, 0.01369597547165533890645150449927, 0.01370834215408245175538137772264, 0.01372072000291640198055276300693, 0.01373310902823982396214752554897, 0.01374550924014445590914945682925, 0.01375792064873112424683299082062, 0.01377034326410980086263791122292, 0.01378277709639958575893459169492, 0.01379522215572869317523618803989, 0.01380767845223450536462639348656, 0.01382014599606355698124815489791, 0.01383262479737152120251586495669, 0.01384511486632326697499006940006, 0.01385761621309283993241923127471, 0.01387012884786344678322844714558, 0.01388265278082751776056458226094, 0.01389518802218668060144413090029, 0.01390773458215175360785931246710, 0.01392029247094279942320582676984, 0.01393286169878910768504809425394, 0.01394544227592917941260797221048, 0.01395803421261078772208641396446, 0.01397063751909095527525828117632, 0.01398325220563594560585496395788, 0.01399587828252131169182170822296, 0.01400851576003189075114718775694, 0.01402116464846177475156441261106, 0.01403382495811438326893672012829, 0.01404649669930243226223520736085, 0.01405917988234793060409177911652, 0.01407187451758222691833299933251, 0.01408458061534600264108618716818, 0.01409729818598924946937422930660, 0.01411002723987132834171376316590, 0.01412276778736095556032736908492, 0.01413551983883618717863228653187, 0.01414828340468446930822121743176, 0.01416105849530263117996842225921, 0.01417384512109686606207148429348, 0.01418664329248278330175558892279, 0.01419945301988540312110309571381, 0.01421227431373912886147792278280, 0.01422510718448781463774110989107, 0.01423795164258474105212215476968, 0.01425080769849260478587815725859, 0.01426367536268357237572157458771, 0.01427655464563926980547936551602, 0.01428944555785075995468780263309, 0.01430234810981860504863760752414, 0.01431526231205284410696876307156, 0.01432818817507298773950008552447, 0.01434112570940806671848655184931, 0.01435407492559661810083149191541, 0.01436703583418666961557530470373, 0.01438000844573580211394059347185, 0.01439299277081112528320350207878, 0.01440598881998926550362938314720, 0.01441899660385642656379445725179, 0.01443201613300836884390410119750, 0.01444504741805039717272851618191, 0.01445809046959741633875395905307, 0.01447114529827391547767145851822, 0.01448421191471394899041857939892, 0.01449729032956120593211846170334, 0.01451038055346898052178072902052, 0.01452348259710015999923715668274, 0.01453659647112728707518680693056, 0.01454972218623254431868474512157, 0.01456285975310772640156642410147, 0.01457600918245431642628062718359, 0.01458917048498345296614342458952, 0.01460234367141592659589122149555, 0.01461552875248222672921460940643, 0.01462872573892253988403489017855, 0.01464193464148671845748150843747, 0.01465515547093434838010761467331, 0.01466838823803473523810225742636, 0.01468163295356687651771476765816, 0.01469488962831953099419379782375, 0.01470815827309120311927603808044, 0.01472143889869011353088712468207, 0.01473473151593427364625110698171, 0.01474803613565146311048525973320, 0.01476135276867921244936532332304, 0.01477468142586485858047673502824, 0.01478802211806553960904420108591, 0.01480137485614816880707955704111, 0.01481473965098949532870342693514, 0.01482811651347609380180436744467, 0.01484150545450433830718672822968, 0.01485490648498047003278621502886, 0.01486831961582057645698817793800, 0.01488174485795057920556327957229, 0.01489518222230628782809525034736, 0.01490863171983338765491655664164, 0.01492209336148742071515016505145, 0.01493556715823384645203120157930, 0.01494905312104802957984261979618, 0.01496255126091521406306306118950, 0.01497606158883058903585894228172, 0.01498958411579927839374359876956, 0.01500311885283630783383124196462, 0.01501666581096668118266990177290, 0.01503022500122535611011276301952, 0.01504379643465722678208340568062, 0.01505738012231718457589746407166, 0.01507097607527010767192177098650, 0.01508458430459083676744569402217, 0.01509820482136423752672627074389, 0.01511183763668518670320040087063, 0.01512548276165854958807965857659, 0.01513914020739924939928933156352, 0.01515280998503224299533975738541, 0.01516649210569250352809156368039, 0.01518018658052508809697123126625, 0.01519389342068511866701285839554, 0.01520761263733775951745297305706, 0.01522134424165828489594609607138, 0.01523508824483205820188302936913, 0.01524884465805451810860304817652, 0.01526261349253123580926860825002, 0.01527639475947790460852449001550, 0.01529018847012031390164565891610, 0.01530399463569442029819978046135, 0.01531781326744632160119508057505, 0.01533164437663224466401601375765, 0.01534548797451861130991535020485, 0.01535934407238200884171508420195, 0.01537321268150918657235948217021, 0.01538709381319710613189588599425, 0.01540098747875293452858080911483, 0.01541489368949401812802779687672, 0.01542881245674795204214646560104, 0.01544274379185255757773731488669, 0.01545668770615586662398044381916, 0.01547064421101618583720416211236, 0.01548461331780207755892675436371, 0.01549859503789233899917476833252, 0.01551258938267607336014552998904, 0.01552659636355266728480195581596, 0.01554061599193176830546736510996, 0.01555464827923335943693494698437, 0.01556869323688773142089214474026, 0.01558275087633547058285632402885, 0.01559682120902751954749643203968, 0.01561090424642516162612171370938, 0.01562500000000000000000000000000, 0.01563910848123402363984979501765, 0.01565322970161959342805246819808, 0.01566736367265941440307663867770, 0.01568151040586660341369373838916, 0.01569566991276468564953106010762, 0.01570984220488754259936747814663, 0.01572402729377952307343591087374, 0.01573822519099537728393123359183, 0.01575243590810027419224503830719, 0.01576665945666985008122296108013, 0.01578089584829019120792992225688, 0.01579514509455781992586231865516, 0.01580940720707975713499315872923, 0.01582368219747350493453730280180, 0.01583797007736702233682279938876, 0.01585227085839880506457078013227, 0.01586658455221784738697898831106, 0.01588091117048364211972177884036, 0.01589525072486623266665439757617, 0.01590960322704620261147212545438, 0.01592396868871465490102856676913, 0.01593834712157327429538078433779, 0.01595273853733431349000149168660, 0.01596714294772057229909734132889, 0.01598156036446546357510101188382, 0.01599599079931299239198949635465, 0.01601043426401774563694324626795, 0.01602489077034494405205045097773, 0.01603936033007043876486008571192, 0.01605384295498068353280629594337, 0.01606833865687280066270048450860, 0.01608284744755456713294350379329, 0.01609736933884439030739699205697, 0.01611190434257138426321631641258, 0.01612645247057533509638105329032, 0.01614101373470669398280108453037, 0.01615558814682664656725563645523, 0.01617017571880708173837071228718, 0.01618477646253058122027823628741, 0.01619939038989048549210814087473, 0.01621401751279087297130665490386, 0.01622865784314654266640154389734, 0.01624331139288308356594114911786, 0.01625797817393684688291877193933, 0.01627265819825493911587876993963, 0.01628735147779527756006778815845, 0.01630205802452657989909390323646, 0.01631677785042833991879795974000, 0.01633151096749090383508651314060, 0.01634625738771543213001535832518, 0.01636101712311390302123648154975, 0.01637579018570916797314929169715, 0.01639057658753493434966586050905, 0.01640537634063573765863530695697, 0.01642018945706703175746454803630, 0.01643501594889515068920182727652, 0.01644985582819728786585500301953, 0.01646470910706157586567144335277, 0.01647957579758706908590326634112, 0.01649445591188370557889086853720, 0.01650934946207239378823672382168, 0.01652425646028498826267671972801, 0.01653917691866426190050454181346, 0.01655411084936398574685156859232, 0.01656905826454890470755820786053, 0.01658401917639472020193913692765, 0.01659899359708815261282843778190, 0.01661398153882692740879178927571, 0.01662898301381975779689170735764, 0.01664399803428640717273268023746, 0.01665902661245767524267336057164, 0.01667406876057537026825094983451, 0.01668912449089238886346109325132, 0.01670419381567269170862921612297, 0.01671927674719127926428186015073, 0.01673437329773426809897962641571, 0.01674948347959887007263546365721, 0.01676460730509336805038600459739, 0.01677974478653718876097755696719, 0.01679489593626088544953134373827, 0.01681006076660611012196788749407, 0.01682523928992569334228690536293, 0.01684043151858361647699169338921, 0.01685563746495499781730131871882, 0.01687085714142615502919575476426, 0.01688609056039459474507502534379, 0.01690133773426898827763054100615, 0.01691659867546923406989023419555, 0.01693187339642645422577160729816, 0.01694716190958295634616526115224, 0.01696246422739232373455564584219, 0.01697778036231937029421068530155, 0.01699311032684015093652263317381, 0.01700845413344200321437149625581, 0.01702381179462354732212503449773, 0.01703918332289465140116924146696, 0.01705456873077651827608214318843, 0.01706996803080165076016427860850, 0.01708538123551384124709784373408, 0.01710080835746823416099182679773, 0.01711624940923131901748810435038, 0.01713170440338088879039801781801, 0.01714717335250613358677007624919, 0.01716265626920760942186738873261, 0.01717815316609721740248595267531, 0.01719366405579828005478759678226, 0.01720918895094551356872436542744, 0.01722472786418501392025071083935, 0.01724028080817432972970948412694, 0.01725584779558243103680936769706, 0.01727142883908970583117792330086, 0.01728702395138801556351282329160, 0.01730263314518068820668794671747, 0.01731825643318248009183690783175, 0.01733389382811966958342075884048, 0.01734954534273002238475847036625, 0.01736521098976277419079217168019, 0.01738089078197870701592009368142, 0.01739658473215012143842095326818, 0.01741229285306081925321919356975, 0.01742801515750617979971792692595, 0.01744375165829313567567027121186, 0.01745950236824014498160373420887, 0.01747526730017727805699401244510, 0.01749104646694619319413632752003, 0.01750683988140010541312285852200, 0.01752264755640386972856958891498, 0.01753846950483395686348764286322, 0.01755430573957843590204852546321, 0.01757015627353703673962925790875, 0.01758602111962115008281237749088, 0.01760190029075377887712861024738, 0.01761779379986963892101847761751, 0.01763370165991511376302192104504, 0.01764962388384825123233135002465, 0.01766556048463883629717763312783, 0.01768151147526835637036057846672, 0.01769747686872998743146112587965, 0.01771345667802868076301514577153, 0.01772945091618111784770306371684, 0.01774545959621571036834986045960, 0.01776148273117266265797020707851, 0.01777752033410395088308675326516, 0.01779357241807330569649536755605, 0.01780963899615629203454503226567, 0.01782572008144027442266832395035, 0.01784181568702439962814665364021, 0.01785792582601968339628406567954, 0.01787405051154897575593771819058, 0.01789018975674694020283617135192, 0.01790634357476013696630623428518, 0.01792251197874699872314430137976, 0.01793869498187779590314683275665, 0.01795489259733474077251891287688, 0.01797110483831192845327606733008, 0.01798733171801535427047902260256, 0.01800357324966295885504408147426, 0.01801982944648461773540226715795, 0.01803610032172212399026456353113, 0.01805238588862926110700790616193, 0.01806868616047177522609956668020, 0.01808500115052736126330934496309, 0.01810133087208572882920165625364, 0.01811767533844860222913553116086, 0.01813403456292966842156033635547, 0.01815040855885467763197738122471, 0.01816679733956140518902344638263, 0.01818320091839964805502383171643, 0.01819961930873128033714358764428, 0.01821605252393024287904665925453, 0.01823250057738252591366112653759, 0.01824896348248622804377738759740, 0.01826544125265155277260120669780, 0.01828193390130078421762505058723, 0.01829844144186834956067322366380, 0.01831496388780080863956101211443, 0.01833150125255683313141297219317, 0.01834805354960727594160196929352, 0.01836462079243516079540832208750, 0.01838120299453564407410333103599, 0.01839780016941610502057002918264, 0.01841441233059612145317451847859, 0.01843103949160743507129645024634, 0.01844768166599405553873758378813, 0.01846433886731220844201750708180, 0.01848101110913032835147973287349, 0.01849769840502914208801854556441, 0.01851440076860163402860948167472, 0.01853111821345302875907457007543, 0.01854785075320086740191527496791, 0.01856459840147499373852468806945, 0.01858136117191751604527105712350, 0.01859813907818290076856548864725, 0.01861493213393794129983938034911, 0.01863174035286173715886270940700, 0.01864856374864577379102392740151, 0.01866540233499390175064824859419, 0.01868225612562230200652813039142, 0.01869912513425959002533183195283, 0.01871600937464676026045218293348, 0.01873290886053719656034743934470, 0.01874982360569672074079861090468, 0.01876675362390359605435641299209, 0.01878369892894848555697784320273, 0.01880065953463454231364693214346, 0.01881763545477738164279912780330, 0.01883462670320506029963958383178, 0.01885163329375814933452915056478, 0.01886865524028972715409047111734, 0.01888569255666533788784455794030, 0.01890274525676308159383154361421, 0.01891981335447359691137592108134, 0.01893689686370001942772312020224, 0.01895399579835807882255416245698, 0.01897111017237606764296309336260, 0.01898823999969482742566917465865, 0.01900538529426780767761506751867, 0.01902254607006107281486073645738, 0.01903972234105325705977307393368, 0.01905691412123564423830579528385, 0.01907412142461215737165858286062, 0.01909134426519933785959537431154, 0.01910858265702640099159559383679, 0.01912583661413524288574805609642, 0.01914310615058039885538754276695, 0.01916039128042912667582164942814, 0.01917769201776139617598992970215, 0.01919500837666984413565351985653, 0.01921234037125987142990979350543, 0.01922968801564961874306369793430, 0.01924705132396993534360518651738, 0.01926443031036446582038301755802, 0.01928182498898962926592304256701, 0.01929923537401458458195868672647, 0.01931666147962132415449865163737, 0.01933410332000464609825129969067, 0.01935156090937213343994294234562, 0.01936903426194422697670383115565, 0.01938652339195421139828034995389, 0.01940402831364818753145939922433, 0.01942154904128515560679524298848, 0.01943908558913698403358694122289, 0.01945663797148840593043139790552, 0.01947420620263707463637459227357, 0.01949179029689356371091157882347, 0.01950939026858132530062306386753, 0.01952700613203678381424310828152, 0.01954463790160930816708351187572, 0.01956228559166119096435210167328, 0.01957994921656772482898567488974, 0.01959762879071718505441523916488, 0.01961532432851079837954344498030, 0.01963303584436283666381228840692, 0.01965076335270058566218054352248, 0.01966850686796432073899509873627, 0.01968626640460739013471780367581, 0.01970404197709619761869070941884, 0.01972183359991016779466654895714, 0.01973964128754183977587643994411, 0.01975746505449683942945426906590, 0.01977530491529384815141412445882, 0.01979316088446470001116495041060, 0.01981103297655434358759407587058, 0.01982892120612083156072635858891, 0.01984682558773539357011017614241, 0.01986474613598241539813571421291, 0.01988268286545941815335325486558, 0.01990063579077713806775307148200, 0.01991860492655950914953066899216, 0.01993659028744362501917031238463, 0.01995459188807983952340663336145, 0.01997260974313173204075511080191, 0.01999064386727608319538340708732, 0.02000869427520296506273211889493, 0.02002676098161571688338611352265, 0.02004484400123091036860500935290, 0.02006294334877845031428478250746, 0.02008105903900153990648824731124, 0.02009919108665664949642248870987, 0.02011733950651362068384742087801, 0.02013550431335562815315931572968, 0.02015368552197915191781518728931, 0.02017188314719408487318830225377, 0.02019009720382367381596999678095, 0.02020832770670452291361662844338, 0.02022657467068667003218251920771, 0.02024483811063356245019129175944, 0.02026311804142202563361330192038, 0.02028141447794236038038029334984, 0.02029972743509831159536282996214, 0.02031805692780704053479468029764, 0.02033640297099922195078747222396, 0.02035476557961900592741422144627, 0.02037314476862399706402761978552, 0.02039154055298535508922164183332, 0.02040995294768774628857421760131, 0.02042838196772933309630637666032, 0.02044682762812185736200909502713, 0.02046528994389061953396158344276, 0.02048376893007444396466176783633, 0.02050226460172577605534094402628, 0.02052077697391064756149425818421, 0.02053930606170866618453985097403, 0.02055785188021308496075789662427, 0.02057641444453078144460889120637, 0.02059499376978225076983974872746, 0.02061358987110166463008198434181, 0.02063220276363686433995781044359, 0.02065083246254933654895147299158, 0.02066947898301428609979524253504, 0.02068814234022063255902246226015, 0.02070682254937095817526326868574, 0.02072551962568161890154705417899, 0.02074423358438270970083294741926, 0.02076296444071803679043419776917, 0.02078171220994521131708587802223, 0.02080047690733561813192231682024, 0.02081925854817439844324233888528, 0.02083805714776052614434220799922, 0.02085687272140679046628086723558, 0.02087570528443977863064517919156, 0.02089455485219994176904201310663, 0.02091342144004159145365129290894, 0.02093230506333285806386257377198, 0.02095120573745579833913055267658, 0.02097012347780634333727078910670, 0.02098905829979430190390665700306, 0.02100801021884341965306752797460, 0.02102697925039138590608267520565, 0.02104596540988977818043004219817, 0.02106496871280416974259175333373, 0.02108398917461409838303154629102, 0.02110302681081303866061915641694, 0.02112208163690849210825106752054, 0.02114115366842196988561575210497, 0.02116024292088894767638329597048, 0.02117934940985898364940176463733, 0.02119847315089565947809902013432, 0.02121761415957658034048272099881, 0.02123677245149345471642021720982, 0.02125594804225207010150988651276, 0.02127514094747226178205856683689, 0.02129435118278801691849011490376, 0.02131357876384742597308807887657, 0.02133282370631268617944265031383, 0.02135208602586015705360189542716, 0.02137136573818037080241261094216, 0.02139066285897797681236909284053, 0.02140997740397184920246864692217, 0.02142930938889505212974206926901, 0.02144865882949481897257193452333, 0.02146802574153263906686639472809, 0.02148741014078423341993051565169, 0.02150681204303953389378456506620, 0.02152623146410275953299695572696, 0.02154566841979240962579034146529, 0.02156512292594121860123124179154, 0.02158459499839626705153250441072, 0.02160408465301892969034902591829, 0.02162359190568487535277775180020, 0.02164311677228414332319061941234, 0.02166265926872112251855284625890, 0.02168221941091451679395341045620, 0.02170179721479745596490751324836, 0.02172139269631744376565229970311, 0.02174100587143634744080600285088, 0.02176063675613049142043564643245, 0.02178028536639061915614057340917, 0.02179995171822187924326463814850, 0.02181963582764390521817610135713, 0.02183933771069080514992677422015, 0.02185905738341111306799469105044, 0.02187879486186789998458657180436, 0.02189855016213874613906220645276, 0.02191832330031569936457103153771, 0.02193811429250538264090764073444, 0.02195792315482895940004226531528, 0.02197774990342211617888601438153, 0.02199759455443514241657076979664, 0.02201745712403290963776747446445, 0.02203733762839485410545137256122, 0.02205723608371505314873495251504, 0.02207715250620220434618623528422, 0.02209708691207961164804096654279, 0.02211703931758525476514165575281, 0.02213700973897178569949062421074, 0.02215699819250648711088658160406, 0.02217700469447136946143928071251, 0.02219702926116315019888780568635, 0.02221707190889321212323714860304, 0.02223713265398771440906067198284, 0.02225721151278755444158363729912, 0.02227730850164834700000149325660, 0.02229742363694051446310062658540, 0.02231755693504925558423579445844, 0.02233770841237453161354231667701, 0.02235787808533114609521597060393, 0.02237806597034872752027823139542, 0.02239827208387170157100065637223, 0.02241849644235937438763173190637, 0.02243873906228592216005601756024, 0.02245899996014034949443072264330, 0.02247927915242659696604121677410, 0.02249957665566349948593760643689, 0.02251989248638477589259387912080, 0.02254022666113910527974084629932, 0.02256057919649012005747223952312, 0.02258095010901635391054043111581, 0.02260133941531136322899975255041, 0.02262174713198367853594916709881, 0.02264217327565679754863836592449, 0.02266261786296925456740680715484, 0.02268308091057461700623676392752, 0.02270356243514144722883685290071, 0.02272406245335339622370973700072, 0.02274458098190918278747041370025, 0.02276511803752255883037669548230, 0.02278567363692241692918472040219, 0.02280624779685274175489162473696, 0.02282684053407261007273554298536, 0.02284745186535626013113464694015, 0.02286808180749308472279324178089, 0.02288873037728758955133834263052, 0.02290939759155950425362213707103, 0.02293008346714373035801770583930, 0.02295078802089034128441902282702, 0.02297151126966466561096780196749, 0.02299225323034725584903092965305, 0.02301301391983386762651875301344, 0.02303379335503555336295278266334, 0.02305459155287863451389007707348, 0.02307540853030467728479457889534, 0.02309624430427058283665786575511, 0.02311709889174856299987048657840, 0.02313797230972612292698720182216, 0.02315886457520613048166602254696, 0.02317977570520682664700906627786, 0.02320070571676175613662351793209, 0.02322165462691990617249970796365, 0.02324262245274564403496597719823, 0.02326360921131870318490086901875, 0.02328461491973429428603559188105, 0.02330563959510304622435583610240, 0.02332668325455101304699567776879, 0.02334774591521973988172966585353, 0.02336882759426626293697282221729, 0.02338992830886305399062941035027, 0.02341104807619814529018320570231, 0.02343218691347508098044016833228, 0.02345334483791289975629368314003, 0.02347452186674623200723921456756, 0.02349571801722526512290478706291, 0.02351693330661572614581622531205, 0.02353816775219897197701790503288, 0.02355942137127196162049713734632, 0.02358069418114723189705550510098, 0.02360198619915299111937656562077, 0.02362329744263309827534413898320, 0.02364462792894702833357278848325, 0.02366597767546997632681637924179, 0.02368734669959282265749855866943, 0.02370873501872210534213714083762, 0.02373014265028012756419961704069, 0.02375156961170492297963363625968, 0.02377301592045022796129138953347, 0.02379448159398557874344426465996, 0.02381596664979628713565418252074, 0.02383747110538341276719798145223, 0.02385899497826385329268816803960, 0.02388053828597033398373206125598, 0.02390210104605135915667446511179, 0.02392368327607132666434708312408, 0.02394528499361048973215204682674, 0.02396690621626493614138020404880, 0.02398854696164668537372577361566, 0.02401020724738365391681682581293, 0.02403188709111963791698052261836, 0.02405358651051441032375777240304, 0.02407530552324367578709285453442, 0.02409704414699907412678037132991, 0.02411880239948825319085123908280, 0.02414058029843484803889097634055, 0.02416237786157846012535799218313, 0.02418419510667475097465128897056, 0.02420603205149540401719399085323, 0.02422788871382812458943334377182, 0.02424976511147670585333280257601, 0.02427166126226102532692507907086, 0.02429357718401701018984262248068, 0.02431551289459672401949141828936, 0.02433746841186835985215708433316, 0.02435944375371620201908839931093, 0.02438143893804071982156500553174, 0.02440345398275855018366264914675, 0.02442548890580246295778366061313, 0.02444754372512146500806551330243, 0.02446961845868076898535825591807, 0.02449171312446176557164889686646, 0.02451382774046212062457605895816, 0.02453596232469576476908912354702, 0.02455811689519283441685004731880, 0.02458029146999979666632363262124, 0.02460248606717942154720191183515, 0.02462470070481072650925291611657, 0.02464693540098911520019875354137, 0.02466919017382631848511742589380, 0.02469146504145038403810197280563, 0.02471376002200576654788122255013, 0.02473607513365331384003198422761, 0.02475841039457021483527476846120, 0.02478076582295012444956405772700, 0.02480314143700312196072488291065, 0.02482553725495568672232415963208, 0.02484795329505079877763229490029, 0.02487038957554791110404757148444, 0.02489284611472292185752053228498, 0.02491532293086826804762168308116, 0.02493782004229291165975368471663, 0.02496033746732229802178792965606, 0.02498287522429846682636700450075, 0.02500543333158001743643517045257, 0.02502801180754208459910969963857, 0.02505061067057642865130162590503, 0.02507322993909143205026879286379, 0.02509586963151204733191157458805, 0.02511852976627990119418143422081, 0.02514121036185328061929311616041, 0.02516391143670709817925512652437, 0.02518663300933298224149048394338, 0.02520937509823926656049586370045, 0.02523213772195094864447817428754, 0.02525492089900979383876311601398, 0.02527772464797431797856042123840, 0.02530054898741974575560043092537, 0.02532339393593811827098960520743, 0.02534625951213826181018795580258, 0.02536914573464576355688038233893, 0.02539205262210307567638523096321, 0.02541498019316947715173782285092, 0.02543792846652105990590264639195, 0.02546089746085081206850020407728, 0.02548388719486860756746615663815, 0.02550689768730117143458180350990, 0.02552992895689218041943568948682, 0.02555298102240223176440103713958, 0.02557605390260881891850708313996, 0.02559914761630644255974154077649, 0.02562226218230656896168717651108, 0.02564539761943759876849924239650, 0.02566855394654498495610184249927, 0.02569173118249120160716536531709, 0.02571492934615570227774306033552, 0.02573814845643503101957350054363, 0.02576138853224279809395191875865, 0.02578464959250965221615459199711, 0.02580793165618337076105959226879, 0.02583123474222884241591202680866, 0.02585455886962803595530147049431, 0.02587790405738011126346442836166, 0.02590127032450137076202700825434, 0.02592465769002525247111101691644, 0.02594806617300242021495471078651, 0.02597149579250074280523108427587, 0.02599494656760525587713139827883, 0.02601841851741828332000849854921, 0.02604191166105938870511948834974, 0.02606542601766535099949706477673, 0.02608896160639028599659283713663, 0.02611251844640559427457304764175, 0.02613609655689994731853076359585, 0.02615969595707938119555358014168, 0.02618331666616728614638276440019, 0.02620695870340435107426202421266, 0.02623062208804869538392168237806, 0.02625430683937581693987439734883, 0.02627801297667857818862735541643, 0.02630174051926731024209082931975, 0.02632548948646977818310865870899, 0.02634925989763114637098873060950, 0.02637305177211409987214629779828, 0.02639686512929880976563445926786, 0.02642069998858289497922768873650, 0.02644455636938153331172429716389, 0.02646843429112743714681776907582, 0.02649233377327082222807419498167, 0.02651625483527950827289387802921, 0.02654019749663889468638267032929, 0.02656416177685192933632940537336, 0.02658814769543921263661445664184, 0.02661215527193898019997497783606, 0.02663618452590705079630062357410, 0.02666023547691695819161772362804, 0.02668430814455990257583195557345, 0.02670840254844473321549358502125, 0.02673251870819804559831212031895, 0.02675665664346416408592155278257, 0.02678081637390509334162302934601, 0.02680499791920065363881597875206, 0.02682920129904842188039992834092, 0.02685342653316371772098669623574, 0.02687767364127971111975590190468, 0.02690194264314739111543239857838, 0.02692623355853553113181675371379, 0.02695054640723079653064075955626, 0.02697488120903773420322657727866, 0.02699923798377871358988855376992, 0.02702361675129404811057654001161, 0.02704801753144197434819417935614, 0.02707244034409861041523548408350, 0.02709688520915806350664034596321, 0.02712135214653241255255977648631, 0.02714584117615165964609857951473, 0.02717035231796385494340562161142, 0.02719488559193506196920431250419, 0.02721944101804931945287613359596, 0.02724401861630876275910395634128, 0.02726861840673358572395557075652, 0.02729324040936201636875502174462, 0.02731788464425041404459726379628, 0.02734255113147325555456035317548, 0.02736723989112309698978897642974, 0.02739195094331067781290300899855, 0.02741668430816490351076275544528, 0.02744144000583280396110552601385, 0.02746621805647964792429505109794, 0.02749101848028891181829891365851, 0.02751584129746224849366598164124, 0.02754068652821960172527582244584, 0.02756555419279917151786918338985, 0.02759044431145738635047237607978, 0.02761535690446901072925278697312, 0.02764029199212711396249630979582, 0.02766524959474304240503172991339, 0.02769022973264653394998013880013, 0.02771523242618567986483846254941, 0.02774025769572689356645689429115, 0.02776530556165503552112916452188, 0.02779037604437336120288826180058, 0.02781546916430350721571862493420, 0.02784058494188559884641165353969, 0.02786572339757821537009618850789, 0.02789088455185835882521594442096, 0.02791606842522157544417282792892, 0.02794127503818191055051656235264, 0.02796650441127189121170992791576, 0.02799175656504262338364341644592, 0.02801703152006378150229437551388, 0.02804232929692354950312882522212, 0.02806764991622876653787344025659, 0.02809299339860486452447041472169, 0.02811835976469586120818355823303, 0.02814374903516445383666599866501, 0.02816916123069200528217237433637, 0.02819459637197849893874845861319, 0.02822005447974265668342752633180, 0.02824553557472191112065473816983, 0.02827103967767237435726457306373, 0.02829656680936893861644243486353, 0.02832211699060526235993684451842, 0.02834769024219373212414296858697, 0.02837328658496556660351117784558, 0.02839890603977080624220619142761, 0.02842454862747825772295584556559, 0.02845021436897562927548221978213, 0.02847590328516948210424430953935, 0.02850161539698520957175631451719, 0.02852735072536714475144314917543, 0.02855310929127853961095873103204, 0.02857889111570151990937560526618, 0.02860469621963721009727521504828, 0.02863052462410568821393752614313, 0.02865637635014597547900017104894, 0.02868225141881613343697310369862, 0.02870814985119323620166298383083, 0.02873407166837333923115060940745, 0.02876001689147160422788118694370, 0.02878598554162225056640700415755, 0.02881197763997853100725876629440, 0.02883799320771285312758891450358, 0.02886403226601673768780820239499, 0.02889009483610079434545703236381, 0.02891618093919483267750791810613, 0.02894229059654783095534291703643, 0.02896842382942789798083715879784, 0.02899458065912241186423692340668, 0.02902076110693796104356145804104, 0.02904696519420031999847431336548, 0.02907319294225457415037361386112, 0.02909944437246508863736949024315, 0.02912571950621545280313284820295, 0.02915201836490863285256125436717, 0.02917834096996690593228684917904, 0.02920468734283185319178244299110, 0.02923105750496445345842921881285, 0.02925745147784507976806978035711, 0.02928386928297343691496301687494, 0.02931031094186869676021522934661, 0.02933677647606947047620451485272, 0.02936326590713375303542953531633, 0.02938977925663906198838759564751, 0.02941631654618240623855207616089, 0.02944287779738022706177424936413, 0.02946946303186854729250221396342, 0.02949607227130292622097051946639, 0.02952270553735842489873064664607, 0.02954936285172971716095347005648, 0.02957604423613107921808840217182, 0.02960274971229633761415911408221, 0.02962947930197899065740685387027, 0.02965623302695218760360873488935, 0.02968301090900867661437345645936, 0.02970981296996094006557243005773, 0.02973663923164115291397635587600, 0.02976348971590115841112655914458, 0.02979036444461257565619050069472, 0.02981726343966677530983311328328, 0.02984418672297484143030033010291, 0.02987113431646769290406240315860, 0.02989810624209605915968523959236, 0.02992510252183042812612612237899, 0.02995212317766117807171788456344, 0.02997916823159855678748719753912, 0.03000623770567261566766248392923, 0.03003333162193336236533980354579, 0.03006045000245071222022552603903, 0.03008759286931445356416681136125, 0.03011476024463436915179492814332, 0.03014195215054021534384354197300, 0.03016916860918167353489138804434, 0.03019640964272847505345254148779, 0.03022367527337037340640080174126, 0.03025096552331709917615931715318, 0.03027828041479849879857866312705, 0.03030561997006448599067951477082, 0.03033298421138500705618312736078, 0.03036037316105017619394246253250, 0.03038778684137023733402571679107, 0.03041522527467551903490594611412, 0.03044268848331656979189219214277, 0.03047017648966411640376605873826, 0.03049768931610903621720609635304, 0.03052522698506247161853721650004, 0.03055278951895580921704898003100, 0.03058037694024062780329131783219, 0.03060798927138884059639956092269, 0.03063562653489264320239016115011, 0.03066328875326448932803202751529, 0.03069097594903722261983070040969, 0.03071868814476401768343016840390, 0.03074642536301837314471896434043, 0.03077418762639421226379177198851, 0.03080197495750586905716161822966, 0.03082978737898803625605559375344, 0.03085762491349590408429293120207, 0.03088548758370511515547462977338, 0.03091337541231173324796088763833, 0.03094128842203237167440832422471, 0.03096922663560415511785350872742, 0.03099719007578467799834953666505, 0.03102517876535214672029105997808, 0.03105319272710533456960391163193, 0.03108123198386353661093473021992, 0.03110929655846671887386989396873, 0.03113738647377546284178428948053, 0.03116550175267094116571264805771, 0.03119364241805503909499286407936, 0.03122180849285032325224342741876, 0.03125000000000000000000000000000, 0.03127821696246804727969959003531, 0.03130645940323918685610493639615, 0.03133472734531882880615327735541, 0.03136302081173320682738747677831, 0.03139133982552937129906212021524, 0.03141968440977508519873495629326, 0.03144805458755904614687182174748, 0.03147645038199075456786246718366, 0.03150487181620054838449007661438, 0.03153331891333970016244592216026, 0.03156179169658038241585984451376, 0.03159029018911563985172463731033, 0.03161881441415951426998631745846, 0.03164736439494700986907460560360, 0.03167594015473404467364559877751, 0.03170454171679761012914156026454, 0.03173316910443569477395797662211, 0.03176182234096728423944355768072, 0.03179050144973246533330879515233, 0.03181920645409240522294425090877, 0.03184793737742930980205713353826, 0.03187669424314654859076156867559, 0.03190547707466862698000298337320, 0.03193428589544114459819468265778, 0.03196312072893092715020202376763, 0.03199198159862598478397899270931, 0.03202086852803549127388649253589, 0.03204978154068988810410090195546, 0.03207872066014087752972017142383, 0.03210768590996136706561259188675, 0.03213667731374560132540096901721, 0.03216569489510913426588700758657, 0.03219473867768878061479398411393, 0.03222380868514276852643263282516, 0.03225290494115067019276210658063, 0.03228202746941338796560216906073, 0.03231117629365329313451127291046, 0.03234035143761416347674142457436, 0.03236955292506116244055647257483, 0.03239878077978097098421628174947, 0.03242803502558174594261330980771, 0.03245731568629308533280308779467, 0.03248662278576616713188229823572, 0.03251595634787369376583754387866, 0.03254531639650987823175753987925, 0.03257470295559055512013557631690, 0.03260411604905315979818780647292, 0.03263355570085667983759591948001, 0.03266302193498180767017302628119, 0.03269251477543086426003071665036, 0.03272203424622780604247296309950, 0.03275158037141833594629858339431, 0.03278115317506986869933172101810, 0.03281075268127147531727061391393, 0.03284037891413406351492909607259, 0.03287003189779030137840365455304, 0.03289971165639457573171000603907, 0.03292941821412315173134288670553, 0.03295915159517413817180653268224, 0.03298891182376741115778173707440, 0.03301869892414478757647344764337, 0.03304851292056997652535343945601, 0.03307835383732852380100908362692, 0.03310822169872797149370313718464, 0.03313811652909780941511641572106, 0.03316803835278944040387827385530, 0.03319798719417630522565687556380, 0.03322796307765385481758357855142, 0.03325796602763951559378341471529, 0.03328799606857281434546536047492, 0.03331805322491535048534672114329, 0.03334813752115074053650189966902, 0.03337824898178477772692218650263, 0.03340838763134538341725843224594, 0.03343855349438255852856372030146, 0.03346874659546853619795925283142, 0.03349896695919774014527092731441, 0.03352921461018673610077200919477, 0.03355948957307437752195511393438, 0.03358979187252177089906268747654, 0.03362012153321222024393577498813, 0.03365047857985138668457381072585, 0.03368086303716723295398338677842, 0.03371127492990999563460263743764, 0.03374171428285231005839150952852, 0.03377218112078918949015005068759, 0.03380267546853797655526108201229, 0.03383319735093846813978046839111, 0.03386374679285290845154321459631, 0.03389432381916591269233052230447, 0.03392492845478464746911129168438, 0.03395556072463874058842137060310, 0.03398622065368030187304526634762, 0.03401690826688400642874299251162, 0.03404762358924709464425006899546, 0.03407836664578930280233848293392, 0.03410913746155303655216428637686, 0.03413993606160330152032855721700, 0.03417076247102768249419568746816, 0.03420161671493646832198365359545, 0.03423249881846263803497620870075, 0.03426340880676177758079603563601, 0.03429434670501226717354015249839, 0.03432531253841521884373477746522, 0.03435630633219443480497190535061, 0.03438732811159656010957519356452, 0.03441837790189102713744873085489, 0.03444945572837002784050142167871, 0.03448056161634865945941896825389, 0.03451169559116486207361873539412, 0.03454285767817941166235584660171, 0.03457404790277603112702564658321, 0.03460526629036137641337589343493, 0.03463651286636496018367381566350, 0.03466778765623933916684151768095, 0.03469909068546004476951694073250, 0.03473042197952554838158434336037, 0.03476178156395741403184018736283, 0.03479316946430024287684190653636, 0.03482458570612163850643838713950, 0.03485603031501235959943585385190, 0.03488750331658627135134054242371, 0.03491900473648028996320746841775, 0.03495053460035455611398802489020, 0.03498209293389238638827265504005, 0.03501367976280021082624571704400, 0.03504529511280773945713917782996, 0.03507693900966791372697528572644, 0.03510861147915687180409705092643, 0.03514031254707407347925851581749, 0.03517204223924230016562475498176, 0.03520380058150755775425722049476, 0.03523558759973927784203695523502, 0.03526740331983022752604384209008, 0.03529924776769650246466270004930, 0.03533112096927767259435526625566, 0.03536302295053671274072115693343, 0.03539495373745997486292225175930, 0.03542691335605736152603029154307, 0.03545890183236223569540612743367, 0.03549091919243142073669972091920, 0.03552296546234532531594041415701, 0.03555504066820790176617350653032, 0.03558714483614661139299073511211, 0.03561927799231258406909006453134, 0.03565144016288054884533664790069, 0.03568363137404879925629330728043, 0.03571585165203936679256813135908, 0.03574810102309795151187543638116, 0.03578037951349388040567234270384, 0.03581268714952027393261246857037, 0.03584502395749399744628860275952, 0.03587738996375559180629366551329, 0.03590978519466948154503782575375, 0.03594220967662385690655213466016, 0.03597466343603070854095804520512, 0.03600714649932591771008816294852, 0.03603965889296923547080453431590, 0.03607220064344424798052912706225, 0.03610477177725852221401581232385, 0.03613737232094355045219913336041, 0.03617000230105472252661868992618, 0.03620266174417145765840331250729, 0.03623535067689720445827106232173, 0.03626806912585933684312067271094, 0.03630081711770935526395476244943, 0.03633359467912281037804689276527, 0.03636640183679929611004766343285, 0.03639923861746256067428717528855, 0.03643210504786048575809331850905, 0.03646500115476505182732225307518, 0.03649792696497245608755477519480, 0.03653088250530310554520241339560, 0.03656386780260156843525010117446, 0.03659688288373669912134644732760, 0.03662992777560161727912202422885, 0.03666300250511366626282594438635, 0.03669610709921455188320393858703, 0.03672924158487032159081664417499, 0.03676240598907128814820666207197, 0.03679560033883221004114005836527, 0.03682882466119224290634903695718, 0.03686207898321487014259290049267, 0.03689536333198811107747516757627, 0.03692867773462441688403501416360, 0.03696202221826065670295946574697, 0.03699539681005828417603709112882, 0.03702880153720326805721896334944, 0.03706223642690605751814914015085, 0.03709570150640173480383054993581, 0.03712919680294998747704937613889, 0.03716272234383503209054211424700, 0.03719627815636580153713097729451, 0.03722986426787588259967876069823, 0.03726348070572347431772541881401, 0.03729712749729154758204785480302, 0.03733080466998780350129649718838, 0.03736451225124460401305626078283, 0.03739825026851918005066366390565, 0.03743201874929352052090436586695, 0.03746581772107439312069487868939, 0.03749964721139344148159722180935, 0.03753350724780719210871282598418, 0.03756739785789697111395568640546, 0.03760131906926908462729386428691, 0.03763527090955476328559825560660, 0.03766925340641012059927916766355, 0.03770326658751629866905830112955, 0.03773731048057945430818094223469, 0.03777138511333067577568911588060, 0.03780549051352616318766308722843, 0.03783962670894719382275184216269, 0.03787379372740003885544624040449, 0.03790799159671615764510832491396, 0.03794222034475213528592618672519, 0.03797647999938965485133834931730, 0.03801077058853561535523013503735, 0.03804509214012214562972147291475, 0.03807944468210651411954614786737, 0.03811382824247128847661159056770, 0.03814824284922431474331716572124, 0.03818268853039867571919074862308, 0.03821716531405280198319118767358, 0.03825167322827048577149611219284, 0.03828621230116079771077508553390, 0.03832078256085825335164329885629, 0.03835538403552279235197985940431, 0.03839001675333968827130703971307, 0.03842468074251974285981958701086, 0.03845937603129923748612739586861, 0.03849410264793987068721037303476, 0.03852886062072893164076603511603, 0.03856364997797925853184608513402, 0.03859847074802916916391737345293, 0.03863332295924264830899730327474, 0.03866820664000929219650259938135, 0.03870312181874426687988588469125, 0.03873806852388845395340766231129, 0.03877304678390842279656069990779, 0.03880805662729637506291879844866, 0.03884309808257031121359048597697, 0.03887817117827396806717388244579, 0.03891327594297681186086279581104, 0.03894841240527414927274918454714, 0.03898358059378712742182315764694, 0.03901878053716265060124612773507, 0.03905401226407356762848621656303, 0.03908927580321861633416702375143, 0.03912457118332238192870420334657, 0.03915989843313544965797134977947, 0.03919525758143437010883047832976, 0.03923064865702159675908688996060, 0.03926607168872567332762457681383, 0.03930152670540117132436108704496, 0.03933701373592864147799019747254, 0.03937253280921478026943560735162, 0.03940808395419239523738141883769, 0.03944366719982033558933309791428, 0.03947928257508367955175287988823, 0.03951493010899367885890853813180, 0.03955060983058769630282824891765, 0.03958632176892940002232990082121, 0.03962206595310868717518815174117, 0.03965784241224166312145271717782, 0.03969365117547078714022035228481, 0.03972949227196483079627142842583, 0.03976536573091883630670650973116, 0.03980127158155427613550614296400, 0.03983720985311901829906133798431, 0.03987318057488725003834062476926, 0.03990918377615967904681326672289, 0.03994521948626346408151022160382, 0.03998128773455216639076681417464, 0.04001738855040593012546423778986, 0.04005352196323143376677222704529, 0.04008968800246182073721001870581, 0.04012588669755690062856956501491, 0.04016211807800307981297649462249, 0.04019838217331329899284497741974, 0.04023467901302724136769484175602, 0.04027100862671125630631863145936, 0.04030737104395830383563037457861, 0.04034376629438816974637660450753, 0.04038019440764734763193999356190, 0.04041665541340904582723325688676, 0.04045314934137334006436503841542, 0.04048967622126712490038258351888, 0.04052623608284405126722660384075, 0.04056282895588472076076058669969, 0.04059945487019662319072565992428, 0.04063611385561408106958936059527, 0.04067280594199844390157494444793, 0.04070953115923801185482844289254, 0.04074628953724799412805523957104, 0.04078308110597071017844328366664, 0.04081990589537549257714843520262, 0.04085676393545866619261275332065, 0.04089365525624371472401819005427, 0.04093057988778123906792316688552, 0.04096753786014888792932353567267, 0.04100452920345155211068188805257, 0.04104155394782129512298851636842, 0.04107861212341733236907970194807, 0.04111570376042616992151579324855, 0.04115282888906156288921778241274, 0.04118998753956450153967949745493, 0.04122717974220332926016396868363, 0.04126440552727372867991562088719, 0.04130166492509867309790294598315, 0.04133895796602857219959048507008, 0.04137628468044126511804492452029, 0.04141364509874191635052653737148, 0.04145103925136323780309410835798, 0.04148846716876541940166589483852, 0.04152592888143607358086839553835, 0.04156342441989042263417175604445, 0.04160095381467123626384463364047, 0.04163851709634879688648467777057, 0.04167611429552105228868441599843, 0.04171374544281358093256173447116, 0.04175141056887955726129035838312, 0.04178910970439988353808402621326, 0.04182684288008318290730258581789, 0.04186461012666571612772514754397, 0.04190241147491159667826110535316, 0.04194024695561268667454157821339, 0.04197811659958860380781331400613, 0.04201602043768683930613505594920, 0.04205395850078277181216535041131, 0.04209193081977955636086008439634, 0.04212993742560833948518350666745, 0.04216797834922819676606309258204, 0.04220605362162607732123831283388, 0.04224416327381698421650213504108, 0.04228230733684393977123150420994, 0.04232048584177789535276659194096, 0.04235869881971796729880352927466, 0.04239694630179131895619804026865, 0.04243522831915316068096544199761, 0.04247354490298690943284043441963, 0.04251189608450414020301977302552, 0.04255028189494452356411713367379, 0.04258870236557603383698022980752, 0.04262715752769485194617615775314, 0.04266564741262537235888530062766, 0.04270417205172031410720379085433, 0.04274273147636074160482522188431, 0.04278132571795595362473818568105, 0.04281995480794369840493729384434, 0.04285861877779010425948413853803, 0.04289731765898963794514386904666, 0.04293605148306527813373278945619, 0.04297482028156846683986103130337, 0.04301362408607906778756913013240, 0.04305246292820551906599391145392, 0.04309133683958481925158068293058, 0.04313024585188243720246248358308, 0.04316918999679253410306500882143, 0.04320816930603785938069805183659, 0.04324718381136975070555550360041, 0.04328623354456828664638123882469, 0.04332531853744224503710569251780, 0.04336443882182903358790682091239, 0.04340359442959491192981502649673, 0.04344278539263488753130459940621, 0.04348201174287269488161200570175, 0.04352127351226098284087129286490, 0.04356057073278123831228114681835, 0.04359990343644375848652927629701, 0.04363927165528781043635220271426, 0.04367867542138161029985354844030, 0.04371811476682222613598938210089, 0.04375758972373579996917314360871, 0.04379710032427749227812441290553, 0.04383664660063139872914206307541, 0.04387622858501076528181528146888, 0.04391584630965791880008453063056, 0.04395549980684423235777202876307, 0.04399518910887028483314153959327, 0.04403491424806581927553494892891, 0.04407467525678970821090274512244, 0.04411447216743010629746990503008, 0.04415430501240440869237247056844, 0.04419417382415922329608193308559, 0.04423407863517050953028331150563, 0.04427401947794357139898124842148, 0.04431399638501297422177316320813, 0.04435400938894273892287856142502, 0.04439405852232630039777561137271, 0.04443414381778642424647429720608, 0.04447426530797542881812134396569, 0.04451442302557510888316727459824, 0.04455461700329669400000298651321, 0.04459484727388102892620125317080, 0.04463511387009851116847158891687, 0.04467541682474906322708463335402, 0.04471575617066229219043194120786, 0.04475613194069745504055646279085, 0.04479654416774340314200131274447, 0.04483699288471874877526346381273, 0.04487747812457184432011203512047, 0.04491799992028069898886144528660, 0.04495855830485319393208243354820, 0.04499915331132699897187521287378, 0.04503978497276955178518775824159, 0.04508045332227821055948169259864, 0.04512115839298024011494447904624, 0.04516190021803270782108086223161, 0.04520267883062272645799950510082, 0.04524349426396735707189833419761, 0.04528434655131359509727673184898, 0.04532523572593850913481361430968, 0.04536616182114923401247352785504, 0.04540712487028289445767370580143, 0.04544812490670679244741947400144, 0.04548916196381836557494082740050, 0.04553023607504511766075339096460, 0.04557134727384483385836944080438, 0.04561249559370548350978324947391, 0.04565368106814522014547108597071, 0.04569490373071252026226929388031, 0.04573616361498616944558648356178, 0.04577746075457517910267668526103, 0.04581879518311900850724427414207, 0.04586016693428746071603541167860, 0.04590157604178068256883804565405, 0.04594302253932933122193560393498, 0.04598450646069451169806185930611, 0.04602602783966773525303750602689, 0.04606758671007110672590556532668, 0.04610918310575726902778015414697, 0.04615081706060935456958915779069, 0.04619248860854116567331573151023, 0.04623419778349712599974097315680, 0.04627594461945224585397440364432, 0.04631772915041226096333204509392, 0.04635955141041365329401813255572, 0.04640141143352351227324703586419, 0.04644330925383981234499941592730, 0.04648524490549128806993195439645, 0.04652721842263740636980173803749, 0.04656922983946858857207118376209, 0.04661127919020609244871167220481, 0.04665336650910202609399135553758, 0.04669549183043947976345933170705, 0.04673765518853252587394564443457, 0.04677985661772610798125882070053, 0.04682209615239629058036641140461, 0.04686437382695016196088033666456, 0.04690668967582579951258736628006, 0.04694904373349246401447842913512, 0.04699143603445053024580957412581, 0.04703386661323145229163245062409, 0.04707633550439794395403581006576, 0.04711884274254392324099427469264, 0.04716138836229446379411101020196, 0.04720397239830598223875313124154, 0.04724659488526619655068827796640, 0.04728925585789405666714557696650, 0.04733195535093995265363275848358, 0.04737469339918564531499711733886, 0.04741747003744421068427428167524, 0.04746028530056025512839923408137, 0.04750313922340984595926727251936, 0.04754603184090045592258277906694, 0.04758896318797115748688852931991, 0.04763193329959257427130836504148, 0.04767494221076682553439596290445, 0.04771798995652770658537633607921, 0.04776107657194066796746412251196, 0.04780420209210271831334893022358, 0.04784736655214265332869416624817, 0.04789056998722097946430409365348, 0.04793381243252987228276040809760, 0.04797709392329337074745154723132, 0.04802041449476730783363365162586, 0.04806377418223927583396104523672, 0.04810717302102882064751554480608, 0.04815061104648735157418570906884, 0.04819408829399814825356074265983, 0.04823760479897650638170247816561, 0.04828116059686969607778195268111, 0.04832475572315692025071598436625, 0.04836839021334950194930257794113, 0.04841206410299080803438798170646, 0.04845577742765624917886668754363, 0.04849953022295341170666560515201, 0.04854332252452205065385015814172, 0.04858715436803402037968524496137, 0.04863102578919344803898283657873, 0.04867493682373671970431416866631, 0.04871888750743240403817679862186, 0.04876287787608143964313001106348, 0.04880690796551710036732529829351, 0.04885097781160492591556732122626, 0.04889508745024293001613102660485, 0.04893923691736153797071651183614, 0.04898342624892353114329779373293, 0.04902765548092424124915211791631, 0.04907192464939152953817824709404, 0.04911623379038566883370009463761, 0.04916058293999959333264726524249, 0.04920497213435884309440382367029, 0.04924940140962145301850583223313, 0.04929387080197823040039750708274, 0.04933838034765263697023485178761, 0.04938293008290076807620394561127, 0.04942752004401153309576244510026, 0.04947215026730662768006396845522, 0.04951682078914042967054953692241, 0.04956153164590024889912811545400, 0.04960628287400624392144976582131, 0.04965107450991137344464831926416, 0.04969590659010159755526458980057, 0.04974077915109582220809514296889, 0.04978569222944584371504106456996, 0.04983064586173653609524336616232, 0.04987564008458582331950736943327, 0.04992067493464459604357585931211, 0.04996575044859693365273400900151, 0.05001086666316003487287034090514, 0.05005602361508416919821939927715, 0.05010122134115285730260325181007, 0.05014645987818286410053758572758, 0.05019173926302409466382314917610, 0.05023705953255980238836286844162, 0.05028242072370656123858623232081, 0.05032782287341419635851025304873, 0.05037326601866596448298096788676, 0.05041875019647853312099172740091, 0.05046427544390189728895634857508, 0.05050984179801958767752623202796, 0.05055544929594863595712084247680, 0.05060109797483949151120086185074, 0.05064678787187623654197921041487, 0.05069251902427652362037591160515, 0.05073829146929152711376076467786, 0.05078410524420615135277046192641, 0.05082996038633895430347564570184, 0.05087585693304211981180529278390, 0.05092179492170162413700040815456, 0.05096777438973721513493231327629, 0.05101379537460234286916360701980, 0.05105985791378436083887137897364, 0.05110596204480446352880207427916, 0.05115210780521763783701416627991, 0.05119829523261288511948308155297, 0.05124452436461313792337435302215, 0.05129079523887519753699848479300, 0.05133710789308996991220368499853, 0.05138346236498240321433073063417, 0.05142985869231140455548612067105, 0.05147629691287006203914700108726, 0.05152277706448559618790383751730, 0.05156929918501930443230918399422, 0.05161586331236674152211918453759, 0.05166246948445768483182405361731, 0.05170911773925607191060294098861, 0.05175580811476022252692885672332, 0.05180254064900274152405401650867, 0.05184931538005050494222203383288, 0.05189613234600484042990942157303, 0.05194299158500148561046216855175, 0.05198989313521051175426279655767, 0.05203683703483656664001699709843, 0.05208382332211877741023897669947, 0.05213085203533070199899412955347, 0.05217792321278057199318567427326, 0.05222503689281118854914609528350, 0.05227219311379989463706152719169, 0.05231939191415876239110716028335, 0.05236663333233457229276552880037, 0.05241391740680870214852404842532, 0.05246124417609739076784336475612, 0.05250861367875163387974879469766, 0.05255602595335715637725471083286, 0.05260348103853462048418165863950, 0.05265097897293955636621731741798, 0.05269851979526229274197746121899, 0.05274610354422819974429259559656, 0.05279373025859761953126891853572, 0.05284139997716578995845537747300, 0.05288911273876306662344859432778, 0.05293686858225487429363553815165, 0.05298466754654164445614838996335, 0.05303250967055901654578775605842, 0.05308039499327778937276534065859, 0.05312832355370385867265881074673, 0.05317629539087842527322891328367, 0.05322431054387796039994995567213, 0.05327236905181410159260124714820, 0.05332047095383391638323544725608, 0.05336861628911980515166391114690, 0.05341680509688946643098717004250, 0.05346503741639609119662424063790, 0.05351331328692832817184310556513, 0.05356163274781018668324605869202, 0.05360999583840130727763195750413, 0.05365840259809684376079985668184, 0.05370685306632743544197339247148, 0.05375534728255942223951180380936, 0.05380388528629478223086479715676, 0.05385246711707106226363350742758, 0.05390109281446159306128151911253, 0.05394976241807546840645315455731, 0.05399847596755742717977710753985, 0.05404723350258809622115308002321, 0.05409603506288394869638835871228, 0.05414488068819722083047096816699, 0.05419377041831612701328069192641, 0.05424270429306482510511955297261, 0.05429168235230331929219715902946, 0.05434070463592770988681124322284, 0.05438977118387012393840862500838, 0.05443888203609863890575226719193, 0.05448803723261752551820791268256, 0.05453723681346717144791114151303, 0.05458648081872403273751004348924, 0.05463576928850082808919452759255, 0.05468510226294651110912070635095, 0.05473447978224619397957795285947, 0.05478390188662135562580601799709, 0.05483336861632980702152551089057, 0.05488288001166560792221105202771, 0.05493243611295929584859010219589, 0.05498203696057782363659782731702, 0.05503168259492449698733196328249, 0.05508137305643920345055164489168, 0.05513110838559834303573836677970, 0.05518088862291477270094475215956, 0.05523071380893802145850557394624, 0.05528058398425422792499261959165, 0.05533049918948608481006345982678, 0.05538045946529306789996027760026, 0.05543046485237135972967692509883, 0.05548051539145378713291378858230, 0.05553061112331007104225832904376, 0.05558075208874672240577652360116, 0.05563093832860701443143724986840, 0.05568116988377119769282330707938, 0.05573144679515643074019237701577, 0.05578176910371671765043188884192, 0.05583213685044315088834565585785, 0.05588255007636382110103312470528, 0.05593300882254378242341985583153, 0.05598351313008524676728683289184, 0.05603406304012756300458875102777, 0.05608465859384709900625765044424, 0.05613529983245753307574688051318, 0.05618598679720972904894082944338, 0.05623671952939172241636711646606, 0.05628749807032890767333199733002, 0.05633832246138401056434474867274, 0.05638919274395699787749691722638, 0.05644010895948531336685505266360, 0.05649107114944382224130947633967, 0.05654207935534474871452914612746, 0.05659313361873787723288486972706, 0.05664423398121052471987368903683, 0.05669538048438746424828593717393, 0.05674657316993113320702235569115, 0.05679781207954161248441238285523, 0.05684909725495651544591169113119, 0.05690042873795125855096443956427, 0.05695180657033896420848861907871, 0.05700323079397041914351262903438, 0.05705470145073428950288629835086, 0.05710621858255707922191746206408, 0.05715778223140303981875121053235, 0.05720939243927442019455043009657, 0.05726104924821137642787505228625, 0.05731275270029195095800034209788, 0.05736450283763226687394620739724, 0.05741629970238647240332596766166, 0.05746814333674667846230121881490, 0.05752003378294320845576237388741, 0.05757197108324450113281400831511, 0.05762395527995706201451753258880, 0.05767598641542570625517782900715, 0.05772806453203347537561640478998, 0.05778018967220158869091406472762, 0.05783236187838966535501583621226, 0.05788458119309566191068583407286, 0.05793684765885579596167431759568, 0.05798916131824482372847384681336, 0.05804152221387592208712291608208, 0.05809393038840063999694862673095, 0.05814638588450914830074722772224, 0.05819888874493017727473898048629, 0.05825143901243090560626569640590, 0.05830403672981726570512250873435, 0.05835668193993381186457369835807, 0.05840937468566370638356488598220, 0.05846211500992890691685843762571, 0.05851490295569015953613956071422, 0.05856773856594687382992603374987, 0.05862062188373739352043045869323, 0.05867355295213894095240902970545, 0.05872653181426750607085907063265, 0.05877955851327812397677519129502, 0.05883263309236481247710415232177, 0.05888575559476045412354849872827, 0.05893892606373709458500442792683, 0.05899214454260585244194103893278, 0.05904541107471684979746129329214, 0.05909872570345943432190694011297, 0.05915208847226215843617680434363, 0.05920549942459267522831822816443, 0.05925895860395798131481370774054, 0.05931246605390437520721746977870, 0.05936602181801735322874691291872, 0.05941962593992188013114486011546, 0.05947327846328230582795271175200, 0.05952697943180231682225311828915, 0.05958072888922515131238100138944, 0.05963452687933355061966622656655, 0.05968837344594968286060066020582, 0.05974226863293538580812480631721, 0.05979621248419211831937047918473, 0.05985020504366085625225224475798, 0.05990424635532235614343576912688, 0.05995833646319711357497439507824, 0.06001247541134523133532496785847, 0.06006666324386672473067960709159, 0.06012090000490142444045105207806, 0.06017518573862890712833362272249, 0.06022952048926873830358985628664, 0.06028390430108043068768708394600, 0.06033833721836334706978277608869, 0.06039281928545695010690508297557, 0.06044735054674074681280160348251, 0.06050193104663419835231863430636, 0.06055656082959699759715732625409, 0.06061123994012897198135902954164, 0.06066596842277001411236625472156, 0.06072074632210035238788492506501, 0.06077557368274047466805143358215, 0.06083045054935103806981189222824, 0.06088537696663313958378438428554, 0.06094035297932823280753211747651, 0.06099537863221807243441219270608, 0.06105045397012494323707443300009, 0.06110557903791161843409796006199, 0.06116075388048125560658263566438, 0.06121597854277768119279912184538, 0.06127125306978528640478032230021, 0.06132657750652897865606405503058, 0.06138195189807444523966140081939, 0.06143737628952803536686033680780, 0.06149285072603674628943792868085, 0.06154837525278842452758354397702, 0.06160394991501173811432323645931, 0.06165957475797607251211118750689, 0.06171524982699180816858586240414, 0.06177097516741023031094925954676, 0.06182675082462346649592177527666, 0.06188257684406474334881664844943, 0.06193845327120831023570701745484, 0.06199438015156935599669907333009, 0.06205035753070429344058211995616, 0.06210638545421066913920782326386, 0.06216246396772707322186946043985, 0.06221859311693343774773978793746, 0.06227477294755092568356857896106, 0.06233100350534188233142529611541, 0.06238728483611007818998572815872, 0.06244361698570064650448685483752, 0.06250000000000000000000000000000, 0.06255643392493612231497479569953, 0.06261291880647835983442206497784, 0.06266945469063765761230655471081, 0.06272604162346644141035056918554, 0.06278267965105871484254862480157, 0.06283936881955017039746991258653, 0.06289610917511810617153145130942, 0.06295290076398148138014931873840, 0.06300974363240109676898015322877, 0.06306663782667941420267965213498, 0.06312358339316073707614407339861, 0.06318058037823127970344927462065, 0.06323762882831904241776044273138, 0.06329472878989399198257359557829, 0.06335188030946808934729119755502, 0.06340908343359523413607092834354, 0.06346633820887136179234033761531, 0.06352364468193456847888711536143, 0.06358100289946494454440539811912, 0.06363841290818479656810069400308, 0.06369587475485861960411426707651, 0.06375338848629312493709875298009, 0.06381095414933724008221815893194, 0.06386857179088228919638936531555, 0.06392624145786186817819185534972, 0.06398396319725195569017017760416, 0.06404173705607098254777298507179, 0.06409956308137979008598961172538, 0.06415744132028174118165253503321, 0.06421537181992273413122518377349, 0.06427335462749121652858974584888, 0.06433138979021824077619839954423, 0.06438947735537756122958796822786, 0.06444761737028555093065307346478, 0.06450580988230131262994859753235, 0.06456405493882677593120433812146, 0.06462235258730660014681035363537, 0.06468070287522829919790723351980, 0.06473910585012232488111294514965, 0.06479756155956195584622037131339, 0.06485607005116346412965100398651, 0.06491463137258617066560617558935, 0.06497324557153236201934021210036, 0.06503191269574737365388727994286, 0.06509063279301975646351507975851, 0.06514940591118112411805896044825, 0.06520823209810630571858780513139, 0.06526711140171335967519183896002, 0.06532604386996362921813386037684, 0.06538502955086171464227362548627, 0.06544406849245561208494592619900, 0.06550316074283669964817278241753, 0.06556230635013970964308782640728, 0.06562150536254295063454122782787, 0.06568075782826815478543380777410, 0.06574006379558057500123169347717, 0.06579942331278915146342001207813, 0.06585883642824633121826138903998, 0.06591830319034824858803744973557, 0.06597782364753482231556347414880, 0.06603739784828960290852251091565, 0.06609702584113992529513126328311, 0.06615670767465704760201816725385, 0.06621644339745595686519408218373, 0.06627623305819560495244502362766, 0.06633607670557888080775654771060, 0.06639597438835262432910155894206, 0.06645592615530769575737934928839, 0.06651593205527903118756682943058, 0.06657599213714565644650633657875, 0.06663610644983067321511782665766, 0.06669627504230148107300379933804, 0.06675649796356956933163218081972, 0.06681677526269073907894124886298, 0.06687710698876511705712744060293, 0.06693749319093708627370631347731, 0.06699793391839545253496623899991, 0.06705842922037347220154401838954, 0.06711897914614878279948584349768, 0.06717958374504351404254975932417, 0.06724024306642444048787154997626, 0.06730095715970278724693542926616, 0.06736172607433443815239115792792, 0.06742254985981999126920527487528, 0.06748342856570463399457082687150, 0.06754436224157836510251229356072, 0.06760535093707595311052216402459, 0.06766639470187695015734874459667, 0.06772749358570578914751081356371, 0.06778864763833182538466104460895, 0.06784985690956930881601039118323, 0.06791112144927746729905493339174, 0.06797244130736060374609053269523, 0.06803381653376802673527379283769, 0.06809524717849416153292452236201, 0.06815673329157860560467696586784, 0.06821827492310608698211638056819, 0.06827987212320658916286930661954, 0.06834152494205536498839137493633, 0.06840323342987296439954292281982, 0.06846499763692524831437680177260, 0.06852681761352355516159207127203, 0.06858869341002454822486811281124, 0.06865062507683042380968174711597, 0.06871261266438886960994381070122, 0.06877465622319314797472600275796, 0.06883675580378204039710965389531, 0.06889891145674005568100284335742, 0.06896112323269733279662574432223, 0.06902339118232971026944966297378, 0.06908571535635882332471169320343, 0.06914809580555209000962690879533, 0.06921053258072272507117617124095, 0.06927302573272992036734763132699, 0.06933557531247869221147084317636, 0.06939818137092006178345826583609, 0.06946084395905109676316868672075, 0.06952356312791485581925599035458, 0.06958633892860047187589600525826, 0.06964917141224327701287677427899, 0.06971206063002474695444732333272, 0.06977500663317251494710546921851, 0.06983800947296057992641493683550, 0.06990106920070913998355166540932, 0.06996418586778474502096969445120, 0.07002735952560042165249143408801, 0.07009059022561549279206616347437, 0.07015387801933579969837495582397, 0.07021722295831374360819410185286, 0.07028062509414817471409264726390, 0.07034408447848457257567389433461, 0.07040760116301511550851444098953, 0.07047117519947856956186171828449, 0.07053480663966042729651206855124, 0.07059849553539300492932540009861, 0.07066224193855535906649834032578, 0.07072604590107339772586669823795, 0.07078990747491994972584450351860, 0.07085382671211473692984839090059, 0.07091780366472445751302444705289, 0.07098183838486284147339944183841, 0.07104593092469066450966863612848, 0.07111008133641577577677139743173, 0.07117428967229322278598147022421, 0.07123855598462519589375574469159, 0.07130288032576106993509768017248, 0.07136726274809759851258661456086, 0.07143170330407876134071187834707, 0.07149620204619587526817525713341, 0.07156075902698776081134468540768, 0.07162537429904057562080055276965, 0.07169004791498796713700158989013, 0.07175477992751118361258733102659, 0.07181957038933897696786345932196, 0.07188441935324769993531646150586, 0.07194932687206141708191609041023, 0.07201429299865184929796413371150, 0.07207931778593844318603345300289, 0.07214440128688849596105825412451, 0.07220954355451707218360724027661, 0.07227474464188708702661045890636, 0.07234000460210944505323737985236, 0.07240532348834294307238224064349, 0.07247070135379438116096650901454, 0.07253613825171867368624134542188, 0.07260163423541872440569733271332, 0.07266718935824560687830597771608, 0.07273280367359859222009532686570, 0.07279847723492514910414996620602, 0.07286421009572095763839882920365, 0.07293000230953010365464450615036, 0.07299585392994492605289735820406, 0.07306176501060619721261701897674, 0.07312773560520313687050020234892, 0.07319376576747341212048070246965, 0.07325985555120320680266843282880, 0.07332600501022733252565188877270, 0.07339221419842913152198349280297, 0.07345848316974062930384548053553, 0.07352481197814257629641332414394, 0.07359120067766444783785573235946, 0.07365764932238445805712245828545, 0.07372415796642974028518580098535, 0.07379072666397624991052595078145, 0.07385735546924880601249441269829, 0.07392404443652131340591893149394, 0.07399079362011659610764979788655, 0.07405760307440652223665011888443, 0.07412447285381211503629828030171, 0.07419140301280349736323671550053, 0.07425839360589994719852313664887, 0.07432544468767006418108422849400, 0.07439255631273163082983757021793, 0.07445972853575175132156971358199, 0.07452696141144694863545083762801, 0.07459425499458312291967132523496, 0.07466160933997557924701737874784, 0.07472902450248920802611252156566, 0.07479650053703837397911513562576, 0.07486403749858701328623311610500, 0.07493163544214878624138975737878, 0.07499929442278691071877005924762, 0.07506701449561435646185003633946, 0.07513479571579394222791137281092, 0.07520263813853819701016334420274, 0.07527054181910951269340870339875, 0.07533850681282024119855833532711, 0.07540653317503262509369221788802, 0.07547462096115888086078626884046, 0.07554277022666135155137823176119, 0.07561098102705235413090179008577, 0.07567925341789435988992806869646, 0.07574758745480007771089248080898, 0.07581598319343232916800445764238, 0.07588444068950425669406456563593, 0.07595295999877930970267669863460, 0.07602154117707125846603588570360, 0.07609018428024427738165513801505, 0.07615888936421302823909229573474, 0.07622765648494259083101098894986, 0.07629648569844861560884652362802, 0.07636537706079735143838149724616, 0.07643433062810561784417018316162, 0.07650334645654094378741660875676, 0.07657242460232159542155017106779, 0.07664156512171653445886221334149, 0.07671076807104555694838410317971, 0.07678003350667937654261407942613, 0.07684936148503951347521478965064, 0.07691875206259846109446698392276, 0.07698820529587974137442074606952, 0.07705772124145789103710768586097, 0.07712729995595848930811655463913, 0.07719694149605833832783474690586, 0.07726664591848531049578241436393, 0.07733641328001857051521739094824, 0.07740624363748853375977176938250, 0.07747613704777693566239094025150, 0.07754609356781683171533359200112, 0.07761611325459275012583759689733, 0.07768619616514063630496877976839, 0.07775634235654792225655995707712, 0.07782655188595362372172559162209, 0.07789682481054832630107398472319, 0.07796716118757422708807069966497, 0.07803756107432530120249225547013, 0.07810802452814716301254804875498, 0.07817855160643721879054623968841, 0.07824914236664476385740840669314, 0.07831979686627092707151831518786, 0.07839051516286871246208534103062, 0.07846129731404319351817377992120, 0.07853214337745137441082476925658, 0.07860305341080231489314655846101, 0.07867402747185728295598039494507, 0.07874506561842957441665902251771, 0.07881616790838476271918722204646, 0.07888733439964067117866619582855, 0.07895856515016738685908137540537, 0.07902986021798732996224146063469, 0.07910121966117539260565649783530, 0.07917264353785882780023541727132, 0.07924413190621734659480068785342, 0.07931568482448332624290543435563, 0.07938730235094158815822851238408, 0.07945898454392963383696724122274, 0.07953073146183767261341301946231, 0.07960254316310858002658790155692, 0.07967441970623800884254706033971, 0.07974636114977450007668124953852, 0.07981836755231938584920214907470, 0.07989043897252690040744482757873, 0.07996257546910433278153362834928, 0.08003477710081188800650409120863, 0.08010704392646283977796883846167, 0.08017937600492364147442003741162, 0.08025177339511382901271474565874, 0.08032423615600613187037737361607, 0.08039676434662659798568995483947, 0.08046935802605451049096529914095, 0.08054201725342248485706164728981, 0.08061474208791660767126074915723, 0.08068753258877635337054101682952, 0.08076038881529466750830437149489, 0.08083331082681809165446651377351, 0.08090629868274670788430569245975, 0.08097935244253422204518955140884, 0.08105247216568810253445320768151, 0.08112565791176946927709678902829, 0.08119890974039321862587570421965, 0.08127222771122816213917872119055, 0.08134561188399691555872550452477, 0.08141906231847599595408127015617, 0.08149257907449598825611047914208, 0.08156616221194144811246218296219, 0.08163981179075095739872125477632, 0.08171352787091733238522550664129, 0.08178731051248745720361199573745, 0.08186115977556245038027071814213, 0.08193507572029777585864707134533, 0.08200905840690311809915158391959, 0.08208310789564257636818922492239, 0.08215722424683466473815940389613, 0.08223140752085235372081939431155, 0.08230565777812309802285994919657, 0.08237997507912900307935899490985, 0.08245435948440667239811574518171, 0.08252881105454742960425562614546, 0.08260332985019734619580589196630, 0.08267791593205717215475658576906, 0.08275256936088250248051423341167, 0.08282729019748383270105307474296, 0.08290207850272650336176383234488, 0.08297693433753081104775617404812, 0.08305185776287214716173679107669, 0.08312684883978087302391912771782, 0.08320190762934244477211365165203, 0.08327703419269759377296935554114, 0.08335222859104211845515663981132, 0.08342749088562713410954785331342, 0.08350282113775911452258071676624, 0.08357821940879979483174366805542, 0.08365368576016633805902955600686, 0.08372922025333143225545029508794, 0.08380482294982322111209782633523, 0.08388049391122535947129534861233, 0.08395623319917720761562662801225, 0.08403204087537370636784572752731, 0.08410791700156551586875508519370, 0.08418386163955911272172016879267, 0.08425987485121670672594262896382, 0.08433595669845636577655056953517, 0.08441210724325215464247662566777, 0.08448832654763399618857988571108, 0.08456461467368785178688739279096, 0.08464097168355579070553318388193, 0.08471739763943594847539486636379, 0.08479389260358261015682046490838, 0.08487045663830632136193088399523, 0.08494708980597384662125648446818, 0.08502379216900825265046393042212, 0.08510056378988904712823426734758, 0.08517740473115208155174826742950, 0.08525431505538967613677669987737, 0.08533129482525074471777060125532, 0.08540834410344065596998319733757, 0.08548546295272145545407482813971, 0.08556265143591190724947637136211, 0.08563990961588742456545020331760, 0.08571723755558018076339266144714, 0.08579463531797927589028773809332, 0.08587210296613058402304119454129, 0.08594964056313690592414644697783, 0.08602724817215813557513826026479, 0.08610492585641106588756343853674, 0.08618267367916961074758575023225, 0.08626049170376487440492496716615, 0.08633837999358508208391782545732, 0.08641633861207569100582048804426, 0.08649436762273950141111100720082, 0.08657246708913660104833809327829, 0.08665063707488446231863576940668, 0.08672887764365806717581364182479, 0.08680718885918985161520566862237, 0.08688557078526974730703358318351, 0.08696402348574538976322401140351, 0.08704254702452197955953039354426, 0.08712114146556244886898667800779, 0.08719980687288751697305855259401, 0.08727854331057564862828002105744, 0.08735735084276319284413148125168, 0.08743622953364445227197876420178, 0.08751517944747162769392190284634, 0.08759420064855495680067321018214, 0.08767329320126279745828412615083, 0.08775245717002155831920617856667, 0.08783169261931580984459344563220, 0.08791099961368846471554405752613, 0.08799037821774059742185869481546, 0.08806982849613162467328209004336, 0.08814935051357941642180549024488, 0.08822894433486024035051542568908, 0.08830861002480878962916932550797, 0.08838834764831844659216386617118, 0.08846815727034104681614223864017, 0.08854803895588711504238688121404, 0.08862799277002594844354632641625, 0.08870801877788550560133273847896, 0.08878811704465257303997560711650, 0.08886828763557284849294859441216, 0.08894853061595088539181830356029, 0.08902884605115019001075893356756, 0.08910923400659338800000597302642, 0.08918969454776208560797812197052, 0.08927022774019699458136756220483, 0.08935083364949812645416926670805, 0.08943151234132461213643949804464, 0.08951226388139488232553730995278, 0.08959308833548680628400262548894, 0.08967398576943752530610254325438, 0.08975495624914366088464845461203, 0.08983599984056139797772289057320, 0.08991711660970641561974048272532, 0.08999830662265397018817481011865, 0.09007956994553910357037551648318, 0.09016090664455644887453900082619, 0.09024231678596045247431334246357, 0.09032380043606541564216172446322, 0.09040535766124548067157462583054, 0.09048698852793468638822105276631, 0.09056869310262719019455346369796, 0.09065047145187704602520284424827, 0.09073232364229844026937144008116, 0.09081424974056578891534741160285, 0.09089624981341361265041456363178, 0.09097832392763670339430603917208, 0.09106047215009023532150678192920, 0.09114269454768969547231449723768, 0.09122499118741093926399088331891, 0.09130736213629044029094217194142, 0.09138980746142506828011420338953, 0.09147232722997231113559735149465, 0.09155492150915035820535337052206, 0.09163759036623804477006416391305, 0.09172033386857489367649520772829, 0.09180315208356136513767609130809, 0.09188604507865869019944682349887, 0.09196901292138899564054810298330, 0.09205205567933547050607501205377, 0.09213517342014224120738674628228, 0.09221836621151451029998469266502, 0.09230163412121870913917831558138, 0.09238497721708235910220707864937, 0.09246839556699422424390633068469, 0.09255188923890449170794880728863, 0.09263545830082454968223970581676, 0.09271910282082727883246064948253, 0.09280282286704702454649407172838, 0.09288661850767965244557444748352, 0.09297048981098254838428829316399, 0.09305443684527481273960347607499, 0.09313845967893720489971798315310, 0.09322255838041215714184772878070, 0.09330673301820405218798271107516, 0.09339098366087898728249427904302, 0.09347531037706502399231567324023, 0.09355971323545221596251764140106, 0.09364419230479260891630843843814, 0.09372874765390028228839724988575, 0.09381337935165159902517473256012, 0.09389808746698495578453247389916, 0.09398287206890103273604353262272, 0.09406773322646290458326490124819, 0.09415267100879591566364723576044, 0.09423768548508781872641293375636, 0.09432277672458892758822202040392, 0.09440794479661199223308187811199, 0.09449318977053236534580094030389, 0.09457851171578811333429115393301, 0.09466391070187993306284113259608, 0.09474938679837126287441861904881, 0.09483494007488842136854856335049, 0.09492057060112053801237408379166, 0.09500627844681966416295892940980, 0.09509206368180091184516555813389, 0.09517792637594234272935267426874, 0.09526386659918512078704111445404, 0.09534988442153365106879192580891, 0.09543597991305544092632828778733, 0.09552215314388130817935262939500, 0.09560840418420543662669786044717, 0.09569473310428533441296394812525, 0.09578113997444193117303257167805, 0.09586762486505974456552081619520, 0.09595418784658676925047871009156, 0.09604082898953458791169168762281, 0.09612754836447855166792209047344, 0.09621434604205766905060670524108, 0.09630122209297467539279580250877, 0.09638817658799629650712148531966, 0.09647520959795304051898057196013, 0.09656232119373936439998828973330, 0.09664951144631384050143196873250, 0.09673678042669903165418077151116, 0.09682412820598158831320034778400, 0.09691155485531249835773337508726, 0.09699906044590685116890682593294, 0.09708664504904407355212470065453, 0.09717430873606804075937048992273, 0.09726205157838692383354128878636, 0.09734987364747341165305272170372, 0.09743777501486480807635359724372, 0.09752575575216290704183563775587, 0.09761381593103417297907498095810, 0.09770195562320985183113464245253, 0.09779017490048588778783766883862, 0.09787847383472304818585740804338, 0.09796685249784706228659558746585, 0.09805531096184851025387985146153, 0.09814384929878303132078087855916, 0.09823246758077133766740018927521, 0.09832116587999922829865795392834, 0.09840994426871764455544422389721, 0.09849880281924290603701166446626, 0.09858774160395648855637062979440, 0.09867676069530524618489408794630, 0.09876586016580153615240789122254, 0.09885504008802310782488831364390, 0.09894430053461322760455232128152, 0.09903364157828085934109907384482, 0.09912306329180052555383184653692, 0.09921256574801246008732391601370, 0.09930214901982274688929663852832, 0.09939181318020322286610479523006, 0.09948155830219161666061467030886, 0.09957138445889168743008212913992, 0.09966129172347309994606234795356, 0.09975128016917161888343912323762, 0.09984134986928919208715171862423, 0.09993150089719389506104363363193, 0.10002173332632004199016506618136, 0.10011204723016833839643879855430, 0.10020244268230575623856992706351, 0.10029291975636570044549955582625, 0.10038347852604818932764629835219, 0.10047411906511963253230135251215, 0.10056484144741309472159684901271, 0.10065564574682839271702050609747, 0.10074653203733197059932535921689, 0.10083750039295703848640783917290, 0.10092855088780379457791269715017, 0.10101968359603920311062807968483, 0.10111089859189724415866606932468, 0.10120219594967898302240172370148, 0.10129357574375250083953403645864, 0.10138503804855300560738839976693, 0.10147658293858305422752152935573, 0.10156821048841233046111653948174, 0.10165992077267788085137567577476, 0.10175171386608423962361058556780, 0.10184358984340327602957643193804, 0.10193554877947440251428901092368, 0.10202759074920468573832721403960, 0.10211971582756874943331837357618, 0.10221192408960888542424072511494, 0.10230421561043527567402833255983, 0.10239659046522581187232958654931, 0.10248904872922623421338528260094, 0.10258159047775039507399696958601, 0.10267421578617996757998298562597, 0.10276692472996477867308584563943, 0.10285971738462280911097224134210, 0.10295259382574015183386961780343, 0.10304555412897116462023205940568, 0.10313859837003860886461836798844, 0.10323172662473351079981398470409, 0.10332493896891534190807249160571, 0.10341823547851214382120588197722, 0.10351161622952047280943332907555, 0.10360508129800545529253241738843, 0.10369863076010100988444406766575, 0.10379226469200970861539445877497, 0.10388598317000292958756091366013, 0.10397978627042102350852559311534, 0.10407367406967316103560960982577, 0.10416764664423751318711452995558, 0.10426170407066140399798825910693, 0.10435584642556117174194696417544, 0.10445007378562234934271657493809, 0.10454438622759978927412305438338, 0.10463878382831756641557774401008, 0.10473326666466911682995544197183, 0.10482783481361740429704809685063, 0.10492248835219480929126234514115, 0.10501722735750324000392197376641, 0.10511205190671431275450942166572, 0.10520696207706928260172674072237, 0.10530195794587907109907121139258, 0.10539703959052458548395492243799, 0.10549220708845642724416080682204, 0.10558746051719521130696222144252, 0.10568279995433157991691075494600, 0.10577822547752616100247280428448, 0.10587373716450972083169546067438, 0.10596933509308328891229677992669, 0.10606501934111807472493893556020, 0.10616078998655555098995506568826, 0.10625664710740771734531762149345, 0.10635259078175689217982125001072, 0.10644862108775587916653648790088, 0.10654473810362820318520249429639, 0.10664094190766786052204651014108, 0.10673723257823958254775220666488, 0.10683361019377893286197434008500, 0.10693007483279221014882409690472, 0.10702662657385661471032278768689, 0.10712326549562037336649211738404, 0.10721999167680264231083953063717, 0.10731680519619364588823628992031, 0.10741370613265487088394678494296, 0.10751069456511887223459922324764, 0.10760777057258953670615397868460, 0.10770493423414212452726701485517, 0.10780218562892322775592646166842, 0.10789952483615090905733069348571, 0.10799695193511485435955421507970, 0.10809446700517622019788177567534, 0.10819207012576786963720110179565, 0.10828976137639444166094193633398, 0.10838754083663229565992480729619, 0.10848540858612962245466349031631, 0.10858336470460663858439431805891, 0.10868140927185546140698590988904, 0.10877954236774022012124163438784, 0.10887776407219727781150453438386, 0.10897607446523507879199144099402, 0.10907447362693431514024666739715, 0.10917296163744806547502008697847, 0.10927153857700168393396467081402, 0.10937020452589299446266579707299, 0.10946895956449238795915590571894, 0.10956780377324275288497545943756, 0.10966673723265958628747540615223, 0.10976576002333121584442210405541, 0.10986487222591861945275582002068, 0.10996407392115560563983223119067, 0.11006336518984899397466392656497, 0.11016274611287843465667890541226, 0.11026221677119665831590111793048, 0.11036177724582954540188950431912, 0.11046142761787607067258676352139, 0.11056116796850842809440962355438, 0.11066099837897216962012691965356, 0.11076091893058617743328397864389, 0.11086092970474269170377823456874, 0.11096103078290757426582757716460, 0.11106122224662016984009227371644, 0.11116150417749340317818962375895, 0.11126187665721402886287449973679, 0.11136233976754242314122222978767, 0.11146289359031281984702133058818, 0.11156353820743343530086377768384, 0.11166427370088632953226692734461, 0.11176510015272761444649063378165, 0.11186601764508756484683971166305, 0.11196702626017053516793708922705, 0.11206812608025508437581407861217, 0.11216931718769419801251530088848, 0.11227059966491509390706937665527, 0.11237197359441943034230604325785, 0.11247343905878344483273423293213, 0.11257499614065785698002741810342, 0.11267664492276799337311388171656, 0.11277838548791399575499383445276, 0.11288021791897065448928572095610, 0.11298214229888761672704333705042, 0.11308415871068949742905829225492, 0.11318626723747578222134535508303, 0.11328846796242102168417176244475, 0.11339076096877492849657187434786, 0.11349314633986230804740813482567, 0.11359562415908319721324915008154, 0.11369819450991303089182338226237, 0.11380085747590254485750449475745, 0.11390361314067788678361381471404, 0.11400646158794083828702525806875, 0.11410940290146862063913602014509, 0.11421243716511413068825930849925, 0.11431556446280607963750242106471, 0.11441878487854886814467647582205, 0.11452209849642272510017448894359, 0.11462550540058390191600068419575, 0.11472900567526456150346803042339, 0.11483259940477290317328851187995, 0.11493628667349335692460243762980, 0.11504006756588644466710036340373, 0.11514394216648896063226459318685, 0.11524791055991412402903506517760, 0.11535197283085144026593127364322, 0.11545612906406692299565719395105, 0.11556037934440317738182812945524, 0.11566472375677937234339509586789, 0.11576916238619128218800824470236, 0.11587369531771159192334863519136, 0.11597832263648968909031111707009, 0.11608304442775180254088240872079, 0.11618786077680127999389725346191, 0.11629277176901833823485787888785, 0.11639777748986031291611453752921, 0.11650287802486181121253139281180, 0.11660807345963455916582063309761, 0.11671336387986759597357178108723, 0.11681874937132741276712977196439, 0.11692423001985785546708029869478, 0.11702980591138027743891569798507, 0.11713547713189374765985206749974, 0.11724124376747482867422434082982, 0.11734710590427784027145463596753, 0.11745306362853501214171814126530, 0.11755911702655628958691380603341, 0.11766526618472958332084488120017, 0.11777151118952090824709699745654, 0.11787785212747423080337227929704, 0.11798428908521167712830646223665, 0.11809082214943369959492258658429, 0.11819745140691891027717730366930, 0.11830417694452428911677799305835, 0.11841099884918535045663645632885, 0.11851791720791600426299083892445, 0.11862493210780870878107151611403, 0.11873204363603470645749382583745, 0.11883925187984378801786533585982, 0.11894655692656458390032980787510, 0.11905395886360463364450623657831, 0.11916145777845034425812542622225, 0.11926905375866705960596902968973, 0.11937674689189936572120132041164, 0.11948453726587081324961303607779, 0.11959242496838419500537753492608, 0.11970041008732171250450448951597, 0.11980849271064475392023496169713, 0.11991667292639418551658536671312, 0.12002495082269046267064993571694, 0.12013332648773349109472263762655, 0.12024180000980282112532648852721, 0.12035037147725781425666724544499, 0.12045904097853751824054313601664, 0.12056780860216083361979855226309, 0.12067667443672669413956555217737, 0.12078563857091394184717358939452, 0.12089470109348145199223978352165, 0.12100386209326839670463726861271, 0.12111312165919403682767807595155, 0.12122247988025790232935463563990, 0.12133193684554002822473250944313, 0.12144149264420074640913327357339, 0.12155114736548092158052725153539, 0.12166090109870207613962378445649, 0.12177075393326632080093219201444, 0.12188070595865643785948861932411, 0.12199075726443614486882438541215, 0.12210090794024992810751228944355, 0.12221115807582319523483249668061, 0.12232150776096251121316527132876, 0.12243195708555540401896166713414, 0.12254250613957053117619722115705, 0.12265315501305795731212811006117, 0.12276390379614893211268622508214, 0.12287475257905604297814505798669, 0.12298570145207349257887585736171, 0.12309675050557687681074270358295, 0.12320789983002343459528304947526, 0.12331914951595214502422237501378, 0.12343049965398365797053514825166, 0.12354195033482041898853509565015, 0.12365350164924693299184355055331, 0.12376515368812952833099672034223, 0.12387690654241657883805061146631, 0.12398876030313871199339814666018, 0.12410071506140862851452766335569, 0.12421277090842129664505222308435, 0.12432492793545414644373892087970, 0.12443718623386691712884299931829, 0.12454954589510180973377373447875, 0.12466200701068376466285059223082, 0.12477456967222019801333487976081, 0.12488723397140125137561028623168, 0.12500000000000000000000000000000, 0.12511286784987224462994959139905, 0.12522583761295671966884412995569, 0.12533890938127531522461310942163, 0.12545208324693288282070113837108, 0.12556535930211742968509724960313, 0.12567873763910034079493982517306, 0.12579221835023621234306290261884, 0.12590580152796296276029863747681, 0.12601948726480219353796030645753, 0.12613327565335882840535930426995, 0.12624716678632147415228814679722, 0.12636116075646255940689854924130, 0.12647525765663808483552088546276, 0.12658945757978798396514719115657, 0.12670376061893617869458239511005, 0.12681816686719046827214185668709, 0.12693267641774272358468067523063, 0.12704728936386913695777423072286, 0.12716200579892988908881079623825, 0.12727682581636959313620138800616, 0.12739174950971723920822853415302, 0.12750677697258624987419750596018, 0.12762190829867448016443631786387, 0.12773714358176457839277873063111, 0.12785248291572373635638371069945, 0.12796792639450391138034035520832, 0.12808347411214196509554597014358, 0.12819912616275958017197922345076, 0.12831488264056348236330507006642, 0.12843074363984546826245036754699, 0.12854670925498243305717949169775, 0.12866277958043648155239679908846, 0.12877895471075512245917593645572, 0.12889523474057110186130614692956, 0.12901161976460262525989719506470, 0.12912810987765355186240867624292, 0.12924470517461320029362070727075, 0.12936140575045659839581446703960, 0.12947821170024464976222589029931, 0.12959512311912391169244074262679, 0.12971214010232692825930200797302, 0.12982926274517234133121235117869, 0.12994649114306472403868042420072, 0.13006382539149474730777455988573, 0.13018126558603951292703015951702, 0.13029881182236224823611792089650, 0.13041646419621261143717561026278, 0.13053422280342671935038367792004, 0.13065208773992725843626772075368, 0.13077005910172342928454725097254, 0.13088813698491122416989185239800, 0.13100632148567339929634556483506, 0.13112461270027941928617565281456, 0.13124301072508590126908245565573, 0.13136151565653630957086761554820, 0.13148012759116115000246338695433, 0.13159884662557830292684002415626, 0.13171767285649266243652277807996, 0.13183660638069649717607489947113, 0.13195564729506964463112694829761, 0.13207479569657920581704502183129, 0.13219405168227985059026252656622, 0.13231341534931409520403633450769, 0.13243288679491191373038816436747, 0.13255246611639120990489004725532, 0.13267215341115776161551309542119, 0.13279194877670524865820311788411, 0.13291185231061539151475869857677, 0.13303186411055806237513365886116, 0.13315198427429131289301267315750, 0.13327221289966134643023565331532, 0.13339255008460296214600759867608, 0.13351299592713913866326436163945, 0.13363355052538147815788249772595, 0.13375421397753023411425488120585, 0.13387498638187417254741262695461, 0.13399586783679090506993247799983, 0.13411685844074694440308803677908, 0.13423795829229756559897168699536, 0.13435916749008702808509951864835, 0.13448048613284888097574309995252, 0.13460191431940557449387085853232, 0.13472345214866887630478231585585, 0.13484509971963998253841054975055, 0.13496685713140926798914165374299, 0.13508872448315673020502458712144, 0.13521070187415190622104432804917, 0.13533278940375390031469748919335, 0.13545498717141157829502162712743, 0.13557729527666365076932208921789, 0.13569971381913861763202078236645, 0.13582224289855493459810986678349, 0.13594488261472120749218106539047, 0.13606763306753605347054758567538, 0.13619049435698832306584904472402, 0.13631346658315721120935393173568, 0.13643654984621217396423276113637, 0.13655974424641317832573861323908, 0.13668304988411072997678274987265, 0.13680646685974592879908584563964, 0.13692999527385049662875360354519, 0.13705363522704711032318414254405, 0.13717738682004909644973622562247, 0.13730125015366084761936349423195, 0.13742522532877773921988762140245, 0.13754931244638629594945200551592, 0.13767351160756408079421930779063, 0.13779782291348011136200568671484, 0.13792224646539466559325148864446, 0.13804678236465942053889932594757, 0.13817143071271764664942338640685, 0.13829619161110418001925381759065, 0.13842106516144545014235234248190, 0.13854605146545984073469526265399, 0.13867115062495738442294168635271, 0.13879636274184012356691653167218, 0.13892168791810219352633737344149, 0.13904712625582971163851198070915, 0.13917267785720094375179201051651, 0.13929834282448655402575354855799, 0.13942412126004949390889464666543, 0.13955001326634502989421093843703, 0.13967601894592115985282987367100, 0.13980213840141827996710333081865, 0.13992837173556949004193938890239, 0.14005471905120084330498286817601, 0.14018118045123098558413232694875, 0.14030775603867159939674991164793, 0.14043444591662748721638820370572, 0.14056125018829634942818529452779, 0.14068816895696914515134778866923, 0.14081520232603023101702888197906, 0.14094235039895713912372343656898, 0.14106961327932085459302413710247, 0.14119699107078600985865080019721, 0.14132448387711071813299668065156, 0.14145209180214679545173339647590, 0.14157981494983989945168900703720, 0.14170765342422947385969678180118, 0.14183560732944891502604889410577, 0.14196367676972568294679888367682, 0.14209186184938132901933727225696, 0.14222016267283155155354279486346, 0.14234857934458644557196294044843, 0.14247711196925039178751148938318, 0.14260576065152213987019536034495, 0.14273452549619519702517322912172, 0.14286340660815752268142375669413, 0.14299240409239175053635051426681, 0.14312151805397552162268937081535, 0.14325074859808115124160110553930, 0.14338009582997593427400317978027, 0.14350955985502236722517466205318, 0.14363914077867795393572691864392, 0.14376883870649539987063292301173, 0.14389865374412283416383218082046, 0.14402858599730369859592826742301, 0.14415863557187688637206690600578, 0.14428880257377699192211650824902, 0.14441908710903414436721448055323, 0.14454948928377417405322091781272, 0.14468000920421889010647475970472, 0.14481064697668588614476448128698, 0.14494140270758876232193301802909, 0.14507227650343734737248269084375, 0.14520326847083744881139466542663, 0.14533437871649121375661195543216, 0.14546560734719718444019065373141, 0.14559695446985029820829993241205, 0.14572842019144191527679765840730, 0.14586000461906020730928901230072, 0.14599170785988985210579471640813, 0.14612353002121239442523403795349, 0.14625547121040627374100040469784, 0.14638753153494682424096140493930, 0.14651971110240641360533686565759, 0.14665201002045466505130377754540, 0.14678442839685826304396698560595, 0.14691696633948125860769096107106, 0.14704962395628515259282664828788, 0.14718240135532889567571146471892, 0.14731529864476891611424491657090, 0.14744831593285948057037160197069, 0.14758145332795249982105190156290, 0.14771471093849761202498882539658, 0.14784808887304262681183786298789, 0.14798158724023319221529959577310, 0.14811520614881304447330023776885, 0.14824894570762423007259656060342, 0.14838280602560699472647343100107, 0.14851678721179989439704627329775, 0.14865088937534012836216845698800, 0.14878511262546326165967514043587, 0.14891945707150350264313942716399, 0.14905392282289389727090167525603, 0.14918850998916624583934265046992, 0.14932321867995115849403475749568, 0.14945804900497841605222504313133, 0.14959300107407674795823027125152, 0.14972807499717402657246623220999, 0.14986327088429757248277951475757, 0.14999858884557382143754011849524, 0.15013402899122871292370007267891, 0.15026959143158788445582274562184, 0.15040527627707639402032668840548, 0.15054108363821902538681740679749, 0.15067701362564048239711667065421, 0.15081306635006525018738443577604, 0.15094924192231776172157253768091, 0.15108554045332270310275646352238, 0.15122196205410470826180358017155, 0.15135850683578871977985613739293, 0.15149517490960015542178496161796, 0.15163196638686465833600891528476, 0.15176888137900851338812913127185, 0.15190591999755861940535339726921, 0.15204308235414251693207177140721, 0.15218036856048855476331027603010, 0.15231777872842605647818459146947, 0.15245531296988518166202197789971, 0.15259297139689723121769304725603, 0.15273075412159470287676299449231, 0.15286866125621123568834036632325, 0.15300669291308188757483321751351, 0.15314484920464319084310034213559, 0.15328313024343306891772442668298, 0.15342153614209111389676820635941, 0.15356006701335875308522815885226, 0.15369872297007902695042957930127, 0.15383750412519692218893396784551, 0.15397641059175948274884149213904, 0.15411544248291578207421537172195, 0.15425459991191697861623310927826, 0.15439388299211667665566949381173, 0.15453329183697062099156482872786, 0.15467282656003714103043478189647, 0.15481248727497706751954353876499, 0.15495227409555387132478188050300, 0.15509218713563366343066718400223, 0.15523222650918550025167519379465, 0.15537239233028127260993755953677, 0.15551268471309584451311991415423, 0.15565310377190724744345118324418, 0.15579364962109665260214796944638, 0.15593432237514845417614139932994, 0.15607512214865060240498451094027, 0.15621604905629432602509609750996, 0.15635710321287443758109247937682, 0.15649828473328952771481681338628, 0.15663959373254185414303663037572, 0.15678103032573742492417068206123, 0.15692259462808638703634755984240, 0.15706428675490274882164953851316, 0.15720610682160462978629311692202, 0.15734805494371456591196078989014, 0.15749013123685914883331804503541, 0.15763233581676952543837444409291, 0.15777466879928134235733239165711, 0.15791713030033477371816275081073, 0.15805972043597465992448292126937, 0.15820243932235078521131299567060, 0.15834528707571765560047083454265, 0.15848826381243469318960137570684, 0.15863136964896665248581086871127, 0.15877460470188317631645702476817, 0.15891796908785926767393448244547, 0.15906146292367534522682603892463, 0.15920508632621716005317580311385, 0.15934883941247601768509412067942, 0.15949272229954900015336249907705, 0.15963673510463877169840429814940, 0.15978087794505380081488965515746, 0.15992515093820866556306725669856, 0.16006955420162377601300818241725, 0.16021408785292567955593767692335, 0.16035875200984728294884007482324, 0.16050354679022765802542949131748, 0.16064847231201226374075474723213, 0.16079352869325319597137990967894, 0.16093871605210902098193059828191, 0.16108403450684496971412329457962, 0.16122948417583321534252149831445, 0.16137506517755270674108203365904, 0.16152077763058933501660874298977, 0.16166662165363618330893302754703, 0.16181259736549341576861138491950, 0.16195870488506844409037910281768, 0.16210494433137620506890641536302, 0.16225131582353893855419357805658, 0.16239781948078643725175140843930, 0.16254445542245632427835744238109, 0.16269122376799383111745100904955, 0.16283812463695199190816254031233, 0.16298515814899197651222095828416, 0.16313232442388289622492436592438, 0.16327962358150191479744250955264, 0.16342705574183466477045101328258, 0.16357462102497491440722399147489, 0.16372231955112490076054143628426, 0.16387015144059555171729414269066, 0.16401811681380623619830316783919, 0.16416621579128515273637844984478, 0.16431444849366932947631880779227, 0.16446281504170470744163878862310, 0.16461131555624619604571989839314, 0.16475995015825800615871798981971, 0.16490871896881334479623149036343, 0.16505762210909485920851125229092, 0.16520665970039469239161178393260, 0.16535583186411434430951317153813, 0.16550513872176500496102846682334, 0.16565458039496766540210614948592, 0.16580415700545300672352766468975, 0.16595386867506162209551234809624, 0.16610371552574429432347358215338, 0.16625369767956174604783825543564, 0.16640381525868488954422730330407, 0.16655406838539518754593871108227, 0.16670445718208423691031327962264, 0.16685498177125426821909570662683, 0.16700564227551822904516143353248, 0.16715643881759958966348733611085, 0.16730737152033267611805911201373, 0.16745844050666286451090059017588, 0.16760964589964644222419565267046, 0.16776098782245071894259069722466, 0.16791246639835441523125325602450, 0.16806408175074741273569145505462, 0.16821583400313103173751017038740, 0.16836772327911822544344033758534, 0.16851974970243341345188525792764, 0.16867191339691273155310113907035, 0.16882421448650430928495325133554, 0.16897665309526799237715977142216, 0.16912922934737570357377478558192, 0.16928194336711158141106636776385, 0.16943479527887189695078973272757, 0.16958778520716522031364092981676, 0.16974091327661264272386176799046, 0.16989417961194769324251296893635, 0.17004758433801650530092786084424, 0.17020112757977809425646853469516, 0.17035480946230416310349653485900, 0.17050863011077935227355339975475, 0.17066258965050148943554120251065, 0.17081668820688131193996639467514, 0.17097092590544291090814965627942, 0.17112530287182381449895274272421, 0.17127981923177484913090040663519, 0.17143447511116036152678532289428, 0.17158927063595855178057547618664, 0.17174420593226116804608238908258, 0.17189928112627381184829289395566, 0.17205449634431627115027652052959, 0.17220985171282213177512687707349, 0.17236534735833922149517150046449, 0.17252098340752974880984993433231, 0.17267675998717016416783565091464, 0.17283267722415138201164097608853, 0.17298873524547900282222201440163, 0.17314493417827320209667618655658, 0.17330127414976892463727153881337, 0.17345775528731613435162728364958, 0.17361437771837970323041133724473, 0.17377114157053949461406716636702, 0.17392804697149077952644802280702, 0.17408509404904395911906078708853, 0.17424228293112489773797335601557, 0.17439961374577503394611710518802, 0.17455708662115129725656004211487, 0.17471470168552638568826296250336, 0.17487245906728890454395752840355, 0.17503035889494325538784380569268, 0.17518840129710991360134642036428, 0.17534658640252559491656825230166, 0.17550491434004311663841235713335, 0.17566338523863161968918689126440, 0.17582199922737692943108811505226, 0.17598075643548119484371738963091, 0.17613965699226324934656418008672, 0.17629870102715883284361098048976, 0.17645788866972048070103085137816, 0.17661722004961757925833865101595, 0.17677669529663689318432773234235, 0.17693631454068209363228447728034, 0.17709607791177423008477376242809, 0.17725598554005189688709265283251, 0.17741603755577101120266547695792, 0.17757623408930514607995121423301, 0.17773657527114569698589718882431, 0.17789706123190177078363660712057, 0.17805769210230038002151786713512, 0.17821846801318677600001194605284, 0.17837938909552417121595624394104, 0.17854045548039398916273512440966, 0.17870166729899625290833853341610, 0.17886302468264922427287899608928, 0.17902452776278976465107461990556, 0.17918617667097361256800525097788, 0.17934797153887505061220508650877, 0.17950991249828732176929690922407, 0.17967199968112279595544578114641, 0.17983423321941283123948096545064, 0.17999661324530794037634962023731, 0.18015913989107820714075103296636, 0.18032181328911289774907800165238, 0.18048463357192090494862668492715, 0.18064760087213083128432344892644, 0.18081071532249096134314925166109, 0.18097397705586937277644210553262, 0.18113738620525438038910692739591, 0.18130094290375409205040568849654, 0.18146464728459688053874288016232, 0.18162849948113157783069482320570, 0.18179249962682722530082912726357, 0.18195664785527340678861207834416, 0.18212094430018047064301356385840, 0.18228538909537939094462899447535, 0.18244998237482187852798176663782, 0.18261472427258088058188434388285, 0.18277961492285013656022840677906, 0.18294465445994462227119470298931, 0.18310984301830071641070674104412, 0.18327518073247608954012832782610, 0.18344066773714978735299041545659, 0.18360630416712273027535218261619, 0.18377209015731738039889364699775, 0.18393802584277799128109620596661, 0.18410411135867094101215002410754, 0.18427034684028448241477349256456, 0.18443673242302902059996938533004, 0.18460326824243741827835663116275, 0.18476995443416471820441415729874, 0.18493679113398844848781266136939, 0.18510377847780898341589761457726, 0.18527091660164909936447941163351, 0.18543820564165455766492129896506, 0.18560564573409404909298814345675, 0.18577323701535930489114889496705, 0.18594097962196509676857658632798, 0.18610887369054962547920695214998, 0.18627691935787440979943596630619, 0.18644511676082431428369545756141, 0.18661346603640810437596542215033, 0.18678196732175797456498855808604, 0.18695062075413004798463134648046, 0.18711942647090443192503528280213, 0.18728838460958521783261687687627, 0.18745749530780056457679449977149, 0.18762675870330319805034946512023, 0.18779617493396991156906494779832, 0.18796574413780206547208706524543, 0.18813546645292580916652980249637, 0.18830534201759183132729447152087, 0.18847537097017563745282586751273, 0.18864555344917785517644404080784, 0.18881588959322398446616375622398, 0.18898637954106473069160188060778, 0.18915702343157622666858230786602, 0.18932782140375986612568226519215, 0.18949877359674252574883723809762, 0.18966988014977684273709712670097, 0.18984114120224107602474816758331, 0.19001255689363932832591785881959, 0.19018412736360182369033111626777, 0.19035585275188468545870534853748, 0.19052773319837024157408222890808, 0.19069976884306730213758385161782, 0.19087195982611088185265657557466, 0.19104430628776261635870525879000, 0.19121680836841087325339572089433, 0.19138946620857066882592789625051, 0.19156227994888386234606514335610, 0.19173524973011948913104163239041, 0.19190837569317353850095742018311, 0.19208165797906917582338337524561, 0.19225509672895710333584418094688, 0.19242869208411533810121341048216, 0.19260244418594935078559160501754, 0.19277635317599259301424297063932, 0.19295041919590608103796114392026, 0.19312464238747872879997657946660, 0.19329902289262768100286393746501, 0.19347356085339806330836154302233, 0.19364825641196317662640069556801, 0.19382310971062499671546675017453, 0.19399812089181370233781365186587, 0.19417329009808814710424940130906, 0.19434861747213608151874097984546, 0.19452410315677384766708257757273, 0.19469974729494682330610544340743, 0.19487555002972961615270719448745, 0.19505151150432581408367127551173, 0.19522763186206834595814996191621, 0.19540391124641970366226928490505, 0.19558034980097177557567533767724, 0.19575694766944609637171481608675, 0.19593370499569412457319117493171, 0.19611062192369702050775970292307, 0.19628769859756606264156175711832, 0.19646493516154267533480037855043, 0.19664233175999845659731590785668, 0.19681988853743528911088844779442, 0.19699760563848581207402332893253, 0.19717548320791297711274125958880, 0.19735352139061049236978817589261, 0.19753172033160307230481578244508, 0.19771008017604621564977662728779, 0.19788860106922645520910464256303, 0.19806728315656171868219814768963, 0.19824612658360105110766369307385, 0.19842513149602492017464783202740, 0.19860429803964549377859327705664, 0.19878362636040644573220959046012, 0.19896311660438323332122934061772, 0.19914276891778337486016425827984, 0.19932258344694619989212469590711, 0.19950256033834323776687824647524, 0.19968269973857838417430343724845, 0.19986300179438779012208726726385, 0.20004346665264008398033013236272, 0.20022409446033667679287759710860, 0.20040488536461151247713985412702, 0.20058583951273140089099911165249, 0.20076695705209637865529259670438, 0.20094823813023926506460270502430, 0.20112968289482618944319369802542, 0.20131129149365678543404101219494, 0.20149306407466394119865071843378, 0.20167500078591407697281567834580, 0.20185710177560758915582539430034, 0.20203936719207840622125615936966, 0.20222179718379448831733213864936, 0.20240439189935796604480344740296, 0.20258715148750500167906807291729, 0.20277007609710601121477679953387, 0.20295316587716610845504305871145, 0.20313642097682466092223307896347, 0.20331984154535576170275135154952, 0.20350342773216847924722117113561, 0.20368717968680655205915286387608, 0.20387109755894880502857802184735, 0.20405518149840937147665442807920, 0.20423943165513749886663674715237, 0.20442384817921777084848145022988, 0.20460843122087055134805666511966, 0.20479318093045162374465917309863, 0.20497809745845246842677056520188, 0.20516318095550079014799393917201, 0.20534843157235993515996597125195, 0.20553384945992955734617169127887, 0.20571943476924561822194448268419, 0.20590518765148030366773923560686, 0.20609110825794232924046411881136, 0.20627719674007721772923673597688, 0.20646345324946702159962796940817, 0.20664987793783068381614498321142, 0.20683647095702428764241176395444, 0.20702323245904094561886665815109, 0.20721016259601091058506483477686, 0.20739726152020201976888813533151, 0.20758452938401941723078891754994, 0.20777196634000585917512182732025, 0.20795957254084204701705118623067, 0.20814734813934632207121921965154, 0.20833529328847502637422905991116, 0.20852340814132280799597651821387, 0.20871169285112234348389392835088, 0.20890014757124469868543314987619, 0.20908877245519957854824610876676, 0.20927756765663513283115548802016, 0.20946653332933823365991088394367, 0.20965566962723480859409619370126, 0.20984497670438961858252469028230, 0.21003445471500648000784394753282, 0.21022410381342862550901884333143, 0.21041392415413856520345348144474, 0.21060391589175814219814242278517, 0.21079407918104917096790984487598, 0.21098441417691285448832161364408, 0.21117492103439042261392444288504, 0.21136559990866315983382150989200, 0.21155645095505232200494560856896, 0.21174747432901944166339092134876, 0.21193867018616657782459355985338, 0.21213003868223614944987787112041, 0.21232157997311110197991013137653, 0.21251329421481543469063524298690, 0.21270518156351378435964250002144, 0.21289724217551175833307297580177, 0.21308947620725640637040498859278, 0.21328188381533572104409302028216, 0.21347446515647916509550441332976, 0.21366722038755786572394868017000, 0.21386014966558442029764819380944, 0.21405325314771322942064557537378, 0.21424653099124074673298423476808, 0.21443998335360528462167906127434, 0.21463361039238729177647257984063, 0.21482741226530974176789356988593, 0.21502138913023774446919844649528, 0.21521554114517907341230795736919, 0.21540986846828424905453402971034, 0.21560437125784645551185292333685, 0.21579904967230181811466138697142, 0.21599390387022970871910843015939, 0.21618893401035244039576355135068, 0.21638414025153573927440220359131, 0.21657952275278888332188387266797, 0.21677508167326459131984961459239, 0.21697081717225924490932698063261, 0.21716672940921327716878863611782, 0.21736281854371092281397181977809, 0.21755908473548044024248326877569, 0.21775552814439455562300906876771, 0.21795214893047015758398288198805, 0.21814894725386863028049333479430, 0.21834592327489613095004017395695, 0.21854307715400336786792934162804, 0.21874040905178598892533159414597, 0.21893791912898477591831181143789, 0.21913560754648550576995091887511, 0.21933347446531917257495081230445, 0.21953152004666243168884420811082, 0.21972974445183723890551164004137, 0.21992814784231121127966446238133, 0.22012673037969798794932785312994, 0.22032549222575686931335781082453, 0.22052443354239331663180223586096, 0.22072355449165909080377900863823, 0.22092285523575214134517352704279, 0.22112233593701685618881924710877, 0.22132199675794433924025383930712, 0.22152183786117235486656795728777, 0.22172185940948538340755646913749, 0.22192206156581514853165515432920, 0.22212244449324033968018454743287, 0.22232300835498680635637924751791, 0.22252375331442805772574899947358, 0.22272467953508484628244445957534, 0.22292578718062563969404266117635, 0.22312707641486687060172755536769, 0.22332854740177265906453385468922, 0.22353020030545522889298126756330, 0.22373203529017512969367942332610, 0.22393405252034107033587417845411, 0.22413625216051016875162815722433, 0.22433863437538839602503060177696, 0.22454119932983018781413875331054, 0.22474394718883886068461208651570, 0.22494687811756688966546846586425, 0.22514999228131571396005483620684, 0.22535328984553598674622776343313, 0.22555677097582799150998766890552, 0.22576043583794130897857144191221, 0.22596428459777523345408667410084, 0.22616831742137899485811658450984, 0.22637253447495156444269071016606, 0.22657693592484204336834352488950, 0.22678152193754985699314374869573, 0.22698629267972461609481626965135, 0.22719124831816639442649830016308, 0.22739638901982606178364676452475, 0.22760171495180508971500898951490, 0.22780722628135577356722762942809, 0.22801292317588167657405051613750, 0.22821880580293724127827204029018, 0.22842487433022826137651861699851, 0.22863112892561215927500484212942, 0.22883756975709773628935295164410, 0.22904419699284545020034897788719, 0.22925101080116780383200136839150, 0.22945801135052912300693606084678, 0.22966519880954580634657702375989, 0.22987257334698671384920487525960, 0.23008013513177288933420072680747, 0.23028788433297792126452918637369, 0.23049582111982824805807013035519, 0.23070394566170288053186254728644, 0.23091225812813384599131438790209, 0.23112075868880635476365625891049, 0.23132944751355874468679019173578, 0.23153832477238256437601648940472, 0.23174739063542318384669727038272, 0.23195664527297937818062223414017, 0.23216608885550360508176481744158, 0.23237572155360255998779450692382, 0.23258554353803667646971575777570, 0.23279555497972062583222907505842, 0.23300575604972362242506278562360, 0.23321614691926911833164126619522, 0.23342672775973519194714356217446, 0.23363749874265482553425954392878, 0.23384846003971571093416059738956, 0.23405961182276055487783139597013, 0.23427095426378749531970413499948, 0.23448248753494965734844868165965, 0.23469421180855568054290927193506, 0.23490612725707002428343628253060, 0.23511823405311257917382761206682, 0.23533053236945916664168976240035, 0.23554302237904181649419399491308, 0.23575570425494846160674455859407, 0.23596857817042335425661292447330, 0.23618164429886739918984517316858, 0.23639490281383782055435460733861, 0.23660835388904857823355598611670, 0.23682199769837070091327291265770, 0.23703583441583200852598167784890, 0.23724986421561741756214303222805, 0.23746408727206941291498765167489, 0.23767850375968757603573067171965, 0.23789311385312916780065961575019, 0.23810791772720926728901247315662, 0.23832291555690068851625085244450, 0.23853810751733411921193805937946, 0.23875349378379873144240264082327, 0.23896907453174162649922607215558, 0.23918484993676839001075506985217, 0.23940082017464342500900897903193, 0.23961698542128950784046992339427, 0.23983334585278837103317073342623, 0.24004990164538092534129987143388, 0.24026665297546698218944527525309, 0.24048360001960564225065297705441, 0.24070074295451562851333449088997, 0.24091808195707503648108627203328, 0.24113561720432166723959710452618, 0.24135334887345338827913110435475, 0.24157127714182788369434717878903, 0.24178940218696290398447956704331, 0.24200772418653679340927453722543, 0.24222624331838807365535615190311, 0.24244495976051580465870927127980, 0.24266387369108005644946501888626, 0.24288298528840149281826654714678, 0.24310229473096184316105450307077, 0.24332180219740415227924756891298, 0.24354150786653264160186438402889, 0.24376141191731287571897723864822, 0.24398151452887228973764877082431, 0.24420181588049985621502457888710, 0.24442231615164639046966499336122, 0.24464301552192502242633054265752, 0.24486391417111080803792333426827, 0.24508501227914106235239444231411, 0.24530631002611591462425622012233, 0.24552780759229786422537245016429, 0.24574950515811208595629011597339, 0.24597140290414698515775171472342, 0.24619350101115375362148540716589, 0.24641579966004686919056609895051, 0.24663829903190429004844475002756, 0.24686099930796731594107029650331, 0.24708390066964083797707019130030, 0.24730700329849386598368710110663, 0.24753030737625905666199344068445, 0.24775381308483315767610122293263, 0.24797752060627742398679629332037, 0.24820143012281725702905532671139, 0.24842554181684259329010444616870, 0.24864985587090829288747784175939, 0.24887437246773383425768599863659, 0.24909909179020361946754746895749, 0.24932401402136752932570118446165, 0.24954913934444039602666975952161, 0.24977446794280250275122057246335, 0.25000000000000000000000000000000, 0.25022573569974443374874795154028, 0.25045167522591349484883949116920, 0.25067781876255063044922621884325, 0.25090416649386571013025104548433, 0.25113071860423491488134573046409, 0.25135747527820068158987965034612, 0.25158443670047236917497457397985, 0.25181160305592598103174850621144, 0.25203897452960438707592061291507, 0.25226655130671760129956737728207, 0.25249433357264300381572752485226, 0.25272232151292511881379709848261, 0.25295051531327616967104177092551, 0.25317891515957602344144561357098, 0.25340752123787235738916479022009, 0.25363633373438088103313248211634, 0.25386535283548550268051258171909, 0.25409457872773827391554846144572, 0.25432401159785977817762159247650, 0.25455365163273924178355400727014, 0.25478349901943447841645706830604, 0.25501355394517244423724378066254, 0.25524381659734901584002386698558, 0.25547428716352915678555746126221, 0.25570496583144747271276742139889, 0.25593585278900782276068071041664, 0.25616694822428393019109194028715, 0.25639825232551916034395844690152, 0.25662976528112696472661014013283, 0.25686148727969093652490073509398, 0.25709341850996481060320775213768, 0.25732555916087301861594482943474, 0.25755790942151024491835187291144, 0.25779046948114214821146106260130, 0.25802323952920530603094562138722, 0.25825621975530710372481735248584, 0.25848941034922640058724141454150, 0.25872281150091325230278016533703, 0.25895642340048929952445178059861, 0.25919024623824776787373025399575, 0.25942428020465391202975524720387, 0.25965852549034468266242470235738, 0.25989298228612939256620961714361, 0.26012765078298955012670035102929, 0.26036253117207902585406031903403, 0.26059762364472449647223584179301, 0.26083292839242522287435122052557, 0.26106844560685343870076735584007, 0.26130417547985446136138421024953, 0.26154011820344685856909450194507, 0.26177627396982244833978370479599, 0.26201264297134674308153989841230, 0.26224922540055889408350253688695, 0.26248602145017180253816491131147, 0.26272303131307256363058399983856, 0.26296025518232235551607800516649, 0.26319769325115660585368004831253, 0.26343534571298526936189432490210, 0.26367321276139304986330103020009, 0.26391129459013928926225389659521, 0.26414959139315835612293881240475, 0.26438810336455975669167628439027, 0.26462683069862819040807266901538, 0.26486577358982382746077632873494, 0.26510493223278241980978009451064, 0.26534430682231552323102619084239, 0.26558389755341049731640623576823, 0.26582370462123078302951739715354, 0.26606372822111612475026731772232, 0.26630396854858257027487411505717, 0.26654442579932274837162253788847, 0.26678510016920592429201519735216, 0.26702599185427822181537749202107, 0.26726710105076301182691622670973, 0.26750842795506046822850976241170, 0.26774997276374834509482525390922, 0.26799173567358186565101618725748, 0.26823371688149388880617607355816, 0.26847591658459507568679214273288, 0.26871833498017411168135026855452, 0.26896097226569776195148619990505, 0.26920382863881114898774171706464, 0.26944690429733780812071586296952, 0.26969019943927996507682109950110, 0.26993371426281853597828330748598, 0.27017744896631351592120040550071, 0.27042140374830381244208865609835, 0.27066557880750780062939497838670, 0.27090997434282321210119448551268, 0.27115459055332730153864417843579, 0.27139942763827717975289033347508, 0.27164448579710992470737096482480, 0.27188976522944241498436213078094, 0.27213526613507210694109517135075, 0.27238098871397670164284932070586, 0.27262693316631442241870786347135, 0.27287309969242434792846552227275, 0.27311948849282635665147722647816, 0.27336609976822145995356549974531, 0.27361293371949180208702046002145, 0.27385999054770104876865843834821, 0.27410727045409422064636828508810, 0.27435477364009819289947245124495, 0.27460250030732169523872698846390, 0.27485045065755547843977524280490, 0.27509862489277253638775277977402, 0.27534702321512816158843861558125, 0.27559564582696022272401137342968, 0.27584449293078933118650297728891, 0.27609356472931889658894988315296, 0.27634286142543529329884677281370, 0.27659238322220830452735640392348, 0.27684213032289095579585591622163, 0.27709210293091968146939052530797, 0.27734230124991471333473214144760, 0.27759272548368030264498429460218, 0.27784337583620438705267474688299, 0.27809425251165936776587273016048, 0.27834535571440188750358402103302, 0.27859668564897310805150709711597, 0.27884824252009893230663806207303, 0.27910002653269011529957310813188, 0.27935203789184231970565974734200, 0.27960427680283650442305543037946, 0.27985674347113903559503000906261, 0.28010943810240168660996573635202, 0.28036236090246191565711342263967, 0.28061551207734325430465105455369, 0.28086889183325497443277640741144, 0.28112250037659264334521935779776, 0.28137633791393834581384680859628, 0.28163040465206046203405776395812, 0.28188470079791422273629564188013, 0.28213922655864176469719950546278, 0.28239398214157201971730160039442, 0.28264896775422143626599336130312, 0.28290418360429364641461802420963, 0.28315962989967979890337801407441, 0.28341530684845894771939356360235, 0.28367121465889783005209778821154, 0.28392735353945136589359776735364, 0.28418372369876265803867454451392, 0.28444032534566315861823682098475, 0.28469715868917289114392588089686, 0.28495422393850072806387174750853, 0.28521152130304433525154195194773, 0.28546905099239039405034645824344, 0.28572681321631498985169628213043, 0.28598480818478355658385225979146, 0.28624303610795104324537874163070, 0.28650149719616224697205097982078, 0.28676019165995192405915759081836, 0.28701911971004473445034932410636, 0.28727828155735585236030260603002, 0.28753767741299085525241707728128, 0.28779730748824566832766436164093, 0.28805717199460739719185653484601, 0.28831727114375382825528504326940, 0.28857760514755398384423301649804, 0.28883817421806823322327772984863, 0.28909897856754834810644183562545, 0.28936001840843778021294951940945, 0.28962129395337171677837773131614, 0.28988280541517758015501726731600, 0.29014455300687469474496538168751, 0.29040653694167484211163809959544, 0.29066875743298248302437514212215, 0.29093121469439436888038130746281, 0.29119390893970054090544863356627, 0.29145684038288388606474654807243, 0.29172000923812041461857802460145, 0.29198341571977964870043820155843, 0.29224706004242484436161930716480, 0.29251094242081254748200080939569, 0.29277506306989359297077157862077, 0.29303942220481288272182496257301, 0.29330402004090933010260755509080, 0.29356885679371647057678273995407, 0.29383393267896251721538192214211, 0.29409924791257030518565329657577, 0.29436480271065773584027169818000, 0.29463059728953788773964106439962, 0.29489663186571896114074320394138, 0.29516290665590494413095257186797, 0.29542942187699527956112888205098, 0.29569617774608525362367572597577, 0.29596317448046632891944796028838, 0.29623041229762608894660047553771, 0.29649789141524846014519312120683, 0.29676561205121393394179563074431, 0.29703357442359984430524377785332, 0.29730177875068025672433691397600, 0.29757022525092646780819904961390, 0.29783891414300700528627885432797, 0.29810784564578779454180335051205, 0.29837701997833243616753406968201, 0.29864643735990237249922074624919, 0.29891609800995683210445008626266, 0.29918600214815344040530931124522, 0.29945614999434810865608369567781, 0.29972654176859514496555902951513, 0.29999717769114758736392900573264, 0.30026805798245748135855137661565, 0.30053918286317576891164549124369, 0.30081055255415273252950214555312, 0.30108216727643810628478604485281, 0.30135402725128096479423334130843, 0.30162613270013044486361764029425, 0.30189848384463557895429630661965, 0.30217108090664540620551292704477, 0.30244392410820936101245592908526, 0.30271701367157749507086350604368, 0.30299034981920031084356992323592, 0.30326393277372931667201783056953, 0.30353776275801702677625826254371, 0.30381183999511723881070679453842, 0.30408616470828497835299231155659, 0.30436073712097716503777178331802, 0.30463555745685211295636918293894, 0.30491062593977030781289272454160, 0.30518594279379446243538609451207, 0.30546150824318940575352598898462, 0.30573732251242247137668073264649, 0.30601338582616383066081766628486, 0.30628969840928638168620068427117, 0.30656626048686608232429762210813, 0.30684307228418228330468764397665, 0.30712013402671750617045631770452, 0.30739744594015799838970792734472, 0.30767500825039384437786793569103, 0.30795282118351896549768298427807, 0.30823088496583150863727951218607, 0.30850919982383401274361744981434, 0.30878776598423335331133898762346, 0.30906658367394124198312965745572, 0.30934565312007428206086956379295, 0.30962497454995413503908707752998, 0.30990454819110768713841252974817, 0.31018437427126732686133436800446, 0.31046445301837100050335038758931, 0.31074478466056248970872388781572, 0.31102536942619168902623982830846, 0.31130620754381449488690236648836, 0.31158729924219324969314470763493, 0.31186864475029696386343402991770, 0.31215024429730120480996902188053, 0.31243209811258859653904096376209, 0.31271420642574887516218495875364, 0.31299656946657905542963362677256, 0.31327918746508365277492202949361, 0.31356206065147490535949259538029, 0.31384518925617277407269511968479, 0.31412857350980544213214784576849, 0.31441221364320931508373746510188, 0.31469610988742913182392157978029, 0.31498026247371829766663609007082, 0.31526467163353910638790011944366, 0.31554933759856268471466478331422, 0.31583426060066949192517427036364, 0.31611944087194937536011707379657, 0.31640487864470157042262599134119, 0.31669057415143525568979043782747, 0.31697652762486944189035398267151, 0.31726273929793330497162173742254, 0.31754920940376635263291404953634, 0.31783593817571859085902019614878, 0.31812292584735069045365207784926, 0.31841017265243426459520037496986, 0.31869767882495209088133947261667, 0.31898544459909800030672499815410, 0.31927347020927748788565736504097, 0.31956175589010765714093054157274, 0.31985030187641733112613451339712, 0.32013910840324749651486513357668, 0.32042817570585141462302658510453, 0.32071750401969456589768014964648, 0.32100709358045526053970775137714, 0.32129694462402458299266072572209, 0.32158705738650639194275981935789, 0.32187743210421798645270996530598, 0.32216806901368999493939782041707, 0.32245896835166643068504299662891, 0.32275013035510535797101283606025, 0.32304155526117872554436871723738, 0.32333324330727236661786605509405, 0.32362519473098677602607153858116, 0.32391740977013694369190943689318, 0.32420988866275241013781283072603, 0.32450263164707782159723592485534, 0.32479563896157293001465404813644, 0.32508891084491264855671488476219, 0.32538244753598760672375078684126, 0.32567624927390403932747631188249, 0.32597031629798395302444191656832, 0.32626464884776573693869750059093, 0.32655924716300388510603625036310, 0.32685411148366932954090202656516, 0.32714924204994977330329675169196, 0.32744463910224985703223410382634, 0.32774030288119110343458828538132, 0.32803623362761241688545510442054, 0.32833243158257030547275689968956, 0.32862889698733865895263761558454, 0.32892563008340935937212634598836, 0.32922263111249244760259102804412, 0.32951990031651601231743597963941, 0.32981743793762668959246298072685, 0.33011524421818977392817373583966, 0.33041331940078938478322356786521, 0.33071166372822863310787511181843, 0.33101027744353006543320816490450, 0.33130916078993533080421229897183, 0.33160831401090595793590409812168, 0.33190773735012329970217592745030, 0.33220743105148858864694716430677, 0.33250739535912343658452527961344, 0.33280763051736983459960583786597, 0.33310813677079037509187742216454, 0.33340891436416841830947532798746, 0.33370996354250859194934264451149, 0.33401128455103645809032286706497, 0.33431287763519912381582344096387, 0.33461474304066540774726945528528, 0.33491688101332572902180118035176, 0.33521929179929282893724007408309, 0.33552197564490143788518139444932, 0.33582493279670883046250651204900, 0.33612816350149476996023167885141, 0.33643166800626211898617157203262, 0.33673544655823645088688067517069, 0.33703949940486677139261928459746, 0.33734382679382551861735350939853, 0.33764842897300861856990650267107, 0.33795330619053592924316831158649, 0.33825845869475146265870080242166, 0.33856388673422316282213273552770, 0.33886959055774379390157946545514, 0.33917557041433049613843309089134, 0.33948182655322528544772353598091, 0.33978835922389533097387470661488, 0.34009516867603306611300695294631, 0.34040225515955618851293706939032, 0.34070961892460827069584183846018, 0.34101726022155876005825803076732, 0.34132517930100297887108240502130, 0.34163337641376256836878155809245, 0.34194185181088587732745054381667, 0.34225060574364762899790548544843, 0.34255963846354964275064958201256, 0.34286895022232077856472187704640, 0.34317854127191710356115095237328, 0.34348841186452228058101354690734, 0.34379856225254767920773701916914, 0.34410899268863254230055304105917, 0.34441970342564420803910252288915, 0.34473069471667849850149423218681, 0.34504196681505949761969986866461, 0.34535351997434032833567130182928, 0.34566535444830281953443318343488, 0.34597747049095800564444402880326, 0.34628986835654634868220114185533, 0.34660254829953790478569430888456, 0.34691551057463226870325456729915, 0.34722875543675935094967144323164, 0.34754228314107904473928556399187, 0.34785609394298155905289604561403, 0.34817018809808786272697034291923, 0.34848456586224985098709794328897, 0.34879922749155006789223421037605, 0.34911417324230253900196885297191, 0.34942940337105282688767715626454, 0.34974491813457780908791505680711, 0.35006071778988645526453638012754, 0.35037680259421988271384407198639, 0.35069317280505118983313650460332, 0.35100982868008617776567348300887, 0.35132677047726329488952501378662, 0.35164399845475385886217623010452, 0.35196151287096233417628354800399, 0.35227931398452655420427959143126, 0.35259740205431766568722196097951, 0.35291577733944090589091047149850, 0.35323444009923521402782853328972, 0.35355339059327378636865546468471, 0.35387262908136413175341772330285, 0.35419215582354851568069875611400, 0.35451197108010379377418530566501, 0.35483207511154196689417972265801, 0.35515246817861034767105365972384, 0.35547315054229139397179437764862, 0.35579412246380348605612198298331, 0.35611538420460081555418696552806, 0.35643693602637355200002389210567, 0.35675877819104828692076125662425, 0.35708091096078803383662148007716, 0.35740333459799250581667706683220, 0.35772604936529839303460676092072, 0.35804905552557958481330047106894, 0.35837235334194722513601050195575, 0.35869594307775004571325894175970, 0.35901982499657469904974504970596, 0.35934399936224559191089156229282, 0.35966846643882560696781069964345, 0.35999322649061593626385047173244, 0.36031827978215641428150206593273, 0.36064362657822573998700477204693, 0.36096926714384186540840460111212, 0.36129520174426166256864689785289, 0.36162143064498186717514727206435, 0.36194795411173880106403544232307, 0.36227477241050876077821385479183, 0.36260188580750812858966014573525, 0.36292929456919381658863699158246, 0.36325699896226315566138964641141, 0.36358499925365439509050702326931, 0.36391329571054686908837538794614, 0.36424188860036094128602712771681, 0.36457077819075872637810675769288, 0.36489996474964381256711476453347, 0.36522944854516176116376868776570, 0.36555922984570021760930558230029, 0.36588930891988930005354063723644, 0.36621968603660143282141348208825, 0.36655036146495212356910542439437, 0.36688133547429963021713206217100, 0.36721260833424546055070436523238, 0.36754418031463470528663606273767, 0.36787605168555603807334364319104, 0.36820822271734188202430004821508, 0.36854069368056890931839575387130, 0.36887346484605809671109000191791, 0.36920653648487483655671326232550, 0.36953990886832938089767708333966, 0.36987358226797695248677655399661, 0.37020755695561796683179522915452, 0.37054183320329814321780759200919, 0.37087641128330917084099382918794, 0.37121129146818809818597628691350, 0.37154647403071855427114655867626, 0.37188195924393024904830440391379, 0.37221774738109925095841390429996, 0.37255383871574876408772070135456, 0.37289023352164868407854214638064, 0.37322693207281620875193084430066, 0.37356393464351589361882588491426, 0.37390124150826015148041392421874, 0.37423885294180886385007056560426, 0.37457676921917038015408252249472, 0.37491499061560124017589146205864, 0.37525351740660639610069893024047, 0.37559234986793976762697866433882, 0.37593148827560418645532536174869, 0.37627093290585161833305960499274, 0.37661068403518360714343771178392, 0.37695074194035133041680296628329, 0.37729110689835571035288808161567, 0.37763177918644791342117628119013, 0.37797275908212951689435499247338, 0.37831404686315245333716461573204, 0.37865564280751967674021329912648, 0.37899754719348510700882570745307, 0.37933976029955368547419425340195, 0.37968228240448209653834510390880, 0.38002511378727871216298694889701, 0.38036825472720364738066223253554, 0.38071170550376931540625946581713, 0.38105546639674053865931568907399, 0.38139953768613460427516770323564, 0.38174391965222170819416191989149, 0.38208861257552528822856174883782, 0.38243361673682174650679144178866, 0.38277893241714128214070456124318, 0.38312455989776778020328151797003, 0.38347049946023897826208326478081, 0.38381675138634702149076360910840, 0.38416331595813840715791798174905, 0.38451019345791420667168836189376, 0.38485738416823062069127558970649, 0.38520488837189875708233444129291, 0.38555270635198518602848594127863, 0.38590083839181210656477105658269, 0.38624928477495751311110439019103, 0.38659804578525536200572787493002, 0.38694712170679607110557185478683, 0.38729651282392640876395262239384, 0.38764621942124999343093350034906, 0.38799624178362734916447607247392, 0.38834658019617634971965003387595, 0.38869723494427216303748195969092, 0.38904820631354763982301392388763, 0.38939949458989370212336211807269, 0.38975110005945923230541438897490, 0.39010302300865157265619131976564, 0.39045526372413674742745115509024, 0.39080782249283940732453856981010, 0.39116069960194349564019944409665, 0.39151389533889224825458086343133, 0.39186740999138824914638234986342, 0.39222124384739398550436817458831, 0.39257539719513218079427474549448, 0.39292987032308535066960075710085, 0.39328466351999685768348058445554, 0.39363977707487063373292812684667, 0.39399521127697162414804665786505, 0.39435096641582589871433128791978, 0.39470704278122104025072758304304, 0.39506344066320614460963156489015, 0.39542016035209232027725079205993, 0.39577720213845296592936051638389, 0.39613456631312343736439629537927, 0.39649225316720204670417615488986, 0.39685026299204989586044689531263, 0.39720859607929098755718655411329, 0.39756725272081283595326794966240, 0.39792623320876652215360991249327, 0.39828553783556674972032851655968, 0.39864516689389234427309816055640, 0.39900512067668653104490772420831, 0.39936539947715676834860687449691, 0.39972600358877552473302330326987, 0.40008693330528022347181149598327, 0.40044818892067335358575519421720, 0.40080977072922291393197724573838, 0.40117167902546285729314945456281, 0.40153391410419275731058519340877, 0.40189647626047847461805417879077, 0.40225936578965243439753862730868, 0.40262258298731357086808202438988, 0.40298612814932777137499897435191, 0.40335000157182820945678258794942, 0.40371420355121517831165078860067, 0.40407873438415675693136108748149, 0.40444359436758903214581550855655, 0.40480878379871593208960689480591, 0.40517430297500994784698491457675, 0.40554015219421207794070483032556, 0.40590633175433221691008611742291, 0.40627284195364926633331492666912, 0.40663968309071157891665393435687, 0.40700685546433695849444234227121, 0.40737435937361304860715449649433, 0.40774219511789766556830727495253, 0.40811036299681874295330885615840, 0.40847886331027494222212226304691, 0.40884769635843565271926536297542, 0.40921686244174110269611333023931, 0.40958636186090313646701588368160, 0.40995619491690499236469236166158, 0.41032636191100158029598787834402, 0.41069686314471981480878071124607, 0.41106769891985917020349461381556, 0.41143886953849123644388896536839, 0.41181037530296055182432723995589, 0.41218221651588471399207946888055, 0.41255439348015443545847347195377, 0.41292690649893398768810470755852, 0.41329975587566142314344119768066, 0.41367294191404857528482352790888, 0.41404646491808183572658208504436, 0.41442032519202187668128090081154, 0.41479452304040403953777627066302, 0.41516905876803877895042660384206, 0.41554393268001177386139488589833, 0.41591914508168409403410237246135, 0.41629469627869258863128720804525, 0.41667058657695010825960935108014, 0.41704681628264561599195303642773, 0.41742338570224463145663662544393, 0.41780029514248945288201753101021, 0.41817754491039915709649221753352, 0.41855513531327015464000851352466, 0.41893306665867652283097299914516, 0.41931133925446961718819238740252, 0.41968995340877918165389814930677, 0.42006890943001301552683912632347, 0.42044820762685725101803768666286, 0.42082784830827701938460450037383, 0.42120783178351633990743607682816, 0.42158815836209834193581968975195, 0.42196882835382565346549199603032, 0.42234984206878090073900011702790, 0.42273119981732631966764301978401, 0.42311290191010458849873998588009, 0.42349494865803893883793307395536, 0.42387734037233315564918711970677, 0.42426007736447218787745327972516, 0.42464315994622225947097149401088, 0.42502658842963086938127048597380, 0.42541036312702745769698253752722, 0.42579448435102362768844841411919, 0.42617895241451281274080997718556, 0.42656376763067138657703480930650, 0.42694893031295838570216005791735, 0.42733444077511573144789736033999, 0.42772029933116878508414515636105, 0.42810650629542651435244238200539, 0.42849306198248149346596846953616, 0.42887996670721051373220689129084, 0.42926722078477469457524762219691, 0.42965482453061948353578713977186, 0.43004277826047543342724566173274, 0.43043108229035820233576714599621, 0.43081973693656849810906805942068, 0.43120874251569285551255461541587, 0.43159809934460369174047400520067, 0.43198780774045941743821686031879, 0.43237786802070482528037587144354, 0.43276828050307153405995563844044, 0.43315904550557776664376774533594, 0.43355016334652912712854799792694, 0.43394163434451854532980519252305, 0.43433345881842655433757727223565, 0.43472563708742173460564117704052, 0.43511816947096093599611776880920, 0.43551105628878911124601813753543, 0.43590429786094025965681453271827, 0.43629789450773731607213790084643, 0.43669184654979226190008034791390, 0.43708615430800668022470745199826, 0.43748081810357203336181441954977, 0.43787583825796955183662362287578, 0.43827121509297090051759937523457, 0.43866694893063840066105285586673, 0.43906304009332486337768841622164, 0.43945948890367442229987204882491, 0.43985629568462247807048015602049, 0.44025346075939597589865570625989, 0.44065098445151368311556439039123, 0.44104886708478668877475570297975, 0.44144710898331818160755801727646, 0.44184571047150422717919582282775, 0.44224467187403376788878972547536, 0.44264399351588867848050767861423, 0.44304367572234459871083345205989, 0.44344371881897082232626416953281, 0.44384412313163029706331030865840, 0.44424488898648062384921786360792, 0.44464601670997366822390972629364, 0.44504750662885611545149799894716, 0.44544935907016963705373768789286, 0.44585157436125133489923655361054, 0.44625415282973374120345511073538, 0.44665709480354526261791647812061, 0.44706040061091051329711376638443, 0.44746407058035025938735884665221, 0.44786810504068202964944589439256, 0.44827250432102039301440754570649, 0.44867726875077679205006120355392, 0.44908239865966032011712627536326, 0.44948789437767777688037540428923, 0.44989375623513377933093693172850, 0.45029998456263131689780720989802, 0.45070657969107202900360675812408, 0.45111354195165598301997533781105, 0.45152087167588256244599165256659, 0.45192856919555052241932457945950, 0.45233663484275798971623316901969, 0.45274506894990307337423018907430, 0.45315387184968414224783828103682, 0.45356304387509971398628749739146, 0.45397258535944912116733007678704, 0.45438249663633284436414783158398, 0.45479277803965212356729352904949, 0.45520342990361012391886674777197, 0.45561445256271165815675772137183, 0.45602584635176335314810103227501, 0.45643761160587437153424161806470, 0.45684974866045657826418846525485, 0.45726225785122431855000968425884, 0.45767513951419541706755467203038, 0.45808839398569095591184918703220, 0.45850202160233560766400273678300, 0.45891602270105819050272089043574, 0.45933039761909166820430527877761, 0.45974514669397342769840975051920, 0.46016027026354572315725022235711, 0.46057576866595589804020960400521, 0.46099164223965649611614026071038, 0.46140789132340570555257386331505, 0.46182451625626774749378000706201, 0.46224151737761270952731251782097, 0.46265889502711737835127792095591, 0.46307664954476518426318421006727, 0.46349478127084636769339454076544, 0.46391329054595864533894200576469, 0.46433217771100726567468086614099, 0.46475144310720511997558901384764, 0.46517108707607324191712905303575, 0.46559110995944130717560938137467, 0.46601151209944724485012557124719, 0.46643229383853818115213130113261, 0.46685345551947043940543835560675, 0.46727499748530965106851908785757, 0.46769692007943131084601873226347, 0.46811922364552122077796525445592, 0.46854190852757499063940826999897, 0.46896497506989925918574613206147, 0.46938842361711147210812100638577, 0.46981225451414004856687256506120, 0.47023646810622510283650399287581, 0.47066106473891838879453075605852, 0.47108604475808363298838798982615, 0.47151140850989681219118665467249, 0.47193715634084676402437708020443, 0.47236328859773479837969034633716, 0.47278980562767553008640675216157, 0.47321670777809721197826320349122, 0.47364399539674140182654582531541, 0.47407166883166396154081212443998, 0.47449972843123494614658852697175, 0.47492817454413882582997530334978, 0.47535700751937509656031011218147, 0.47578622770625839111247046275821, 0.47621583545441853457802494631323, 0.47664583111380126601019924237335, 0.47707621503466834944617858127458, 0.47750698756759746288480528164655, 0.47793814906348314197614968179550, 0.47836969987353689104381260221999, 0.47880164034928685001801795806387, 0.47923397084257896016978861553071, 0.47966669170557685308864392936812, 0.48009980329076185068259974286775, 0.48053330595093390886773931924836, 0.48096720003921134001245718536666, 0.48140148590903125702666898177995, 0.48183616391414996193987008155091, 0.48227123440864338999034544031019, 0.48270669774690677655826220870949, 0.48314255428365571187754312632023, 0.48357880437392591899126159660227, 0.48401544837307358681854907445086, 0.48445248663677609179956107254839, 0.48488991952103166482856977381743, 0.48532774738216011289893003777252, 0.48576597057680293012538186303573, 0.48620458946192374183326023739937, 0.48664360439480830455849513782596, 0.48708301573306517218142630554212, 0.48752282383462580694910570855427, 0.48796302905774457947529754164862, 0.48840363176099965691889792651637, 0.48884463230329289196163244923810, 0.48928603104385004485266108531505, 0.48972782834222150505354420602089, 0.49017002455828223572709134714387, 0.49061262005223182924851244024467, 0.49105561518459561742844243781292, 0.49149901031622422742373146320460, 0.49194280580829397031550342944684, 0.49238700202230745173181958307396, 0.49283159932009379389228342915885, 0.49327659806380858009688950005511, 0.49372199861593452085983813049097, 0.49416780133928178697644284511625, 0.49461400659698773196737420221325, 0.49506061475251800230168441885326, 0.49550762616966637086335367712309, 0.49595504121255484797359258664073, 0.49640286024563445854695942216495, 0.49685108363368524209136012359522, 0.49729971174181658577495568351878, 0.49774874493546755749306953475752, 0.49819818358040734995739740043064, 0.49864802804273505865140236892330, 0.49909827868888068103103705652757, 0.49954893588560511652474360744236, 0.50000000000000000000000000000000, 0.50045147139948886749749590308056, 0.50090335045182687867537651982275, 0.50135563752510126089845243768650, 0.50180833298773142026050209096866, 0.50226143720846971874038899841253, 0.50271495055640136317975930069224, 0.50316887340094484937225161047536, 0.50362320611185196206349701242289, 0.50407794905920877415184122583014, 0.50453310261343531362143721707980, 0.50498866714528600763145504970453, 0.50544464302585023762759419696522, 0.50590103062655233934208354185103, 0.50635783031915204688289122714195, 0.50681504247574471477832958044019, 0.50727266746876187308856742674834, 0.50773070567097100536102516343817, 0.50818915745547654783109692289145, 0.50864802319571955635524318495300, 0.50910730326547837254480555202463, 0.50956699803886895683291413661209, 0.51002710789034488847448756132508, 0.51048763319469792065774527145550, 0.51094857432705831357111492252443, 0.51140993166289494542553484279779, 0.51187170557801564552136142083327, 0.51233389644856786038218388057430, 0.51279650465103832068791689380305, 0.51325953056225392945322028026567, 0.51372297455938187304980147018796, 0.51418683701992973222871796679101, 0.51465111832174603723188965886948, 0.51511581884302048983670374582289, 0.51558093896228440744522458771826, 0.51604647905841061206189124277444, 0.51651243951061420744963470497169, 0.51697882069845280117448282908299, 0.51744562300182650460556033067405, 0.51791284680097859904890356119722, 0.51838049247649564676976297050714, 0.51884856040930782405951049440773, 0.51931705098068936532484940471477, 0.51978596457225878513241923428723, 0.52025530156597898923109823954292, 0.52072506234415805170812063806807, 0.52119524728944899294447168358602, 0.52166585678485044574870244105114, 0.52213689121370687740153471168014, 0.52260835095970903374507088301471, 0.52308023640689371713818900389015, 0.52355254793964489667956740959198, 0.52402528594269348616307979682460, 0.52449845080111778816700507377391, 0.52497204290034360507632982262294, 0.52544606262614512726116799967713, 0.52592051036464471103215601033298, 0.52639538650231321170736009662505, 0.52687069142597053872378864980419, 0.52734642552278609972660206040018, 0.52782258918027857852450779319042, 0.52829918278631671224587762480951, 0.52877620672911951338335256878054, 0.52925366139725638081614533803076, 0.52973154717964765492155265746987, 0.53020986446556483961956018902129, 0.53068861364463104646205238168477, 0.53116779510682099463281247153645, 0.53164740924246156605903479430708, 0.53212745644223224950053463544464, 0.53260793709716514054974823011435, 0.53308885159864549674324507577694, 0.53357020033841184858403039470431, 0.53405198370855655465305744655780, 0.53453420210152591263152999090380, 0.53501685591012093645701952482341, 0.53549994552749669018965050781844, 0.53598347134716373130203237451497, 0.53646743376298777761235214711633, 0.53695183316919015137358428546577, 0.53743666996034822336270053710905, 0.53792194453139552390297239981010, 0.53840765727762229797548343412927, 0.53889380859467561624143172593904, 0.53938039887855993015364219900221, 0.53986742852563707195656661497196, 0.54035489793262692082009834848577, 0.54084280749660762488417731219670, 0.54133115761501560125878995677340, 0.54181994868564642420238897102536, 0.54230918110665460307728835687158, 0.54279885527655447052808312946581, 0.54328897159421973839243946713395, 0.54377953045888482996872426156187, 0.54427053227014421388219034270151, 0.54476197742795329226339617889607, 0.54525386633262884483741572694271, 0.54574619938484869585693104454549, 0.54623897698565271330295445295633, 0.54673219953644291990713099949062, 0.54722586743898371519634338255855, 0.54771998109540209753731687669642, 0.54821454090818844129273657017620, 0.54870954728019638579894490248989, 0.54920500061464339047745397692779, 0.54970090131511095687955048560980, 0.55019724978554507277550555954804, 0.55069404643025632317687723116251, 0.55119129165392044544802274685935, 0.55168898586157866237300595457782, 0.55218712945863768215559730379027, 0.55268572285087058659769354562741, 0.55318476644441672007701527036261, 0.55368426064578180056940936992760, 0.55418420586183936293878105061594, 0.55468460249982953769176674541086, 0.55518545096736060528996858920436, 0.55568675167240877410534949376597, 0.55618850502331873553174546032096, 0.55669071142880377500716804206604, 0.55719337129794621610301419423195, 0.55769648504019797563557858666172, 0.55820005306538011957684375374811, 0.55870407578368463941131949468399, 0.55920855360567300884611086075893, 0.55971348694227807119006001812522, 0.56021887620480337321993147270405, 0.56072472180492394233652930779499, 0.56123102415468650860930210910738, 0.56173778366650994886555281482288, 0.56224500075318528669043871559552, 0.56275267582787669162769361719256, 0.56326080930412092406811552791623, 0.56376940159582855649489374627592, 0.56427845311728352939439901092555, 0.56478796428314403943460320078884, 0.56529793550844287253198672260623, 0.56580836720858718180693358590361, 0.56631925979935959780675602814881, 0.56683061369691789543878712720471, 0.56734242931779566010419557642308, 0.56785470707890273178719553470728, 0.56836744739752531607734908902785, 0.56888065069132631723647364196950, 0.56939431737834578228785176179372, 0.56990844787700145612774349501706, 0.57042304260608867050308390389546, 0.57093810198478078810069291648688, 0.57145362643263009072569502677652, 0.57196961636956711316770451958291, 0.57248607221590208649075748326140, 0.57300299439232460496640442215721, 0.57352038331990384811831518163672, 0.57403823942008946890069864821271, 0.57455656311471181574290767457569, 0.57507535482598159948253169204690, 0.57559461497649133665532872328185, 0.57611434398921479438371306969202, 0.57663454228750765651057008653879, 0.57715521029510796768846603299608, 0.57767634843613646644655545969727, 0.57819795713509669621288367125089, 0.57872003681687556042589903881890, 0.57924258790674354457905792514794, 0.57976561083035516031003453463200, 0.58028910601374938948993076337501, 0.58081307388334979524557866170653, 0.58133751486596485502644782172865, 0.58186242938878873776076261492562, 0.58238781787940108181089726713253, 0.58291368076576766110719063362922, 0.58344001847624082923715604920289, 0.58396683143955940842317886563251, 0.58449412008484957770093615181395, 0.58502188484162509496400161879137, 0.58555012613978729696384561975719, 0.58607884440962565442134746263037, 0.58660804008181866020521511018160, 0.58713771358743305217586794242379, 0.58766786535792503443076384428423, 0.58819849582514061037130659315153, 0.58872960542131558270284585887566, 0.58926119457907577547928212879924, 0.58979326373143792228148640788277, 0.59032581331180988826190514373593, 0.59085884375399044809995530158631, 0.59139235549217050724735145195154, 0.59192634896093265783889592057676, 0.59246082459525217789320095107541, 0.59299578283049692029038624241366, 0.59353122410242797890589372400427, 0.59406714884719968861048755570664, 0.59460355750136051344867382795201, 0.59514045050185293561639809922781, 0.59567782828601401057255770865595, 0.59621569129157558908360670102411, 0.59675403995666487233506813936401, 0.59729287471980463397613902998273, 0.59783219601991366420890017252532, 0.59837200429630699183292108500609, 0.59891229998869621731216739135562, 0.59945308353719028993111805903027, 0.59999435538229517472785801146529, 0.60053611596491496271710275323130, 0.60107836572635153782329098248738, 0.60162110510830557608130675362190, 0.60216433455287610154726962718996, 0.60270805450256192958846668261685, 0.60325226540026088972723528058850, 0.60379696768927115790859261323931, 0.60434216181329081241102585408953, 0.60488784821641883304721432068618, 0.60543402734315499014172701208736, 0.60598069963840062168713984647184, 0.60652786554745863334403566113906, 0.60707552551603405355251652508741, 0.60762367999023447762141358907684, 0.60817232941657006772828708562884, 0.60872147424195421905324110412039, 0.60927111491370422591273836587789, 0.60982125187954072664808791159885, 0.61037188558758892487077218902414, 0.61092301648637881150705197796924, 0.61147464502484494275336146529298, 0.61202677165232755029933287005406, 0.61257939681857276337240136854234, 0.61313252097373227567089770673192, 0.61368614456836456660937528795330, 0.61424026805343501234091263540904, 0.61479489188031610780171831720509, 0.61535001650078768875573587138206, 0.61590564236703793099536596855614, 0.61646176993166312829686148688779, 0.61701839964766791446493243711302, 0.61757553196846670662267797524692, 0.61813316734788248396625931491144, 0.61869130624014856412173912758590, 0.61924994909990827007817415505997, 0.61980909638221548529912752201199, 0.62036874854253465372266873600893, 0.62092890603674200100670077517862, 0.62148956932112509043975023814710, 0.62205073885238337805247965661692, 0.62261241508762898977380473297671, 0.62317459848438649938628941526986, 0.62373728950059381670456559731974, 0.62430048859460240961993804376107, 0.62486419622517719307808192752418, 0.62542841285149775032436991750728, 0.62599313893315811085926725354511, 0.62655837493016730554984405898722, 0.62712412130294969969668272824492, 0.62769037851234554814539023936959, 0.62825714701961088426429569153697, 0.62882442728641863016747493020375, 0.62939221977485826364784315956058, 0.62996052494743659533327218014165, 0.63052934326707810175349777637166, 0.63109867519712536942932956662844, 0.63166852120133909487265100324294, 0.63223888174389875072023414759315, 0.63280975728940314084525198268238, 0.63338114830287051137958087565494, 0.63395305524973888378070796534303, 0.63452547859586660994324347484508, 0.63509841880753270526582809907268, 0.63567187635143707069573792978190, 0.63624585169470138090730415569851, 0.63682034530486864021270321245538, 0.63739535764990418176267894523335, 0.63797088919819600061344999630819, 0.63854694041855508679361719259759, 0.63912351178021520325955862062983, 0.63970060375283466225226902679424, 0.64027821680649499302973026715335, 0.64085635141170271822375070769340, 0.64143500803938913179536029929295, 0.64201418716091063210171796526993, 0.64259388924804905496301898892852, 0.64317411477301278388551963871578, 0.64375486420843597290541993061197, 0.64433613802737987885649317831849, 0.64491793670333286137008599325782, 0.64550026071021082696432813463616, 0.64608311052235734006643497195910, 0.64666648661454473323573211018811, 0.64725038946197366307444553967798, 0.64783481954027388738381887378637, 0.64841977732550482027562566145207, 0.64900526329415575421677431222633, 0.64959127792314586002930809627287, 0.65017782168982529711342976952437, 0.65076489507197521344750157368253, 0.65135249854780796763265016124933, 0.65194063259596790604888383313664, 0.65252929769553147387739500118187, 0.65311849432600765918977003821055, 0.65370822296733865908180405313033, 0.65429848409989954660659350338392, 0.65488927820449960304216574513703, 0.65548060576238220686917657076265, 0.65607246725522494479321267135674, 0.65666486316514061094551379937911, 0.65725779397467731790527523116907, 0.65785126016681882976655515449238, 0.65844526222498489520518205608823, 0.65903980063303202463487195927883, 0.65963487587525337918492596145370, 0.66023048843637954785634747167933, 0.66082663880157876956644713573041, 0.66142332745645737723805268615251, 0.66202055488706001984411386729334, 0.66261832157987066160842459794367, 0.66321662802181191587180819624336, 0.66381547470024659940435185490060, 0.66441486210297717729389432861353, 0.66501479071824687316905055922689, 0.66561526103473966919921167573193, 0.66621627354158075018375484432909, 0.66681782872833694764125311849057, 0.66741992708501718389868528902298, 0.66802256910207291618064573412994, 0.66862575527039824763164688192774, 0.66922948608133070447223644805490, 0.66983376202665145804360236070352, 0.67043858359858565787448014816619, 0.67104395128980287577036278889864, 0.67164986559341766092501302409801, 0.67225632700298965094276582021848, 0.67286333601252423797234314406523, 0.67347089311647290177376135034137, 0.67407899880973365380754103171057, 0.67468765358765092621240455628140, 0.67529685794601723713981300534215, 0.67590661238107185848633662317297, 0.67651691738950281429509914232767, 0.67712777346844632564426547105541, 0.67773918111548758780315893091029, 0.67835114082866088125456371926703, 0.67896365310645057089544707196183, 0.67957671844779066194774941322976, 0.68019033735206602120371144337696, 0.68080451031911237702587413878064, 0.68141923784921665241398613943602, 0.68203452044311752011651606153464, 0.68265035860200595774216481004260, 0.68326675282752524775986557870056, 0.68388370362177175465490108763333, 0.68450121148729525799581097089685, 0.68511927692709939652360162654077, 0.68573790044464155712944375409279, 0.68635708254383420712230190474656, 0.68697682372904456116202709381469, 0.68759712450509535841547403833829, 0.68821798537726508460110608211835, 0.68883940685128852710050750829396, 0.68946138943335699700298846437363, 0.69008393363011899523939973732922, 0.69070703994868065667134260365856, 0.69133070889660552804656390435412, 0.69195494098191601128888805760653, 0.69257973671309269736440228371066, 0.69320509659907569854908615525346, 0.69383102114926453740650913459831, 0.69445751087351870189934288646327, 0.69508456628215797845626866546809, 0.69571218788596311810579209122807, 0.69634037619617583647624314835411, 0.69696913172449959095189342406229, 0.69759845498310013578446842075209, 0.69822834648460518902624016845948, 0.69885880674210554275305185001343, 0.69948983626915561817583011361421, 0.70012143557977302155137522277073, 0.70075360518843965440538568145712, 0.70138634561010237966627300920663, 0.70201965736017235553134696601774, 0.70265354095452658977905002757325, 0.70328799690950771772435246020905, 0.70392302574192466835256709600799, 0.70455862796905299738625672034686, 0.70519480410863533137444392195903, 0.70583155467888181178182094299700, 0.70646888019847042805565706657944, 0.70710678118654757273731092936941, 0.70774525816272826350683544660569, 0.70838431164709703136139751222800, 0.70902394216020758754837061133003, 0.70966415022308404481066190783167, 0.71030493635722069534210731944768, 0.71094630108458278794358875529724, 0.71158824492760697211224396596663, 0.71223076840920163110837393105612, 0.71287387205274710400004778421135, 0.71351755638209657384152251324849, 0.71416182192157606767324296015431, 0.71480666919598501163335413366440, 0.71545209873059678606921352184145, 0.71609811105115916962660094213788, 0.71674470668389445027202100391150, 0.71739188615550009142651788351941, 0.71803964999314928707718763689627, 0.71868799872449118382178312458564, 0.71933693287765121393562139928690, 0.71998645298123187252770094346488, 0.72063655956431282856300413186545, 0.72128725315645159099631200660951, 0.72193853428768361979450673970859, 0.72259040348852332513729379570577, 0.72324286128996373435029454412870, 0.72389590822347760212807088464615, 0.72454954482101752155642770958366, 0.72520377161501625717932029147050, 0.72585858913838763317727398316492, 0.72651399792452631132277929282282, 0.72716999850730879018101404653862, 0.72782659142109373817675077589229, 0.72848377720072188257205425543361, 0.72914155638151745275621351538575, 0.72979992949928762513422952906694, 0.73045889709032352232753737553139, 0.73111845969140043521861116460059, 0.73177861783977860010708127447288, 0.73243937207320286564282696417649, 0.73310072292990424713821084878873, 0.73376267094859926043426412434201, 0.73442521666849092110140873046475, 0.73508836062926952159557458799100, 0.73575210337111207614668728638208, 0.73641644543468376404860009643016, 0.73708138736113781863679150774260, 0.73774692969211619342218000383582, 0.73841307296974967311342652465100, 0.73907981773665876179535416667932, 0.73974716453595390497355310799321, 0.74041511391123593366359045830905, 0.74108366640659639745791764653404, 0.74175282256661823065968519586022, 0.74242258293637619637195257382700, 0.74309294806143710854229311735253, 0.74376391848786038707430634531192, 0.74443549476219850191682780859992, 0.74510767743149752817544140270911, 0.74578046704329736815708429276128, 0.74645386414563241750386168860132, 0.74712786928703189825995423234417, 0.74780248301652019193852538592182, 0.74847770588361772770014113120851, 0.74915353843834076030816504498944, 0.74982998123120236932948046160163, 0.75050703481321279220139786048094, 0.75118469973587953525395732867764, 0.75186297655120837291065072349738, 0.75254186581170323666611920998548, 0.75322136807036721428687542356784, 0.75390148388070266083360593256657, 0.75458221379671142070577616323135, 0.75526355837289582684235256238026, 0.75594551816425903378870998494676, 0.75662809372630490667432923146407, 0.75731128561503935348042659825296, 0.75799509438697010299534895239049, 0.75867952059910737094838850680389, 0.75936456480896419307669020781759, 0.76005022757455742432597389779403, 0.76073650945440729476132446507108, 0.76142341100753863081251893163426, 0.76211093279348107731863137814798, 0.76279907537226920855033540647128, 0.76348783930444341638832383978297, 0.76417722515105057645712349767564, 0.76486723347364349301358288357733, 0.76555786483428256428140912248637, 0.76624911979553556040656303594005, 0.76694099892047795652416652956163, 0.76763350277269404298152721821680, 0.76832663191627681431583596349810, 0.76902038691582841334337672378751, 0.76971476833646124138255117941299, 0.77040977674379751416466888258583, 0.77110541270397037205697188255726, 0.77180167678362421312954211316537, 0.77249856954991502622220878038206, 0.77319609157051072401145574986003, 0.77389424341359214221114370957366, 0.77459302564785281752790524478769, 0.77529243884249998686186700069811, 0.77599248356725469832895214494783, 0.77669316039235269943930006775190, 0.77739446988854432607496391938184, 0.77809641262709527964602784777526, 0.77879898917978740424672423614538, 0.77950220011891846461082877794979, 0.78020604601730325633468510204693, 0.78091052744827349485490231018048, 0.78161564498567881464907713962020, 0.78232139920388710230270135070896, 0.78302779067778449650916172686266, 0.78373481998277649829276469972683, 0.78444248769478808203103881169227, 0.78515079439026436158854949098895, 0.78585974064617070133920151420170, 0.78656932703999371536696116891108, 0.78727955414974126746585625369335, 0.78799042255394324829609331573010, 0.78870193283165179742866257583955, 0.78941408556244196947915270357043, 0.79012688132641228921926312978030, 0.79084032070418475157680404663552, 0.79155440427690593185872103276779, 0.79226913262624687472879259075853, 0.79298450633440409340835230977973, 0.79370052598409979172089379062527, 0.79441719215858197511437310822657, 0.79513450544162567190653589932481, 0.79585246641753304430721982498653, 0.79657107567113349944065703311935, 0.79729033378778468854619632111280, 0.79801024135337295106751298590098, 0.79873079895431353669721374899382, 0.79945200717755116048834906905540, 0.80017386661056044694362299196655, 0.80089637784134670717151038843440, 0.80161954145844593888625695399242, 0.80234335805092571458629890912562, 0.80306782820838551462117038681754, 0.80379295252095694923610835758154, 0.80451873157930486879507725461735, 0.80524516597462714173616404877976, 0.80597225629865565377230041121948, 0.80670000314365641891356517589884, 0.80742840710243035662330157720135, 0.80815746876831351386272217496298, 0.80888718873517806429163101711310, 0.80961756759743186417921378961182, 0.81034860595001989569396982915350, 0.81108030438842415588140966065112, 0.81181266350866443382017223484581, 0.81254568390729853266662985333824, 0.81327936618142315783330786871375, 0.81401371092867391698888468454243, 0.81474871874722609721430899298866, 0.81548439023579533113661454990506, 0.81622072599363748590661771231680, 0.81695772662054988444424452609383, 0.81769539271687119441622826343519, 0.81843372488348220539222666047863, 0.81917272372180638395633422987885, 0.81991238983380998472938472332316, 0.82065272382200316059197575668804, 0.82139372628943974063986388500780, 0.82213539783971834040698922763113, 0.82287773907698247288777793073677, 0.82362075060592110364865447991178, 0.82436443303176942798415893776109, 0.82510878696030887091694694390753, 0.82585381299786797537620941511705, 0.82659951175132273526457993284566, 0.82734588382809715056964705581777, 0.82809292983616367145316417008871, 0.82884065038404375336256180162309, 0.82958904608080807907555254132603, 0.83033811753607755790085320768412, 0.83108786536002354772278977179667, 0.83183829016336818806820474492270, 0.83258939255738517726257441609050, 0.83334117315390021651921870216029, 0.83409363256529123198390607285546, 0.83484677140448926291327325088787, 0.83560059028497890576403506202041, 0.83635508982079831419298443506705, 0.83711027062654042030231948956498, 0.83786613331735304566194599829032, 0.83862267850893923437638477480505, 0.83937990681755836330779629861354, 0.84013781886002603105367825264693, 0.84089641525371450203607537332573, 0.84165569661655414979151146326330, 0.84241566356703267981487215365632, 0.84317631672419668387163937950390, 0.84393765670765141795328645457630, 0.84469968413756180147800023405580, 0.84546239963465263933528603956802, 0.84622580382020917699747997176019, 0.84698989731607787767586614791071, 0.84775468074466631129837423941353, 0.84852015472894448677720902196597, 0.84928631989244451894194298802176, 0.85005317685926173876254097194760, 0.85082072625405502641626753757009, 0.85158896870204714435459436572273, 0.85235790482902562548161995437113, 0.85312753526134277315406961861299, 0.85389786062591666038201765331905, 0.85466888155023146289579472067999, 0.85544059866233757016829031272209, 0.85621301259085302870488476401079, 0.85698612396496298693193693907233, 0.85775993341442113848671624509734, 0.85853444156954927812819278187817, 0.85930964906123896707157427954371, 0.86008555652095097787679378598114, 0.86086216458071629364923182947678, 0.86163947387313699621813611884136, 0.86241748503138571102510923083173, 0.86319619868920738348094801040133, 0.86397561548091883487643372063758, 0.86475573604140965056075174288708, 0.86553656100614306811991127688088, 0.86631809101115553328753549067187, 0.86710032669305825425709599585389, 0.86788326868903709065961038504611, 0.86866691763685310867515454447130, 0.86945127417484358023358481659670, 0.87023633894192176096993307510274, 0.87102211257757822249203627507086, 0.87180859572188063033593152795220, 0.87259578901547463214427580169286, 0.87338369309958452380016069582780, 0.87417230861601336044941490399651, 0.87496163620714395570132637658389, 0.87575167651593910367324724575155, 0.87654243018594191205750121298479, 0.87733389786127680132210571173346, 0.87812608018664972675537683244329, 0.87891897780734884459974409764982, 0.87971259136924495614096031204099, 0.88050692151879195179731141251978, 0.88130196890302736623112878078246, 0.88209773416957337754951140595949, 0.88289421796663636321511603455292, 0.88369142094300856538069410817116, 0.88448934374806742475527698843507, 0.88528798703177735696101535722846, 0.88608735144468930844396936663543, 0.88688743763794153363022587654996, 0.88768824626326059412662061731680, 0.88848977797296124769843572721584, 0.88929203341994733644781945258728, 0.89009501325771223090299599789432, 0.89089871814033927410747537578573, 0.89170314872250266979847310722107, 0.89250830565946748240691022147075, 0.89331418960709063625813541875686, 0.89412080122182102659422753276885, 0.89492814116070051877471769330441, 0.89573621008136417032119425130077, 0.89654500864204078602881509141298, 0.89735453750155358410012240710785, 0.89816479731932064023425255072652, 0.89897578875535555376075080857845, 0.89978751247026755866187386345700, 0.90059996912526274481791688231169, 0.90141315938214394698491105373250, 0.90222708390331196603995067562209, 0.90304174335176523591428576764883, 0.90385713839110104483864915891900, 0.90467326968551597943246633803938, 0.90549013789980614674846037814859, 0.90630774369936817347337409955799, 0.90712608775019942797257499478292, 0.90794517071889835335696261608973, 0.90876499327266557770599320065230, 0.90958555607930424713458705809899, 0.91040685980722035886003595805960, 0.91122890512542320529121298022801, 0.91205169270352670629620206455002, 0.91287522321174885409078569864505, 0.91369949732091315652837693050969, 0.91452451570244863710001936851768, 0.91535027902839083413510934406077, 0.91617678797138191182369837406441, 0.91700404320467121532800547356601, 0.91783204540211638100544178087148, 0.91866079523818333640861055755522, 0.91949029338794685539681950103841, 0.92032054052709144631450044471421, 0.92115153733191179608041920801043, 0.92198328447931299223228052142076, 0.92281578264681141110514772663009, 0.92364903251253549498756001412403, 0.92448303475522541905462503564195, 0.92531779005423486772485830442747, 0.92615329908953036852636842013453, 0.92698956254169273538678908153088, 0.92782658109191740170018647404504, 0.92866435542201453134936173228198, 0.92950288621441023995117802769528, 0.93034217415214659485656056858716, 0.93118221991888261435121876274934, 0.93202302419889448970025114249438, 0.93286458767707647332656506478088, 0.93370691103894087881087671121350, 0.93454999497061930213703817571513, 0.93539384015886273271433992704260, 0.93623844729104233053362804639619, 0.93708381705514998127881653999793, 0.93792995013979851837149226412294, 0.93877684723422283319393955025589, 0.93962450902828009713374513012241, 0.94047293621245020567300798575161, 0.94132212947783677758906151211704, 0.94217208951616726597677597965230, 0.94302281701979373540467577186064, 0.94387431268169352804875416040886, 0.94472657719546959675938069267431, 0.94557961125535117119511596683878, 0.94643341555619442395652640698245, 0.94728799079348280365309165063081, 0.94814333766332792308162424887996, 0.94899945686246978127087459142786, 0.94985634908827765165995060669957, 0.95071401503875019312062022436294, 0.95157245541251678222494092551642, 0.95243167090883706915604989262647, 0.95329166222760264304270094726235, 0.95415243006933658787005470003351, 0.95501397513519492576961056329310, 0.95587629812696639497460182610666, 0.95673939974707367106532274192432, 0.95760328069857370003603591612773, 0.95846794168515792033957723106141, 0.95933338341115359515498539622058, 0.96019960658152370136519948573550, 0.96106661190186781773547863849672, 0.96193440007842256900261190821766, 0.96280297181806251405333796355990, 0.96367232782830003490204262561747, 0.96454246881728677998069088062039, 0.96541339549381355311652441741899, 0.96628510856731142375508625264047, 0.96715760874785172696022073068889, 0.96803089674614717363709814890171, 0.96890497327355218359912214509677, 0.96977983904206332965713954763487, 0.97065549476432022579786007554503, 0.97153194115360586025076372607145, 0.97240917892384748366652047479874, 0.97328720878961660911699027565191, 0.97416603146613045538515507359989, 0.97504564766925150287590895459289, 0.97592605811548915895059508329723, 0.97680726352199931383779585303273, 0.97768926460658567290096243596054, 0.97857206208770008970532217063010, 0.97945565668444312112939087455743, 0.98034004911656436043188023177208, 0.98122524010446365849702488048933, 0.98211123036919134587918733814149, 0.98299802063244834382516046389355, 0.98388561161658794063100685889367, 0.98477400404461490346363916614791, 0.98566319864018758778456685831770, 0.98655319612761716019377900011023, 0.98744399723186915274197872349760, 0.98833560267856346293058322771685, 0.98922801319397546393474840442650, 0.99012122950503611562567130022217, 0.99101525233933274172670735424617, 0.99191008242510969594718517328147, 0.99280572049126891709391884432989, 0.99370216726737048418272024719045, 0.99459942348363317154991136703757, 0.99549748987093522600844153203070, 0.99639636716081458889249233834562, 0.99729605608547011730280473784660, 0.99819655737776147308437657557079, 0.99909787177121012202718475236907, 1.00000000000000000000000000000000, 1.00090294279897773499499180616112, 1.00180670090365375735075303964550, 1.00271127505020252179690487537300, 1.00361666597546284052100418193731, 1.00452287441693965952538292185636, 1.00542990111280272635951860138448, 1.00633774680188969874450322095072, 1.00724641222370392412699402484577, 1.00815589811841754830368245166028, 1.00906620522687062724287443415960, 1.00997733429057201526291009940905, 1.01088928605170047525518839393044, 1.01180206125310467868416708370205, 1.01271566063830409376578245428391, 1.01363008495148942955665916088037, 1.01454533493752374617713485349668, 1.01546141134194201072205032687634, 1.01637831491095309566219384578289, 1.01729604639143911271048636990599, 1.01821460653095674508961110404925, 1.01913399607773791366582827322418, 1.02005421578068977694897512265015, 1.02097526638939584131549054291099, 1.02189714865411662714222984504886, 1.02281986332578989085106968559558, 1.02374341115603129104272284166655, 1.02466779289713572076436776114861, 1.02559300930207664137583378760610, 1.02651906112450785890644056053134, 1.02744594911876374609960294037592, 1.02837367403985946445743593358202, 1.02930223664349207446377931773895, 1.03023163768604097967340749164578, 1.03116187792456881489044917543652, 1.03209295811682122412378248554887, 1.03302487902122841489926940994337, 1.03395764139690560234896565816598, 1.03489124600365300921112066134810, 1.03582569360195719809780712239444, 1.03676098495299129353952594101429, 1.03769712081861564811902098881546, 1.03863410196137873064969880942954, 1.03957192914451757026483846857445, 1.04051060313195820050680140411714, 1.04145012468831610341624127613613, 1.04239049457889798588894336717203, 1.04333171356970089149740488210227, 1.04427378242741375480306942336028, 1.04521670191941806749014176602941, 1.04616047281378743427637800778029, 1.04710509587928979335913481918396, 1.04805057188538697232615959364921, 1.04899690160223557633401014754781, 1.04994408580068721015265964524588, 1.05089212525229025452233599935425, 1.05184102072928942206431202066597, 1.05279077300462642341472019325010, 1.05374138285194107744757729960838, 1.05469285104557219945320412080036, 1.05564517836055715704901558638085, 1.05659836557263342449175524961902, 1.05755241345823902676670513756108, 1.05850732279451276163229067606153, 1.05946309435929530984310531493975, 1.06041972893112967923912037804257, 1.06137722728926209292410476336954, 1.06233559021364198926562494307291, 1.06329481848492313211806958861416, 1.06425491288446449900106927088927, 1.06521587419433028109949646022869, 1.06617770319729099348649015155388, 1.06714040067682369716806078940863, 1.06810396741711310930611489311559, 1.06906840420305204730766490683891, 1.07003371182024187291403904964682, 1.07099989105499338037930101563688, 1.07196694269432746260406474902993, 1.07293486752597555522470429423265, 1.07390366633838030274716857093154, 1.07487333992069644672540107421810, 1.07584388906279104780594479962019, 1.07681531455524459595096686825855, 1.07778761718935123248286345187807, 1.07876079775711986030728439800441, 1.07973485705127414391313322994392, 1.08070979586525384164019669697154, 1.08168561499321524976835462439340, 1.08266231523003120251757991354680, 1.08363989737129284840477794205071, 1.08461836221330920615457671374315, 1.08559771055310894105616625893163, 1.08657794318843947678487893426791, 1.08755906091776965993744852312375, 1.08854106454028842776438068540301, 1.08952395485590680657139728282345, 1.09050773266525768967483145388542, 1.09149239876969739171386208909098, 1.09247795397130542660590890591266, 1.09346439907288583981426199898124, 1.09445173487796720834808184008580, 1.09543996219080419507463375339285, 1.09642908181637688258547314035241, 1.09741909456039277159788980497979, 1.09841000122928678095490795385558, 1.09940180263022191375910097121960, 1.10039449957109014555101111909607, 1.10138809286051264635375446232501, 1.10238258330784089089604549371870, 1.10337797172315732474601190915564, 1.10437425891727536431119460758055, 1.10537144570174117319538709125482, 1.10636953288883344015403054072522, 1.10736852129156382318342366488650, 1.10836841172367872587756210123189, 1.10936920499965907538353349082172, 1.11037090193472121057993717840873, 1.11137350334481754821069898753194, 1.11237701004663747106349092064193, 1.11338142285760755001433608413208, 1.11438674259589243220602838846389, 1.11539297008039572922655224829214, 1.11640010613076046119829243252752, 1.11740815156736927882263898936799, 1.11841710721134601769222172151785, 1.11942697388455614238012003625045, 1.12043775240960674643986294540809, 1.12144944360984788467305861558998, 1.12246204830937301721860421821475, 1.12347556733301989773110562964575, 1.12449000150637057338087743119104, 1.12550535165575338325538723438513, 1.12652161860824184813623105583247, 1.12753880319165711298978749255184, 1.12855690623456705878879802185111, 1.12957592856628807886920640157769, 1.13059587101688574506397344521247, 1.13161673441717436361386717180721, 1.13263851959871919561351205629762, 1.13366122739383579087757425440941, 1.13468485863559132020839115284616, 1.13570941415780546357439106941456, 1.13673489479505063215469817805570, 1.13776130138265263447294728393899, 1.13878863475669156457570352358744, 1.13981689575400291225548699003411, 1.14084608521217734100616780779092, 1.14187620396956157620138583297376, 1.14290725286525995940678512852173, 1.14393923273913422633540903916582, 1.14497214443180417298151496652281, 1.14600598878464898788820391928311, 1.14704076663980769623663036327343, 1.14807647884017893780139729642542, 1.14911312622942363148581534915138, 1.15015070965196319896506338409381, 1.15118922995298267331065744656371, 1.15222868797842958876742613938404, 1.15326908457501531302114017307758, 1.15431042059021593537693206599215, 1.15535269687227293289311091939453, 1.15639591427019339242576734250179, 1.15744007363375112085179807763780, 1.15848517581348686711351092526456, 1.15953122166071032062006906926399, 1.16057821202749877897986152675003, 1.16162614776669959049115732341306, 1.16267502973192971005289564345730, 1.16372485877757747552152522985125, 1.16477563575880216362179453426506, 1.16582736153153532221438126725843, 1.16688003695248165847431209840579, 1.16793366287911881684635773126502, 1.16898824016969915540187230362790, 1.17004376968325018992800323758274, 1.17110025227957459392769123951439, 1.17215768881925153088729985029204, 1.17321608016363732041043022036320, 1.17427542717486588230713095981628, 1.17533573071585006886152768856846, 1.17639699165028122074261318630306, 1.17745921084263094336108679272002, 1.17852238915815155095856425759848, 1.17958652746287584456297281576553, 1.18065162662361977652381028747186, 1.18171768750798089619991060317261, 1.18278471098434101449470290390309, 1.18385269792186531567779184115352, 1.18492164919050435578640190215083, 1.18599156566099384058077248482732, 1.18706244820485573576718252297724, 1.18813429769439937722097511141328, 1.18920711500272102689734765590401, 1.19028090100370587123279619845562, 1.19135565657202802114511541731190, 1.19243138258315117816721340204822, 1.19350807991332974467013627872802, 1.19458574943960948999688298499677, 1.19566439203982732841780034505064, 1.19674400859261398366584217001218, 1.19782459997739243462433478271123, 1.19890616707438057986223611806054, 1.19998871076459034945571602293057, 1.20107223192982992543420550646260, 1.20215673145270307564658196497476, 1.20324221021661093011800858221250, 1.20432866910575220309453925437992, 1.20541610900512385917693336523371, 1.20650453080052177945447056117700, 1.20759393537854231581718522647861, 1.20868432362658162482205170817906, 1.20977569643283744404982371634105, 1.21086805468630998028345402417472, 1.21196139927680124337427969294367, 1.21305573109491726668807132227812, 1.21415105103206810710503305017482, 1.21524735998046895524282717815368, 1.21634465883313991341196924622636, 1.21744294848390843810648220824078, 1.21854222982740845182547673175577, 1.21964250375908145329617582319770, 1.22074377117517784974154437804827, 1.22184603297275762301410395593848, 1.22294929004968988550672293058597, 1.22405354330465532264327066513943, 1.22515879363714552674480273708468, 1.22626504194746432929719048843253, 1.22737228913672913321875057590660, 1.22848053610687002468182527081808, 1.22958978376063199355883170937886, 1.23070003300157537751147174276412, 1.23181128473407586199073193711229, 1.23292353986332625659372297377558, 1.23403679929533605097446979925735, 1.23515106393693341324535595049383, 1.23626633469576496793251862982288, 1.23738261248029712824347825517179, 1.23849989819981654015634831011994, 1.23961819276443074855365011899266, 1.24073749708506930744533747201785, 1.24185781207348400201340155035723, 1.24297913864225018087950047629420, 1.24410147770476675610495931323385, 1.24522483017525797954760946595343, 1.24634919696877299877257883053971, 1.24747457900118785545373611967079, 1.24860097718920481923987608752213, 1.24972839245035438615616385504836, 1.25085682570299550064873983501457, 1.25198627786631622171853450709023, 1.25311674986033461109968811797444, 1.25424824260589962143797038152115, 1.25538075702469109629078047873918, 1.25651429403922176852859138307394, 1.25764885457283726033494986040751, 1.25878443954971652729568631912116, 1.25992104989487319066654436028330, 1.26105868653415620350699555274332, 1.26219735039425073885865913325688, 1.26333704240267796770069708145456, 1.26447776348779750144046829518629, 1.26561951457880628169050396536477, 1.26676229660574102275916175130988, 1.26790611049947776756141593068605, 1.26905095719173321988648694969015, 1.27019683761506541053165619814536, 1.27134375270287436343608078459511, 1.27249170338940276181460831139702, 1.27364069060973728042540642491076, 1.27479071529980836352535789046669, 1.27594177839639200122689999261638, 1.27709388083710995154262946016388, 1.27824702356043062856372216629097, 1.27940120750566932450453805358848, 1.28055643361298998605946053430671, 1.28171270282340543644750141538680, 1.28287001607877826359072059858590, 1.28402837432182104215883100550855, 1.28518777849609833197064290288836, 1.28634822954602556777103927743156, 1.28750972841687194581083986122394, 1.28867227605475975771298635663697, 1.28983587340666572274017198651563, 1.29100052142042165392865626927232, 1.29216622104471468013286994391819, 1.29333297322908946647146422037622, 1.29450077892394710410428615432465, 1.29566963908054777476763774757273, 1.29683955465100964055125132290414, 1.29801052658831128638894369942136, 1.29918255584629172005861619254574, 1.30035564337965059422685953904875, 1.30152979014395042689500314736506, 1.30270499709561593526530032249866, 1.30388126519193581209776766627328, 1.30505859539106294775479000236373, 1.30623698865201554042414500145242, 1.30741644593467731816360810626065, 1.30859696819979909321318700676784, 1.30977855640899920608433149027405, 1.31096121152476441373835314152529, 1.31214493451044988958642534271348, 1.31332972633028122189102759875823, 1.31451558794935463581055046233814, 1.31570252033363765953311030898476, 1.31689052444996979041036411217647, 1.31807960126606404926974391855765, 1.31926975175050675836985192290740, 1.32046097687275909571269494335866, 1.32165327760315753913289427146083, 1.32284665491291475447610537230503, 1.32404110977412026173283265961800, 1.32523664315974132321684919588733, 1.32643325604362383174361639248673, 1.32763094940049319880870370980119, 1.32882972420595435458778865722707, 1.33002958143649374633810111845378, 1.33123052206947933839842335146386, 1.33243254708316150036750968865817, 1.33363565745667389528250623698113, 1.33483985417003436779737057804596, 1.33604513820414583236129146825988, 1.33725151054079649526329376385547, 1.33845897216266163098907782114111, 1.33966752405330291608720472140703, 1.34087716719717131574896029633237, 1.34208790257960575154072557779728, 1.34329973118683532185002604819601, 1.34451265400597930188553164043697, 1.34572667202504847594468628813047, 1.34694178623294580354752270068275, 1.34815799761946708557047713838983, 1.34937530717530207446941403759411, 1.35059371589203447427962601068430, 1.35181322476214371697267324634595, 1.35303383477900562859019828465534, 1.35425554693689265128853094211081, 1.35547836223097517560631786182057, 1.35670228165732176250912743853405, 1.35792730621290114179089414392365, 1.35915343689558132389549882645952, 1.36038067470413204240742288675392, 1.36160902063822475405174827756127, 1.36283847569843330482797227887204, 1.36406904088623504023303212306928, 1.36530071720401191548432962008519, 1.36653350565505049551973115740111, 1.36776740724354350930980217526667, 1.36900242297459051599162194179371, 1.37023855385419857100259832805023, 1.37147580088928311425888750818558, 1.37271416508766841424460380949313, 1.37395364745808912232405418762937, 1.37519424901019071683094807667658, 1.37643597075453016920221216423670, 1.37767881370257683215641009155661, 1.37892277886671399400597692874726, 1.38016786726023799047879947465844, 1.38141407989736131334268520731712, 1.38266141779321105609312780870823, 1.38390988196383202257777611521306, 1.38515947342618539472880456742132, 1.38641019319815139709817231050692, 1.38766204229852907481301826919662, 1.38891502174703740379868577292655, 1.39016913256431595691253733093617, 1.39142437577192623621158418245614, 1.39268075239235167295248629670823, 1.39393826344899940394839177315589, 1.39519690996620027156893684150418, 1.39645669296921015600787541188765, 1.39771761348421108550610370002687, 1.39897967253831123635166022722842, 1.40024287115954582105814552051015, 1.40150721037687953085537628794555, 1.40277269122020475933254601841327, 1.40403931472034471106269393203547, 1.40530708190905317955810005514650, 1.40657599381901543544870492041809, 1.40784605148384933670513419201598, 1.40911725593810599477251344069373, 1.41038960821727066274888784391806, 1.41166310935776362356364188599400, 1.41293776039694085611131413315888, 1.41421356237309514547462185873883, 1.41549051632545652701367089321138, 1.41676862329419406272279502445599, 1.41804788432041517509674122266006, 1.41932830044616808962132381566335, 1.42060987271444116863960971386405, 1.42189260216916557588717751059448, 1.42317648985521394422448793193325, 1.42446153681840326221674786211224, 1.42574774410549420800009556842269, 1.42703511276419314768304502649698, 1.42832364384315213534648592030862, 1.42961333839197002326670826732880, 1.43090419746119379418303196871420, 1.43219622210231833925320188427577, 1.43348941336778890054404200782301, 1.43478377231100018285303576703882, 1.43607929998629857415437527379254, 1.43737599744898236764356624917127, 1.43867386575530242787124279857380, 1.43997290596246374505540188692976, 1.44127311912862565712600826373091, 1.44257450631290318199262401321903, 1.44387706857536723958901347941719, 1.44518080697704665027458759141155, 1.44648572257992746870058908825740, 1.44779181644695520425614176929230, 1.44909908964203504311285541916732, 1.45040754323003251435864058294101, 1.45171717827677504430994304129854, 1.45302799584905262264555858564563, 1.45433999701461758036202809307724, 1.45565318284218725430889662675327, 1.45696755440144376514410851086723, 1.45828311276303490551242703077151, 1.45959985899857525026845905813389, 1.46091779418064704465507475106278, 1.46223691938280087043722232920118, 1.46355723567955697816955762391444, 1.46487874414640573128565392835299, 1.46620144585980849427642169757746, 1.46752534189719829882392332365271, 1.46885043333698184220281746092951, 1.47017672125853904319114917598199, 1.47150420674222415229337457276415, 1.47283289086936752809720019286033, 1.47416277472227585931818794051651, 1.47549385938423238684436000767164, 1.47682614593949934622685304930201, 1.47815963547331752359070833335863, 1.47949432907190780994710621598642, 1.48083022782247186732718091661809, 1.48216733281319279491583529306808, 1.48350564513323646131937039172044, 1.48484516587275239274390514765400, 1.48618589612287443912919115973637, 1.48752783697572077414861269062385, 1.48887098952439700383365561719984, 1.49021535486299505635088280541822, 1.49156093408659473631416858552257, 1.49290772829126483500772337720264, 1.49425573857406379651990846468834, 1.49560496603304038387705077184364, 1.49695541176723545540028226241702, 1.49830707687668152061633008997887, 1.49965996246240473865896092320327, 1.50101406962642558440279572096188, 1.50236939947175907050791465735529, 1.50372595310241674582130144699477, 1.50508373162340647333223841997096, 1.50644273614073465061835577216698, 1.50780296776140509962260694010183, 1.50916442759342284141155232646270, 1.51052711674579165368470512476051, 1.51189103632851784553281504486222, 1.51325618745260981334865846292814, 1.51462257123007892900545812153723, 1.51599018877394020599069790478097, 1.51735904119821474189677701360779, 1.51872912961792860819798534066649, 1.52010045514911484865194779558806, 1.52147301890881458952264893014217, 1.52284682201507726162503786326852, 1.52422186558696193259265783126466, 1.52559815074453841710067081294255, 1.52697567860888705482125260459725, 1.52835445030210093086964207031997, 1.52973446694728698602716576715466, 1.53111572966856535060742317000404, 1.53249823959107112081312607188011, 1.53388199784095591304833305912325, 1.53526700554538830800765936146490, 1.53665326383255362863167192699621, 1.53804077383165682668675344757503, 1.53942953667292248276510235882597, 1.54081955348759502832933776517166, 1.54221082540794074411394376511453, 1.54360335356724864830368915136205, 1.54499713909983005244441756076412, 1.54639218314102144802291149972007, 1.54778848682718428442228741914732, 1.54918605129570563505581048957538, 1.55058487768499997372373400139622, 1.55198496713450961870250921492698, 1.55338632078470539887860013550380, 1.55478893977708865214992783876369, 1.55619282525419055929205569555052, 1.55759797835957480849344847229077, 1.55900440023783692922165755589958, 1.56041209203460651266937020409387, 1.56182105489654698970980462036096, 1.56323128997135762929815427924041, 1.56464279840777420460540270141792, 1.56605558135556877097371852869401, 1.56746963996555299658552939945366, 1.56888497538957616406207762338454, 1.57030158878052850113249405694660, 1.57171948129234140267840302840341, 1.57313865407998743073392233782215, 1.57455910829948253493171250738669, 1.57598084510788649659218663146021, 1.57740386566330359485732515167911, 1.57882817112488393895830540714087, 1.58025376265282457843852625956060, 1.58168064140836950315360809327103, 1.58310880855381164167283714050427, 1.58453826525249374945758518151706, 1.58596901266880818681670461955946, 1.58740105196819936139718265621923, 1.58883438431716395022874621645315, 1.59026901088325156585767672368092, 1.59170493283506608861443964997306, 1.59314215134226699888131406623870, 1.59458066757556937709239264222560, 1.59602048270674590213502597180195, 1.59746159790862707339442749798764, 1.59890401435510232097669813811081, 1.60034773322112089388724598393310, 1.60179275568269341434302077686880, 1.60323908291689187777251390798483, 1.60468671610185142917259781825123, 1.60613565641677102924234077363508, 1.60758590504191389847221671516309, 1.60903746315860973759015450923471, 1.61049033194925428347232809755951, 1.61194451259731130754460082243895, 1.61340000628731283782713035179768, 1.61485681420486071324660315440269, 1.61631493753662724977004927495727, 1.61777437747035612858326203422621, 1.61923513519486372835842757922364, 1.62069721190003979138793965830700, 1.62216060877684831176281932130223, 1.62362532701732886764034446969163, 1.62509136781459706533325970667647, 1.62655873236284631566661573742749, 1.62802742185734783397776936908485, 1.62949743749445219442861798597733, 1.63096878047159066227322909981012, 1.63244145198727497181323542463360, 1.63391545324109999093309397721896, 1.63539078543374238883245652687037, 1.63686744976696441078445332095725, 1.63834544744361276791266845975770, 1.63982477966761996945876944664633, 1.64130544764400632118395151337609, 1.64278745257887948127972777001560, 1.64427079567943645876937353023095, 1.64575547815396494577555586147355, 1.64724150121184220729730895982357, 1.64872886606353885596831787552219, 1.65021757392061774183389388781507, 1.65170762599573595075241883023409, 1.65319902350264547052915986569133, 1.65469176765619430113929411163554, 1.65618585967232734290632834017742, 1.65768130076808728468051867821487, 1.65917809216161615815110508265207, 1.66067623507215511580170641536824, 1.66217573072004709544557954359334, 1.66367658032673637613640948984539, 1.66517878511477057656975375721231, 1.66668234630780043303843740432058, 1.66818726513058246396781214571092, 1.66969354280897874787115142680705, 1.67120118056995758948346519900952, 1.67271017964159662838596887013409, 1.67422054125308084060463897912996, 1.67573226663470586927928707154933, 1.67724535701787846875276954961009, 1.67875981363511672661559259722708, 1.68027563772005184006275158026256, 1.68179283050742900407215074665146, 1.68331139323310829958302292652661, 1.68483132713406535962974430731265, 1.68635263344839336774327875900781, 1.68787531341530283590657290915260, 1.68939936827512338091139554308029, 1.69092479926930527867057207913604, 1.69245160764041835399495994352037, 1.69397979463215575535173229582142, 1.69550936148933262259674847882707, 1.69704030945788897355441804393195, 1.69857263978488903788388597604353, 1.70010635371852347752508194389520, 1.70164145250811005283253507514019, 1.70317793740409428870918873144547, 1.70471580965805125096323990874225, 1.70625507052268554630813923722599, 1.70779572125183332076403530663811, 1.70933776310046292579158944135997, 1.71088119732467536238118555047549, 1.71242602518170605740976952802157, 1.71397224792992597386387387814466, 1.71551986682884227697343249019468, 1.71706888313909855625638556375634, 1.71861929812247793414314855908742, 1.72017111304190195575358757196227, 1.72172432916143258729846365895355, 1.72327894774627399243627223768272, 1.72483497006277142205021846166346, 1.72639239737841476696189602080267, 1.72795123096183766975286744127516, 1.72951147208281952316610841080546, 1.73107312201228591419521762873046, 1.73263618202231106657507098134374, 1.73420065338611650851419199170778, 1.73576653737807395927461584506091, 1.73733383527370621735030908894259, 1.73890254834968716046716963319341, 1.74047267788384352193986615020549, 1.74204422515515644498407255014172, 1.74361719144376126067186305590440, 1.74519157803094904224394667835440, 1.74676738619916904760032139165560, 1.74834461723202672089882980799302, 1.74992327241428791140265275316779, 1.75150335303187820734649449150311, 1.75308486037188382411500242596958, 1.75466779572255360264421142346691, 1.75625216037329945351075366488658, 1.75783795561469791124409312033094, 1.75942518273848991228192062408198, 1.76101384303758390359462282503955, 1.76260393780605495450686248659622, 1.76419546833914675509902281191899, 1.76578843593327272643023206910584, 1.76738284188601713076138821634231, 1.76897868749613484951055397687014, 1.77057597406355471392203071445692, 1.77217470288937861688793873327086, 1.77377487527588306726045175309991, 1.77537649252652118825324123463361, 1.77697955594592249539687145443168, 1.77858406683989467289563890517456, 1.78019002651542446180599199578864, 1.78179743628067854821495075157145, 1.78340629744500533959694621444214, 1.78501661131893496481382044294151, 1.78662837921418127251627083751373, 1.78824160244364205318845506553771, 1.78985628232140103754943538660882, 1.79147242016272834064238850260153, 1.79309001728408157205763018282596, 1.79470907500310716820024481421569, 1.79632959463864150251311002648436, 1.79795157751071088547689669212559, 1.79957502494053511732374772691401, 1.80119993825052548963583376462338, 1.80282631876428789396982210746501, 1.80445416780662393207990135124419, 1.80608348670353047182857153529767, 1.80771427678220186763269339280669, 1.80934653937103195886493267607875, 1.81098027579961229349692075629719, 1.81261548739873634694674819911597, 1.81425217550039885594514998956583, 1.81589034143779670671392523217946, 1.81752998654533115541198640130460, 1.81917111215860849426917411619797, 1.82081371961444071772007191611920, 1.82245781025084641058242596045602, 1.82410338540705341259240412910003, 1.82575044642349770818157139729010, 1.82739899464182609101214893598808, 1.82904903140489727420003873703536, 1.83070055805678166827021868812153, 1.83235357594276360160279182309750, 1.83400808640934243065601094713202, 1.83566409080423298405548848677427, 1.83732159047636667281722111511044, 1.83898058677589371079363900207682, 1.84064108105418311467360581445973, 1.84230307466382359216083841602085, 1.84396656895862598446456104284152, 1.84563156529362304425490037829150, 1.84729806502507076793051510321675, 1.84896606951045083810925007128390, 1.85063558010846973544971660885494, 1.85230659817906073705273684026906, 1.85397912508338547077357816306176, 1.85565316218383480340037294809008, 1.85732871084402906269872346456395, 1.85900577242882047990235605539056, 1.86068434830429318971312113717431, 1.86236443983776522870243752549868, 1.86404604839778897940050228498876, 1.86572917535415294665313012956176, 1.86741382207788153557714849739568, 1.86909998994123860427407635143027, 1.87078768031772546542867985408520, 1.87247689458208466106725609279238, 1.87416763411029996255763307999587, 1.87585990027959703674298452824587, 1.87755369446844566638787910051178, 1.87924901805656019426749026024481, 1.88094587242490041134601597150322, 1.88264425895567355517812302423408, 1.88434417903233453195355195930460, 1.88604563403958747080935154372128, 1.88774862536338683405290339578642, 1.88945315439093919351876138534863, 1.89115922251070234239023193367757, 1.89286683111238862586844788893359, 1.89457598158696560730618330126163, 1.89628667532665584616324849775992, 1.89799891372493956254174918285571, 1.89971269817655530331990121339913, 1.90142803007750060828584537375718, 1.90314491082503334240527692600153, 1.90486334181767413831209978525294, 1.90658332445520528608540189452469, 1.90830486013867317574010940006701, 1.91002795027038985153922112658620, 1.91175259625393278994920365221333, 1.91347879949414734213064548384864, 1.91520656139714740007207183225546, 1.91693588337031584067915446212282, 1.91866676682230719030997079244116, 1.92039921316304740273039897147100, 1.92213322380373563547095727699343, 1.92386880015684513800522381643532, 1.92560594363612502810667592711980, 1.92734465565660006980408525123494, 1.92908493763457333791677683620946, 1.93082679098762710623304883483797, 1.93257021713462284751017250528093, 1.93431521749570345392044146137778, 1.93606179349229434727419629780343, 1.93780994654710436719824429019354, 1.93955967808412665931427909526974, 1.94131098952864045159572015109006, 1.94306388230721172050152745214291, 1.94481835784769474528843602456618, 1.94657441757923321823398055130383, 1.94833206293226091077031014719978, 1.95009129533850300575181790918577, 1.95185211623097831790119016659446, 1.95361452704399862767559170606546, 1.95537852921317134580192487192107, 1.95714412417540017941064434126019, 1.95891131336888624225878174911486, 1.96068009823312872086376046354417, 1.96245048020892731699404976097867, 1.96422246073838269175837467628298, 1.96599604126489668765032092778711, 1.96777122323317588126201371778734, 1.96954800808923002897188325732714, 1.97132639728037517556913371663541, 1.97310639225523432038755800022045, 1.97488799446373830548395744699519, 1.97667120535712692586116645543370, 1.97845602638795092786949680885300, 1.98024245901007223125134260044433, 1.98203050467866548345341470849235, 1.98382016485021939189437034656294, 1.98561144098253783418783768865978, 1.98740433453474096836544049438089, 1.98919884696726634309982273407513, 1.99099497974187045201688306406140, 1.99279273432162917778498467669124, 1.99459211217094023460560947569320, 1.99639311475552294616875315114157, 1.99819574354242024405436950473813, 2.00000000000000000000000000000000, 2.00180588559795546998998361232225, 2.00361340180730795879071592935361, 2.00542255010040504359380975074600, 2.00723333195092568104200836387463, 2.00904574883387931905076584371272, 2.01085980222560545271903720276896, 2.01267549360377895339979659183882, 2.01449282444740784825398804969154, 2.01631179623683509660736490332056, 2.01813241045374081039653901825659, 2.01995466858114403052582019881811, 2.02177857210340095051037678786088, 2.02360412250620935736833416740410, 2.02543132127660818753156490856782, 2.02726016990297885911331832176074, 2.02909066987504704826505985693075, 2.03092282268388402144410065375268, 2.03275662982190619132438769156579, 2.03459209278287822542097273981199, 2.03642921306191393426843205816112, 2.03826799215547582733165654644836, 2.04010843156137955389795024530031, 2.04195053277879212672019093588460, 2.04379429730823325428445969009772, 2.04563972665157978170213937119115, 2.04748682231206258208544568333309, 2.04933558579427144152873552229721, 2.05118601860415328275166757521220, 2.05303812224901571781288112106267, 2.05489189823752749219920588075183, 2.05674734807971848482566201710142, 2.05860447328698414892755863547791, 2.06046327537208195934681498329155, 2.06232375584913718569168850081041, 2.06418591623364244824756497109775, 2.06604975804245682979853881988674, 2.06791528279381120469793131633196, 2.06978249200730601842224132269621, 2.07165138720391439619561424478889, 2.07352196990598214298984203196596, 2.07539424163723129623804197763093, 2.07726820392275746129939761885908, 2.07914385828903514052967693714891, 2.08102120626391640101360280823428, 2.08290024937663220683248255227227, 2.08478098915779597177788673434407, 2.08666342713940178299480976420455, 2.08854756485482750960613884672057, 2.09043340383883569089107368199620, 2.09232094562757486855275601556059, 2.09421019175857958671826963836793, 2.09610114377077394465231918729842, 2.09799380320447115266802029509563, 2.09988817160137442030531929049175, 2.10178425050458050904467199870851, 2.10368204145857884412862404133193, 2.10558154600925284682944038650021, 2.10748276570388215489515459921677, 2.10938570209114439890640824160073, 2.11129035672111431409803117276169, 2.11319673114526684898351049923804, 2.11510482691647805353341027512215, 2.11701464558902552326458135212306, 2.11892618871859061968621062987950, 2.12083945786225935847824075608514, 2.12275445457852418584820952673908, 2.12467118042728397853124988614582, 2.12658963696984626423613917722832, 2.12850982576892899800213854177855, 2.13043174838866056219899292045739, 2.13235540639458198697298030310776, 2.13428080135364739433612157881726, 2.13620793483422577452301993616857, 2.13813680840610409461532981367782, 2.14006742364048374582807809929363, 2.14199978210998676075860203127377, 2.14393388538865492520812949805986, 2.14586973505195111044940858846530, 2.14780733267676060549433714186307, 2.14974667984139289345080214843620, 2.15168777812558209561188959924038, 2.15363062911048919190193373651709, 2.15557523437870246496572690375615, 2.15752159551423972061456879600883, 2.15946971410254828782626645988785, 2.16141959173050812736960324400570, 2.16337122998643049953670924878679, 2.16532463046006240503515982709359, 2.16727979474258569680955588410143, 2.16923672442661841230915342748631, 2.17119542110621743802312266780064, 2.17315588637687939765896771859843, 2.17511812183553931987489704624750, 2.17708212908057685552876137080602, 2.17904790971181361314279456564691, 2.18101546533051537934966290777083, 2.18298479753939478342772417818196, 2.18495590794261085321181781182531, 2.18692879814577167962852399796247, 2.18890346975593441669616368017159, 2.19087992438160839014926750678569, 2.19285816363275376517094628070481, 2.19483818912078554319577960995957, 2.19682000245857356190981590771116, 2.19880360526044382751820194243919, 2.20078899914218029110202223819215, 2.20277618572102529270750892465003, 2.20476516661568178179209098743740, 2.20675594344631464949202381831128, 2.20874851783455117271159906522371, 2.21074289140348234639077418250963, 2.21273906577766643621885123138782, 2.21473704258312764636684732977301, 2.21673682344735745175512420246378, 2.21873840999931770667785713158082, 2.22074180386944242115987435681745, 2.22274700668963509642139797506388, 2.22475402009327494212698184128385, 2.22676284571521510002867216826417, 2.22877348519178486441205677692778, 2.23078594016079145845310449658427, 2.23280021226152092239658486505505, 2.23481630313473855764527797873598, 2.23683421442269203538444344303571, 2.23885394776911228476024007250089, 2.24087550481921349287972589081619, 2.24289888721969532525690738111734, 2.24492409661874603443720843642950, 2.24695113466603979546221125929151, 2.24898000301274114676175486238208, 2.25101070331150676651077446877025, 2.25304323721648369627246211166494, 2.25507760638331378189036513504107, 2.25711381246913411757759604370221, 2.25915185713257615773841280315537, 2.26119174203377149012794689042494, 2.26323346883434917131694419367705, 2.26527703919743839122702411259525, 2.26732245478767158175514850881882, 2.26936971727118264041678230569232, 2.27141882831561092714878213882912, 2.27346978959010126430939635611139, 2.27552260276530526894589456787799, 2.27757726951338312915140704717487, 2.27963379150800582451097398006823, 2.28169217042435468201233561558183, 2.28375240793912315240277166594751, 2.28581450573051991881357025704347, 2.28787846547826845267081807833165, 2.28994428886360834596302993304562, 2.29201197756929797577640783856623, 2.29408153327961539247326072654687, 2.29615295768035787560279459285084, 2.29822625245884681888242084824014, 2.30030141930392684201933661825024, 2.30237845990596534662131489312742, 2.30445737595685917753485227876808, 2.30653816915003062604228034615517, 2.30862084118043187075386413198430, 2.31070539374454586578622183878906, 2.31279182854038678485153468500357, 2.31488014726750224170359615527559, 2.31697035162697373422702185052913, 2.31906244332142064124013813852798, 2.32115642405499755795972305350006, 2.32325229553339873689310479676351, 2.32535005946385986419500113697723, 2.32744971755515495104305045970250, 2.32955127151760432724358906853013, 2.33165472306307108851797238457948, 2.33376007390496331694862419681158, 2.33586732575823718960350561246742, 2.33797648033939875489295445731841, 2.34008753936650037985600647516549, 2.34220050455914874376617262896616, 2.34431537763850306177459970058408, 2.34643216032727464082086044072639, 2.34855085434973176461426191963255, 2.35067146143170013772305537713692, 2.35279398330056244148522637260612, 2.35491842168526188672217358544003, 2.35704477831630310191712851519696, 2.35917305492575168912594563153107, 2.36130325324723955304762057494372, 2.36343537501596223648903105640784, 2.36556942196868202898940580780618, 2.36770539584373063135558368230704, 2.36984329838100871157280380430166, 2.37198313132198768116154496965464, 2.37412489640971147153436504595447, 2.37626859538879875444195022282656, 2.37841423000544205379469531180803, 2.38056180200741174246559239691123, 2.38271131314405604229023083462380, 2.38486276516630235633442680409644, 2.38701615982665948934027255745605, 2.38917149887921897999376596999355, 2.39132878407965465683560069010127, 2.39348801718522752324247448996175, 2.39564919995478486924866956542246, 2.39781233414876115972447223612107, 2.39997742152918069891143204586115, 2.40214446385965985086841101292521, 2.40431346290540615129316392994951, 2.40648442043322186023601716442499, 2.40865733821150485027828835882246, 2.41083221801024771835386673046742, 2.41300906160104355890894112235401, 2.41518787075708463163437045295723, 2.41736864725316324964410341635812, 2.41955139286567488809964743268210, 2.42173610937261996056690804834943, 2.42392279855360248674855938588735, 2.42611146218983453337614264455624, 2.42830210206413621421006610034965, 2.43049471996093791048565435630735, 2.43268931766627982682393849245273, 2.43488589696781732030217426654417, 2.43708445965481690365095346351154, 2.43928500751816246250314179633278, 2.44148754235035569948308875609655, 2.44369206594551524602820791187696, 2.44589858009937977101344586117193, 2.44810708660931064528654133027885, 2.45031758727429105348960547416937, 2.45253008389492865859438097686507, 2.45474457827345826643750115181319, 2.45696107221374004936365054163616, 2.45917956752126398711766341875773, 2.46140006600315075502294348552823, 2.46362256946815172398146387422457, 2.46584707972665206909823609748855, 2.46807359859067210194893959851470, 2.47030212787386682649071190098766, 2.47253266939152993586503725964576, 2.47476522496059425648695651034359, 2.47699979639963308031269662023988, 2.47923638552886149710730023798533, 2.48147499417013861489067494403571, 2.48371562414696800402680310071446, 2.48595827728449991766979110252578, 2.48820295540953351220991862646770, 2.49044966035051595909521893190686, 2.49269839393754599754515766107943, 2.49494915800237571090747223934159, 2.49720195437840963847975217504427, 2.49945678490070877231232771009672, 2.50171365140599100129747967002913, 2.50397255573263244343706901418045, 2.50623349972066922219937623594888, 2.50849648521179924287594076304231, 2.51076151404938219258156095747836, 2.51302858807844353705718276614789, 2.51529770914567452066989972081501, 2.51756887909943305459137263824232, 2.51984209978974638133308872056659, 2.52211737306831285110320095554926, 2.52439470078850147771731826651376, 2.52667408480535593540139416290913, 2.52895552697559500288093659037258, 2.53123902915761256338100793072954, 2.53352459321148204551832350261975, 2.53581222099895553512283186137211, 2.53810191438346643977297389938030, 2.54039367523013082106331239629071, 2.54268750540574872687216156919021, 2.54498340677880552362921662279405, 2.54728138121947411676160299975891, 2.54958143059961672705071578093339, 2.55188355679278400245379998523276, 2.55418776167421990308525892032776, 2.55649404712086125712744433258194, 2.55880241501133864900907610717695, 2.56111286722597997211892106861342, 2.56342540564681131698421268083621, 2.56574003215755652718144119717181, 2.56805674864364208431766201101709, 2.57037555699219666394128580577672, 2.57269645909205113554207855486311, 2.57501945683374389162167972244788, 2.57734455210951995951518256333657, 2.57967174681333144548034397303127, 2.58200104284084286376810268848203, 2.58433244208942980435494973789901, 2.58666594645817893294292844075244, 2.58900155784789420820857230864931, 2.59133927816109554953527549514547, 2.59367910930201928110250264580827, 2.59602105317662257277788739884272, 2.59836511169258344011723238509148, 2.60071128675930118845371907809749, 2.60305958028790085379000629473012, 2.60540999419123231461981049505994, 2.60776253038387162419553533254657, 2.61011719078212589550958000472747, 2.61247397730403108084829000290483, 2.61483289186935463632721621252131, 2.61719393639959818642637401353568, 2.61955711281799885625787283061072, 2.62192242304952882747670628305059, 2.62428986902089933508364083536435, 2.62665945266056244378205519751646, 2.62903117589870927162110092467628, 2.63140504066727487497701076790690, 2.63378104889993958082072822435293, 2.63615920253212809853948783711530, 2.63853950350101351673970384581480, 2.64092195374551819142538988671731, 2.64330655520631507826578854292165, 2.64569330982582906486300089454744, 2.64808221954824052346566531923600, 2.65047328631948264643369839177467, 2.65286651208724766348723278497346, 2.65526189880098639761740741960239, 2.65765944841190870917557731445413, 2.66005916287298749267620223690756, 2.66246104413895867679684670292772, 2.66486509416632300073501937731635, 2.66727131491334734647580262389965, 2.66967970834006873559474115609191, 2.67209027640829166472258293651976, 2.67450302108159299052658752771094, 2.67691794432532326197815564228222, 2.67933504810660583217440944281407, 2.68175433439434263149792059266474, 2.68417580515921150308145115559455, 2.68659946237367064370005209639203, 2.68902530801195815968185343081132, 2.69145334405009695188937257626094, 2.69388357246589160709504540136550, 2.69631599523893417114095427677967, 2.69875061435060414893882807518821, 2.70118743178406894855925202136859, 2.70362644952428743394534649269190, 2.70606766955801170126960641937330, 2.70851109387378530257706188422162, 2.71095672446195035121263572364114, 2.71340456331464396910746472713072, 2.71585461242580228358178828784730, 2.71830687379116264779099765291903, 2.72076134940826452890405562357046, 2.72321804127644950810349655512255, 2.72567695139686616556673470768146, 2.72813808177247008046606424613856, 2.73060143440802383096865924017038, 2.73306701131010054695025246473961, 2.73553481448708701861960435053334, 2.73800484594918103198324388358742, 2.74047710770839714200519665610045, 2.74295160177856622851777501637116, 2.74542833017533682848920761898626, 2.74790729491617824464810837525874, 2.75038849802038143366189615335315, 2.75287194150906033840442432847340, 2.75535762740515366431282018311322, 2.75784555773342798801195385749452, 2.76033573452047598095759894931689, 2.76282815979472262668537041463424, 2.76532283558642255627546546747908, 2.76781976392766404515555223042611, 2.77031894685237078945760913484264, 2.77282038639630323828555447107647, 2.77532408459705814962603653839324, 2.77783004349407480759737154585309, 2.78033826512863235791428451193497, 2.78284875154385247242316836491227, 2.78536150478470290181576274335384, 2.78787652689799880789678354631178, 2.79039381993240054313787368300837, 2.79291338593842031201575082377531, 2.79543522696842261510141725011636, 2.79795934507662247270332045445684, 2.80048574231909164211629104102030, 2.80301442075375906171075257589109, 2.80554538244040951866509203682654, 2.80807862944068942212538786407094, 2.81061416381810635911620011029299, 2.81315198763803087089740984083619, 2.81569210296769867341026838403195, 2.81823451187621243363423673145007, 2.82077921643454132549777568783611, 2.82332621871552724712728377198800, 2.82587552079388171222262826631777, 2.82842712474619029094924371747766, 2.83098103265091305402734178642277, 2.83353724658838812544559004891198, 2.83609576864083035019348244532011, 2.83865660089233573515343778126407, 2.84121974542888278136842927779071, 2.84378520433833115177435502118897, 2.84635297971042788844897586386651, 2.84892307363680652443349572422449, 2.85149548821098841600019113684539, 2.85407022552838629536609005299397, 2.85664728768630427069297184061725, 2.85922667678394004653341653465759, 2.86180839492238714427685408736579, 2.86439244420463667850640376855154, 2.86697882673557780108808401564602, 2.86956754462200036570607153407764, 2.87215859997259759239796039764769, 2.87475199489796473528713249834254, 2.87734773151060485574248559714761, 2.87994581192492749011080377385952, 2.88254623825725131425201652746182, 2.88514901262580591989603817637544, 2.88775413715073492326723680889700, 2.89036161395409330054917518282309, 2.89297144515985493740117817651480, 2.89558363289391040851228353858460, 2.89819817928407008622571083833463, 2.90081508646006502871728116588201, 2.90343435655355053270909593265969, 2.90605599169810524529111717129126, 2.90867999402923516072405618615448, 2.91130636568437495270700310356915, 2.91393510880288753028821702173445, 2.91656622552606981102485406154301, 2.91919971799715050053691811626777, 2.92183558836129408931014950212557, 2.92447383876560174087444465840235, 2.92711447135911440042832509789150, 2.92975748829281146257130785670597, 2.93240289171961698855284339515492, 2.93505068379439704173705649736803, 2.93770086667396368440563492185902, 2.94035344251707764229308850190137, 2.94300841348444830458674914552830, 2.94566578173873505619440038572066, 2.94832554944455127454716603097040, 2.95098771876846477368872001534328, 2.95365229187899869245370609860402, 2.95631927094663504718141666671727, 2.95898865814381561989421243197285, 2.96166045564494373465436183323618, 2.96433466562638514574246073607355, 2.96701129026647336672795063350350, 2.96969033174550478548781029530801, 2.97237179224574843416917246941011, 2.97505567395144199238643523131032, 2.97774197904879400766731123439968, 2.98043070972599011270176561083645, 2.98312186817318947262833717104513, 2.98581545658252967001544675440527, 2.98851147714812714895060707931407, 2.99120993206608121184331139374990, 2.99391082353447091080056452483404, 2.99661415375336304123266017995775, 2.99931992492480992140713169646915, 3.00202813925285116880559144192375, 3.00473879894351814101582931471057, 3.00745190620483349164260289398953, 3.01016746324681294666447683994193, 3.01288547228146885714750169427134, 3.01560593552281064333442373026628, 3.01832885518684568282310465292539, 3.02105423349158330736941024952102, 3.02378207265703613515483993978705, 3.02651237490521962669731692585628, 3.02924514246015741392170639301185, 3.03198037754788085607060565962456, 3.03471808239642948379355402721558, 3.03745825923585677230676083127037, 3.04020091029822969730389559117611, 3.04294603781762917904529786028434, 3.04569364403015452325007572653703, 3.04844373117392430927452551259194, 3.05119630148907683420134162588511, 3.05395135721777366555329535913188, 3.05670890060420230582849399070255, 3.05946893389457397205433153430931, 3.06223145933713025712563648994546, 3.06499647918214224162625214376021, 3.06776399568191182609666611824650, 3.07053401109077617192610887286719, 3.07330652766510725726334385399241, 3.07608154766331365337350689515006, 3.07885907334584496553020471765194, 3.08163910697519005665867553034332, 3.08442165081588148822788753022905, 3.08720670713449685251816845266148, 3.08999427819966010488883512152825, 3.09278436628204289604582299944013, 3.09557697365436856884457483829465, 3.09837210259141127011162097915076, 3.10116975536999994744746800279245, 3.10396993426901879331580857979134, 3.10677264156941079775720027100760, 3.10957787955417730429985567752738, 3.11238565050838111858411139110103, 3.11519595671914961698689694458153, 3.11800880047567385844331511179917, 3.12082418406921258124953055812512, 3.12364210979309397941960924072191, 3.12646257994271525859630855848081, 3.12928559681554796512159555277321, 3.13211116271113798603664690745063, 3.13493927993110599317105879890732, 3.13776995077915188403494539670646, 3.14060317756105744635419796395581, 3.14343896258468280535680605680682, 3.14627730815997486146784467564430, 3.14911821659896506986342501477338, 3.15196169021577299318437326292042, 3.15480773132660718971465030335821, 3.15765634224976832200582066434436, 3.16050752530564915687705251912121, 3.16336128281673856221800633647945, 3.16621761710762372743488413107116, 3.16907653050498749891517036303412, 3.17193802533761637363340923911892, 3.17480210393639916688357516250107, 3.17766876863432790045749243290629, 3.18053802176650268762614359729923, 3.18340986567013217722887929994613, 3.18628430268453399776262813247740, 3.18916133515113875418478528445121, 3.19204096541349224835926179366652, 3.19492319581725414678885499597527, 3.19780802871020419786418642615899, 3.20069546644224178777449196786620, 3.20358551136538682868604155373760, 3.20647816583378331145581796590704, 3.20937343220370285834519563650247, 3.21227131283354205848468154727016, 3.21517181008382779694443343032617, 3.21807492631721947518030901846942, 3.22098066389850856694465619511902, 3.22388902519462217099999179481529, 3.22680001257462567565426070359536, 3.22971362840972142649320630880538, 3.23262987507325405545088869985193, 3.23554875494071225716652406845242, 3.23847027038972745671685515844729, 3.24139442380007958277587931661401, 3.24432121755369662352563864260446, 3.24725065403465773528068893938325, 3.25018273562919413066651941335294, 3.25311746472569263133323147485498, 3.25605484371469566795553873816971, 3.25899487498890438885723597195465, 3.26193756094318132454645819962025, 3.26488290397454994362647084926721, 3.26783090648219953777697810437530, 3.27078157086748522175412290380336, 3.27373489953392882156890664191451, 3.27669089488722509173612706945278, 3.27964955933523993891753889329266, 3.28261089528801264236790302675217, 3.28557490515775851847024568996858, 3.28854159135887336162795691052452, 3.29151095630792989155111172294710, 3.29448300242368441459461791964713, 3.29745773212707771193663575104438, 3.30043514784123548366778777563013, 3.30341525199147190150483766046818, 3.30639804700529138514752958144527, 3.30938353531238860227858822327107, 3.31237171934465468581265668035485, 3.31536260153617501345024720649235, 3.31835618432323231630221016530413, 3.32135247014431023160341283073649, 3.32435146144009419089115908718668, 3.32735316065347275227281897969078, 3.33035757022954070905029766436201, 3.33336469261560086607687480864115, 3.33637453026116492793562429142185, 3.33938708561795705165309300355148, 3.34240236113991562305614024808165, 3.34542035928319325677193774026819, 3.34844108250616123712006810819730, 3.35146453326941218264778399316128, 3.35449071403575693750553909922019, 3.35751962727023345323118519445416, 3.36055127544010412421471301058773, 3.36358566101485800814430149330292, 3.36662278646621615507683600299060, 3.36966265426813071925948861462530, 3.37270526689678673548655751801562, 3.37575062683060522772393596824259, 3.37879873655024720591200093622319, 3.38184959853861055734114415827207, 3.38490321528083670798991988704074, 3.38795958926431151070346459164284, 3.39101872297866524519349695765413, 3.39408061891577750301962623780128, 3.39714527956977807576777195208706, 3.40021270743704695505016388779040, 3.40328290501621966157586030021776, 3.40635587480818902150758731295355, 3.40943161931610250192647981748451, 3.41251014104537109261627847445197, 3.41559144250366708561728046333883, 3.41867552620092585158317888271995, 3.42176239464935028067316125088837, 3.42485205036341211481953905604314, 3.42794449585985194772774775628932, 3.43103973365768410985765513032675, 3.43413776627819755660198097757529, 3.43723859624495586828629711817484, 3.44034222608380346741796529386193, 3.44344865832286561868613716796972, 3.44655789549254798487254447536543, 3.44966994012554284410043692332692, 3.45278479475682953392379204160534, 3.45590246192367533950573488255031, 3.45902294416563860224300697154831, 3.46214624402457227247964510752354, 3.46527236404462213315014196268748, 3.46840130677223301702838398341555, 3.47153307475614836263844154018443, 3.47466767054741243470061817788519, 3.47780509669937387684512941632420, 3.48094535576768748796894215047359, 3.48408845031031288996814510028344, 3.48723438288752207725451626174618, 3.49038315606189852857710320677143, 3.49353477239833809520064278331120, 3.49668923446405344179765961598605, 3.49984654482857626689451535639819, 3.50300670606375641469298898300622, 3.50616972074376720414079500187654, 3.50933559144510720528842284693383, 3.51250432074659890702150732977316, 3.51567591122939537839897639059927, 3.51885036547697982456384124816395, 3.52202768607516780718924565007910, 3.52520787561210946492451512312982, 3.52839093667829351019804562383797, 3.53157687186654545286046413821168, 3.53476568377203381743356658262201, 3.53795737499227014311031780380290, 3.54115194812710942784406142891385, 3.54434940577875678968666761647910, 3.54754975055176657861011335626245, 3.55075298505304237650648246926721, 3.55395911189184499079374290886335, 3.55716813367978934579127781034913, 3.56038005303084892361198399157729, 3.56359487256135709642990150314290, 3.56681259489001067919389242888428, 3.57003322263786992962764088588301, 3.57325675842836210094333182496484, 3.57648320488728410637691013107542, 3.57971256464280207509887077321764, 3.58294484032545623719556715514045, 3.58618003456816314411526036565192, 3.58941815000621433640048962843139, 3.59265918927728256093701020290609, 3.59590315502142221504300323431380, 3.59915004988107023464749545382801, 3.60239987650105053518245767918415, 3.60565263752857623202885406499263, 3.60890833561324786415980270248838, 3.61216697340706049956793322053272, 3.61542855356440417935459663567599, 3.61869307874206391772986535215750, 3.62196055159922458699384151259437, 3.62523097479747313798270624829456, 3.62850435100079771189029997913167, 3.63178068287559296933864061429631, 3.63505997309066275491318265267182, 3.63834222431721698853834823239595, 3.64162743922888099135093398217577, 3.64491562050169326525406177097466, 3.64820677081410682518480825820006, 3.65150089284699497227393294451758, 3.65479798928365262611350772203878, 3.65809806280979454840007747407071, 3.66140111611356333654043737624306, 3.66470715188552764729479349625763, 3.66801617281868486131202189426403, 3.67132818160846552402176712348592, 3.67464318095273334563444223022088, 3.67796117355178742158727800415363, 3.68128216210836578525800177885685, 3.68460614932764718432167683204170, 3.68793313791725196892912208568305, 3.69126313058724564442059090652037, 3.69459613005014197995024005649611, 3.69793213902090167621850014256779, 3.70127116021693902681022336764727, 3.70461319635812147410547368053813, 3.70795825016677094154715632612351, 3.71130632436766916271153604611754, 3.71465742168805812539744692912791, 3.71801154485764095980471211078111, 3.72136869660858593533703242428601, 3.72472887967553045740487505099736, 3.72809209679557795880100456997752, 3.73145835070830544921705040906090, 3.73482764415576351524350684485398, 3.73819997988247720854815270286053, 3.74157536063545048676814985810779, 3.74495378916416976622372203564737, 3.74833526822059992511526615999173, 3.75171980055919407348596905649174, 3.75510738893689177686496805108618, 3.75849803611312038853498052048963, 3.76189174484980082269203194300644, 3.76528851791134711035624604846817, 3.76868835806466906390710391860921, 3.77209126807917449752949323737994, 3.77549725072677411219501664163545, 3.77890630878187838703752277069725, 3.78231844502140424069125401729252, 3.78573366222477769582610562792979, 3.78915196317393121461236660252325, 3.79257335065331169232649699551985, 3.79599782744987956917270821577404, 3.79942539635311060663980242679827, 3.80285606015500077248248089745175, 3.80628982165006712889976370206568, 3.80972668363534827662419957050588, 3.81316664891041012808159393898677, 3.81660972027734679556942865019664, 3.82005590054077970307844225317240, 3.82350519250786513580919745436404, 3.82695759898829512835050081775989, 3.83041312279429480014414366451092, 3.83387176674063168135830892424565, 3.83733353364461482470915143494494, 3.84079842632609480546079794294201, 3.84426644760747127094191455398686, 3.84773760031369072009965748293325, 3.85121188727225005621335185423959, 3.85468931131319969551896065240726, 3.85816987526914711992276352248155, 3.86165358197525421246609766967595, 3.86514043426924569502034501056187, 3.86863043499140735193009277281817, 3.87212358698458869454839259560686, 3.87561989309420873439648858038709, 3.87911935616825331862855819053948, 3.88262197905728090319144030218013, 3.88612776461442344100305490428582, 3.88963671569538993466608189919498, 3.89314883515846643646796110260766, 3.89666412586452137745141044433694, 3.90018259067700645559284566843417, 3.90370423246195663580238033318892, 3.90722905408799725535118341213092, 3.91075705842634313569305959390476, 3.91428824835080035882128868252039, 3.91782262673777204042835364816710, 3.92136019646625788581673077715095, 3.92490096041785463398809952195734, 3.92844492147676493942753950250335, 3.93199208252979381938985170563683, 3.93554244646635176252402743557468, 3.93909601617845961385455666459166, 3.94265279456075035113826743327081, 3.94621278451046864077511600044090, 3.94977598892747616687870504392777, 3.95334241071425429581154276093002, 3.95691205277590185573899361770600, 3.96048491802014401841347535082605, 3.96406100935733096690682941698469, 3.96764032970043878378874069312587, 3.97122288196507566837567537731957, 3.97480866906948193673088098876178, 3.97839769393453268619964546815027, 3.98198995948374045994455627806019, 3.98558546864325879965917920344509, 3.98918422434188046921121895138640, 3.99278622951104544824829645222053, 3.99639148708484093219794885953888, 4.00000000000000000000000000000000, 4.00361177119591182815838692476973, 4.00722680361461502940301215858199, 4.01084510020081008718761950149201, 4.01446666390185225026243642787449, 4.01809149766775774992311198730022, 4.02171960445121090543807440553792, 4.02535098720755879497801288380288, 4.02898564889481480832955639925785, 4.03262359247367019321472980664112, 4.03626482090748250897149773663841, 4.03990933716228717287322069751099, 4.04355714420680190102075357572176, 4.04720824501241871473666833480820, 4.05086264255321548688471011701040, 4.05452033980595771822663664352149, 4.05818133975009498470853941398673, 4.06184564536776715470978160738014, 4.06551325964381238264877538313158, 4.06918418556575645084194547962397, 4.07285842612382698035844441619702, 4.07653598431095165466331309289671, 4.08021686312275999597432019072585, 4.08390106555758336526196217164397, 4.08758859461646650856891938019544, 4.09127945330315956340427874238230, 4.09497364462412516417089136666618, 4.09867117158854288305747104459442, 4.10237203720830656550333515042439, 4.10607624449803143562576224212535, 4.10978379647505498439841176150367, 4.11349469615943785782974373432808, 4.11720894657396740967669757083058, 4.12092655074416391869362996658310, 4.12464751169827525956179670174606, 4.12837183246728400831671024207026, 4.13209951608491365959707763977349, 4.13583056558762240939586263266392, 4.13956498401461114866606294526719, 4.14330277440782879239122848957777, 4.14704393981196517415810376405716, 4.15078848327446170429766425513662, 4.15453640784551492259879523771815, 4.15828771657807116923777357442304, 4.16204241252783191384878591634333, 4.16580049875326441366496510454454, 4.16956197831559194355577346868813, 4.17332685427880356598961952840909, 4.17709512970965501921227769344114, 4.18086680767767226996056706411764, 4.18464189125514973710551203112118, 4.18842038351715917343653927673586, 4.19220228754154877748305807472207, 4.19598760640894141715762089006603, 4.19977634320274884061063858098350, 4.20356850100916190626776369754225, 4.20736408291715680007882838253863, 4.21116309201850569365888077300042, 4.21496553140776519796872889855877, 4.21877140418228790963439678307623, 4.22258071344222862819606234552339, 4.22639346229053458614544069860131, 4.23020965383295521888840085011907, 4.23402929117805104652916270424612, 4.23785237743718123937242125975899, 4.24167891572451871695648151217028, 4.24550890915704837169641905347817, 4.24934236085456795706249977229163, 4.25317927393969252847227835445665, 4.25701965153785799600427708355710, 4.26086349677732201257640554104000, 4.26471081278916308576754090609029, 4.26856160270729478867224315763451, 4.27241586966845243722445957246237, 4.27627361681220730105223992723040, 4.28013484728096749165615619858727, 4.28399956421997352151720406254753, 4.28786777077730896223783929599449, 4.29173947010390222089881717693061, 4.29561466535352209916709398385137, 4.29949335968278489872318459674716, 4.30337555625116419122377919848077, 4.30726125822097838380386747303419, 4.31115046875740404175303410738707, 4.31504319102847944122913759201765, 4.31893942820509657565253291977569, 4.32283918346101536656078678788617, 4.32674245997286099907341849757358, 4.33064926092012481007031965418719, 4.33455958948517050544069206807762, 4.33847344885323682461830685497262, 4.34239084221243576422466503572650, 4.34631177275375790713951573707163, 4.35023624367107863974979409249499, 4.35416425816115371105752274161205, 4.35809581942362633810716943116859, 4.36203093066103075869932581554167, 4.36596959507878956685544835636392, 4.36991181588522170642363562365063, 4.37385759629154335925704799592495, 4.37780693951186972157074706046842, 4.38175984876321589212011531344615, 4.38571632726550753034189256140962, 4.38967637824157108639155921991915, 4.39364000491714712381963181542233, 4.39760721052088765503640388487838, 4.40157799828436147038246417650953, 4.40555237144205058541501784930006, 4.40953033323136356358418197487481, 4.41351188689262929898404763662256, 4.41749703566910145724477843032219, 4.42148578280696469278154836501926, 4.42547813155533376061612216290087, 4.42947408516625440455527495942079, 4.43347364689471490351024840492755, 4.43747681999863630153413396328688, 4.44148360773888395414132901350968, 4.44549401337927019284279595012777, 4.44950804018655077243238338269293, 4.45352569143043020005734433652833, 4.45754697038356972882411355385557, 4.46157188032158380508462869329378, 4.46560042452304095661475002998486, 4.46963260626947711529055595747195, 4.47366842884538495894730658619665, 4.47770789553822368134206044487655, 4.48175100963842698575945178163238, 4.48579777443939153869223446235992, 4.48984819323749118069599717273377, 4.49390226933207959092442251858301, 4.49796000602548318170192942488939, 4.50202140662301264484312923741527, 4.50608647443296739254492422332987, 4.51015521276662845195914997020736, 4.51422762493826734697677238727920, 4.51830371426515231547682560631074, 4.52238348406754298025589378084987, 4.52646693766869745445546868722886, 4.53055407839487678245404822519049, 4.53464490957534316351029701763764, 4.53873943454236528083356461138465, 4.54283765663122185429756427765824, 4.54693957918020252861879271222278, 4.55104520553060964971336943563074, 4.55515453902676625830281409434974, 4.55926758301601253720036766026169, 4.56338434084870847584625153103843, 4.56750481587824630480554333189502, 4.57162901146104072580556021421216, 4.57575693095653601716321645653807, 4.57988857772721669192605986609124, 4.58402395513859683973123537725769, 4.58816306655922989676810175296851, 4.59230591536071575120558918570168, 4.59645250491769452594326139660552, 4.60060283860785279586025353637524, 4.60475691981193069324262978625484, 4.60891475191371835506970455753617, 4.61307633830006036390614099218510, 4.61724168236086374150772826396860, 4.62141078748909261975086337770335, 4.62558365708077356970306937000714, 4.62976029453500448340719231055118, 4.63394070325394835663246340118349, 4.63812488664284039430185657693073, 4.64231284810999511591944610700011, 4.64650459106679836196462929365225, 4.65070011892771884021158257382922, 4.65489943511030990208610091940500, 4.65910254303520954266559783718549, 4.66330944612614128885752506903373, 4.66752014780992663389724839362316, 4.67173465151647526738543092506006, 4.67595296067879662160748921451159, 4.68017507873300075971201295033097, 4.68440100911829837571076495805755, 4.68863075527700523537077970104292, 4.69286432065454928164172088145278, 4.69710170869946441740694353939034, 4.70134292286340027544611075427383, 4.70558796660112488297045274521224, 4.70983684337052466162276687100530, 4.71408955663260531565583733026870, 4.71834610985150337825189126306213, 4.72260650649447999427366085001267, 4.72687075003192358479964241269045, 4.73113884393736405797881161561236, 4.73541079168746215088958706473932, 4.73968659676201742314560760860331, 4.74396626264397536232308993930928, 4.74824979281942383124714979203418, 4.75253719077759662070548074552789, 4.75682846001088410758939062361605, 4.76112360401482437310960449394770, 4.76542262628811208458046166924760, 4.76972553033260471266885360819288, 4.77403231965331986685896481503733, 4.77834299775843707180911223986186, 4.78265756815930931367120138020255, 4.78697603437045593466336868004873, 4.79129839990956885031891943071969, 4.79562466829752231944894447224215, 4.79995484305836228600128379184753, 4.80428892771931881355840232572518, 4.80862692581081230258632785989903, 4.81296884086644460865045402897522, 4.81731467642300881237815701751970, 4.82166443602049543670773346093483, 4.82601812320208800599630194483325, 4.83037574151416837509032120578922, 4.83473729450632649928820683271624, 4.83910278573135066437771456548944, 4.84347221874523903295539639657363, 4.84784559710720497349711877177469, 4.85222292437966906675228528911248, 4.85660420412827242842013220069930, 4.86098943992187582097130871261470, 4.86537863533256054182629668503068, 4.86977179393563375242592883296311, 4.87416891930963380730190692702308, 4.87857001503632581318470329279080, 4.88297508470071139896617751219310, 4.88738413189103049205641582375392, 4.89179716019875954202689172234386, 4.89621417321862040239466296043247, 4.90063517454858210697921094833873, 4.90506016778985820536718165385537, 4.90948915654691564469658260350116, 4.91392214442748009872730108327232, 4.91835913504252886241374653764069, 4.92280013200630151004588697105646, 4.92724513893630344796292774844915, 4.93169415945330502637489189510234, 4.93614719718134331571945949690416, 4.94060425574773365298142380197532, 4.94506533878305987173007451929152, 4.94953044992118851297391302068718, 4.95399959279926616062539324047975, 4.95847277105772388239302017609589, 4.96294998834027722978134988807142, 4.96743124829393600805360620142892, 4.97191655456900072351800190517679, 4.97640591081906702441983725293539, 4.98089932070103191819043786381371, 4.98539678787509288326873502228409, 4.98989831600475053363652477855794, 4.99440390875681927695950435008854, 4.99891356980141843280307512031868, 5.00342730281198200259495934005827, 5.00794511146526488687413802836090, 5.01246699944133933257717217202298, 5.01699297042359759757346182595938, 5.02152302809876438516312191495672, 5.02605717615688796229278523242101, 5.03059541829134815316137974150479, 5.03513775819886610918274527648464, 5.03968419957949276266617744113319, 5.04423474613662481402798221097328, 5.04878940157700295543463653302751, 5.05334816961071275898120802594349, 5.05791105395118911758345348061994, 5.06247805831522512676201586145908, 5.06704918642296497921506670536473, 5.07162444199791018206724402261898, 5.07620382876693287954594779876061, 5.08078735046026164212662479258142, 5.08537501081149656556590343825519, 5.08996681355761104725843324558809, 5.09456276243894912170162569964305, 5.09916286119923256592301186174154, 5.10376711358556800490759997046553, 5.10837552334844069434893754078075, 5.11298809424172162607646896503866, 5.11760483002267729801815221435390, 5.12222573445196083241626183735207, 5.12685081129362174579000566154718, 5.13148006431511305436288239434361, 5.13611349728728505681374372215942, 5.14075111398439243970415191142820, 5.14539291818410227108415710972622, 5.15003891366748867142177914502099, 5.15468910421903903085194542654790, 5.15934349362666289096068794606254, 5.16400208568168661571462507708929, 5.16866488417885872053147977567278, 5.17333189291635786588585688150488, 5.17800311569578930459556431742385, 5.18267855632219021089213129016571, 5.18735821860403856220500529161654, 5.19204210635324603373419449781068, 5.19673022338516599205604507005773, 5.20142257351860237690743815619498, 5.20611916057580259575843228958547, 5.21081998838246374106120128999464, 5.21552506076774324839107066509314, 5.22023438156425267919757970958017, 5.22494795460806127351816030568443, 5.22966578373870927265443242504261, 5.23438787279919726103116772719659, 5.23911422563599682433732596109621, 5.24384484609905765495341256610118, 5.24857973804179955834570137085393, 5.25331890532112488756411039503291, 5.25806235179741854324220184935257, 5.26281008133455063813244123593904, 5.26756209779987827346303674858063, 5.27231840506425619707897567423061, 5.27707900700202703347940769162960, 5.28184390749103549467236007330939, 5.28661311041263015653157708584331, 5.29138661965165901790442148922011, 5.29616443909648015875291093834676, 5.30094657263896529286739678354934, 5.30573302417449621515288527007215, 5.31052379760197190705639513907954, 5.31531889682381741835115462890826, 5.32011832574597587353082417394035, 5.32492208827791646541527370573021, 5.32973018833264600147003875463270, 5.33454262982669558113002494792454, 5.33935941668013658301106261205859, 5.34418055281658332944516587303951, 5.34900604216318686923159475554712, 5.35383588865064563577789158443920, 5.35867009621321166434881888562813, 5.36350866878868615117426088545471, 5.36835161031842300616290231118910, 5.37319892474734128740010419278406, 5.37805061602391720754212656174786, 5.38290668810019301560032545239665, 5.38776714493178321419009080273099, 5.39263199047786923046032825368457, 5.39750122870120740969923645025119, 5.40237486356813789711850404273719, 5.40725289904857575606911268550903, 5.41213533911602251436079313862137, 5.41702218774757060515412376844324, 5.42191344892390070242527144728228, 5.42680912662928705003650975413620, 5.43170922485160456716357657569461, 5.43661374758232618376041500596330, 5.44152269881652816962969154701568, 5.44643608255289901620699311024509, 5.45135390279373321931188911548816, 5.45627616354493927275370879215188, 5.46120286881604766193731848034076, 5.46613402262020198207892462960444, 5.47106962897417314906078900094144, 5.47600969189836206396648776717484, 5.48095421541679517218881301232614, 5.48590320355713156885713033261709, 5.49085666035067365697841523797251, 5.49581458983235737747463645064272, 5.50077699604076197914537260658108, 5.50574388301812067680884865694679, 5.51071525481030821680406006635167, 5.51569111546685508784548801486380, 5.52067146904095196191519789863378, 5.52565631958944525337074082926847, 5.53064567117284422437251123483293, 5.53563952785532809031110446085222, 5.54063789370474246709363796981052, 5.54564077279260558839268924202770, 5.55064816919411629925207307678647, 5.55566008698815050337316279183142, 5.56067653025726382765014932374470, 5.56569750308770494484633672982454, 5.57072300956940669180994518683292, 5.57575305379599672761514739249833, 5.58078763986480108627574736601673, 5.58582677187684151220992134767585, 5.59087045393684434202441480010748, 5.59591869015324494540664090891369, 5.60097148463818417241100178216584, 5.60602884150751723524308545165695, 5.61109076488081903733018407365307, 5.61615725888137973242919542826712, 5.62122832763621183005398052046075, 5.62630397527606174179481968167238, 5.63138420593539823499895646818914, 5.63646902375242397909005376277491, 5.64155843286908265099555137567222, 5.64665243743105538243298724410124, 5.65175104158776253626683683251031, 5.65685424949238058189848743495531, 5.66196206530182699623310327297077, 5.66707449317677536271276039769873, 5.67219153728166070038696489064023, 5.67731320178467235848529526265338, 5.68243949085776467455843885545619, 5.68757040867666230354871004237793, 5.69270595942085666507637142785825, 5.69784614727361216068857174832374, 5.70299097642197683200038227369078, 5.70814045105677347891059980611317, 5.71329457537260765320752398110926, 5.71845335356788009306683306931518, 5.72361678984477517673212787485681, 5.72878488840927246883438783697784, 5.73395765347115560217616803129204, 5.73913508924400161959056276828051, 5.74431719994519429661750109517016, 5.74950398979592947057426499668509, 5.75469546302121059966339089442044, 5.75989162384985409204318784759380, 5.76509247651450262850403305492364, 5.77029802525161272797049605287611, 5.77550827430146895835605391766876, 5.78072322790818660109835036564618, 5.78594289031971076298077605315484, 5.79116726578781992884614737704396, 5.79639635856814017245142167666927, 5.80163017292013094561298203188926, 5.80686871310710017723977216519415, 5.81211198339621049058223434258252, 5.81735998805847120962653207243420, 5.82261273136874901723558650701307, 5.82787021760577506057643404346891, 5.83313245105214051022812782321125, 5.83839943599430011289541653241031, 5.84367117672258817862029900425114, 5.84894767753120436992730901692994, 5.85422894271822791267823049565777, 5.85951497658562292514261571341194, 5.86480578343923486528410649043508, 5.87010136758879319529569329461083, 5.87540173334792736881126984371804, 5.88070688503415617276459670392796, 5.88601682696889572099507859093137, 5.89133156347747011238880077144131, 5.89665109888910343727275176206604, 5.90197543753692865919902033056132, 5.90730458375799738490741219720803, 5.91263854189327098254125303355977, 5.91797731628763035161000516382046, 5.92332091128988746930872366647236, 5.92866933125277117966334117227234, 5.93402258053294584527748156688176, 5.93938066349100957097562059061602, 5.94474358449149775651676463894546, 5.95011134790288309659445076249540, 5.95548395809758801533462246879935, 5.96086141945198111358195092179812, 5.96624373634637805707825464196503, 5.97163091316505934003089350881055, 5.97702295429625518607963385875337, 5.98241986413216153550820308737457, 5.98782164706894182160112904966809, 5.99322830750672697064374006004073, 5.99863984984961806645742399268784, 6.00405627850570233761118288384750, 6.00947759788703717021007832954638, 6.01490381240966609510678608785383, 6.02033492649362589332895367988385, 6.02577094456293860247342308866791, 6.03121187104562039849042776040733, 6.03665771037369136564620930585079, 6.04210846698316750291724019916728, 6.04756414531407138213126017944887, 6.05302474981043925339463385171257, 6.05849028492031571602183248614892, 6.06396075509576082396279161912389, 6.06943616479285896758710805443116, 6.07491651847171443279194136266597, 6.08040182059645850642937148222700, 6.08589207563525835809059572056867, 6.09138728806030993467857115319930, 6.09688746234784773037063132505864, 6.10239260297815366840268325177021, 6.10790271443554821928501041838899, 6.11341780120840372347856828127988, 6.11893786778914794410866306861863, 6.12446291867426140242969268001616, 6.12999295836428359507408458739519, 6.13552799136382365219333223649301, 6.14106802218155323203063744585961, 6.14661305533021362634826800785959, 6.15216309532662730674701379030012, 6.15771814669169081923882913542911, 6.16327821395037922513893136056140, 6.16884330163176297645577506045811, 6.17441341426899459321475660544820, 6.17998855639931932159925054293126, 6.18556873256408579209164599888027, 6.19115394730873802586756937671453, 6.19674420518282165204482225817628, 6.20233951073999989489493600558490, 6.20793986853803847481003685970791, 6.21354528313882070733598084188998, 6.21915575910835460859971135505475, 6.22477130101676312534664248232730, 6.23039191343829834579537418903783, 6.23601760095134771688663022359833, 6.24164836813842605067748081637546, 6.24728421958618707066079878131859, 6.25292515988543051719261711696163, 6.25857119363109681842161080567166, 6.26422232542227508389487411477603, 6.26987855986221198634211759781465, 6.27553990155830465624831049353816, 6.28120635512211400452997622778639, 6.28687792516936561071361211361364, 6.29255461631995061111410905141383, 6.29823643319792925154843032942154, 6.30392338043154598636874652584083, 6.30961546265321526760772030684166, 6.31531268449953575583322162856348, 6.32101505061129831375410503824241, 6.32672256563347890079285207320936, 6.33243523421524656669134856201708, 6.33815306100997499783034072606824, 6.34387605067523363544523817836307, 6.34960420787279744558873062487692, 6.35533753726865580091498486581258, 6.36107604353300626343070689472370, 6.36681973134026346627933889976703, 6.37256860536906799552525626495481, 6.37832267030227839654799026902765, 6.38408193082698360854010388720781, 6.38984639163450829357770999195054, 6.39561605742040928390679255244322, 6.40139093288448268737056423560716, 6.40717102273077365737208310747519, 6.41295633166756839926847533206455, 6.41874686440740482851197157287970, 6.42454262566708411696936309454031, 6.43034362016765648206728656077757, 6.43614985263443806218219833681360, 6.44196132779701713388931239023805, 6.44777805038924611835682298988104, 6.45360002514925046313010170706548, 6.45942725681944285298641261761077, 6.46525975014650899908019709982909, 6.47109750988142362615462843677960, 6.47694054077945491343371031689458, 6.48278884760016005373017833335325, 6.48864243510739235887285758508369, 6.49450130806931547056137787876651, 6.50036547125838914951145852683112, 6.50623492945138437448804324958473, 6.51210968742939133591107747633941, 6.51798974997780966589289164403453, 6.52387512188636176091449669911526, 6.52976580794909988725294169853441, 6.53566181296439996373237590887584, 6.54156314173496866715140640735626, 6.54746979906785764313781328382902, 6.55338178977445195982909353915602, 6.55929911867047898965665808646008, 6.56522179057602528473580605350435, 6.57114981031551792511891108006239, 6.57708318271774583507749412092380, 6.58302191261585978310222344589420, 6.58896600484736971736765553941950, 6.59491546425415453569485180196352, 6.60087029568247096733557555126026, 6.60683050398294469118809502106160, 6.61279609401058188211663946276531, 6.61876707062477720455717644654214, 6.62474343868931025980373306083493, 6.63072520307234913872207471285947, 6.63671236864646463260442033060826, 6.64270494028862135138524536159821, 6.64870292288018749360389847424813, 6.65470632130694550454563795938157, 6.66071514045908230627901502884924, 6.66672938523120084397532991715707, 6.67274906052232985587124858284369, 6.67877417123591499148460570722818, 6.68480472227983035793386079603806, 6.69084071856638651354387548053637, 6.69688216501232425059697561664507, 6.70292906653882347711714828619733, 6.70898142807151387501107819844037, 6.71503925454046779464079008903354, 6.72110255088020736025100632105023, 6.72717132202971601628860298660584, 6.73324557293243408651051140623167, 6.73932530853626055034055752912536, 6.74541053379357347097311503603123, 6.75150125366121134362629163661040, 6.75759747310049352364558217232116, 6.76369919707722111468228831654415, 6.76980643056167430415825947420672, 6.77591917852862213322850948316045, 6.78203744595733049038699391530827, 6.78816123783155678239609187585302, 6.79429055913955526335712420404889, 6.80042541487409391010032777558081, 6.80656581003244109950856000068597, 6.81271174961637626665833522565663, 6.81886323863220500385295963496901, 6.82502028209074307341097664902918, 6.83118288500733328305614122655243, 6.83735105240185170316635776543990, 6.84352478929870144952474220190197, 6.84970410072682334146065841196105, 6.85588899171970389545549551257864, 6.86207946731536910789372996077873, 6.86827553255639333684712255490012, 6.87447719248991173657259423634969, 6.88068445216760782301435028784908, 6.88689731664573034919385463581420, 6.89311579098509596974508895073086, 6.89933988025108657637929354677908, 6.90556958951365817966916438308544, 6.91180492384735067901146976510063, 6.91804588833127809266443364322186, 6.92429248804914365678087051492184, 6.93054472808924426630028392537497, 6.93680261354446692223518766695634, 6.94306614951229583709846338024363, 6.94933534109482486940123635577038, 6.95561019339874953004709823289886, 6.96189071153537408775946460082196, 6.96817690062062577993629020056687, 6.97446876577504504268745222361758, 6.98076631212379616897578671341762, 6.98706954479667619040128556662239, 6.99337846892810777177373893209733, 6.99969308965715164561061101267114, 7.00601341212751282938597796601243, 7.01233944148753618463842940400355, 7.01867118289021352239842599374242, 7.02500864149319781404301465954632, 7.03135182245879164497637248132378, 7.03770073095395876094926279620267, 7.04405537215033561437849130015820, 7.05041575122421981802744994638488, 7.05678187335658613221767154755071, 7.06315374373309090572092827642336, 7.06953136754406852304555286536925, 7.07591474998453939804221590748057, 7.08230389625421885568812285782769, 7.08869881155751535573017463320866, 7.09509950110353226904180701239966, 7.10150597010608475301296493853442, 7.10791822378369086976590551785193, 7.11433626735957780340413592057303, 7.12076010606169784722396798315458, 7.12718974512271508103822270641103, 7.13362518978002047020936515764333, 7.14006644527573985925528177176602, 7.14651351685672509006508335005492, 7.15296640977456732457540056202561, 7.15942512928560415019774154643528, 7.16588968065091425074797371053137, 7.17236006913632540005210103117861, 7.17883630001242867280097925686277, 7.18531837855456601005244010593742, 7.19180631004284354190758676850237, 7.19830009976214046929499090765603, 7.20479975300210284672175475861877, 7.21130527505715157587928842986003, 7.21781667122649572831960540497676, 7.22433394681412188731428614119068, 7.23085710712880747053077357122675, 7.23738615748412783545973070431501, 7.24392110319845006216610272531398, 7.25046194959494538778699279646389, 7.25700870200159542378059995826334, 7.26356136575118771503412062884308, 7.27011994618132462164794560521841, 7.27668444863443397707669646479189, 7.28325487845776287088028766447678, 7.28983124100338475415128414169885, 7.29641354162821365036961651640013, 7.30300178569399172090470528928563, 7.30959597856730436404859574395232, 7.31619612561958909680015494814143, 7.32280223222712756125929445261136, 7.32941430377105440641116729239002, 7.33603234563736972262404378852807, 7.34265636321693193622195394709706, 7.34928636190546580309046476031654, 7.35592234710357484317455600830726, 7.36256432421673245869442325783893, 7.36921229865529348046493396395817, 7.37586627583450393785824417136610, 7.38252626117449217701960151316598, 7.38919226010028307172206041286699, 7.39586427804180335243700028513558, 7.40254232043387982997728613554500, 7.40922639271624206003252766095102, 7.41591650033354188309431265224703, 7.42261264873534010177991149248555, 7.42931484337611536261647415813059, 7.43602308971528191960942422156222, 7.44273739321717364703090424882248, 7.44945775935106002663133040186949, 7.45618419359115591760200913995504, 7.46291670141661178661252051824704, 7.46965528831152614230859398958273, 7.47639995976495441709630540572107, 7.48315072127090274989313911646605, 7.48990757832833775609060467104428, 7.49667053644119985023053231998347, 7.50343960111838903515035781310871, 7.51021477787378177737309670192190, 7.51699607222624077706996104097925, 7.52378348969960253356248358613811, 7.53057703582269333253407239681110, 7.53737671612933812781420783721842, 7.54418253615835077141582587501034, 7.55099450145354733621161358314566, 7.55781261756375677407504554139450, 7.56463689004281025773934743483551, 7.57146732444955450347379155573435, 7.57830392634786242922473320504650, 7.58514670130662427283141369116493, 7.59199565489975736198857703129761, 7.59885079270622121327960485359654, 7.60571212031000243314338149502873, 7.61257964330013336962110770400614, 7.61945336727069655324839914101176, 7.62633329782082203252002727822401, 7.63321944055469181478201790014282, 7.64011180108155940615688450634480, 7.64701038501573204797523430897854, 7.65391519797658848034416223526932, 7.66082624558858960028828732902184, 7.66774353348126425089503754861653, 7.67466706728922787306146346963942, 7.68159685265218961092159588588402, 7.68853289521494343006224880809896, 7.69547520062738055202089526574127, 7.70242377454450011242670370847918, 7.70937862262640116739476070506498, 7.71633975053829335166710734483786, 7.72330716395050842493219533935189, 7.73028086853849227821910972124897, 7.73726086998281292750334614538588, 7.74424717396917738909678519121371, 7.75123978618841835697139686089940, 7.75823871233650574907869668095373, 7.76524395811456180638288060436025, 7.77225552922884777018452950869687, 7.77927343139077898115374409826472, 7.78629767031693287293592220521532, 7.79332825172904453125966028892435, 7.80036518135401202300727163674310, 7.80740846492391327160476066637784, 7.81445810817599539888078652438708, 7.82151411685268449502927978755906, 7.82857649670160071764257736504078, 7.83564525347554585721354669658467, 7.84272039293251399527662215405144, 7.84980192083570926797619904391468, 7.85688984295353165521191840525717, 7.86398416505958675060128371114843, 7.87108489293270352504805487114936, 7.87819203235692011588753302930854, 7.88530558912149981409811516641639, 7.89242556902093728155023200088181, 7.89955197785495411011424948810600, 7.90668482142850681526624612160958, 7.91382410555180371147798723541200, 7.92096983604028981318379010190256, 7.92812201871466104563523913384415, 7.93528065940087756757748138625175, 7.94244576393015222492977045476437, 7.94961733813896298528334227739833, 7.95679538786906537239929093630053, 7.96397991896748269624595195637085, 7.97117093728651582296151900663972, 7.97836844868376093842243790277280, 7.98557245902209267285343230469152, 7.99278297416968008803905831882730, 8.00000000000000000000000000000000, 8.00722354239182365631677384953946, 8.01445360722923005880602431716397, 8.02169020040162017437523900298402, 8.02893332780370450052487285574898, 8.03618299533551549984622397460043, 8.04343920890242181087614881107584, 8.05070197441511758995602576760575, 8.05797129778962961665911279851571, 8.06524718494734038642945961328223, 8.07252964181496501794299547327682, 8.07981867432457434574644139502198, 8.08711428841360380204150715144351, 8.09441649002483742947333666961640, 8.10172528510643097376942023402080, 8.10904067961191543645327328704298, 8.11636267950018996941707882797346, 8.12369129073553430941956321476027, 8.13102651928762476529755076626316, 8.13836837113151290168389095924795, 8.14571685224765396071688883239403, 8.15307196862190330932662618579343, 8.16043372624551999194864038145170, 8.16780213111516673052392434328794, 8.17517718923293301713783876039088, 8.18255890660631912680855748476461, 8.18994728924825032834178273333237, 8.19734234317708576611494208918884, 8.20474407441661313100667030084878, 8.21215248899606287125152448425069, 8.21956759295010996879682352300733, 8.22698939231887571565948746865615, 8.23441789314793481935339514166117, 8.24185310148832783738725993316621, 8.24929502339655051912359340349212, 8.25674366493456801663342048414052, 8.26419903216982731919415527954698, 8.27166113117524481879172526532784, 8.27912996802922229733212589053437, 8.28660554881565758478245697915554, 8.29408787962393034831620752811432, 8.30157696654892340859532851027325, 8.30907281569102984519759047543630, 8.31657543315614233847554714884609, 8.32408482505566382769757183268666, 8.33160099750652882732993020908907, 8.33912395663118388711154693737626, 8.34665370855760713197923905681819, 8.35419025941931003842455538688228, 8.36173361535534453992113412823528, 8.36928378251029947421102406224236, 8.37684076703431834687307855347171, 8.38440457508309755496611614944413, 8.39197521281788283431524178013206, 8.39955268640549768122127716196701, 8.40713700201832381253552739508450, 8.41472816583431360015765676507726, 8.42232618403701138731776154600084, 8.42993106281553039593745779711753, 8.43754280836457581926879356615245, 8.44516142688445725639212469104677, 8.45278692458106917229088139720261, 8.46041930766591043777680170023814, 8.46805858235610209305832540849224, 8.47570475487436247874484251951799, 8.48335783144903743391296302434057, 8.49101781831409674339283810695633, 8.49868472170913591412499954458326, 8.50635854787938505694455670891330, 8.51403930307571599200855416711420, 8.52172699355464402515281108208001, 8.52942162557832617153508181218058, 8.53712320541458957734448631526902, 8.54483173933690487444891914492473, 8.55254723362441460210447985446081, 8.56026969456193498331231239717454, 8.56799912843994704303440812509507, 8.57573554155461792447567859198898, 8.58347894020780444179763435386121, 8.59122933070704419833418796770275, 8.59898671936556979744636919349432, 8.60675111250232838244755839696154, 8.61452251644195676760773494606838, 8.62230093751480808350606821477413, 8.63008638205695888245827518403530, 8.63787885641019315130506583955139, 8.64567836692203073312157357577235, 8.65348491994572199814683699514717, 8.66129852184024962014063930837438, 8.66911917897034101088138413615525, 8.67694689770647364923661370994523, 8.68478168442487152844933007145301, 8.69262354550751581427903147414327, 8.70047248734215727949958818498999, 8.70832851632230742211504548322409, 8.71619163884725267621433886233717, 8.72406186132206151739865163108334, 8.73193919015757913371089671272784, 8.73982363177044341284727124730125, 8.74771519258308671851409599184990, 8.75561387902373944314149412093684, 8.76351969752643178424023062689230, 8.77143265453101506068378512281924, 8.77935275648314217278311843983829, 8.78728000983429424763926363084465, 8.79521442104177531007280776975676, 8.80315599656872294076492835301906, 8.81110474288410117083003569860011, 8.81906066646272712716836394974962, 8.82702377378525859796809527324513, 8.83499407133820291448955686064437, 8.84297156561392938556309673003852, 8.85095626311066752123224432580173, 8.85894817033250880911054991884157, 8.86694729378942980702049680985510, 8.87495363999727260306826792657375, 8.88296721547776790828265802701935, 8.89098802675854038568559190025553, 8.89901608037310154486476676538587, 8.90705138286086040011468867305666, 8.91509394076713945764822710771114, 8.92314376064316761016925738658756, 8.93120084904608191322950005996972, 8.93926521253895423058111191494390, 8.94733685769076991789461317239329, 8.95541579107644736268412088975310, 8.96350201927685397151890356326476, 8.97159554887878307738446892471984, 8.97969638647498236139199434546754, 8.98780453866415918184884503716603, 8.99592001205096636340385884977877, 9.00404281324602528968625847483054, 9.01217294886593478508984844665974, 9.02031042553325690391829994041473, 9.02845524987653469395354477455840, 9.03660742853030463095365121262148, 9.04476696813508596051178756169975, 9.05293387533739490891093737445772, 9.06110815678975356490809645038098, 9.06928981915068632702059403527528, 9.07747886908473056166712922276929, 9.08567531326244370859512855531648, 9.09387915836040505723758542444557, 9.10209041106121929942673887126148, 9.11030907805353251660562818869948, 9.11853516603202507440073532052338, 9.12676868169741695169250306207687, 9.13500963175649260961108666379005, 9.14325802292208145161112042842433, 9.15151386191307203432643291307613, 9.15977715545443338385211973218247, 9.16804791027719367946247075451538, 9.17632613311845979353620350593701, 9.18461183072143150241117837140337, 9.19290500983538905188652279321104, 9.20120567721570559172050707275048, 9.20951383962386138648525957250968, 9.21782950382743671013940911507234, 9.22615267660012072781228198437020, 9.23448336472172748301545652793720, 9.24282157497818523950172675540671, 9.25116731416154713940613874001428, 9.25952058907000896681438462110236, 9.26788140650789671326492680236697, 9.27624977328568078860371315386146, 9.28462569621999023183889221400023, 9.29300918213359672392925858730450, 9.30140023785543768042316514765844, 9.30979887022061980417220183881000, 9.31820508607041908533119567437097, 9.32661889225228257771505013806745, 9.33504029561985326779449678724632, 9.34346930303295053477086185012013, 9.35190592135759324321497842902318, 9.36035015746600151942402590066195, 9.36880201823659675142152991611511, 9.37726151055401047074155940208584, 9.38572864130909856328344176290557, 9.39420341739892883481388707878068, 9.40268584572680055089222150854766, 9.41117593320224976594090549042448, 9.41967368674104932324553374201059, 9.42817911326521063131167466053739, 9.43669221970300675650378252612427, 9.44521301298895998854732170002535, 9.45374150006384716959928482538089, 9.46227768787472811595762323122472, 9.47082158337492430177917412947863, 9.47937319352403484629121521720663, 9.48793252528795072464617987861857, 9.49649958563884766249429958406836, 9.50507438155519324141096149105579, 9.51365692002176821517878124723211, 9.52224720802964874621920898789540, 9.53084525257622416916092333849519, 9.53945106066520942533770721638575, 9.54806463930663973371792963007465, 9.55668599551687414361822447972372, 9.56531513631861862734240276040509, 9.57395206874091186932673736009747, 9.58259679981913770063783886143938, 9.59124933659504463889788894448429, 9.59990968611672457200256758369505, 9.60857785543863762711680465145037, 9.61725385162162460517265571979806, 9.62593768173288921730090805795044, 9.63462935284601762475631403503940, 9.64332887204099087341546692186967, 9.65203624640417601199260388966650, 9.66075148302833675018064241157845, 9.66947458901265299857641366543248, 9.67820557146270132875542913097888, 9.68694443749047806591079279314727, 9.69569119421440994699423754354939, 9.70444584875933813350457057822496, 9.71320840825654485684026440139860, 9.72197887984375164194261742522940, 9.73075727066512108365259337006137, 9.73954358787126750485185766592622, 9.74833783861926761460381385404617, 9.75714003007265162636940658558160, 9.76595016940142279793235502438620, 9.77476826378206098411283164750785, 9.78359432039751908405378344468772, 9.79242834643724080478932592086494, 9.80127034909716421395842189667746, 9.81012033557971641073436330771074, 9.81897831309383128939316520700231, 9.82784428885496019745460216654465, 9.83671827008505772482749307528138, 9.84560026401260302009177394211292, 9.85449027787260689592585549689829, 9.86338831890661005274978379020467, 9.87229439436268663143891899380833, 9.88120851149546730596284760395065, 9.89013067756611974346014903858304, 9.89906089984237702594782604137436, 9.90799918559853232125078648095950, 9.91694554211544776478604035219178, 9.92589997668055445956269977614284, 9.93486249658787201610721240285784, 9.94383310913800144703600381035358, 9.95281182163813404883967450587079, 9.96179864140206383638087572762743, 9.97079357575018576653747004456818, 9.97979663200950106727304955711588, 9.98880781751363855391900870017707, 9.99782713960283686560615024063736, 10.00685460562396400518991868011653, 10.01589022293052977374827605672181, 10.02493399888267866515434434404597, 10.03398594084719519514692365191877, 10.04304605619752877032624382991344, 10.05211435231377592458557046484202, 10.06119083658269630632275948300958, 10.07027551639773221836549055296928, 10.07936839915898552533235488226637, 10.08846949227324962805596442194656, 10.09757880315400591086927306605503, 10.10669633922142551796241605188698, 10.11582210790237823516690696123987, 10.12495611663045025352403172291815, 10.13409837284592995843013341072947, 10.14324888399582036413448804523796, 10.15240765753386575909189559752122, 10.16157470092052328425324958516285, 10.17075002162299313113180687651038, 10.17993362711522209451686649117619, 10.18912552487789824340325139928609, 10.19832572239846513184602372348309, 10.20753422717113600981519994093105, 10.21675104669688138869787508156151, 10.22597618848344325215293793007731, 10.23520966004535459603630442870781, 10.24445146890392166483252367470413, 10.25370162258724349158001132309437, 10.26296012863022610872576478868723, 10.27222699457457011362748744431883, 10.28150222796878487940830382285640, 10.29078583636820454216831421945244, 10.30007782733497734284355829004198, 10.30937820843807806170389085309580, 10.31868698725332578192137589212507, 10.32800417136337323142925015417859, 10.33732976835771744106295955134556, 10.34666378583271573177171376300976, 10.35600623139157860919112863484770, 10.36535711264438042178426258033141, 10.37471643720807712441001058323309, 10.38408421270649206746838899562135, 10.39346044677033198411209014011547, 10.40284514703720475381487631238997, 10.41223832115160519151686457917094, 10.42163997676492748212240257998928, 10.43105012153548649678214133018628, 10.44046876312850535839515941916034, 10.44989590921612254703632061136886, 10.45933156747741854530886485008523, 10.46877574559839452206233545439318, 10.47822845127199364867465192219242, 10.48768969219811530990682513220236, 10.49715947608359911669140274170786, 10.50663781064224977512822079006582, 10.51612470359483708648440369870514, 10.52562016266910127626488247187808, 10.53512419559975654692607349716127, 10.54463681012851239415795134846121, 10.55415801400405406695881538325921, 10.56368781498207098934472014661878, 10.57322622082526031306315417168662, 10.58277323930331803580884297844023, 10.59232887819296031750582187669352, 10.60189314527793058573479356709868, 10.61146604834899243030577054014429, 10.62104759520394381411279027815908, 10.63063779364763483670230925781652, 10.64023665149195174706164834788069, 10.64984417655583293083054741146043, 10.65946037666529200294007750926539, 10.66908525965339116226004989584908, 10.67871883336027316602212522411719, 10.68836110563316665889033174607903, 10.69801208432637373846318951109424, 10.70767177730129127155578316887841, 10.71734019242642332869763777125627, 10.72701733757737230234852177090943, 10.73670322063684601232580462237820, 10.74639784949468257480020838556811, 10.75610123204783441508425312349573, 10.76581337620038603120065090479329, 10.77553428986356642838018160546198, 10.78526398095573846092065650736913, 10.79500245740241481939847290050238, 10.80474972713627579423700808547437, 10.81450579809715151213822537101805, 10.82427067823204502872158627724275, 10.83404437549514121030824753688648, 10.84382689784780140485054289456457, 10.85361825325857410007301950827241, 10.86341844970320913432715315138921, 10.87322749516465236752083001192659, 10.88304539763305633925938309403136, 10.89287216510579803241398622049019, 10.90270780558746643862377823097631, 10.91255232708987854550741758430377, 10.92240573763209532387463696068153, 10.93226804524040396415784925920889, 10.94213925794834629812157800188288, 10.95201938379672412793297553434968, 10.96190843083359034437762602465227, 10.97180640711426313771426066523418, 10.98171332070134731395683047594503, 10.99162917966471475494927290128544, 11.00155399208152395829074521316215, 11.01148776603624135361769731389359, 11.02143050962061643360812013270333, 11.03138223093371017569097602972761, 11.04134293808190392383039579726756, 11.05131263917889050674148165853694, 11.06129134234568844874502246966586, 11.07127905571065618062220892170444, 11.08127578740948493418727593962103, 11.09128154558521117678537848405540, 11.10129633838823259850414615357295, 11.11132017397630100674632558366284, 11.12135306051452765530029864748940, 11.13139500617540988969267345964909, 11.14144601913881338361989037366584, 11.15150610759199345523029478499666, 11.16157527972960217255149473203346, 11.17165354375368302441984269535169, 11.18174090787368868404882960021496, 11.19183738030648989081328181782737, 11.20194296927636834482200356433168, 11.21205768301503447048617090331391, 11.22218152976163807466036814730614, 11.23231451776275946485839085653424, 11.24245665527242366010796104092151, 11.25260795055212348358963936334476, 11.26276841187079646999791293637827, 11.27293804750484795818010752554983, 11.28311686573816530199110275134444, 11.29330487486211076486597448820248, 11.30350208317552507253367366502061, 11.31370849898476116379697486991063, 11.32392413060365399246620654594153, 11.33414898635355072542552079539746, 11.34438307456332140077392978128046, 11.35462640356934471697059052530676, 11.36487898171552934911687771091238, 11.37514081735332460709742008475587, 11.38541191884171333015274285571650, 11.39569229454722432137714349664748, 11.40598195284395366400076454738155, 11.41628090211354695782119961222634, 11.42658915074521530641504796221852, 11.43690670713576018613366613863036, 11.44723357968955035346425574971363, 11.45756977681854493766877567395568, 11.46791530694231120435233606258407, 11.47827017848800323918112553656101, 11.48863439989038859323500219034031, 11.49900797959185894114852999337018, 11.50939092604242119932678178884089, 11.51978324769970818408637569518760, 11.53018495302900525700806610984728, 11.54059605050322545594099210575223, 11.55101654860293791671210783533752, 11.56144645581637320219670073129237, 11.57188578063942152596155210630968, 11.58233453157563985769229475408792, 11.59279271713628034490284335333854, 11.60326034584026189122596406377852, 11.61373742621420035447954433038831, 11.62422396679242098116446868516505, 11.63471997611694241925306414486840, 11.64522546273749803447117301402614, 11.65574043521155012115286808693781, 11.66626490210428102045625564642251, 11.67679887198860022579083306482062, 11.68734235344517635724059800850227, 11.69789535506240873985461803385988, 11.70845788543645582535646099131554, 11.71902995317124585028523142682388, 11.72961156687846973056821298087016, 11.74020273517758639059138658922166, 11.75080346669585473762253968743607, 11.76141377006831234552919340785593, 11.77203365393779144199015718186274, 11.78266312695494022477760154288262, 11.79330219777820687454550352413207, 11.80395087507385731839804066112265, 11.81460916751599476981482439441606, 11.82527708378654196508250606711954, 11.83595463257526070322001032764092, 11.84664182257977493861744733294472, 11.85733866250554235932668234454468, 11.86804516106589169055496313376352, 11.87876132698201914195124118123204, 11.88948716898299551303352927789092, 11.90022269580576619318890152499080, 11.91096791619517603066924493759871, 11.92172283890396222716390184359625, 11.93248747269275611415650928393006, 11.94326182633011868006178701762110, 11.95404590859251037215926771750674, 11.96483972826432307101640617474914, 11.97564329413788364320225809933618, 11.98645661501345394128748012008145, 11.99727969969923613291484798537567, 12.00811255701140467522236576769501, 12.01895519577407434042015665909275, 12.02980762481933219021357217570767, 12.04066985298725178665790735976771, 12.05154188912587720494684617733583, 12.06242374209124079698085552081466, 12.07331542074738273129241861170158, 12.08421693396633500583448039833456, 12.09512829062814276426252035889775, 12.10604949962087850678926770342514, 12.11698056984063143204366497229785, 12.12792151019152164792558323824778, 12.13887232958571793517421610886231, 12.14983303694342886558388272533193, 12.16080364119291701285874296445400, 12.17178415127051671618119144113734, 12.18277457612061986935714230639860, 12.19377492469569546074126265011728, 12.20478520595630733680536650354043, 12.21580542887109643857002083677799, 12.22683560241680744695713656255975, 12.23787573557829588821732613723725, 12.24892583734852280485938536003232, 12.25998591672856719014816917479038, 12.27105598272764730438666447298601, 12.28213604436310646406127489171922, 12.29322611066042725269653601571918, 12.30432619065325461349402758060023, 12.31543629338338163847765827085823, 12.32655642790075845027786272112280, 12.33768660326352595291155012091622, 12.34882682853798918642951321089640, 12.35997711279863864319850108586252, 12.37113746512817158418329199776053, 12.38230789461747605173513875342906, 12.39348841036564330408964451635256, 12.40467902147999978978987201116979, 12.41587973707607694962007371941581, 12.42709056627764141467196168377995, 12.43831151821670921719942271010950, 12.44954260203352625069328496465459, 12.46078382687659669159074837807566, 12.47203520190269543377326044719666, 12.48329673627685210135496163275093, 12.49456843917237414132159756263718, 12.50585031977086103438523423392326, 12.51714238726219363684322161134332, 12.52844465084455016778974822955206, 12.53975711972442397268423519562930, 12.55107980311660931249662098707631, 12.56241271024422800905995245557278, 12.57375585033873122142722422722727, 12.58510923263990122222821810282767, 12.59647286639585850309686065884307, 12.60784676086309197273749305168167, 12.61923092530643053521544061368331, 12.63062536899907151166644325712696, 12.64203010122259662750821007648483, 12.65344513126695780158570414641872, 12.66487046843049313338269712403417, 12.67630612201994999566068145213649, 12.68775210135046727089047635672614, 12.69920841574559489117746124975383, 12.71067507453731160182996973162517, 12.72215208706601252686141378944740, 12.73363946268052693255867779953405, 12.74513721073813599105051252990961, 12.75664534060455679309598053805530, 12.76816386165396721708020777441561, 12.77969278326901658715541998390108, 12.79123211484081856781358510488644, 12.80278186576896537474112847121432, 12.81434204546154731474416621495038, 12.82591266333513679853695066412911, 12.83749372881480965702394314575940, 12.84908525133416823393872618908063, 12.86068724033531296413457312155515, 12.87229970526887612436439667362720, 12.88392265559403426777862478047609, 12.89555610077849223671364597976208, 12.90720005029850092626020341413096, 12.91885451363888570597282523522153, 12.93051950029301799816039419965819, 12.94219501976284725230925687355921, 12.95388108155890982686742063378915, 12.96557769520032010746035666670650, 12.97728487021478471774571517016739, 12.98900261613863094112275575753301, 13.00073094251677829902291705366224, 13.01246985890276874897608649916947, 13.02421937485878267182215495267883, 13.03597949995561933178578328806907, 13.04775024377272352182899339823052, 13.05953161589819977450588339706883, 13.07132362592879992746475181775168, 13.08312628346993733430281281471252, 13.09493959813571528627562656765804, 13.10676357954890391965818707831204, 13.11859823734095797931331617292017, 13.13044358115205056947161210700870, 13.14229962063103585023782216012478, 13.15416636543549167015498824184760, 13.16604382523171956620444689178839, 13.17793200969473943473531107883900, 13.18983092850830907138970360392705, 13.20174059136494193467115110252053, 13.21366100796588938237619004212320, 13.22559218802116376423327892553061, 13.23753414124955440911435289308429, 13.24948687737862051960746612166986, 13.26145040614469827744414942571893, 13.27342473729292926520884066121653, 13.28540988057724270277049072319642, 13.29740584576037498720779694849625, 13.30941264261389100909127591876313, 13.32143028091816461255803005769849, 13.33345877046240168795065983431414, 13.34549812104465971174249716568738, 13.35754834247182998296921141445637, 13.36960944455966071586772159207612, 13.38168143713277302708775096107274, 13.39376433002464850119395123329014, 13.40585813307764695423429657239467, 13.41796285614302775002215639688075, 13.43007850908093558928158017806709, 13.44220510176041472050201264210045, 13.45434264405943203257720597321168, 13.46649114586486817302102281246334, 13.47865061707252110068111505825073, 13.49082106758714694194623007206246, 13.50300250732242268725258327322081, 13.51519494620098704729116434464231, 13.52739839415444222936457663308829, 13.53961286112334860831651894841343, 13.55183835705724426645701896632090, 13.56407489191466098077398783061653, 13.57632247566311356479218375170603, 13.58858111827911052671424840809777, 13.60085082974818782020065555116162, 13.61313162006488219901712000137195, 13.62542349923275253331667045131326, 13.63772647726441000770591926993802, 13.65004056418148614682195329805836, 13.66236577001466656611228245310485, 13.67470210480370340633271553087980, 13.68704957859740289904948440380394, 13.69940820145364668292131682392210, 13.71177798343940779091099102515727, 13.72415893463073821578745992155746, 13.73655106511278667369424510980025, 13.74895438497982347314518847269937, 13.76136890433521564602870057569817, 13.77379463329146069838770927162841, 13.78623158197019193949017790146172, 13.79867976050217315275858709355816, 13.81113917902731635933832876617089, 13.82360984769470135802293953020126, 13.83609177666255618532886728644371, 13.84858497609828731356174102984369, 13.86108945617848853260056785074994, 13.87360522708893384447037533391267, 13.88613229902459167419692676048726, 13.89867068218964973880247271154076, 13.91122038679749906009419646579772, 13.92378142307074817551892920164391, 13.93635380124125155987258040113375, 13.94893753155009008537490444723517, 13.96153262424759233795157342683524, 13.97413908959335238080257113324478, 13.98675693785621554354747786419466, 13.99938617931430329122122202534229, 14.01202682425502565877195593202487, 14.02467888297507236927685880800709, 14.03734236578042704479685198748484, 14.05001728298639562808602931909263, 14.06270364491758328995274496264756, 14.07540146190791752189852559240535, 14.08811074430067122875698260031641, 14.10083150244843963605489989276975, 14.11356374671317226443534309510142, 14.12630748746618181144185655284673, 14.13906273508813704609110573073849, 14.15182949996907879608443181496114, 14.16460779250843771137624571565539, 14.17739762311503071146034926641732, 14.19019900220706453808361402479932, 14.20301194021216950602592987706885, 14.21583644756738173953181103570387, 14.22867253471915560680827184114605, 14.24152021212339569444793596630916, 14.25437949024543016207644541282207, 14.26725037956004094041873031528667, 14.28013289055147971851056354353204, 14.29302703371345018013016670010984, 14.30593281954913464915080112405121, 14.31885025857120830039548309287056, 14.33177936130182850149594742106274, 14.34472013827265080010420206235722, 14.35767260002485734560195851372555, 14.37063675710913202010488021187484, 14.38361262008568708381517353700474, 14.39660019952428093858998181531206, 14.40959950600420569344350951723754, 14.42261055011430315175857685972005, 14.43563334245299145663921080995351, 14.44866789362824377462857228238136, 14.46171421425761494106154714245349, 14.47477231496825567091946140863001, 14.48784220639690012433220545062795, 14.50092389918989077557398559292778, 14.51401740400319084756119991652668, 14.52712273150237543006824125768617, 14.54023989236264924329589121043682, 14.55336889726886795415339292958379, 14.56650975691552574176057532895356, 14.57966248200676950830256828339770, 14.59282708325642730073923303280026, 14.60600357138798344180941057857126, 14.61919195713460872809719148790464, 14.63239225123917819360030989628285, 14.64560446445425512251858890522271, 14.65882860754210881282233458478004, 14.67206469127473944524808757705614, 14.68531272643386387244390789419413, 14.69857272381093160618092952063307, 14.71184469420714968634911201661453, 14.72512864843346491738884651567787, 14.73842459731058696092986792791635, 14.75173255166900787571648834273219, 14.76505252234898435403920302633196, 14.77838452020056614344412082573399, 14.79172855608360670487400057027116, 14.80508464086775965995457227109000, 14.81845278543248412006505532190204, 14.83183300066708376618862530449405, 14.84522529747068020355982298497111, 14.85862968675223072523294831626117, 14.87204617943056383921884844312444, 14.88547478643434729406180849764496, 14.89891551870212005326266080373898, 14.91236838718231183520401827991009, 14.92583340283322357322504103649408, 14.93931057662305228461718797916546, 14.95279991952990883419261081144214, 14.96630144254180549978627823293209, 14.97981515665667551218120934208855, 14.99334107288239970046106463996693, 15.00687920223677807030071562621742, 15.02042955574756355474619340384379, 15.03399214445248155413992208195850, 15.04756697939920506712496717227623, 15.06115407164538666506814479362220, 15.07475343225867625562841567443684, 15.08836507231670154283165175002068, 15.10198900290709467242322716629133, 15.11562523512751354815009108278900, 15.12927378008562051547869486967102, 15.14293464889910900694758311146870, 15.15660785269572485844946641009301, 15.17029340261324854566282738232985, 15.18399130979951472397715406259522, 15.19770158541244242655920970719308, 15.21142424062000486628676299005747, 15.22515928660026673924221540801227, 15.23890673454139310649679828202352, 15.25266659564164406504005455644801, 15.26643888110938362956403580028564, 15.28022360216311881231376901268959, 15.29402077003146409595046861795709, 15.30783039595317696068832447053865, 15.32165249117717920057657465804368, 15.33548706696252850179007509723306, 15.34933413457845574612292693927884, 15.36319370530437922184319177176803, 15.37706579042988686012449761619791, 15.39095040125476110404179053148255, 15.40484754908900022485340741695836, 15.41875724525280233478952141012996, 15.43267950107658670333421468967572, 15.44661432790101684986439067870378, 15.46056173707698455643821944249794, 15.47452173996562585500669229077175, 15.48849434793835477819357038242742, 15.50247957237683671394279372179881, 15.51647742467301149815739336190745, 15.53048791622912361276576120872051, 15.54451105845769554036905901739374, 15.55854686278155796230748819652945, 15.57259534063386574587184441043064, 15.58665650345808906251932057784870, 15.60073036270802404601454327348620, 15.61481692984782654320952133275568, 15.62891621635199079776157304877415, 15.64302823370536899005855957511812, 15.65715299340320143528515473008156, 15.67129050695109171442709339316934, 15.68544078586502799055324430810288, 15.69960384167141853595239808782935, 15.71377968590706331042383681051433, 15.72796833011917350120256742229685, 15.74216978586540705009610974229872, 15.75638406471384023177506605861709, 15.77061117824299962819623033283278, 15.78485113804187456310046400176361, 15.79910395570990822022849897621199, 15.81336964285701363053249224321917, 15.82764821110360742295597447082400, 15.84193967208057962636758020380512, 15.85624403742932209127047826768830, 15.87056131880175513515496277250350, 15.88489152786030444985954090952873, 15.89923467627792597056668455479667, 15.91359077573813074479858187260106, 15.92795983793496539249190391274169, 15.94234187457303164592303801327944, 15.95673689736752187684487580554560, 15.97114491804418534570686460938305, 15.98556594833936017607811663765460, 16.00000000000000000000000000000000, 16.01444708478364020720619009807706, 16.02890721445846367032572743482888, 16.04338040080324034875047800596803, 16.05786665560740189562238811049610, 16.07236599067103810511980555020273, 16.08687841780484362175229762215167, 16.10140394883023162719837273471057, 16.11594259557926633874558319803327, 16.13049436989468077285891922656447, 16.14505928362992648317231214605272, 16.15963734864915579692024039104581, 16.17422857682720760408301430288702, 16.18883298004967130623299453873187, 16.20345057021286905296619806904346, 16.21808135922383087290654657408595, 16.23272535900037638612047885544598, 16.24738258147107572426648403052241, 16.26205303857524953059510153252631, 16.27673674226302225065410311799496, 16.29143370449531147414745646528900, 16.30614393724380661865325237158686, 16.32086745249103287846992316190153, 16.33560426223033701376152748707682, 16.35035437846586603427567752078176, 16.36511781321263470090343616902828, 16.37989457849650420939724426716566, 16.39468468635417153222988417837769, 16.40948814883322270929966180119663, 16.42430497799212929521672776900232, 16.43913518590021993759364704601467, 16.45397878463774787860529613681138, 16.46883578629587674413414788432419, 16.48370620297665567477451986633241, 16.49859004679309748553350800648332, 16.51348732986914313869419856928289, 16.52839806433965463838831055909395, 16.54332226235048608486977173015475, 16.55825993605845170009160938207060, 16.57321109763131516956491395831108, 16.58817575924785714391873625572771, 16.60315393309785392261801462154835, 16.61814563138205969039518095087260, 16.63315086631227757152373669669032, 16.64816965011133120810882246587425, 16.66320199501305765465986041817814, 16.67824791326236422150941507425159, 16.69330741711521781667215691413730, 16.70838051883862007684911077376455, 16.72346723071068552712858945596963, 16.73856756502060250113572692498565, 16.75368153406863669374615710694343, 16.76880915016618800450487469788641, 16.78395042563577277405784116126597, 16.79910537281099536244255432393402, 16.81427400403664051964369718916714, 16.82945633166863430574267113115638, 16.84465236807402277463552309200168, 16.85986212563105368644755799323320, 16.87508561672915874396494473330677, 16.89032285376891451278424938209355, 16.90557384916213123915440519340336, 16.92083861533182798098096100147814, 16.93611716471220418611665081698447, 16.95140950974872140477600623853505, 16.96671566289807842053960484918207, 16.98203563662819348678567621391267, 16.99736944341826827553632028866559, 17.01271709575877366660279221832752, 17.02807860615143198401710833422840, 17.04345398710928094487826456315815, 17.05884325115665944849752122536302, 17.07424641082917915468897263053805, 17.08966347867380619618415948934853, 17.10509446724883630963631730992347, 17.12053938912386996662462479434907, 17.13599825687989053335513744968921, 17.15147108310924295437871478497982, 17.16695788041560888359526870772243, 17.18245866141408129124101833440363, 17.19797343873114670032009598799050, 17.21350222500465676489511679392308, 17.22904503288390998250179109163582, 17.24460187502962327243949403055012, 17.26017276411391776491655036807060, 17.27575771282038274989645287860185, 17.29135673384406501895682595204562, 17.30696983989144399629367399029434, 17.32259704368049568756759981624782, 17.33823835794068912719012587331235, 17.35389379541294729847322741989046, 17.36956336884973950418498134240508, 17.38524709101503518127174174878746, 17.40094497468431455899917636997998, 17.41665703264461129151641216594726, 17.43238327769451245785603532567620, 17.44812372264412303479730326216668, 17.46387838031515471470811462495476, 17.47964726354089037840822129510343, 17.49543038516617343702819198369980, 17.51122775804747178085563064087182, 17.52703939505287067390781885478646, 17.54286530906203012136757024563849, 17.55870551296628079285255807917565, 17.57456001966859204799220606219023, 17.59042884208355062014561553951353, 17.60631199313743877610249910503626, 17.62220948576820589437375019770116, 17.63812133292545425433672789949924, 17.65404754757051364322251174598932, 17.66998814267640938169279252178967, 17.68594313122785877112619346007705, 17.70191252622132793703713105060160, 17.71789634066502472364845743868500, 17.73389458757885961404099361971021, 17.74990727999454165342285705264658, 17.76593443095554292199267365504056, 17.78197605351708077137118380051106, 17.79803216074619598430217592976987, 17.81410276572172435294305614661425, 17.83018788153427891529645421542227, 17.84628752128632811491115717217326, 17.86240169809217093188635772094131, 17.87853042507790846116222382988781, 17.89467371538153273036186874378473, 17.91083158215290183079559938050807, 17.92700403855370794303780712652951, 17.94319109775756260205525904893875, 17.95939277294997182821134629193693, 17.97560907732831836369769007433206, 17.99184002410192562138036009855568, 18.00808562649205768479987455066293, 18.02434589773186957017969689331949, 18.04062085106651025512292108032852, 18.05691049975307649333444715011865, 18.07321485706060926190730242524296, 18.08953393627016836830989632289857, 18.10586775067479692324923234991729, 18.12221631357950712981619290076196, 18.13857963830136910132750927004963, 18.15495773816946467604793724603951, 18.17135062652488741719025711063296, 18.18775831672080656176149204839021, 18.20418082212244570428083534352481, 18.22061815610706503321125637739897, 18.23707033206404304337411304004490, 18.25353736339484100881236372515559, 18.27001926351298521922217332758009, 18.28651604584415579779488325584680, 18.30302772382615117408022342715412, 18.31955431090886676770423946436495, 18.33609582055438025349758390802890, 18.35265226623692669249976461287588, 18.36922366144286300482235674280673, 18.38581001967077455105936678592116, 18.40241135443141473615469294600189, 18.41902767924772277297051914501935, 18.43565900765486986756513942964375, 18.45230535320024856105192156974226, 18.46896672944345496603091305587441, 18.48564314995636337357609590981156, 18.50233462832309783152595628052950, 18.51904117814001793362876924220473, 18.53576281301578632110249600373209, 18.55249954657136868263478390872478, 18.56925139243998046367778442800045, 18.58601836426718989514483837410808, 18.60280047571087891356000909581780, 18.61959774044123960834440367761999, 18.63641017214083106523503374774009, 18.65323778450456870814377907663584, 18.67008059123970653558899357449263, 18.68693860606589751682804489973933, 18.70381184271519003914363565854728, 18.72070031493200303884805180132389, 18.73760403647318995012938103172928, 18.75452302110802804691047640517354, 18.77145728261819712656688352581114, 18.78840683479785056420041655655950, 18.80537169145360465449812181759626, 18.82235186640449953188181098084897, 18.83934737348209154106370988301933, 18.85635822653042836805070692207664, 18.87338443940601351300756505224854, 18.89042602597791287166728579904884, 18.90748300012770144462592725176364, 18.92455537574945623191524646244943, 18.94164316674984149813099065795541, 18.95874638704807324529610923491418, 18.97586505057590144929235975723714, 18.99299917127768821956124156713486, 19.01014876311039358824928058311343, 19.02731384004353643035756249446422, 19.04449441605929038701106037478894, 19.06169050515245189103552547749132, 19.07890212133041885067541443277150, 19.09612927861327236200850165914744, 19.11337199103375539266380656044930, 19.13063027263723725468480552081019, 19.14790413748182018593979591969401, 19.16519359963828250670303532388061, 19.18249867319008927779577788896859, 19.19981937223344203857777756638825, 19.21715571087728235966096690390259, 19.23450770324324921034531143959612, 19.25187536346577132917445851489902, 19.26925870569203880222630687057972, 19.28665774408198174683093384373933, 19.30407249280834491855785017833114, 19.32150296605668060578864242415875, 19.33894917802530599715282733086497, 19.35641114292539555208350066095591, 19.37388887498096323724894318729639, 19.39138238842881989398847508709878, 19.40889169751867271429546235594898, 19.42641681651309326639420760329813, 19.44395775968750328388523485045880, 19.46151454133023506187782913912088, 19.47908717574253856241739413235337, 19.49667567723853522920762770809233, 19.51428006014529970002513437066227, 19.53190033880284914857838884927332, 19.54953652756412196822566329501569, 19.56718864079503461539388808887452, 19.58485669287448871500600944273174, 19.60254069819432842791684379335493, 19.62024067115942571604136901441962, 19.63795662618766968421368801500648, 19.65568857770992039490920433308929, 19.67343654017010834422762854956090, 19.69120052802520959289722668472677, 19.70898055574521379185171099379659, 19.72677663781321300007220997940749, 19.74458878872538036830519558861852, 19.76241702299093461192569520790130, 19.78026135513223593420661927666515, 19.79812179968475760460933088324964, 19.81599837119706464250157296191901, 19.83389108423088842414472310338169, 19.85179995336111247183907835278660, 19.86972499317574403221442480571568, 19.88766621827599934135832882020622, 19.90562364327627165039302781224251, 19.92359728280412767276175145525485, 19.94158715150036442764758248813450, 19.95959326401900923997345671523362, 19.97761563502727710783801740035415, 19.99565427920566662578494288027287, 20.01370921124793156309351616073400, 20.03178044586105954749655211344361, 20.04986799776535022488133108709008, 20.06797188169439749572120490483940, 20.08609211239505754065248765982687, 20.10422870462754474374378332868218, 20.12238167316539971807287656702101, 20.14055103279546443673098110593855, 20.15873679831796749795103096403182, 20.17693898454650636153928644489497, 20.19515760630801182173854613211006, 20.21339267844284393049747450277209, 20.23164421580476357576117152348161, 20.24991223326090050704806344583631, 20.26819674569185281143290922045708, 20.28649776799164783369633369147778, 20.30481531506773151818379119504243, 20.32314940184104301579282036982477, 20.34150004324599336769097135402262, 20.35986725423044418903373298235238, 20.37825104975578938137914519757032, 20.39665144479693736911940504796803, 20.41506845434227201963039988186210, 20.43350209339375567196839256212115, 20.45195237696689360973323346115649, 20.47041932009070919207260885741562, 20.48890293780783622423768974840641, 20.50740324517449408858738024719059, 20.52592025726045221745152957737446, 20.54445398914913312182761728763580, 20.56300445593757686424396524671465, 20.58157167273640908433662843890488, 20.60015565466994758025975897908211, 20.61875641687616322883513930719346, 20.63737397450665156384275178425014, 20.65600834272674291014482150785625, 20.67465953671544198755327670369297, 20.69332757166543146354342752601951, 20.71201246278315011295489966869354, 20.73071422528876794899588276166469, 20.74943287441615424882002116646618, 20.76816842541297702950942039024085, 20.78692089354067107365153788123280, 20.80569029407440950762975262477994, 20.82447664230320327760637155734003, 20.84327995352986206967216276098043, 20.86210024307097299356428266037256, 20.88093752625700361136296123731881, 20.89979181843225219949999882373959, 20.91866313495483709061772970017046, 20.93755149119678193869731330778450, 20.95645690254399440277666144538671, 20.97537938439623061981365026440471, 20.99431895216719468066912668291479, 21.01327562128450310297012038063258, 21.03224940718967417296880739741027, 21.05124032533819899981608614325523, 21.07024839119952019927950459532440, 21.08927362025702478831590269692242, 21.10831602800810458120395196601748, 21.12737562996414908411679789423943, 21.14645244165052062612630834337324, 21.16554647860662896619032835587859, 21.18465775638592774043900135438889, 21.20378629055586117146958713419735, 21.22293209669797775518418347928673, 21.24209519040789473365293815732002, 21.26127558729526967340461851563305, 21.28047330298389638869593909475952, 21.29968835311167296708845242392272, 21.31892075333058400588015501853079, 21.33817051930677877180642099119723, 21.35743766672055343747160804923624, 21.37672221126633331778066349215806, 21.39602416865274037149902142118663, 21.41534355460258964853892393875867, 21.43468038485284665739527554251254, 21.45403467515473749926968594081700, 21.47340644127369557736528804525733, 21.49279569898936514960041677113622, 21.51220246409566172474114864598960, 21.53162675240077916782865941058844, 21.55106857972713285676036321092397, 21.57052796191146981641395541373640, 21.59000491480483674422430340200663, 21.60949945427255158847401617094874, 21.62901159619429591884909314103425, 21.64854135646409716287053015548736, 21.66808875099028242061649507377297, 21.68765379569559925698740698862821, 21.70723650651715530557339661754668, 21.72683689940641826865430630277842, 21.74645499032929762961430242285132, 21.76609079526611978394612378906459, 21.78574433021159606482797244098037, 21.80541561117492932453387766145170, 21.82510465417976419644219276960939, 21.84481147526419064774927392136306, 21.86453609048080082288834091741592, 21.88427851589669970167051360476762, 21.90403876759344825586595106869936, 21.92381686166717358332789444830269, 21.94361281422853338085587893147022, 21.96342664140269462791366095189005, 21.98325835932942240447118820156902, 22.00310798416305502200884802732617, 22.02297553207248270723539462778717, 22.04286101924122576178888266440481, 22.06276446186742745680930966045707, 22.08268587616380784766079159453511, 22.10262527835777746076928451657295, 22.12258268469138400291740254033357, 22.14255811142131236124441784340888, 22.16255157481896276294719427824020, 22.18256309117042945899811456911266, 22.20259267677646519700829230714589, 22.22264034795259490806529356632382, 22.24270612102906241602795489598066, 22.26279001235081977938534691929817, 22.28289203827762321452610194683075, 22.30301221518399401588794717099518, 22.32315055945920434510298946406692, 22.34330708750735894341232778970152, 22.36348181574738447352501680143178, 22.38367476061297978162656363565475, 22.40388593855272958421664952766150, 22.42411536603007604639969940762967, 22.44436305952327614932073629461229, 22.46462903552551182428942411206663, 22.48491331054485442564327968284488, 22.50521590110424696717927872668952, 22.52553682374158583456846827175468, 22.54587609500969946907389385160059, 22.56623373147633060398220550268888, 22.58660974972421442430459137540311, 22.60700416635105725049470493104309, 22.62741699796952232759394973982126, 22.64784826120730087950505549088120, 22.66829797270710855627839919179678, 22.68876614912664280154785956256092, 22.70925280713868232851382344961166, 22.72975796343106580366111302282661, 22.75028163470664921419484016951174, 22.77082383768341955487812811043113, 22.79138458909445574818164459429681, 22.81196390568790732800152909476310, 22.83256180422708681021504162345082, 22.85317830149043771825745352543890, 22.87381341427152037226733227726072, 22.89446715937909360150115389842540, 22.91513955363709698076490894891322, 22.93583061388462240870467212516814, 22.95654035697599937293489347212017, 22.97726879978078429189736198168248, 22.99801595918371788229705998674035, 23.01878185208483529322620597667992, 23.03956649539942347360010899137706, 23.06036990605801051401613221969455, 23.08119210100644380645462661050260, 23.10203309720588293885157327167690, 23.12289291163274640439340146258473, 23.14377156127883594649574661161751, 23.16466906315128682081194710917771, 23.18558543427256068980568670667708, 23.20652069168051667702457052655518, 23.22747485242840781438644626177847, 23.24844793358484196232893737033010, 23.26943995223387773307877068873495, 23.29045092547500317436970362905413, 23.31148087042310024230573617387563, 23.33252980420855493548515369184315, 23.35359774397720755700902373064309, 23.37468470689035271448119601700455, 23.39579071012481037428187846671790, 23.41691577087291875614027958363295, 23.43805990634249170057046285364777, 23.45922313375693235570906836073846, 23.48040547035517988661013077944517, 23.50160693339170947524507937487215, 23.52282754013661758563102921471000, 23.54406730787558998940767196472734, 23.56532625390988044955520308576524, 23.58660439555640664366364944726229, 23.60790175014772174222343892324716, 23.62921833503198953962964878883213, 23.65055416757307682473765453323722, 23.67190926515052851186737825628370, 23.69328364515954987723489466588944, 23.71467732501107761322600708808750, 23.73609032213179048653728386852890, 23.75752265396403828390248236246407, 23.77897433796598392063970095477998, 23.80044539161153949180516065098345, 23.82193583239035206133848987519741, 23.84344567780791734890044608619064, 23.86497494538551933374037616886199, 23.88652365266023736012357403524220, 23.90809181718501363889117783401161, 23.92967945652865324746016995050013, 23.95128658827576728640451619867235, 23.97291323002690077714760263916105, 23.99455939939848292397073237225413, 24.01622511402280935044473153539002, 24.03791039154814157541295571718365, 24.05961524963867148585450195241719, 24.08133970597450357331581471953541, 24.10308377825174730446633475366980, 24.12484748418248869938906864263117, 24.14663084149476546258483722340316, 24.16843386793266290624160319566727, 24.19025658125629263395239831879735, 24.21209899924175701357853540685028, 24.23396113968125575865997234359384, 24.25584302038305040127852407749742, 24.27774465917143587034843221772462, 24.29966607388685062574040784966201, 24.32160728238584113114484352990985, 24.34356830254103343236238288227469, 24.36554915224123263328692701179534, 24.38754984939139802690988290123641, 24.40957041191261467361073300708085, 24.43161085774218577171268407255411, 24.45367120483362199934163072612137, 24.47575147115659177643465227447450, 24.49785167469703850429141311906278, 24.51997183345714148572369595058262, 24.54211196545529460877332894597203, 24.56427208872620582269519218243659, 24.58645222132086161082042963244021, 24.60865238130650922698805516120046, 24.63087258676675617152795894071460, 24.65311285580152400598308304324746, 24.67537320652705190582310024183244, 24.69765365707597126743166882079095, 24.71995422559728439182435977272689, 24.74227493025634316836658399552107, 24.76461578923494499804291990585625, 24.78697682073129371360664663370699, 24.80935804295999957957974402233958, 24.83175947415214679381278983782977, 24.85418113255528993477128096856177, 24.87662303643341843439884542021900, 24.89908520406704539595921232830733, 24.92156765375320048860885435715318, 24.94407040380539086754652089439332, 24.96659347255369709728256566450000, 24.98913687834475538807055272627622, 25.01170063954172206877046846784651, 25.03428477452438016825908562168479, 25.05688930168910744100685406010598, 25.07951423944884794536847039125860, 25.10215960623321151956588437315077, 25.12482542048846312354726251214743, 25.14751170067746244285444845445454, 25.17021846527979178631539980415255, 25.19294573279172766433475771918893, 25.21569352172618394547498610336334, 25.23846185061285396500352362636477, 25.26125073799815012876024411525577, 25.28406020244519325501642015296966, 25.30689026253390494503037189133465, 25.32974093686099337219275184907019, 25.35261224403989999132136290427297, 25.37550420270092743635359511245042, 25.39841683149119688778228010050952, 25.42135014907462320365993946325034, 25.44430417413201794829546997789294, 25.46727892536106097054471320006996, 25.49027442147627198210102505981922, 25.51329068120910648076460347510874, 25.53632772330794153958777314983308, 25.55938556653803317431083996780217, 25.58246422968163003019981260877103, 25.60556373153793785490961454343051, 25.62868409092309462948833242990077, 25.65182532667026293893286492675543, 25.67498745762962641947524389252067, 25.69817050266833646787745237816125, 25.72137448067061882284178864210844, 25.74459941053775935415615094825625, 25.76784531118806853555724956095219, 25.79111220155697381528625555802137, 25.81440010059700895794776442926377, 25.83770902727777141194565047044307, 25.86103900058602889089343079831451, 25.88439003952570161004587134812027, 25.90776216311781965373484126757830, 25.93115539040063310949335573241115, 25.95456974042958009363246674183756, 25.97800523227726188224551151506603, 26.00146188503354949261847650632262, 26.02493971780554460337953059934080, 26.04843874971756534364430990535766, 26.07195899991123155814420897513628, 26.09550048754545414908534439746290, 26.11906323179639954901176679413766, 26.14264725185759274950214603450149, 26.16625256693988532674666203092784, 26.18987919627143057255125313531607, 26.21352715909779718117533775512129, 26.23719647468192661676766874734312, 26.26088716230410113894322421401739, 26.28459924126206459504828671924770, 26.30833273087099044573733408469707, 26.33208765046343913240889378357679, 26.35586401938947176404326455667615, 26.37966185701662524820676480885595, 26.40348118272988386934230220504105, 26.42732201593177165932502248324454, 26.45118437604233463389391545206308, 26.47506828249910881822870578616858, 26.49897375475723393378757464233786, 26.52290081228940366031565645243973, 26.54684947458585853041768132243305, 26.57081976115447830011362384539098, 26.59481169152076063255663029849529, 26.61882528522778201818255183752626, 26.64286056183632211968870251439512, 26.66691754092481403404235607013106, 26.69099624208931942348499433137476, 26.71509668494365286051106522791088, 26.73921888911932853716280078515410, 26.76336287426554605417550192214549, 26.78752866004928634424686606507748, 26.81171626615530101389595074579120, 26.83592571228605550004431279376149, 26.86015701816186407313580275513232, 26.88441020352083654643138288520277, 26.90868528811886406515441194642335, 26.93298229172972568790100922342390, 26.95730123414505285950326651800424, 26.98164213517429388389246014412493, 27.00600501464483826907780894543976, 27.03038989240198120000968629028648, 27.05479678830888445872915326617658, 27.07922572224669011120568029582500, 27.10367671411449563834139553364366, 27.12814978382932196154797566123307, 27.15264495132621647144333110190928, 27.17716223655822815885585441719741, 27.20170165949637564040131110232323, 27.22626324012975373989320360124111, 27.25084699846551572477437730412930, 27.27545295452882001541183853987604, 27.30008112836296518821654899511486, 27.32473154002934023765192250721157, 27.34940420960740681266543106175959, 27.37409915719479869267161120660603, 27.39881640290730402398367004934698, 27.42355596687881558182198205031455, 27.44831786926146932614756224211305, 27.47310213022558400552952662110329, 27.49790876995964694629037694539875, 27.52273780867042418663004355039448, 27.54758926658292850220277614425868, 27.57246316394038387898035580292344, 27.59735952100433564737613778561354, 27.62227835805463982410401513334364, 27.64721969538940271604587906040251, 27.67218355332510526523037697188556, 27.69716995219658173255083966068923, 27.72217891235697706520113570149988, 27.74721045417785703079971426632255, 27.77226459804919045382121112197638, 27.79734136437929947760494542308152, 27.82244077359498746204735653009266, 27.84756284614150345646521600428969, 27.87270760248250311974516080226749, 27.89787506310017306532245129346848, 27.92306524849519178133050445467234, 27.94827817918670476160514226648957, 27.97351387571242398166759812738746, 27.99877235862861368786980165168643, 28.02405364851005131754391186404973, 28.04935776595013408041268121451139, 28.07468473156086119502106157597154, 28.10003456597279125617205863818526, 28.12540728983515947447813232429326, 28.15080292381584570193808758631349, 28.17622148860134245751396520063281, 28.20166300489687216668244218453765, 28.22712749342635163429804379120469, 28.25261497493236362288371310569346, 28.27812547017626698675485386047512, 28.30365899993816469759622123092413, 28.32921558501687542275249143131077, 28.35479524623005076477966213133186, 28.38039800441413618159458565060049, 28.40602388042433901205185975413769, 28.43167289513475637363626447040588, 28.45734506943832187175758008379489, 28.48304042424679138889587193261832, 28.50875898049085321872553322464228, 28.53450075912009253897849703207612, 28.56026578110295943702112708706409, 28.58605406742689325483297579921782, 28.61186563909827640372895984910429, 28.63770051714241660079096618574113, 28.66355872260364634485085844062269, 28.68944027654531225834944052621722, 28.71534520004971469120391702745110, 28.74127351421825693478240282274783, 28.76722524017138127305770467501134, 28.79320039904856187717996363062412, 28.81919901200840072874598263297230, 28.84522110022861340894451132044196, 28.87126668490598291327842161990702, 28.89733578725648044382978696376085, 28.92342842851523698755045188590884, 28.94954462993651134183892281726003, 28.97568441279379314323705330025405, 29.00184779837978865657532878685743, 29.02803480800638169512239983305335, 29.05424546300474020199544611386955, 29.08047978472530559201914002187550, 29.10673779453773590830678585916758, 29.13301951383104437809379305690527, 29.15932496401354967474617296829820, 29.18565416651285460147846606560051, 29.21200714277595622547778475563973, 29.23838391426922456162174057681113, 29.26478450247835638720061979256570, 29.29120892890850313960982020944357, 29.31765721508422473107202677056193, 29.34412938254947889049617515411228, 29.37062545286772063946045818738639, 29.39714544762187387050289544276893, 29.42368938841429937269822403322905, 29.45025729686692272935033543035388, 29.47684919462118458000077225733548, 29.50346510333801575143297668546438, 29.53010504469796160265104845166206, 29.55676904040113939231559925246984, 29.58345711216721340974800114054233, 29.61016928173550866176810814067721, 29.63690557086497889827114704530686, 29.66366600133416753237725060898811, 29.69045059494134974897860956843942, 29.71725937350447210860693303402513, 29.74409235886112767843769688624889, 29.77094957286868392998258059378713, 29.79783103740425076466635800898075, 29.82473677436462367040803655982018, 29.85166680566644004102272447198629, 29.87862115324611167466173355933279, 29.90559983905981766838522162288427, 29.93260288508360034143152006436139, 29.95963031331336168250345508567989, 29.98668214576479940092212927993387, 30.01375840447354548246039485093206, 30.04085911149513776763342320919037, 30.06798428890496310827984416391701, 30.09513395879839947610889794304967, 30.12230814329078398827732598874718, 30.14950686451735251125683134887367, 30.17673014463339242752226709853858, 30.20397800581419645027381193358451, 30.23125047025502709630018216557801, 30.25854756017123037281635333783925, 30.28586929779822511932252382393926, 30.31321570539144971689893282018602, 30.34058680522648643318461836315691, 30.36798261959904010609534452669322, 30.39540317082488485311841941438615, 30.42284848124000262714616837911308, 30.45031857320054058391178841702640, 30.47781346908278621299359656404704, 30.50533319128327747193907271139324, 30.53287776221877791726910800207406, 30.56044720432623762462753802537918, 30.58804154006291753375990083441138, 30.61566079190636457951768534258008, 30.64330498235435840115314931608737, 30.67097413392504634543911379296333, 30.69866826915692215038689028006047, 30.72638741060875844368638354353607, 30.75413158085976306210795883089304, 30.78190080250952931351093866396695, 30.80969509817800044970681483391672, 30.83751449050559401143800641875714, 30.86535900215318051209578698035330, 30.89322865580203369972878135740757, 30.92112347415395845473540248349309, 30.94904347993126236815442098304629, 30.97698869587670955638714076485485, 31.00495914475366276974455104209483, 31.03295484934603365445582312531769, 31.06097583245824722553152241744101, 31.08902211691538042259708163328469, 31.11709372556312303004233399406075, 31.14519068126773149174368882086128, 31.17331300691616746689760475419462, 31.20146072541605519745644414797425, 31.22963385969565308641904266551137, 31.25783243270397093738210969604552, 31.28605646741074863825815555173904, 31.31430598680640287057030946016312, 31.34258101390217277071315038483590, 31.37088157173006663924752501770854, 31.39920768334283707190479617565870, 31.42755937181411596270663721952587, 31.45593666023835410783249244559556, 31.48433957173081410019221948459744, 31.51276812942767335812277451623231, 31.54122235648600991453349706716835, 31.56970227608374912620092800352722, 31.59820791141980578231596155092120, 31.62673928571403791920602088794112, 31.65529642220721484591194894164801, 31.68387934416114859459412400610745, 31.71248807485865484068199293687940, 31.74112263760351027030992554500699, 31.76978305572059824157804541755468, 31.79846935255586259927440551109612, 31.82718155147626148959716374520212, 31.85591967586992012684277142398059, 31.88468374914607394998711242806166, 31.91347379473504375368975161109120, 31.94228983608836003327269281726331, 31.97113189667873101029726967681199, 32.00000000000000000000000000000000, 32.02889416956728041441238019615412, 32.05781442891692734065145486965775, 32.08676080160648069750095601193607, 32.11573331121480379124477622099221, 32.14473198134207621023961110040545, 32.17375683560968724350459524430335, 32.20280789766046325439674546942115, 32.23188519115853267749116639606655, 32.26098873978936154571783845312893, 32.29011856725985296634462429210544, 32.31927469729831159384048078209162, 32.34845715365441520816602860577404, 32.37766596009934261246598907746375, 32.40690114042573810593239613808692, 32.43616271844766174581309314817190, 32.46545071800075277224095771089196, 32.49476516294215144853296806104481, 32.52410607715049906119020306505263, 32.55347348452604450130820623598993, 32.58286740899062294829491293057799, 32.61228787448761323730650474317372, 32.64173490498206575693984632380307, 32.67120852446067402752305497415364, 32.70070875693173206855135504156351, 32.73023562642526940180687233805656, 32.75978915699300841879448853433132, 32.78936937270834306445976835675538, 32.81897629766644541859932360239327, 32.84860995598425859043345553800464, 32.87827037180043987518729409202933, 32.90795756927549575721059227362275, 32.93767157259175348826829576864839, 32.96741240595331134954903973266482, 32.99718009358619497106701601296663, 33.02697465973828627738839713856578, 33.05679612867930927677662111818790, 33.08664452470097216973954346030951, 33.11651987211690340018321876414120, 33.14642219526263033912982791662216, 33.17635151849571428783747251145542, 33.20630786619570784523602924309671, 33.23629126276411938079036190174520, 33.26630173262455514304747339338064, 33.29633930022266241621764493174851, 33.32640399002611530931972083635628, 33.35649582652472844301883014850318, 33.38661483423043563334431382827461, 33.41676103767724015369822154752910, 33.44693446142137105425717891193926, 33.47713513004120500227145384997129, 33.50736306813727338749231421388686, 33.53761830033237600900974939577281, 33.56790085127154554811568232253194, 33.59821074562199072488510864786804, 33.62854800807328103928739437833428, 33.65891266333726861148534226231277, 33.68930473614804554927104618400335, 33.71972425126210737289511598646641, 33.75017123345831748792988946661353, 33.78064570753782902556849876418710, 33.81114769832426247830881038680673, 33.84167723066365596196192200295627, 33.87223432942440837223330163396895, 33.90281901949744280955201247707009, 33.93343132579615684107920969836414, 33.96407127325638697357135242782533, 33.99473888683653655107264057733119, 34.02543419151754733320558443665504, 34.05615721230286396803421666845679, 34.08690797421856188975652912631631, 34.11768650231331889699504245072603, 34.14849282165835830937794526107609, 34.17932695734761239236831897869706, 34.21018893449767261927263461984694, 34.24107877824773993324924958869815, 34.27199651375978106671027489937842, 34.30294216621848590875742956995964, 34.33391576083121776719053741544485, 34.36491732282816258248203666880727, 34.39594687746229340064019197598100, 34.42700445000931352979023358784616, 34.45809006576781996500358218327165, 34.48920375005924654487898806110024, 34.52034552822783552983310073614120, 34.55151542564076549979290575720370, 34.58271346768813003791365190409124, 34.61393967978288799258734798058867, 34.64519408736099137513519963249564, 34.67647671588137825438025174662471, 34.70778759082589459694645483978093, 34.73912673769947900836996268481016, 34.77049418203007036254348349757493, 34.80188994936862911799835273995996, 34.83331406528922258303282433189452, 34.86476655538902491571207065135241, 34.89624744528824606959460652433336, 34.92775676063030942941622924990952, 34.95929452708178075681644259020686, 34.99086077033234687405638396739960, 35.02245551609494356171126128174365, 35.05407879010574134781563770957291, 35.08573061812406024273514049127698, 35.11741102593256158570511615835130, 35.14912003933718409598441212438047, 35.18085768416710124029123107902706, 35.21262398627487755220499821007252, 35.24441897153641178874750039540231, 35.27624266585090850867345579899848, 35.30809509514102728644502349197865, 35.33997628535281876338558504357934, 35.37188626245571754225238692015409, 35.40382505244265587407426210120320, 35.43579268133004944729691487737000, 35.46778917515771922808198723942041, 35.49981455998908330684571410529315, 35.53186886191108584398534731008112, 35.56395210703416154274236760102212, 35.59606432149239196860435185953975, 35.62820553144344870588611229322851, 35.66037576306855783059290843084455, 35.69257504257265622982231434434652, 35.72480339618434186377271544188261, 35.75706085015581692232444765977561, 35.78934743076306546072373748756945, 35.82166316430580366159119876101613, 35.85400807710741588607561425305903, 35.88638219551512520411051809787750, 35.91878554589994365642269258387387, 35.95121815465663672739538014866412, 35.98368004820385124276072019711137, 36.01617125298411536959974910132587, 36.04869179546373914035939378663898, 36.08124170213302051024584216065705, 36.11382099950615298666889430023730, 36.14642971412121852381460485048592, 36.17906787254033673661979264579713, 36.21173550134959384649846469983459, 36.24443262715901425963238580152392, 36.27715927660273820265501854009926, 36.30991547633892935209587449207902, 36.34270125304977483438051422126591, 36.37551663344161312352298409678042, 36.40836164424489140856167068704963, 36.44123631221413006642251275479794, 36.47414066412808608674822608008981, 36.50707472678968201762472745031118, 36.54003852702597043844434665516019, 36.57303209168831159558976651169360, 36.60605544765230234816044685430825, 36.63910862181773353540847892872989, 36.67219164110876050699516781605780, 36.70530453247385338499952922575176, 36.73844732288572600964471348561347, 36.77162003934154910211873357184231, 36.80482270886282947230938589200377, 36.83805535849544554594103829003870, 36.87131801530973973513027885928750, 36.90461070640049712210384313948452, 36.93793345888690993206182611174881, 36.97128629991272674715219181962311, 37.00466925664619566305191256105900, 37.03808235628003586725753848440945, 37.07152562603157264220499200746417, 37.10499909314273736526956781744957, 37.13850278487996092735556885600090, 37.17203672853437979028967674821615, 37.20560095142175782712001819163561, 37.23919548088247921668880735523999, 37.27282034428166213047006749548018, 37.30647556900913741628755815327168, 37.34016118247941307117798714898527, 37.37387721213179503365608979947865, 37.40762368543038007828727131709456, 37.44140062986400607769610360264778, 37.47520807294637990025876206345856, 37.50904604221605609382095281034708, 37.54291456523639425313376705162227, 37.57681366959570112840083311311901, 37.61074338290720930899624363519251, 37.64470373280899906376362196169794, 37.67869474696418308212741976603866, 37.71271645306085673610141384415329, 37.74676887881202702601513010449708, 37.78085205195582574333457159809768, 37.81496600025540288925185450352728, 37.84911075149891246383049292489886, 37.88328633349968299626198131591082, 37.91749277409614649059221846982837, 37.95173010115180289858471951447427, 37.98599834255537643912248313426971, 38.02029752622078717649856116622686, 38.05462768008707286071512498892844, 38.08898883211858077402212074957788, 38.12338101030490378207105095498264, 38.15780424266083770135082886554301, 38.19225855722654472401700331829488, 38.22674398206751078532761312089860, 38.26126054527447450936961104162037, 38.29580827496364037187959183938801, 38.33038719927656501340607064776123, 38.36499734638017855559155577793717, 38.39963874446688407715555513277650, 38.43431142175456471932193380780518, 38.46901540648649842069062287919223, 38.50375072693154265834891702979803, 38.53851741138407760445261374115944, 38.57331548816396349366186768747866, 38.60814498561668983711570035666227, 38.64300593211336121157728484831750, 38.67789835605061199430565466172993, 38.71282228585079110416700132191181, 38.74777774996192647449788637459278, 38.78276477685763978797695017419755, 38.81778339503734542859092471189797, 38.85283363302618653278841520659626, 38.88791551937500656777046970091760, 38.92302908266047012375565827824175, 38.95817435148507712483478826470673, 38.99335135447707045841525541618466, 39.02856012029059940005026874132454, 39.06380067760569829715677769854665, 39.09907305512824393645132659003139, 39.13437728159006923078777617774904, 39.16971338574897743001201888546348, 39.20508139638865685583368758670986, 39.24048134231885143208273802883923, 39.27591325237533936842737603001297, 39.31137715541984078981840866617858, 39.34687308034021668845525709912181, 39.38240105605041918579445336945355, 39.41796111149042758370342198759317, 39.45355327562642600014441995881498, 39.48917757745076073661039117723703, 39.52483404598186922385139041580260, 39.56052271026447186841323855333030, 39.59624359936951520921866176649928, 39.63199674239412928500314592383802, 39.66778216846177684828944620676339, 39.70359990672222494367815670557320, 39.73944998635148806442884961143136, 39.77533243655199868271665764041245, 39.81124728655254330078605562448502, 39.84719456560825534552350291050971, 39.88317430300072885529516497626901, 39.91918652803801847994691343046725, 39.95523127005455421567603480070829, 39.99130855841133325156988576054573, 40.02741842249586312618703232146800, 40.06356089172211909499310422688723, 40.09973599553070044976266217418015, 40.13594376338879499144240980967879, 40.17218422479011508130497531965375, 40.20845740925508948748756665736437, 40.24476334633079943614575313404202, 40.28110206559092887346196221187711, 40.31747359663593499590206192806363, 40.35387796909301272307857288978994, 40.39031521261602364347709226422012, 40.42678535688568786099494900554419, 40.46328843160952715152234304696321, 40.49982446652180101409612689167261, 40.53639349138370562286581844091415, 40.57299553598329566739266738295555, 40.60963063013546303636758239008486, 40.64629880368208603158564073964953, 40.68300008649198673538194270804524, 40.71973450846088837806746596470475, 40.75650209951157876275829039514065, 40.79330288959387473823881009593606, 40.83013690868454403926079976372421, 40.86700418678751134393678512424231, 40.90390475393378721946646692231297, 40.94083864018141838414521771483123, 40.97780587561567244847537949681282, 41.01480649034898817717476049438119, 41.05184051452090443490305915474892, 41.08890797829826624365523457527161, 41.12600891187515372848793049342930, 41.16314334547281816867325687780976, 41.20031130933989516051951795816422, 41.23751283375232645767027861438692, 41.27474794901330312768550356850028, 41.31201668545348582028964301571250, 41.34931907343088397510655340738595, 41.38665514333086292708685505203903, 41.42402492556630022590979933738708, 41.46142845057753589799176552332938, 41.49886574883230849764004233293235, 41.53633685082595405901884078048170, 41.57384178708134214730307576246560, 41.61138058814881901525950524955988, 41.64895328460640655521274311468005, 41.68655990705972413934432552196085, 41.72420048614194598712856532074511, 41.76187505251400722272592247463763, 41.79958363686450439899999764747918, 41.83732626990967418123545940034091, 41.87510298239356387739462661556900, 41.91291380508798880555332289077342, 41.95075876879246123962730052880943, 41.98863790433438936133825336582959, 42.02655124256900620594024076126516, 42.06449881437934834593761479482055, 42.10248065067639799963217228651047, 42.14049678239904039855900919064879, 42.17854724051404957663180539384484, 42.21663205601620916240790393203497, 42.25475125992829816823359578847885, 42.29290488330104125225261668674648, 42.33109295721325793238065671175718, 42.36931551277185548087800270877779, 42.40757258111172234293917426839471, 42.44586419339595551036836695857346, 42.48419038081578946730587631464005, 42.52255117459053934680923703126609, 42.56094660596779277739187818951905, 42.59937670622334593417690484784544, 42.63784150666116801176031003706157, 42.67634103861355754361284198239446, 42.71487533344110687494321609847248, 42.75344442253266663556132698431611, 42.79204833730548074299804284237325, 42.83068710920517929707784787751734, 42.86936076970569331479055108502507, 42.90806935030947499853937188163400, 42.94681288254739115473057609051466, 42.98559139797873029920083354227245, 43.02440492819132344948229729197919, 43.06325350480155833565731882117689, 43.10213715945426571352072642184794, 43.14105592382293963282791082747281, 43.18000982960967348844860680401325, 43.21899890854510317694803234189749, 43.25802319238859183769818628206849, 43.29708271292819432574106031097472, 43.33617750198056484123299014754593, 43.37530759139119851397481397725642, 43.41447301303431061114679323509336, 43.45367379881283653730861260555685, 43.49290998065859525922860484570265, 43.53218159053223956789224757812917, 43.57148866042319212965594488196075, 43.61083122234985864906775532290339, 43.65020930835952839288438553921878, 43.68962295052838129549854784272611, 43.72907218096160164577668183483183, 43.76855703179339940334102720953524, 43.80807753518689651173190213739872, 43.84763372333434716665578889660537, 43.88722562845706676171175786294043, 43.92685328280538925582732190378010, 43.96651671865884480894237640313804, 44.00621596832611004401769605465233, 44.04595106414496541447078925557435, 44.08572203848245152357776532880962, 44.12552892373485491361861932091415, 44.16537175232761569532158318907022, 44.20525055671555492153856903314590, 44.24516536938276800583480508066714, 44.28511622284262472248883568681777, 44.32510314963792552589438855648041, 44.36512618234085891799622913822532, 44.40518535355293039401658461429179, 44.44528069590518981613058713264763, 44.48541224205812483205590979196131, 44.52558002470163955877069383859634, 44.56578407655524642905220389366150, 44.60602443036798803177589434199035, 44.64630111891840869020597892813385, 44.68661417501471788682465557940304, 44.72696363149476894705003360286355, 44.76734952122595956325312727130949, 44.80777187710545916843329905532300, 44.84823073206015209279939881525934, 44.88872611904655229864147258922458, 44.92925807105102364857884822413325, 44.96982662108970885128655936568975, 45.01043180220849393435855745337903, 45.05107364748317166913693654350936, 45.09175219001939893814778770320117, 45.13246746295266120796441100537777, 45.17321949944842884860918275080621, 45.21400833270211450098940986208618, 45.25483399593904465518789947964251, 45.29569652241460175901011098176241, 45.33659594541421711255679838359356, 45.37753229825328560309571912512183, 45.41850561427736465702764689922333, 45.45951592686213160732222604565322, 45.50056326941329842838968033902347, 45.54164767536683910975625622086227, 45.58276917818891149636328918859363, 45.62392781137581465600305818952620, 45.66512360845417362043008324690163, 45.70635660298087543651490705087781, 45.74762682854304074453466455452144, 45.78893431875818720300230779685080, 45.83027910727419396152981789782643, 45.87166122776924481740934425033629, 45.91308071395199874586978694424033, 45.95453759956156858379472396336496, 45.99603191836743576459411997348070, 46.03756370416967058645241195335984, 46.07913299079884694720021798275411, 46.12073981211602102803226443938911, 46.16238420201288761290925322100520, 46.20406619441176587770314654335380, 46.24578582326549280878680292516947, 46.28754312255767189299149322323501, 46.32933812630257364162389421835542, 46.37117086854512137961137341335416, 46.41304138336103335404914105311036, 46.45494970485681562877289252355695, 46.49689586716968392465787474066019, 46.53887990446775546615754137746990, 46.58090185095000634873940725810826, 46.62296174084620048461147234775126, 46.66505960841710987097030738368630, 46.70719548795441511401804746128619, 46.74936941378070542896239203400910, 46.79158142024962074856375693343580, 46.83383154174583751228055916726589, 46.87611981268498340114092570729554, 46.91844626751386471141813672147691, 46.96081094071035977322026155889034, 47.00321386678341895049015874974430, 47.04565508027323517126205842941999, 47.08813461575117997881534392945468, 47.13065250781976089911040617153049, 47.17320879111281328732729889452457, 47.21580350029544348444687784649432, 47.25843667006397907925929757766426, 47.30110833514615364947530906647444, 47.34381853030105702373475651256740, 47.38656729031909975446978933177888, 47.42935465002215522645201417617500, 47.47218064426358097307456773705781, 47.51504530792807656780496472492814, 47.55794867593196784127940190955997, 47.60089078322307898361032130196691, 47.64387166478070412267697975039482, 47.68689135561583469780089217238128, 47.72994989077103866748075233772397, 47.77304730532047472024714807048440, 47.81618363437002727778235566802323, 47.85935891305730649492033990100026, 47.90257317655153457280903239734471, 47.94582646005380155429520527832210, 47.98911879879696584794146474450827, 48.03245022804561870088946307078004, 48.07582078309628315082591143436730, 48.11923049927734297170900390483439, 48.16267941194900714663162943907082, 48.20616755650349460893266950733960, 48.24969496836497739877813728526235, 48.29326168298953092516967444680631, 48.33686773586532581248320639133453, 48.38051316251258526790479663759470, 48.42419799848351402715707081370056, 48.46792227936251151731994468718767, 48.51168604076610080255704815499485, 48.55548931834287174069686443544924, 48.59933214777370125148081569932401, 48.64321456477168226228968705981970, 48.68713660508206686472476576454937, 48.73109830448246526657385402359068, 48.77509969878279605381976580247283, 48.81914082382522934722146601416171, 48.86322171548437154342536814510822, 48.90734240966724399868326145224273, 48.95150294231318355286930454894900, 48.99570334939407700858282623812556, 49.03994366691428297144739190116525, 49.08422393091058921754665789194405, 49.12854417745241164539038436487317, 49.17290444264172322164085926488042, 49.21730476261301845397611032240093, 49.26174517353351234305591788142920, 49.30622571160304801196616608649492, 49.35074641305410381164620048366487, 49.39530731415194253486333764158189, 49.43990845119456878364871954545379, 49.48454986051268633673316799104214, 49.52923157846988999608583981171250, 49.57395364146258742721329326741397, 49.61871608591999915915948804467916, 49.66351894830429358762557967565954, 49.70836226511057986954256193712354, 49.75324607286683686879769084043801, 49.79817040813409079191842465661466, 49.84313530750640097721770871430635, 49.88814080761078173509304178878665, 49.93318694510739419456513132900000, 49.97827375668951077614110545255244, 50.02340127908344413754093693569303, 50.06856954904876033651817124336958, 50.11377860337821488201370812021196, 50.15902847889769589073694078251719, 50.20431921246642303913176874630153, 50.24965084097692624709452502429485, 50.29502340135492488570889690890908, 50.34043693055958357263079960830510, 50.38589146558345532866951543837786, 50.43138704345236789094997220672667, 50.47692370122570793000704725272954, 50.52250147599630025752048823051155, 50.56812040489038651003284030593932, 50.61378052506780989006074378266931, 50.65948187372198674438550369814038, 50.70522448807979998264272580854595, 50.75100840540185487270719022490084, 50.79683366298239377556456020101905, 50.84270029814924640731987892650068, 50.88860834826403589659093995578587, 50.93455785072212194108942640013993, 50.98054884295254396420205011963844, 51.02658136241821296152920695021749, 51.07265544661588307917554629966617, 51.11877113307606634862167993560433, 51.16492845936326006039962521754205, 51.21112746307587570981922908686101, 51.25736818184618925897666485980153, 51.30365065334052587786572985351086, 51.34997491525925283895048778504133, 51.39634100533667293575490475632250, 51.44274896134123764568357728421688, 51.48919882107551870831230189651251, 51.53569062237613707111449912190437, 51.58222440311394763057251111604273, 51.62880020119401791589552885852754, 51.67541805455554282389130094088614, 51.72207800117205778178686159662902, 51.76878007905140322009174269624054, 51.81552432623563930746968253515661, 51.86231078080126621898671146482229, 51.90913948085916018726493348367512, 51.95601046455452376449102303013206, 52.00292377006709898523695301264524, 52.04987943561108920675906119868159, 52.09687749943513068728861981071532, 52.14391799982246311628841795027256, 52.19100097509090829817068879492581, 52.23812646359279909802353358827531, 52.28529450371518549900429206900299, 52.33250513387977065349332406185567, 52.37975839254286114510250627063215, 52.42705431819559436235067551024258, 52.47439294936385323353533749468625, 52.52177432460820227788644842803478, 52.56919848252412919009657343849540, 52.61666546174198089147466816939414, 52.66417530092687826481778756715357, 52.71172803877894352808652911335230, 52.75932371403325049641352961771190, 52.80696236545976773868460441008210, 52.85464403186354331865004496648908, 52.90236875208466926778783090412617, 52.95013656499821763645741157233715, 52.99794750951446786757514928467572, 53.04580162457880732063131290487945, 53.09369894917171706083536264486611, 53.14163952230895660022724769078195, 53.18962338304152126511326059699059, 53.23765057045556403636510367505252, 53.28572112367264423937740502879024, 53.33383508184962806808471214026213, 53.38199248417863884696998866274953, 53.43019336988730572102213045582175, 53.47843777823865707432560157030821, 53.52672574853109210835100384429097, 53.57505732009857268849373213015497, 53.62343253231060202779190149158239, 53.67185142457211100008862558752298, 53.72031403632372814627160551026464, 53.76882040704167309286276577040553, 53.81737057623772813030882389284670, 53.86596458345945137580201844684780, 53.91460246829010571900653303600848, 53.96328427034858776778492028824985, 54.01201002928967653815561789087951, 54.06077978480396240001937258057296, 54.10959357661776891745830653235316, 54.15845144449338022241136059165001, 54.20735342822899127668279106728733, 54.25629956765864392309595132246614, 54.30528990265243294288666220381856, 54.35432447311645631771170883439481, 54.40340331899275128080262220464647, 54.45252648025950747978640720248222, 54.50169399693103144954875460825861, 54.55090590905764003082367707975209, 54.60016225672593037643309799022973, 54.64946308005868047530384501442313, 54.69880841921481362533086212351918, 54.74819831438959738534322241321206, 54.79763280581460804796734009869397, 54.84711193375763116364396410062909, 54.89663573852293865229512448422611, 54.94620426045116801105905324220657, 54.99581753991929389258075389079750, 55.04547561734084837326008710078895, 55.09517853316585700440555228851736, 55.14492632788076775796071160584688, 55.19471904200867129475227557122707, 55.24455671610927964820803026668727, 55.29443939077880543209175812080503, 55.34436710665021053046075394377112, 55.39433990439316346510167932137847, 55.44435782471395413040227140299976, 55.49442090835571406159942853264511, 55.54452919609838090764242224395275, 55.59468272875859895520989084616303, 55.64488154718997492409471306018531, 55.69512569228300691293043200857937, 55.74541520496500623949032160453498, 55.79575012620034613064490258693695, 55.84613049699038356266100890934467, 55.89655635837340952321028453297913, 55.94702775142484796333519625477493, 55.99754471725722737573960330337286, 56.04810729702010263508782372809947, 56.09871553190026816082536242902279, 56.14936946312172239004212315194309, 56.20006913194558251234411727637053, 56.25081457967031894895626464858651, 56.30160584763169140387617517262697, 56.35244297720268491502793040126562, 56.40332600979374433336488436907530, 56.45425498685270326859608758240938, 56.50522994986472724576742621138692, 56.55625094035253397350970772095025, 56.60731799987632939519244246184826, 56.65843117003375084550498286262155, 56.70959049246010152955932426266372, 56.76079600882827236318917130120099, 56.81204776084867802410371950827539, 56.86334579026951274727252894081175, 56.91469013887664374351516016758978, 56.96608084849358277779174386523664, 57.01751796098170643745106644928455, 57.06900151824018507795699406415224, 57.12053156220591887404225417412817, 57.17210813485378650966595159843564, 57.22373127819655280745791969820857, 57.27540103428483320158193237148225, 57.32711744520729268970171688124537, 57.37888055309062451669888105243444, 57.43069040009942938240783405490220, 57.48254702843651386956480564549565, 57.53445048034276254611540935002267, 57.58640079809712375435992726124823, 57.63839802401680145749196526594460, 57.69044220045722681788902264088392, 57.74253336981196582655684323981404, 57.79467157451296088765957392752171, 57.84685685703047397510090377181768, 57.89908925987302268367784563452005, 57.95136882558758628647410660050809, 58.00369559675957731315065757371485, 58.05606961601276339024479966610670, 58.10849092600948040399089222773910, 58.16095956945061118403828004375100, 58.21347558907547181661357171833515, 58.26603902766208875618758611381054, 58.31864992802709934949234593659639, 58.37130833302570920295693213120103, 58.42401428555191245095556951127946, 58.47676782853844912324348115362227, 58.52956900495671277440123958513141, 58.58241785781700627921964041888714, 58.63531443016844946214405354112387, 58.68825876509895778099235030822456, 58.74125090573544127892091637477279, 58.79429089524374774100579088553786, 58.84737877682859874539644806645811, 58.90051459373384545870067086070776, 58.95369838924236916000154451467097, 59.00693020667603150286595337092876, 59.06021008939592320530209690332413, 59.11353808080227878463119850493968, 59.16691422433442681949600228108466, 59.22033856347101732353621628135443, 59.27381114172995779654229409061372, 59.32733200266833506475450121797621, 59.38090118988269949795721913687885, 59.43451874700894421721386606805027, 59.48818471772225535687539377249777, 59.54189914573736785996516118757427, 59.59566207480850152933271601796150, 59.64947354872924734081607311964035, 59.70333361133288008204544894397259, 59.75724230649222334932346711866558, 59.81119967811963533677044324576855, 59.86520577016720068286304012872279, 59.91926062662672336500691017135978, 59.97336429152959880184425855986774, 60.02751680894709096492078970186412, 60.08171822299027553526684641838074, 60.13596857780992621655968832783401, 60.19026791759679895221779588609934, 60.24461628658156797655465197749436, 60.29901372903470502251366269774735, 60.35346028926678485504453419707716, 60.40795601162839290054762386716902, 60.46250094051005419260036433115602, 60.51709512034246074563270667567849, 60.57173859559645023864504764787853, 60.62643141078289943379786564037204, 60.68117361045297286636923672631383, 60.73596523919808021219068905338645, 60.79080634164976970623683882877231, 60.84569696248000525429233675822616, 60.90063714640108116782357683405280, 60.95562693816557242598719312809408, 61.01066638256655494387814542278647, 61.06575552443755583453821600414813, 61.12089440865247524925507605075836, 61.17608308012583506751980166882277, 61.23132158381272915903537068516016, 61.28660996470871680230629863217473, 61.34194826785009269087822758592665, 61.39733653831384430077378056012094, 61.45277482121751688737276708707213, 61.50826316171952612421591766178608, 61.56380160501905862702187732793391, 61.61939019635600089941362966783345, 61.67502898101118802287601283751428, 61.73071800430636102419157396070659, 61.78645731160406739945756271481514, 61.84224694830791690947080496698618, 61.89808695986252473630884196609259, 61.95397739175341911277428152970970, 62.00991828950732553948910208418965, 62.06590969869206730891164625063539, 62.12195166491649445106304483488202, 62.17804423383076084519416326656938, 62.23418745112624606008466798812151, 62.29038136253546298348737764172256, 62.34662601383233493379520950838923, 62.40292145083211039491288829594851, 62.45926771939130617283808533102274, 62.51566486540794187476421939209104, 62.57211293482149727651631110347807, 62.62861197361280574114061892032623, 62.68516202780434554142630076967180, 62.74176314346013327849505003541708, 62.79841536668567414380959235131741, 62.85511874362823192541327443905175, 62.91187332047670821566498489119112, 62.96867914346162820038443896919489, 63.02553625885534671624554903246462, 63.08244471297201982906699413433671, 63.13940455216749825240185600705445, 63.19641582283961156463192310184240, 63.25347857142807583841204177588224, 63.31059284441442969182389788329601, 63.36775868832229718918824801221490, 63.42497614971730968136398587375879, 63.48224527520702054061985109001398, 63.53956611144119648315609083510935, 63.59693870511172519854881102219224, 63.65436310295252297919432749040425, 63.71183935173984025368554284796119, 63.76936749829214789997422485612333, 63.82694758947008750737950322218239, 63.88457967217672006654538563452661, 63.94226379335746202059453935362399, 64.00000000000000000000000000000000, 64.05778833913456082882476039230824, 64.11562885783385468130290973931551, 64.17352160321296139500191202387214, 64.23146662242960758248955244198442, 64.28946396268415242047922220081091, 64.34751367121937448700919048860669, 64.40561579532092650879349093884230, 64.46377038231706535498233279213309, 64.52197747957872309143567690625787, 64.58023713451970593268924858421087, 64.63854939459662318768096156418324, 64.69691430730883041633205721154809, 64.75533192019868522493197815492749, 64.81380228085147621186479227617383, 64.87232543689532349162618629634380, 64.93090143600150554448191542178392, 64.98953032588430289706593612208962, 65.04821215430099812238040613010526, 65.10694696905208900261641247197986, 65.16573481798124589658982586115599, 65.22457574897522647461300948634744, 65.28346980996413151387969264760613, 65.34241704892134805504610994830728, 65.40141751386346413710271008312702, 65.46047125285053880361374467611313, 65.51957831398601683758897706866264, 65.57873874541668612891953671351075, 65.63795259533289083719864720478654, 65.69721991196851718086691107600927, 65.75654074360087975037458818405867, 65.81591513855099151442118454724550, 65.87534314518350697653659153729677, 65.93482481190662269909807946532965, 65.99436018717238994213403202593327, 66.05394931947657255477679427713156, 66.11359225735861855355324223637581, 66.17328904940194433947908692061901, 66.23303974423380680036643752828240, 66.29284439052526067825965583324432, 66.35270303699142857567494502291083, 66.41261573239141569047205848619342, 66.47258252552823876158072380349040, 66.53260346524911028609494678676128, 66.59267860044532483243528986349702, 66.65280798005223061863944167271256, 66.71299165304945688603766029700637, 66.77322966846087126668862765654922, 66.83352207535448030739644309505820, 66.89386892284274210851435782387853, 66.95427026008241000454290769994259, 67.01472613627454677498462842777371, 67.07523660066475201801949879154563, 67.13580170254309109623136464506388, 67.19642149124398144977021729573607, 67.25709601614656207857478875666857, 67.31782532667453722297068452462554, 67.37860947229609109854209236800671, 67.43944850252421474579023197293282, 67.50034246691663497585977893322706, 67.56129141507565805113699752837420, 67.62229539664852495661762077361345, 67.68335446132731192392384400591254, 67.74446865884881674446660326793790, 67.80563803899488561910402495414019, 67.86686265159231368215841939672828, 67.92814254651277394714270485565066, 67.98947777367307310214528115466237, 68.05086838303509466641116887331009, 68.11231442460572793606843333691359, 68.17381594843712377951305825263262, 68.23537300462663779399008490145206, 68.29698564331671661875589052215219, 68.35865391469522478473663795739412, 68.42037786899534523854526923969388, 68.48215755649547986649849917739630, 68.54399302751956213342054979875684, 68.60588433243697181751485913991928, 68.66783152166243553438107483088970, 68.72983464565632516496407333761454, 68.79189375492458680128038395196199, 68.85400890001862705958046717569232, 68.91618013153563993000716436654329, 68.97840750011849308975797612220049, 69.04069105645567105966620147228241, 69.10303085128153099958581151440740, 69.16542693537626007582730380818248, 69.22787935956577598517469596117735, 69.29038817472198275027039926499128, 69.35295343176275650876050349324942, 69.41557518165178919389290967956185, 69.47825347539895801673992536962032, 69.54098836406014072508696699514985, 69.60377989873725823599670547991991, 69.66662813057844516606564866378903, 69.72953311077804983142414130270481, 69.79249489057649213918921304866672, 69.85551352126061885883245849981904, 69.91858905416356151363288518041372, 69.98172154066469374811276793479919, 70.04491103218988712342252256348729, 70.10815758021148269563127541914582, 70.17146123624812048547028098255396, 70.23482205186512317141023231670260, 70.29824007867436819196882424876094, 70.36171536833420248058246215805411, 70.42524797254975510440999642014503, 70.48883794307282357749500079080462, 70.55248533170181701734691159799695, 70.61619019028205457289004698395729, 70.67995257070563752677117008715868, 70.74377252491143508450477384030819, 70.80765010488531174814852420240641, 70.87158536266009889459382975474000, 70.93557835031543845616397447884083, 70.99962911997816661369142821058631, 71.06373772382217168797069462016225, 71.12790421406832308548473520204425, 71.19212864298478393720870371907949, 71.25641106288689741177222458645701, 71.32075152613711566118581686168909, 71.38515008514531245964462868869305, 71.44960679236868372754543088376522, 71.51412170031163384464889531955123, 71.57869486152613092144747497513890, 71.64332632861160732318239752203226, 71.70801615421483177215122850611806, 71.77276439103025040822103619575500, 71.83757109179988731284538516774774, 71.90243630931327345479076029732823, 71.96736009640770248552144039422274, 72.03234250596823073919949820265174, 72.09738359092747828071878757327795, 72.16248340426604102049168432131410, 72.22764199901230597333778860047460, 72.29285942824243704762920970097184, 72.35813574508067347323958529159427, 72.42347100269918769299692939966917, 72.48886525431802851926477160304785, 72.55431855320547640531003708019853, 72.61983095267785870419174898415804, 72.68540250609954966876102844253182, 72.75103326688322624704596819356084, 72.81672328848978281712334137409925, 72.88247262442826013284502550959587, 72.94828132825617217349645216017962, 73.01414945357936403524945490062237, 73.08007705405194087688869331032038, 73.14606418337662319117953302338719, 73.21211089530460469632089370861650, 73.27821724363546707081695785745978, 73.34438328221752101399033563211560, 73.41060906494770676999905845150352, 73.47689464577145201928942697122693, 73.54324007868309820423746714368463, 73.60964541772565894461877178400755, 73.67611071699089109188207658007741, 73.74263603061947947026055771857500, 73.80922141280099424420768627896905, 73.87586691777381986412365222349763, 73.94257259982545349430438363924623, 74.00933851329239132610382512211800, 74.07616471256007173451507696881890, 74.14305125206314528440998401492834, 74.20999818628547473053913563489914, 74.27700556975992185471113771200180, 74.34407345706875958057935349643230, 74.41120190284351565424003638327122, 74.47839096176495843337761471047997, 74.54564068856332426094013499096036, 74.61295113801827483257511630654335, 74.68032236495882614235597429797053, 74.74775442426359006731217959895730, 74.81524737086076015657454263418913, 74.88280125972801215539220720529556, 74.95041614589275980051752412691712, 75.01809208443211218764190562069416, 75.08582913047278850626753410324454, 75.15362733919140225680166622623801, 75.22148676581441861799248727038503, 75.28940746561799812752724392339587, 75.35738949392836616425483953207731, 75.42543290612171347220282768830657, 75.49353775762405405203026020899415, 75.56170410391165148666914319619536, 75.62993200051080577850370900705457, 75.69822150299782492766098584979773, 75.76657266699936599252396263182163, 75.83498554819229298118443693965673, 75.90346020230360579716943902894855, 75.97199668511075287824496626853943, 76.04059505244157435299712233245373, 76.10925536017414572143024997785687, 76.17797766423716154804424149915576, 76.24676202060980756414210190996528, 76.31560848532167540270165773108602, 76.38451711445308944803400663658977, 76.45348796413502157065522624179721, 76.52252109054894901873922208324075, 76.59161654992728074375918367877603, 76.66077439855313002681214129552245, 76.72999469276035711118311155587435, 76.79927748893376815431111026555300, 76.86862284350912943864386761561036, 76.93803081297299684138124575838447, 77.00750145386308531669783405959606, 77.07703482276815520890522748231888, 77.14663097632792698732373537495732, 77.21628997123337967423140071332455, 77.28601186422672242315456969663501, 77.35579671210122398861130932345986, 77.42564457170158220833400264382362, 77.49555549992385294899577274918556, 77.56552955371527957595390034839511, 77.63556679007469085718184942379594, 77.70566726605237306557683041319251, 77.77583103875001313554093940183520, 77.84605816532094024751131655648351, 77.91634870297015424966957652941346, 77.98670270895414091683051083236933, 78.05712024058119880010053748264909, 78.12760135521139659431355539709330, 78.19814611025648787290265318006277, 78.26875456318013846157555235549808, 78.33942677149795486002403777092695, 78.41016279277731371166737517341971, 78.48096268463770286416547605767846, 78.55182650475067873685475206002593, 78.62275431083968157963681733235717, 78.69374616068043337691051419824362, 78.76480211210083837158890673890710, 78.83592222298085516740684397518635, 78.90710655125285200028883991762996, 78.97835515490152147322078235447407, 79.04966809196373844770278083160520, 79.12104542052894373682647710666060, 79.19248719873903041843732353299856, 79.26399348478825857000629184767604, 79.33556433692355369657889241352677, 79.40719981344444988735631341114640, 79.47889997270297612885769922286272, 79.55066487310399736543331528082490, 79.62249457310508660157211124897003, 79.69438913121651069104700582101941, 79.76634860600145771059032995253801, 79.83837305607603695989382686093450, 79.91046254010910843135206960141659, 79.98261711682266650313977152109146, 80.05483684499172625237406464293599, 80.12712178344423818998620845377445, 80.19947199106140089952532434836030, 80.27188752677758998288481961935759, 80.34436844958023016260995063930750, 80.41691481851017897497513331472874, 80.48952669266159887229150626808405, 80.56220413118185774692392442375422, 80.63494719327186999180412385612726, 80.70775593818602544615714577957988, 80.78063042523204728695418452844024, 80.85357071377137572198989801108837, 80.92657686321905430304468609392643, 80.99964893304360202819225378334522, 81.07278698276741124573163688182831, 81.14599107196659133478533476591110, 81.21926126027092607273516478016973, 81.29259760736417206317128147929907, 81.36600017298397347076388541609049, 81.43946901692177675613493192940950, 81.51300419902315752551658079028130, 81.58660577918774947647762019187212, 81.66027381736908807852159952744842, 81.73400837357502268787357024848461, 81.80780950786757443893293384462595, 81.88167728036283676829043542966247, 81.95561175123134489695075899362564, 82.02961298069797635434952098876238, 82.10368102904180886980611830949783, 82.17781595659653248731046915054321, 82.25201782375030745697586098685861, 82.32628669094563633734651375561953, 82.40062261867979032103903591632843, 82.47502566750465291534055722877383, 82.54949589802660625537100713700056, 82.62403337090697164057928603142500, 82.69863814686176795021310681477189, 82.77331028666172585417371010407805, 82.84804985113260045181959867477417, 82.92285690115507179598353104665875, 82.99773149766461699528008466586471, 83.07267370165190811803768156096339, 83.14768357416268429460615152493119, 83.22276117629763803051901049911976, 83.29790656921281311042548622936010, 83.37311981411944827868865104392171, 83.44840097228389197425713064149022, 83.52375010502801444545184494927526, 83.59916727372900879799999529495835, 83.67465253981934836247091880068183, 83.75020596478712775478925323113799, 83.82582761017597761110664578154683, 83.90151753758492247925460105761886, 83.97727580866877872267650673165917, 84.05310248513801241188048152253032, 84.12899762875869669187522958964109, 84.20496130135279599926434457302094, 84.28099356479808079711801838129759, 84.35709448102809915326361078768969, 84.43326411203241832481580786406994, 84.50950251985659633646719157695770, 84.58580976660208250450523337349296, 84.66218591442651586476131342351437, 84.73863102554371096175600541755557, 84.81514516222344468587834853678942, 84.89172838679191102073673391714692, 84.96838076163157893461175262928009, 85.04510234918107869361847406253219, 85.12189321193558555478375637903810, 85.19875341244669186835380969569087, 85.27568301332233602352062007412314, 85.35268207722711508722568396478891, 85.42975066688221374988643219694495, 85.50688884506533327112265396863222, 85.58409667461096148599608568474650, 85.66137421841035859415569575503469, 85.73872153941138662958110217005014, 85.81613870061894999707874376326799, 85.89362576509478230946115218102932, 85.97118279595746059840166708454490, 86.04880985638264689896459458395839, 86.12650700960311667131463764235377, 86.20427431890853142704145284369588, 86.28211184764587926565582165494561, 86.36001965921934697689721360802650, 86.43799781709020635389606468379498, 86.51604638477718367539637256413698, 86.59416542585638865148212062194943, 86.67235500396112968246598029509187, 86.75061518278239702794962795451283, 86.82894602606862122229358647018671, 86.90734759762567307461722521111369, 86.98581996131719051845720969140530, 87.06436318106447913578449515625834, 87.14297732084638425931188976392150, 87.22166244469971729813551064580679, 87.30041861671905678576877107843757, 87.37924590105676259099709568545222, 87.45814436192320329155336366966367, 87.53711406358679880668205441907048, 87.61615507037379302346380427479744, 87.69526744666869433331157779321074, 87.77445125691413352342351572588086, 87.85370656561077851165464380756021, 87.93303343731768961788475280627608, 88.01243193665222008803539210930467, 88.09190212828993082894157851114869, 88.17144407696490304715553065761924, 88.25105784746970982723723864182830, 88.33074350465523139064316637814045, 88.41050111343110984307713806629181, 88.49033073876553601166961016133428, 88.57023244568524944497767137363553, 88.65020629927585105178877711296082, 88.73025236468171783599245827645063, 88.81037070710586078803316922858357, 88.89056139181037963226117426529527, 88.97082448411624966411181958392262, 89.05116004940327911754138767719269, 89.13156815311049285810440778732300, 89.21204886073597606355178868398070, 89.29260223783681738041195785626769, 89.37322835002943577364931115880609, 89.45392726298953789410006720572710, 89.53469904245191912650625454261899, 89.61554375421091833686659811064601, 89.69646146412030418559879763051867, 89.77745223809310459728294517844915, 89.85851614210204729715769644826651, 89.93965324217941770257311873137951, 90.02086360441698786871711490675807, 90.10214729496634333827387308701873, 90.18350438003879787629557540640235, 90.26493492590532241592882201075554, 90.34643899889685769721836550161242, 90.42801666540422900197881972417235, 90.50966799187808931037579895928502, 90.59139304482920351802022196352482, 90.67319189082843422511359676718712, 90.75506459650657120619143825024366, 90.83701122855472931405529379844666, 90.91903185372426321464445209130645, 91.00112653882659685677936067804694, 91.08329535073367821951251244172454, 91.16553835637782299272657837718725, 91.24785562275162931200611637905240, 91.33024721690834724086016649380326, 91.41271320596175087302981410175562, 91.49525365708608148906932910904288, 91.57786863751637440600461559370160, 91.66055821454838792305963579565287, 91.74332245553848963481868850067258, 91.82616142790399749173957388848066, 91.90907519912313716758944792672992, 91.99206383673487152918823994696140, 92.07512740833934117290482390671968, 92.15826598159769389440043596550822, 92.24147962423204205606452887877822, 92.32476840402577522581850644201040, 92.40813238882353175540629308670759, 92.49157164653098561757360585033894, 92.57508624511534378598298644647002, 92.65867625260514728324778843671083, 92.74234173709024275922274682670832, 92.82608276672206670809828210622072, 92.90989940971363125754578504711390, 92.99379173433936784931574948132038, 93.07775980893551093231508275493979, 93.16180370190001269747881451621652, 93.24592348169240096922294469550252, 93.33011921683421974194061476737261, 93.41439097590883022803609492257237, 93.49873882756141085792478406801820, 93.58316284049924149712751386687160, 93.66766308349167502456111833453178, 93.75223962536996680228185141459107, 93.83689253502772942283627344295382, 93.92162188142071954644052311778069, 94.00642773356683790098031749948859, 94.09131016054647034252411685883999, 94.17626923150235995763068785890937, 94.26130501563952179822081234306097, 94.34641758222562657465459778904915, 94.43160700059088696889375569298863, 94.51687334012795815851859515532851, 94.60221667029230729895061813294888, 94.68763706060211404746951302513480, 94.77313458063819950893957866355777, 94.85870930004431045290402835235000, 94.94436128852716194614913547411561, 95.03009061585615313560992944985628, 95.11589735186393568255880381911993, 95.20178156644615796722064260393381, 95.28774332956140824535395950078964, 95.37378271123166939560178434476256, 95.45989978154207733496150467544794, 95.54609461064094944049429614096880, 95.63236726874005455556471133604646, 95.71871782611461298984067980200052, 95.80514635310306914561806479468942, 95.89165292010760310859041055664420, 95.97823759759393169588292948901653, 96.06490045609123740177892614156008, 96.15164156619256630165182286873460, 96.23846099855468594341800780966878, 96.32535882389801429326325887814164, 96.41233511300698921786533901467919, 96.49938993672995479755627457052469, 96.58652336597906185033934889361262, 96.67373547173065162496641278266907, 96.76102632502517053580959327518940, 96.84839599696702805431414162740111, 96.93584455872502303463988937437534, 97.02337208153220160511409630998969, 97.11097863668574348139372887089849, 97.19866429554740250296163139864802, 97.28642912954336452457937411963940, 97.37427321016413372944953152909875, 97.46219660896493053314770804718137, 97.55019939756559210763953160494566, 97.63828164765045869444293202832341, 97.72644343096874308685073629021645, 97.81468481933448799736652290448546, 97.90300588462636710573860909789801, 97.99140669878815401716565247625113, 98.07988733382856594289478380233049, 98.16844786182117843509331578388810, 98.25708835490482329078076872974634, 98.34580888528344644328171852976084, 98.43460952522603690795222064480186, 98.52349034706702468611183576285839, 98.61245142320609602393233217298985, 98.70149282610820762329240096732974, 98.79061462830388506972667528316379, 98.87981690238913756729743909090757, 98.96909972102537267346633598208427, 99.05846315693977999217167962342501, 99.14790728292517485442658653482795, 99.23743217183999831831897608935833, 99.32703789660858717525115935131907, 99.41672453022115973908512387424707, 99.50649214573367373759538168087602, 99.59634081626818158383684931322932, 99.68627061501280195443541742861271, 99.77628161522156347018608357757330, 99.86637389021478838913026265799999, 99.95654751337902155228221090510488, 100.04680255816688827508187387138605, 100.13713909809752067303634248673916, 100.22755720675642976402741624042392, 100.31805695779539178147388156503439, 100.40863842493284607826353749260306, 100.49930168195385249418905004858971, 100.59004680270984977141779381781816, 100.68087386111916714526159921661019, 100.77178293116691065733903087675571, 100.86277408690473578189994441345334, 100.95384740245141586001409450545907, 101.04500295199260051504097646102309, 101.13624080978077302006568061187863, 101.22756105013561978012148756533861, 101.31896374744397348877100739628077, 101.41044897615959996528545161709189, 101.50201681080370974541438044980168, 101.59366732596478755112912040203810, 101.68540059629849281463975785300136, 101.77721669652807179318187991157174, 101.86911570144424388217885280027986, 101.96109768590508792840410023927689, 102.05316272483642592305841390043497, 102.14531089323176615835109259933233, 102.23754226615213269724335987120867, 102.32985691872652012079925043508410, 102.42225492615175141963845817372203, 102.51473636369237851795332971960306, 102.60730130668105175573145970702171, 102.69994983051850567790097557008266, 102.79268201067334587150980951264501, 102.88549792268247529136715456843376, 102.97839764215103741662460379302502, 103.07138124475227414222899824380875, 103.16444880622789526114502223208547, 103.25760040238803583179105771705508, 103.35083610911108564778260188177228, 103.44415600234411556357372319325805, 103.53756015810280644018348539248109, 103.63104865247127861493936507031322, 103.72462156160253243797342292964458, 103.81827896171832037452986696735024, 103.91202092910904752898204606026411, 104.00584754013419797047390602529049, 104.09975887122217841351812239736319, 104.19375499887026137457723962143064, 104.28783599964492623257683590054512, 104.38200195018181659634137758985162, 104.47625292718559819604706717655063, 104.57058900743037099800858413800597, 104.66501026775954130698664812371135, 104.75951678508572229020501254126430, 104.85410863639118872470135102048516, 104.94878589872770646707067498937249, 105.04354864921640455577289685606956, 105.13839696504825838019314687699080, 105.23333092348396178294933633878827, 105.32835060185375652963557513430715, 105.42345607755788705617305822670460, 105.51864742806650099282705923542380, 105.61392473091953547736920882016420, 105.70928806372708663730008993297815, 105.80473750416933853557566180825233, 105.90027312999643527291482314467430, 105.99589501902893573515029856935143, 106.09160324915761464126262580975890, 106.18739789834343412167072528973222, 106.28327904461791320045449538156390, 106.37924676608304253022652119398117, 106.47530114091112807273020735010505, 106.57144224734528847875481005758047, 106.66767016369925613616942428052425, 106.76398496835727769393997732549906, 106.86038673977461144204426091164351, 106.95687555647731414865120314061642, 107.05345149706218421670200768858194, 107.15011464019714537698746426030993, 107.24686506462120405558380298316479, 107.34370284914422200017725117504597, 107.44062807264745629254321102052927, 107.53764081408334618572553154081106, 107.63474115247545626061764778569341, 107.73192916691890275160403689369559, 107.82920493658021143801306607201695, 107.92656854069717553556984057649970, 108.02402005857935307631123578175902, 108.12155956960792480003874516114593, 108.21918715323553783491661306470633, 108.31690288898676044482272118330002, 108.41470685645798255336558213457465, 108.51259913531728784619190264493227, 108.61057980530486588577332440763712, 108.70864894623291263542341766878963, 108.80680663798550256160524440929294, 108.90505296051901495957281440496445, 109.00338799386206289909750921651721, 109.10181181811528006164735415950418, 109.20032451345186075286619598045945, 109.29892616011736095060769002884626, 109.39761683842962725066172424703836, 109.49639662877919477068644482642412, 109.59526561162921609593468019738793, 109.69422386751526232728792820125818, 109.79327147704587730459024896845222, 109.89240852090233602211810648441315, 109.99163507983858778516150778159499, 110.09095123468169674652017420157790, 110.19035706633171400881110457703471, 110.28985265576153551592142321169376, 110.38943808401734258950455114245415, 110.48911343221855929641606053337455, 110.58887878155761086418351624161005, 110.68873421330042106092150788754225, 110.78867980878632693020335864275694, 110.88871564942790826080454280599952, 110.98884181671142812319885706529021, 111.08905839219676181528484448790550, 111.18936545751719791041978169232607, 111.28976309437994984818942612037063, 111.39025138456601382586086401715875, 111.49083040993001247898064320906997, 111.59150025240069226128980517387390, 111.69226099398076712532201781868935, 111.79311271674681904642056906595826, 111.89405550284969592667039250954986, 111.99508943451445475147920660674572, 112.09621459404020527017564745619893, 112.19743106380053632165072485804558, 112.29873892624344478008424630388618, 112.40013826389116502468823455274105, 112.50162915934063789791252929717302, 112.60321169526338280775235034525394, 112.70488595440536983005586080253124, 112.80665201958748866672976873815060, 112.90850997370540653719217516481876, 113.01045989972945449153485242277384, 113.11250188070506794701941544190049, 113.21463599975265879038488492369652, 113.31686234006750169100996572524309, 113.41918098492020305911864852532744, 113.52159201765654472637834260240197, 113.62409552169735604820743901655078, 113.72669158053902549454505788162351, 113.82938027775328748703032033517957, 113.93216169698716555558348773047328, 114.03503592196341287490213289856911, 114.13800303648037015591398812830448, 114.24106312441183774808450834825635, 114.34421626970757301933190319687128, 114.44746255639310561491583939641714, 114.55080206856966640316386474296451, 114.65423489041458537940343376249075, 114.75776110618124903339776210486889, 114.86138080019885876481566810980439, 114.96509405687302773912961129099131, 115.06890096068552509223081870004535, 115.17280159619424750871985452249646, 115.27679604803360291498393053188920, 115.38088440091445363577804528176785, 115.48506673962393165311368647962809, 115.58934314902592177531914785504341, 115.69371371406094795020180754363537, 115.79817851974604536735569126904011, 115.90273765117517257294821320101619, 116.00739119351915462630131514742970, 116.11213923202552678048959933221340, 116.21698185201896080798178445547819, 116.32191913890122236807656008750200, 116.42695117815094363322714343667030, 116.53207805532417751237517222762108, 116.63729985605419869898469187319279, 116.74261666605141840591386426240206, 116.84802857110382490191113902255893, 116.95353565707689824648696230724454, 117.05913800991342554880247917026281, 117.16483571563401255843928083777428, 117.27062886033689892428810708224773, 117.37651753019791556198470061644912, 117.48250181147088255784183274954557, 117.58858179048749548201158177107573, 117.69475755365719749079289613291621, 117.80102918746769091740134172141552, 117.90739677848473832000308902934194, 118.01386041335206300573190674185753, 118.12042017879184641060419380664825, 118.22707616160455756926239700987935, 118.33382844866885363899200456216931, 118.44067712694203464707243256270885, 118.54762228345991559308458818122745, 118.65466400533667012950900243595243, 118.76180237976539899591443827375770, 118.86903749401788843442773213610053, 118.97636943544451071375078754499555, 119.08379829147473571993032237514853, 119.19132414961700305866543203592300, 119.29894709745849468163214623928070, 119.40666722266576016409089788794518, 119.51448461298444669864693423733115, 119.62239935623927067354088649153709, 119.73041154033440136572608025744557, 119.83852125325344673001382034271955, 119.94672858305919760368851711973548, 120.05503361789418192984157940372825, 120.16343644598055107053369283676147, 120.27193715561985243311937665566802, 120.38053583519359790443559177219868, 120.48923257316313595310930395498872, 120.59802745806941004502732539549470, 120.70692057853356971008906839415431, 120.81591202325678580109524773433805, 120.92500188102010838520072866231203, 121.03419024068492149126541335135698, 121.14347719119290047729009529575706, 121.25286282156579886759573128074408, 121.36234722090594573273847345262766, 121.47193047839616042438137810677290, 121.58161268329953941247367765754461, 121.69139392496001050858467351645231, 121.80127429280216233564715366810560, 121.91125387633114485197438625618815, 122.02133276513310988775629084557295, 122.13151104887511166907643200829625, 122.24178881730495049851015210151672, 122.35216616025167013503960333764553, 122.46264316762545831807074137032032, 122.57321992941743360461259726434946, 122.68389653570018538175645517185330, 122.79467307662768860154756112024188, 122.90554964243503377474553417414427, 123.01652632343905224843183532357216, 123.12760321003811725404375465586782, 123.23878039271200179882725933566689, 123.35005796202237604575202567502856, 123.46143600861272204838314792141318, 123.57291462320813479891512542963028, 123.68449389661583381894160993397236, 123.79617391972504947261768393218517, 123.90795478350683822554856305941939, 124.01983657901465107897820416837931, 124.13181939738413461782329250127077, 124.24390332983298890212608966976404, 124.35608846766152169038832653313875, 124.46837490225249212016933597624302, 124.58076272507092596697475528344512, 124.69325202766466986759041901677847, 124.80584290166422078982577659189701, 124.91853543878261234567617066204548, 125.03132973081588374952843878418207, 125.14422586964299455303262220695615, 125.25722394722561148228123784065247, 125.37032405560869108285260153934360, 125.48352628692026655699010007083416, 125.59683073337134828761918470263481, 125.71023748725646385082654887810349, 125.82374664095341643132996978238225, 125.93735828692325640076887793838978, 126.05107251771069343249109806492925, 126.16488942594403965813398826867342, 126.27880910433499650480371201410890, 126.39283164567922312926384620368481, 126.50695714285615167682408355176449, 126.62118568882885938364779576659203, 126.73551737664459437837649602442980, 126.84995229943461936272797174751759, 126.96449055041404108123970218002796, 127.07913222288239296631218167021871, 127.19387741022345039709762204438448, 127.30872620590504595838865498080850, 127.42367870347968050737108569592237, 127.53873499658429579994844971224666, 127.65389517894017501475900644436479, 127.76915934435344013309077126905322, 127.88452758671492404118907870724797, 128.00000000000000000000000000000000, 128.11557667826912165764952078461647, 128.23125771566770936260581947863102, 128.34704320642592279000382404774427, 128.46293324485921516497910488396883, 128.57892792536830484095844440162182, 128.69502734243874897401838097721338, 128.81123159064185301758698187768459, 128.92754076463413070996466558426619, 129.04395495915744618287135381251574, 129.16047426903941186537849716842175, 129.27709878919324637536192312836647, 129.39382861461766083266411442309618, 129.51066384039737044986395630985498, 129.62760456170295242372958455234766, 129.74465087379064698325237259268761, 129.86180287200301108896383084356785, 129.97906065176860579413187224417925, 130.09642430860199624476081226021051, 130.21389393810417800523282494395971, 130.33146963596249179317965172231197, 130.44915149795045294922601897269487, 130.56693961992826302775938529521227, 130.68483409784269611009221989661455, 130.80283502772692827420542016625404, 130.92094250570107760722748935222626, 131.03915662797203367517795413732529, 131.15747749083337225783907342702150, 131.27590519066578167439729440957308, 131.39443982393703436173382215201855, 131.51308148720175950074917636811733, 131.63183027710198302884236909449100, 131.75068629036701395307318307459354, 131.86964962381324539819615893065929, 131.98872037434477988426806405186653, 132.10789863895314510955358855426311, 132.22718451471723710710648447275162, 132.34657809880388867895817384123802, 132.46607948846761360073287505656481, 132.58568878105052135651931166648865, 132.70540607398285715134989004582167, 132.82523146478283138094411697238684, 132.94516505105647752316144760698080, 133.06520693049822057218989357352257, 133.18535720089064966487057972699404, 133.30561596010446123727888334542513, 133.42598330609891377207532059401274, 133.54645933692174253337725531309843, 133.66704415070896061479288619011641, 133.78773784568548421702871564775705, 133.90854052016482000908581539988518, 134.02945227254909354996925685554743, 134.15047320132950403603899758309126, 134.27160340508618219246272929012775, 134.39284298248796289954043459147215, 134.51419203229312415714957751333714, 134.63565065334907444594136904925108, 134.75721894459218219708418473601341, 134.87889700504842949158046394586563, 135.00068493383326995171955786645412, 135.12258283015131610227399505674839, 135.24459079329704991323524154722691, 135.36670892265462384784768801182508, 135.48893731769763348893320653587580, 135.61127607798977123820804990828037, 135.73372530318462736431683879345655, 135.85628509302554789428540971130133, 135.97895554734614620429056230932474, 136.10173676607018933282233774662018, 136.22462884921145587213686667382717, 136.34763189687424755902611650526524, 136.47074600925327558798016980290413, 136.59397128663343323751178104430437, 136.71730782939044956947327591478825, 136.84075573799069047709053847938776, 136.96431511299095973299699835479259, 137.08798605503912426684109959751368, 137.21176866487394363502971827983856, 137.33566304332487106876214966177940, 137.45966929131265032992814667522907, 137.58378750984917360256076790392399, 137.70801780003725411916093435138464, 137.83236026307127986001432873308659, 137.95681500023698617951595224440098, 138.08138211291134211933240294456482, 138.20606170256306199917162302881479, 138.33085387075252015165460761636496, 138.45575871913155197034939192235470, 138.58077634944396550054079852998257, 138.70590686352551301752100698649883, 138.83115036330357838778581935912371, 138.95650695079791603347985073924065, 139.08197672812028145017393399029970, 139.20755979747451647199341095983982, 139.33325626115689033213129732757807, 139.45906622155609966284828260540962, 139.58498978115298427837842609733343, 139.71102704252123771766491699963808, 139.83717810832712302726577036082745, 139.96344308132938749622553586959839, 140.08982206437977424684504512697458, 140.21631516042296539126255083829165, 140.34292247249624097094056196510792, 140.46964410373024634282046463340521, 140.59648015734873638393764849752188, 140.72343073666840496116492431610823, 140.85049594509951020881999284029007, 140.97767588614564715499000158160925, 141.10497066340363403469382319599390, 141.23238038056410914578009396791458, 141.35990514141127505354234017431736, 141.48754504982287016900954768061638, 141.61530020977062349629704840481281, 141.74317072532019778918765950948000, 141.87115670063087691232794895768166, 141.99925823995633322738285642117262, 142.12747544764434337594138924032450, 142.25580842813664617096947040408850, 142.38425728596956787441740743815899, 142.51282212577379482354444917291403, 142.64150305227423132237163372337818, 142.77030017029062491928925737738609, 142.89921358473736745509086176753044, 143.02824340062326768929779063910246, 143.15738972305226184289494995027781, 143.28665265722321464636479504406452, 143.41603230842966354430245701223612, 143.54552878206050081644207239151001, 143.67514218359977462569077033549547, 143.80487261862654690958152059465647, 143.93472019281540497104288078844547, 144.06468501193646147839899640530348, 144.19476718185495656143757514655590, 144.32496680853208204098336864262819, 144.45528399802461194667557720094919, 144.58571885648487409525841940194368, 144.71627149016134694647917058318853, 144.84694200539837538599385879933834, 144.97773050863605703852954320609570, 145.10863710641095281062007416039705, 145.23966190535571740838349796831608, 145.37080501219909933752205688506365, 145.50206653376645249409193638712168, 145.63344657697956563424668274819851, 145.76494524885652026569005101919174, 145.89656265651234434699290432035923, 146.02829890715872807049890980124474, 146.16015410810388175377738662064075, 146.29212836675324638235906604677439, 146.42422179060920939264178741723299, 146.55643448727093414163391571491957, 146.68876656443504202798067126423120, 146.82121812989541353999811690300703, 146.95378929154290403857885394245386, 147.08648015736619640847493428736925, 147.21929083545131788923754356801510, 147.35222143398178218376415316015482, 147.48527206123895894052111543715000, 147.61844282560198848841537255793810, 147.75173383554763972824730444699526, 147.88514519965090698860876727849245, 148.01867702658478265220765024423599, 148.15232942512014346903015393763781, 148.28610250412629056881996802985668, 148.41999637257094946107827126979828, 148.55401113951984370942227542400360, 148.68814691413751916115870699286461, 148.82240380568703130848007276654243, 148.95678192352991686675522942095995, 149.09128137712664852188026998192072, 149.22590227603654966515023261308670, 149.36064472991765228471194859594107, 149.49550884852718013462435919791460, 149.63049474172152031314908526837826, 149.76560251945602431078441441059113, 149.90083229178551960103504825383425, 150.03618416886422437528381124138832, 150.17165826094557701253506820648909, 150.30725467838280451360333245247602, 150.44297353162883723598497454077005, 150.57881493123599625505448784679174, 150.71477898785673232850967906415462, 150.85086581224342694440565537661314, 150.98707551524810810406052041798830, 151.12340820782330297333828639239073, 151.25986400102161155700741801410913, 151.39644300599564985532197169959545, 151.53314533399873198504792526364326, 151.66997109638458596236887387931347, 151.80692040460721159433887805789709, 151.94399337022150575648993253707886, 152.08119010488314870599424466490746, 152.21851072034829144286049995571375, 152.35595532847432309608848299831152, 152.49352404121961512828420381993055, 152.63121697064335080540331546217203, 152.76903422890617889606801327317953, 152.90697592827004314131045248359442, 153.04504218109789803747844416648149, 153.18323309985456148751836735755205, 153.32154879710626005362428259104490, 153.45998938552071422236622311174870, 153.59855497786753630862222053110600, 153.73724568701825887728773523122072, 153.87606162594599368276249151676893, 154.01500290772617063339566811919212, 154.15406964553631041781045496463776, 154.29326195265585397464747074991465, 154.43257994246675934846280142664909, 154.57202372845344484630913939327002, 154.71159342420244797722261864691973, 154.85128914340316441666800528764725, 154.99111099984770589799154549837112, 155.13105910743055915190780069679022, 155.27113358014938171436369884759188, 155.41133453210474613115366082638502, 155.55166207750002627108187880367041, 155.69211633064188049502263311296701, 155.83269740594030849933915305882692, 155.97340541790828183366102166473866, 156.11424048116239760020107496529818, 156.25520271042279318862711079418659, 156.39629222051297574580530636012554, 156.53750912636027692315110471099615, 156.67885354299590972004807554185390, 156.82032558555462742333475034683943, 156.96192536927540572833095211535692, 157.10365300950135747370950412005186, 157.24550862167936315927363466471434, 157.38749232136086675382102839648724, 157.52960422420167674317781347781420, 157.67184444596171033481368795037270, 157.81421310250570400057767983525991, 157.95671030980304294644156470894814, 158.09933618392747689540556166321039, 158.24209084105788747365295421332121, 158.38497439747806083687464706599712, 158.52798696957651714001258369535208, 158.67112867384710739315778482705355, 158.81439962688889977471262682229280, 158.95779994540595225771539844572544, 159.10132974620799473086663056164980, 159.24498914621017320314422249794006, 159.38877826243302138209401164203882, 159.53269721200291542118065990507603, 159.67674611215207391978765372186899, 159.82092508021821686270413920283318, 159.96523423364533300627954304218292, 160.10967368998345250474812928587198, 160.25424356688847637997241690754890, 160.39894398212280179905064869672060, 160.54377505355517996576963923871517, 160.68873689916046032521990127861500, 160.83382963702035794995026662945747, 160.97905338532319774458301253616810, 161.12440826236371549384784884750843, 161.26989438654373998360824771225452, 161.41551187637205089231429155915976, 161.56126085046409457390836905688047, 161.70714142754275144397979602217674, 161.85315372643810860608937218785286, 161.99929786608720405638450756669044, 162.14557396553482249146327376365662, 162.29198214393318266957066953182220, 162.43852252054185214547032956033945, 162.58519521472834412634256295859814, 162.73200034596794694152777083218098, 162.87893803384355351226986385881901, 163.02600839804631505103316158056259, 163.17321155837549895295524038374424, 163.32054763473817615704319905489683, 163.46801674715004537574714049696922, 163.61561901573514887786586768925190, 163.76335456072567353658087085932493, 163.91122350246268979390151798725128, 164.05922596139595270869904197752476, 164.20736205808361773961223661899567, 164.35563191319306497462093830108643, 164.50403564750061491395172197371721, 164.65257338189127267469302751123905, 164.80124523735958064207807183265686, 164.95005133500930583068111445754766, 165.09899179605321251074201427400112, 165.24806674181394328115857206285000, 165.39727629372353590042621362954378, 165.54662057332345170834742020815611, 165.69609970226520090363919734954834, 165.84571380231014359196706209331751, 165.99546299532923399056016933172941, 166.14534740330381623607536312192678, 166.29536714832536858921230304986238, 166.44552235259527606103802099823952, 166.59581313842562622085097245872021, 166.74623962823889655737730208784342, 166.89680194456778394851426128298044, 167.04750021005602889090368989855051, 167.19833454745801759599999058991671, 167.34930507963869672494183760136366, 167.50041192957425550957850646227598, 167.65165522035195522221329156309366, 167.80303507516984495850920211523771, 167.95455161733755744535301346331835, 168.10620497027602482376096304506063, 168.25799525751739338375045917928219, 168.40992260270559199852868914604187, 168.56198712959616159423603676259518, 168.71418896205619830652722157537937, 168.86652822406483664963161572813988, 169.01900503971319267293438315391541, 169.17161953320416500901046674698591, 169.32437182885303172952262684702873, 169.47726205108742192351201083511114, 169.63029032444688937175669707357883, 169.78345677358382204147346783429384, 169.93676152326315786922350525856018, 170.09020469836215738723694812506437, 170.24378642387117110956751275807619, 170.39750682489338373670761939138174, 170.55136602664467204704124014824629, 170.70536415445423017445136792957783, 170.85950133376442749977286439388990, 171.01377769013066654224530793726444, 171.16819334922192297199217136949301, 171.32274843682071718831139151006937, 171.47744307882277325916220434010029, 171.63227740123789999415748752653599, 171.78725153018956461892230436205864, 171.94236559191492119680333416908979, 172.09761971276529379792918916791677, 172.25301401920623334262927528470755, 172.40854863781706285408290568739176, 172.56422369529175853131164330989122, 172.72003931843869395379442721605301, 172.87599563418041270779212936758995, 173.03209276955436735079274512827396, 173.18833085171277730296424124389887, 173.34471000792225936493196059018373, 173.50123036556479405589925590902567, 173.65789205213724244458717294037342, 173.81469519525134614923445042222738, 173.97163992263438103691441938281059, 174.12872636212895827156899031251669, 174.28595464169276851862377952784300, 174.44332488939943459627102129161358, 174.60083723343811357153754215687513, 174.75849180211352518199419137090445, 174.91628872384640658310672733932734, 175.07422812717359761336410883814096, 175.23231014074758604692760854959488, 175.39053489333738866662315558642149, 175.54890251382826704684703145176172, 175.70741313122155702330928761512041, 175.86606687463537923576950561255217, 176.02486387330444017607078421860933, 176.18380425657986165788315702229738, 176.34288815392980609431106131523848, 176.50211569493941965447447728365660, 176.66148700931046278128633275628090, 176.82100222686221968615427613258362, 176.98066147753107202333922032266855, 177.14046489137049888995534274727106, 177.30041259855170210357755422592163, 177.46050472936343567198491655290127, 177.62074141421172157606633845716715, 177.78112278362075926452234853059053, 177.94164896823249932822363916784525, 178.10232009880655823508277535438538, 178.26313630622098571620881557464600, 178.42409772147195212710357736796141, 178.58520447567363476082391571253538, 178.74645670005887154729862231761217, 178.90785452597907578820013441145420, 179.06939808490383825301250908523798, 179.23108750842183667373319622129202, 179.39292292824060837119759526103735, 179.55490447618620919456589035689831, 179.71703228420409459431539289653301, 179.87930648435883540514623746275902, 180.04172720883397573743422981351614, 180.20429458993268667654774617403746, 180.36700876007759575259115081280470, 180.52986985181064483185764402151108, 180.69287799779371539443673100322485, 180.85603333080845800395763944834471, 181.01933598375617862075159791857004, 181.18278608965840703604044392704964, 181.34638378165686845022719353437424, 181.51012919301314241238287650048733, 181.67402245710945862811058759689331, 181.83806370744852642928890418261290, 182.00225307765319371355872135609388, 182.16659070146735643902502488344908, 182.33107671275564598545315675437450, 182.49571124550325862401223275810480, 182.66049443381669448172033298760653, 182.82542641192350174605962820351124, 182.99050731417216297813865821808577, 183.15573727503274881200923118740320, 183.32111642909677584611927159130573, 183.48664491107697926963737700134516, 183.65232285580799498347914777696133, 183.81815039824627433517889585345984, 183.98412767346974305837647989392281, 184.15025481667868234580964781343937, 184.31653196319538778880087193101645, 184.48295924846408411212905775755644, 184.64953680805155045163701288402081, 184.81626477764706351081258617341518, 184.98314329306197123514721170067787, 185.15017249023068757196597289294004, 185.31735250521029456649557687342167, 185.48468347418048551844549365341663, 185.65216553344413341619656421244144, 185.81979881942726251509157009422779, 185.98758346867873569863149896264076, 186.15551961787102186463016550987959, 186.32360740380002539495762903243303, 186.49184696338480193844588939100504, 186.66023843366843948388122953474522, 186.82878195181766045607218984514475, 186.99747765512282171584956813603640, 187.16632568099848299425502773374319, 187.33532616698335004912223666906357, 187.50447925073993360456370282918215, 187.67378507005545884567254688590765, 187.84324376284143909288104623556137, 188.01285546713367580196063499897718, 188.18262032109294068504823371767998, 188.35253846300471991526137571781874, 188.52261003127904359644162468612194, 188.69283516445125314930919557809830, 188.86321400118177393778751138597727, 189.03374668025591631703719031065702, 189.20443334058461459790123626589775, 189.37527412120422809493902605026960, 189.54626916127639901787915732711554, 189.71741860008862090580805670469999, 189.88872257705432389229827094823122, 190.06018123171230627121985889971256, 190.23179470372787136511760763823986, 190.40356313289231593444128520786762, 190.57548665912281649070791900157928, 190.74756542246333879120356868952513, 190.91979956308415466992300935089588, 191.09218922128189888098859228193760, 191.26473453748010911112942267209291, 191.43743565222922597968135960400105, 191.61029270620613829123612958937883, 191.78330584021520621718082111328840, 191.95647519518786339176585897803307, 192.12980091218247480355785228312016, 192.30328313238513260330364573746920, 192.47692199710937188683601561933756, 192.65071764779602858652651775628328, 192.82467022601397843573067802935839, 192.99877987345990959511254914104939, 193.17304673195812370067869778722525, 193.34747094346130324993282556533813, 193.52205265005034107161918655037880, 193.69679199393405610862828325480223, 193.87168911745004606927977874875069, 194.04674416306440321022819261997938, 194.22195727337148696278745774179697, 194.39732859109480500592326279729605, 194.57285825908672904915874823927879, 194.74854642032826745889906305819750, 194.92439321792986106629541609436274, 195.10039879513118421527906320989132, 195.27656329530091738888586405664682, 195.45288686193748617370147258043289, 195.62936963866897599473304580897093, 195.80601176925273421147721819579601, 195.98281339757630803433130495250225, 196.15977466765713188578956760466099, 196.33689572364235687018663156777620, 196.51417670980964658156153745949268, 196.69161777056689288656343705952168, 196.86921905045207381590444128960371, 197.04698069413404937222367152571678, 197.22490284641219204786466434597969, 197.40298565221641524658480193465948, 197.58122925660777013945335056632757, 197.75963380477827513459487818181515, 197.93819944205074534693267196416855, 198.11692631387955998434335924685001, 198.29581456585034970885317306965590, 198.47486434367999663663795217871666, 198.65407579321717435050231870263815, 198.83344906044231947817024774849415, 199.01298429146734747519076336175203, 199.19268163253636316767369862645864, 199.37254123002560390887083485722542, 199.55256323044312694037216715514660, 199.73274778042957677826052531599998, 199.91309502675804310456442181020975, 200.09360511633377655016374774277210, 200.27427819619504134607268497347832, 200.45511441351285952805483248084784, 200.63611391559078356294776313006878, 200.81727684986569215652707498520613, 200.99860336390770498837810009717941, 201.18009360541969954283558763563633, 201.36174772223833429052319843322039, 201.54356586233382131467806175351143, 201.72554817380947156379988882690668, 201.90769480490283172002818901091814, 202.09000590398520103008195292204618, 202.27248161956154604013136122375727, 202.45512210027123956024297513067722, 202.63792749488794697754201479256153, 202.82089795231919993057090323418379, 203.00403362160741949082876089960337, 203.18733465192957510225824080407619, 203.37080119259698562927951570600271, 203.55443339305614358636375982314348, 203.73823140288848776435770560055971, 203.92219537181017585680820047855377, 204.10632544967285184611682780086994, 204.29062178646353231670218519866467, 204.47508453230426539448671974241734, 204.65971383745304024159850087016821, 204.84450985230350283927691634744406, 205.02947272738475703590665943920612, 205.21460261336210351146291941404343, 205.39989966103701135580195114016533, 205.58536402134669174301961902529001, 205.77099584536495058273430913686752, 205.95679528430207483324920758605003, 206.14276248950454828445799648761749, 206.32889761245579052229004446417093, 206.51520080477607166358211543411016, 206.70167221822217129556520376354456, 206.88831200468823112714744638651609, 207.07512031620561288036697078496218, 207.26209730494255722987873014062643, 207.44924312320506487594684585928917, 207.63655792343664074905973393470049, 207.82404185821809505796409212052822, 208.01169508026839594094781205058098, 208.19951774244435682703624479472637, 208.38750999774052274915447924286127, 208.57567199928985246515367180109024, 208.76400390036363319268275517970324, 208.95250585437119639209413435310125, 209.14117801486074199601716827601194, 209.33002053551908261397329624742270, 209.51903357017144458041002508252859, 209.70821727278237744940270204097033, 209.89757179745541293414134997874498, 210.08709729843280911154579371213913, 210.27679393009651676038629375398159, 210.46666184696792356589867267757654, 210.65670120370751305927115026861429, 210.84691215511577411234611645340919, 211.03729485613300198565411847084761, 211.22784946183907095473841764032841, 211.41857612745417327460017986595631, 211.60947500833867707115132361650467, 211.80054625999287054582964628934860, 211.99179003805787147030059713870287, 212.18320649831522928252525161951780, 212.37479579668686824334145057946444, 212.56655808923582640090899076312780, 212.75849353216608506045304238796234, 212.95060228182225614546041470021009, 213.14288449469057695750962011516094, 213.33534032739851227233884856104851, 213.52796993671455538787995465099812, 213.72077347954922288408852182328701, 213.91375111295462829730240628123283, 214.10690299412436843340401537716389, 214.30022928039429075397492852061987, 214.49373012924240811116760596632957, 214.68740569828844400035450235009193, 214.88125614529491258508642204105854, 215.07528162816669237145106308162212, 215.26948230495091252123529557138681, 215.46385833383780550320807378739119, 215.65840987316042287602613214403391, 215.85313708139435107113968115299940, 216.04804011715870615262247156351805, 216.24311913921584960007749032229185, 216.43837430647107566983322612941265, 216.63380577797352088964544236660004, 216.82941371291596510673116426914930, 217.02519827063457569238380528986454, 217.22115961060973177154664881527424, 217.41729789246582527084683533757925, 217.61361327597100512321048881858587, 217.81010592103802991914562880992889, 218.00677598772412579819501843303442, 218.20362363623056012329470831900835, 218.40064902690372150573239196091890, 218.59785232023472190121538005769253, 218.79523367685925450132344849407673, 218.99279325755838954137288965284824, 219.19053122325843219186936039477587, 219.38844773503052465457585640251637, 219.58654295409175460918049793690443, 219.78481704180467204423621296882629, 219.98327015967717557032301556318998, 220.18190246936339349304034840315580, 220.38071413266342801762220915406942, 220.57970531152307103184284642338753, 220.77887616803468517900910228490829, 220.97822686443711859283212106674910, 221.17775756311522172836703248322010, 221.37746842660084212184301577508450, 221.57735961757265386040671728551388, 221.77743129885581652160908561199903, 221.97768363342285624639771413058043, 222.17811678439352363056968897581100, 222.37873091503439582083956338465214, 222.57952618875989969637885224074125, 222.78050276913202765172172803431749, 222.98166081986002495796128641813993, 223.18300050480138452257961034774780, 223.38452198796153425064403563737869, 223.58622543349363809284113813191652, 223.78811100569939185334078501909971, 223.99017886902890950295841321349144, 224.19242918808041054035129491239786, 224.39486212760107264330144971609116, 224.59747785248688956016849260777235, 224.80027652778233004937646910548210, 225.00325831868127579582505859434605, 225.20642339052676561550470069050789, 225.40977190881073966011172160506248, 225.61330403917497733345953747630119, 225.81701994741081307438435032963753, 226.02091979945890898306970484554768, 226.22500376141013589403883088380098, 226.42927199950531758076976984739304, 226.63372468013500338201993145048618, 226.83836196984040611823729705065489, 227.04318403531308945275668520480394, 227.24819104339471209641487803310156, 227.45338316107805098909011576324701, 227.65876055550657497406064067035913, 227.86432339397433111116697546094656, 228.07007184392682574980426579713821, 228.27600607296074031182797625660896, 228.48212624882367549616901669651270, 228.68843253941514603866380639374256, 228.89492511278621122983167879283428, 229.10160413713933280632772948592901, 229.30846978082917075880686752498150, 229.51552221236249806679552420973778, 229.72276160039771752963133621960878, 229.93018811374605547825922258198261, 230.13780192137105018446163740009069, 230.34560319238849501743970904499292, 230.55359209606720582996786106377840, 230.76176880182890727155609056353569, 230.97013347924786330622737295925617, 231.17868629805184355063829571008682, 231.38742742812189590040361508727074, 231.59635703949209073471138253808022, 231.80547530235034514589642640203238, 232.01478238703830925260263029485941, 232.22427846405105356097919866442680, 232.43396370403792161596356891095638, 232.64383827780244473615312017500401, 232.85390235630188726645428687334061, 233.06415611064835502475034445524216, 233.27459971210839739796938374638557, 233.48523333210283681182772852480412, 233.69605714220764980382227804511786, 233.90707131415379649297392461448908, 234.11827601982685109760495834052563, 234.32967143126802511687856167554855, 234.54125772067379784857621416449547, 234.75303506039583112396940123289824, 234.96500362294176511568366549909115, 235.17716358097499096402316354215145, 235.38951510731439498158579226583242, 235.60205837493538183480268344283104, 235.81479355696947664000617805868387, 236.02772082670412601146381348371506, 236.24084035758369282120838761329651, 236.45415232320911513852479401975870, 236.66765689733770727798400912433863, 236.88135425388406929414486512541771, 237.09524456691983118616917636245489, 237.30932801067334025901800487190485, 237.52360475953079799182887654751539, 237.73807498803577686885546427220106, 237.95273887088902142750157508999109, 238.16759658294947143986064475029707, 238.38264829923400611733086407184601, 238.59789419491698936326429247856140, 238.81333444533152032818179577589035, 239.02896922596889339729386847466230, 239.24479871247854134708177298307419, 239.46082308066880273145216051489115, 239.67704250650689346002764068543911, 239.89345716611839520737703423947096, 240.11006723578836385968315880745649, 240.32687289196110214106738567352295, 240.54387431123970486623875331133604, 240.76107167038719580887118354439735, 240.97846514632627190621860790997744, 241.19605491613882009005465079098940, 241.41384115706713942017813678830862, 241.63182404651357160219049546867609, 241.85000376204021677040145732462406, 242.06838048136984298253082670271397, 242.28695438238580095458019059151411, 242.50572564313159773519146256148815, 242.72469444181189146547694690525532, 242.94386095679232084876275621354580, 243.16322536659907882494735531508923, 243.38278784992002101716934703290462, 243.60254858560432467129430733621120, 243.82250775266228970394877251237631, 244.04266553026621977551258169114590, 244.26302209775022333815286401659250, 244.48357763460990099702030420303345, 244.70433232050334027007920667529106, 244.92528633525091663614148274064064, 245.14643985883486720922519452869892, 245.36779307140037076351291034370661, 245.58934615325537720309512224048376, 245.81109928487006754949106834828854, 246.03305264687810449686367064714432, 246.25520642007623450808750931173563, 246.47756078542400359765451867133379, 246.70011592404475209150405135005713, 246.92287201722544409676629584282637, 247.14582924641626959783025085926056, 247.36898779323166763788321986794472, 247.59234783945009894523536786437035, 247.81590956701367645109712611883879, 248.03967315802930215795640833675861, 248.26363879476826923564658500254154, 248.48780665966597780425217933952808, 248.71217693532304338077665306627750, 248.93674980450498424033867195248604, 249.16152545014185193394951056689024, 249.38650405532933973518083803355694, 249.61168580332844157965155318379402, 249.83707087756522469135234132409096, 250.06265946163176749905687756836414, 250.28845173928598910606524441391230, 250.51444789445122296456247568130493, 250.74064811121738216570520307868719, 250.96705257384053311398020014166832, 251.19366146674269657523836940526962, 251.42047497451292770165309775620699, 251.64749328190683286265993956476450, 251.87471657384651280153775587677956, 252.10214503542138686498219612985849, 252.32977885188807931626797653734684, 252.55761820866999300960742402821779, 252.78566329135844625852769240736961, 253.01391428571230335364816710352898, 253.24237137765771876729559153318405, 253.47103475328918875675299204885960, 253.69990459886923872545594349503517, 253.92898110082808216247940436005592, 254.15826444576478593262436334043741, 254.38775482044690079419524408876896, 254.61745241181009191677730996161699, 254.84735740695936101474217139184475, 255.07746999316859159989689942449331, 255.30779035788035002951801288872957, 255.53831868870688026618154253810644, 255.76905517342984808237815741449594, 256.00000000000000000000000000000000, 256.23115335653841384555562399327755, 256.46251543133524819495505653321743, 256.69408641285184558000764809548855, 256.92586648971860086021479219198227, 257.15785585073643915166030637919903, 257.39005468487749794803676195442677, 257.62246318128381972201168537139893, 257.85508152926809088967274874448776, 258.08790991831489236574270762503147, 258.32094853807893741759471595287323, 258.55419757838632222046726383268833, 258.78765722923532166532822884619236, 259.02132768079491142998449504375458, 259.25520912340573431720258668065071, 259.48930174758129396650474518537521, 259.72360574400613586476538330316544, 259.95812130353704105800716206431389, 260.19284861720399248952162452042103, 260.42778787620852654072223231196404, 260.66293927192481305610272102057934, 260.89830299590090589845203794538975, 261.13387923985669658577535301446915, 261.36966819568527853334671817719936, 261.60567005545385654841084033250809, 261.84188501140232574471156112849712, 262.07831325594389682009932585060596, 262.31495498166674451567814685404301, 262.55181038133173387905117124319077, 262.78887964787389819321106187999249, 263.02616297440351900149835273623466, 263.26366055420413658794132061302662, 263.50137258073385737588978372514248, 263.73929924762649079639231786131859, 263.97744074868973029879271052777767, 264.21579727790611968885059468448162, 264.45436902943447421421296894550323, 264.69315619760794788817293010652065, 264.93215897693505667120916768908501, 265.17137756210104271303862333297729, 265.41081214796582798953750170767307, 265.65046292956549223163165152072906, 265.89033010211295504632289521396160, 266.13041386099661167463636957108974, 266.37071440178118564290343783795834, 266.61123192020892247455776669085026, 266.85196661219799807440722361207008, 267.09291867384331453649792820215225, 267.33408830141792122958577238023281, 267.57547569137113896431401371955872, 267.81708104032946948791504837572575, 268.05890454509818709993851371109486, 268.30094640265917860233457759022713, 268.54320681017219385466887615621090, 268.78568596497592579908086918294430, 269.02838406458641884455573745071888, 269.27130130669797836162615567445755, 269.51443788918436439416836947202682, 269.75779401009702951341751031577587, 270.00136986766636937318253330886364, 270.24516566030263220454799011349678, 270.48918158659427035672706551849842, 270.73341784530907716543879359960556, 270.97787463539526697786641307175159, 271.22255215597971300667268224060535, 271.46745060636908419837709516286850, 271.71257018605109578857081942260265, 271.95791109469246293883770704269409, 272.20347353214020813538809306919575, 272.44925769842291174427373334765434, 272.69526379374866564830881543457508, 272.94149201850638064570375718176365, 273.18794257326686647502356208860874, 273.43461565878106966920313425362110, 273.68151147598121042392449453473091, 273.92863022598191946599399670958519, 274.17597211007841906393878161907196, 274.42353732974771673980285413563251, 274.67132608664974213752429932355881, 274.91933858262547119011287577450275, 275.16757501969817667486495338380337, 275.41603560007450823832186870276928, 275.66472052614273025028523989021778, 275.91363000047380182877532206475735, 276.16276422582268423866480588912964, 276.41212340512629452859982848167419, 276.66170774150486977305263280868530, 276.91151743826310394069878384470940, 277.16155269888810153133817948400974, 277.41181372705085550478543154895306, 277.66230072660715677557163871824741, 277.91301390159600259721628390252590, 278.16395345624039237009128555655479, 278.41511959494903294398682191967964, 278.66651252231395119451917707920074, 278.91813244311202879543998278677464, 279.16997956230596855675685219466686, 279.42205408504264596558641642332077, 279.67435621665407552427495829761028, 279.92688616265877499245107173919678, 280.17964412875971902394667267799377, 280.43263032084576025226851925253868, 280.68584494499248194188112393021584, 280.93928820746066321589751169085503, 281.19296031469730223761871457099915, 281.44686147333680992232984863221645, 281.70099189019919094789656810462475, 281.95535177229112377972342073917389, 282.20994132680726806938764639198780, 282.46476076112838882181677035987377, 282.71981028282237957682809792459011, 282.97509009964574033801909536123276, 283.23060041954147436626954004168510, 283.48634145064022504811873659491539, 283.74231340126175382465589791536331, 283.99851647991283698502229526638985, 284.25495089528851622162619605660439, 284.51161685627329234193894080817699, 284.76851457193930627909139730036259, 285.02564425154741911683231592178345, 285.28300610454846264474326744675636, 285.54060034058142036883509717881680, 285.79842716947456437992514111101627, 286.05648680124653537859558127820492, 286.31477944610469421604648232460022, 286.57330531444625876247300766408443, 286.83206461685932708860491402447224, 287.09105756412117216314072720706463, 287.35028436719937872112495824694633, 287.60974523725309381916304118931293, 287.86944038563098047234234400093555, 288.12937002387275242654141038656235, 288.38953436370991312287515029311180, 288.64993361706433461222331970930099, 288.91056799604905336309457197785378, 289.17143771296974819051683880388737, 289.43254298032286442321492359042168, 289.69388401079652339831227436661720, 289.95546101727211407705908641219139, 290.21727421282207615149673074483871, 290.47932381071126428651041351258755, 290.74161002439819867504411377012730, 291.00413306753307551844045519828796, 291.26689315395896073823678307235241, 291.52989049771304053138010203838348, 291.79312531302485922424239106476307, 292.05659781431728561074123717844486, 292.32030821620776350755477324128151, 292.58425673350666329497471451759338, 292.84844358121824825502699241042137, 293.11286897454186828326783142983913, 293.37753312887031142963678576052189, 293.64243625979065654973965138196945, 293.90757858308580807715770788490772, 294.17296031473256334720645099878311, 294.43858167090246524821850471198559, 294.70444286796356436752830632030964, 294.97054412247808841129881329834461, 295.23688565120380644657416269183159, 295.50346767109527945649460889399052, 295.77029039930198450747411698102951, 296.03735405316939477415871806442738, 296.30465885024028693806030787527561, 296.57220500825280851131537929177284, 296.83999274514172839189996011555195, 297.10802227903968741884455084800720, 297.37629382827520885257399640977383, 297.64480761137389208670356310904026, 297.91356384705983373351045884191990, 298.18256275425346757401712238788605, 298.45180455207292880004388280212879, 298.72128945983530456942389719188213, 298.99101769705453079950530081987381, 299.26098948344287009604158811271191, 299.53120503891204862156882882118225, 299.80166458357120973232667893171310, 300.07236833772822137689217925071716, 300.34331652189115402507013641297817, 300.61450935676583640088210813701153, 300.88594706325750394171336665749550, 301.15762986247199251010897569358349, 301.42955797571369203069480136036873, 301.70173162448668335855472832918167, 301.97415103049621620812104083597660, 302.24681641564677647693315520882607, 302.51972800204299574033939279615879, 302.79288601199129971064394339919090, 303.06629066799763450035243295133114, 303.33994219276900139448116533458233, 303.61384080921442318867775611579418, 303.88798674044323888665530830621719, 304.16238020976612688173190690577030, 304.43702144069658288572099991142750, 304.71191065694881672243354842066765, 304.98704808243905972631182521581650, 305.26243394128670161080663092434406, 305.53806845781258516581146977841854, 305.81395185653985890894546173512936, 306.09008436219579607495688833296299, 306.36646619970929350529331713914871, 306.64309759421234957699198275804520, 306.91997877104142844473244622349739, 307.19710995573524314750102348625660, 307.47449137403634722431888803839684, 307.75212325189198736552498303353786, 308.03000581545256864046677947044373, 308.30813929107245030536432750523090, 308.58652390531170794929494149982929, 308.86515988493374607060104608535767, 309.14404745690671916236169636249542, 309.42318684840489595444523729383945, 309.70257828680655620701145380735397, 309.98222199969524126572650857269764, 310.26211821486111830381560139358044, 310.54226716029893395898398011922836, 310.82266906420932173205073922872543, 311.10332415500005254216375760734081, 311.38423266128398836372070945799351, 311.66539481188044646842172369360924, 311.94681083581656366732204332947731, 312.22848096232496573065873235464096, 312.51040542084541584699763916432858, 312.79258444102595149161061272025108, 313.07501825272072437655879184603691, 313.35770708599159206642070785164833, 313.64065117110925484666950069367886, 313.92385073855103883033734746277332, 314.20730601900254441716242581605911, 314.49101724335872631854726932942867, 314.77498464272196088131750002503395, 315.05920844840318295609904453158379, 315.34368889192342066962737590074539, 315.62842620501163537483080290257931, 315.91342061960585851920768618583679, 316.19867236785495379081112332642078, 316.48418168211594547756249085068703, 316.76994879495595114349271170794964, 317.05597393915303428002516739070415, 317.34225734769444215999101288616657, 317.62879925377762901916867122054100, 317.91559989081190451543079689145088, 318.20265949241615999198984354734421, 318.48997829242017587603186257183552, 318.77755652486604276418802328407764, 319.06539442400600137261790223419666, 319.35349222430392046589986421167850, 319.64185016043643372540827840566635, 319.93046846729083654281566850841045, 320.21934737996673447923967614769936, 320.50848713377695275994483381509781, 320.79788796424583097177674062550068, 321.08755010711013255786383524537086, 321.37747379832092065043980255723000, 321.66765927404094327357597649097443, 321.95810677064622495890944264829159, 322.24881652472743098769569769501686, 322.53978877308765049747307784855366, 322.83102375274387441095313988626003, 323.12252170092818914781673811376095, 323.41428285508573026163503527641296, 323.70630745287598983850330114364624, 323.99859573217440811276901513338089, 324.29114793106981551318312995135784, 324.58396428786619480888475663959980, 324.87704504108370429094065912067890, 325.17039042945685878294170834124088, 325.46400069193566650938009843230247, 325.75787606768710702453972771763802, 326.05201679609285747574176639318466, 326.34642311675082737565389834344387, 326.64109526947635231408639810979366, 326.93603349430031812516972422599792, 327.23123803147007038205629214644432, 327.52670912145134707316174171864986, 327.82244700492555011805961839854717, 328.11845192279167804372264072299004, 328.41472411616723547922447323799133, 328.71126382638635732291731983423233, 329.00807129500100245422800071537495, 329.30514676378254534938605502247810, 329.60249047471933181441272608935833, 329.90010267001838428768678568303585, 330.19798359210642502148402854800224, 330.49613348362805709257372654974461, 330.79455258744684442717698402702808, 331.09324114664690341669484041631222, 331.39219940453062918095383793115616, 331.69142760462005981025868095457554, 331.99092599065846798112033866345882, 332.29069480660785984582616947591305, 332.59073429665050980474916286766529, 332.89104470519055212207604199647903, 333.19162627685147981537738814949989, 333.49247925647756574107916094362736, 333.79360388913556789702852256596088, 334.09500042011228515548282302916050, 334.39666909491580781832453794777393, 334.69861015927739344988367520272732, 335.00082385914868154941359534859657, 335.30331044070368307075113989412785, 335.60607015033968991701840423047543, 335.90910323467528542096260935068130, 336.21240994055187911726534366607666, 336.51599051503478676750091835856438, 336.81984520541135452731396071612835, 337.12397425919215265821549110114574, 337.42837792411239661305444315075874, 337.73305644812984382951981388032436, 338.03801007942615797219332307577133, 338.34323906640833001802093349397182, 338.64874365770629083272069692611694, 338.95452410217461647334857843816280, 339.26058064889377874351339414715767, 339.56691354716787145662237890064716, 339.87352304652608836477156728506088, 340.18040939672431477447389625012875, 340.48757284774256959281046874821186, 340.79501364978659694315865635871887, 341.10273205328934409408248029649258, 341.41072830890863087915931828320026, 341.71900266752868446928914636373520, 342.02755538026133308449061587452888, 342.33638669844407331765978597104549, 342.64549687364120700294733978807926, 342.95488615764554651832440868020058, 343.26455480247602736199041828513145, 343.57450306037895870758802630007267, 343.88473118382984239360666833817959, 344.19523942553081496953382156789303, 344.50602803841223931158310733735561, 344.81709727563412570816581137478352, 345.12844739058374443629872985184193, 345.44007863687716053391341120004654, 345.75199126836082541558425873517990, 346.06418553910896207526093348860741, 346.37666170342532723225303925573826, 346.68942001584451872986392118036747, 347.00246073112975864205509424209595, 347.31578410427425751549890264868736, 347.62939039050269229846890084445477, 347.94327984526893260408542118966579, 348.25745272425768916946253739297390, 348.57190928338553703724755905568600, 348.88664977879903972279862500727177, 349.20167446687599976939964108169079, 349.51698360422705036398838274180889, 349.83257744769304053988889791071415, 350.14845625434702469647163525223732, 350.46462028149517209385521709918976, 350.78106978667500470692175440490246, 351.09780502765630672001861967146397, 351.41482626244311404661857523024082, 351.73213374927092900179559364914894, 352.04972774660865297846612520515919, 352.36760851315972331576631404459476, 352.68577630785983956229756586253643, 353.00423138987861193527351133525372, 353.32297401862092556257266551256180, 353.64200445372460990256513468921185, 353.96132295506191667300299741327763, 354.28092978274099777991068549454212, 354.60082519710363158083055168390274, 354.92100945872664397029438987374306, 355.24148282842344315213267691433430, 355.56224556724174590272014029324055, 355.88329793646477128277183510363102, 356.20464019761311647016555070877075, 356.52627261244214196267421357333660, 356.84819544294367688053171150386333, 357.17040895134726952164783142507076, 357.49291340011797046827268786728382, 357.81570905195792420272482559084892, 358.13879616980767650602501817047596, 358.46217501684390072114183567464352, 358.78584585648098936871974729001522, 359.10980895237241838913178071379662, 359.43406456840841656230622902512550, 359.75861296871744343661703169345856, 360.08345441766795147486845962703228, 360.40858917986560072677093558013439, 360.73401752015502097492571920156479, 361.05973970362128966371528804302216, 361.38575599558765816254890523850918, 361.71206666161668863423983566462994, 362.03867196751235724150319583714008, 362.36557217931704144575633108615875, 362.69276756331350952677894383668900, 363.02025838602628482476575300097466, 363.34804491421914462989661842584610, 363.67612741489682548490236513316631, 364.00450615530638742711744271218777, 364.33318140293494025172549299895763, 364.66215342551106459723087027668953, 364.99142249100651724802446551620960, 365.32098886763361633711610920727253, 365.65085282384677611844381317496300, 365.98101462834432595627731643617153, 366.31147455006572499769390560686588, 366.64223285819332431856309995055199, 366.97328982215395853927475400269032, 367.30464571161621734063373878598213, 367.63630079649232129668234847486019, 367.96825534693948611675295978784561, 368.30050963335759206529473885893822, 368.63306392639054820392630062997341, 368.96591849692816822425811551511288, 369.29907361610332827694946900010109, 369.63252955529389964794972911477089, 369.96628658612394247029442340135574, 370.30034498046160251760738901793957, 370.63470501042036175931571051478386, 370.96936694836097103689098730683327, 371.30433106688849420606857165694237, 371.63959763885429765650769695639610, 371.97516693735747139726299792528152, 372.31103923574227110293577425181866, 372.64721480759982341623981483280659, 372.98369392676960387689177878201008, 373.32047686733710634143790230154991, 373.65756390363509353846893645823002, 373.99495531024564343169913627207279, 374.33265136199719336218549869954586, 374.67065233396647272456903010606766, 375.00895850147986720912740565836430, 375.34757014011114506502053700387478, 375.68648752568265081208664923906326, 376.02571093426735160392126999795437, 376.36524064218610874377191066741943, 376.70507692600921245684730820357800, 377.04522006255808719288324937224388, 377.38567032890273367229383438825607, 377.72642800236332050189957953989506, 378.06749336051183263407438062131405, 378.40886668116945656947791576385498, 378.75054824240822881620260886847973, 379.09253832255279803575831465423107, 379.43483720017746918529155664145947, 379.77744515410842041092109866440296, 380.12036246342461254243971779942513, 380.46358940745597010391065850853920, 380.80712626578434765178826637566090, 381.15097331824563298141583800315857, 381.49513084492690495608258061110973, 381.83959912616808196617057546973228, 382.18437844256379776197718456387520, 382.52946907496050243935314938426018, 382.87487130445822458568727597594261, 383.22058541241227658247225917875767, 383.56661168043063980803708545863628, 383.91295039037544256643741391599178, 384.25960182436494960711570456624031, 384.60656626477049258028273470699787, 384.95384399421851639999658800661564, 385.30143529559205717305303551256657, 385.64934045202818424513679929077625, 385.99755974691959181654965505003929, 386.34609346391624740135739557445049, 386.69494188692283387354109436273575, 387.04410530010045476956292986869812, 387.39358398786811221725656650960445, 387.74337823490031951223500072956085, 388.09348832612857904678094200789928, 388.44391454674297392557491548359394, 388.79465718218983738552196882665157, 389.14571651817323072464205324649811, 389.49709284065653491779812611639500, 389.84878643585994950626627542078495, 390.20079759026214105688268318772316, 390.55312659060183477777172811329365, 390.90577372387519972107838839292526, 391.25873927733772461579064838588238, 391.61202353850546842295443639159203, 391.96562679515284344233805313706398, 392.31954933531403639790369197726250, 392.67379144728471374037326313555241, 393.02835341961952053679851815104485, 393.38323554113355839945143088698387, 393.73843810090414763180888257920742, 394.09396138826832611812278628349304, 394.44980569282415672205388545989990, 394.80597130443283049316960386931896, 395.16245851321576765258214436471462, 395.51926760955632289551431313157082, 395.87639888410149069386534392833710, 396.23385262775934734236216172575951, 396.59162913170047204403090290725231, 396.94972868735999327327590435743332, 397.30815158643457607468008063733578, 397.66689812088441158266505226492882, 398.02596858293469495038152672350407, 398.38536326507295370902284048497677, 398.74508246005098044406622648239136, 399.10512646088625388074433431029320, 399.46549556085938093019649386405945, 399.82619005351585883545340038836002, 400.18721023266755310032749548554420, 400.54855639239031006582081317901611, 400.91022882702549168243422172963619, 401.27222783118156712589552626013756, 401.63455369973166853014845401048660, 401.99720672781518260308075696229935, 402.36018721083939908567117527127266, 402.72349544447695279814070090651512, 403.08713172466735841226181946694851, 403.45109634761894312759977765381336, 403.81538960980589081373182125389576, 404.18001180797011784306960180401802, 404.54496323912309208026272244751453, 404.91024420054276333758025430142879, 405.27585498977566658140858635306358, 405.64179590463839986114180646836758, 406.00806724321506635533296503126621, 406.37466930385892283084103837609291, 406.74160238519397125855903141200542, 407.10886678611251454640296287834644, 407.47646280577674815503996796905994, 407.84439074362035171361640095710754, 408.21265089934593106590909883379936, 408.58124357292678041631006635725498, 408.95016906460853078897343948483467, 409.31942767490636470029130578041077, 409.68901970460677830487838946282864, 410.05894545476951407181331887841225, 410.42920522672449124002014286816120, 410.79979932207379533792845904827118, 411.17072804269338348603923805058002, 411.54199169073012853914406150579453, 411.91359056860392229282297194004059, 412.28552497900909656891599297523499, 412.65779522491186526167439296841621, 413.03040160955191595348878763616085, 413.40334443644434259113040752708912, 413.77662400937674647138919681310654, 414.15024063241099838705849833786488, 414.52419460988511445975746028125286, 414.89848624641035712556913495063782, 415.27311584687299728102516382932663, 415.64808371643619011592818424105644, 416.02339016053701925557106733322144, 416.39903548488848628039704635739326, 416.77501999548104549830895848572254, 417.15134399857993230398278683423996, 417.52800780072703901169006712734699, 417.90501170874239278418826870620251, 418.28235602972171136570977978408337, 418.66004107103788101085228845477104, 419.03806714034288916082005016505718, 419.41643454556503911589970812201500, 419.79514359491054165118839591741562, 420.17419459686561822309158742427826, 420.55358786019331773786689154803753, 420.93332369393561975812190212309361, 421.31340240741502611854230053722858, 421.69382431023177559836767613887787, 422.07458971226577659763279370963573, 422.45569892367814190947683528065681, 422.83715225490857392287580296397209, 423.21895001667706992520834319293499, 423.60109251998574109165929257869720, 423.98358007611597031427663750946522, 424.36641299663017434795619919896126, 424.74959159337373648668290115892887, 425.13311617847188017549342475831509, 425.51698706433188590381178073585033, 425.90120456364451229092082940042019, 426.28576898938143813211354427039623, 426.67068065479674032758339308202267, 427.05593987342911077575990930199623, 427.44154695909872998527134768664837, 427.82750222590902922092936933040619, 428.21380598824873686680803075432777, 428.60045856078886572504416108131409, 428.98746025848453200524090789258480, 429.37481139657688800070900470018387, 429.76251229059005254384828731417656, 430.15056325633310052580782212316990, 430.53896460990182504247059114277363, 430.92771666767589522351045161485672, 431.31681974632056153495796024799347, 431.70627416278870214227936230599880, 432.09608023431769652233924716711044, 432.48623827843141498306067660450935, 432.87674861294215133966645225882530, 433.26761155594726915296632796525955, 433.65882742583170283978688530623913, 434.05039654126915138476761057972908, 434.44231922121974776018760167062283, 434.83459578493142316801822744309902, 435.22722655194201024642097763717175, 435.62021184207634405538556165993214, 436.01355197544796737929573282599449, 436.40724727246112024658941663801670, 436.80129805380767038514022715389729, 437.19570464046915958533645607531071, 437.59046735371850900264689698815346, 437.98558651511700645642122253775597, 438.38106244651658016664441674947739, 438.77689547006104930915171280503273, 439.17308590818379343545529991388321, 439.56963408360905987137812189757824, 439.96654031935435114064603112637997, 440.36380493872707120317500084638596, 440.76142826532657181815011426806450, 441.15941062304614206368569284677505, 441.55775233606965457511250860989094, 441.95645372887400981198879890143871, 442.35551512623044345673406496644020, 442.75493685320196846078033559024334, 443.15471923514502350371913053095341, 443.55486259771163304321817122399807, 443.95536726684599670988973230123520, 444.35623356878676304404507391154766, 444.75746183006879164167912676930428, 445.15905237752008360985200852155685, 445.56100553826377108634915202856064, 445.96332163972004991592257283627987, 446.36600100960305326225352473556995, 446.76904397592278428419376723468304, 447.17245086698727618568227626383305, 447.57622201139901108035701327025890, 447.98035773805753478882252238690853, 448.38485837616082108070258982479572, 448.78972425520242950369720347225666, 449.19495570497355174666154198348522, 449.60055305556466009875293821096420, 450.00651663736283580874442122876644, 450.41284678105324701391509734094143, 450.81954381762147932022344321012497, 451.22660807835023888401337899267673, 451.63403989482139877509325742721558, 452.04183959891781796613940969109535, 452.45000752282055600517196580767632, 452.85854399901035094444523565471172, 453.26744936027000676403986290097237, 453.67672393968109645356889814138412, 454.08636807062589468841906636953354, 454.49638208678942419282975606620312, 454.90676632215632935185567475855350, 455.31752111101286573102697730064392, 455.72864678794866222233395092189312, 456.14014368785393571670283563435078, 456.55201214592119640656164847314358, 456.96425249764735099233803339302540, 457.37686507883057629442191682755947, 457.78985022557213824256905354559422, 458.20320827427866561265545897185802, 458.61693956165862573470803909003735, 459.03104442472471191649674437940121, 459.44552320079543505926267243921757, 459.86037622749239517361274920403957, 460.27560384274181615182897076010704, 460.69120638477699003487941808998585, 461.10718419213469587703002616763115, 461.52353760365753032601787708699703, 461.94026695849572661245474591851234, 462.35737259610397131837089546024799, 462.77485485624350758371292613446712, 463.19271407898418146942276507616043, 463.61095060470097450888715684413910, 464.02956477407633428811095654964447, 464.44855692810210712195839732885361, 464.86792740807612744902144186198711, 465.28767655560460525521193630993366, 465.70780471260377453290857374668121, 466.12831222129699426659499295055866, 466.54919942421651057884446345269680, 466.97046666420567362365545704960823, 467.39211428441558382473886013031006, 467.81414262830730876885354518890381, 468.23655203965370219520991668105125, 468.65934286253633445085142739117146, 469.08251544134731148005812428891659, 469.50607012079166224793880246579647, 469.93000724588381444846163503825665, 470.35432716194964086753316223621368, 470.77903021462878996317158453166485, 471.20411674987104788669967092573643, 471.62958711393861221949919126927853, 472.05544165340825202292762696743011, 472.48168071516766985951107926666737, 472.90830464641794605995528399944305, 473.33531379467541455596801824867725, 473.76270850776842280538403429090977, 474.19048913383937815524404868483543, 474.61865602134668051803600974380970, 475.04720951906188020075205713510513, 475.47614997607126952061662450432777, 475.90547774177804285500315017998219, 476.33519316589922709681559354066849, 476.76529659846767117414856329560280, 477.19578838983397872652858495712280, 477.62666889066332487345789559185505, 478.05793845193750257749343290925026, 478.48959742495708269416354596614838, 478.92164616133788967999862506985664, 479.35408501301350270296097733080387, 479.78691433223679041475406847894192, 480.22013447157706877987948246300220, 480.65374578392192006504046730697155, 481.08774862247940973247750662267208, 481.52214334077473267825553193688393, 481.95693029265220275192405097186565, 482.39210983227764018010930158197880, 482.82768231413456305745057761669159, 483.26364809302685898728668689727783, 483.70000752408043354080291464924812, 484.13676096273997018215595744550228, 484.57390876477131769206607714295387, 485.01145128626319547038292512297630, 485.44938888362412399146705865859985, 485.88772191358435748043120838701725, 486.32645073319815764989471063017845, 486.76557569984032625143299810588360, 487.20509717120836512549431063234806, 487.64501550532457940789754502475262, 488.08533106053272376811946742236614, 488.52604419550016245921142399311066, 488.96715526921980199404060840606689, 489.40866464100696475725271739065647, 489.85057267050154905518866144120693, 490.29287971766973441845038905739784, 490.73558614280108258753898553550243, 491.17869230651047018909594044089317, 491.62219856974013509898213669657707, 492.06610529375655005424050614237785, 492.51041284015218479908071458339691, 492.95512157084800719530903734266758, 493.40023184808978840010240674018860, 493.84574403445060397643828764557838, 494.29165849283253919566050171852112, 494.73797558646367633627960458397865, 495.18469567889991367337643168866634, 495.63181913402735290219425223767757, 496.07934631605894537642598152160645, 496.52727758953619741078000515699387, 496.97561331933195560850435867905617, 497.42435387064642782206647098064423, 497.87349960900968426358303986489773, 498.32305090028370386789902113378048, 498.77300811065896368745598010718822, 499.22337160665659894220880232751369, 499.67414175513044938270468264818192, 500.12531892326387605862691998481750, 500.57690347857169399503618478775024, 501.02889578890244592912495136260986, 501.48129622243504854850471019744873, 501.93410514768072516744723543524742, 502.38732293348539315047673881053925, 502.84094994902613962040049955248833, 503.29498656381338150822557508945465, 503.74943314769302560307551175355911, 504.20429007084305794705869629979134, 504.65955770377581757202278822660446, 505.11523641733998601921484805643559, 505.57132658271717673414968885481358, 506.02782857142432249020203016698360, 506.48474275531543753459118306636810, 506.94206950657871857401914894580841, 507.39980919773813639039872214198112, 507.85796220165616432495880872011185, 508.31652889152991292576189152896404, 508.77550964089346052787732332944870, 509.23490482362018383355461992323399, 509.69471481391900624657864682376385, 510.15493998633689898269949480891228, 510.61558071576070005903602577745914, 511.07663737741410159287624992430210, 511.53811034685935510424314998090267, 512.00000000000000000000000000000000, 512.46230671307682769111124798655510, 512.92503086267049638991011306643486, 513.38817282570369116001529619097710, 513.85173297943720172042958438396454, 514.31571170147287830332061275839806, 514.78010936975499589607352390885353, 515.24492636256763944402337074279785, 515.71016305853618177934549748897552, 516.17581983662978473148541525006294, 516.64189707615787483518943190574646, 517.10839515677264444093452766537666, 517.57531445847064333065645769238472, 518.04265536158982285996899008750916, 518.51041824681146863440517336130142, 518.97860349516258793300949037075043, 519.44721148801227172953076660633087, 519.91624260707408211601432412862778, 520.38569723440798497904324904084206, 520.85557575241705308144446462392807, 521.32587854384962611220544204115868, 521.79660599180181179690407589077950, 522.26775847971339317155070602893829, 522.73933639137055706669343635439873, 523.21134011090771309682168066501617, 523.68377002280465148942312225699425, 524.15662651188779364019865170121193, 524.62990996333348903135629370808601, 525.10362076266346775810234248638153, 525.57775929574779638642212375998497, 526.05232594880703800299670547246933, 526.52732110840827317588264122605324, 527.00274516146771475177956745028496, 527.47859849525298159278463572263718, 527.95488149737946059758542105555534, 528.43159455581223937770118936896324, 528.90873805886894842842593789100647, 529.38631239521589577634586021304131, 529.86431795387011334241833537817001, 530.34275512420208542607724666595459, 530.82162429593165597907500341534615, 531.30092585913098446326330304145813, 531.78066020422591009264579042792320, 532.26082772199322334927273914217949, 532.74142880356237128580687567591667, 533.22246384041784494911553338170052, 533.70393322439599614881444722414017, 534.18583734768662907299585640430450, 534.66817660283584245917154476046562, 535.15095138274227792862802743911743, 535.63416208065893897583009675145149, 536.11780909019637419987702742218971, 536.60189280531835720466915518045425, 537.08641362034438770933775231242180, 537.57137192995185159816173836588860, 538.05676812917283768911147490143776, 538.54260261339595672325231134891510, 539.02887577836872878833673894405365, 539.51558802019405902683502063155174, 540.00273973533273874636506661772728, 540.49033132060526440909598022699356, 540.97836317318854071345413103699684, 541.46683569061815433087758719921112, 541.95574927079053395573282614350319, 542.44510431195942601334536448121071, 542.93490121273816839675419032573700, 543.42514037210219157714163884520531, 543.91582218938492587767541408538818, 544.40694706428041627077618613839149, 544.89851539684582348854746669530869, 545.39052758749733129661763086915016, 545.88298403701276129140751436352730, 546.37588514653373295004712417721748, 546.86923131756213933840626850724220, 547.36302295196242084784898906946182, 547.85726045196383893198799341917038, 548.35194422015683812787756323814392, 548.84707465949543347960570827126503, 549.34265217329948427504859864711761, 549.83867716525094238022575154900551, 550.33515003939635334972990676760674, 550.83207120014901647664373740553856, 551.32944105228546050057047978043556, 551.82726000094760365755064412951469, 552.32552845164536847732961177825928, 552.82424681025258905719965696334839, 553.32341548300973954610526561737061, 553.82303487652620788139756768941879, 554.32310539777620306267635896801949, 554.82362745410171100957086309790611, 555.32460145321431355114327743649483, 555.82602780319200519443256780505180, 556.32790691248078474018257111310959, 556.83023918989806588797364383935928, 557.33302504462790238903835415840149, 557.83626488622405759087996557354927, 558.33995912461193711351370438933372, 558.84410817008529193117283284664154, 559.34871243330815104854991659522057, 559.85377232531754998490214347839355, 560.35928825751943804789334535598755, 560.86526064169152050453703850507736, 561.37168988998496388376224786043167, 561.87857641492132643179502338171005, 562.38592062939460447523742914199829, 562.89372294667361984465969726443291, 563.40198378039838189579313620924950, 563.91070354458224755944684147834778, 564.41988265361453613877529278397560, 564.92952152225677764363354071974754, 565.43962056564475915365619584918022, 565.95018019929148067603819072246552, 566.46120083908294873253908008337021, 566.97268290128045009623747318983078, 567.48462680252350764931179583072662, 567.99703295982567397004459053277969, 568.50990179057703244325239211320877, 569.02323371254658468387788161635399, 569.53702914387861255818279460072517, 570.05128850309483823366463184356689, 570.56601220909692528948653489351273, 571.08120068116284073767019435763359, 571.59685433894912875985028222203255, 572.11297360249307075719116255640984, 572.62955889220938843209296464920044, 573.14661062889251752494601532816887, 573.66412923371865417720982804894447, 574.18211512824234432628145441412926, 574.70056873439875744224991649389267, 575.21949047450618763832608237862587, 575.73888077126196094468468800187111, 576.25874004774550485308282077312469, 576.77906872741982624575030058622360, 577.29986723412866922444663941860199, 577.82113599209810672618914395570755, 578.34287542593949638103367760777473, 578.86508596064572884642984718084335, 579.38776802159304679662454873323441, 579.91092203454422815411817282438278, 580.43454842564415230299346148967743, 580.95864762142252857302082702517509, 581.48322004879639735008822754025459, 582.00826613506615103688091039657593, 582.53378630791792147647356614470482, 583.05978099542608106276020407676697, 583.58625062604971844848478212952614, 584.11319562863457122148247435688972, 584.64061643241552701510954648256302, 585.16851346701332658994942903518677, 585.69688716243649651005398482084274, 586.22573794908373656653566285967827, 586.75506625774062285927357152104378, 587.28487251958131309947930276393890, 587.81515716617161615431541576981544, 588.34592062946512669441290199756622, 588.87716334180493049643700942397118, 589.40888573592712873505661264061928, 589.94108824495617682259762659668922, 590.47377130240761289314832538366318, 591.00693534219055891298921778798103, 591.54058079860396901494823396205902, 592.07470810633878954831743612885475, 592.60931770048057387612061575055122, 593.14441001650561702263075858354568, 593.67998549028345678379992023110390, 594.21604455807937483768910169601440, 594.75258765655041770514799281954765, 595.28961522274778417340712621808052, 595.82712769411966746702091768383980, 596.36512550850693514803424477577209, 596.90360910414585760008776560425758, 597.44257891967060913884779438376427, 597.98203539410906159901060163974762, 598.52197896688574019208317622542381, 599.06241007782409724313765764236450, 599.60332916714241946465335786342621, 600.14473667545644275378435850143433, 600.68663304378230805014027282595634, 601.22901871353167280176421627402306, 601.77189412651500788342673331499100, 602.31525972494398502021795138716698, 602.85911595142738406138960272073746, 603.40346324897336671710945665836334, 603.94830206099243241624208167195320, 604.49363283129355295386631041765213, 605.03945600408599148067878559231758, 605.58577202398259942128788679838181, 606.13258133599526900070486590266228, 606.67988438553800278896233066916466, 607.22768161842884637735551223158836, 607.77597348088647777331061661243439, 608.32476041953225376346381381154060, 608.87404288139316577144199982285500, 609.42382131389763344486709684133530, 609.97409616487811945262365043163300, 610.52486788257340322161326184868813, 611.07613691562517033162293955683708, 611.62790371307971781789092347025871, 612.18016872439159214991377666592598, 612.73293239941858701058663427829742, 613.28619518842469915398396551609039, 613.83995754208285688946489244699478, 614.39421991147048629500204697251320, 614.94898274807269444863777607679367, 615.50424650378397473104996606707573, 616.06001163090513728093355894088745, 616.61627858214490061072865501046181, 617.17304781062341589858988299965858, 617.73031976986749214120209217071533, 618.28809491381343832472339272499084, 618.84637369680979190889047458767891, 619.40515657361311241402290761470795, 619.96444399939048253145301714539528, 620.52423642972223660763120278716087, 621.08453432059786791796796023845673, 621.64533812841864346410147845745087, 622.20664831000010508432751521468163, 622.76846532256797672744141891598701, 623.33078962376089293684344738721848, 623.89362167163312733464408665895462, 624.45696192464993146131746470928192, 625.02081084169083169399527832865715, 625.58516888205190298322122544050217, 626.15003650544144875311758369207382, 626.71541417198318413284141570329666, 627.28130234221850969333900138735771, 627.84770147710207766067469492554665, 628.41461203800508883432485163211823, 628.98203448671745263709453865885735, 629.54996928544392176263500005006790, 630.11841689680636591219808906316757, 630.68737778384684133925475180149078, 631.25685241002327074966160580515862, 631.82684123921171703841537237167358, 632.39734473570990758162224665284157, 632.96836336423189095512498170137405, 633.53989758991190228698542341589928, 634.11194787830606856005033478140831, 634.68451469538888431998202577233315, 635.25759850755525803833734244108200, 635.83119978162380903086159378290176, 636.40531898483231998397968709468842, 636.97995658484035175206372514367104, 637.55511304973208552837604656815529, 638.13078884801200274523580446839333, 638.70698444860784093179972842335701, 639.28370032087286745081655681133270, 639.86093693458167308563133701682091, 640.43869475993346895847935229539871, 641.01697426755390551988966763019562, 641.59577592849166194355348125100136, 642.17510021422026511572767049074173, 642.75494759664184130087960511445999, 643.33531854808188654715195298194885, 643.91621354129244991781888529658318, 644.49763304945486197539139539003372, 645.07957754617530099494615569710732, 645.66204750548774882190627977252007, 646.24504340185637829563347622752190, 646.82856571017146052327007055282593, 647.41261490575197967700660228729248, 647.99719146434881622553803026676178, 648.58229586213963102636625990271568, 649.16792857573238961776951327919960, 649.75409008216740858188131824135780, 650.34078085891371756588341668248177, 650.92800138387133301876019686460495, 651.51575213537421404907945543527603, 652.10403359218571495148353278636932, 652.69284623350165475130779668688774, 653.28219053895270462817279621958733, 653.87206698860063625033944845199585, 654.46247606294014076411258429288864, 655.05341824290269414632348343729973, 655.64489400985110023611923679709435, 656.23690384558335608744528144598007, 656.82944823233447095844894647598267, 657.42252765277271464583463966846466, 658.01614259000200490845600143074989, 658.61029352756509069877211004495621, 659.20498094943866362882545217871666, 659.80020534003676857537357136607170, 660.39596718421285004296805709600449, 660.99226696725611418514745309948921, 661.58910517489368885435396805405617, 662.18648229329380683338968083262444, 662.78439880906125836190767586231232, 663.38285520924011962051736190915108, 663.98185198131693596224067732691765, 664.58138961321571969165233895182610, 665.18146859330101960949832573533058, 665.78208941038110424415208399295807, 666.38325255370295963075477629899979, 666.98495851295513148215832188725471, 667.58720777827113579405704513192177, 668.19000084022457031096564605832100, 668.79333818983161563664907589554787, 669.39722031855478689976735040545464, 670.00164771829736309882719069719315, 670.60662088140736614150227978825569, 671.21214030067937983403680846095085, 671.81820646935057084192521870136261, 672.42481988110375823453068733215332, 673.03198103006957353500183671712875, 673.63969041082270905462792143225670, 674.24794851838430531643098220229149, 674.85675584822479322610888630151749, 675.46611289625968765903962776064873, 676.07602015885231594438664615154266, 676.68647813281666003604186698794365, 677.29748731541258166544139385223389, 677.90904820434923294669715687632561, 678.52116129778755748702678829431534, 679.13382709433574291324475780129433, 679.74704609305217672954313457012177, 680.36081879344862954894779250025749, 680.97514569548513918562093749642372, 681.59002729957319388631731271743774, 682.20546410657868818816496059298515, 682.82145661781726175831863656640053, 683.43800533505736893857829272747040, 684.05511076052266616898123174905777, 684.67277339688814663531957194209099, 685.29099374728241400589467957615852, 685.90977231529109303664881736040115, 686.52910960495205472398083657026291, 687.14900612075791741517605260014534, 687.76946236765968478721333667635918, 688.39047885106162993906764313578606, 689.01205607682447862316621467471123, 689.63419455126825141633162274956703, 690.25689478116748887259745970368385, 690.88015727375432106782682240009308, 691.50398253672165083116851747035980, 692.12837107821792415052186697721481, 692.75332340685065446450607851147652, 693.37884003168903745972784236073494, 694.00492146225951728411018848419189, 694.63156820854851503099780529737473, 695.25878078100538459693780168890953, 695.88655969053786520817084237933159, 696.51490544851537833892507478594780, 697.14381856677107407449511811137199, 697.77329955759807944559725001454353, 698.40334893375199953879928216338158, 699.03396720845410072797676548361778, 699.66515489538608107977779582142830, 700.29691250869404939294327050447464, 700.92924056299034418771043419837952, 701.56213957335000941384350880980492, 702.19561005531261344003723934292793, 702.82965252488622809323715046048164, 703.46426749854185800359118729829788, 704.09945549321730595693225041031837, 704.73521702631944663153262808918953, 705.37155261571967912459513172507286, 706.00846277975722387054702267050743, 706.64594803724185112514533102512360, 707.28400890744921980513026937842369, 707.92264591012383334600599482655525, 708.56185956548199555982137098908424, 709.20165039420726316166110336780548, 709.84201891745328794058877974748611, 710.48296565684688630426535382866859, 711.12449113448349180544028058648109, 711.76659587292954256554367020726204, 712.40928039522623294033110141754150, 713.05254522488428392534842714667320, 713.69639088588735376106342300772667, 714.34081790269453904329566285014153, 714.98582680023594093654537573456764, 715.63141810391584840544965118169785, 716.27759233961535301205003634095192, 716.92435003368780144228367134928703, 717.57169171296197873743949458003044, 718.21961790474483677826356142759323, 718.86812913681683312461245805025101, 719.51722593743488687323406338691711, 720.16690883533590294973691925406456, 720.81717835973120145354187116026878, 721.46803504031004194985143840312958, 722.11947940724257932743057608604431, 722.77151199117531632509781047701836, 723.42413332323337726847967132925987, 724.07734393502471448300639167428017, 724.73114435863408289151266217231750, 725.38553512662701905355788767337799, 726.04051677205256964953150600194931, 726.69608982843828925979323685169220, 727.35225482979365096980473026633263, 728.00901231061277485423488542437553, 728.66636280586988050345098599791527, 729.32430685102212919446174055337906, 729.98284498201303449604893103241920, 730.64197773526723267423221841454506, 731.30170564769355223688762634992599, 731.96202925668865191255463287234306, 732.62294910013144999538781121373177, 733.28446571638664863712619990110397, 733.94657964430791707854950800538063, 734.60929142323243468126747757196426, 735.27260159298464259336469694972038, 735.93651069387897223350591957569122, 736.60101926671518413058947771787643, 737.26612785278109640785260125994682, 737.93183699385633644851623103022575, 738.59814723220665655389893800020218, 739.26505911058779929589945822954178, 739.93257317224788494058884680271149, 740.60068996092320503521477803587914, 741.26941002084072351863142102956772, 741.93873389672194207378197461366653, 742.60866213377698841213714331388474, 743.27919527770859531301539391279221, 743.95033387471494279452599585056305, 744.62207847148454220587154850363731, 745.29442961519964683247962966561317, 745.96738785353920775378355756402016, 746.64095373467421268287580460309982, 747.31512780727018707693787291646004, 747.98991062049128686339827254414558, 748.66530272399438672437099739909172, 749.34130466793294544913806021213531, 750.01791700295973441825481131672859, 750.69514028022229013004107400774956, 751.37297505136530162417329847812653, 752.05142186853470320784253999590874, 752.73048128437221748754382133483887, 753.41015385201842491369461640715599, 754.09044012511617438576649874448776, 754.77134065780546734458766877651215, 755.45285600472664100379915907979012, 756.13498672102366526814876124262810, 756.81773336233891313895583152770996, 757.50109648481645763240521773695946, 758.18507664510559607151662930846214, 758.86967440035493837058311328291893, 759.55489030821684082184219732880592, 760.24072492684922508487943559885025, 760.92717881491194020782131701707840, 761.61425253156869530357653275132179, 762.30194663649126596283167600631714, 762.99026168985380991216516122221947, 763.67919825233616393234115093946457, 764.36875688512759552395436912775040, 765.05893814992100487870629876852036, 765.74974260891644917137455195188522, 766.44117082482455316494451835751534, 767.13322336086127961607417091727257, 767.82590078075088513287482783198357, 768.51920364872989921423140913248062, 769.21313252954098516056546941399574, 769.90768798843703279999317601323128, 770.60287059118411434610607102513313, 771.29868090405636849027359858155251, 771.99511949383918363309931010007858, 772.69218692783249480271479114890099, 773.38988377384566774708218872547150, 774.08821060020090953912585973739624, 774.78716797573622443451313301920891, 775.48675646980063902447000145912170, 776.18697665225715809356188401579857, 776.88782909348594785114983096718788, 777.58931436437967477104393765330315, 778.29143303634646144928410649299622, 778.99418568131306983559625223278999, 779.69757287171989901253255084156990, 780.40159518052428211376536637544632, 781.10625318120366955554345622658730, 781.81154744775039944215677678585052, 782.51747855467544923158129677176476, 783.22404707701093684590887278318405, 783.93125359030568688467610627412796, 784.63909867062807279580738395452499, 785.34758289456942748074652627110481, 786.05670683923904107359703630208969, 786.76647108226711679890286177396774, 787.47687620180829526361776515841484, 788.18792277653665223624557256698608, 788.89961138564831344410777091979980, 789.61194260886566098633920773863792, 790.32491702643153530516428872942924, 791.03853521911264579102862626314163, 791.75279776820298138773068785667419, 792.46770525551869468472432345151901, 793.18325826340094408806180581450462, 793.89945737471998654655180871486664, 794.61630317286915214936016127467155, 795.33379624176882316533010452985764, 796.05193716586938990076305344700813, 796.77072653014590741804568096995354, 797.49016492010196088813245296478271, 798.21025292177250776148866862058640, 798.93099112171876186039298772811890, 799.65238010703171767090680077672005, 800.37442046533510620065499097108841, 801.09711278478062013164162635803223, 801.82045765405098336486844345927238, 802.54445566236313425179105252027512, 803.26910739946333706029690802097321, 803.99441345563036520616151392459869, 804.72037442167879817134235054254532, 805.44699088895390559628140181303024, 806.17426344933471682452363893389702, 806.90219269523788625519955530762672, 807.63077921961178162746364250779152, 808.36002361594023568613920360803604, 809.08992647824618416052544489502907, 809.82048840108552667516050860285759, 810.55170997955133316281717270612717, 811.28359180927679972228361293673515, 812.01613448643013271066593006253242, 812.74933860771784566168207675218582, 813.48320477038794251711806282401085, 814.21773357222502909280592575669289, 814.95292561155349631007993593811989, 815.68878148724070342723280191421509, 816.42530179869186213181819766759872, 817.16248714585356083262013271450996, 817.90033812921706157794687896966934, 818.63885534981272940058261156082153, 819.37803940921355660975677892565727, 820.11789090953902814362663775682449, 820.85841045344898248004028573632240, 821.59959864414759067585691809654236, 822.34145608538676697207847610116005, 823.08398338146025707828812301158905, 823.82718113720784458564594388008118, 824.57104995801819313783198595046997, 825.31559044982373052334878593683243, 826.06080321910383190697757527232170, 826.80668887288868518226081505417824, 827.55324801875349294277839362621307, 828.30048126482199677411699667572975, 829.04838921977022891951492056250572, 829.79697249282071425113826990127563, 830.54623169374599456205032765865326, 831.29616743287238023185636848211288, 832.04678032107403851114213466644287, 832.79807096977697256079409271478653, 833.55003999096209099661791697144508, 834.30268799715986460796557366847992, 835.05601560145407802338013425469398, 835.81002341748478556837653741240501, 836.56471205944342273141955956816673, 837.32008214207576202170457690954208, 838.07613428068577832164010033011436, 838.83286909113007823179941624403000, 839.59028718982108330237679183483124, 840.34838919373123644618317484855652, 841.10717572038663547573378309607506, 841.86664738787123951624380424618721, 842.62680481483005223708460107445717, 843.38764862046355119673535227775574, 844.14917942453155319526558741927147, 844.91139784735628381895367056131363, 845.67430450981714784575160592794418, 846.43790003335413985041668638586998, 847.20218503997148218331858515739441, 847.96716015223194062855327501893044, 848.73282599326034869591239839792252, 849.49918318674747297336580231785774, 850.26623235694376035098684951663017, 851.03397412866377180762356147170067, 851.80240912728902458184165880084038, 852.57153797876287626422708854079247, 853.34136130959348065516678616404533, 854.11187974685822155151981860399246, 854.88309391819745997054269537329674, 855.65500445181805844185873866081238, 856.42761197649747373361606150865555, 857.20091712157773145008832216262817, 857.97492051696906401048181578516960, 858.74962279315377600141800940036774, 859.52502458118010508769657462835312, 860.30112651266620105161564424633980, 861.07792921980365008494118228554726, 861.85543333535179044702090322971344, 862.63363949264112306991592049598694, 863.41254832557740428455872461199760, 864.19216046863539304467849433422089, 864.97247655686282996612135320901871, 865.75349722588430267933290451765060, 866.53522311189453830593265593051910, 867.31765485166340567957377061247826, 868.10079308253830276953522115945816, 868.88463844243949552037520334124565, 869.66919156986284633603645488619804, 870.45445310388402049284195527434349, 871.24042368415268811077112331986427, 872.02710395089593475859146565198898, 872.81449454492224049317883327603340, 873.60259610761534077028045430779457, 874.39140928093831917067291215062141, 875.18093470743701800529379397630692, 875.97117303023401291284244507551193, 876.76212489303316033328883349895477, 877.55379094012209861830342561006546, 878.34617181636758687091059982776642, 879.13926816721811974275624379515648, 879.93308063870870228129206225275993, 880.72760987745414240635000169277191, 881.52285653065314363630022853612900, 882.31882124609228412737138569355011, 883.11550467213930915022501721978188, 883.91290745774801962397759780287743, 884.71103025246088691346812993288040, 885.50987370640393692156067118048668, 886.30943847029004700743826106190681, 887.10972519542326608643634244799614, 887.91073453369199341977946460247040, 888.71246713757352608809014782309532, 889.51492366013758328335825353860855, 890.31810475504016721970401704311371, 891.12201107652754217269830405712128, 891.92664327944009983184514567255974, 892.73200201920610652450704947113991, 893.53808795184556856838753446936607, 894.34490173397455237136455252766609, 895.15244402279802216071402654051781, 895.96071547611506957764504477381706, 896.76971675232164216140517964959145, 897.57944851040485900739440694451332, 898.38991140994710349332308396697044, 899.20110611112932019750587642192841, 900.01303327472567161748884245753288, 900.82569356210649402783019468188286, 901.63908763524295864044688642024994, 902.45321615670047776802675798535347, 903.26807978964279755018651485443115, 904.08367919783563593227881938219070, 904.90001504564111201034393161535263, 905.71708799802070188889047130942345, 906.53489872054001352807972580194473, 907.35344787936219290713779628276825, 908.17273614125178937683813273906708, 908.99276417357884838565951213240623, 909.81353264431265870371134951710701, 910.63504222202573146205395460128784, 911.45729357589732444466790184378624, 912.28028737570787143340567126870155, 913.10402429184239281312329694628716, 913.92850499529470198467606678605080, 914.75373015766115258884383365511894, 915.57970045114427648513810709118843, 916.40641654855733122531091794371605, 917.23387912331725146941607818007469, 918.06208884944942383299348875880241, 918.89104640159087011852534487843513, 919.72075245498479034722549840807915, 920.55120768548363230365794152021408, 921.38241276955398006975883617997169, 922.21436838426939175406005233526230, 923.04707520731506065203575417399406, 923.88053391699145322490949183702469, 924.71474519220794263674179092049599, 925.54970971248701516742585226893425, 926.38542815796836293884553015232086, 927.22190120940194901777431368827820, 928.05912954815266857622191309928894, 928.89711385620421424391679465770721, 929.73585481615225489804288372397423, 930.57535311120921051042387261986732, 931.41560942520754906581714749336243, 932.25662444259398853318998590111732, 933.09839884843302115768892690539360, 933.94093332841134724731091409921646, 934.78422856883116764947772026062012, 935.62828525661461753770709037780762, 936.47310407930740439041983336210251, 937.31868572507266890170285478234291, 938.16503088269462296011624857783318, 939.01214024158332449587760493159294, 939.86001449176762889692327007651329, 940.70865432389928173506632447242737, 941.55806042925757992634316906332970, 942.40823349974209577339934185147285, 943.25917422787722443899838253855705, 944.11088330681650404585525393486023, 944.96336143033533971902215853333473, 945.81660929283589211991056799888611, 946.67062758935082911193603649735451, 947.52541701553684561076806858181953, 948.38097826767875631048809736967087, 949.23731204269336103607201948761940, 950.09441903812376040150411427021027, 950.95229995214253904123324900865555, 951.81095548355608571000630035996437, 952.67038633179845419363118708133698, 953.53059319693534234829712659120560, 954.39157677966795745305716991424561, 955.25333778132664974691579118371010, 956.11587690387500515498686581850052, 956.97919484991416538832709193229675, 957.84329232267577935999725013971329, 958.70817002602700540592195466160774, 959.57382866447358082950813695788383, 960.44026894315413755975896492600441, 961.30749156784384013008093461394310, 962.17549724495881946495501324534416, 963.04428668154946535651106387376785, 963.91386058530440550384810194373131, 964.78421966455528036021860316395760, 965.65536462826912611490115523338318, 966.52729618605371797457337379455566, 967.40001504816086708160582929849625, 968.27352192547994036431191489100456, 969.14781752954263538413215428590775, 970.02290257252639094076585024595261, 970.89877776724824798293411731719971, 971.77544382716871496086241677403450, 972.65290146639631529978942126035690, 973.53115139968065250286599621176720, 974.41019434241673025098862126469612, 975.29003101064915881579509004950523, 976.17066212106544753623893484473228, 977.05208839100032491842284798622131, 977.93431053843960398808121681213379, 978.81732928201392951450543478131294, 979.70114534100309811037732288241386, 980.58575943533946883690077811479568, 981.47117228560216517507797107100487, 982.35738461302094037819188088178635, 983.24439713948027019796427339315414, 984.13221058751310010848101228475571, 985.02082568030436959816142916679382, 985.91024314169601439061807468533516, 986.80046369617957680020481348037720, 987.69148806890120795287657529115677, 988.58331698566507839132100343704224, 989.47595117292735267255920916795731, 990.36939135779982734675286337733269, 991.26363826805470580438850447535515, 992.15869263211789075285196304321289, 993.05455517907239482156001031398773, 993.95122663866391121700871735811234, 994.84870774129285564413294196128845, 995.74699921801936852716607972979546, 996.64610180056740773579804226756096, 997.54601622131792737491196021437645, 998.44674321331319788441760465502739, 999.34828351026089876540936529636383, 1000.25063784652775211725383996963501, 1001.15380695714338799007236957550049, 1002.05779157780489185824990272521973, 1002.96259244487009709700942039489746, 1003.86821029536145033489447087049484, 1004.77464586697078630095347762107849, 1005.68189989805227924080099910497665, 1006.58997312762676301645115017890930, 1007.49886629538605120615102350711823, 1008.40858014168611589411739259958267, 1009.31911540755163514404557645320892, 1010.23047283467997203842969611287117, 1011.14265316543435346829937770962715, 1012.05565714284864498040406033396721, 1012.96948551063087506918236613273621, 1013.88413901315743714803829789161682, 1014.79961839547627278079744428396225, 1015.71592440331232864991761744022369, 1016.63305778305982585152378305792809, 1017.55101928178692105575464665889740, 1018.46980964724036766710923984646797, 1019.38942962783801249315729364752769, 1020.30987997267379796539898961782455, 1021.23116143152140011807205155491829, 1022.15327475482820318575249984860420, 1023.07622069371871020848629996180534, 1024.00000000000000000000000000000000, 1024.92461342615365538222249597311020, 1025.85006172534099277982022613286972, 1026.77634565140738232003059238195419, 1027.70346595887440344085916876792908, 1028.63142340294575660664122551679611, 1029.56021873950999179214704781770706, 1030.48985272513527888804674148559570, 1031.42032611707236355869099497795105, 1032.35163967325956946297083050012589, 1033.28379415231574967037886381149292, 1034.21679031354528888186905533075333, 1035.15062891694128666131291538476944, 1036.08531072317964571993798017501831, 1037.02083649362293726881034672260284, 1037.95720699032517586601898074150085, 1038.89442297602454345906153321266174, 1039.83248521414816423202864825725555, 1040.77139446881596995808649808168411, 1041.71115150483410616288892924785614, 1042.65175708769925222441088408231735, 1043.59321198360362359380815178155899, 1044.53551695942678634310141205787659, 1045.47867278274111413338687270879745, 1046.42268022181542619364336133003235, 1047.36754004560930297884624451398849, 1048.31325302377558728039730340242386, 1049.25981992666697806271258741617203, 1050.20724152532693551620468497276306, 1051.15551859149559277284424751996994, 1052.10465189761407600599341094493866, 1053.05464221681654635176528245210648, 1054.00549032293542950355913490056992, 1054.95719699050596318556927144527435, 1055.90976299475892119517084211111069, 1056.86318911162447875540237873792648, 1057.81747611773789685685187578201294, 1058.77262479043179155269172042608261, 1059.72863590774022668483667075634003, 1060.68551024840417085215449333190918, 1061.64324859186331195815000683069229, 1062.60185171826196892652660608291626, 1063.56132040845182018529158085584641, 1064.52165544398644669854547828435898, 1065.48285760712474257161375135183334, 1066.44492768083568989823106676340103, 1067.40786644879199229762889444828033, 1068.37167469537325814599171280860901, 1069.33635320567168491834308952093124, 1070.30190276548455585725605487823486, 1071.26832416131787795166019350290298, 1072.23561818039274839975405484437943, 1073.20378561063671440933831036090851, 1074.17282724068877541867550462484360, 1075.14274385990370319632347673177719, 1076.11353625834567537822294980287552, 1077.08520522679191344650462269783020, 1078.05775155673745757667347788810730, 1079.03117604038811805367004126310349, 1080.00547947066547749273013323545456, 1080.98066264121052881819196045398712, 1081.95672634637708142690826207399368, 1082.93367138123630866175517439842224, 1083.91149854158106791146565228700638, 1084.89020862391885202669072896242142, 1085.86980242547633679350838065147400, 1086.85028074420438315428327769041061, 1087.83164437876985175535082817077637, 1088.81389412856083254155237227678299, 1089.79703079369164697709493339061737, 1090.78105517499466259323526173830032, 1091.76596807402552258281502872705460, 1092.75177029306746590009424835443497, 1093.73846263512427867681253701448441, 1094.72604590392484169569797813892365, 1095.71452090392767786397598683834076, 1096.70388844031367625575512647628784, 1097.69414931899086695921141654253006, 1098.68530434659896855009719729423523, 1099.67735433050188476045150309801102, 1100.67030007879270669945981353521347, 1101.66414240029803295328747481107712, 1102.65888210457092100114095956087112, 1103.65452000189520731510128825902939, 1104.65105690329073695465922355651855, 1105.64849362050517811439931392669678, 1106.64683096601947909221053123474121, 1107.64606975305241576279513537883759, 1108.64621079555240612535271793603897, 1109.64725490820342201914172619581223, 1110.64920290642862710228655487298965, 1111.65205560638401038886513561010361, 1112.65581382496156948036514222621918, 1113.66047837979613177594728767871857, 1114.66605008925580477807670831680298, 1115.67252977244811518175993114709854, 1116.67991824922387422702740877866745, 1117.68821634017058386234566569328308, 1118.69742486661630209709983319044113, 1119.70754465063509996980428695678711, 1120.71857651503887609578669071197510, 1121.73052128338304100907407701015472, 1122.74337977996992776752449572086334, 1123.75715282984265286359004676342010, 1124.77184125878920895047485828399658, 1125.78744589334723968931939452886581, 1126.80396756079676379158627241849899, 1127.82140708916449511889368295669556, 1128.83976530722907227755058556795120, 1129.85904304451355528726708143949509, 1130.87924113128951830731239169836044, 1131.90036039858296135207638144493103, 1132.92240167816589746507816016674042, 1133.94536580256090019247494637966156, 1134.96925360504701529862359166145325, 1135.99406591965134794008918106555939, 1137.01980358115406488650478422641754, 1138.04646742509316936775576323270798, 1139.07405828775722511636558920145035, 1140.10257700618967646732926368713379, 1141.13202441819385057897306978702545, 1142.16240136232568147534038871526718, 1143.19370867789825751970056444406509, 1144.22594720498614151438232511281967, 1145.25911778441877686418592929840088, 1146.29322125778503504989203065633774, 1147.32825846743730835441965609788895, 1148.36423025648468865256290882825851, 1149.40113746879751488449983298778534, 1150.43898094901237527665216475725174, 1151.47776154252392188936937600374222, 1152.51748009549100970616564154624939, 1153.55813745483965249150060117244720, 1154.59973446825733844889327883720398, 1155.64227198419621345237828791141510, 1156.68575085187899276206735521554947, 1157.73017192129145769285969436168671, 1158.77553604318609359324909746646881, 1159.82184406908845630823634564876556, 1160.86909685128830460598692297935486, 1161.91729524284505714604165405035019, 1162.96644009759279470017645508050919, 1164.01653227013230207376182079315186, 1165.06757261583584295294713228940964, 1166.11956199085216212552040815353394, 1167.17250125209943689696956425905228, 1168.22639125726914244296494871377945, 1169.28123286483105403021909296512604, 1170.33702693402665317989885807037354, 1171.39377432487299302010796964168549, 1172.45147589816747313307132571935654, 1173.51013251548124571854714304208755, 1174.56974503916262619895860552787781, 1175.63031433234323230863083153963089, 1176.69184125893025338882580399513245, 1177.75432668360986099287401884794235, 1178.81777147185425747011322528123856, 1179.88217648991235364519525319337845, 1180.94754260481522578629665076732635, 1182.01387068438111782597843557596207, 1183.08116159720793802989646792411804, 1184.14941621267757909663487225770950, 1185.21863540096114775224123150110245, 1186.28882003301123404526151716709137, 1187.35997098056691356759984046220779, 1188.43208911615874967537820339202881, 1189.50517531310083541029598563909531, 1190.57923044549556834681425243616104, 1191.65425538823933493404183536767960, 1192.73025101701387029606848955154419, 1193.80721820829171520017553120851517, 1194.88515783934121827769558876752853, 1195.96407078821812319802120327949524, 1197.04395793377148038416635245084763, 1198.12482015564819448627531528472900, 1199.20665833428483892930671572685242, 1200.28947335091288550756871700286865, 1201.37326608756461610028054565191269, 1202.45803742706334560352843254804611, 1203.54378825303001576685346662998199, 1204.63051944988797004043590277433395, 1205.71823190285476812277920544147491, 1206.80692649794673343421891331672668, 1207.89660412198486483248416334390640, 1208.98726566258710590773262083530426, 1210.07891200817198296135757118463516, 1211.17154404796519884257577359676361, 1212.26516267199053800140973180532455, 1213.35976877107600557792466133832932, 1214.45536323685769275471102446317673, 1215.55194696177295554662123322486877, 1216.64952083906450752692762762308121, 1217.74808576278633154288399964570999, 1218.84764262779526688973419368267059, 1219.94819232975623890524730086326599, 1221.04973576514680644322652369737625, 1222.15227383125034066324587911367416, 1223.25580742615943563578184694051743, 1224.36033744878318429982755333185196, 1225.46586479883717402117326855659485, 1226.57239037684939830796793103218079, 1227.67991508416571377892978489398956, 1228.78843982294097259000409394502640, 1229.89796549614538889727555215358734, 1231.00849300756794946209993213415146, 1232.12002326181027456186711788177490, 1233.23255716428980122145731002092361, 1234.34609562124683179717976599931717, 1235.46063953973498428240418434143066, 1236.57618982762687664944678544998169, 1237.69274739361958381778094917535782, 1238.81031314722622482804581522941589, 1239.92888799878096506290603429079056, 1241.04847285944447321526240557432175, 1242.16906864119573583593592047691345, 1243.29067625683728692820295691490173, 1244.41329662000021016865503042936325, 1245.53693064513595345488283783197403, 1246.66157924752178587368689477443695, 1247.78724334326625466928817331790924, 1248.91392384929986292263492941856384, 1250.04162168338166338799055665731430, 1251.17033776410380596644245088100433, 1252.30007301088289750623516738414764, 1253.43082834396636826568283140659332, 1254.56260468443701938667800277471542, 1255.69540295420415532134938985109329, 1256.82922407601017766864970326423645, 1257.96406897343490527418907731771469, 1259.09993857088784352527000010013580, 1260.23683379361273182439617812633514, 1261.37475556769368267850950360298157, 1262.51370482004654149932321161031723, 1263.65368247842343407683074474334717, 1264.79468947141981516324449330568314, 1265.93672672846378191024996340274811, 1267.07979517982380457397084683179855, 1268.22389575661213712010066956281662, 1269.36902939077776863996405154466629, 1270.51519701511051607667468488216400, 1271.66239956324761806172318756580353, 1272.81063796966463996795937418937683, 1273.95991316968070350412745028734207, 1275.11022609946417105675209313631058, 1276.26157769602400549047160893678665, 1277.41396889721568186359945684671402, 1278.56740064174573490163311362266541, 1279.72187386916334617126267403364182, 1280.87738951986693791695870459079742, 1282.03394853510781103977933526039124, 1283.19155185698332388710696250200272, 1284.35020042844053023145534098148346, 1285.50989519328368260175921022891998, 1286.67063709616377309430390596389771, 1287.83242708258489983563777059316635, 1288.99526609890972395078279078006744, 1290.15915509235060198989231139421463, 1291.32409501097549764381255954504013, 1292.49008680371275659126695245504379, 1293.65713142034292104654014110565186, 1294.82522981150395935401320457458496, 1295.99438292869763245107606053352356, 1297.16459172427926205273251980543137, 1298.33585715146477923553902655839920, 1299.50818016433481716376263648271561, 1300.68156171782743513176683336496353, 1301.85600276774266603752039372920990, 1303.03150427074842809815891087055206, 1304.20806718437142990296706557273865, 1305.38569246700330950261559337377548, 1306.56438107790540925634559243917465, 1307.74413397720127250067889690399170, 1308.92495212588028152822516858577728, 1310.10683648580538829264696687459946, 1311.28978801970220047223847359418869, 1312.47380769116671217489056289196014, 1313.65889646466894191689789295196533, 1314.84505530554542929166927933692932, 1316.03228518000400981691200286149979, 1317.22058705513018139754422008991241, 1318.40996189887732725765090435743332, 1319.60041068007353715074714273214340, 1320.79193436842570008593611419200897, 1321.98453393451222837029490619897842, 1323.17821034978737770870793610811234, 1324.37296458658761366677936166524887, 1325.56879761812251672381535172462463, 1326.76571041848023924103472381830215, 1327.96370396263387192448135465383530, 1329.16277922643143938330467790365219, 1330.36293718660203921899665147066116, 1331.56417882076220848830416798591614, 1332.76650510740591926150955259799957, 1333.96991702591026296431664377450943, 1335.17441555654227158811409026384354, 1336.38000168044914062193129211664200, 1337.58667637966323127329815179109573, 1338.79444063710957379953470081090927, 1340.00329543659472619765438139438629, 1341.21324176281473228300455957651138, 1342.42428060135875966807361692190170, 1343.63641293870114168385043740272522, 1344.84963976220751646906137466430664, 1346.06396206013914707000367343425751, 1347.27938082164541810925584286451340, 1348.49589703676861063286196440458298, 1349.71351169644958645221777260303497, 1350.93222579251937531807925552129745, 1352.15204031770463188877329230308533, 1353.37295626563332007208373397588730, 1354.59497463082516333088278770446777, 1355.81809640869846589339431375265121, 1357.04232259557511497405357658863068, 1358.26765418867148582648951560258865, 1359.49409218610435345908626914024353, 1360.72163758689725909789558500051498, 1361.95029139097027837124187499284744, 1363.18005459914638777263462543487549, 1364.41092821315737637632992118597031, 1365.64291323563452351663727313280106, 1366.87601067011473787715658545494080, 1368.11022152104533233796246349811554, 1369.34554679377629327063914388418198, 1370.58198749456482801178935915231705, 1371.81954463058218607329763472080231, 1373.05821920990410944796167314052582, 1374.29801224151583483035210520029068, 1375.53892473531936957442667335271835, 1376.78095770212325987813528627157211, 1378.02411215364895724633242934942245, 1379.26838910253650283266324549913406, 1380.51378956233497774519491940736771, 1381.76031454750864213565364480018616, 1383.00796507344330166233703494071960, 1384.25674215643584830104373395442963, 1385.50664681370130892901215702295303, 1386.75768006337807491945568472146988, 1388.00984292451903456822037696838379, 1389.26313641709703006199561059474945, 1390.51756156201076919387560337781906, 1391.77311938107573041634168475866318, 1393.02981089703075667785014957189560, 1394.28763713354214814899023622274399, 1395.54659911519615889119450002908707, 1396.80669786750399907759856432676315, 1398.06793441690820145595353096723557, 1399.33030979077216215955559164285660, 1400.59382501738809878588654100894928, 1401.85848112598068837542086839675903, 1403.12427914670001882768701761960983, 1404.39122011062522688007447868585587, 1405.65930504977245618647430092096329, 1406.92853499708371600718237459659576, 1408.19891098643461191386450082063675, 1409.47043405263889326306525617837906, 1410.74310523143935824919026345014572, 1412.01692555951444774109404534101486, 1413.29189607448370225029066205024719, 1414.56801781489843961026053875684738, 1415.84529182024766669201198965311050, 1417.12371913096399111964274197816849, 1418.40330078841452632332220673561096, 1419.68403783490657588117755949497223, 1420.96593131369377260853070765733719, 1422.24898226896698361088056117296219, 1423.53319174585908513108734041452408, 1424.81856079045246588066220283508301, 1426.10509044976856785069685429334641, 1427.39278177177470752212684601545334, 1428.68163580538907808659132570028305, 1429.97165360047188187309075146913528, 1431.26283620783169681089930236339569, 1432.55518467923070602410007268190384, 1433.84870006737560288456734269857407, 1435.14338342592395747487898916006088, 1436.43923580948967355652712285518646, 1437.73625827363366624922491610050201, 1439.03445187486977374646812677383423, 1440.33381767067180589947383850812912, 1441.63435671946240290708374232053757, 1442.93607008062008389970287680625916, 1444.23895881448515865486115217208862, 1445.54302398235063265019562095403671, 1446.84826664646675453695934265851974, 1448.15468787004942896601278334856033, 1449.46228871726816578302532434463501, 1450.77107025325403810711577534675598, 1452.08103354410513929906301200389862, 1453.39217965687657851958647370338440, 1454.70450965958730193960946053266525, 1456.01802462122554970846977084875107, 1457.33272561173976100690197199583054, 1458.64861370204425838892348110675812, 1459.96568996402606899209786206483841, 1461.28395547053446534846443682909012, 1462.60341129538710447377525269985199, 1463.92405851337730382510926574468613, 1465.24589820026289999077562242746353, 1466.56893143277329727425239980220795, 1467.89315928861583415709901601076126, 1469.21858284646486936253495514392853, 1470.54520318596928518672939389944077, 1471.87302138775794446701183915138245, 1473.20203853343036826117895543575287, 1474.53225570556219281570520251989365, 1475.86367398771267289703246206045151, 1477.19629446441331310779787600040436, 1478.53011822117559859179891645908356, 1479.86514634449576988117769360542297, 1481.20137992184641007042955607175827, 1482.53882004168144703726284205913544, 1483.87746779344388414756394922733307, 1485.21732426755397682427428662776947, 1486.55839055541719062603078782558441, 1487.90066774942988558905199170112610, 1489.24415694296908441174309700727463, 1490.58885923039929366495925933122635, 1491.93477570707841550756711512804031, 1493.28190746934842536575160920619965, 1494.63025561454037415387574583292007, 1495.97982124098257372679654508829117, 1497.33060544798877344874199479818344, 1498.68260933586589089827612042427063, 1500.03583400591946883650962263345718, 1501.39028056044458026008214801549911, 1502.74595010273060324834659695625305, 1504.10284373706940641568507999181747, 1505.46096256874443497508764266967773, 1506.82030770403684982738923281431198, 1508.18088025023234877153299748897552, 1509.54268131561093468917533755302429, 1510.90571200945328200759831815958023, 1512.26997344204733053629752248525620, 1513.63546672467782627791166305541992, 1515.00219296963291526481043547391891, 1516.37015329021119214303325861692429, 1517.73934880070987674116622656583786, 1519.10978061643368164368439465761185, 1520.48144985369845016975887119770050, 1521.85435762982388041564263403415680, 1523.22850506313739060715306550264359, 1524.60389327298253192566335201263428, 1525.98052337970761982433032244443893, 1527.35839650467232786468230187892914, 1528.73751377025519104790873825550079, 1530.11787629984200975741259753704071, 1531.49948521783289834274910390377045, 1532.88234164964910632988903671503067, 1534.26644672172255923214834183454514, 1535.65180156150177026574965566396713, 1537.03840729745979842846281826496124, 1538.42626505908197032113093882799149, 1539.81537597687406559998635202646255, 1541.20574118236822869221214205026627, 1542.59736180811273698054719716310501, 1543.99023898767836726619862020015717, 1545.38437385566498960542958229780197, 1546.77976754769133549416437745094299, 1548.17642120040181907825171947479248, 1549.57433595147244886902626603841782, 1550.97351293960127804894000291824341, 1552.37395330451431618712376803159714, 1553.77565818697189570229966193437576, 1555.17862872875934954208787530660629, 1556.58286607269292289856821298599243, 1557.98837136262613967119250446557999, 1559.39514574343979802506510168313980, 1560.80319036104856422753073275089264, 1562.21250636240733911108691245317459, 1563.62309489550079888431355357170105, 1565.03495710935089846316259354352951, 1566.44809415402187369181774556636810, 1567.86250718061137376935221254825592, 1569.27819734125614559161476790904999, 1570.69516578913885496149305254220963, 1572.11341367847808214719407260417938, 1573.53294216453423359780572354793549, 1574.95375240361659052723553031682968, 1576.37584555307330447249114513397217, 1577.79922277129662688821554183959961, 1579.22388521773132197267841547727585, 1580.64983405286307061032857745885849, 1582.07707043822529158205725252628326, 1583.50559553640596277546137571334839, 1584.93541051103738936944864690303802, 1586.36651652680188817612361162900925, 1587.79891474943997309310361742973328, 1589.23260634573830429872032254934311, 1590.66759248353764633066020905971527, 1592.10387433173877980152610689401627, 1593.54145306029181483609136193990707, 1594.98032984020392177626490592956543, 1596.42050584354501552297733724117279, 1597.86198224343752372078597545623779, 1599.30476021406343534181360155344009, 1600.74884093067021240130998194217682, 1602.19422556956124026328325271606445, 1603.64091530810196672973688691854477, 1605.08891132472626850358210504055023, 1606.53821479892667412059381604194641, 1607.98882691126073041232302784919739, 1609.44074884335759634268470108509064, 1610.89398177790781119256280362606049, 1612.34852689866943364904727786779404, 1613.80438539047577251039911061525345, 1615.26155843922356325492728501558304, 1616.72004723188047137227840721607208, 1618.17985295649236832105088979005814, 1619.64097680217105335032101720571518, 1621.10341995910266632563434541225433, 1622.56718361855359944456722587347031, 1624.03226897286026542133186012506485, 1625.49867721543569132336415350437164 };
 
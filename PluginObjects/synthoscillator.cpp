@@ -12,10 +12,6 @@ SynthOscillator::SynthOscillator(std::shared_ptr<SynthOscModifiers> _modifiers,
 	: ISynthComponent(_midiData, numOutputs, numModulators)
 	, modifiers(_modifiers)
 {
-	// --- clear out arrays
-	memset(sawTables, 0, kNumWaveTables * sizeof(double*));
-	memset(triangleTables, 0, kNumWaveTables * sizeof(double*));
-
 	// --- create tables
 	createWaveTables();
 
@@ -31,39 +27,35 @@ SynthOscillator::SynthOscillator(std::shared_ptr<SynthOscModifiers> _modifiers,
 	componentType = componentType::kPitchedOscillator;
 
 	// --- create modulators
-	modulators[kSynthOscPitchMod] = new Modulator(kDefaultOutputValueOFF, kSynthOsc_Pitch_ModRange, modTransform::kNoTransform);
-	modulators[kSynthOscToOscPitchMod] = new Modulator(kDefaultOutputValueOFF, kSynthOsc_Pitch_ModRange, modTransform::kNoTransform, true);/* priority modulator */
+	modulators[kSynthOscPitchMod] = createModulator(kDefaultOutputValueOFF, kSynthOsc_Pitch_ModRange, modTransform::kNoTransform);
+	modulators[kSynthOscToOscPitchMod] = createModulator(kDefaultOutputValueOFF, kSynthOsc_Pitch_ModRange, modTransform::kNoTransform, true);/* priority modulator */
 
-	modulators[kSynthOscLinFreqMod] = new Modulator(kDefaultOutputValueOFF, kSynthOsc_FM_PM_ModIndex, modTransform::kNoTransform, true);/* priority modulator */
+	modulators[kSynthOscLinFreqMod] = createModulator(kDefaultOutputValueOFF, kSynthOsc_FM_PM_ModIndex, modTransform::kNoTransform, true);/* priority modulator */
 
-	modulators[kSynthOscLinPhaseMod] = new Modulator(kDefaultOutputValueOFF, kSynthOsc_FM_PM_ModIndex, modTransform::kNoTransform, true);/* priority modulator */
+	modulators[kSynthOscLinPhaseMod] = createModulator(kDefaultOutputValueOFF, kSynthOsc_FM_PM_ModIndex, modTransform::kNoTransform, true);/* priority modulator */
 
-	modulators[kSynthOscPulseWidthMod] = new Modulator(kDefaultOutputValueOFF, kSynthOsc_PW_ModRange, modTransform::kNoTransform);
-	modulators[kSynthToOscOscPulseWidthMod] = new Modulator(kDefaultOutputValueOFF, kSynthOsc_PW_ModRange, modTransform::kNoTransform, true);/* priority modulator */
+	modulators[kSynthOscPulseWidthMod] = createModulator(kDefaultOutputValueOFF, kSynthOsc_PW_ModRange, modTransform::kNoTransform);
+	modulators[kSynthToOscOscPulseWidthMod] = createModulator(kDefaultOutputValueOFF, kSynthOsc_PW_ModRange, modTransform::kNoTransform, true);/* priority modulator */
 
-	modulators[kSynthOscAmpMod] = new Modulator(kDefaultOutputValueON, kSynthOsc_Amp_ModRange, modTransform::kAlwaysPositiveTransform);
+	modulators[kSynthOscAmpMod] = createModulator(kDefaultOutputValueON, kSynthOsc_Amp_ModRange, modTransform::kAlwaysPositiveTransform);
 
-	modulators[kSynthOscMaxDownAmpMod] = new Modulator(kDefaultOutputValueON, kSynthOsc_Amp_ModRange, modTransform::kMaxDownTransform);
+	modulators[kSynthOscMaxDownAmpMod] = createModulator(kDefaultOutputValueON, kSynthOsc_Amp_ModRange, modTransform::kMaxDownTransform);
 
 	/* the modulation range for this one will be changed for each portamento "session" */
-	modulators[kSynthOscPortamentoMod] = new Modulator(kDefaultOutputValueOFF, kSynthOsc_Pitch_ModRange,  modTransform::kNoTransform);
+	modulators[kSynthOscPortamentoMod] = createModulator(kDefaultOutputValueOFF, kSynthOsc_Pitch_ModRange,  modTransform::kNoTransform);
 
 	// --- validate all pointers
 	validComponent = validateComponent();
+
+	// --- a kernel for the default waveform until the first update
+	selectWaveformKernel();
 }
 
 /** Destructor: delete output array and modulators */
 SynthOscillator::~SynthOscillator()
 {
-	// --- destroy wavetables
-	destroyWaveTables();
-
-	// --- delete our arrays and nullify
-	if (outputs) delete[] outputs;
-	if (modulators)delete[] modulators;
-
-	outputs = nullptr;
-	modulators = nullptr;
+	// --- delete our arrays (and modulators) and nullify
+	destroyArrays();
 }
 
 /**
@@ -85,13 +77,9 @@ bool SynthOscillator::initializeComponent(InitializeInfo& info)
 	// --- bulk reset
 	resetComponent();
 
-	// --- recrate the tables only if sample rate has changed
+	// --- switch tables only if sample rate has changed
 	if (bNewSR)
-	{
-		// --- then recrate
-		destroyWaveTables();
-		createWaveTables();
-	}
+		selectWaveTables();
 
 	return true;
 }
@@ -145,7 +133,7 @@ bool SynthOscillator::resetComponent()
 	modCounter = 0.0;
 
 	// --- VA saw requires offset
-	if (oscWave == synthOscWaveform::kSaw)
+	if (oscWave == synthOscWaveform::kSaw || oscWave == synthOscWaveform::kSupersaw)
 		modCounter = 0.5;
 
 	// --- wavetable stuff
@@ -154,6 +142,9 @@ bool SynthOscillator::resetComponent()
 	// --- common to both VA and WT
 	phaseInc = 0.0;
 
+	// --- unison stack phases
+	resetUnisonStack();
+
 	// --- reset run/stop flag
 	noteOn = false;
 
@@ -247,8 +238,7 @@ bool SynthOscillator::updateComponent()
 			(modifiers->octave * 12) +										/* octave*12 = semitones */
 			modifiers->semitones +											/* raw semitones */
 			(modifiers->cents / 100.0) +									/* cents/100 = semitones */
-			(modifiers->masterTuningOffset_cents / 100.0) +					/* master tuning offset */
-			((unisonDetuneIntensity * modifiers->unisonDetune_cents) / 100.0));		/* unison detune in cents */
+			(modifiers->masterTuningOffset_cents / 100.0));					/* master tuning offset */
 
 	// --- apply tuning ratio for FM and other exotics
 	oscFrequencyNoPriorityMod *= (modifiers->oscFreqRatio * modifiers->masterTuningRatio);
@@ -280,6 +270,12 @@ bool SynthOscillator::updateComponent()
 	// --- select the wave table
 	selectTable();
 
+	// --- unison stack detune and pan
+	updateUnisonStack();
+
+	// --- the render kernel, on a waveform or channel layout change
+	selectWaveformKernel();
+
 	return true;
 }
 
@@ -352,39 +348,8 @@ bool SynthOscillator::doOscillate()
 	// --- check valid flag
 	if (!validComponent) return false;
 
-	double oscOutput = 0.0;
-
 	// --- decode oscillator
-	if (oscWave == synthOscWaveform::kSaw)
-	{
-		// --- VA oscillator
-		outputs[kLeftOscOutput] = doSawtooth();
-		outputs[kRightOscOutput] = outputs[kLeftOscOutput];
-	}
-	else if (oscWave == synthOscWaveform::kSquare)
-	{
-		// --- dual mono output for wavetable oscillator
-		outputs[kLeftOscOutput] = doSquareWave();
-		outputs[kRightOscOutput] = outputs[kLeftOscOutput];
-	}
-	else if (oscWave == synthOscWaveform::kTriangle)
-	{
-		// --- dual mono output for wavetable oscillator
-		outputs[kLeftOscOutput] = doTriangleWave();
-		outputs[kRightOscOutput] = outputs[kLeftOscOutput];
-	}
-	else if (oscWave == synthOscWaveform::kSin)
-	{
-		// --- dual mono output for wavetable oscillator
-		outputs[kLeftOscOutput] = doSineWave();
-		outputs[kRightOscOutput] = outputs[kLeftOscOutput];
-	}
-	else if (oscWave == synthOscWaveform::kWhiteNoise)
-	{
-		// --- dual mono output for noise oscillator
-		outputs[kLeftOscOutput] = doWhiteNoise();
-		outputs[kRightOscOutput] = outputs[kLeftOscOutput];
-	}
+	renderWaveform(outputs[kLeftOscOutput], outputs[kRightOscOutput]);
 
 	// --- additional outputs for AM
 	outputs[kOscUnipolarOutputFromMax] = bipolarToUnipolar(outputs[kLeftOscOutput]);
@@ -410,6 +375,101 @@ bool SynthOscillator::doOscillate()
 	return true;
 }
 
+/**
+	\brief Render the selected waveform with the kernel chosen by updateComponent( ); the supersaw needs a
+	SupersawOscillator and is a single saw here
+
+	\param left -- receives the left output
+	\param right -- receives the right output
+*/
+void SynthOscillator::renderWaveform(double& left, double& right)
+{
+	(this->*waveformKernel)(left, right);
+}
+
+/**
+	\brief One sample of one waveform. The waveform and channel layout are template arguments, so the tests below are
+	resolved by the compiler and each instantiation calls its render function directly.
+
+	\param left -- receives the left output
+	\param right -- receives the right output
+*/
+template <synthOscWaveform Waveform, uint32_t Channels>
+void SynthOscillator::renderWaveformKernel(double& left, double& right)
+{
+	if (Channels == 2)
+	{
+		// --- stereo output for the unison stack
+		doUnisonStack<Waveform>(left, right);
+	}
+	else if (Waveform == synthOscWaveform::kSaw || Waveform == synthOscWaveform::kSupersaw)
+	{
+		// --- VA oscillator
+		left = doSawtooth();
+		right = left;
+	}
+	else if (Waveform == synthOscWaveform::kSquare)
+	{
+		// --- dual mono output for wavetable oscillator
+		left = doSquareWave();
+		right = left;
+	}
+	else if (Waveform == synthOscWaveform::kTriangle)
+	{
+		// --- dual mono output for wavetable oscillator
+		left = doTriangleWave();
+		right = left;
+	}
+	else if (Waveform == synthOscWaveform::kSin)
+	{
+		// --- dual mono output for wavetable oscillator
+		left = doSineWave();
+		right = left;
+	}
+	else if (Waveform == synthOscWaveform::kWhiteNoise)
+	{
+		// --- dual mono output for noise oscillator
+		left = doWhiteNoise();
+		right = left;
+	}
+}
+
+/**
+	\brief Point waveformKernel at the kernel for the current waveform and channel layout, only when either has changed;
+	noise has no unison stack
+*/
+void SynthOscillator::selectWaveformKernel()
+{
+	uint32_t channels = unisonCount > 1 && oscWave != synthOscWaveform::kWhiteNoise ? 2 : 1;
+	if (waveformKernel && oscWave == kernelWave && channels == kernelChannels)
+		return;
+
+	kernelWave = oscWave;
+	kernelChannels = channels;
+
+	bool stereo = channels == 2;
+	switch (oscWave)
+	{
+		case synthOscWaveform::kSquare:		setWaveformKernel<synthOscWaveform::kSquare>(stereo); break;
+		case synthOscWaveform::kTriangle:	setWaveformKernel<synthOscWaveform::kTriangle>(stereo); break;
+		case synthOscWaveform::kSin:		setWaveformKernel<synthOscWaveform::kSin>(stereo); break;
+		case synthOscWaveform::kWhiteNoise:	setWaveformKernel<synthOscWaveform::kWhiteNoise>(stereo); break;
+
+		// --- kSupersaw is a saw here
+		default:							setWaveformKernel<synthOscWaveform::kSaw>(stereo); break;
+	}
+}
+
+/**
+	\brief Set waveformKernel to one of the two channel layouts of a waveform
+	\param stereo -- true for the unison stack
+*/
+template <synthOscWaveform Waveform>
+void SynthOscillator::setWaveformKernel(bool stereo)
+{
+	waveformKernel = stereo ? &SynthOscillator::renderWaveformKernel<Waveform, 2> : &SynthOscillator::renderWaveformKernel<Waveform, 1>;
+}
+
 /**
 	\brief Synthesize the VA Sawtooth waveform
 
@@ -473,6 +533,181 @@ double SynthOscillator::doSawtooth()
 	return output;
 }
 
+/**
+	\brief Rebuild the unison stack's detune ratios and pan gains when the count, detune or spread changes. Detune and
+	pan run together across the stack from -1 (flat, left) to +1 (sharp, right), the same layout the engine used to
+	give its seven unison voices; the level is 1/sqrt(N) since the stacked oscillators are not phase aligned.
+*/
+void SynthOscillator::updateUnisonStack()
+{
+	uint32_t count = modifiers->unisonCount;
+	if (count < 1) count = 1;
+	if (count > kMaxUnisonOscillators) count = kMaxUnisonOscillators;
+
+	// --- only on a change: each oscillator needs a pitch shift
+	if (count == unisonCount && modifiers->unisonDetune_cents == unisonDetune_cents && modifiers->unisonSpread_Pct == unisonSpread_Pct)
+		return;
+
+	unisonCount = count;
+	unisonDetune_cents = modifiers->unisonDetune_cents;
+	unisonSpread_Pct = modifiers->unisonSpread_Pct;
+
+	if (unisonCount == 1)
+		return;
+
+	double spread = unisonSpread_Pct / 100.0;
+	boundValue(spread, 0.0, 1.0);
+
+	double level = 1.0 / sqrt((double)unisonCount);
+	for (uint32_t i = 0; i < unisonCount; i++)
+	{
+		double position = -1.0 + 2.0*(double)i / (double)(unisonCount - 1);
+		unisonIncRatio[i] = pitchShiftTableLookup(position*unisonDetune_cents / 100.0);
+
+		double pan = position*spread;
+		unisonLeftGain[i] = level*fmin(1.0, 1.0 - pan);
+		unisonRightGain[i] = level*fmin(1.0, 1.0 + pan);
+	}
+}
+
+/**
+	\brief Reset the phases of the whole unison stack (all kMaxUnisonOscillators, so the count can change mid-note);
+	the phases are spread by the golden ratio so a new note does not start with all of its edges lined up.
+	The first oscillator starts where the single oscillator does.
+*/
+void SynthOscillator::resetUnisonStack()
+{
+	const double goldenRatioFraction = 0.6180339887498949;
+
+	for (uint32_t i = 0; i < kMaxUnisonOscillators; i++)
+	{
+		double phase = fmod(i*goldenRatioFraction, 1.0);
+		unisonModCounter[i] = fmod(0.5 + phase, 1.0); // --- VA saw offset, as in resetComponent( )
+		unisonReadIndex[i] = phase*kWaveTableLength;
+	}
+}
+
+/**
+	\brief Render the unison stack and pan it into a stereo pair
+
+	\param left -- receives the left output
+	\param right -- receives the right output
+*/
+template <synthOscWaveform Waveform>
+void SynthOscillator::doUnisonStack(double& left, double& right)
+{
+	double stackOutput[kMaxUnisonOscillators];
+
+	if (Waveform == synthOscWaveform::kSaw || Waveform == synthOscWaveform::kSupersaw)
+		doUnisonSawtooth(stackOutput);
+	else
+		doUnisonWaveTable(stackOutput);
+
+	left = 0.0;
+	right = 0.0;
+	for (uint32_t i = 0; i < unisonCount; i++)
+	{
+		left += unisonLeftGain[i] * stackOutput[i];
+		right += unisonRightGain[i] * stackOutput[i];
+	}
+}
+
+/**
+	\brief Synthesize the VA sawtooth for each oscillator in the unison stack. The phase accumulators and trivial saws
+	of the whole stack are one branch-free loop over plain arrays, which the compiler vectorizes; the BLEP correction
+	then only runs for the few oscillators that are near their edge on this sample.
+
+	\param stackOutput -- receives unisonCount output samples
+*/
+void SynthOscillator::doUnisonSawtooth(double* stackOutput)
+{
+	double phase[kMaxUnisonOscillators];
+	double inc[kMaxUnisonOscillators];
+
+	// --- phase accumulators: checkAndWrapModulo( ), then phase modulation as in doSawtooth( ); the directions of the
+	//     wraps are the same for the whole stack, so the loop itself has no branches
+	const double centerPhaseInc = phaseInc;
+	const double phaseModulation = phaseModuator;
+	const double wrapDown = centerPhaseInc > 0.0 ? 1.0 : 0.0;
+	const double wrapUp = centerPhaseInc < 0.0 ? 1.0 : 0.0;
+	const double modWrapDown = phaseModulation > 0.0 ? 1.0 : 0.0;
+	const double modWrapUp = phaseModulation < 0.0 ? 1.0 : 0.0;
+	const uint32_t count = unisonCount;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		double oscInc = centerPhaseInc*unisonIncRatio[i];
+		double counter = unisonModCounter[i];
+		counter -= counter >= 1.0 ? wrapDown : 0.0;
+		counter += counter <= 0.0 ? wrapUp : 0.0;
+		unisonModCounter[i] = counter + oscInc;
+
+		double finalCounter = counter + phaseModulation;
+		finalCounter -= finalCounter >= 1.0 ? modWrapDown : 0.0;
+		finalCounter += finalCounter <= 0.0 ? modWrapUp : 0.0;
+
+		phase[i] = finalCounter;
+		inc[i] = fabs(oscInc);
+		stackOutput[i] = 2.0*finalCounter - 1.0; // --- trivial saw
+	}
+
+	// --- hard sync follows the first oscillator
+	resetTrigger = phase[0] < inc[0];
+
+	// --- BLEP table and width for the (center) oscillator frequency, as in doSawtooth( )
+	const double* blepTable = &dBLEPTable_8_BLKHAR[0];
+	double pointsPerSide = 4.0;
+	bool interpolate = false;
+	if (oscFrequency > sampleRate / 4.0)
+	{
+		blepTable = &dBLEPTable[0];
+		pointsPerSide = 1.0;
+		interpolate = true;
+	}
+	else if (oscFrequency > sampleRate / 8.0)
+		pointsPerSide = 2.0;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		double width = pointsPerSide*inc[i];
+		if (phase[i] < width || phase[i] > 1.0 - width)
+			stackOutput[i] += doBLEP_N(blepTable, 4096, phase[i], inc[i], 1.0, false, pointsPerSide, interpolate);
+	}
+}
+
+/**
+	\brief Synthesize the wavetable waveforms for each oscillator in the unison stack, reusing the single oscillator
+	functions with each oscillator's read index and increment swapped in
+
+	\param stackOutput -- receives unisonCount output samples
+*/
+void SynthOscillator::doUnisonWaveTable(double* stackOutput)
+{
+	double centerPhaseInc = phaseInc;
+	double centerReadIndex = waveTableReadIndex;
+	bool firstResetTrigger = false;
+
+	for (uint32_t i = 0; i < unisonCount; i++)
+	{
+		phaseInc = centerPhaseInc*unisonIncRatio[i];
+		waveTableReadIndex = unisonReadIndex[i];
+
+		if (oscWave == synthOscWaveform::kSquare)
+			stackOutput[i] = doSquareWave();
+		else if (oscWave == synthOscWaveform::kTriangle)
+			stackOutput[i] = doTriangleWave();
+		else
+			stackOutput[i] = doSineWave();
+
+		unisonReadIndex[i] = waveTableReadIndex;
+		if (i == 0)
+			firstResetTrigger = resetTrigger;
+	}
+
+	phaseInc = centerPhaseInc;
+	waveTableReadIndex = centerReadIndex;
+	resetTrigger = firstResetTrigger;
+}
+
 /**
 	\brief Synthesize the Square wave using the sum-of-saws wavetable method
 
@@ -539,7 +774,8 @@ double SynthOscillator::doSineWave()
 }
 
 /**
-	\brief Create the wavetables; this happens at construction time and whenever the sample rate changes
+	\brief Calculate the wavetables in place; this happens at construction time and whenever the sample rate changes
+	to a rate that has no shared tables
 */
 void SynthOscillator::createWaveTables()
 {
@@ -554,13 +790,45 @@ void SynthOscillator::createWaveTables()
 	}
 
 	// --- SAW, TRIANGLE: need 9 tables
+	ownWaveTables.createWaveTables(sampleRate);
+}
+
+/**
+	\brief Point at the shared wave tables for the current sample rate; without them, use (and if the rate changed,
+	recalculate) our own. Selects the current table from the new set.
+*/
+void SynthOscillator::selectWaveTables()
+{
+	OscillatorWaveTables* sharedTables = midiData ? midiData->getOscillatorWaveTables() : nullptr;
+	WaveTableSet* sharedSet = sharedTables ? sharedTables->getWaveTableSet(sampleRate) : nullptr;
+
+	if (sharedSet)
+		waveTables = sharedSet;
+	else
+	{
+		if (ownWaveTables.sampleRate != sampleRate)
+			createWaveTables();
+		waveTables = &ownWaveTables;
+	}
+
+	selectTable();
+}
+
+/**
+	\brief Calculate the saw and triangle multi-tables in place for a sample rate
+	\param _sampleRate -- the sample rate
+*/
+void WaveTableSet::createWaveTables(double _sampleRate)
+{
+	sampleRate = _sampleRate;
+
 	double seedFreq = 27.5; // Note A0, bottom of piano
 	for (int j = 0; j < kNumWaveTables; j++)
 	{
-		double* sawTableAccumulator = new double[kWaveTableLength];
+		double* sawTableAccumulator = sawTables[j];
 		memset(sawTableAccumulator, 0, kWaveTableLength * sizeof(double));
 
-		double* triTableAccumulator = new double[kWaveTableLength];
+		double* triTableAccumulator = triangleTables[j];
 		memset(triTableAccumulator, 0, kWaveTableLength * sizeof(double));
 
 		int numHarmonics = (int)((sampleRate / 2.0 / seedFreq) - 1.0);
@@ -619,36 +887,40 @@ void SynthOscillator::createWaveTables()
 			triTableAccumulator[i] /= maxTriVavlue;
 		}
 
-		// --- store
-		sawTables[j] = sawTableAccumulator;
-		triangleTables[j] = triTableAccumulator;
-
 		// --- next table is one octave up
 		seedFreq *= 2.0;
 	}
 }
 
 /**
-	\brief Destroy the wavetables; this happens at construction time and whenever the sample rate changes
+	\brief Calculate the sets for a host rate and its 2x and 4x oversampled rates; a set already at its rate is kept,
+	so a reset at the same rate costs nothing. Call from reset( ), never from the audio thread.
+
+	\param hostSampleRate -- the host sample rate
 */
-void SynthOscillator::destroyWaveTables()
+void OscillatorWaveTables::createWaveTables(double hostSampleRate)
 {
-	for (int i = 0; i < kNumWaveTables; i++)
+	for (uint32_t i = 0; i < kNumWaveTableSets; i++)
 	{
-		double* p = sawTables[i];
-		if (p)
-		{
-			delete[] p;
-			sawTables[i] = 0;
-		}
+		double rate = hostSampleRate*(double)(1 << i);
+		if (waveTableSets[i].sampleRate != rate)
+			waveTableSets[i].createWaveTables(rate);
+	}
+}
 
-		p = triangleTables[i];
-		if (p)
-		{
-			delete[] p;
-			triangleTables[i] = 0;
-		}
+/**
+	\brief Find the set calculated for a sample rate
+	\param sampleRate -- the sample rate
+	\return the set, or nullptr if there is none for the rate
+*/
+WaveTableSet* OscillatorWaveTables::getWaveTableSet(double sampleRate)
+{
+	for (uint32_t i = 0; i < kNumWaveTableSets; i++)
+	{
+		if (waveTableSets[i].sampleRate == sampleRate && sampleRate > 0.0)
+			return &waveTableSets[i];
 	}
+	return nullptr;
 }
 
 /**
@@ -694,9 +966,9 @@ void SynthOscillator::selectTable()
 
 	// --- choose table
 	if (oscWave == synthOscWaveform::kSquare)
-		currentTable = sawTables[currentTableIndex];
+		currentTable = waveTables->sawTables[currentTableIndex];
 	else if (oscWave == synthOscWaveform::kTriangle)
-		currentTable = triangleTables[currentTableIndex];
+		currentTable = waveTables->triangleTables[currentTableIndex];
 	else if (oscWave == synthOscWaveform::kSin)
 		currentTable = &sineTable[0];
 }
@@ -27,8 +27,12 @@ const double kSynthOsc_Pitch_ModRange = 12.0;		// --> +/- 12 semitones, could al
 // --- other constants
 const unsigned int kNumWaveTables = 9;
 const unsigned int kWaveTableLength = 512;
+const unsigned int kNumWaveTableSets = 3;	// --- shared multi-table sets: one per voice oversampling rate (1x, 2x, 4x)
 const unsigned int kNumOscAudioOutputs = 2;
 
+// --- unison: most oscillators stacked inside one SynthOscillator
+const uint32_t kMaxUnisonOscillators = 16;
+
 // --- outputs[] indexes for this component
 enum {
 	kLeftOscOutputWithAmpGain,	/* output with user amp-gain applied */
@@ -55,7 +59,7 @@ enum {
 	kNumSynthOscModulators };
 
 // --- strongly typed enum for trivial oscillator type & mode
-enum class synthOscWaveform { kSaw, kSquare, kTriangle, kSin, kWhiteNoise};
+enum class synthOscWaveform { kSaw, kSquare, kTriangle, kSin, kWhiteNoise, kSupersaw};
 
 /**
 	\struct SynthOscModifiers
@@ -72,7 +76,12 @@ enum class synthOscWaveform { kSaw, kSquare, kTriangle, kSin, kWhiteNoise};
 	\param masterTuningRatio:			master tuning control using a ratio
 	\param masterTuningOffset_cents:	master tuning control using a pitch offset in cents
 	\param unisonDetune_cents:			master unison detuning amount in cents
+	\param unisonCount:					oscillators stacked per note [1, kMaxUnisonOscillators]; 1 = no stack (set by the SynthEngine in unison mode)
+	\param unisonSpread_Pct:			stereo spread of the stacked oscillators in percent
 	\param oscWave:						waveform for this oscillator; see enum class synthOscWaveform
+	\param supersawCount:				saws in the supersaw [1, kMaxSupersawSaws] (SupersawOscillator only)
+	\param supersawDetune_Pct:			supersaw detune knob in percent; mapped through the detune curve
+	\param supersawMix_Pct:				supersaw mix knob in percent: center saw vs. detuned saws
 	\param pulseWidthControl_Pct:		pulse width in percent [2%, 98%]
 	\param oscAmpControl_dB:			user controlled output control in dB
 	\param useOscFreqControl:			a flag that notifies the object to take its frequency value from the oscFreqControl rather than MIDI pitch
@@ -91,10 +100,17 @@ struct SynthOscModifiers
 	double masterTuningRatio = 1.0;			// --- for a global master tune value as a ratio
 	double masterTuningOffset_cents = 0.0;	// --- for a global master tune value in cents
 	double unisonDetune_cents = 0.0; // --- unison detune (master value)
+	uint32_t unisonCount = 1;			// --- stacked oscillators per note
+	double unisonSpread_Pct = 100.0;	// --- stereo spread of the stack
 
 	// --- strongly typed enum for trivial oscilator type
 	synthOscWaveform oscWave = synthOscWaveform::kSaw; // note default
 
+	// --- supersaw (SupersawOscillator only; a plain SynthOscillator renders a single saw)
+	uint32_t supersawCount = 7;			// --- saws in the supersaw
+	double supersawDetune_Pct = 50.0;	// --- detune knob
+	double supersawMix_Pct = 50.0;		// --- center vs. side saws
+
 	// --- pulse width
 	double pulseWidthControl_Pct = 50.0;	// --- pulse width as a percent, usually from user control [1%, 99%]
 
@@ -109,6 +125,52 @@ struct SynthOscModifiers
 
 };
 
+/**
+	\struct WaveTableSet
+	\ingroup SynthStructures
+	\brief The saw and triangle multi-tables for one sample rate; 9 of each for 9 octaves each starting on an A pitch
+
+	\param sampleRate:		the rate the tables were calculated for; 0 until they are
+	\param sawTables:		saw multi-tables (the square wave is a sum of two saws)
+	\param triangleTables:	triangle multi-tables
+*/
+struct WaveTableSet
+{
+	WaveTableSet() {}
+
+	// --- calculate the tables in place
+	void createWaveTables(double _sampleRate);
+
+	double sampleRate = 0.0;
+	double sawTables[kNumWaveTables][kWaveTableLength];
+	double triangleTables[kNumWaveTables][kWaveTableLength];
+};
+
+/**
+	\class OscillatorWaveTables
+	\ingroup SynthClasses
+	\brief The wave table sets for the host rate and the 2x and 4x oversampled rates.
+
+	The tables depend only on the sample rate, so the synth engine owns one OscillatorWaveTables for all of its
+	oscillators (see IMIDIData::getOscillatorWaveTables( )) and calculates the sets in reset( ). An oscillator selects the
+	set for its rate when it is initialized, so a voice oversampling switch on the audio thread only changes a pointer.
+	An oscillator without shared tables, or at a rate with no set, calculates its own.
+*/
+class OscillatorWaveTables
+{
+public:
+	OscillatorWaveTables() {}
+
+	// --- calculate the sets for a host rate; sets that are already at their rate are kept
+	void createWaveTables(double hostSampleRate);
+
+	// --- the set for a sample rate, nullptr if there is none
+	WaveTableSet* getWaveTableSet(double sampleRate);
+
+protected:
+	WaveTableSet waveTableSets[kNumWaveTableSets];	///< host rate x 1, 2, 4
+};
+
 /**
 	\class SynthOscillator
 	\ingroup SynthClasses
@@ -116,6 +178,13 @@ struct SynthOscModifiers
 	- uses Virtual Analog for Sawtooth waveform
 	- uses wavetable sum-of-saws for PWM square wave
 	- uses wavetable for triangle and sin waveforms
+	- unison: with unisonCount > 1 the oscillator renders a stack of detuned copies of its waveform, spread across the
+	  stereo field, in place of the single oscillator; one voice then plays a whole unison note (see doUnisonStack( ))
+	- derived oscillators add waveforms by overriding renderWaveform( ); here synthOscWaveform::kSupersaw is a single saw
+	  and the SupersawOscillator renders the real thing
+	- each waveform and channel layout (single or unison stack) is a template instantiation of renderWaveformKernel( );
+	  updateComponent( ) points waveformKernel at the one for the current mode, so the per-sample path does not test
+	  the waveform
 
 	Outputs: contains 7 outputs
 	- Left Output with user-controlled gain (in dB) applied
@@ -192,14 +261,35 @@ public:
 	double getOscFrequency() { return oscFrequency; }
 	double getMIDIPitchFrequency() { return midiNotePitch; }
 
-	// --- set our unison detune
-//	void setUnisonDetune(double _unisonDetune_Cents) { unisonDetune_Cents = _unisonDetune_Cents; }
-	void setUnisonDetuneIntensity(double _unisonDetuneIntensity) { unisonDetuneIntensity = _unisonDetuneIntensity; }
 	
 protected:
 	// --- do the oscillator operation; may be called externally
 	bool doOscillate();
+
+	// --- render the selected waveform into the left and right outputs; derived oscillators add waveforms here
+	virtual void renderWaveform(double& left, double& right);
+
+	// --- one sample of a waveform; Channels = 1 for the single oscillator (dual mono), 2 for the unison stack
+	template <synthOscWaveform Waveform, uint32_t Channels>
+	void renderWaveformKernel(double& left, double& right);
+
+	// --- the selected waveform kernel
+	typedef void (SynthOscillator::*WaveformKernel)(double& left, double& right);
+	void selectWaveformKernel();
+	template <synthOscWaveform Waveform>
+	void setWaveformKernel(bool stereo);
+	WaveformKernel waveformKernel = nullptr;							///< renderWaveformKernel( ) instantiation for the current mode
+	synthOscWaveform kernelWave = synthOscWaveform::kSaw;				///< waveform that waveformKernel was selected for
+	uint32_t kernelChannels = 0;										///< channel layout that waveformKernel was selected for
 	
+	// --- unison stack: detuned, panned copies of the waveform
+	void updateUnisonStack();
+	void resetUnisonStack();
+	template <synthOscWaveform Waveform>
+	void doUnisonStack(double& left, double& right);
+	void doUnisonSawtooth(double* stackOutput);
+	void doUnisonWaveTable(double* stackOutput);
+
 	// --- waveform render functions
 	double doSawtooth();
 	double doSquareWave();
@@ -226,7 +316,9 @@ protected:
 
 	// --- for wavetables
 	void createWaveTables();
-	void destroyWaveTables();
+
+	// --- point at the shared tables for the sample rate, or at (and if needed calculate) our own
+	void selectWaveTables();
 
 	// --- get index of multi-table to use based on note pitch frequency
 	int getTableIndex();
@@ -255,9 +347,6 @@ protected:
 	// --- the oscillator frequency with all modulations applied *EXCEPT* Frequency Modulation (FM)
 	double oscFrequency = 0.0;				///<the oscillator frequency with all modulations applied *EXCEPT* Frequency Modulation (FM)
 
-	// --- unison Detune, varies with each voice and not shared!
-	double unisonDetuneIntensity = 0.0;		///< unison detuning intensity scalar [0, +1]
-
 	// --- the FINAL PW for square wave only
 	double pulseWidth = 0.0;				///< the FINAL PW for square wave only, after modulations are applied
 
@@ -277,12 +366,23 @@ protected:
 	// --- WaveRable oscillator variables
 	double waveTableReadIndex = 0.0;		///< wavetable read location
 
+	// --- unison stack, one array entry per stacked oscillator (structure of arrays so the saw loop vectorizes)
+	uint32_t unisonCount = 1;										///< stacked oscillators; 1 = the single oscillator above
+	double unisonDetune_cents = 0.0;								///< detune the stack was built for
+	double unisonSpread_Pct = 0.0;									///< spread the stack was built for
+	double unisonIncRatio[kMaxUnisonOscillators] = { 0.0 };			///< detune as a ratio of phaseInc
+	double unisonModCounter[kMaxUnisonOscillators] = { 0.0 };		///< VA saw modulo counters
+	double unisonReadIndex[kMaxUnisonOscillators] = { 0.0 };		///< wavetable read locations
+	double unisonLeftGain[kMaxUnisonOscillators] = { 0.0 };		///< left gain, including the 1/sqrt(N) level
+	double unisonRightGain[kMaxUnisonOscillators] = { 0.0 };		///< right gain, including the 1/sqrt(N) level
+
 	// --- the tables
 	double sineTable[kWaveTableLength];		///< the single sine table
 
 	// --- multi-tables; 9 of them for 9 octaves each starting on an A pitch
-	double* sawTables[kNumWaveTables];		///< saw multi-tables; 9 of them for 9 octaves each starting on an A pitch
-	double* triangleTables[kNumWaveTables]; ///< triangle multi-tables; 9 of them for 9 octaves each starting on an A pitch
+	//     our own are stored in the object so that a sample rate change recalculates them without allocating
+	WaveTableSet ownWaveTables;					///< used when there are no shared tables for our rate
+	WaveTableSet* waveTables = &ownWaveTables;	///< the shared set for our rate, or ownWaveTables
 
 	// --- for storing current table
 	double* currentTable = nullptr;			///< the currently select4ed table
@@ -0,0 +1,190 @@
+// -----------------------------------------------------------------------------
+//    AllocationTripwireTest.cpp
+//
+//    Headless test of the allocation-free audio thread: drives a SynthEngine through reset,
+//    notes, controllers, mode and patch changes and block and sample rendering, and checks
+//    that AllocationTripwire::getTripCount( ) stays at 0 on the audio thread side. Returns 0
+//    if all checks pass.
+//
+//    SYNTH_ALLOCATION_TRIPWIRE must be defined for every file, so build it with all of the
+//    PluginObjects sources, from PluginObjects, with the plugin's compiler settings, e.g.:
+//    g++ -std=c++14 -DSYNTH_ALLOCATION_TRIPWIRE -I. -I../PluginKernel tests/AllocationTripwireTest.cpp *.cpp -o AllocationTripwireTest
+// -----------------------------------------------------------------------------
+#ifndef SYNTH_ALLOCATION_TRIPWIRE
+#error "build with SYNTH_ALLOCATION_TRIPWIRE defined for all files"
+#endif
+
+#include "SynthEngine.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+static int failures = 0;
+static SynthEngine* engine = nullptr;
+static double leftBuffer[512] = { 0.0 };
+static double rightBuffer[512] = { 0.0 };
+static void* volatile escapedMemory = nullptr;		///< keeps the compiler from removing the test allocations
+
+// --- report a stage that allocated on the audio thread and keep going
+static void checkTrips(const char* stage)
+{
+	uint64_t trips = AllocationTripwire::getTripCount();
+	if (trips != 0)
+	{
+		printf("FAILED: %s: %llu audio thread allocations, last size %zu\n", stage, (unsigned long long)trips,
+			   AllocationTripwire::getLastTripSize());
+		failures++;
+	}
+	AllocationTripwire::resetTripCount();
+}
+
+// --- render like a host: update, then blocks of uneven sizes, then the one sample path
+static void render(const char* stage, uint32_t sampleCount)
+{
+	static const uint32_t blockSizes[] = { 64, 37, 512, 1, 200 };
+	UpdateInfo updateInfo;
+	uint32_t rendered = 0;
+	uint32_t block = 0;
+	while (rendered < sampleCount)
+	{
+		uint32_t blockSize = blockSizes[block++ % 5];
+		if (blockSize > sampleCount - rendered)
+			blockSize = sampleCount - rendered;
+
+		engine->update(updateInfo);
+		engine->renderBlock(leftBuffer, rightBuffer, blockSize, 0);
+		rendered += blockSize;
+	}
+
+	double outputs[kNumEngineOutputs] = { 0.0 };
+	RenderInfo renderInfo;
+	renderInfo.numOutputChannels = kNumEngineOutputs;
+	renderInfo.outputData = &outputs[0];
+	for (uint32_t i = 0; i < 64; i++)
+	{
+		renderInfo.sampleOffset = i;
+		engine->render(renderInfo);
+	}
+	engine->flushMIDIEvents();
+
+	checkTrips(stage);
+}
+
+// --- MIDI straight into the engine, the way the host wrapper delivers it
+static void sendMIDI(uint32_t status, uint32_t channel, uint32_t data1, uint32_t data2)
+{
+	midiEvent event(status, channel, data1, data2, 0);
+	engine->processMIDIEvent(event);
+}
+
+int main()
+{
+	// --- count, don't assert, so every stage reports
+	AllocationTripwire::setAssertOnTrip(false);
+
+	// --- the tripwire itself: operator new always, malloc( ) where the C library can be interposed
+	{
+		AudioThreadScope audioThreadScope;
+		escapedMemory = new int(1);
+		delete (int*)escapedMemory;
+	}
+	if (AllocationTripwire::getTripCount() != 2)
+	{
+		printf("FAILED: new/delete in an audio thread scope were not counted\n");
+		failures++;
+	}
+	AllocationTripwire::resetTripCount();
+#if defined(__GLIBC__)
+	{
+		AudioThreadScope audioThreadScope;
+		escapedMemory = malloc(32);
+		free(escapedMemory);
+	}
+	if (AllocationTripwire::getTripCount() != 2)
+	{
+		printf("FAILED: malloc/free in an audio thread scope were not counted\n");
+		failures++;
+	}
+	AllocationTripwire::resetTripCount();
+#endif
+
+	// --- allocation outside a scope is not counted
+	engine = new SynthEngine;
+	ResetInfo resetInfo(44100, 16);
+	engine->reset(resetInfo);
+	checkTrips("construct and reset");
+
+	// --- every master FX on
+	std::shared_ptr<SynthEngineModifiers> modifiers = engine->getSynthEngineModifiers();
+	modifiers->chorusFXModifiers->enabled = true;
+	modifiers->delayFXModifiers->enabled = true;
+	modifiers->ensembleFXModifiers->enabled = true;
+	modifiers->reverbFXModifiers->enabled = true;
+	render("idle", 4096);
+
+	// --- more notes than voices, so some are stolen
+	for (uint32_t note = 0; note < 20; note++)
+		sendMIDI(NOTE_ON, 0, 40 + note, 100);
+	checkTrips("note on");
+	render("poly", 8192);
+
+	// --- controllers, then release everything
+	sendMIDI(CONTROL_CHANGE, 0, 1, 64);
+	sendMIDI(CONTROL_CHANGE, 0, 64, 127);
+	sendMIDI(PITCH_BEND, 0, 0, 80);
+	sendMIDI(CHANNEL_PRESSURE, 0, 50, 0);
+	for (uint32_t note = 0; note < 20; note++)
+		sendMIDI(NOTE_OFF, 0, 40 + note, 0);
+	sendMIDI(CONTROL_CHANGE, 0, 64, 0);
+	checkTrips("controllers and note off");
+	render("release", 8192);
+
+	// --- mono and unison modes
+	modifiers->synthMode = synthMode::kMono;
+	sendMIDI(NOTE_ON, 0, 60, 100);
+	sendMIDI(NOTE_ON, 0, 62, 100);
+	render("mono", 4096);
+	sendMIDI(NOTE_OFF, 0, 62, 0);
+	sendMIDI(NOTE_OFF, 0, 60, 0);
+
+	modifiers->synthMode = synthMode::kUnison;
+	sendMIDI(NOTE_ON, 0, 60, 100);
+	render("unison", 4096);
+	sendMIDI(NOTE_OFF, 0, 60, 0);
+
+	// --- MPE member channel expression
+	modifiers->synthMode = synthMode::kPoly;
+	modifiers->enableMPE = true;
+	render("mpe on", 64);
+	sendMIDI(NOTE_ON, 2, 60, 100);
+	sendMIDI(PITCH_BEND, 2, 0, 90);
+	sendMIDI(CONTROL_CHANGE, 2, 74, 90);
+	render("mpe", 4096);
+	sendMIDI(NOTE_OFF, 2, 60, 0);
+
+	// --- oversampling changes re-initialize the voice oscillators and filters
+	modifiers->voiceModifiers->oversampling = oversamplingMode::k2x;
+	sendMIDI(NOTE_ON, 0, 60, 100);
+	render("oversampling 2x", 4096);
+	modifiers->voiceModifiers->oversampling = oversamplingMode::k4x;
+	render("oversampling 4x", 4096);
+
+	// --- master FX order and bypass
+	modifiers->masterFXOrder[0] = kMasterFXReverb;
+	modifiers->masterFXOrder[3] = kMasterFXChorus;
+	render("fx order", 4096);
+	modifiers->reverbFXModifiers->enabled = false;
+	render("fx bypass", 8192);
+
+	// --- sample accurate events from the queues
+	midiEvent noteOn(NOTE_ON, 0, 70, 100, 10);
+	engine->queueMIDIEvent(noteOn);
+	engine->queueExternalMIDIEvent(noteOn);
+	checkTrips("queue events");
+	render("queued events", 256);
+
+	delete engine;
+
+	printf(failures == 0 ? "AllocationTripwireTest passed\n" : "AllocationTripwireTest: %d failures\n", failures);
+	return failures == 0 ? 0 : 1;
+}
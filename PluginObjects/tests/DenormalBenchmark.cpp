@@ -0,0 +1,142 @@
+// -----------------------------------------------------------------------------
+//    DenormalBenchmark.cpp
+//
+//    Render time of a decaying FX tail: a short note into a 100 mSec reverb and a 50 mSec,
+//    30% feedback delay, then 40 seconds of silence, rendered in 512 sample buffers. Prints
+//    the render time per second of audio for the first second (baseline), the worst second
+//    and the mean of the tail for the same tail three ways: with a DenormalGuard held per buffer
+//    (as PluginCore does), with only the objects' snapToZero( ), and fully unguarded, which
+//    shows the denormal spike. Returns 1 if the guarded tail is not faster (by its mean)
+//    than the unguarded one.
+//
+//    Build and run from PluginObjects, optimized, with the plugin's compiler settings, e.g.:
+//    g++ -std=c++14 -O2 -DSYNTH_DENORMAL_SNAP_SWITCH -I. -I../PluginKernel tests/DenormalBenchmark.cpp *.cpp -o DenormalBenchmark && ./DenormalBenchmark
+// -----------------------------------------------------------------------------
+#include "SynthEngine.h"
+#include "DenormalGuard.h"
+
+#include <chrono>
+#include <cstdio>
+
+// --- LIMITS (always at top)
+//
+const double kBenchmarkSampleRate = 44100.0;
+const uint32_t kBenchmarkBufferSize = 512;
+const uint32_t kBenchmarkSeconds = 40;
+
+#ifndef SYNTH_DENORMAL_SNAP_SWITCH
+#error build with -DSYNTH_DENORMAL_SNAP_SWITCH so that the unguarded run can turn snapToZero( ) off
+#endif
+
+// --- the snapToZero( ) switch (see synthobjects.h)
+bool enableDenormalSnap = true;
+
+// --- render the tail; returns the baseline, worst and mean tail render times in mSec per second of audio
+static void renderTail(bool useGuard, bool useSnap, double& baseline_mSec, double& worst_mSec, double& tail_mSec)
+{
+	enableDenormalSnap = useSnap;
+
+	SynthEngine* engine = new SynthEngine;
+	std::shared_ptr<SynthEngineModifiers> modifiers = engine->getSynthEngineModifiers();
+	modifiers->reverbFXModifiers->enabled = true;
+	modifiers->reverbFXModifiers->reverbTime_mSec = 100.0;
+	modifiers->delayFXModifiers->enabled = true;
+	modifiers->delayFXModifiers->delayTime_mSec = 50.0;
+	modifiers->delayFXModifiers->feedback_Pct = 30.0;
+
+	// --- an audible note: the voice modifiers default to closed filters and a delayed, repeating EG (the plugin sets
+	//     them from its controls), and a silent voice leaves the FX tail at exact zeros
+	std::shared_ptr<SynthVoiceModifiers> voiceModifiers = modifiers->voiceModifiers;
+	voiceModifiers->eg1Modifiers->delayTime_mSec = 0.0;
+	voiceModifiers->eg1Modifiers->repeatTime_mSec = 0.0;
+	voiceModifiers->eg1Modifiers->attackTime_mSec = 5.0;
+	voiceModifiers->eg1Modifiers->decayTime_mSec = 100.0;
+	voiceModifiers->eg1Modifiers->sustainLevel = 0.7;
+	voiceModifiers->eg1Modifiers->releaseTime_mSec = 100.0;
+	voiceModifiers->filter1Modifiers->fcControl = 2000.0;
+	voiceModifiers->filter2Modifiers->fcControl = 10000.0;
+
+	ResetInfo resetInfo(kBenchmarkSampleRate, 16);
+	engine->reset(resetInfo);
+	UpdateInfo updateInfo;
+	engine->update(updateInfo);
+
+	static double leftBuffer[kBenchmarkBufferSize];
+	static double rightBuffer[kBenchmarkBufferSize];
+	uint32_t buffersPerSecond = (uint32_t)(kBenchmarkSampleRate / kBenchmarkBufferSize);
+	uint32_t noteOffBuffer = (uint32_t)(0.05 * kBenchmarkSampleRate / kBenchmarkBufferSize);
+
+	midiEvent noteOn(NOTE_ON, 0, 60, 100, 0);
+	engine->processMIDIEvent(noteOn);
+
+	baseline_mSec = 0.0;
+	worst_mSec = 0.0;
+	tail_mSec = 0.0;
+	for (uint32_t second = 0; second < kBenchmarkSeconds; second++)
+	{
+		double renderTime_mSec = 0.0;
+		for (uint32_t buffer = 0; buffer < buffersPerSecond; buffer++)
+		{
+			if (second == 0 && buffer == noteOffBuffer)
+			{
+				midiEvent noteOff(NOTE_OFF, 0, 60, 0, 0);
+				engine->processMIDIEvent(noteOff);
+			}
+
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			if (useGuard)
+			{
+				DenormalGuard denormalGuard;
+				engine->update(updateInfo);
+				engine->renderBlock(leftBuffer, rightBuffer, kBenchmarkBufferSize, 0);
+			}
+			else
+			{
+				engine->update(updateInfo);
+				engine->renderBlock(leftBuffer, rightBuffer, kBenchmarkBufferSize, 0);
+			}
+			renderTime_mSec += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		// --- per second of audio
+		renderTime_mSec *= kBenchmarkSampleRate / (double)(buffersPerSecond * kBenchmarkBufferSize);
+		if (second == 0)
+			baseline_mSec = renderTime_mSec;
+		else
+		{
+			tail_mSec += renderTime_mSec / (double)(kBenchmarkSeconds - 1);
+			if (renderTime_mSec > worst_mSec)
+				worst_mSec = renderTime_mSec;
+		}
+	}
+
+	delete engine;
+	enableDenormalSnap = true;
+}
+
+int main()
+{
+	double baseline_mSec = 0.0;
+	double worst_mSec = 0.0;
+	double tail_mSec = 0.0;
+
+	renderTail(true, true, baseline_mSec, worst_mSec, tail_mSec);
+	printf("guard per buffer + snapToZero: baseline %.1f mSec/s, worst %.1f mSec/s, tail %.1f mSec/s\n", baseline_mSec, worst_mSec, tail_mSec);
+	double guardedTail_mSec = tail_mSec;
+
+	renderTail(false, true, baseline_mSec, worst_mSec, tail_mSec);
+	printf("snapToZero only:               baseline %.1f mSec/s, worst %.1f mSec/s, tail %.1f mSec/s\n", baseline_mSec, worst_mSec, tail_mSec);
+
+	renderTail(false, false, baseline_mSec, worst_mSec, tail_mSec);
+	printf("unguarded:                     baseline %.1f mSec/s, worst %.1f mSec/s, tail %.1f mSec/s (%.1fx the guarded tail)\n",
+		   baseline_mSec, worst_mSec, tail_mSec, guardedTail_mSec > 0.0 ? tail_mSec / guardedTail_mSec : 0.0);
+
+	// --- the guard has to pay for itself on the tail it exists for
+	if (guardedTail_mSec >= tail_mSec)
+	{
+		printf("FAILED: the guarded tail is not faster than the unguarded one\n");
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,175 @@
+// -----------------------------------------------------------------------------
+//    EngineTelemetryRingTest.cpp
+//
+//    Headless test of EngineTelemetryRing: empty, full, FIFO order, popLatestFrame( ),
+//    index wrap and one producer/one consumer thread pair. Returns 0 if all checks pass.
+//
+//    Build and run from PluginObjects:
+//    g++ -std=c++14 -O2 -pthread -I. tests/EngineTelemetryRingTest.cpp -o EngineTelemetryRingTest && ./EngineTelemetryRingTest
+// -----------------------------------------------------------------------------
+#include "EngineTelemetry.h"
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+static int failures = 0;
+
+// --- report a failed check and keep going
+static void check(bool condition, const char* what)
+{
+	if (!condition)
+	{
+		printf("FAILED: %s\n", what);
+		failures++;
+	}
+}
+
+// --- a frame with recognizable contents
+static EngineTelemetryFrame makeFrame(uint64_t blockIndex)
+{
+	EngineTelemetryFrame frame;
+	frame.blockIndex = blockIndex;
+	frame.peak[0] = (float)blockIndex;
+	frame.activeVoices = (uint32_t)(blockIndex % kMaxTelemetryVoices);
+	frame.voiceNote[blockIndex % kMaxTelemetryVoices] = 60;
+	return frame;
+}
+
+static void testEmpty()
+{
+	EngineTelemetryRing ring;
+	EngineTelemetryFrame frame = makeFrame(1234);
+
+	check(ring.getFrameCount() == 0, "new ring is empty");
+	check(!ring.popFrame(frame), "popFrame( ) on an empty ring fails");
+	check(!ring.popLatestFrame(frame), "popLatestFrame( ) on an empty ring fails");
+	check(frame.blockIndex == 1234, "a failed pop leaves the frame unchanged");
+}
+
+static void testFull()
+{
+	EngineTelemetryRing ring;
+
+	for (uint32_t i = 0; i < kTelemetryRingSize; i++)
+		check(ring.pushFrame(makeFrame(i)), "pushFrame( ) succeeds until the ring is full");
+
+	check(ring.getFrameCount() == kTelemetryRingSize, "full ring holds kTelemetryRingSize frames");
+	check(!ring.pushFrame(makeFrame(kTelemetryRingSize)), "pushFrame( ) on a full ring fails");
+	check(ring.getFrameCount() == kTelemetryRingSize, "a dropped frame does not change the count");
+
+	// --- the frames come out in order; the dropped one never appears
+	EngineTelemetryFrame frame;
+	for (uint32_t i = 0; i < kTelemetryRingSize; i++)
+	{
+		check(ring.popFrame(frame), "popFrame( ) succeeds while frames are waiting");
+		check(frame.blockIndex == i, "frames come out in push order");
+		check(frame.peak[0] == (float)i && frame.voiceNote[i % kMaxTelemetryVoices] == 60, "frame contents are copied");
+	}
+	check(!ring.popFrame(frame), "drained ring is empty");
+
+	// --- one slot free again
+	check(ring.pushFrame(makeFrame(99)), "pushFrame( ) succeeds after the reader drains");
+}
+
+static void testPopLatest()
+{
+	EngineTelemetryRing ring;
+	for (uint32_t i = 0; i < 10; i++)
+		ring.pushFrame(makeFrame(i));
+
+	EngineTelemetryFrame frame;
+	check(ring.popLatestFrame(frame), "popLatestFrame( ) succeeds while frames are waiting");
+	check(frame.blockIndex == 9, "popLatestFrame( ) returns the newest frame");
+	check(ring.getFrameCount() == 0, "popLatestFrame( ) drains the ring");
+	check(!ring.popLatestFrame(frame) && frame.blockIndex == 9, "second popLatestFrame( ) fails and leaves the frame");
+
+	// --- after a full ring the newest is the last frame that was accepted
+	for (uint32_t i = 0; i <= kTelemetryRingSize; i++)
+		ring.pushFrame(makeFrame(100 + i));
+	check(ring.popLatestFrame(frame), "popLatestFrame( ) on a full ring succeeds");
+	check(frame.blockIndex == 100 + kTelemetryRingSize - 1, "popLatestFrame( ) on a full ring returns the last accepted frame");
+
+	// --- clear( ) discards everything
+	ring.pushFrame(makeFrame(7));
+	ring.clear();
+	check(!ring.popFrame(frame), "clear( ) empties the ring");
+}
+
+static void testWrap()
+{
+	// --- many times around the ring with the reader two frames behind
+	EngineTelemetryRing ring;
+	EngineTelemetryFrame frame;
+	uint64_t nextRead = 0;
+	for (uint64_t i = 0; i < 20 * kTelemetryRingSize; i++)
+	{
+		check(ring.pushFrame(makeFrame(i)), "pushFrame( ) never fails with a reader two frames behind");
+		if (i >= 2)
+		{
+			check(ring.popFrame(frame) && frame.blockIndex == nextRead, "frames stay in order across the wrap");
+			nextRead++;
+		}
+	}
+	check(ring.getFrameCount() == 2, "two frames are left");
+}
+
+static void testThreads()
+{
+	// --- this producer retries when the ring is full (the engine drops the frame instead), so every frame must arrive
+	//     in order and intact while both ends wrap many times
+	const uint64_t frameCount = 20000;
+	EngineTelemetryRing ring;
+
+	std::atomic<bool> producerDone{ false };
+	std::thread producer([&ring, &producerDone, frameCount]()
+	{
+		for (uint64_t i = 0; i < frameCount; i++)
+		{
+			while (!ring.pushFrame(makeFrame(i)))
+				std::this_thread::yield();
+		}
+		producerDone.store(true, std::memory_order_release);
+	});
+
+	bool ordered = true;
+	bool intact = true;
+	uint64_t received = 0;
+	EngineTelemetryFrame frame;
+	for (;;)
+	{
+		// --- check the flag first, so a frame pushed before it was set is still popped below
+		bool done = producerDone.load(std::memory_order_acquire);
+		if (!ring.popFrame(frame))
+		{
+			if (done)
+				break;
+			std::this_thread::yield();
+			continue;
+		}
+
+		if (frame.blockIndex != received)
+			ordered = false;
+		if (frame.peak[0] != (float)frame.blockIndex)
+			intact = false;
+
+		received++;
+	}
+	producer.join();
+
+	check(ordered, "frames from another thread arrive in order");
+	check(intact, "frames from another thread arrive intact");
+	check(received == frameCount, "the reader received every frame");
+}
+
+int main()
+{
+	testEmpty();
+	testFull();
+	testPopLatest();
+	testWrap();
+	testThreads();
+
+	printf(failures == 0 ? "EngineTelemetryRingTest passed\n" : "EngineTelemetryRingTest: %d failures\n", failures);
+	return failures == 0 ? 0 : 1;
+}